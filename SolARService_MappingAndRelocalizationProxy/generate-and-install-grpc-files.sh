@@ -20,5 +20,7 @@
 
 pushd grpc > /dev/null
 ./generate.sh
+./generate.sh -p=solar_mapping_and_relocalization_proxy_v2.proto
 popd > /dev/null
-cp grpc/solar_mapping_and_relocalization_proxy.proto-gen/cpp/* src/grpc/
\ No newline at end of file
+cp grpc/solar_mapping_and_relocalization_proxy.proto-gen/cpp/* src/grpc/
+cp grpc/solar_mapping_and_relocalization_proxy_v2.proto-gen/cpp/* src/grpc/
\ No newline at end of file
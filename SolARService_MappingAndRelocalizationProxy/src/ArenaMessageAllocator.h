@@ -0,0 +1,175 @@
+/**
+ * @copyright Copyright (c) 2021 B-com http://www.b-com.com/
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ARENA_MESSAGE_ALLOCATOR_H
+#define ARENA_MESSAGE_ALLOCATOR_H
+
+#include <google/protobuf/arena.h>
+#include <grpcpp/impl/codegen/message_allocator.h>
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace com::bcom::solar::gprc
+{
+
+#define ARENA_INITIAL_BLOCK_SIZE (16 * 1024)
+
+/**
+ * @class RetainableMessages
+ * @brief Messages of a call that can be kept alive once the call is finished
+ *
+ * gRPC releases the messages of a call when it is finished. Each reference
+ * returned by retain() delays this release until it is destroyed: the data of
+ * a request can then be read in place after its call is answered.
+ */
+class RetainableMessages
+{
+    public:
+        virtual ~RetainableMessages() = default;
+
+        /// @brief Reference keeping the messages of a call alive (nullptr if they can not be retained)
+        static std::shared_ptr<const void> retain(grpc::experimental::RpcAllocatorState* state)
+        {
+            auto messages = dynamic_cast<RetainableMessages*>(state);
+            if (messages == nullptr)
+                return nullptr;
+            messages->m_references.fetch_add(1, std::memory_order_relaxed);
+            return std::shared_ptr<const void>(messages, [](RetainableMessages* retained) { retained->unref(); });
+        }
+
+    protected:
+        /// @brief Releases a reference: the messages are destroyed with the last one
+        void unref()
+        {
+            if (m_references.fetch_sub(1, std::memory_order_acq_rel) == 1)
+                destroy();
+        }
+
+        virtual void destroy() = 0;
+
+    private:
+        std::atomic<unsigned int> m_references{1};      // Reference of gRPC, released by Release()
+};
+
+/**
+ * @class ArenaMessageAllocator
+ * @brief gRPC message allocator giving each call its own protobuf arena
+ *
+ * The request and response messages (and all their nested messages) of a call
+ * are created on a per-call arena, which starts on a recycled initial block:
+ * the whole message tree is allocated and freed at once, without any call to
+ * the heap allocator in steady state (except for large bytes/string payloads).
+ * The messages of a call can be retained (RetainableMessages), even after the
+ * allocator is destroyed.
+ */
+template <class RequestT, class ResponseT>
+class ArenaMessageAllocator
+    : public grpc::experimental::MessageAllocator<RequestT, ResponseT>
+{
+    public:
+        explicit ArenaMessageAllocator(size_t initialBlockSize = ARENA_INITIAL_BLOCK_SIZE)
+            : m_blocks{std::make_shared<BlockPool>(initialBlockSize)}
+        {}
+
+        grpc::experimental::MessageHolder<RequestT, ResponseT>* AllocateMessages() override
+        {
+            return new ArenaMessageHolder(m_blocks, m_blocks->acquire());
+        }
+
+    private:
+
+        /// @brief Initial blocks of the arenas, ready to be reused
+        class BlockPool
+        {
+            public:
+                explicit BlockPool(size_t blockSize) : m_blockSize{blockSize} {}
+
+                size_t blockSize() const { return m_blockSize; }
+
+                std::unique_ptr<char[]> acquire()
+                {
+                    {
+                        std::unique_lock<std::mutex> lock(m_mutexBlocks);
+                        if (!m_freeBlocks.empty()) {
+                            std::unique_ptr<char[]> block = std::move(m_freeBlocks.back());
+                            m_freeBlocks.pop_back();
+                            return block;
+                        }
+                    }
+                    return std::unique_ptr<char[]>(new char[m_blockSize]);
+                }
+
+                void release(std::unique_ptr<char[]> block)
+                {
+                    std::unique_lock<std::mutex> lock(m_mutexBlocks);
+                    m_freeBlocks.push_back(std::move(block));
+                }
+
+            private:
+                size_t m_blockSize;
+                std::vector<std::unique_ptr<char[]>> m_freeBlocks;  // Initial blocks ready to be reused
+                std::mutex m_mutexBlocks;                           // Mutex used to control free blocks access
+        };
+
+        class ArenaMessageHolder
+            : public grpc::experimental::MessageHolder<RequestT, ResponseT>, public RetainableMessages
+        {
+            public:
+                ArenaMessageHolder(std::shared_ptr<BlockPool> blocks, std::unique_ptr<char[]> block)
+                    : m_blocks{std::move(blocks)}, m_block{std::move(block)}, m_arena{arenaOptions(*m_blocks, m_block.get())}
+                {
+                    this->set_request(google::protobuf::Arena::CreateMessage<RequestT>(&m_arena));
+                    this->set_response(google::protobuf::Arena::CreateMessage<ResponseT>(&m_arena));
+                }
+
+                void Release() override
+                {
+                    unref();
+                }
+
+            protected:
+                void destroy() override
+                {
+                    // The arena must be destroyed before its initial block is recycled
+                    std::shared_ptr<BlockPool> blocks = std::move(m_blocks);
+                    std::unique_ptr<char[]> block = std::move(m_block);
+                    delete this;
+                    blocks->release(std::move(block));
+                }
+
+            private:
+                static google::protobuf::ArenaOptions arenaOptions(const BlockPool& blocks, char* block)
+                {
+                    google::protobuf::ArenaOptions options;
+                    options.initial_block = block;
+                    options.initial_block_size = blocks.blockSize();
+                    return options;
+                }
+
+                std::shared_ptr<BlockPool> m_blocks;
+                std::unique_ptr<char[]> m_block;
+                google::protobuf::Arena m_arena;
+        };
+
+        std::shared_ptr<BlockPool> m_blocks;        // Shared with the messages, which may outlive the allocator
+};
+
+} // namespace com::bcom::solar::gprc
+
+#endif // ARENA_MESSAGE_ALLOCATOR_H
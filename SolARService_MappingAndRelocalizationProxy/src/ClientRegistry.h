@@ -0,0 +1,137 @@
+/**
+ * @copyright Copyright (c) 2021 B-com http://www.b-com.com/
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CLIENT_REGISTRY_H
+#define CLIENT_REGISTRY_H
+
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <vector>
+
+// Number of independent shards (power of 2)
+#define CLIENT_REGISTRY_NB_SHARDS 16
+
+namespace com::bcom::solar::gprc
+{
+
+/**
+ * @class ClientRegistry
+ * @brief Read-mostly map of client contexts, indexed by client UUID
+ *
+ * Every request looks up its client, while clients are rarely registered or
+ * unregistered. Clients are spread over independent shards according to the
+ * hash of their UUID: lookups take a shared lock on one shard only, so
+ * lookups never wait for each other, and a registration only blocks the
+ * lookups of its shard.
+ * A shard holds a few clients in a vector: the hash, computed once per call,
+ * is compared before the UUID.
+ * Thread safe.
+ */
+template <class T>
+class ClientRegistry
+{
+    public:
+        /// @brief Add a client
+        /// @return false if a client is already registered with this UUID
+        bool insert(const std::string& clientUUID, std::shared_ptr<T> value)
+        {
+            size_t hash = std::hash<std::string>{}(clientUUID);
+            Shard& shard = m_shards[hash % CLIENT_REGISTRY_NB_SHARDS];
+
+            std::unique_lock<std::shared_mutex> lock(shard.mutex);
+            if (shard.indexOf(hash, clientUUID) < shard.entries.size())
+                return false;
+            shard.entries.push_back(Entry{hash, clientUUID, std::move(value)});
+            return true;
+        }
+
+        /// @brief Give the client registered with a UUID (nullptr if unknown)
+        std::shared_ptr<T> find(const std::string& clientUUID) const
+        {
+            size_t hash = std::hash<std::string>{}(clientUUID);
+            const Shard& shard = m_shards[hash % CLIENT_REGISTRY_NB_SHARDS];
+
+            std::shared_lock<std::shared_mutex> lock(shard.mutex);
+            size_t index = shard.indexOf(hash, clientUUID);
+            return (index < shard.entries.size()) ? shard.entries[index].value : nullptr;
+        }
+
+        /// @brief Remove a client
+        /// @return false if no client is registered with this UUID
+        bool erase(const std::string& clientUUID)
+        {
+            size_t hash = std::hash<std::string>{}(clientUUID);
+            Shard& shard = m_shards[hash % CLIENT_REGISTRY_NB_SHARDS];
+
+            std::shared_ptr<T> removed;     // Released after the lock
+            std::unique_lock<std::shared_mutex> lock(shard.mutex);
+            size_t index = shard.indexOf(hash, clientUUID);
+            if (index == shard.entries.size())
+                return false;
+            removed = std::move(shard.entries[index].value);
+            if (index + 1 < shard.entries.size())
+                shard.entries[index] = std::move(shard.entries.back());
+            shard.entries.pop_back();
+            return true;
+        }
+
+        /// @brief Give the number of registered clients
+        size_t size() const
+        {
+            size_t size = 0;
+            for (const Shard& shard : m_shards) {
+                std::shared_lock<std::shared_mutex> lock(shard.mutex);
+                size += shard.entries.size();
+            }
+            return size;
+        }
+
+    private:
+        struct Entry
+        {
+            size_t hash;
+            std::string clientUUID;
+            std::shared_ptr<T> value;
+        };
+
+        // Each shard on its own cache line: lookups of different shards do not share lock data
+        struct alignas(64) Shard
+        {
+            mutable std::shared_mutex mutex;
+            std::vector<Entry> entries;
+
+            // Index of a client in entries (entries.size() if not found)
+            size_t indexOf(size_t hash, const std::string& clientUUID) const
+            {
+                size_t index = 0;
+                while ((index < entries.size())
+                       && ((entries[index].hash != hash) || (entries[index].clientUUID != clientUUID)))
+                    index++;
+                return index;
+            }
+        };
+
+        std::array<Shard, CLIENT_REGISTRY_NB_SHARDS> m_shards;
+};
+
+} // namespace com::bcom::solar::gprc
+
+#endif // CLIENT_REGISTRY_H
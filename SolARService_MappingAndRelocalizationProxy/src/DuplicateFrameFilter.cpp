@@ -0,0 +1,60 @@
+/**
+ * @copyright Copyright (c) 2021 B-com http://www.b-com.com/
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "DuplicateFrameFilter.h"
+
+#include <algorithm>
+#include <bitset>
+
+namespace com::bcom::solar::gprc
+{
+
+DuplicateFrameFilter::DuplicateFrameFilter(unsigned int maxDistance, unsigned int historySize, unsigned int maxAgeMs)
+    : m_maxDistance{maxDistance}, m_historySize{std::max(1u, historySize)}, m_maxAgeMs{static_cast<long>(maxAgeMs)}
+{
+    m_history.reserve(m_historySize);
+}
+
+bool DuplicateFrameFilter::isDuplicate(long timestamp, uint64_t hash)
+{
+    if (!enabled())
+        return false;
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+
+    for (const Entry& entry : m_history) {
+        if ((timestamp >= entry.timestamp) && (timestamp - entry.timestamp < m_maxAgeMs)
+            && (std::bitset<64>(entry.hash ^ hash).count() <= m_maxDistance))
+            return true;
+    }
+
+    if (m_history.size() < m_historySize)
+        m_history.push_back(Entry{timestamp, hash});
+    else {
+        m_history[m_next] = Entry{timestamp, hash};
+        m_next = (m_next + 1) % m_historySize;
+    }
+    return false;
+}
+
+void DuplicateFrameFilter::reset()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_history.clear();
+    m_next = 0;
+}
+
+} // namespace com::bcom::solar::gprc
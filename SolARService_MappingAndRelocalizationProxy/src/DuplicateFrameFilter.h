@@ -0,0 +1,76 @@
+/**
+ * @copyright Copyright (c) 2021 B-com http://www.b-com.com/
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef DUPLICATE_FRAME_FILTER_H
+#define DUPLICATE_FRAME_FILTER_H
+
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace com::bcom::solar::gprc
+{
+
+/**
+ * @class DuplicateFrameFilter
+ * @brief Detection of the frames visually identical to a recent forwarded frame
+ *
+ * The difference hashes of the last forwarded frames of a client are kept in
+ * a small history. A frame whose hash is within a Hamming distance of one of
+ * them is a duplicate (blocked camera, static scene), whatever the device
+ * pose. History entries expire after a maximum age (frame timestamps): at
+ * least one frame is forwarded per period, even if the scene never changes.
+ * A null distance disables the filter (no frame is a duplicate).
+ * Thread safe.
+ */
+class DuplicateFrameFilter
+{
+    public:
+        /// @param[in] maxDistance: maximum Hamming distance (bits) between the hashes of duplicate frames (0: disabled)
+        /// @param[in] historySize: number of forwarded frames compared with a new frame
+        /// @param[in] maxAgeMs: age (milliseconds) after which a forwarded frame is no longer compared
+        DuplicateFrameFilter(unsigned int maxDistance, unsigned int historySize, unsigned int maxAgeMs);
+
+        bool enabled() const { return m_maxDistance > 0; }
+
+        /// @brief Indicates if a frame duplicates a recent forwarded frame
+        /// If not, the frame is added to the history as a forwarded frame.
+        /// @param[in] timestamp: frame timestamp (milliseconds)
+        /// @param[in] hash: difference hash of the frame image
+        bool isDuplicate(long timestamp, uint64_t hash);
+
+        /// @brief Clear the history (client restarted)
+        void reset();
+
+    private:
+        struct Entry
+        {
+            long timestamp;
+            uint64_t hash;
+        };
+
+        unsigned int m_maxDistance;
+        unsigned int m_historySize;
+        long m_maxAgeMs;
+
+        mutable std::mutex m_mutex;
+        std::vector<Entry> m_history;       // Circular buffer of the last forwarded frames
+        size_t m_next = 0;                  // Index of the next entry to replace (history full)
+};
+
+} // namespace com::bcom::solar::gprc
+
+#endif // DUPLICATE_FRAME_FILTER_H
@@ -0,0 +1,434 @@
+/**
+ * @copyright Copyright (c) 2021 B-com http://www.b-com.com/
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "FrameRecording.h"
+
+#include <cstring>
+
+#ifdef _WIN32
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// Size of the write buffer: large sequential writes
+#define RECORDING_WRITE_BUFFER_SIZE (8 * 1024 * 1024)
+
+#define RECORDING_MAGIC "SOLARREC"
+#define RECORDING_INDEX_MAGIC "SOLARIDX"
+
+namespace com::bcom::solar::gprc
+{
+
+namespace
+{
+
+uint64_t paddedSize(uint64_t size)
+{
+    return (size + 7) & ~static_cast<uint64_t>(7);
+}
+
+} // anonymous namespace
+
+FrameRecordingWriter::~FrameRecordingWriter()
+{
+    close();
+}
+
+bool FrameRecordingWriter::open(const std::string& path, const std::string& clientUUID,
+                                const std::vector<RecordingCamera>& cameras)
+{
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+
+        if (m_file != nullptr)
+            return false;
+
+        m_file = std::fopen(path.c_str(), "wb");
+        if (m_file == nullptr)
+            return false;
+
+        m_buffer.resize(RECORDING_WRITE_BUFFER_SIZE);
+        std::setvbuf(m_file, m_buffer.data(), _IOFBF, m_buffer.size());
+
+        m_path = path;
+        m_offset = 0;
+        m_cameras.clear();
+        m_index.clear();
+        m_error = false;
+
+        RecordingFileHeader header = {};
+        std::memcpy(header.magic, RECORDING_MAGIC, sizeof(header.magic));
+        header.version = RECORDING_VERSION;
+        std::strncpy(header.clientUUID, clientUUID.c_str(), sizeof(header.clientUUID) - 1);
+        write(&header, sizeof(header));
+    }
+
+    for (const auto& camera : cameras)
+        writeCamera(camera);
+
+    return !m_error;
+}
+
+bool FrameRecordingWriter::writeCamera(const RecordingCamera& camera)
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+
+    if (m_file == nullptr)
+        return false;
+
+    m_cameras.push_back(camera);
+    return writeChunk(RecordingChunkType::CAMERA, &camera, sizeof(camera));
+}
+
+bool FrameRecordingWriter::writeFrame(int64_t timestamp, const std::vector<RecordingImage>& images)
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+
+    if (m_file == nullptr)
+        return false;
+
+    uint64_t size = sizeof(RecordingFrameHeader);
+    for (const auto& image : images)
+        size += sizeof(RecordingImageHeader) + paddedSize(image.header.dataSize);
+
+    m_index.push_back(RecordingIndexEntry{timestamp, m_offset});
+
+    RecordingChunkHeader chunkHeader = {};
+    chunkHeader.type = static_cast<uint32_t>(RecordingChunkType::FRAME);
+    chunkHeader.size = size;
+    write(&chunkHeader, sizeof(chunkHeader));
+
+    RecordingFrameHeader frameHeader = {};
+    frameHeader.timestamp = timestamp;
+    frameHeader.nbImages = static_cast<uint32_t>(images.size());
+    write(&frameHeader, sizeof(frameHeader));
+
+    for (const auto& image : images) {
+        write(&image.header, sizeof(image.header));
+        write(image.data, image.header.dataSize);
+        writePadding(image.header.dataSize);
+    }
+
+    return !m_error;
+}
+
+bool FrameRecordingWriter::close()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+
+    if (m_file == nullptr)
+        return false;
+
+    // Index: cameras, then frames
+    uint64_t indexOffset = m_offset;
+    RecordingChunkHeader chunkHeader = {};
+    chunkHeader.type = static_cast<uint32_t>(RecordingChunkType::INDEX);
+    chunkHeader.size = m_cameras.size() * sizeof(RecordingCamera) + m_index.size() * sizeof(RecordingIndexEntry);
+    write(&chunkHeader, sizeof(chunkHeader));
+    write(m_cameras.data(), m_cameras.size() * sizeof(RecordingCamera));
+    write(m_index.data(), m_index.size() * sizeof(RecordingIndexEntry));
+
+    RecordingTrailer trailer = {};
+    trailer.indexOffset = indexOffset;
+    trailer.nbFrames = m_index.size();
+    trailer.nbCameras = static_cast<uint32_t>(m_cameras.size());
+    std::memcpy(trailer.magic, RECORDING_INDEX_MAGIC, sizeof(trailer.magic));
+    write(&trailer, sizeof(trailer));
+
+    if (std::fclose(m_file) != 0)
+        m_error = true;
+    m_file = nullptr;
+    std::vector<char>().swap(m_buffer);
+
+    return !m_error;
+}
+
+uint64_t FrameRecordingWriter::nbFrames() const
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    return m_index.size();
+}
+
+uint64_t FrameRecordingWriter::size() const
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    return m_offset;
+}
+
+bool FrameRecordingWriter::writeChunk(RecordingChunkType type, const void* payload, uint64_t size)
+{
+    RecordingChunkHeader chunkHeader = {};
+    chunkHeader.type = static_cast<uint32_t>(type);
+    chunkHeader.size = paddedSize(size);
+    write(&chunkHeader, sizeof(chunkHeader));
+    write(payload, size);
+    writePadding(size);
+    return !m_error;
+}
+
+bool FrameRecordingWriter::write(const void* data, uint64_t size)
+{
+    if ((size > 0) && (std::fwrite(data, 1, size, m_file) != size))
+        m_error = true;
+    m_offset += size;
+    return !m_error;
+}
+
+bool FrameRecordingWriter::writePadding(uint64_t size)
+{
+    static const char padding[8] = {};
+    return write(padding, paddedSize(size) - size);
+}
+
+FrameRecordingReader::~FrameRecordingReader()
+{
+    close();
+}
+
+bool FrameRecordingReader::open(const std::string& path)
+{
+    close();
+
+    if (!map(path))
+        return false;
+
+    const RecordingFileHeader* header = reinterpret_cast<const RecordingFileHeader*>(m_data);
+    if ((m_size < sizeof(RecordingFileHeader))
+            || (std::memcmp(header->magic, RECORDING_MAGIC, sizeof(header->magic)) != 0)
+            || (header->version != RECORDING_VERSION)) {
+        close();
+        return false;
+    }
+    m_clientUUID.assign(header->clientUUID, strnlen(header->clientUUID, sizeof(header->clientUUID)));
+
+    if (!readIndex()) {
+        // Recording interrupted: no index
+        m_recovered = true;
+        if (!scanChunks()) {
+            close();
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void FrameRecordingReader::close()
+{
+    unmap();
+    m_clientUUID.clear();
+    m_cameras.clear();
+    m_index.clear();
+    m_recovered = false;
+}
+
+bool FrameRecordingReader::frame(size_t index, RecordingFrameView& frame) const
+{
+    if (index >= m_index.size())
+        return false;
+
+    // Index entries are checked when the index is read: the chunk and frame headers are in the file
+    uint64_t offset = m_index[index].offset;
+    const RecordingChunkHeader* chunkHeader = reinterpret_cast<const RecordingChunkHeader*>(m_data + offset);
+    offset += sizeof(RecordingChunkHeader);
+    if ((chunkHeader->size < sizeof(RecordingFrameHeader)) || (chunkHeader->size > m_size - offset))
+        return false;
+    uint64_t end = offset + chunkHeader->size;
+
+    const RecordingFrameHeader* frameHeader = reinterpret_cast<const RecordingFrameHeader*>(m_data + offset);
+    offset += sizeof(RecordingFrameHeader);
+    if (frameHeader->nbImages > (end - offset) / sizeof(RecordingImageHeader))
+        return false;
+
+    frame.timestamp = frameHeader->timestamp;
+    frame.images.resize(frameHeader->nbImages);
+    for (auto& image : frame.images) {
+        if (sizeof(RecordingImageHeader) > end - offset)
+            return false;
+        image.header = reinterpret_cast<const RecordingImageHeader*>(m_data + offset);
+        offset += sizeof(RecordingImageHeader);
+        if (paddedSize(image.header->dataSize) > end - offset)
+            return false;
+        image.data = m_data + offset;
+        offset += paddedSize(image.header->dataSize);
+    }
+
+    return true;
+}
+
+bool FrameRecordingReader::readIndex()
+{
+    if ((m_size < sizeof(RecordingFileHeader) + sizeof(RecordingChunkHeader) + sizeof(RecordingTrailer))
+            || (m_size % 8 != 0))
+        return false;
+
+    const RecordingTrailer* trailer = reinterpret_cast<const RecordingTrailer*>(m_data + m_size - sizeof(RecordingTrailer));
+    if (std::memcmp(trailer->magic, RECORDING_INDEX_MAGIC, sizeof(trailer->magic)) != 0)
+        return false;
+
+    // Index chunk between the frame chunks and the trailer (sizes bounded first: no overflow)
+    uint64_t maxIndexSize = m_size - sizeof(RecordingFileHeader) - sizeof(RecordingChunkHeader) - sizeof(RecordingTrailer);
+    if ((trailer->nbCameras > maxIndexSize / sizeof(RecordingCamera))
+            || (trailer->nbFrames > maxIndexSize / sizeof(RecordingIndexEntry))
+            || (trailer->indexOffset < sizeof(RecordingFileHeader))
+            || (trailer->indexOffset > sizeof(RecordingFileHeader) + maxIndexSize))
+        return false;
+    uint64_t indexSize = trailer->nbCameras * sizeof(RecordingCamera) + trailer->nbFrames * sizeof(RecordingIndexEntry);
+    if (trailer->indexOffset + sizeof(RecordingChunkHeader) + indexSize + sizeof(RecordingTrailer) != m_size)
+        return false;
+
+    const uint8_t* index = m_data + trailer->indexOffset + sizeof(RecordingChunkHeader);
+    const RecordingIndexEntry* entries = reinterpret_cast<const RecordingIndexEntry*>(
+                index + trailer->nbCameras * sizeof(RecordingCamera));
+
+    // Frame chunk and frame headers of each entry before the index (aligned: read in place)
+    for (uint64_t i = 0; i < trailer->nbFrames; i++) {
+        uint64_t offset = entries[i].offset;
+        if ((offset < sizeof(RecordingFileHeader)) || (offset % 8 != 0)
+                || (offset > trailer->indexOffset)
+                || (sizeof(RecordingChunkHeader) + sizeof(RecordingFrameHeader) > trailer->indexOffset - offset))
+            return false;
+    }
+
+    const RecordingCamera* cameras = reinterpret_cast<const RecordingCamera*>(index);
+    m_cameras.assign(cameras, cameras + trailer->nbCameras);
+    m_index.assign(entries, entries + trailer->nbFrames);
+
+    return true;
+}
+
+bool FrameRecordingReader::scanChunks()
+{
+    // Chunks are read up to the last complete one
+    uint64_t offset = sizeof(RecordingFileHeader);
+    while (offset + sizeof(RecordingChunkHeader) <= m_size) {
+        const RecordingChunkHeader* chunkHeader = reinterpret_cast<const RecordingChunkHeader*>(m_data + offset);
+        uint64_t payloadOffset = offset + sizeof(RecordingChunkHeader);
+        if (chunkHeader->size > m_size - payloadOffset)
+            break;
+
+        switch (static_cast<RecordingChunkType>(chunkHeader->type))
+        {
+        case RecordingChunkType::CAMERA:
+            if (chunkHeader->size >= sizeof(RecordingCamera))
+                m_cameras.push_back(*reinterpret_cast<const RecordingCamera*>(m_data + payloadOffset));
+            break;
+        case RecordingChunkType::FRAME:
+            if (chunkHeader->size >= sizeof(RecordingFrameHeader)) {
+                const RecordingFrameHeader* frameHeader = reinterpret_cast<const RecordingFrameHeader*>(m_data + payloadOffset);
+                m_index.push_back(RecordingIndexEntry{frameHeader->timestamp, offset});
+            }
+            break;
+        default:
+            break;
+        }
+
+        offset = payloadOffset + chunkHeader->size;
+    }
+
+    return true;
+}
+
+#ifdef _WIN32
+
+bool FrameRecordingReader::map(const std::string& path)
+{
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                              FILE_FLAG_RANDOM_ACCESS, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+        return false;
+
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file, &size) || (size.QuadPart == 0)) {
+        CloseHandle(file);
+        return false;
+    }
+
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (mapping == nullptr) {
+        CloseHandle(file);
+        return false;
+    }
+
+    const void* data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (data == nullptr) {
+        CloseHandle(mapping);
+        CloseHandle(file);
+        return false;
+    }
+
+    m_fileHandle = file;
+    m_mappingHandle = mapping;
+    m_data = static_cast<const uint8_t*>(data);
+    m_size = static_cast<uint64_t>(size.QuadPart);
+    return true;
+}
+
+void FrameRecordingReader::unmap()
+{
+    if (m_data != nullptr)
+        UnmapViewOfFile(m_data);
+    if (m_mappingHandle != nullptr)
+        CloseHandle(m_mappingHandle);
+    if (m_fileHandle != nullptr)
+        CloseHandle(m_fileHandle);
+    m_data = nullptr;
+    m_mappingHandle = nullptr;
+    m_fileHandle = nullptr;
+    m_size = 0;
+}
+
+#else
+
+bool FrameRecordingReader::map(const std::string& path)
+{
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+        return false;
+
+    struct stat status;
+    if ((fstat(fd, &status) != 0) || (status.st_size == 0)) {
+        ::close(fd);
+        return false;
+    }
+
+    void* data = mmap(nullptr, static_cast<size_t>(status.st_size), PROT_READ, MAP_SHARED, fd, 0);
+    // The mapping stays valid after the file is closed
+    ::close(fd);
+    if (data == MAP_FAILED)
+        return false;
+
+    m_data = static_cast<const uint8_t*>(data);
+    m_size = static_cast<uint64_t>(status.st_size);
+    return true;
+}
+
+void FrameRecordingReader::unmap()
+{
+    if (m_data != nullptr)
+        munmap(const_cast<uint8_t*>(m_data), static_cast<size_t>(m_size));
+    m_data = nullptr;
+    m_size = 0;
+}
+
+#endif // _WIN32
+
+} // namespace com::bcom::solar::gprc
@@ -0,0 +1,251 @@
+/**
+ * @copyright Copyright (c) 2021 B-com http://www.b-com.com/
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FRAME_RECORDING_H
+#define FRAME_RECORDING_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#define RECORDING_FILE_EXTENSION ".solarrec"
+#define RECORDING_VERSION 1
+
+namespace com::bcom::solar::gprc
+{
+
+/*
+ * Frame recording file format (little endian, all blocks aligned on 8 bytes)
+ *
+ *   RecordingFileHeader
+ *   chunks: RecordingChunkHeader + payload (padded to 8 bytes)
+ *     CAMERA: RecordingCamera
+ *     FRAME:  RecordingFrameHeader, then for each image:
+ *             RecordingImageHeader + image data (padded to 8 bytes)
+ *     INDEX:  RecordingCamera for each camera chunk, then
+ *             RecordingIndexEntry for each frame chunk, in recording order
+ *   RecordingTrailer (last 32 bytes: offset of the index chunk)
+ *
+ * Images are stored as received from the client (raw pixels or original
+ * PNG/JPEG data, same layout and compression values as the gRPC messages).
+ * Camera chunks are written before the frames they apply to. A file without
+ * trailer (recording interrupted) is read by scanning the chunks.
+ */
+
+enum class RecordingChunkType : uint32_t {
+    CAMERA = 1,
+    FRAME = 2,
+    INDEX = 3
+};
+
+struct RecordingFileHeader
+{
+    char magic[8];              // "SOLARREC"
+    uint32_t version;
+    uint32_t reserved;
+    char clientUUID[48];        // Null terminated
+};
+
+struct RecordingChunkHeader
+{
+    uint32_t type;              // RecordingChunkType
+    uint32_t reserved;
+    uint64_t size;              // Payload size, padding included
+};
+
+struct RecordingCamera
+{
+    uint32_t sensorId;
+    uint32_t cameraType;        // gRPC CameraType
+    uint32_t width;
+    uint32_t height;
+    float intrinsics[9];        // Row major 3x3 matrix
+    float distortion[5];        // K1, K2, P1, P2, K3
+    uint32_t rotation;          // gRPC ImageRotation
+    uint32_t reserved;
+};
+
+struct RecordingFrameHeader
+{
+    int64_t timestamp;
+    uint32_t nbImages;
+    uint32_t reserved;
+};
+
+struct RecordingImageHeader
+{
+    uint32_t sensorId;
+    uint32_t width;
+    uint32_t height;
+    uint8_t layout;             // gRPC ImageLayout
+    uint8_t compression;        // gRPC ImageCompression
+    uint16_t reserved;
+    float pose[16];             // Row major 4x4 matrix
+    uint64_t dataSize;          // Image data size, padding excluded
+};
+
+struct RecordingIndexEntry
+{
+    int64_t timestamp;
+    uint64_t offset;            // Offset of the frame chunk header in the file
+};
+
+struct RecordingTrailer
+{
+    uint64_t indexOffset;       // Offset of the index chunk header in the file
+    uint64_t nbFrames;
+    uint32_t nbCameras;
+    uint32_t reserved;
+    char magic[8];              // "SOLARIDX"
+};
+
+static_assert(sizeof(RecordingFileHeader) == 64, "Unexpected recording header size");
+static_assert(sizeof(RecordingChunkHeader) == 16, "Unexpected recording chunk header size");
+static_assert(sizeof(RecordingCamera) == 80, "Unexpected recording camera size");
+static_assert(sizeof(RecordingFrameHeader) == 16, "Unexpected recording frame header size");
+static_assert(sizeof(RecordingImageHeader) == 88, "Unexpected recording image header size");
+static_assert(sizeof(RecordingIndexEntry) == 16, "Unexpected recording index entry size");
+static_assert(sizeof(RecordingTrailer) == 32, "Unexpected recording trailer size");
+
+/// @brief Image to record: header and data (not copied)
+struct RecordingImage
+{
+    RecordingImageHeader header;
+    const void* data;
+};
+
+/**
+ * @class FrameRecordingWriter
+ * @brief Streaming writer of a frame recording file
+ *
+ * Chunks are appended through a large write buffer: image data are written
+ * once, as received, without encoding. The index and the trailer are written
+ * by close() (or by the destructor).
+ * Thread safe.
+ */
+class FrameRecordingWriter
+{
+    public:
+        FrameRecordingWriter() = default;
+        ~FrameRecordingWriter();
+
+        FrameRecordingWriter(const FrameRecordingWriter&) = delete;
+        FrameRecordingWriter& operator=(const FrameRecordingWriter&) = delete;
+
+        /// @brief Create the file and write its header and the known cameras
+        bool open(const std::string& path, const std::string& clientUUID,
+                  const std::vector<RecordingCamera>& cameras);
+
+        /// @brief Record new parameters for a camera (applies to the next frames)
+        bool writeCamera(const RecordingCamera& camera);
+
+        /// @brief Record the images of a frame
+        bool writeFrame(int64_t timestamp, const std::vector<RecordingImage>& images);
+
+        /// @brief Write the index and the trailer, then close the file
+        bool close();
+
+        const std::string& path() const { return m_path; }
+        uint64_t nbFrames() const;
+        uint64_t size() const;
+
+    private:
+        bool writeChunk(RecordingChunkType type, const void* payload, uint64_t size);
+        bool write(const void* data, uint64_t size);
+        bool writePadding(uint64_t size);
+
+        mutable std::mutex m_mutex;
+        std::FILE* m_file = nullptr;
+        std::string m_path;
+        uint64_t m_offset = 0;                      // Current file size
+        std::vector<RecordingCamera> m_cameras;     // Camera chunks
+        std::vector<RecordingIndexEntry> m_index;   // Frame chunks
+        std::vector<char> m_buffer;                 // Write buffer of m_file
+        bool m_error = false;
+};
+
+/// @brief Image of a recorded frame, pointing to the mapped file
+struct RecordingImageView
+{
+    const RecordingImageHeader* header;
+    const uint8_t* data;
+};
+
+/// @brief Recorded frame, pointing to the mapped file
+struct RecordingFrameView
+{
+    int64_t timestamp = 0;
+    std::vector<RecordingImageView> images;
+};
+
+/**
+ * @class FrameRecordingReader
+ * @brief Random access to the frames of a recording file, mapped in memory
+ *
+ * Frames are read in place, without copy: views are valid until the reader
+ * is closed. The index is read from the end of the file, or rebuilt by
+ * scanning the chunks if the recording was interrupted.
+ * Not thread safe while opened or closed; frames can be read concurrently.
+ */
+class FrameRecordingReader
+{
+    public:
+        FrameRecordingReader() = default;
+        ~FrameRecordingReader();
+
+        FrameRecordingReader(const FrameRecordingReader&) = delete;
+        FrameRecordingReader& operator=(const FrameRecordingReader&) = delete;
+
+        bool open(const std::string& path);
+        void close();
+
+        const std::string& clientUUID() const { return m_clientUUID; }
+
+        /// @brief Camera parameters in recording order (the last one of a sensor applies to the next frames)
+        const std::vector<RecordingCamera>& cameras() const { return m_cameras; }
+
+        size_t nbFrames() const { return m_index.size(); }
+
+        /// @brief Give a frame by its index in the recording
+        bool frame(size_t index, RecordingFrameView& frame) const;
+
+        /// @brief Indicates if the index was rebuilt (recording interrupted)
+        bool recovered() const { return m_recovered; }
+
+    private:
+        bool map(const std::string& path);
+        void unmap();
+        bool readIndex();
+        bool scanChunks();
+
+        const uint8_t* m_data = nullptr;
+        uint64_t m_size = 0;
+#ifdef _WIN32
+        void* m_fileHandle = nullptr;
+        void* m_mappingHandle = nullptr;
+#endif
+        std::string m_clientUUID;
+        std::vector<RecordingCamera> m_cameras;
+        std::vector<RecordingIndexEntry> m_index;
+        bool m_recovered = false;
+};
+
+} // namespace com::bcom::solar::gprc
+
+#endif // FRAME_RECORDING_H
@@ -0,0 +1,751 @@
+/**
+ * @copyright Copyright (c) 2021 B-com http://www.b-com.com/
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ImageConversion.h"
+
+#include <array>
+#include <atomic>
+#include <vector>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define PROXY_X86_64 1
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#endif
+
+// Per function instruction set selection (no global -mssse3/-mavx2 flag needed)
+#if defined(PROXY_X86_64) && (defined(__GNUC__) || defined(__clang__))
+#define TARGET_SSSE3 __attribute__((target("ssse3")))
+#define TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define TARGET_SSSE3
+#define TARGET_AVX2
+#endif
+
+// Luminance weights (BT.601) in 7 bits fixed point: (B * 15 + G * 75 + R * 38 + 64) >> 7
+// (7 bits so that the SIMD multiply-add of a pixel fits in a signed 16 bits integer)
+#define GREY_WEIGHT_B 15
+#define GREY_WEIGHT_G 75
+#define GREY_WEIGHT_R 38
+#define GREY_SHIFT 7
+
+namespace com::bcom::solar::gprc::imageconversion
+{
+
+namespace
+{
+
+// Kernel selected for the conversion functions
+std::atomic<Kernel> gActiveKernel{bestKernel()};
+
+#ifdef PROXY_X86_64
+
+// Keep bytes 0,1,2 of each of the 4 pixels of a 16 bytes lane, zero the last 4 bytes
+#define PACK_BGRA_TO_BGR_MASK 0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1
+
+TARGET_SSSE3
+void packBGRA32ToBGR24SSSE3(const uint8_t* src, uint8_t* dst, size_t nbPixels)
+{
+    const __m128i mask = _mm_setr_epi8(PACK_BGRA_TO_BGR_MASK);
+
+    size_t i = 0;
+    // 16 pixels per iteration: 64 bytes read, 48 bytes written
+    for (; i + 16 <= nbPixels; i += 16) {
+        const __m128i* in = reinterpret_cast<const __m128i*>(src + 4 * i);
+        __m128i a = _mm_shuffle_epi8(_mm_loadu_si128(in), mask);
+        __m128i b = _mm_shuffle_epi8(_mm_loadu_si128(in + 1), mask);
+        __m128i c = _mm_shuffle_epi8(_mm_loadu_si128(in + 2), mask);
+        __m128i d = _mm_shuffle_epi8(_mm_loadu_si128(in + 3), mask);
+
+        __m128i* out = reinterpret_cast<__m128i*>(dst + 3 * i);
+        _mm_storeu_si128(out,     _mm_or_si128(a, _mm_slli_si128(b, 12)));
+        _mm_storeu_si128(out + 1, _mm_or_si128(_mm_srli_si128(b, 4), _mm_slli_si128(c, 8)));
+        _mm_storeu_si128(out + 2, _mm_or_si128(_mm_srli_si128(c, 8), _mm_slli_si128(d, 4)));
+    }
+
+    packBGRA32ToBGR24Scalar(src + 4 * i, dst + 3 * i, nbPixels - i);
+}
+
+TARGET_AVX2
+void packBGRA32ToBGR24AVX2(const uint8_t* src, uint8_t* dst, size_t nbPixels)
+{
+    const __m256i mask = _mm256_setr_epi8(PACK_BGRA_TO_BGR_MASK, PACK_BGRA_TO_BGR_MASK);
+    // Move the 12 useful bytes of the high lane next to the 12 bytes of the low lane
+    const __m256i compact = _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 3, 7);
+
+    size_t i = 0;
+    // 8 pixels per store: 32 bytes read, 24 useful bytes written.
+    // Each 32 bytes store overlaps the next one by 8 bytes, so keep at least
+    // 3 pixels after the current block to never write past the end of dst.
+    for (; i + 11 <= nbPixels; i += 8) {
+        __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + 4 * i));
+        v = _mm256_permutevar8x32_epi32(_mm256_shuffle_epi8(v, mask), compact);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + 3 * i), v);
+    }
+
+    packBGRA32ToBGR24SSSE3(src + 4 * i, dst + 3 * i, nbPixels - i);
+}
+
+// Same as PACK_BGRA_TO_BGR_MASK with the 4 pixels in reverse order
+#define PACK_BGRA_TO_BGR_REVERSED_MASK 12, 13, 14, 8, 9, 10, 4, 5, 6, 0, 1, 2, -1, -1, -1, -1
+
+TARGET_SSSE3
+void packBGRA32ToBGR24Rotate180SSSE3(const uint8_t* src, uint8_t* dst, size_t nbPixels)
+{
+    const __m128i mask = _mm_setr_epi8(PACK_BGRA_TO_BGR_REVERSED_MASK);
+
+    size_t i = 0;
+    // 16 pixels per iteration, written from the end of dst: the last source
+    // lane becomes the first destination lane
+    for (; i + 16 <= nbPixels; i += 16) {
+        const __m128i* in = reinterpret_cast<const __m128i*>(src + 4 * i);
+        __m128i a = _mm_shuffle_epi8(_mm_loadu_si128(in + 3), mask);
+        __m128i b = _mm_shuffle_epi8(_mm_loadu_si128(in + 2), mask);
+        __m128i c = _mm_shuffle_epi8(_mm_loadu_si128(in + 1), mask);
+        __m128i d = _mm_shuffle_epi8(_mm_loadu_si128(in), mask);
+
+        __m128i* out = reinterpret_cast<__m128i*>(dst + 3 * (nbPixels - i - 16));
+        _mm_storeu_si128(out,     _mm_or_si128(a, _mm_slli_si128(b, 12)));
+        _mm_storeu_si128(out + 1, _mm_or_si128(_mm_srli_si128(b, 4), _mm_slli_si128(c, 8)));
+        _mm_storeu_si128(out + 2, _mm_or_si128(_mm_srli_si128(c, 8), _mm_slli_si128(d, 4)));
+    }
+
+    // Remaining source pixels go to the beginning of dst
+    packBGRA32ToBGR24Rotate180Scalar(src + 4 * i, dst, nbPixels - i);
+}
+
+#undef PACK_BGRA_TO_BGR_REVERSED_MASK
+#undef PACK_BGRA_TO_BGR_MASK
+
+#define REVERSE_BYTES_MASK 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0
+
+TARGET_SSSE3
+void copyGrey8Rotate180SSSE3(const uint8_t* src, uint8_t* dst, size_t nbPixels)
+{
+    const __m128i reverse = _mm_setr_epi8(REVERSE_BYTES_MASK);
+
+    size_t i = 0;
+    for (; i + 16 <= nbPixels; i += 16) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + nbPixels - i - 16), _mm_shuffle_epi8(v, reverse));
+    }
+
+    copyGrey8Rotate180Scalar(src + i, dst, nbPixels - i);
+}
+
+TARGET_AVX2
+void copyGrey8Rotate180AVX2(const uint8_t* src, uint8_t* dst, size_t nbPixels)
+{
+    const __m256i reverse = _mm256_setr_epi8(REVERSE_BYTES_MASK, REVERSE_BYTES_MASK);
+
+    size_t i = 0;
+    for (; i + 32 <= nbPixels; i += 32) {
+        __m256i v = _mm256_shuffle_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i)), reverse);
+        // Bytes reversed in each 128 bits lane, then lanes swapped
+        v = _mm256_permute4x64_epi64(v, _MM_SHUFFLE(1, 0, 3, 2));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + nbPixels - i - 32), v);
+    }
+
+    copyGrey8Rotate180SSSE3(src + i, dst, nbPixels - i);
+}
+
+#define GREY_WEIGHTS_BGRA GREY_WEIGHT_B, GREY_WEIGHT_G, GREY_WEIGHT_R, 0
+
+TARGET_SSSE3
+void convertBGRA32ToGrey8SSSE3(const uint8_t* src, uint8_t* dst, size_t nbPixels)
+{
+    const __m128i weights = _mm_setr_epi8(GREY_WEIGHTS_BGRA, GREY_WEIGHTS_BGRA, GREY_WEIGHTS_BGRA, GREY_WEIGHTS_BGRA);
+    const __m128i rounding = _mm_set1_epi16(1 << (GREY_SHIFT - 1));
+
+    size_t i = 0;
+    // 16 pixels per iteration: 64 bytes read, 16 bytes written
+    for (; i + 16 <= nbPixels; i += 16) {
+        const __m128i* in = reinterpret_cast<const __m128i*>(src + 4 * i);
+        // B*wB + G*wG and R*wR + A*0 for each pixel, then sum of the two halves
+        __m128i a = _mm_maddubs_epi16(_mm_loadu_si128(in), weights);
+        __m128i b = _mm_maddubs_epi16(_mm_loadu_si128(in + 1), weights);
+        __m128i c = _mm_maddubs_epi16(_mm_loadu_si128(in + 2), weights);
+        __m128i d = _mm_maddubs_epi16(_mm_loadu_si128(in + 3), weights);
+
+        __m128i lo = _mm_srli_epi16(_mm_add_epi16(_mm_hadd_epi16(a, b), rounding), GREY_SHIFT);
+        __m128i hi = _mm_srli_epi16(_mm_add_epi16(_mm_hadd_epi16(c, d), rounding), GREY_SHIFT);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_packus_epi16(lo, hi));
+    }
+
+    convertBGRA32ToGrey8Scalar(src + 4 * i, dst + i, nbPixels - i);
+}
+
+TARGET_AVX2
+void convertBGRA32ToGrey8AVX2(const uint8_t* src, uint8_t* dst, size_t nbPixels)
+{
+    const __m256i weights = _mm256_setr_epi8(GREY_WEIGHTS_BGRA, GREY_WEIGHTS_BGRA, GREY_WEIGHTS_BGRA, GREY_WEIGHTS_BGRA,
+                                             GREY_WEIGHTS_BGRA, GREY_WEIGHTS_BGRA, GREY_WEIGHTS_BGRA, GREY_WEIGHTS_BGRA);
+    const __m256i rounding = _mm256_set1_epi16(1 << (GREY_SHIFT - 1));
+    // hadd and packus work per 128 bits lane: put the groups of 4 pixels back in order
+    const __m256i reorder = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+
+    size_t i = 0;
+    // 32 pixels per iteration: 128 bytes read, 32 bytes written
+    for (; i + 32 <= nbPixels; i += 32) {
+        const __m256i* in = reinterpret_cast<const __m256i*>(src + 4 * i);
+        __m256i a = _mm256_maddubs_epi16(_mm256_loadu_si256(in), weights);
+        __m256i b = _mm256_maddubs_epi16(_mm256_loadu_si256(in + 1), weights);
+        __m256i c = _mm256_maddubs_epi16(_mm256_loadu_si256(in + 2), weights);
+        __m256i d = _mm256_maddubs_epi16(_mm256_loadu_si256(in + 3), weights);
+
+        __m256i lo = _mm256_srli_epi16(_mm256_add_epi16(_mm256_hadd_epi16(a, b), rounding), GREY_SHIFT);
+        __m256i hi = _mm256_srli_epi16(_mm256_add_epi16(_mm256_hadd_epi16(c, d), rounding), GREY_SHIFT);
+        __m256i grey = _mm256_permutevar8x32_epi32(_mm256_packus_epi16(lo, hi), reorder);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), grey);
+    }
+
+    convertBGRA32ToGrey8SSSE3(src + 4 * i, dst + i, nbPixels - i);
+}
+
+TARGET_SSSE3
+void convertBGRA32ToGrey8Rotate180SSSE3(const uint8_t* src, uint8_t* dst, size_t nbPixels)
+{
+    const __m128i weights = _mm_setr_epi8(GREY_WEIGHTS_BGRA, GREY_WEIGHTS_BGRA, GREY_WEIGHTS_BGRA, GREY_WEIGHTS_BGRA);
+    const __m128i rounding = _mm_set1_epi16(1 << (GREY_SHIFT - 1));
+    const __m128i reverse = _mm_setr_epi8(REVERSE_BYTES_MASK);
+
+    size_t i = 0;
+    for (; i + 16 <= nbPixels; i += 16) {
+        const __m128i* in = reinterpret_cast<const __m128i*>(src + 4 * i);
+        __m128i a = _mm_maddubs_epi16(_mm_loadu_si128(in), weights);
+        __m128i b = _mm_maddubs_epi16(_mm_loadu_si128(in + 1), weights);
+        __m128i c = _mm_maddubs_epi16(_mm_loadu_si128(in + 2), weights);
+        __m128i d = _mm_maddubs_epi16(_mm_loadu_si128(in + 3), weights);
+
+        __m128i lo = _mm_srli_epi16(_mm_add_epi16(_mm_hadd_epi16(a, b), rounding), GREY_SHIFT);
+        __m128i hi = _mm_srli_epi16(_mm_add_epi16(_mm_hadd_epi16(c, d), rounding), GREY_SHIFT);
+        __m128i grey = _mm_shuffle_epi8(_mm_packus_epi16(lo, hi), reverse);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + nbPixels - i - 16), grey);
+    }
+
+    convertBGRA32ToGrey8Rotate180Scalar(src + 4 * i, dst, nbPixels - i);
+}
+
+TARGET_AVX2
+void convertBGRA32ToGrey8Rotate180AVX2(const uint8_t* src, uint8_t* dst, size_t nbPixels)
+{
+    const __m256i weights = _mm256_setr_epi8(GREY_WEIGHTS_BGRA, GREY_WEIGHTS_BGRA, GREY_WEIGHTS_BGRA, GREY_WEIGHTS_BGRA,
+                                             GREY_WEIGHTS_BGRA, GREY_WEIGHTS_BGRA, GREY_WEIGHTS_BGRA, GREY_WEIGHTS_BGRA);
+    const __m256i rounding = _mm256_set1_epi16(1 << (GREY_SHIFT - 1));
+    // Groups of 4 pixels back in order (see convertBGRA32ToGrey8AVX2), in reverse order
+    const __m256i reorder = _mm256_setr_epi32(7, 3, 6, 2, 5, 1, 4, 0);
+    const __m256i reverse = _mm256_setr_epi8(REVERSE_BYTES_MASK, REVERSE_BYTES_MASK);
+
+    size_t i = 0;
+    for (; i + 32 <= nbPixels; i += 32) {
+        const __m256i* in = reinterpret_cast<const __m256i*>(src + 4 * i);
+        __m256i a = _mm256_maddubs_epi16(_mm256_loadu_si256(in), weights);
+        __m256i b = _mm256_maddubs_epi16(_mm256_loadu_si256(in + 1), weights);
+        __m256i c = _mm256_maddubs_epi16(_mm256_loadu_si256(in + 2), weights);
+        __m256i d = _mm256_maddubs_epi16(_mm256_loadu_si256(in + 3), weights);
+
+        __m256i lo = _mm256_srli_epi16(_mm256_add_epi16(_mm256_hadd_epi16(a, b), rounding), GREY_SHIFT);
+        __m256i hi = _mm256_srli_epi16(_mm256_add_epi16(_mm256_hadd_epi16(c, d), rounding), GREY_SHIFT);
+        // Groups of 4 pixels in reverse order, then bytes reversed in each group
+        __m256i grey = _mm256_permutevar8x32_epi32(_mm256_packus_epi16(lo, hi), reorder);
+        grey = _mm256_shuffle_epi8(grey, reverse);
+        grey = _mm256_shuffle_epi32(grey, _MM_SHUFFLE(0, 1, 2, 3));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + nbPixels - i - 32), grey);
+    }
+
+    convertBGRA32ToGrey8Rotate180SSSE3(src + 4 * i, dst, nbPixels - i);
+}
+
+#undef REVERSE_BYTES_MASK
+#undef GREY_WEIGHTS_BGRA
+
+// Downscale by 2 of a grey image: the two rows are summed after the pairs of
+// columns (_mm_maddubs_epi16 with 1 weights), then rounded and packed
+TARGET_SSSE3
+void downscaleGrey8By2SSSE3(const uint8_t* src, uint8_t* dst, uint32_t width, uint32_t height)
+{
+    const __m128i ones = _mm_set1_epi8(1);
+    const __m128i rounding = _mm_set1_epi16(2);
+    const uint32_t dstWidth = width / 2;
+
+    for (uint32_t y = 0; y < height / 2; y++) {
+        const uint8_t* row0 = src + static_cast<size_t>(2 * y) * width;
+        const uint8_t* row1 = row0 + width;
+        uint8_t* out = dst + static_cast<size_t>(y) * dstWidth;
+
+        uint32_t x = 0;
+        // 16 destination pixels per iteration
+        for (; x + 16 <= dstWidth; x += 16) {
+            __m128i a = _mm_add_epi16(_mm_maddubs_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(row0 + 2 * x)), ones),
+                                      _mm_maddubs_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(row1 + 2 * x)), ones));
+            __m128i b = _mm_add_epi16(_mm_maddubs_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(row0 + 2 * x + 16)), ones),
+                                      _mm_maddubs_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(row1 + 2 * x + 16)), ones));
+            a = _mm_srli_epi16(_mm_add_epi16(a, rounding), 2);
+            b = _mm_srli_epi16(_mm_add_epi16(b, rounding), 2);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out + x), _mm_packus_epi16(a, b));
+        }
+        for (; x < dstWidth; x++)
+            out[x] = static_cast<uint8_t>((row0[2 * x] + row0[2 * x + 1] + row1[2 * x] + row1[2 * x + 1] + 2) >> 2);
+    }
+}
+
+TARGET_AVX2
+void downscaleGrey8By2AVX2(const uint8_t* src, uint8_t* dst, uint32_t width, uint32_t height)
+{
+    const __m256i ones = _mm256_set1_epi8(1);
+    const __m256i rounding = _mm256_set1_epi16(2);
+    const uint32_t dstWidth = width / 2;
+
+    for (uint32_t y = 0; y < height / 2; y++) {
+        const uint8_t* row0 = src + static_cast<size_t>(2 * y) * width;
+        const uint8_t* row1 = row0 + width;
+        uint8_t* out = dst + static_cast<size_t>(y) * dstWidth;
+
+        uint32_t x = 0;
+        // 32 destination pixels per iteration
+        for (; x + 32 <= dstWidth; x += 32) {
+            __m256i a = _mm256_add_epi16(_mm256_maddubs_epi16(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(row0 + 2 * x)), ones),
+                                         _mm256_maddubs_epi16(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(row1 + 2 * x)), ones));
+            __m256i b = _mm256_add_epi16(_mm256_maddubs_epi16(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(row0 + 2 * x + 32)), ones),
+                                         _mm256_maddubs_epi16(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(row1 + 2 * x + 32)), ones));
+            a = _mm256_srli_epi16(_mm256_add_epi16(a, rounding), 2);
+            b = _mm256_srli_epi16(_mm256_add_epi16(b, rounding), 2);
+            // packus works per 128 bits lane: put the 64 bits groups back in order
+            __m256i packed = _mm256_permute4x64_epi64(_mm256_packus_epi16(a, b), _MM_SHUFFLE(3, 1, 2, 0));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + x), packed);
+        }
+        for (; x < dstWidth; x++)
+            out[x] = static_cast<uint8_t>((row0[2 * x] + row0[2 * x + 1] + row1[2 * x] + row1[2 * x + 1] + 2) >> 2);
+    }
+}
+
+// Downscale by 2 of a 3 channels image: the same channel of the two pixels of a
+// block is shuffled next to itself, then summed as in downscaleGrey8By2SSSE3.
+// A 16 bytes lane gives 4 destination pixels (12 bytes) from 24 source bytes,
+// read as bytes 0-15 (pixels 0 and 1) and bytes 8-23 (pixels 2 and 3)
+#define PAIR_BGR_LOW_MASK 0, 3, 1, 4, 2, 5, 6, 9, 7, 10, 8, 11, -1, -1, -1, -1
+#define PAIR_BGR_HIGH_MASK 4, 7, 5, 8, 6, 9, 10, 13, 11, 14, 12, 15, -1, -1, -1, -1
+// The 6 bytes of each half of the packed lane, contiguous
+#define COMPACT_BGR_MASK 0, 1, 2, 3, 4, 5, 8, 9, 10, 11, 12, 13, -1, -1, -1, -1
+
+inline void downscaleBGR24By2Scalar(const uint8_t* row0, const uint8_t* row1, uint8_t* out, uint32_t x, uint32_t dstWidth)
+{
+    for (; x < dstWidth; x++) {
+        for (uint32_t c = 0; c < 3; c++)
+            out[3 * x + c] = static_cast<uint8_t>((row0[6 * x + c] + row0[6 * x + 3 + c]
+                                                   + row1[6 * x + c] + row1[6 * x + 3 + c] + 2) >> 2);
+    }
+}
+
+TARGET_SSSE3
+void downscaleBGR24By2SSSE3(const uint8_t* src, uint8_t* dst, uint32_t width, uint32_t height)
+{
+    const __m128i ones = _mm_set1_epi8(1);
+    const __m128i rounding = _mm_set1_epi16(2);
+    const __m128i pairLow = _mm_setr_epi8(PAIR_BGR_LOW_MASK);
+    const __m128i pairHigh = _mm_setr_epi8(PAIR_BGR_HIGH_MASK);
+    const __m128i compact = _mm_setr_epi8(COMPACT_BGR_MASK);
+    const uint32_t dstWidth = width / 2;
+
+    for (uint32_t y = 0; y < height / 2; y++) {
+        const uint8_t* row0 = src + static_cast<size_t>(2 * y) * width * 3;
+        const uint8_t* row1 = row0 + static_cast<size_t>(width) * 3;
+        uint8_t* out = dst + static_cast<size_t>(y) * dstWidth * 3;
+
+        uint32_t x = 0;
+        // 4 destination pixels per iteration, stored with 16 bytes (the last 4 are written again
+        // by the next iteration): 2 more destination pixels must follow them in the row
+        for (; x + 6 <= dstWidth; x += 4) {
+            const uint8_t* in0 = row0 + 6 * x;
+            const uint8_t* in1 = row1 + 6 * x;
+            __m128i low0 = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(in0)), pairLow);
+            __m128i low1 = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(in1)), pairLow);
+            __m128i high0 = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(in0 + 8)), pairHigh);
+            __m128i high1 = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(in1 + 8)), pairHigh);
+            __m128i a = _mm_add_epi16(_mm_maddubs_epi16(low0, ones), _mm_maddubs_epi16(low1, ones));
+            __m128i b = _mm_add_epi16(_mm_maddubs_epi16(high0, ones), _mm_maddubs_epi16(high1, ones));
+            a = _mm_srli_epi16(_mm_add_epi16(a, rounding), 2);
+            b = _mm_srli_epi16(_mm_add_epi16(b, rounding), 2);
+            __m128i packed = _mm_shuffle_epi8(_mm_packus_epi16(a, b), compact);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out + 3 * x), packed);
+        }
+        downscaleBGR24By2Scalar(row0, row1, out, x, dstWidth);
+    }
+}
+
+// Lane 0 reads the 24 source bytes of destination pixels 0-3, lane 1 those of pixels 4-7
+TARGET_AVX2
+inline __m256i loadBGR24Lanes(const uint8_t* in)
+{
+    return _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(in))),
+                                   _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + 24)), 1);
+}
+
+TARGET_AVX2
+void downscaleBGR24By2AVX2(const uint8_t* src, uint8_t* dst, uint32_t width, uint32_t height)
+{
+    const __m256i ones = _mm256_set1_epi8(1);
+    const __m256i rounding = _mm256_set1_epi16(2);
+    const __m256i pairLow = _mm256_setr_epi8(PAIR_BGR_LOW_MASK, PAIR_BGR_LOW_MASK);
+    const __m256i pairHigh = _mm256_setr_epi8(PAIR_BGR_HIGH_MASK, PAIR_BGR_HIGH_MASK);
+    const __m256i compact = _mm256_setr_epi8(COMPACT_BGR_MASK, COMPACT_BGR_MASK);
+    // 12 bytes of each lane, contiguous
+    const __m256i joinLanes = _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 7, 7);
+    const uint32_t dstWidth = width / 2;
+
+    for (uint32_t y = 0; y < height / 2; y++) {
+        const uint8_t* row0 = src + static_cast<size_t>(2 * y) * width * 3;
+        const uint8_t* row1 = row0 + static_cast<size_t>(width) * 3;
+        uint8_t* out = dst + static_cast<size_t>(y) * dstWidth * 3;
+
+        uint32_t x = 0;
+        // 8 destination pixels per iteration, stored with 32 bytes (the last 8 are written again
+        // by the next iteration): 3 more destination pixels must follow them in the row
+        for (; x + 11 <= dstWidth; x += 8) {
+            const uint8_t* in0 = row0 + 6 * x;
+            const uint8_t* in1 = row1 + 6 * x;
+            __m256i a = _mm256_add_epi16(_mm256_maddubs_epi16(_mm256_shuffle_epi8(loadBGR24Lanes(in0), pairLow), ones),
+                                         _mm256_maddubs_epi16(_mm256_shuffle_epi8(loadBGR24Lanes(in1), pairLow), ones));
+            __m256i b = _mm256_add_epi16(_mm256_maddubs_epi16(_mm256_shuffle_epi8(loadBGR24Lanes(in0 + 8), pairHigh), ones),
+                                         _mm256_maddubs_epi16(_mm256_shuffle_epi8(loadBGR24Lanes(in1 + 8), pairHigh), ones));
+            a = _mm256_srli_epi16(_mm256_add_epi16(a, rounding), 2);
+            b = _mm256_srli_epi16(_mm256_add_epi16(b, rounding), 2);
+            __m256i packed = _mm256_shuffle_epi8(_mm256_packus_epi16(a, b), compact);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 3 * x), _mm256_permutevar8x32_epi32(packed, joinLanes));
+        }
+        downscaleBGR24By2Scalar(row0, row1, out, x, dstWidth);
+    }
+}
+
+#undef COMPACT_BGR_MASK
+#undef PAIR_BGR_HIGH_MASK
+#undef PAIR_BGR_LOW_MASK
+
+bool cpuSupports(Kernel kernel)
+{
+#if defined(_MSC_VER)
+    int info[4];
+    __cpuid(info, 0);
+    const int nbIds = info[0];
+    if (kernel == Kernel::SSSE3) {
+        __cpuid(info, 1);
+        return (info[2] & (1 << 9)) != 0;
+    }
+    if (kernel == Kernel::AVX2) {
+        if (nbIds < 7)
+            return false;
+        __cpuid(info, 1);
+        // OSXSAVE and AVX, then check that the OS saves the YMM registers
+        if ((info[2] & (1 << 27)) == 0 || (info[2] & (1 << 28)) == 0)
+            return false;
+        if ((_xgetbv(0) & 0x6) != 0x6)
+            return false;
+        __cpuidex(info, 7, 0);
+        return (info[1] & (1 << 5)) != 0;
+    }
+    return true;
+#else
+    __builtin_cpu_init();
+    if (kernel == Kernel::SSSE3)
+        return __builtin_cpu_supports("ssse3");
+    if (kernel == Kernel::AVX2)
+        return __builtin_cpu_supports("avx2");
+    return true;
+#endif
+}
+
+#else
+
+bool cpuSupports(Kernel kernel)
+{
+    return kernel == Kernel::SCALAR;
+}
+
+#endif // PROXY_X86_64
+
+// Box filter: sums of the source rows of a block in a row accumulator, then sums of the columns
+template <typename T>
+void downscaleBox(const T* src, T* dst, uint32_t width, uint32_t height, uint32_t nbChannels, uint32_t factor)
+{
+    const uint32_t dstWidth = width / factor;
+    const uint32_t dstHeight = height / factor;
+    const size_t srcRowSize = static_cast<size_t>(width) * nbChannels;
+    const size_t dstRowSize = static_cast<size_t>(dstWidth) * nbChannels;
+
+    if (factor == 2) {
+        // Most common case: no accumulator
+        for (uint32_t y = 0; y < dstHeight; y++) {
+            const T* row0 = src + 2 * y * srcRowSize;
+            const T* row1 = row0 + srcRowSize;
+            T* out = dst + y * dstRowSize;
+            for (uint32_t x = 0; x < dstWidth; x++, row0 += 2 * nbChannels, row1 += 2 * nbChannels) {
+                for (uint32_t c = 0; c < nbChannels; c++)
+                    *out++ = static_cast<T>((row0[c] + row0[c + nbChannels] + row1[c] + row1[c + nbChannels] + 2) >> 2);
+            }
+        }
+        return;
+    }
+
+    const uint32_t area = factor * factor;
+    const size_t usedRowSize = static_cast<size_t>(dstWidth) * factor * nbChannels;
+    std::vector<uint32_t> accumulator(usedRowSize);
+    for (uint32_t y = 0; y < dstHeight; y++) {
+        const T* row = src + static_cast<size_t>(y) * factor * srcRowSize;
+        for (size_t i = 0; i < usedRowSize; i++)
+            accumulator[i] = row[i];
+        for (uint32_t k = 1; k < factor; k++) {
+            row += srcRowSize;
+            for (size_t i = 0; i < usedRowSize; i++)
+                accumulator[i] += row[i];
+        }
+
+        T* out = dst + y * dstRowSize;
+        const uint32_t* block = accumulator.data();
+        for (uint32_t x = 0; x < dstWidth; x++, block += factor * nbChannels) {
+            for (uint32_t c = 0; c < nbChannels; c++) {
+                uint32_t sum = 0;
+                for (uint32_t k = 0; k < factor; k++)
+                    sum += block[k * nbChannels + c];
+                *out++ = static_cast<T>((sum + area / 2) / area);
+            }
+        }
+    }
+}
+
+} // anonymous namespace
+
+Kernel bestKernel()
+{
+    static const Kernel best = cpuSupports(Kernel::AVX2) ? Kernel::AVX2
+                             : cpuSupports(Kernel::SSSE3) ? Kernel::SSSE3
+                             : Kernel::SCALAR;
+    return best;
+}
+
+Kernel activeKernel()
+{
+    return gActiveKernel.load(std::memory_order_relaxed);
+}
+
+Kernel forceKernel(Kernel kernel)
+{
+    if (!cpuSupports(kernel))
+        kernel = bestKernel();
+    gActiveKernel.store(kernel, std::memory_order_relaxed);
+    return kernel;
+}
+
+const char* to_string(Kernel kernel)
+{
+    switch (kernel)
+    {
+    case Kernel::SCALAR: return "scalar";
+    case Kernel::SSSE3: return "SSSE3";
+    case Kernel::AVX2: return "AVX2";
+    default: return "unknown";
+    }
+}
+
+void packBGRA32ToBGR24Scalar(const uint8_t* src, uint8_t* dst, size_t nbPixels)
+{
+    for (size_t i = 0; i < nbPixels; i++, src += 4, dst += 3) {
+        dst[0] = src[0];
+        dst[1] = src[1];
+        dst[2] = src[2];
+    }
+}
+
+void packBGRA32ToBGR24(const uint8_t* src, uint8_t* dst, size_t nbPixels)
+{
+    switch (activeKernel())
+    {
+#ifdef PROXY_X86_64
+    case Kernel::AVX2: packBGRA32ToBGR24AVX2(src, dst, nbPixels); break;
+    case Kernel::SSSE3: packBGRA32ToBGR24SSSE3(src, dst, nbPixels); break;
+#endif
+    default: packBGRA32ToBGR24Scalar(src, dst, nbPixels); break;
+    }
+}
+
+void packBGRA32ToBGR24Rotate180Scalar(const uint8_t* src, uint8_t* dst, size_t nbPixels)
+{
+    dst += 3 * nbPixels;
+    for (size_t i = 0; i < nbPixels; i++, src += 4) {
+        dst -= 3;
+        dst[0] = src[0];
+        dst[1] = src[1];
+        dst[2] = src[2];
+    }
+}
+
+void packBGRA32ToBGR24Rotate180(const uint8_t* src, uint8_t* dst, size_t nbPixels)
+{
+    switch (activeKernel())
+    {
+#ifdef PROXY_X86_64
+    // No AVX2 version: the overlapping 32 bytes stores of the AVX2 repack can not be written backward
+    case Kernel::AVX2:
+    case Kernel::SSSE3: packBGRA32ToBGR24Rotate180SSSE3(src, dst, nbPixels); break;
+#endif
+    default: packBGRA32ToBGR24Rotate180Scalar(src, dst, nbPixels); break;
+    }
+}
+
+void copyGrey8Rotate180Scalar(const uint8_t* src, uint8_t* dst, size_t nbPixels)
+{
+    for (size_t i = 0; i < nbPixels; i++)
+        dst[nbPixels - 1 - i] = src[i];
+}
+
+void copyGrey8Rotate180(const uint8_t* src, uint8_t* dst, size_t nbPixels)
+{
+    switch (activeKernel())
+    {
+#ifdef PROXY_X86_64
+    case Kernel::AVX2: copyGrey8Rotate180AVX2(src, dst, nbPixels); break;
+    case Kernel::SSSE3: copyGrey8Rotate180SSSE3(src, dst, nbPixels); break;
+#endif
+    default: copyGrey8Rotate180Scalar(src, dst, nbPixels); break;
+    }
+}
+
+void convertBGRA32ToGrey8Scalar(const uint8_t* src, uint8_t* dst, size_t nbPixels)
+{
+    for (size_t i = 0; i < nbPixels; i++, src += 4) {
+        dst[i] = static_cast<uint8_t>((src[0] * GREY_WEIGHT_B + src[1] * GREY_WEIGHT_G + src[2] * GREY_WEIGHT_R
+                                       + (1 << (GREY_SHIFT - 1))) >> GREY_SHIFT);
+    }
+}
+
+void convertBGRA32ToGrey8(const uint8_t* src, uint8_t* dst, size_t nbPixels)
+{
+    switch (activeKernel())
+    {
+#ifdef PROXY_X86_64
+    case Kernel::AVX2: convertBGRA32ToGrey8AVX2(src, dst, nbPixels); break;
+    case Kernel::SSSE3: convertBGRA32ToGrey8SSSE3(src, dst, nbPixels); break;
+#endif
+    default: convertBGRA32ToGrey8Scalar(src, dst, nbPixels); break;
+    }
+}
+
+void downscaleBox8Scalar(const uint8_t* src, uint8_t* dst, uint32_t width, uint32_t height,
+                         uint32_t nbChannels, uint32_t factor)
+{
+    downscaleBox(src, dst, width, height, nbChannels, factor);
+}
+
+void downscaleBox8(const uint8_t* src, uint8_t* dst, uint32_t width, uint32_t height,
+                   uint32_t nbChannels, uint32_t factor)
+{
+#ifdef PROXY_X86_64
+    if ((nbChannels == 1) && (factor == 2)) {
+        switch (activeKernel())
+        {
+        case Kernel::AVX2: downscaleGrey8By2AVX2(src, dst, width, height); return;
+        case Kernel::SSSE3: downscaleGrey8By2SSSE3(src, dst, width, height); return;
+        default: break;
+        }
+    }
+    if ((nbChannels == 3) && (factor == 2)) {
+        switch (activeKernel())
+        {
+        case Kernel::AVX2: downscaleBGR24By2AVX2(src, dst, width, height); return;
+        case Kernel::SSSE3: downscaleBGR24By2SSSE3(src, dst, width, height); return;
+        default: break;
+        }
+    }
+#endif
+    downscaleBox(src, dst, width, height, nbChannels, factor);
+}
+
+void downscaleBox16(const uint16_t* src, uint16_t* dst, uint32_t width, uint32_t height,
+                    uint32_t nbChannels, uint32_t factor)
+{
+    downscaleBox(src, dst, width, height, nbChannels, factor);
+}
+
+void convertBGRA32ToGrey8Rotate180Scalar(const uint8_t* src, uint8_t* dst, size_t nbPixels)
+{
+    for (size_t i = 0; i < nbPixels; i++, src += 4) {
+        dst[nbPixels - 1 - i] = static_cast<uint8_t>((src[0] * GREY_WEIGHT_B + src[1] * GREY_WEIGHT_G + src[2] * GREY_WEIGHT_R
+                                                      + (1 << (GREY_SHIFT - 1))) >> GREY_SHIFT);
+    }
+}
+
+void convertBGRA32ToGrey8Rotate180(const uint8_t* src, uint8_t* dst, size_t nbPixels)
+{
+    switch (activeKernel())
+    {
+#ifdef PROXY_X86_64
+    case Kernel::AVX2: convertBGRA32ToGrey8Rotate180AVX2(src, dst, nbPixels); break;
+    case Kernel::SSSE3: convertBGRA32ToGrey8Rotate180SSSE3(src, dst, nbPixels); break;
+#endif
+    default: convertBGRA32ToGrey8Rotate180Scalar(src, dst, nbPixels); break;
+    }
+}
+
+void convertBGR24ToGrey8(const uint8_t* src, uint8_t* dst, size_t nbPixels)
+{
+    for (size_t i = 0; i < nbPixels; i++, src += 3) {
+        dst[i] = static_cast<uint8_t>((src[0] * GREY_WEIGHT_B + src[1] * GREY_WEIGHT_G + src[2] * GREY_WEIGHT_R
+                                       + (1 << (GREY_SHIFT - 1))) >> GREY_SHIFT);
+    }
+}
+
+// Thumbnail of the difference hash, and samples per cell in each direction
+#define DHASH_WIDTH 9
+#define DHASH_HEIGHT 8
+#define DHASH_CELL_SAMPLES 8
+
+uint64_t differenceHash8(const uint8_t* src, uint32_t width, uint32_t height, uint32_t nbChannels)
+{
+    if ((width < DHASH_WIDTH) || (height < DHASH_HEIGHT))
+        return 0;
+
+    // Samples at the same relative positions in each cell: the sums of the cells are comparable
+    std::array<size_t, DHASH_WIDTH * DHASH_CELL_SAMPLES> columns;
+    for (uint32_t i = 0; i < columns.size(); i++)
+        columns[i] = ((2 * static_cast<size_t>(i) + 1) * width / (2 * columns.size())) * nbChannels;
+
+    std::array<uint32_t, DHASH_WIDTH * DHASH_HEIGHT> cells{};
+    const size_t rowSize = static_cast<size_t>(width) * nbChannels;
+    for (uint32_t j = 0; j < DHASH_HEIGHT * DHASH_CELL_SAMPLES; j++) {
+        size_t y = (2 * static_cast<size_t>(j) + 1) * height / (2 * DHASH_HEIGHT * DHASH_CELL_SAMPLES);
+        const uint8_t* row = src + y * rowSize;
+        uint32_t* cellRow = cells.data() + (j / DHASH_CELL_SAMPLES) * DHASH_WIDTH;
+        for (uint32_t i = 0; i < columns.size(); i++) {
+            const uint8_t* pixel = row + columns[i];
+            uint32_t sum = 0;
+            for (uint32_t c = 0; c < nbChannels; c++)
+                sum += pixel[c];
+            cellRow[i / DHASH_CELL_SAMPLES] += sum;
+        }
+    }
+
+    uint64_t hash = 0;
+    for (uint32_t y = 0; y < DHASH_HEIGHT; y++) {
+        for (uint32_t x = 0; x < DHASH_WIDTH - 1; x++) {
+            if (cells[y * DHASH_WIDTH + x] > cells[y * DHASH_WIDTH + x + 1])
+                hash |= uint64_t(1) << (y * (DHASH_WIDTH - 1) + x);
+        }
+    }
+    return hash;
+}
+
+} // namespace com::bcom::solar::gprc::imageconversion
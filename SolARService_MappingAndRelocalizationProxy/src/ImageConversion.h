@@ -0,0 +1,134 @@
+/**
+ * @copyright Copyright (c) 2021 B-com http://www.b-com.com/
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef IMAGE_CONVERSION_H
+#define IMAGE_CONVERSION_H
+
+#include <cstddef>
+#include <cstdint>
+
+namespace com::bcom::solar::gprc
+{
+
+/**
+ * @brief Pixel conversion kernels used by the proxy to prepare received images
+ *
+ * Each kernel has a scalar implementation and, on x86_64, SSSE3 and AVX2
+ * implementations selected once at runtime according to the CPU features.
+ */
+namespace imageconversion
+{
+
+/// @brief Instruction set used by the conversion kernels
+enum class Kernel : uint8_t {
+    SCALAR = 0,
+    SSSE3 = 1,
+    AVX2 = 2
+};
+
+/// @brief Give the best kernel supported by the current CPU
+Kernel bestKernel();
+
+/// @brief Give the kernel used by the conversion functions (best kernel unless forced)
+Kernel activeKernel();
+
+/// @brief Force the kernel used by the conversion functions (for benchmark and tests only)
+/// @return the kernel actually selected (falls back to the best supported one)
+Kernel forceKernel(Kernel kernel);
+
+/// @brief Give a printable name for a kernel
+const char* to_string(Kernel kernel);
+
+/// @brief Pack a 32 bits per pixel interleaved BGRA buffer to 24 bits per pixel BGR
+/// The first three bytes of each pixel are kept in their original order,
+/// the fourth one (alpha) is dropped.
+/// @param[in] src: source buffer (4 * nbPixels bytes)
+/// @param[out] dst: destination buffer (3 * nbPixels bytes), must not overlap src
+/// @param[in] nbPixels: number of pixels to convert
+void packBGRA32ToBGR24(const uint8_t* src, uint8_t* dst, size_t nbPixels);
+
+/// @brief Scalar reference implementation of packBGRA32ToBGR24 (whatever the active kernel)
+void packBGRA32ToBGR24Scalar(const uint8_t* src, uint8_t* dst, size_t nbPixels);
+
+/// @brief Convert a 32 bits per pixel interleaved BGRA buffer to 8 bits luminance
+/// Unpack and conversion are done in one pass (BT.601 weights, 7 bits fixed point),
+/// the fourth byte (alpha) is ignored.
+/// @param[in] src: source buffer (4 * nbPixels bytes)
+/// @param[out] dst: destination buffer (nbPixels bytes), must not overlap src
+/// @param[in] nbPixels: number of pixels to convert
+void convertBGRA32ToGrey8(const uint8_t* src, uint8_t* dst, size_t nbPixels);
+
+/// @brief Scalar reference implementation of convertBGRA32ToGrey8 (whatever the active kernel)
+void convertBGRA32ToGrey8Scalar(const uint8_t* src, uint8_t* dst, size_t nbPixels);
+
+/// @brief Convert a 24 bits per pixel interleaved BGR buffer to 8 bits luminance
+/// (same weights as convertBGRA32ToGrey8, scalar only: used on decoded JPEG images)
+void convertBGR24ToGrey8(const uint8_t* src, uint8_t* dst, size_t nbPixels);
+
+/// @brief Same as packBGRA32ToBGR24, image rotated 180 degrees in the same pass
+/// (the pixels of a dense image are written in reverse order)
+void packBGRA32ToBGR24Rotate180(const uint8_t* src, uint8_t* dst, size_t nbPixels);
+
+/// @brief Scalar reference implementation of packBGRA32ToBGR24Rotate180 (whatever the active kernel)
+void packBGRA32ToBGR24Rotate180Scalar(const uint8_t* src, uint8_t* dst, size_t nbPixels);
+
+/// @brief Same as convertBGRA32ToGrey8, image rotated 180 degrees in the same pass
+void convertBGRA32ToGrey8Rotate180(const uint8_t* src, uint8_t* dst, size_t nbPixels);
+
+/// @brief Scalar reference implementation of convertBGRA32ToGrey8Rotate180 (whatever the active kernel)
+void convertBGRA32ToGrey8Rotate180Scalar(const uint8_t* src, uint8_t* dst, size_t nbPixels);
+
+/// @brief Copy a 8 bits per pixel buffer in reverse order (grey image rotated 180 degrees)
+void copyGrey8Rotate180(const uint8_t* src, uint8_t* dst, size_t nbPixels);
+
+/// @brief Scalar reference implementation of copyGrey8Rotate180 (whatever the active kernel)
+void copyGrey8Rotate180Scalar(const uint8_t* src, uint8_t* dst, size_t nbPixels);
+
+/// @brief Downscale an interleaved 8 bits image by an integer factor (box filter, rounded mean)
+/// Each destination pixel is the mean of a factor x factor block of source pixels.
+/// Remaining columns and rows (width or height not multiple of factor) are dropped.
+/// Grey and 3 channels images downscaled by 2 use the SIMD kernels, other cases the scalar one.
+/// @param[in] src: source buffer (width * height * nbChannels bytes)
+/// @param[out] dst: destination buffer ((width / factor) * (height / factor) * nbChannels bytes)
+/// @param[in] width, height: source image size (pixels)
+/// @param[in] nbChannels: number of interleaved channels
+/// @param[in] factor: downscale factor (>= 1)
+void downscaleBox8(const uint8_t* src, uint8_t* dst, uint32_t width, uint32_t height,
+                   uint32_t nbChannels, uint32_t factor);
+
+/// @brief Scalar reference implementation of downscaleBox8 (whatever the active kernel)
+void downscaleBox8Scalar(const uint8_t* src, uint8_t* dst, uint32_t width, uint32_t height,
+                         uint32_t nbChannels, uint32_t factor);
+
+/// @brief Downscale an interleaved 16 bits image by an integer factor (box filter, scalar only)
+void downscaleBox16(const uint16_t* src, uint16_t* dst, uint32_t width, uint32_t height,
+                    uint32_t nbChannels, uint32_t factor);
+
+/// @brief Difference hash (dHash) of an interleaved 8 bits image (scalar only)
+/// The image is reduced to a 9x8 thumbnail (sum of the channels over a grid of
+/// samples in each cell), each bit is set if a thumbnail cell is brighter than
+/// its right neighbour: close images give hashes with a small Hamming distance.
+/// @param[in] src: image buffer (width * height * nbChannels bytes)
+/// @param[in] width, height: image size (pixels)
+/// @param[in] nbChannels: number of interleaved channels
+/// @return the hash (bit 8 * row + column), 0 for an image smaller than the thumbnail
+uint64_t differenceHash8(const uint8_t* src, uint32_t width, uint32_t height, uint32_t nbChannels);
+
+} // namespace imageconversion
+
+} // namespace com::bcom::solar::gprc
+
+#endif // IMAGE_CONVERSION_H
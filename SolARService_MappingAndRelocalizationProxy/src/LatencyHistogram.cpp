@@ -0,0 +1,104 @@
+/**
+ * @copyright Copyright (c) 2021 B-com http://www.b-com.com/
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "LatencyHistogram.h"
+
+#include <algorithm>
+#include <cmath>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace com::bcom::solar::gprc
+{
+
+void LatencyHistogram::record(uint64_t latencyUs)
+{
+    m_buckets[bucketIndex(latencyUs)].fetch_add(1, std::memory_order_relaxed);
+    m_sumUs.fetch_add(latencyUs, std::memory_order_relaxed);
+
+    uint64_t maxUs = m_maxUs.load(std::memory_order_relaxed);
+    while ((latencyUs > maxUs) && !m_maxUs.compare_exchange_weak(maxUs, latencyUs, std::memory_order_relaxed)) {
+    }
+}
+
+LatencySummary LatencyHistogram::summary() const
+{
+    std::array<uint64_t, NB_BUCKETS> counts;
+    LatencySummary summary;
+    for (unsigned int index = 0; index < NB_BUCKETS; index++) {
+        counts[index] = m_buckets[index].load(std::memory_order_relaxed);
+        summary.count += counts[index];
+    }
+
+    if (summary.count == 0)
+        return summary;
+
+    summary.meanUs = static_cast<double>(m_sumUs.load(std::memory_order_relaxed)) / summary.count;
+    summary.maxUs = m_maxUs.load(std::memory_order_relaxed);
+
+    auto percentile = [&](double quantile) {
+        uint64_t rank = std::max<uint64_t>(1, static_cast<uint64_t>(std::ceil(quantile * summary.count)));
+        uint64_t nbLatencies = 0;
+        for (unsigned int index = 0; index < NB_BUCKETS; index++) {
+            nbLatencies += counts[index];
+            if (nbLatencies >= rank)
+                return std::min(bucketHighestValue(index), summary.maxUs);
+        }
+        return summary.maxUs;
+    };
+
+    summary.p50Us = percentile(0.5);
+    summary.p90Us = percentile(0.9);
+    summary.p99Us = percentile(0.99);
+    summary.p999Us = percentile(0.999);
+
+    return summary;
+}
+
+unsigned int LatencyHistogram::bucketIndex(uint64_t latencyUs)
+{
+    // First power of two range: one bucket for each value
+    if (latencyUs < SUB_BUCKETS)
+        return static_cast<unsigned int>(latencyUs);
+
+    latencyUs = std::min(latencyUs, (uint64_t{1} << LATENCY_HISTOGRAM_MAX_BITS) - 1);
+
+    // Highest bit set: power of two range of the latency
+#if defined(_MSC_VER)
+    unsigned long highestBit;
+    _BitScanReverse64(&highestBit, latencyUs);
+#else
+    unsigned int highestBit = 63 - __builtin_clzll(latencyUs);
+#endif
+
+    // Sub-bucket: bits following the highest bit
+    unsigned int shift = static_cast<unsigned int>(highestBit) - LATENCY_HISTOGRAM_SUB_BUCKET_BITS;
+    return (shift + 1) * SUB_BUCKETS + static_cast<unsigned int>(latencyUs >> shift) - SUB_BUCKETS;
+}
+
+uint64_t LatencyHistogram::bucketHighestValue(unsigned int index)
+{
+    if (index < SUB_BUCKETS)
+        return index;
+
+    unsigned int shift = index / SUB_BUCKETS - 1;
+    uint64_t lowestValue = static_cast<uint64_t>(SUB_BUCKETS + index % SUB_BUCKETS) << shift;
+    return lowestValue + (uint64_t{1} << shift) - 1;
+}
+
+} // namespace com::bcom::solar::gprc
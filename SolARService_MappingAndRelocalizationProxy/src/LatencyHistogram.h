@@ -0,0 +1,89 @@
+/**
+ * @copyright Copyright (c) 2021 B-com http://www.b-com.com/
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef LATENCY_HISTOGRAM_H
+#define LATENCY_HISTOGRAM_H
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+namespace com::bcom::solar::gprc
+{
+
+// Linear sub-buckets in each power of two range: 16 sub-buckets, about 6% precision
+#define LATENCY_HISTOGRAM_SUB_BUCKET_BITS 4
+// Largest latency recorded (microseconds, larger values in the last bucket): about 71 minutes
+#define LATENCY_HISTOGRAM_MAX_BITS 32
+
+/**
+ * @struct LatencySummary
+ * @brief Distribution of the latencies recorded by a histogram (microseconds)
+ */
+struct LatencySummary
+{
+    uint64_t count = 0;
+    double meanUs = 0;
+    uint64_t p50Us = 0;
+    uint64_t p90Us = 0;
+    uint64_t p99Us = 0;
+    uint64_t p999Us = 0;
+    uint64_t maxUs = 0;
+};
+
+/**
+ * @class LatencyHistogram
+ * @brief Lock free histogram of latencies, with a constant relative precision (HDR histogram)
+ *
+ * Latencies are counted in buckets whose width doubles with each power of two:
+ * a record is one atomic increment, whatever the latency, and percentiles are
+ * known to about 6% from 1 microsecond to an hour. Recorded concurrently by
+ * any thread; a summary read meanwhile may miss the latest records.
+ */
+class LatencyHistogram
+{
+    public:
+        /// @brief Record a latency (microseconds)
+        void record(uint64_t latencyUs);
+
+        /// @brief Record a latency (negative durations recorded as null)
+        void record(std::chrono::steady_clock::duration latency)
+        {
+            auto latencyUs = std::chrono::duration_cast<std::chrono::microseconds>(latency).count();
+            record(static_cast<uint64_t>(latencyUs > 0 ? latencyUs : 0));
+        }
+
+        /// @brief Give the number of latencies recorded, their mean, percentiles and maximum
+        /// A percentile is the highest latency of its bucket (never lower than the exact percentile)
+        LatencySummary summary() const;
+
+    private:
+        static constexpr unsigned int SUB_BUCKETS = 1u << LATENCY_HISTOGRAM_SUB_BUCKET_BITS;
+        static constexpr unsigned int NB_BUCKETS =
+                (LATENCY_HISTOGRAM_MAX_BITS - LATENCY_HISTOGRAM_SUB_BUCKET_BITS + 1) * SUB_BUCKETS;
+
+        static unsigned int bucketIndex(uint64_t latencyUs);
+        static uint64_t bucketHighestValue(unsigned int index);
+
+        std::array<std::atomic<uint64_t>, NB_BUCKETS> m_buckets{};
+        std::atomic<uint64_t> m_sumUs{0};
+        std::atomic<uint64_t> m_maxUs{0};
+};
+
+} // namespace com::bcom::solar::gprc
+
+#endif // LATENCY_HISTOGRAM_H
@@ -0,0 +1,75 @@
+/**
+ * @copyright Copyright (c) 2021 B-com http://www.b-com.com/
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "MotionGate.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace com::bcom::solar::gprc
+{
+
+MotionGate::MotionGate(float translationThreshold, float rotationThresholdDeg, unsigned int maxIntervalMs)
+    : m_translationThreshold{std::max(0.f, translationThreshold)},
+      m_rotationThreshold{std::max(0.f, rotationThresholdDeg) * static_cast<float>(M_PI) / 180.f},
+      m_maxIntervalMs{maxIntervalMs}
+{
+}
+
+bool MotionGate::accept(long timestamp, const SolAR::datastructure::Transform3Df& pose)
+{
+    if (!enabled())
+        return true;
+
+    // No valid pose from the device (null or not finite matrix): the motion is unknown
+    bool validPose = pose.matrix().allFinite() && (pose.matrix()(3, 3) != 0.f);
+
+    bool forward = m_firstFrame || !validPose
+                   || ((m_maxIntervalMs > 0) && (timestamp - m_lastTimestamp >= static_cast<long>(m_maxIntervalMs)))
+                   || (timestamp < m_lastTimestamp);
+
+    if (!forward) {
+        // Motion since the last forwarded frame, in the frame of the last forwarded pose
+        SolAR::datastructure::Transform3Df delta = m_lastPose.inverse() * pose;
+
+        if ((m_translationThreshold > 0) && (delta.translation().norm() >= m_translationThreshold))
+            forward = true;
+
+        if ((m_rotationThreshold > 0) && !forward) {
+            // Rotation angle from the trace of the rotation matrix
+            float cosAngle = (delta.linear().trace() - 1.f) / 2.f;
+            float angle = std::acos(std::clamp(cosAngle, -1.f, 1.f));
+            forward = (angle >= m_rotationThreshold);
+        }
+    }
+
+    if (!forward)
+        return false;
+
+    m_firstFrame = !validPose;
+    m_lastTimestamp = timestamp;
+    if (validPose)
+        m_lastPose = pose;
+    return true;
+}
+
+void MotionGate::reset()
+{
+    m_firstFrame = true;
+    m_lastTimestamp = 0;
+}
+
+} // namespace com::bcom::solar::gprc
@@ -0,0 +1,67 @@
+/**
+ * @copyright Copyright (c) 2021 B-com http://www.b-com.com/
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MOTION_GATE_H
+#define MOTION_GATE_H
+
+#include <datastructure/MathDefinitions.h>
+
+namespace com::bcom::solar::gprc
+{
+
+/**
+ * @class MotionGate
+ * @brief Selection of the frames to forward according to the device motion
+ *
+ * A frame is forwarded if the device pose sent by the client moved by more
+ * than a translation or a rotation threshold since the last forwarded frame,
+ * or if a maximum time (frame timestamps) elapsed since the last forwarded
+ * frame. The first frame, and the frames without a valid pose, are always
+ * forwarded. A null threshold disables its criterion: the gate is disabled
+ * (all frames forwarded) when both thresholds are null.
+ * Not thread safe: used under the client context mutex.
+ */
+class MotionGate
+{
+    public:
+        /// @param[in] translationThreshold: minimum translation to forward a frame (meters, 0: not used)
+        /// @param[in] rotationThresholdDeg: minimum rotation to forward a frame (degrees, 0: not used)
+        /// @param[in] maxIntervalMs: maximum time between two forwarded frames (milliseconds, 0: no limit)
+        MotionGate(float translationThreshold, float rotationThresholdDeg, unsigned int maxIntervalMs);
+
+        bool enabled() const { return (m_translationThreshold > 0) || (m_rotationThreshold > 0); }
+
+        /// @brief Indicates if a frame must be forwarded (the last forwarded pose is then updated)
+        /// @param[in] timestamp: frame timestamp (milliseconds)
+        /// @param[in] pose: device pose sent with the frame
+        bool accept(long timestamp, const SolAR::datastructure::Transform3Df& pose);
+
+        /// @brief Forward the next frame whatever its pose (client restarted)
+        void reset();
+
+    private:
+        float m_translationThreshold;
+        float m_rotationThreshold;          // Radians
+        unsigned int m_maxIntervalMs;
+
+        bool m_firstFrame = true;
+        long m_lastTimestamp = 0;                       // Timestamp of the last forwarded frame
+        SolAR::datastructure::Transform3Df m_lastPose;  // Pose of the last forwarded frame
+};
+
+} // namespace com::bcom::solar::gprc
+
+#endif // MOTION_GATE_H
@@ -0,0 +1,86 @@
+/**
+ * @copyright Copyright (c) 2021 B-com http://www.b-com.com/
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef PROXY_OPTIONS_H
+#define PROXY_OPTIONS_H
+
+#include "WorkerPool.h"
+
+#include <cstdint>
+
+namespace com::bcom::solar::gprc
+{
+
+#define DEFAULT_WORKER_QUEUE_SIZE 256
+#define DEFAULT_GRPC_POLLERS 2
+#define DEFAULT_REORDER_MAX_DEPTH 4
+#define DEFAULT_REORDER_MAX_LATENCY_MS 150
+#define DEFAULT_FORWARD_JPEG_QUALITY 80
+#define DEFAULT_MAX_IN_FLIGHT_PER_CLIENT 2
+#define DEFAULT_MAX_IN_FLIGHT 0
+#define DEFAULT_MOTION_GATE_MAX_INTERVAL_MS 1000
+#define DEFAULT_DUPLICATE_HISTORY 4
+#define DEFAULT_DUPLICATE_MAX_AGE_MS 1000
+
+/**
+ * @brief Encoding of the images sent to the front end
+ *
+ * Only reduces the bandwidth between the proxy and the front end: the images are
+ * decoded by the proxy and encoded again by the front end client, which costs
+ * proxy CPU time, even with SAME (the received data are never passed through).
+ */
+enum class ForwardEncoding : uint8_t {
+    NONE = 0,   // Raw pixels
+    SAME,       // Encoding of the image received from the client (encoded again)
+    JPEG,
+    PNG
+};
+
+/// @brief Clients whose RGB images are converted to GREY_8 before being sent to the front end
+enum class GreyForward : uint8_t {
+    OFF = 0,                // Images are forwarded with their received layout
+    RELOCALIZATION_ONLY,    // Clients initialized in relocalization only mode (mapping keeps colors)
+    ALL
+};
+
+/**
+ * @struct ProxyOptions
+ * @brief Processing options of the mapping and relocalization proxy (set from the command line)
+ */
+struct ProxyOptions
+{
+    unsigned int nbWorkers = WorkerPool::defaultThreadCount();  // Threads processing the frames
+    unsigned int workerQueueSize = DEFAULT_WORKER_QUEUE_SIZE;   // Frames waiting for a worker before rejecting new ones
+    unsigned int nbGrpcPollers = DEFAULT_GRPC_POLLERS;          // gRPC completion queues polling threads
+    unsigned int reorderMaxDepth = DEFAULT_REORDER_MAX_DEPTH;   // Maximum number of frames held back to reorder them
+    unsigned int reorderMaxLatencyMs = DEFAULT_REORDER_MAX_LATENCY_MS;  // Maximum delay added to reorder frames
+    ForwardEncoding forwardEncoding = ForwardEncoding::NONE;    // Encoding of the images sent to the front end
+    unsigned int forwardJpegQuality = DEFAULT_FORWARD_JPEG_QUALITY;     // JPEG quality (0-100) of the images sent to the front end
+    GreyForward greyForward = GreyForward::OFF;                 // Clients whose images are sent in grey
+    unsigned int targetWidth = 0;       // Minimum width of the images sent to the front end (0: no downscale)
+    unsigned int maxInFlightPerClient = DEFAULT_MAX_IN_FLIGHT_PER_CLIENT;  // Frames of a client sent or waiting to be sent to the front end
+    unsigned int maxInFlight = DEFAULT_MAX_IN_FLIGHT;           // Frames of all the clients sent or waiting to be sent (0: no limit)
+    float motionGateTranslation = 0;    // Device translation (meters) to forward a new frame (0: not used)
+    float motionGateRotationDeg = 0;    // Device rotation (degrees) to forward a new frame (0: not used)
+    unsigned int motionGateMaxIntervalMs = DEFAULT_MOTION_GATE_MAX_INTERVAL_MS;    // Maximum time between two forwarded frames when the device is still
+    unsigned int duplicateDistance = 0; // Maximum Hamming distance between the image hashes of duplicate frames (0: no duplicate detection)
+    unsigned int duplicateHistory = DEFAULT_DUPLICATE_HISTORY;  // Forwarded frames compared with a new frame to detect duplicates
+    unsigned int duplicateMaxAgeMs = DEFAULT_DUPLICATE_MAX_AGE_MS;  // Age after which a forwarded frame is no longer compared
+};
+
+} // namespace com::bcom::solar::gprc
+
+#endif // PROXY_OPTIONS_H
@@ -15,8 +15,13 @@
  */
 
 #include "RelocalizationAndMappingGrpcServiceImpl.h"
+#include "RelocalizationAndMappingReactors.h"
+#include "ImageConversion.h"
 
+#include <algorithm>
+#include <cassert>
 #include <chrono>
+#include <future>
 #include <string>
 
 #include <xpcf/xpcf.h>
@@ -42,19 +47,25 @@ RelocalizationAndMappingGrpcServiceImpl::RelocalizationAndMappingGrpcServiceImpl
         SolAR::api::pipeline::IAsyncRelocalizationPipeline* pipeline): m_pipeline{ pipeline }
 {
     LOG_DEBUG("RelocalizationAndMappingGrpcServiceImpl constructor");
+
+    setMessageAllocators();
 }
 
 RelocalizationAndMappingGrpcServiceImpl::RelocalizationAndMappingGrpcServiceImpl(
         SolAR::api::pipeline::IAsyncRelocalizationPipeline* pipeline,
-        std::string saveFolder): m_pipeline{ pipeline }, m_file_path { saveFolder }
+        std::string saveFolder,
+        const ProxyOptions& options): m_pipeline{ pipeline }, m_options{ options }, m_file_path { saveFolder },
+            m_workerPool{ options.nbWorkers, options.workerQueueSize }
 {
-    // Save images and poses processing function
+    setMessageAllocators();
+
+    // Record frames processing function
     if (saveFolder != "") {
-        auto fnSaveImagesProcessing = [&]() {
-            saveImages();
+        auto fnRecordFramesProcessing = [&]() {
+            recordFrames();
         };
 
-        m_saveImagesTask = new xpcf::DelegateTask(fnSaveImagesProcessing, true);
+        m_recordFramesTask = new xpcf::DelegateTask(fnRecordFramesProcessing, true);
     }
 }
 
@@ -63,10 +74,14 @@ RelocalizationAndMappingGrpcServiceImpl::RelocalizationAndMappingGrpcServiceImpl
         std::string saveFolder,
         uint8_t display_images,
         SRef<SolAR::api::display::IImageViewer> image_viewer_left,
-        SRef<SolAR::api::display::IImageViewer> image_viewer_right):
-            m_pipeline{ pipeline }, m_file_path { saveFolder }, m_display_images { display_images },
-            m_image_viewer_left {image_viewer_left}, m_image_viewer_right{image_viewer_right}
+        SRef<SolAR::api::display::IImageViewer> image_viewer_right,
+        const ProxyOptions& options):
+            m_pipeline{ pipeline }, m_options{ options }, m_file_path { saveFolder }, m_display_images { display_images },
+            m_image_viewer_left {image_viewer_left}, m_image_viewer_right{image_viewer_right},
+            m_workerPool{ options.nbWorkers, options.workerQueueSize }
 {
+    setMessageAllocators();
+
     // Display images processing function
     if (display_images != 0) {
         auto fnDisplayImagesProcessing = [&]() {
@@ -76,13 +91,13 @@ RelocalizationAndMappingGrpcServiceImpl::RelocalizationAndMappingGrpcServiceImpl
         m_displayImagesTask = new xpcf::DelegateTask(fnDisplayImagesProcessing, true);
     }
 
-    // Save images and poses processing function
+    // Record frames processing function
     if (saveFolder != "") {
-        auto fnSaveImagesProcessing = [&]() {
-            saveImages();
+        auto fnRecordFramesProcessing = [&]() {
+            recordFrames();
         };
 
-        m_saveImagesTask = new xpcf::DelegateTask(fnSaveImagesProcessing, true);
+        m_recordFramesTask = new xpcf::DelegateTask(fnRecordFramesProcessing, true);
     }
 }
 
@@ -93,8 +108,8 @@ RelocalizationAndMappingGrpcServiceImpl::~RelocalizationAndMappingGrpcServiceImp
     if (m_displayImagesTask != nullptr)
         delete m_displayImagesTask;
 
-    if (m_saveImagesTask != nullptr)
-        delete m_saveImagesTask;
+    if (m_recordFramesTask != nullptr)
+        delete m_recordFramesTask;
 }
 
 grpc::Status
@@ -114,9 +129,8 @@ RelocalizationAndMappingGrpcServiceImpl::RegisterClient(grpc::ServerContext* con
     LOG_INFO("Client registered with UUID = {}", clientUUID);
 
     // Add the new client to the map
-    SRef<ProxyClientContext> clientContext = xpcf::utils::make_shared<ProxyClientContext>();
-    unique_lock<mutex> lock(m_mutexClientMap);
-    m_clientsMap.insert(pair<string, SRef<ProxyClientContext>>(clientUUID, clientContext));
+    SRef<ProxyClientContext> clientContext = xpcf::utils::make_shared<ProxyClientContext>(m_options, m_workerPool);
+    m_clients.insert(clientUUID, clientContext);
 
     return Status::OK;
 }
@@ -132,11 +146,23 @@ RelocalizationAndMappingGrpcServiceImpl::UnregisterClient(grpc::ServerContext* c
         LOG_ERROR("Error while unregistering the client to the mapping and relocalization front end service");
     }
 
+    // End the subscriptions to the results of the client
+    SRef<ProxyClientContext> clientContext = getClientContext(request->client_uuid());
+    if (clientContext != nullptr) {
+        // Client not stopped: complete its recording
+        if (clientContext->m_started) {
+            clientContext->m_started = false;
+            stopClient(clientContext);
+        }
+
+        std::unique_lock<std::mutex> lock(clientContext->m_subscribersMutex);
+        clientContext->m_subscriptionsClosed = true;
+        for (TransformSubscriber* subscriber : clientContext->m_subscribers)
+            subscriber->close();
+    }
+
     // Remove the client and its services from the map
-    unique_lock<mutex> lock(m_mutexClientMap);
-    auto it = m_clientsMap.find(request->client_uuid());
-    if (it != m_clientsMap.end())
-        m_clientsMap.erase(it);
+    m_clients.erase(request->client_uuid());
 
     return Status::OK;
 }
@@ -160,7 +186,23 @@ RelocalizationAndMappingGrpcServiceImpl::Init(grpc::ServerContext* context,
         return gRpcError("Error while initializing the mapping and relocalization front end service");
     }
 
-    clientContext->m_started = false;
+    // Client started again by Start only: stop it (started clients count, recording completed)
+    if (clientContext->m_started) {
+        clientContext->m_started = false;
+        stopClient(clientContext);
+    }
+
+    int previousPipelineMode = clientContext->m_pipelineMode.exchange(request->pipeline_mode());
+    if ((previousPipelineMode != -1) && (previousPipelineMode != request->pipeline_mode()))
+        count(*clientContext, ServiceStats::MODE_SWITCHES);
+
+    // Luminance is enough for relocalization: RGB images can be sent in grey to the front end
+    bool forwardGrey = (m_options.greyForward == GreyForward::ALL)
+                       || ((m_options.greyForward == GreyForward::RELOCALIZATION_ONLY)
+                           && (request->pipeline_mode() == RELOCALIZATION_ONLY));
+    clientContext->m_forwardGrey = forwardGrey;
+    if (forwardGrey)
+        LOG_INFO("RGB images of client {} are sent in grey to the front end", request->client_uuid());
 
     LOG_DEBUG("Init mapping and relocalization service OK");
 
@@ -186,35 +228,58 @@ RelocalizationAndMappingGrpcServiceImpl::Start(grpc::ServerContext* context,
 
     LOG_INFO("Start mapping and relocalization service");
 
+    // Save mode: one recording file per client session (created before the front end is started,
+    // the front end is never left started by an error)
+    SRef<FrameRecordingWriter> recorder;
+    if (m_file_path != "") {
+        {
+            std::unique_lock<std::mutex> lock(clientContext->m_images_vector_mutex);
+            recorder = createRecorder(request->client_uuid(), clientContext->m_recordingCameras);
+        }
+        if (recorder == nullptr)
+            return gRpcError("Error while creating the recording file");
+    }
+
     if (m_pipeline->start(request->client_uuid()) != SolAR::FrameworkReturnCode::_SUCCESS) {
         LOG_ERROR("Error while starting the mapping and relocalization front end service");
+        if (recorder != nullptr) {
+            // No session: no recording file
+            recorder->close();
+            boost::system::error_code error;
+            boost::filesystem::remove(boost::filesystem::path(recorder->path()), error);
+        }
         return gRpcError("Error while starting the mapping and relocalization front end service");
     }
 
-    clientContext->m_cameraMode = UNKNOWN_CAMERA_MODE;
-    clientContext->m_ordered_images.clear();
-    clientContext->m_last_image_timestamp = 0;
-
-    clientContext->m_started = true;
+    {
+        std::unique_lock<std::mutex> lock(clientContext->m_images_vector_mutex);
+
+        clientContext->m_cameraMode = UNKNOWN_CAMERA_MODE;
+        clientContext->m_ordered_images.clear();
+        clientContext->m_reorderPolicy.reset();
+        clientContext->m_motionGate.reset();
+        clientContext->m_duplicateFilter.reset();
+        clientContext->m_last_image_timestamp = 0;
+        clientContext->m_coalescedFrames = nullptr;
+        setLastResult(*clientContext, PoseResult{});
+        clientContext->m_recorder = std::move(recorder);
+    }
 
-    LOG_DEBUG("Start mapping and relocalization service OK");
+    // Display and record tasks run while at least one client is started
+    {
+        std::unique_lock<std::mutex> lock(m_startedClientsMutex);
+        if (m_nbStartedClients++ == 0) {
+            if (m_displayImagesTask != nullptr)
+                m_displayImagesTask->start();
 
-    m_index_image = 0;
-    if (m_file_path != "") {
-        m_image1_path = m_file_path + "/000/";
-        boost::filesystem::create_directories(boost::filesystem::path(m_image1_path.c_str()));
-        m_poseFile1.open(m_file_path + "/pose_000.txt");
-        m_image2_path = m_file_path + "/001/";
-        boost::filesystem::create_directories(boost::filesystem::path(m_image2_path.c_str()));
-        m_poseFile2.open(m_file_path + "/pose_001.txt");
-        m_timestampFile.open(m_file_path + "/timestamps.txt");
+            if (m_recordFramesTask != nullptr)
+                m_recordFramesTask->start();
+        }
     }
 
-    if (m_displayImagesTask != nullptr)
-        m_displayImagesTask->start();
+    clientContext->m_started = true;
 
-    if (m_saveImagesTask != nullptr)
-        m_saveImagesTask->start();
+    LOG_DEBUG("Start mapping and relocalization service OK");
 
     return Status::OK;
 }
@@ -240,25 +305,16 @@ RelocalizationAndMappingGrpcServiceImpl::Stop(grpc::ServerContext* context,
 
     LOG_INFO("Stop mapping and relocalization service");
 
-    if (m_pipeline->stop(request->client_uuid()) != SolAR::FrameworkReturnCode::_SUCCESS)
+    bool pipelineStopped = (m_pipeline->stop(request->client_uuid()) == SolAR::FrameworkReturnCode::_SUCCESS);
+
+    // The client is stopped by the proxy, even if the front end failed to stop
+    stopClient(clientContext);
+
+    if (!pipelineStopped)
     {
         return gRpcError("Error while stopping the mapping and relocalization front end service");
     }
 
-    if (m_file_path != "") {
-        // Wait to let all data be saved in files
-        std::this_thread::sleep_for(std::chrono::milliseconds(1000));
-        m_poseFile1.close();
-        m_poseFile2.close();
-        m_timestampFile.close();
-    }
-
-    if (m_displayImagesTask != nullptr)
-        m_displayImagesTask->stop();
-
-    if (m_saveImagesTask != nullptr)
-        m_saveImagesTask->stop();
-
     LOG_DEBUG("Stop mapping and relocalization service OK");
 
     return Status::OK;
@@ -306,10 +362,12 @@ RelocalizationAndMappingGrpcServiceImpl::SetCameraParameters(grpc::ServerContext
     solarCamParams.distortion(3,0) = request->distortion().p_1();
     solarCamParams.distortion(4,0) = request->distortion().k_3();
 
-    if (m_pipeline->setCameraParameters(request->client_uuid(), solarCamParams) != SolAR::FrameworkReturnCode::_SUCCESS)
-    {
-        return gRpcError("Error while setting camera parameters for the mapping and relocalization front end service");
-    }
+    RecordingCamera camera = toRecording(0, request->camera_type(), request->width(), request->height(),
+                                         request->intrinsics(), request->distortion(), request->rotation());
+
+    auto status = setCameraParametersInternal(request->client_uuid(), &solarCamParams, &camera, 1);
+    if (!status.ok())
+        return status;
 
     LOG_DEBUG("Set camera parameters for relocalization and mapping OK");
 
@@ -349,56 +407,61 @@ RelocalizationAndMappingGrpcServiceImpl::SetCameraParametersStereo(grpc::ServerC
               request->distortion2().p_2(),
               request->distortion2().k_3());
 
-    SolAR::datastructure::CameraParameters solarCamParams1;
-    solarCamParams1.name = request->name1();
-    solarCamParams1.id = request->id1();
-    solarCamParams1.type = toSolAR(request->camera_type1());
-    solarCamParams1.resolution.width = request->width1();
-    solarCamParams1.resolution.height = request->height1();
-
-    solarCamParams1.intrinsic(0,0) = request->intrinsics1().m11();
-    solarCamParams1.intrinsic(0,1) = request->intrinsics1().m12();
-    solarCamParams1.intrinsic(0,2) = request->intrinsics1().m13();
-    solarCamParams1.intrinsic(1,0) = request->intrinsics1().m21();
-    solarCamParams1.intrinsic(1,1) = request->intrinsics1().m22();
-    solarCamParams1.intrinsic(1,2) = request->intrinsics1().m23();
-    solarCamParams1.intrinsic(2,0) = request->intrinsics1().m31();
-    solarCamParams1.intrinsic(2,1) = request->intrinsics1().m32();
-    solarCamParams1.intrinsic(2,2) = request->intrinsics1().m33();
-
-    solarCamParams1.distortion(0,0) = request->distortion1().k_1();
-    solarCamParams1.distortion(1,0) = request->distortion1().k_2();
-    solarCamParams1.distortion(2,0) = request->distortion1().p_1();
-    solarCamParams1.distortion(3,0) = request->distortion1().p_1();
-    solarCamParams1.distortion(4,0) = request->distortion1().k_3();
-
-    SolAR::datastructure::CameraParameters solarCamParams2;
-    solarCamParams2.name = request->name2();
-    solarCamParams2.id = request->id2();
-    solarCamParams2.type = toSolAR(request->camera_type2());
-    solarCamParams2.resolution.width = request->width2();
-    solarCamParams2.resolution.height = request->height2();
-
-    solarCamParams2.intrinsic(0,0) = request->intrinsics2().m11();
-    solarCamParams2.intrinsic(0,1) = request->intrinsics2().m12();
-    solarCamParams2.intrinsic(0,2) = request->intrinsics2().m13();
-    solarCamParams2.intrinsic(1,0) = request->intrinsics2().m21();
-    solarCamParams2.intrinsic(1,1) = request->intrinsics2().m22();
-    solarCamParams2.intrinsic(1,2) = request->intrinsics2().m23();
-    solarCamParams2.intrinsic(2,0) = request->intrinsics2().m31();
-    solarCamParams2.intrinsic(2,1) = request->intrinsics2().m32();
-    solarCamParams2.intrinsic(2,2) = request->intrinsics2().m33();
-
-    solarCamParams2.distortion(0,0) = request->distortion2().k_1();
-    solarCamParams2.distortion(1,0) = request->distortion2().k_2();
-    solarCamParams2.distortion(2,0) = request->distortion2().p_1();
-    solarCamParams2.distortion(3,0) = request->distortion2().p_1();
-    solarCamParams2.distortion(4,0) = request->distortion2().k_3();
-
-    if (m_pipeline->setCameraParameters(request->client_uuid(), solarCamParams1, solarCamParams2) != SolAR::FrameworkReturnCode::_SUCCESS)
-    {
-        return gRpcError("Error while setting camera parameters for the stereo mapping and relocalization front end service");
-    }
+    SolAR::datastructure::CameraParameters solarCamParams[2];
+    solarCamParams[0].name = request->name1();
+    solarCamParams[0].id = request->id1();
+    solarCamParams[0].type = toSolAR(request->camera_type1());
+    solarCamParams[0].resolution.width = request->width1();
+    solarCamParams[0].resolution.height = request->height1();
+
+    solarCamParams[0].intrinsic(0,0) = request->intrinsics1().m11();
+    solarCamParams[0].intrinsic(0,1) = request->intrinsics1().m12();
+    solarCamParams[0].intrinsic(0,2) = request->intrinsics1().m13();
+    solarCamParams[0].intrinsic(1,0) = request->intrinsics1().m21();
+    solarCamParams[0].intrinsic(1,1) = request->intrinsics1().m22();
+    solarCamParams[0].intrinsic(1,2) = request->intrinsics1().m23();
+    solarCamParams[0].intrinsic(2,0) = request->intrinsics1().m31();
+    solarCamParams[0].intrinsic(2,1) = request->intrinsics1().m32();
+    solarCamParams[0].intrinsic(2,2) = request->intrinsics1().m33();
+
+    solarCamParams[0].distortion(0,0) = request->distortion1().k_1();
+    solarCamParams[0].distortion(1,0) = request->distortion1().k_2();
+    solarCamParams[0].distortion(2,0) = request->distortion1().p_1();
+    solarCamParams[0].distortion(3,0) = request->distortion1().p_1();
+    solarCamParams[0].distortion(4,0) = request->distortion1().k_3();
+
+    solarCamParams[1].name = request->name2();
+    solarCamParams[1].id = request->id2();
+    solarCamParams[1].type = toSolAR(request->camera_type2());
+    solarCamParams[1].resolution.width = request->width2();
+    solarCamParams[1].resolution.height = request->height2();
+
+    solarCamParams[1].intrinsic(0,0) = request->intrinsics2().m11();
+    solarCamParams[1].intrinsic(0,1) = request->intrinsics2().m12();
+    solarCamParams[1].intrinsic(0,2) = request->intrinsics2().m13();
+    solarCamParams[1].intrinsic(1,0) = request->intrinsics2().m21();
+    solarCamParams[1].intrinsic(1,1) = request->intrinsics2().m22();
+    solarCamParams[1].intrinsic(1,2) = request->intrinsics2().m23();
+    solarCamParams[1].intrinsic(2,0) = request->intrinsics2().m31();
+    solarCamParams[1].intrinsic(2,1) = request->intrinsics2().m32();
+    solarCamParams[1].intrinsic(2,2) = request->intrinsics2().m33();
+
+    solarCamParams[1].distortion(0,0) = request->distortion2().k_1();
+    solarCamParams[1].distortion(1,0) = request->distortion2().k_2();
+    solarCamParams[1].distortion(2,0) = request->distortion2().p_1();
+    solarCamParams[1].distortion(3,0) = request->distortion2().p_1();
+    solarCamParams[1].distortion(4,0) = request->distortion2().k_3();
+
+    RecordingCamera cameras[2] = {
+        toRecording(0, request->camera_type1(), request->width1(), request->height1(),
+                    request->intrinsics1(), request->distortion1(), request->rotation1()),
+        toRecording(1, request->camera_type2(), request->width2(), request->height2(),
+                    request->intrinsics2(), request->distortion2(), request->rotation2())
+    };
+
+    auto status = setCameraParametersInternal(request->client_uuid(), solarCamParams, cameras, 2);
+    if (!status.ok())
+        return status;
 
     LOG_DEBUG("Set camera parameters for relocalization and stereo mapping OK");
 
@@ -475,298 +538,986 @@ RelocalizationAndMappingGrpcServiceImpl::setRectificationParameters(grpc::Server
     solarCam2RectParams.type = toSolAR(request->cam2_stereo_type());
     solarCam2RectParams.baseline = request->cam2_baseline();
 
-    if (m_pipeline->setRectificationParameters(request->client_uuid(), solarCam1RectParams, solarCam2RectParams) != SolAR::FrameworkReturnCode::_SUCCESS)
-    {
-        return gRpcError("Error while setting camera rectification parameters for the mapping and relocalization front end service");
-    }
+    auto status = setRectificationParametersInternal(request->client_uuid(), solarCam1RectParams, solarCam2RectParams);
+    if (!status.ok())
+        return status;
 
     LOG_DEBUG("Set camera rectification parameters for relocalization and mapping OK");
 
     return Status::OK;
 }
 
-bool RelocalizationAndMappingGrpcServiceImpl::sortbythird (
-        const std::tuple<std::vector<SRef<SolAR::datastructure::Image>>,
-                         std::vector<SolAR::datastructure::Transform3Df>, long> a,
-        const std::tuple<std::vector<SRef<SolAR::datastructure::Image>>,
-                         std::vector<SolAR::datastructure::Transform3Df>, long> b)
+grpc::Status
+RelocalizationAndMappingGrpcServiceImpl::setCameraParametersInternal(const std::string& clientUUID,
+                                                                     SolAR::datastructure::CameraParameters* cameras,
+                                                                     const RecordingCamera* recordingCameras,
+                                                                     size_t nbCameras)
 {
-    return (std::get<2>(a) < std::get<2>(b));
+    // Images are downscaled before being sent to the front end: intrinsics must match
+    // (same factor for both cameras)
+    SRef<ProxyClientContext> clientContext = getClientContext(clientUUID);
+    if (clientContext != nullptr) {
+        unsigned int factor = downscaleFactor(recordingCameras[0].width);
+        clientContext->m_downscaleFactor = factor;
+        // Default rotation: none for the first camera, 180 degrees for the second one
+        clientContext->m_rotate180[0] = (static_cast<ImageRotation>(recordingCameras[0].rotation) == ROTATION_180);
+        if (nbCameras == 2)
+            clientContext->m_rotate180[1] = (static_cast<ImageRotation>(recordingCameras[1].rotation) != NO_ROTATION);
+        if (m_file_path != "") {
+            for (size_t i = 0; i < nbCameras; i++)
+                setRecordingCamera(*clientContext, recordingCameras[i]);
+        }
+        if (factor > 1) {
+            for (size_t i = 0; i < nbCameras; i++)
+                downscaleCameraParameters(cameras[i], factor);
+            LOG_INFO("Images downscaled by {}: {}x{}", factor,
+                     cameras[0].resolution.width, cameras[0].resolution.height);
+        }
+    }
+
+    if (nbCameras == 1) {
+        if (m_pipeline->setCameraParameters(clientUUID, cameras[0]) != SolAR::FrameworkReturnCode::_SUCCESS)
+            return gRpcError("Error while setting camera parameters for the mapping and relocalization front end service");
+    }
+    else if (m_pipeline->setCameraParameters(clientUUID, cameras[0], cameras[1]) != SolAR::FrameworkReturnCode::_SUCCESS) {
+        return gRpcError("Error while setting camera parameters for the stereo mapping and relocalization front end service");
+    }
+
+    return Status::OK;
 }
 
 grpc::Status
-RelocalizationAndMappingGrpcServiceImpl::RelocalizeAndMap(grpc::ServerContext* context,
+RelocalizationAndMappingGrpcServiceImpl::setRectificationParametersInternal(const std::string& clientUUID,
+                                                                            SolAR::datastructure::RectificationParameters& cam1RectParams,
+                                                                            SolAR::datastructure::RectificationParameters& cam2RectParams)
+{
+    SRef<ProxyClientContext> clientContext = getClientContext(clientUUID);
+    if ((clientContext != nullptr) && (clientContext->m_downscaleFactor > 1)) {
+        downscaleRectificationParameters(cam1RectParams, clientContext->m_downscaleFactor);
+        downscaleRectificationParameters(cam2RectParams, clientContext->m_downscaleFactor);
+    }
+
+    if (m_pipeline->setRectificationParameters(clientUUID, cam1RectParams, cam2RectParams) != SolAR::FrameworkReturnCode::_SUCCESS)
+    {
+        return gRpcError("Error while setting camera rectification parameters for the mapping and relocalization front end service");
+    }
+
+    return Status::OK;
+}
+
+ServerUnaryReactor*
+RelocalizationAndMappingGrpcServiceImpl::RelocalizeAndMap(CallbackServerContext* context,
                                                           const Frames* request,
                                                           RelocalizationResult* response)
 {
-    return RelocalizeAndMapInternal(context, request, {}, /* fixedpose = */ false, response);
+    ServerUnaryReactor* reactor = context->DefaultReactor();
+
+    // Request and response live on the call arena until the reactor is finished, or
+    // until the frames kept waiting for the front end are done with the request
+    bool submitted = m_workerPool.trySubmit([this, context, request, response, reactor,
+                                             receivedTime = std::chrono::steady_clock::now()]() {
+        ReceivedFrames frames;
+        auto status = toReceivedFrames(*request, frames);
+        if (!status.ok()) {
+            reactor->Finish(status);
+            return;
+        }
+        frames.receivedTime = receivedTime;
+        frames.owner = RetainableMessages::retain(context->GetRpcAllocatorState());
+
+        RelocalizeAndMapInternal(request->client_uuid(), frames, nullTransform(), /* fixedpose = */ false,
+                                 [response, reactor](const grpc::Status& status, const PoseResult& result) {
+                                     toGrpc(result, *response);
+                                     reactor->Finish(status);
+                                 });
+    });
+
+    if (!submitted) {
+        LOG_WARNING("Too many frames waiting to be processed: drop frames");
+        countRejected(request->client_uuid());
+        reactor->Finish(gRpcError("Too many frames waiting to be processed: drop frames",
+                                  grpc::StatusCode::RESOURCE_EXHAUSTED));
+    }
+
+    return reactor;
 }
 
-grpc::Status
-RelocalizationAndMappingGrpcServiceImpl::RelocalizeAndMapGroundTruth(grpc::ServerContext* context,
+ServerUnaryReactor*
+RelocalizationAndMappingGrpcServiceImpl::RelocalizeAndMapGroundTruth(CallbackServerContext* context,
                                                                      const GroundTruthFrames* request,
                                                                      RelocalizationResult* response)
 {
-    return RelocalizeAndMapInternal(context, &request->frames(), request->world_transorm(), request->fixed_pose(), response);
+    ServerUnaryReactor* reactor = context->DefaultReactor();
+
+    // Request and response live on the call arena until the reactor is finished, or
+    // until the frames kept waiting for the front end are done with the request
+    bool submitted = m_workerPool.trySubmit([this, context, request, response, reactor,
+                                             receivedTime = std::chrono::steady_clock::now()]() {
+        ReceivedFrames frames;
+        auto status = toReceivedFrames(request->frames(), frames);
+        if (!status.ok()) {
+            reactor->Finish(status);
+            return;
+        }
+        frames.receivedTime = receivedTime;
+        frames.owner = RetainableMessages::retain(context->GetRpcAllocatorState());
+
+        RelocalizeAndMapInternal(request->client_uuid(), frames, toSolAR(request->world_transorm()), request->fixed_pose(),
+                                 [response, reactor](const grpc::Status& status, const PoseResult& result) {
+                                     toGrpc(result, *response);
+                                     reactor->Finish(status);
+                                 });
+    });
+
+    if (!submitted) {
+        LOG_WARNING("Too many frames waiting to be processed: drop frames");
+        countRejected(request->client_uuid());
+        reactor->Finish(gRpcError("Too many frames waiting to be processed: drop frames",
+                                  grpc::StatusCode::RESOURCE_EXHAUSTED));
+    }
+
+    return reactor;
 }
 
-grpc::Status
-RelocalizationAndMappingGrpcServiceImpl::RelocalizeAndMapInternal(grpc::ServerContext* context,
-                                                                  const Frames* request,
-                                                                  const ::com::bcom::solar::gprc::Matrix4x4& worldTransform,
+ServerUnaryReactor*
+RelocalizationAndMappingGrpcServiceImpl::RelocalizeAndMapBatch(CallbackServerContext* context,
+                                                               const FramesBatch* request,
+                                                               RelocalizationResults* response)
+{
+    ServerUnaryReactor* reactor = context->DefaultReactor();
+
+    // Request and response live on the call arena until the reactor is finished, or
+    // until the frames kept waiting for the front end are done with the request
+    bool submitted = m_workerPool.trySubmit([this, context, request, response, reactor,
+                                             receivedTime = std::chrono::steady_clock::now()]() {
+        std::shared_ptr<const void> owner = RetainableMessages::retain(context->GetRpcAllocatorState());
+        std::vector<ReceivedFrames> frames(request->frames_size());
+        for (int i = 0; i < request->frames_size(); i++) {
+            auto status = toReceivedFrames(request->frames(i), frames[i]);
+            if (!status.ok()) {
+                reactor->Finish(status);
+                return;
+            }
+            frames[i].receivedTime = receivedTime;
+            frames[i].owner = owner;
+        }
+
+        RelocalizeAndMapBatchInternal(request->client_uuid(), frames, request->last_result_only(),
+                                      [response, reactor](const grpc::Status& status, std::vector<PoseResult>& results) {
+                                          for (const PoseResult& result : results)
+                                              toGrpc(result, *response->add_results());
+                                          reactor->Finish(status);
+                                      });
+    });
+
+    if (!submitted) {
+        LOG_WARNING("Too many frames waiting to be processed: drop frames");
+        countRejected(request->client_uuid());
+        reactor->Finish(gRpcError("Too many frames waiting to be processed: drop frames",
+                                  grpc::StatusCode::RESOURCE_EXHAUSTED));
+    }
+
+    return reactor;
+}
+
+ServerBidiReactor<Frames, RelocalizationResult>*
+RelocalizationAndMappingGrpcServiceImpl::RelocalizeAndMapStream(CallbackServerContext* context)
+{
+    return new RelocalizeAndMapStreamReactor<RelocalizationAndMappingGrpcServiceImpl>(this, context);
+}
+
+ServerWriteReactor<RelocalizationResult>*
+RelocalizationAndMappingGrpcServiceImpl::SubscribeTransforms(CallbackServerContext* context,
+                                                             const ClientUUID* request)
+{
+    return new SubscribeTransformsReactor<RelocalizationAndMappingGrpcServiceImpl>(getClientContext(request->client_uuid()),
+                                                                                   request->client_uuid());
+}
+
+void
+RelocalizationAndMappingGrpcServiceImpl::RelocalizeAndMapInternal(const std::string& clientUUID,
+                                                                  const ReceivedFrames& request,
+                                                                  const SolAR::datastructure::Transform3Df& worldTransform,
                                                                   bool fixedPose,
-                                                                  RelocalizationResult* response)
+                                                                  ResultCallback done)
 {
     // Get context for current client
-    SRef<ProxyClientContext> clientContext = getClientContext(request->client_uuid());
+    SRef<ProxyClientContext> clientContext = getClientContext(clientUUID);
     if (clientContext == nullptr) {
-        LOG_ERROR("Unknown client with UUID: {}", request->client_uuid());
-        return gRpcError("Unknown client UUID");
+        LOG_ERROR("Unknown client with UUID: {}", clientUUID);
+        m_stats.counters[ServiceStats::REQUESTS]++;
+        m_stats.counters[ServiceStats::ERRORS]++;
+        done(gRpcError("Unknown client UUID"), PoseResult{});
+        return;
     }
 
-    response->set_confidence(0);
-    response->set_mapping_status(MappingStatus::BOOTSTRAP);
-    response->set_pose_status(RelocalizationPoseStatus::NO_POSE);
+    // The request is counted when answered, with its total latency
+    recordLatency(*clientContext, ServiceStats::QUEUE_WAIT, std::chrono::steady_clock::now() - request.receivedTime);
+    ResultCallback answer = [this, clientContext, receivedTime = request.receivedTime, done = std::move(done)](
+                                    const grpc::Status& status, const PoseResult& result) {
+        recordAnswer(*clientContext, receivedTime, status);
+        done(status, result);
+    };
 
     if (!clientContext->m_started) {
         LOG_INFO("Proxy is not started");
-        return gRpcError("Error: proxy is not started");
+        answer(gRpcError("Error: proxy is not started"), PoseResult{});
+        return;
     }
 
-    // Display images if specified
-    if ((m_display_images == 1) && (m_displayImagesTask != nullptr)) {
-        std::vector<SRef<SolARImage>> imagesToDisplay;
-        SRef<SolARImage> image1, image2;
-        if (request->frames_size() >= 1) {
-            auto status  = buildSolARImage(request->frames(0), toSolAR(request->frames(0).pose()), image1);
-            if (status.ok())
-            {
-                imagesToDisplay.push_back(image1);
+    // Prepare stage: compressed images are not decoded yet
+    SRef<PendingFrames> frames;
+    auto status = prepareFrames(clientUUID, request, *clientContext, frames);
+    if (!status.ok() || (frames == nullptr)) {
+        answer(status, PoseResult{});
+        return;
+    }
+
+    ScheduledFrames scheduledFrames{std::move(frames), &worldTransform, fixedPose, std::move(answer)};
+    scheduleFrames(clientContext, clientUUID, &scheduledFrames, 1);
+}
+
+void
+RelocalizationAndMappingGrpcServiceImpl::scheduleFrames(const SRef<ProxyClientContext>& clientContext,
+                                                        const std::string& clientUUID,
+                                                        ScheduledFrames* batch,
+                                                        size_t size)
+{
+    // Reorder stage
+    std::unique_lock<std::mutex> lock(clientContext->m_images_vector_mutex);
+    auto now = std::chrono::steady_clock::now();
+
+    for (size_t i = 0; i < size; i++) {
+        ScheduledFrames& scheduled = batch[i];
+
+        // The ring holds the maximum depth + 1 frames and is back to the depth after each push:
+        // it is never full here
+        scheduled.frames->reorderTime = now;
+        bool pushed = clientContext->m_ordered_images.push(scheduled.frames->timestamp, std::move(scheduled.frames));
+        assert(pushed && "Reorder buffer full");
+        (void)pushed;
+
+        // The depth may have decreased: drop the frames held back for too long
+        unsigned int depth = clientContext->m_reorderPolicy.depth();
+        while (clientContext->m_ordered_images.size() > depth + 1) {
+            SRef<PendingFrames> framesToDrop;
+            clientContext->m_ordered_images.pop(clientContext->m_last_image_timestamp, framesToDrop);
+            count(*clientContext, ServiceStats::SHRINK_DROPPED);
+            LOG_DEBUG("Reorder buffer depth decreased to {}: drop image", depth);
+        }
+
+        // If more frames than the depth, send the older frames to Front End
+        if (clientContext->m_ordered_images.size() <= depth) {
+            scheduled.answer = ScheduledFrames::Answer::HELD;
+            continue;
+        }
+
+        SRef<PendingFrames> framesToSend;
+        long processedTimestamp;
+        clientContext->m_ordered_images.pop(processedTimestamp, framesToSend);
+        clientContext->m_last_image_timestamp = processedTimestamp;
+        recordLatency(*clientContext, ServiceStats::REORDER, now - framesToSend->reorderTime);
+        framesToSend->worldTransform = *scheduled.worldTransform;
+        framesToSend->fixedPose = scheduled.fixedPose;
+
+        // Motion gate: while the device stands still, the frames are answered at once with the last
+        // result and are never decoded nor forwarded (all the frames are forwarded when recorded)
+        if (!framesToSend->catchUp && (framesToSend->recorder == nullptr)
+            && !clientContext->m_motionGate.accept(processedTimestamp, framesToSend->devicePose)) {
+            count(*clientContext, ServiceStats::MOTION_GATED);
+            scheduled.answer = ScheduledFrames::Answer::LATEST_RESULT;
+            continue;
+        }
+
+        // Admission stage: frames of a batch are the backlog the front end must catch up with,
+        // they take an in-flight slot over budget and are queued on the client strand
+        if (framesToSend->catchUp) {
+            clientContext->m_nbInFlight++;
+            m_nbInFlight++;
+        }
+        // Over budget, the newest frames wait to be forwarded after the frames in flight, and the
+        // request is answered at once with the last result (staleness instead of queueing latency)
+        else if (!admitFrames(*clientContext)) {
+            if (clientContext->m_coalescedFrames != nullptr) {
+                count(*clientContext, ServiceStats::OVERLOAD_DROPPED);
+                LOG_DEBUG("Client over budget: drop image");
             }
+            clientContext->m_coalescedFrames = std::move(framesToSend);
+            count(*clientContext, ServiceStats::LATEST_POSE_REPLIES);
+            scheduled.answer = ScheduledFrames::Answer::LATEST_RESULT;
+            continue;
         }
-        if (request->frames_size() == 2) {
-            auto status  = buildSolARImage(request->frames(0), toSolAR(request->frames(0).pose()), image2);
-            if (status.ok())
-            {
-                imagesToDisplay.push_back(image2);
+
+        // Frames still coalesced (proxy over budget) are older than the admitted ones
+        if (clientContext->m_coalescedFrames != nullptr) {
+            clientContext->m_coalescedFrames = nullptr;
+            count(*clientContext, ServiceStats::OVERLOAD_DROPPED);
+        }
+
+        // Forward stage: frames of a client are sent one at a time, in timestamp order
+        // (posted under the reorder buffer lock to keep the order)
+        scheduled.frames = framesToSend;
+        scheduled.answer = ScheduledFrames::Answer::FORWARDED;
+        postForward(clientContext, clientUUID, std::move(framesToSend), std::move(scheduled.done));
+    }
+
+    lock.unlock();
+
+    for (size_t i = 0; i < size; i++) {
+        ScheduledFrames& scheduled = batch[i];
+
+        switch (scheduled.answer)
+        {
+            case ScheduledFrames::Answer::HELD:
+                LOG_INFO("Not enough images to process");
+                scheduled.done(Status::OK, PoseResult{});
+                break;
+            case ScheduledFrames::Answer::LATEST_RESULT:
+                scheduled.done(Status::OK, latestResult(*clientContext));
+                break;
+            case ScheduledFrames::Answer::FORWARDED:
+                break;
+        }
+    }
+
+    // Decode stage: only frames leaving the reorder buffer are decoded, on this worker,
+    // while the client strand may still be forwarding the previous frames
+    for (size_t i = 0; i < size; i++) {
+        const SRef<PendingFrames>& frames = batch[i].frames;
+        if ((batch[i].answer == ScheduledFrames::Answer::FORWARDED)
+            && ((frames->recorder == nullptr) || (m_displayImagesTask != nullptr)))
+            decodeFrames(*frames);
+    }
+}
+
+void
+RelocalizationAndMappingGrpcServiceImpl::RelocalizeAndMapBatchInternal(const std::string& clientUUID,
+                                                                       const std::vector<ReceivedFrames>& request,
+                                                                       bool lastResultOnly,
+                                                                       BatchResultCallback done)
+{
+    // Get context for current client
+    SRef<ProxyClientContext> clientContext = getClientContext(clientUUID);
+    if (clientContext == nullptr) {
+        LOG_ERROR("Unknown client with UUID: {}", clientUUID);
+        m_stats.counters[ServiceStats::REQUESTS]++;
+        m_stats.counters[ServiceStats::ERRORS]++;
+        std::vector<PoseResult> results;
+        done(gRpcError("Unknown client UUID"), results);
+        return;
+    }
+
+    const size_t nbFrames = request.size();
+    if (nbFrames == 0) {
+        std::vector<PoseResult> results;
+        done(Status::OK, results);
+        return;
+    }
+
+    // The batch is counted as one request when answered, with its total latency
+    auto receivedTime = request[0].receivedTime;
+    recordLatency(*clientContext, ServiceStats::QUEUE_WAIT, std::chrono::steady_clock::now() - receivedTime);
+    BatchResultCallback answer = [this, clientContext, receivedTime, done = std::move(done)](
+                                         const grpc::Status& status, std::vector<PoseResult>& results) {
+        recordAnswer(*clientContext, receivedTime, status);
+        done(status, results);
+    };
+
+    if (!clientContext->m_started) {
+        LOG_INFO("Proxy is not started");
+        std::vector<PoseResult> results;
+        answer(gRpcError("Error: proxy is not started"), results);
+        return;
+    }
+
+    // One result for each frames, answered by the strand or at once: the call is finished by the last answer
+    struct BatchState
+    {
+        std::atomic<size_t> nbPending;
+        std::mutex statusMutex;
+        grpc::Status status;
+        std::vector<PoseResult> results;
+    };
+    auto state = xpcf::utils::make_shared<BatchState>();
+    state->nbPending = nbFrames;
+    state->results.resize(nbFrames);
+
+    auto onAnswered = [state, lastResultOnly, done = std::move(answer)](size_t index, const grpc::Status& status,
+                                                                       const PoseResult& result) {
+        state->results[index] = result;
+        if (!status.ok()) {
+            std::unique_lock<std::mutex> lock(state->statusMutex);
+            if (state->status.ok())
+                state->status = status;
+        }
+        if (--state->nbPending > 0)
+            return;
+
+        // Keep the result of the newest processed frames
+        std::vector<PoseResult>& results = state->results;
+        if (lastResultOnly && (results.size() > 1)) {
+            size_t newest = results.size() - 1;
+            for (size_t i = 0; i < results.size(); i++) {
+                if (results[i].timestamp > results[newest].timestamp)
+                    newest = i;
             }
+            results[0] = results[newest];
+            results.resize(1);
         }
-        if (imagesToDisplay.size() > 0)
-            m_sharedBufferImageToDisplay.push(imagesToDisplay);
+        done(state->status, results);
+    };
+
+    // Prepare stage, for each frames (dropped frames are answered at once)
+    std::vector<ScheduledFrames> batch;
+    batch.reserve(nbFrames);
+    for (size_t i = 0; i < nbFrames; i++) {
+        SRef<PendingFrames> frames;
+        auto status = prepareFrames(clientUUID, request[i], *clientContext, frames);
+        if (!status.ok() || (frames == nullptr)) {
+            onAnswered(i, status, PoseResult{});
+            continue;
+        }
+        frames->catchUp = true;
+        batch.push_back(ScheduledFrames{std::move(frames), &nullTransform(), false,
+                                        [onAnswered, i](const grpc::Status& status, const PoseResult& result) {
+                                            onAnswered(i, status, result);
+                                        }});
     }
 
-    clientContext->m_images_vector_mutex.lock();
+    LOG_DEBUG("Batch of {} frames: {} frames to reorder", nbFrames, batch.size());
+
+    if (!batch.empty())
+        scheduleFrames(clientContext, clientUUID, batch.data(), batch.size());
+}
 
-    if ((request->frames_size() == 1) && (clientContext->m_cameraMode != CAMERA_MONO)) {
-        if (clientContext->m_cameraMode == UNKNOWN_CAMERA_MODE) {
-            clientContext->m_cameraMode = CAMERA_MONO;
+bool
+RelocalizationAndMappingGrpcServiceImpl::admitFrames(ProxyClientContext& clientContext)
+{
+    if (clientContext.m_nbInFlight >= m_options.maxInFlightPerClient)
+        return false;
+
+    unsigned int nbInFlight = m_nbInFlight.load();
+    do {
+        if ((m_options.maxInFlight != 0) && (nbInFlight >= m_options.maxInFlight))
+            return false;
+    } while (!m_nbInFlight.compare_exchange_weak(nbInFlight, nbInFlight + 1));
+
+    clientContext.m_nbInFlight++;
+    return true;
+}
+
+void
+RelocalizationAndMappingGrpcServiceImpl::postForward(const SRef<ProxyClientContext>& clientContext,
+                                                     const std::string& clientUUID,
+                                                     SRef<PendingFrames> frames,
+                                                     ResultCallback done)
+{
+    clientContext->m_forwardStrand->post(
+        [this, clientContext, clientUUID, frames = std::move(frames), done = std::move(done)]() {
+            // Visual duplicate of a recent frame: answered with the last result, not sent to the front end
+            if (isDuplicate(*clientContext, *frames)) {
+                count(*clientContext, ServiceStats::DUPLICATES);
+                recordLatency(*clientContext, ServiceStats::DECODE, frames->decodeDuration);
+                done(Status::OK, latestResult(*clientContext));
+                onForwarded(clientContext, clientUUID);
+                return;
+            }
+
+            PoseResult result;
+            auto status = forwardPendingFrames(*clientContext, clientUUID, frames, result);
+            if (frames->decoded != nullptr)
+                recordLatency(*clientContext, ServiceStats::DECODE, frames->decodeDuration);
+
+            // Keep the result for the frames answered at once
+            if (status.ok() && (result.timestamp != 0))
+                setLastResult(*clientContext, result);
+
+            done(status, result);
+            onForwarded(clientContext, clientUUID);
+        });
+}
+
+void
+RelocalizationAndMappingGrpcServiceImpl::onForwarded(const SRef<ProxyClientContext>& clientContext,
+                                                     const std::string& clientUUID)
+{
+    std::unique_lock<std::mutex> lock(clientContext->m_images_vector_mutex);
+
+    clientContext->m_nbInFlight--;
+    m_nbInFlight--;
+
+    if ((clientContext->m_coalescedFrames == nullptr) || !admitFrames(*clientContext))
+        return;
+
+    // Coalesced frames were already answered: their result only updates the last result
+    SRef<PendingFrames> frames = std::move(clientContext->m_coalescedFrames);
+    clientContext->m_coalescedFrames = nullptr;
+    postForward(clientContext, clientUUID, std::move(frames), [](const grpc::Status&, const PoseResult&) {});
+}
+
+PoseResult
+RelocalizationAndMappingGrpcServiceImpl::latestResult(ProxyClientContext& clientContext)
+{
+    PoseResult result = clientContext.m_lastResult.load();
+
+    if (result.poseStatus != RelocalizationPoseStatus::NO_POSE)
+        result.poseStatus = RelocalizationPoseStatus::LATEST_POSE;
+
+    return result;
+}
+
+bool
+RelocalizationAndMappingGrpcServiceImpl::isDuplicate(ProxyClientContext& clientContext, PendingFrames& frames) const
+{
+    // Recorded frames and frames of a batch are all kept
+    if (!clientContext.m_duplicateFilter.enabled() || (frames.recorder != nullptr) || frames.catchUp)
+        return false;
+
+    // The hash is computed with the decoded images (decode errors are reported when forwarded)
+    if (!decodeFrames(frames).ok() || !frames.imageHashed)
+        return false;
+
+    return clientContext.m_duplicateFilter.isDuplicate(frames.timestamp, frames.imageHash);
+}
+
+void
+RelocalizationAndMappingGrpcServiceImpl::setLastResult(ProxyClientContext& clientContext, const PoseResult& result)
+{
+    PoseResult lastResult = clientContext.m_lastResult.load();
+    clientContext.m_lastResult.store(result);
+
+    // Only the changes of the transform are sent (not the new results with the same transform)
+    if ((result.poseStatus == lastResult.poseStatus) && (result.mappingStatus == lastResult.mappingStatus)
+        && std::equal(result.pose, result.pose + 16, lastResult.pose))
+        return;
+
+    std::unique_lock<std::mutex> lock(clientContext.m_subscribersMutex);
+    for (TransformSubscriber* subscriber : clientContext.m_subscribers)
+        subscriber->publish(result);
+}
+
+void
+RelocalizationAndMappingGrpcServiceImpl::count(ProxyClientContext& clientContext, ServiceStats::Counter counter)
+{
+    clientContext.m_stats.counters[counter].fetch_add(1, std::memory_order_relaxed);
+    m_stats.counters[counter].fetch_add(1, std::memory_order_relaxed);
+}
+
+void
+RelocalizationAndMappingGrpcServiceImpl::recordLatency(ProxyClientContext& clientContext,
+                                                       ServiceStats::Stage stage,
+                                                       std::chrono::steady_clock::duration latency)
+{
+    clientContext.m_stats.latencies[stage].record(latency);
+    m_stats.latencies[stage].record(latency);
+}
+
+void
+RelocalizationAndMappingGrpcServiceImpl::recordAnswer(ProxyClientContext& clientContext,
+                                                      std::chrono::steady_clock::time_point receivedTime,
+                                                      const grpc::Status& status)
+{
+    recordLatency(clientContext, ServiceStats::TOTAL, std::chrono::steady_clock::now() - receivedTime);
+    count(clientContext, ServiceStats::REQUESTS);
+    if (!status.ok())
+        count(clientContext, ServiceStats::ERRORS);
+}
+
+void
+RelocalizationAndMappingGrpcServiceImpl::countRejected(const std::string& clientUUID)
+{
+    SRef<ProxyClientContext> clientContext = getClientContext(clientUUID);
+    if (clientContext != nullptr)
+        count(*clientContext, ServiceStats::REJECTED);
+    else
+        m_stats.counters[ServiceStats::REJECTED].fetch_add(1, std::memory_order_relaxed);
+}
+
+void
+RelocalizationAndMappingGrpcServiceImpl::stopClient(const SRef<ProxyClientContext>& clientContext)
+{
+    // Frames held back are not forwarded any more
+    SRef<FrameRecordingWriter> recorder;
+    {
+        std::unique_lock<std::mutex> lock(clientContext->m_images_vector_mutex);
+        recorder = std::move(clientContext->m_recorder);
+        clientContext->m_recorder = nullptr;
+        clientContext->m_ordered_images.clear();
+        clientContext->m_coalescedFrames = nullptr;
+    }
+
+    // The recording is closed by the record task once the frames forwarded before the stop are written:
+    // a marker follows them through the client strand, then through the record buffer
+    if (recorder != nullptr) {
+        std::promise<void> flushed;
+        std::future<void> isFlushed = flushed.get_future();
+        clientContext->m_forwardStrand->post([this, recorder, &flushed]() {
+            auto marker = xpcf::utils::make_shared<PendingFrames>();
+            marker->recorder = recorder;
+            marker->closeRecording = true;
+            m_sharedBufferFramesToRecord.push(marker);
+            flushed.set_value();
+        });
+        // The record task runs while this client is counted as started: the strand can not block
+        isFlushed.wait();
+    }
+
+    // Display and record tasks stop with the last started client, once the waiting frames are written
+    std::unique_lock<std::mutex> lock(m_startedClientsMutex);
+    if (--m_nbStartedClients > 0)
+        return;
+
+    if (m_displayImagesTask != nullptr)
+        m_displayImagesTask->stop();
+
+    if (m_recordFramesTask != nullptr) {
+        m_recordFramesTask->stop();
+        SRef<const PendingFrames> frames;
+        while (m_sharedBufferFramesToRecord.tryPop(frames))
+            writeFrames(*frames);
+    }
+}
+
+grpc::Status
+RelocalizationAndMappingGrpcServiceImpl::forwardPendingFrames(ProxyClientContext& clientContext,
+                                                              const std::string& clientUUID,
+                                                              const SRef<PendingFrames>& frames,
+                                                              PoseResult& result)
+{
+    // Save mode: frames are recorded as received, decoded only to be displayed once sent
+    if (frames->recorder != nullptr) {
+        m_sharedBufferFramesToRecord.push(frames);
+        if ((m_display_images != 2) || (m_displayImagesTask == nullptr)) {
+            result.timestamp = frames->timestamp;
+            return Status::OK;
+        }
+    }
+
+    auto status = decodeFrames(*frames);
+    if (!status.ok())
+        return status;
+
+    auto forwardTime = std::chrono::steady_clock::now();
+    status = forwardFrames(clientUUID, frames->decoded, frames->worldTransform, frames->fixedPose, result);
+    if (m_file_path.empty())
+        recordLatency(clientContext, ServiceStats::FRONT_END, std::chrono::steady_clock::now() - forwardTime);
+
+    return status;
+}
+
+grpc::Status
+RelocalizationAndMappingGrpcServiceImpl::prepareFrames(const std::string& clientUUID,
+                                                       const ReceivedFrames& request,
+                                                       ProxyClientContext& clientContext,
+                                                       SRef<PendingFrames>& frames)
+{
+    clientContext.m_images_vector_mutex.lock();
+
+    if ((request.nbFrames == 1) && (clientContext.m_cameraMode != CAMERA_MONO)) {
+        if (clientContext.m_cameraMode == UNKNOWN_CAMERA_MODE) {
+            clientContext.m_cameraMode = CAMERA_MONO;
             LOG_INFO("Camera mode = MONO");
         }
         else {
             LOG_WARNING("Only 1 image received in stereo mode: drop image");
-            clientContext->m_images_vector_mutex.unlock();
+            clientContext.m_images_vector_mutex.unlock();
             return gRpcError("Only 1 image received in stereo mode: drop image", grpc::StatusCode::OK);
         }
     }
-    else if ((request->frames_size() == 2) && (clientContext->m_cameraMode != CAMERA_STEREO)) {
-        if (clientContext->m_cameraMode == UNKNOWN_CAMERA_MODE) {
-            clientContext->m_cameraMode = CAMERA_STEREO;
+    else if ((request.nbFrames == 2) && (clientContext.m_cameraMode != CAMERA_STEREO)) {
+        if (clientContext.m_cameraMode == UNKNOWN_CAMERA_MODE) {
+            clientContext.m_cameraMode = CAMERA_STEREO;
             LOG_INFO("Camera mode = STEREO");
         }
         else {
             LOG_WARNING("2 images received in mono mode: switch to stereo mode");
-            clientContext->m_cameraMode = CAMERA_STEREO;
+            clientContext.m_cameraMode = CAMERA_STEREO;
+            count(clientContext, ServiceStats::MODE_SWITCHES);
         }
     }
-    else if ((request->frames_size() == 0) || (request->frames_size() > 2)) {
-        LOG_ERROR("Unexpected number of images: {}", request->frames_size());
-        clientContext->m_images_vector_mutex.unlock();
+    else if ((request.nbFrames == 0) || (request.nbFrames > 2)) {
+        LOG_ERROR("Unexpected number of images: {}", request.nbFrames);
+        clientContext.m_images_vector_mutex.unlock();
         return gRpcError("Unexpected number of images", grpc::StatusCode::CANCELLED);
     }
 
-    clientContext->m_images_vector_mutex.unlock();
+    long timestamp = request.frames[0].timestamp;
 
-    auto fps = clientContext->m_relocAndMapFps.update();
+    // Adapt the reorder buffer depth to the arrival of this frame
+    clientContext.m_reorderPolicy.onFrame(timestamp);
 
-    LOG_INFO("[{}]{:03.2f} FPS", request->client_uuid(), fps);
+    // Image too old if older than last processed image
+    bool tooOld = (timestamp < clientContext.m_last_image_timestamp);
+    if (tooOld)
+        count(clientContext, ServiceStats::LATE_DROPPED);
 
-    long timestamp = request->frames(0).timestamp();
+    ReorderStats reorderStats = clientContext.m_reorderPolicy.stats();
 
-    // Drop image if too old (older than last processed image)
-    if (timestamp < clientContext->m_last_image_timestamp) {
-        LOG_INFO("Image too old: drop it!");
-        return gRpcError("Image too old: drop it!", grpc::StatusCode::OK);
-    }
+    SRef<FrameRecordingWriter> recorder = clientContext.m_recorder;
 
-    // Get data from request
-    SRef<SolARImage> image1 = nullptr, image2 = nullptr;
+    auto fps = clientContext.m_relocAndMapFps.update();
 
-    if (clientContext->m_cameraMode == CAMERA_MONO) {
-        LOG_DEBUG("Get image 1 from request");
-        auto status  = buildSolARImage(request->frames(0), toSolAR(request->frames(0).pose()), image1);
-        if (!status.ok())
-        {
-            LOG_ERROR("Error while converting received image 1 to SolAR datastructure");
-            return gRpcError("Error while converting received image 1 to SolAR datastructure", status.error_code());
-        }
+    clientContext.m_images_vector_mutex.unlock();
+
+    // Latencies, counters and reorder buffer state are given by GetStats
+    const ServiceStats& stats = clientContext.m_stats;
+    LOG_DEBUG("[{}]{:03.2f} FPS, reorder depth: {}, out of order: {:.1f}%, jitter: {:.1f} ms, dropped: {} late, {} on shrink, "
+              "overload: {} latest pose replies, {} dropped, motion gated: {}, duplicates: {}",
+              clientUUID, fps, reorderStats.depth, reorderStats.outOfOrderRate * 100.f, reorderStats.jitterMs,
+              stats.counters[ServiceStats::LATE_DROPPED].load(), stats.counters[ServiceStats::SHRINK_DROPPED].load(),
+              stats.counters[ServiceStats::LATEST_POSE_REPLIES].load(), stats.counters[ServiceStats::OVERLOAD_DROPPED].load(),
+              stats.counters[ServiceStats::MOTION_GATED].load(), stats.counters[ServiceStats::DUPLICATES].load());
+
+    if (tooOld) {
+        LOG_INFO("Image too old: drop it!");
+        return gRpcError("Image too old: drop it!", grpc::StatusCode::OK);
     }
-    else if (clientContext->m_cameraMode == CAMERA_STEREO) {
-        LOG_DEBUG("Get images from request");
 
-        for (uint8_t i = 0; i < 2; i++) {
-            if (request->frames(i).sensor_id() == 0) {
-                // Left image
-                auto status  = buildSolARImage(request->frames(i), toSolAR(request->frames(i).pose()), image1);
-                if (!status.ok())
-                {
-                    LOG_ERROR("Error while converting received image 1 to SolAR datastructure");
-                    return gRpcError("Error while converting received image 1 to SolAR datastructure", status.error_code());
-                }
-            }
-            else if (request->frames(i).sensor_id() == 1) {
-                // Right image
-                auto status  = buildSolARImage(request->frames(i), toSolAR(request->frames(i).pose()), image2);
-                if (!status.ok())
-                {
-                    LOG_ERROR("Error while converting received image 2 to SolAR datastructure");
-                    return gRpcError("Error while converting received image 2 to SolAR datastructure", status.error_code());
-                }
-                // Rotate image from camera right front 180 degrees
-                image2->rotate180();
+    // Get data from request: uncompressed images are built now, compressed images
+    // are kept encoded until the frames leave the reorder buffer (recorded images
+    // are all kept as received)
+    size_t nbImages = (clientContext.m_cameraMode == CAMERA_STEREO) ? 2 : 1;
+    frames = xpcf::utils::make_shared<PendingFrames>();
+    frames->timestamp = timestamp;
+    frames->grey = clientContext.m_forwardGrey;
+    frames->downscaleFactor = clientContext.m_downscaleFactor;
+    frames->recorder = std::move(recorder);
+    for (size_t index = 0; index < nbImages; index++)
+        frames->rotate180[index] = clientContext.m_rotate180[index];
+    frames->images.resize(nbImages);
+    frames->encodedImages.resize(nbImages);
+    std::array<bool, 2> received = {false, false};
+
+    for (int i = 0; i < request.nbFrames; i++) {
+        const ReceivedFrame& frame = request.frames[i];
+        // Mono: first frame, stereo: left (sensor 0) then right (sensor 1) image
+        size_t index = (nbImages == 1) ? i : frame.sensorId;
+        if ((index >= nbImages) || (frame.image == nullptr))
+            continue;
+
+        if ((frame.image->imagecompression() == ImageCompression::NONE) && (frames->recorder == nullptr)) {
+            LOG_DEBUG("Get image {} from request", index + 1);
+            SRef<SolARImage> image;
+            auto status  = buildSolARImage(*frame.image, image, frames->grey, frames->rotate180[index]);
+            if (status.ok())
+                status = downscaleImage(image, frames->downscaleFactor);
+            if (!status.ok())
+            {
+                LOG_ERROR("Error while converting received image {} to SolAR datastructure", index + 1);
+                return gRpcError("Error while converting received image " + std::to_string(index + 1)
+                                 + " to SolAR datastructure", status.error_code());
             }
+            frames->images[index] = image;
+        }
+        else {
+            // Not copied: the request is kept alive until the image is decoded (or recorded)
+            if (request.owner != nullptr)
+                frames->encodedImages[index].image = std::shared_ptr<const Image>(request.owner, frame.image);
+            else
+                frames->encodedImages[index].image = std::make_shared<const Image>(*frame.image);
+            frames->encodedImages[index].pose = frame.pose;
         }
+        received[index] = true;
+    }
 
-        if ((image1 == nullptr) || (image2 == nullptr)) {
+    for (size_t index = 0; index < nbImages; index++) {
+        if (!received[index]) {
             LOG_ERROR("Error: can not found left and/or right image for stereo processing");
             return gRpcError("Error: can not found left and/or right image for stereo processing", grpc::StatusCode::CANCELLED);
         }
     }
 
-    SolAR::datastructure::Transform3Df pose1, pose2;
-    pose1 = toSolAR(request->frames(0).pose());
-    if (clientContext->m_cameraMode == CAMERA_STEREO)
-        pose2 = toSolAR(request->frames(1).pose());
-
-    SolAR::api::pipeline::TransformStatus transform3DStatus;
-    SolAR::datastructure::Transform3Df transform3D;
-    float_t confidence;
-    SolAR::api::pipeline::MappingStatus mappingStatus;
-
-    // Add data to vector of tuple (timestamp, image(s), pose(s))
-    std::vector<SRef<SolAR::datastructure::Image>> images;
-    std::vector<SolAR::datastructure::Transform3Df> poses;
+    frames->devicePose = request.frames[0].pose;
+    frames->poses.push_back(request.frames[0].pose);
+    if (nbImages == 2)
+        frames->poses.push_back(request.frames[1].pose);
 
-    images.push_back(image1);
-    poses.push_back(pose1);
-
-    if (clientContext->m_cameraMode == CAMERA_STEREO) {
-        images.push_back(image2);
-        poses.push_back(pose2);
+    // Display received images if specified (decoded now, not decoded again when forwarded)
+    if ((m_display_images == 1) && (m_displayImagesTask != nullptr)) {
+        if (decodeFrames(*frames).ok())
+            m_sharedBufferImageToDisplay.push(frames->decoded);
     }
 
-    clientContext->m_images_vector_mutex.lock();
-
-    clientContext->m_ordered_images.push_back(std::make_tuple(images, poses, timestamp));
+    return Status::OK;
+}
 
-    // If enough tuples, send the older one to Front End
-    if (clientContext->m_ordered_images.size() >= 5) {
+grpc::Status
+RelocalizationAndMappingGrpcServiceImpl::decodeFrames(PendingFrames& frames) const
+{
+    std::call_once(frames.decodeFlag, [this, &frames]() {
+        auto decodeTime = std::chrono::steady_clock::now();
+        std::vector<SRef<SolARImage>> images = std::move(frames.images);
+
+        for (size_t index = 0; index < images.size(); index++) {
+            ImageCompression receivedCompression = ImageCompression::NONE;
+
+            if (images[index] == nullptr) {
+                LOG_DEBUG("Decode image {}", index + 1);
+                const Image& encodedImage = *frames.encodedImages[index].image;
+                auto status  = buildSolARImage(encodedImage, images[index], frames.grey, frames.rotate180[index]);
+                if (status.ok())
+                    status = downscaleImage(images[index], frames.downscaleFactor);
+                if (!status.ok())
+                {
+                    LOG_ERROR("Error while converting received image {} to SolAR datastructure", index + 1);
+                    frames.decodeStatus = gRpcError("Error while converting received image " + std::to_string(index + 1)
+                                                    + " to SolAR datastructure", status.error_code());
+                    return;
+                }
 
-        // Sort vector based on timestamps
-        std::sort(clientContext->m_ordered_images.begin(), clientContext->m_ordered_images.end(), sortbythird);
+                receivedCompression = encodedImage.imagecompression();
+            }
 
-        std::vector<SRef<SolARImage>> imagesToSend = std::get<0>(clientContext->m_ordered_images[0]);
-        std::vector<SolAR::datastructure::Transform3Df> posesToSend = std::get<1>(clientContext->m_ordered_images[0]);
-        clientContext->m_last_image_timestamp = std::get<2>(clientContext->m_ordered_images[0]);
+            setForwardEncoding(*images[index], receivedCompression);
+        }
 
-        // Remove the older tuple from vector
-        clientContext->m_ordered_images.erase(clientContext->m_ordered_images.begin());
+        // Duplicate detection: hash of the first image (left image in stereo), as sent to the front end
+        if ((m_options.duplicateDistance > 0) && (images[0]->getDataType() == SolARImage::DataType::TYPE_8U)) {
+            frames.imageHash = imageconversion::differenceHash8(static_cast<const uint8_t*>(images[0]->data()),
+                                                                images[0]->getWidth(), images[0]->getHeight(),
+                                                                images[0]->getNbChannels());
+            frames.imageHashed = true;
+        }
 
-        clientContext->m_images_vector_mutex.unlock();
+        // Compressed data (and their request) are no longer needed (unless recorded)
+        if (frames.recorder == nullptr)
+            std::vector<PendingFrames::EncodedImage>().swap(frames.encodedImages);
 
-        if (m_file_path == "") {
+        frames.decoded = xpcf::utils::make_shared<const DecodedFrames>(std::move(images), std::move(frames.poses),
+                                                                       frames.timestamp);
+        frames.decodeDuration = std::chrono::steady_clock::now() - decodeTime;
+    });
 
-            LOG_DEBUG("Do mapping and relocalization");
+    return frames.decodeStatus;
+}
 
-            try {
-                m_pipeline->relocalizeProcessRequest(
-                            request->client_uuid(),
-                            imagesToSend,
-                            posesToSend,
-                            fixedPose,
-                            toSolAR(worldTransform),
-                            std::chrono::time_point<std::chrono::system_clock>(
-                                std::chrono::milliseconds(clientContext->m_last_image_timestamp)),
-                            transform3DStatus,
-                            transform3D,
-                            confidence,
-                            mappingStatus);
-            }
-            catch (const std::exception& e)
-            {
-                response->set_mapping_status(MappingStatus::TRACKING_LOST);
+unsigned int
+RelocalizationAndMappingGrpcServiceImpl::downscaleFactor(uint32_t width) const
+{
+    // Integer factor: the images sent are never narrower than the target width
+    if ((m_options.targetWidth == 0) || (width < 2 * m_options.targetWidth))
+        return 1;
+    return width / m_options.targetWidth;
+}
 
-                return gRpcError("Error: exception thrown by relocation and mapping pipeline: "
-                                 + std::string(e.what()));
-            }
+void
+RelocalizationAndMappingGrpcServiceImpl::setForwardEncoding(SolAR::datastructure::Image& image,
+                                                            ImageCompression receivedCompression) const
+{
+    // Images are serialized with this encoding by the front end client (second gRPC hop): they are
+    // encoded again from their decoded pixels, less bandwidth for more proxy CPU time
+    switch (m_options.forwardEncoding)
+    {
+        case ForwardEncoding::NONE:
+            image.setImageEncoding(SolARImage::ENCODING_NONE);
+            break;
+        case ForwardEncoding::SAME:
+            if (receivedCompression == ImageCompression::JPG)
+                image.setImageEncoding(SolARImage::ENCODING_JPEG);
+            else if (receivedCompression == ImageCompression::PNG)
+                image.setImageEncoding(SolARImage::ENCODING_PNG);
+            else
+                image.setImageEncoding(SolARImage::ENCODING_NONE);
+            break;
+        case ForwardEncoding::JPEG:
+            image.setImageEncoding(SolARImage::ENCODING_JPEG);
+            break;
+        case ForwardEncoding::PNG:
+            image.setImageEncoding(SolARImage::ENCODING_PNG);
+            break;
+    }
 
-            // Display images if specified
-            if ((m_display_images == 2) && (m_displayImagesTask != nullptr)) {
-                m_sharedBufferImageToDisplay.push(imagesToSend);
-            }
+    if (image.getImageEncoding() == SolARImage::ENCODING_JPEG)
+        image.setImageEncodingQuality(static_cast<uint8_t>(m_options.forwardJpegQuality));
+}
 
-            RelocalizationPoseStatus gRpcPoseStatus;
-            auto status = toGrpc(transform3DStatus, gRpcPoseStatus);
-            if (!status.ok())
-            {
-                LOG_ERROR("RelocalizeAndMap(): error while converting received image to SolAR datastructure");
-                return gRpcError("RelocalizeAndMap(): error while converting received image to SolAR datastructure", status.error_code());
-            }
+grpc::Status
+RelocalizationAndMappingGrpcServiceImpl::forwardFrames(const std::string& clientUUID,
+                                                       const SRef<const DecodedFrames>& frames,
+                                                       const SolAR::datastructure::Transform3Df& worldTransform,
+                                                       bool fixedPose,
+                                                       PoseResult& result)
+{
+    if (m_file_path == "") {
+
+        LOG_DEBUG("Do mapping and relocalization");
+
+        SolAR::api::pipeline::TransformStatus transform3DStatus;
+        SolAR::datastructure::Transform3Df transform3D;
+        float_t confidence;
+        SolAR::api::pipeline::MappingStatus mappingStatus;
+
+        try {
+            m_pipeline->relocalizeProcessRequest(
+                        clientUUID,
+                        frames->images,
+                        frames->poses,
+                        fixedPose,
+                        worldTransform,
+                        std::chrono::time_point<std::chrono::system_clock>(
+                            std::chrono::milliseconds(frames->timestamp)),
+                        transform3DStatus,
+                        transform3D,
+                        confidence,
+                        mappingStatus);
+        }
+        catch (const std::exception& e)
+        {
+            result.mappingStatus = MappingStatus::TRACKING_LOST;
 
-            MappingStatus gRpcMappingStatus;
-            status = toGrpc(mappingStatus, gRpcMappingStatus);
-            if (!status.ok())
-            {
-                LOG_ERROR("RelocalizeAndMap(): error while converting received image to SoLAR datastructure");
-                return gRpcError("RelocalizeAndMap(): error while converting received image to SolAR datastructure", status.error_code());
-            }
+            return gRpcError("Error: exception thrown by relocation and mapping pipeline: "
+                             + std::string(e.what()));
+        }
 
-            response->set_confidence(confidence);
-            response->set_mapping_status(gRpcMappingStatus);
-            if (gRpcMappingStatus == MappingStatus::BOOTSTRAP)
-                response->set_pose_status(RelocalizationPoseStatus::NO_POSE);
-            else
-                response->set_pose_status(gRpcPoseStatus);
-            toGrpc(transform3D, *response->mutable_pose());
+        // Display images if specified
+        if ((m_display_images == 2) && (m_displayImagesTask != nullptr)) {
+            m_sharedBufferImageToDisplay.push(frames);
+        }
 
-            LOG_DEBUG("Output");
-            LOG_DEBUG("  confidence: {}", confidence);
-            LOG_DEBUG("  transform status: {}", to_string(transform3DStatus));
-            LOG_DEBUG("  transform:\n{}", transform3D.matrix());
-            LOG_DEBUG("  mapping status:\n{}", to_string(mappingStatus));
+        RelocalizationPoseStatus gRpcPoseStatus;
+        auto status = toGrpc(transform3DStatus, gRpcPoseStatus);
+        if (!status.ok())
+        {
+            LOG_ERROR("RelocalizeAndMap(): error while converting received image to SolAR datastructure");
+            return gRpcError("RelocalizeAndMap(): error while converting received image to SolAR datastructure", status.error_code());
+        }
 
-            return Status::OK;
+        MappingStatus gRpcMappingStatus;
+        status = toGrpc(mappingStatus, gRpcMappingStatus);
+        if (!status.ok())
+        {
+            LOG_ERROR("RelocalizeAndMap(): error while converting received image to SoLAR datastructure");
+            return gRpcError("RelocalizeAndMap(): error while converting received image to SolAR datastructure", status.error_code());
         }
-        else {
 
-            LOG_DEBUG("Save images, poses and timestamps on file");
+        result.timestamp = frames->timestamp;
+        result.confidence = confidence;
+        result.mappingStatus = gRpcMappingStatus;
+        if (gRpcMappingStatus == MappingStatus::BOOTSTRAP)
+            result.poseStatus = RelocalizationPoseStatus::NO_POSE;
+        else
+            result.poseStatus = gRpcPoseStatus;
+        // Same layout as the Eigen matrix of the transform (column major)
+        std::copy(transform3D.data(), transform3D.data() + 16, result.pose);
+
+        LOG_DEBUG("Output");
+        LOG_DEBUG("  confidence: {}", confidence);
+        LOG_DEBUG("  transform status: {}", to_string(transform3DStatus));
+        LOG_DEBUG("  transform:\n{}", transform3D.matrix());
+        LOG_DEBUG("  mapping status:\n{}", to_string(mappingStatus));
 
-            if (m_saveImagesTask != nullptr) {
-                m_sharedBufferImagePoseToSave.push(std::make_tuple(imagesToSend, posesToSend,
-                                                                   clientContext->m_last_image_timestamp));
-            }
+        return Status::OK;
+    }
+    else {
 
-            // Display images if specified
-            if (m_displayImagesTask != nullptr) {
-                m_sharedBufferImageToDisplay.push(imagesToSend);
-            }
+        LOG_DEBUG("Frames recorded: not sent to the front end");
 
-            return Status::OK;
+        // Display images if specified (received images already displayed in mode 1)
+        if ((m_display_images == 2) && (m_displayImagesTask != nullptr)) {
+            m_sharedBufferImageToDisplay.push(frames);
         }
-    }
-    else {
-        LOG_INFO("Not enough images to process");
 
-        clientContext->m_images_vector_mutex.unlock();
+        result.timestamp = frames->timestamp;
 
         return Status::OK;
     }
@@ -777,11 +1528,55 @@ RelocalizationAndMappingGrpcServiceImpl::Get3DTransform(grpc::ServerContext* con
                                                         const ClientUUID* request,
                                                         RelocalizationResult* response)
 {
-    LOG_INFO("Get3DTransform");
+    LOG_DEBUG("Get3DTransform");
+
+    // Get context for current client
+    SRef<ProxyClientContext> clientContext = getClientContext(request->client_uuid());
+    if (clientContext == nullptr) {
+        LOG_ERROR("Unknown client with UUID: {}", request->client_uuid());
+        return gRpcError("Unknown client UUID");
+    }
+
+    // Last result of the front end, without waiting for the frames being processed
+    toGrpc(latestResult(*clientContext), *response);
 
-    return Status(grpc::StatusCode::UNIMPLEMENTED,
-                  "Get3DTransform() is not yet implemented: \
-                    request relocalization to get the latest pose");
+    return Status::OK;
+}
+
+grpc::Status
+RelocalizationAndMappingGrpcServiceImpl::GetStats(grpc::ServerContext* context,
+                                                  const ClientUUID* request,
+                                                  ProxyStatsResult* response)
+{
+    LOG_DEBUG("GetStats");
+
+    toGrpc(m_stats, *response->mutable_proxy());
+
+    // Stats of the proxy only
+    if (request->client_uuid().empty())
+        return Status::OK;
+
+    // Get context for current client
+    SRef<ProxyClientContext> clientContext = getClientContext(request->client_uuid());
+    if (clientContext == nullptr) {
+        LOG_ERROR("Unknown client with UUID: {}", request->client_uuid());
+        return gRpcError("Unknown client UUID");
+    }
+
+    ProxyStats* clientStats = response->mutable_client();
+    toGrpc(clientContext->m_stats, *clientStats);
+
+    // Adaptive reorder buffer of the client
+    ReorderStats reorderStats;
+    {
+        std::unique_lock<std::mutex> lock(clientContext->m_images_vector_mutex);
+        reorderStats = clientContext->m_reorderPolicy.stats();
+    }
+    clientStats->set_reorder_depth(reorderStats.depth);
+    clientStats->set_jitter_ms(reorderStats.jitterMs);
+    clientStats->set_out_of_order_rate(reorderStats.outOfOrderRate);
+
+    return Status::OK;
 }
 
 grpc::Status
@@ -813,18 +1608,18 @@ RelocalizationAndMappingGrpcServiceImpl::SendMessage(grpc::ServerContext* contex
 
 // Private
 
-SRef<ProxyClientContext> RelocalizationAndMappingGrpcServiceImpl::getClientContext(const string & clientUUID) const
+void RelocalizationAndMappingGrpcServiceImpl::setMessageAllocators()
 {
-    SRef<ProxyClientContext> clientContext = nullptr;
-
-    unique_lock<mutex> lock(m_mutexClientMap);
+    SetMessageAllocatorFor_RelocalizeAndMap(&m_framesAllocator);
+    SetMessageAllocatorFor_RelocalizeAndMapGroundTruth(&m_groundTruthFramesAllocator);
+    SetMessageAllocatorFor_RelocalizeAndMapBatch(&m_framesBatchAllocator);
+}
 
-    auto it = m_clientsMap.find(clientUUID);
+SRef<ProxyClientContext> RelocalizationAndMappingGrpcServiceImpl::getClientContext(const string & clientUUID) const
+{
+    SRef<ProxyClientContext> clientContext = m_clients.find(clientUUID);
 
-    if (it != m_clientsMap.end()) {
-        clientContext = it->second;
-    }
-    else {
+    if (clientContext == nullptr) {
         LOG_DEBUG("No context found for client: {}", clientUUID);
     }
 
@@ -1002,15 +1797,99 @@ RelocalizationAndMappingGrpcServiceImpl::toGrpc(const SolAR::datastructure::Tran
     gRpcPose.set_m44(solARPose(3,3));
 }
 
+const SolAR::datastructure::Transform3Df&
+RelocalizationAndMappingGrpcServiceImpl::nullTransform()
+{
+    static const SolAR::datastructure::Transform3Df transform(Eigen::Matrix4f::Zero());
+    return transform;
+}
+
 grpc::Status
-RelocalizationAndMappingGrpcServiceImpl::buildSolARImage(const Frame frame,
-                                                         const SolAR::datastructure::Transform3Df& solARPose,
-                                                         SRef<SolAR::datastructure::Image>& image)
+RelocalizationAndMappingGrpcServiceImpl::toReceivedFrames(const Frames& request, ReceivedFrames& frames)
+{
+    frames.nbFrames = request.frames_size();
+    for (int i = 0; (i < request.frames_size()) && (i < static_cast<int>(frames.frames.size())); i++) {
+        const Frame& frame = request.frames(i);
+        ReceivedFrame& receivedFrame = frames.frames[i];
+        receivedFrame.sensorId = frame.sensor_id();
+        receivedFrame.timestamp = frame.timestamp();
+        receivedFrame.image = frame.has_image() ? &frame.image() : nullptr;
+        receivedFrame.pose = toSolAR(frame.pose());
+    }
+
+    return Status::OK;
+}
+
+void
+RelocalizationAndMappingGrpcServiceImpl::toGrpc(const PoseResult& result, RelocalizationResult& response)
+{
+    response.set_timestamp(result.timestamp);
+    response.set_confidence(result.confidence);
+    response.set_pose_status(static_cast<RelocalizationPoseStatus>(result.poseStatus));
+    response.set_mapping_status(static_cast<MappingStatus>(result.mappingStatus));
+
+    // Default pose (no result yet): all fields null, as in a cleared result
+    if (result.timestamp == 0) {
+        response.clear_pose();
+        return;
+    }
+
+    toGrpc(SolAR::datastructure::Transform3Df(Eigen::Map<const Eigen::Matrix4f>(result.pose)), *response.mutable_pose());
+}
+
+RecordingCamera
+RelocalizationAndMappingGrpcServiceImpl::toRecording(uint32_t sensorId, CameraType type, uint32_t width, uint32_t height,
+                                                     const Matrix3x3& intrinsics, const CameraDistortion& distortion,
+                                                     ImageRotation rotation)
+{
+    RecordingCamera camera = {};
+    camera.sensorId = sensorId;
+    camera.cameraType = static_cast<uint32_t>(type);
+    camera.width = width;
+    camera.height = height;
+    const float intrinsicValues[9] = { intrinsics.m11(), intrinsics.m12(), intrinsics.m13(),
+                                       intrinsics.m21(), intrinsics.m22(), intrinsics.m23(),
+                                       intrinsics.m31(), intrinsics.m32(), intrinsics.m33() };
+    std::copy(intrinsicValues, intrinsicValues + 9, camera.intrinsics);
+    const float distortionValues[5] = { distortion.k_1(), distortion.k_2(), distortion.p_1(),
+                                        distortion.p_2(), distortion.k_3() };
+    std::copy(distortionValues, distortionValues + 5, camera.distortion);
+    camera.rotation = static_cast<uint32_t>(rotation);
+    return camera;
+}
+
+RecordingImage
+RelocalizationAndMappingGrpcServiceImpl::toRecording(uint32_t sensorId, const Image& gRpcImage,
+                                                     const SolAR::datastructure::Transform3Df& pose)
+{
+    // Image data are not copied: valid while the image is
+    RecordingImage image = {};
+    image.header.sensorId = sensorId;
+    image.header.width = gRpcImage.width();
+    image.header.height = gRpcImage.height();
+    image.header.layout = static_cast<uint8_t>(gRpcImage.layout());
+    image.header.compression = static_cast<uint8_t>(gRpcImage.imagecompression());
+    for (int row = 0; row < 4; row++) {
+        for (int col = 0; col < 4; col++)
+            image.header.pose[4 * row + col] = pose(row, col);
+    }
+    image.header.dataSize = gRpcImage.data().size();
+    image.data = gRpcImage.data().data();
+    return image;
+}
+
+grpc::Status
+RelocalizationAndMappingGrpcServiceImpl::buildSolARImage(const Image& gRpcImage,
+                                                         SRef<SolAR::datastructure::Image>& image,
+                                                         bool grey,
+                                                         bool rotate180)
 {
     SolAR::datastructure::Image::ImageEncoding encoding;
+    // Set when the rotation is done by the conversion kernel
+    bool rotated = false;
 
     // Decode image before use if needed
-    switch (frame.image().imagecompression())
+    switch (gRpcImage.imagecompression())
     {
         case ImageCompression::NONE:
         {
@@ -1033,7 +1912,7 @@ RelocalizationAndMappingGrpcServiceImpl::buildSolARImage(const Frame frame,
         }
     }
 
-    switch(frame.image().layout())
+    switch(gRpcImage.layout())
     {
         case ImageLayout::RGB_24:
         {
@@ -1041,65 +1920,116 @@ RelocalizationAndMappingGrpcServiceImpl::buildSolARImage(const Frame frame,
 
             if (encoding == SolAR::datastructure::Image::ENCODING_NONE)
             {
-                // Convert to CV_8UC3 because otherwise convertToSolar() will fail
-                const char* image_buffer = frame.image().data().c_str();
-                std::vector<char> bgr_buffer;
-                for (long j = 0; j < frame.image().data().size(); j += 4)
-                {
-                  bgr_buffer.push_back(image_buffer[j]);
-                  bgr_buffer.push_back(image_buffer[j + 1]);
-                  bgr_buffer.push_back(image_buffer[j + 2]);
+                size_t nbPixels = static_cast<size_t>(gRpcImage.width()) * gRpcImage.height();
+                if (gRpcImage.data().size() < 4 * nbPixels) {
+                    return gRpcError("Error: RGB_24 image buffer is smaller than 4 bytes per pixel");
                 }
 
+                const uint8_t* src = reinterpret_cast<const uint8_t*>(gRpcImage.data().data());
+
+                if (grey) {
+                    // Unpack and conversion to luminance in one pass
+                    image = org::bcom::xpcf::utils::make_shared<SolARImage>(
+                                gRpcImage.width(),
+                                gRpcImage.height(),
+                                SolARImage::ImageLayout::LAYOUT_GREY,
+                                SolARImage::PixelOrder::INTERLEAVED,
+                                SolARImage::DataType::TYPE_8U);
+
+                    (rotate180 ? imageconversion::convertBGRA32ToGrey8Rotate180 : imageconversion::convertBGRA32ToGrey8)(
+                                src, static_cast<uint8_t*>(image->data()), nbPixels);
+                    rotated = rotate180;
+                    break;
+                }
+
+                // Convert to CV_8UC3 because otherwise convertToSolar() will fail
+                // (repack directly into the buffer allocated by the SolAR image)
                 image = org::bcom::xpcf::utils::make_shared<SolARImage>(
-                            &bgr_buffer[0],
-                            frame.image().width(),
-                            frame.image().height(),
+                            gRpcImage.width(),
+                            gRpcImage.height(),
                             SolARImage::ImageLayout::LAYOUT_BGR,
                             SolARImage::PixelOrder::INTERLEAVED,
                             SolARImage::DataType::TYPE_8U);
+
+                (rotate180 ? imageconversion::packBGRA32ToBGR24Rotate180 : imageconversion::packBGRA32ToBGR24)(
+                            src, static_cast<uint8_t*>(image->data()), nbPixels);
+                rotated = rotate180;
             }
             else if (encoding == SolAR::datastructure::Image::ENCODING_PNG) {
 
                 // Use temporary image to decode data buffer
                 SRef<SolAR::datastructure::Image> temp_image =
                         org::bcom::xpcf::utils::make_shared<SolARImage>(
-                            (char*)frame.image().data().c_str(),
-                            frame.image().width(),
-                            frame.image().height(),
+                            (char*)gRpcImage.data().c_str(),
+                            gRpcImage.width(),
+                            gRpcImage.height(),
                             SolARImage::ImageLayout::LAYOUT_BGR,
                             SolARImage::PixelOrder::INTERLEAVED,
                             SolARImage::DataType::TYPE_8U,
                             encoding);
 
-                // Convert to CV_8UC3 because otherwise convertToSolar() will fail
-                char* image_buffer = (char*)temp_image->data();
-                std::vector<char> bgr_buffer;
-                for (long j = 0; j < temp_image->getBufferSize(); j += 4)
-                {
-                  bgr_buffer.push_back(image_buffer[j]);
-                  bgr_buffer.push_back(image_buffer[j + 1]);
-                  bgr_buffer.push_back(image_buffer[j + 2]);
+                size_t nbPixels = static_cast<size_t>(temp_image->getWidth()) * temp_image->getHeight();
+                if (temp_image->getBufferSize() < 4 * nbPixels) {
+                    return gRpcError("Error: decoded PNG image buffer is smaller than 4 bytes per pixel");
+                }
+
+                const uint8_t* src = static_cast<const uint8_t*>(temp_image->data());
+
+                if (grey) {
+                    image = org::bcom::xpcf::utils::make_shared<SolARImage>(
+                                temp_image->getWidth(),
+                                temp_image->getHeight(),
+                                SolARImage::ImageLayout::LAYOUT_GREY,
+                                SolARImage::PixelOrder::INTERLEAVED,
+                                SolARImage::DataType::TYPE_8U);
+
+                    (rotate180 ? imageconversion::convertBGRA32ToGrey8Rotate180 : imageconversion::convertBGRA32ToGrey8)(
+                                src, static_cast<uint8_t*>(image->data()), nbPixels);
+                    rotated = rotate180;
+                    break;
                 }
 
+                // Convert to CV_8UC3 because otherwise convertToSolar() will fail
+                // (repack directly into the buffer allocated by the SolAR image)
                 image = org::bcom::xpcf::utils::make_shared<SolARImage>(
-                            &bgr_buffer[0],
                             temp_image->getWidth(),
                             temp_image->getHeight(),
                             SolARImage::ImageLayout::LAYOUT_BGR,
                             SolARImage::PixelOrder::INTERLEAVED,
                             SolARImage::DataType::TYPE_8U);
+
+                (rotate180 ? imageconversion::packBGRA32ToBGR24Rotate180 : imageconversion::packBGRA32ToBGR24)(
+                            src, static_cast<uint8_t*>(image->data()), nbPixels);
+                rotated = rotate180;
             }
             else if (encoding == SolAR::datastructure::Image::ENCODING_JPEG) {
 
                 image = org::bcom::xpcf::utils::make_shared<SolARImage>(
-                            (char*)frame.image().data().c_str(),
-                            frame.image().width(),
-                            frame.image().height(),
+                            (char*)gRpcImage.data().c_str(),
+                            gRpcImage.width(),
+                            gRpcImage.height(),
                             SolARImage::ImageLayout::LAYOUT_BGR,
                             SolARImage::PixelOrder::INTERLEAVED,
                             SolARImage::DataType::TYPE_8U,
                             encoding);
+
+                if (grey) {
+                    size_t nbPixels = static_cast<size_t>(image->getWidth()) * image->getHeight();
+                    if (image->getBufferSize() < 3 * nbPixels) {
+                        return gRpcError("Error: decoded JPEG image buffer is smaller than 3 bytes per pixel");
+                    }
+
+                    SRef<SolAR::datastructure::Image> colorImage = image;
+                    image = org::bcom::xpcf::utils::make_shared<SolARImage>(
+                                colorImage->getWidth(),
+                                colorImage->getHeight(),
+                                SolARImage::ImageLayout::LAYOUT_GREY,
+                                SolARImage::PixelOrder::INTERLEAVED,
+                                SolARImage::DataType::TYPE_8U);
+
+                    imageconversion::convertBGR24ToGrey8(static_cast<const uint8_t*>(colorImage->data()),
+                                                         static_cast<uint8_t*>(image->data()), nbPixels);
+                }
             }
             else {
                 return gRpcError("Unkown encoding format");
@@ -1111,10 +2041,32 @@ RelocalizationAndMappingGrpcServiceImpl::buildSolARImage(const Frame frame,
         {
             LOG_DEBUG("Create Image: GREY_8");
 
+            if ((encoding == SolAR::datastructure::Image::ENCODING_NONE)
+                    && (gRpcImage.data().size() < static_cast<size_t>(gRpcImage.width()) * gRpcImage.height())) {
+                return gRpcError("Error: GREY_8 image buffer is smaller than 1 byte per pixel");
+            }
+
+            // The SolAR image owns its buffer: raw data are copied once from the request
+            // (in reverse order when rotated)
+            if ((encoding == SolAR::datastructure::Image::ENCODING_NONE) && rotate180) {
+                image = org::bcom::xpcf::utils::make_shared<SolARImage>(
+                            gRpcImage.width(),
+                            gRpcImage.height(),
+                            SolARImage::ImageLayout::LAYOUT_GREY,
+                            SolARImage::PixelOrder::INTERLEAVED,
+                            SolARImage::DataType::TYPE_8U);
+
+                imageconversion::copyGrey8Rotate180(reinterpret_cast<const uint8_t*>(gRpcImage.data().data()),
+                                                    static_cast<uint8_t*>(image->data()),
+                                                    static_cast<size_t>(gRpcImage.width()) * gRpcImage.height());
+                rotated = true;
+                break;
+            }
+
             image = org::bcom::xpcf::utils::make_shared<SolARImage>(
-                        (char*)frame.image().data().c_str(),
-                        frame.image().width(),
-                        frame.image().height(),
+                        (char*)gRpcImage.data().c_str(),
+                        gRpcImage.width(),
+                        gRpcImage.height(),
                         SolARImage::ImageLayout::LAYOUT_GREY,
                         SolARImage::PixelOrder::INTERLEAVED,
                         SolARImage::DataType::TYPE_8U,
@@ -1126,10 +2078,17 @@ RelocalizationAndMappingGrpcServiceImpl::buildSolARImage(const Frame frame,
         {
             LOG_DEBUG("Create Image: GREY_16");
 
+            if ((encoding == SolAR::datastructure::Image::ENCODING_NONE)
+                    && (gRpcImage.data().size() < 2 * static_cast<size_t>(gRpcImage.width()) * gRpcImage.height())) {
+                return gRpcError("Error: GREY_16 image buffer is smaller than 2 bytes per pixel");
+            }
+
+            // The SolAR image owns its buffer: raw data are copied once from the request
+
             image = org::bcom::xpcf::utils::make_shared<SolARImage>(
-                        (char*)frame.image().data().c_str(),
-                        frame.image().width(),
-                        frame.image().height(),
+                        (char*)gRpcImage.data().c_str(),
+                        gRpcImage.width(),
+                        gRpcImage.height(),
                         SolARImage::ImageLayout::LAYOUT_GREY,
                         SolARImage::PixelOrder::INTERLEAVED,
                         SolARImage::DataType::TYPE_16U,
@@ -1143,9 +2102,71 @@ RelocalizationAndMappingGrpcServiceImpl::buildSolARImage(const Frame frame,
         }
     }
 
+    // Decoded (JPEG) and 16 bits images: rotation in a second pass
+    if (rotate180 && !rotated)
+        image->rotate180();
+
     return Status::OK;
 }
 
+grpc::Status
+RelocalizationAndMappingGrpcServiceImpl::downscaleImage(SRef<SolAR::datastructure::Image>& image, unsigned int factor)
+{
+    if (factor <= 1)
+        return Status::OK;
+
+    SolARImage::DataType dataType = image->getDataType();
+    if ((dataType != SolARImage::DataType::TYPE_8U) && (dataType != SolARImage::DataType::TYPE_16U))
+        return gRpcError("Error: downscale is only supported for 8 and 16 bits images");
+
+    SRef<SolAR::datastructure::Image> source = image;
+    image = org::bcom::xpcf::utils::make_shared<SolARImage>(
+                source->getWidth() / factor,
+                source->getHeight() / factor,
+                source->getImageLayout(),
+                SolARImage::PixelOrder::INTERLEAVED,
+                dataType);
+    image->setImageEncoding(source->getImageEncoding());
+
+    if (dataType == SolARImage::DataType::TYPE_8U)
+        imageconversion::downscaleBox8(static_cast<const uint8_t*>(source->data()),
+                                       static_cast<uint8_t*>(image->data()),
+                                       source->getWidth(), source->getHeight(), source->getNbChannels(), factor);
+    else
+        imageconversion::downscaleBox16(static_cast<const uint16_t*>(source->data()),
+                                        static_cast<uint16_t*>(image->data()),
+                                        source->getWidth(), source->getHeight(), source->getNbChannels(), factor);
+
+    return Status::OK;
+}
+
+// Projection (intrinsics) for images downscaled by a box filter: the center of a
+// destination pixel is the center of its block of factor x factor source pixels
+template <typename Projection>
+static void downscaleProjection(Projection& projection, unsigned int factor)
+{
+    const float offset = (factor - 1) / 2.f;
+    for (int row = 0; row < 2; row++)
+        projection.row(row) = (projection.row(row) - offset * projection.row(2)) / static_cast<float>(factor);
+}
+
+void
+RelocalizationAndMappingGrpcServiceImpl::downscaleCameraParameters(SolAR::datastructure::CameraParameters& cameraParameters,
+                                                                   unsigned int factor)
+{
+    // Distortion coefficients apply to normalized coordinates: unchanged
+    cameraParameters.resolution.width /= factor;
+    cameraParameters.resolution.height /= factor;
+    downscaleProjection(cameraParameters.intrinsic, factor);
+}
+
+void
+RelocalizationAndMappingGrpcServiceImpl::downscaleRectificationParameters(
+        SolAR::datastructure::RectificationParameters& rectificationParameters, unsigned int factor)
+{
+    downscaleProjection(rectificationParameters.projection, factor);
+}
+
 grpc::Status
 RelocalizationAndMappingGrpcServiceImpl::toGrpc(SolAR::api::pipeline::TransformStatus solARPoseStatus,
                                                 RelocalizationPoseStatus& gRpcPoseStatus)
@@ -1204,6 +2225,40 @@ RelocalizationAndMappingGrpcServiceImpl::toGrpc(SolAR::api::pipeline::MappingSta
     return Status::OK;
 }
 
+void
+RelocalizationAndMappingGrpcServiceImpl::toGrpc(const ServiceStats& stats, ProxyStats& gRpcStats)
+{
+    toGrpc(stats.latencies[ServiceStats::QUEUE_WAIT], *gRpcStats.mutable_queue_wait());
+    toGrpc(stats.latencies[ServiceStats::DECODE], *gRpcStats.mutable_decode());
+    toGrpc(stats.latencies[ServiceStats::REORDER], *gRpcStats.mutable_reorder());
+    toGrpc(stats.latencies[ServiceStats::FRONT_END], *gRpcStats.mutable_front_end());
+    toGrpc(stats.latencies[ServiceStats::TOTAL], *gRpcStats.mutable_total());
+
+    gRpcStats.set_nb_requests(stats.counters[ServiceStats::REQUESTS].load());
+    gRpcStats.set_nb_errors(stats.counters[ServiceStats::ERRORS].load());
+    gRpcStats.set_nb_rejected(stats.counters[ServiceStats::REJECTED].load());
+    gRpcStats.set_nb_late_dropped(stats.counters[ServiceStats::LATE_DROPPED].load());
+    gRpcStats.set_nb_shrink_dropped(stats.counters[ServiceStats::SHRINK_DROPPED].load());
+    gRpcStats.set_nb_overload_dropped(stats.counters[ServiceStats::OVERLOAD_DROPPED].load());
+    gRpcStats.set_nb_latest_pose_replies(stats.counters[ServiceStats::LATEST_POSE_REPLIES].load());
+    gRpcStats.set_nb_motion_gated(stats.counters[ServiceStats::MOTION_GATED].load());
+    gRpcStats.set_nb_duplicates(stats.counters[ServiceStats::DUPLICATES].load());
+    gRpcStats.set_nb_mode_switches(stats.counters[ServiceStats::MODE_SWITCHES].load());
+}
+
+void
+RelocalizationAndMappingGrpcServiceImpl::toGrpc(const LatencyHistogram& histogram, StageLatency& gRpcLatency)
+{
+    LatencySummary summary = histogram.summary();
+    gRpcLatency.set_count(summary.count);
+    gRpcLatency.set_mean_ms(static_cast<float>(summary.meanUs / 1000.));
+    gRpcLatency.set_p50_ms(summary.p50Us / 1000.f);
+    gRpcLatency.set_p90_ms(summary.p90Us / 1000.f);
+    gRpcLatency.set_p99_ms(summary.p99Us / 1000.f);
+    gRpcLatency.set_p999_ms(summary.p999Us / 1000.f);
+    gRpcLatency.set_max_ms(summary.maxUs / 1000.f);
+}
+
 SolAR::api::pipeline::PipelineMode
 RelocalizationAndMappingGrpcServiceImpl::toSolAR(PipelineMode pipelineMode)
 {
@@ -1225,14 +2280,16 @@ RelocalizationAndMappingGrpcServiceImpl::gRpcError(std::string message,
 
 void RelocalizationAndMappingGrpcServiceImpl::displayImages()
 {
-    std::vector<SRef<SolAR::datastructure::Image>> images;
+    SRef<const DecodedFrames> frames;
 
     // Try to get next images to display
-    if (!m_sharedBufferImageToDisplay.tryPop(images)) {
+    if (!m_sharedBufferImageToDisplay.tryPop(frames)) {
         xpcf::DelegateTask::yield();
         return;
     }
 
+    const std::vector<SRef<SolAR::datastructure::Image>>& images = frames->images;
+
     // Display images if specified
     if ((images.size() >= 1) && (m_image_viewer_left))
         m_image_viewer_left->display(images[0]);
@@ -1241,44 +2298,77 @@ void RelocalizationAndMappingGrpcServiceImpl::displayImages()
 
 }
 
-void RelocalizationAndMappingGrpcServiceImpl::saveImages()
+void RelocalizationAndMappingGrpcServiceImpl::recordFrames()
 {
-    std::tuple<std::vector<SRef<SolARImage>>, std::vector<SolAR::datastructure::Transform3Df>,
-               long> imagesPoses;
+    SRef<const PendingFrames> frames;
 
-    if (!m_sharedBufferImagePoseToSave.tryPop(imagesPoses)) {
+    if (!m_sharedBufferFramesToRecord.tryPop(frames)) {
         xpcf::DelegateTask::yield();
         return;
     }
 
-    std::vector<SRef<SolARImage>> images = std::get<0>(imagesPoses);
-    std::vector<SolAR::datastructure::Transform3Df> poses  = std::get<1>(imagesPoses);
+    writeFrames(*frames);
+}
+
+void RelocalizationAndMappingGrpcServiceImpl::writeFrames(const PendingFrames& frames)
+{
+    // All the frames of the recording are written: the file is completed
+    if (frames.closeRecording) {
+        if (!frames.recorder->close())
+            LOG_ERROR("Error while closing the recording {}", frames.recorder->path());
+        LOG_INFO("Recording {}: {} frames, {} bytes", frames.recorder->path(), frames.recorder->nbFrames(),
+                 frames.recorder->size());
+        return;
+    }
+
+    std::vector<RecordingImage> images;
+    images.reserve(frames.encodedImages.size());
+    for (size_t index = 0; index < frames.encodedImages.size(); index++)
+        images.push_back(toRecording(static_cast<uint32_t>(index), *frames.encodedImages[index].image,
+                                     frames.encodedImages[index].pose));
 
-    char imageName[9];
-    sprintf(imageName, "%0.8d", m_index_image);
+    if (!frames.recorder->writeFrame(frames.timestamp, images))
+        LOG_ERROR("Error while recording frames in {}", frames.recorder->path());
+}
 
-    if (images.size() >= 1)
-    {
-        if (images.at(0)->save(m_image1_path + imageName + std::string(".jpg"))
-                == SolAR::FrameworkReturnCode::_SUCCESS) {
-            for (int i = 0; i < 4; ++i)
-            for (int j = 0; j < 4; j++)
-                m_poseFile1 << poses.at(0)(i, j) << " ";
-            m_poseFile1 << "\n";
-
-            if (images.size() == 2) {
-                if (images.at(1)->save(m_image2_path + imageName + std::string(".jpg"))
-                        == SolAR::FrameworkReturnCode::_SUCCESS) {
-                    for (int i = 0; i < 4; ++i)
-                    for (int j = 0; j < 4; j++)
-                        m_poseFile2 << poses.at(1)(i, j) << " ";
-                    m_poseFile2 << "\n";
-                }
-            }
-            m_timestampFile << std::get<2>(imagesPoses) << "\n";
-            m_index_image++;
-        }
+SRef<FrameRecordingWriter>
+RelocalizationAndMappingGrpcServiceImpl::createRecorder(const std::string& clientUUID,
+                                                        const std::vector<RecordingCamera>& cameras) const
+{
+    // <save folder>/<client UUID>_<start time in ms>.solarrec: a file per session
+    auto startTime = std::chrono::duration_cast<std::chrono::milliseconds>(
+                std::chrono::system_clock::now().time_since_epoch()).count();
+    std::string path = m_file_path + "/" + clientUUID + "_" + std::to_string(startTime) + RECORDING_FILE_EXTENSION;
+
+    boost::system::error_code error;
+    boost::filesystem::create_directories(boost::filesystem::path(m_file_path), error);
+
+    auto recorder = xpcf::utils::make_shared<FrameRecordingWriter>();
+    if (!recorder->open(path, clientUUID, cameras)) {
+        LOG_ERROR("Error while creating the recording file {}", path);
+        return nullptr;
     }
+
+    LOG_INFO("Record frames in {}", path);
+
+    return recorder;
+}
+
+void RelocalizationAndMappingGrpcServiceImpl::setRecordingCamera(ProxyClientContext& clientContext,
+                                                                 const RecordingCamera& camera)
+{
+    std::unique_lock<std::mutex> lock(clientContext.m_images_vector_mutex);
+
+    auto it = std::find_if(clientContext.m_recordingCameras.begin(), clientContext.m_recordingCameras.end(),
+                           [&camera](const RecordingCamera& c) { return c.sensorId == camera.sensorId; });
+    if (it != clientContext.m_recordingCameras.end())
+        *it = camera;
+    else
+        clientContext.m_recordingCameras.push_back(camera);
+
+    // Parameters changed during the recording
+    if (clientContext.m_recorder != nullptr)
+        clientContext.m_recorder->writeCamera(camera);
 }
 
 } // namespace com::bcom::solar::gprc
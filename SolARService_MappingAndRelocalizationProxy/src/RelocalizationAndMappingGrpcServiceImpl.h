@@ -18,6 +18,17 @@
 #define RELOCALIZATION_AND_MAPPING_GRPC_SERVICE_IMPL
 
 #include "grpc/solar_mapping_and_relocalization_proxy.grpc.pb.h"
+#include "ArenaMessageAllocator.h"
+#include "ClientRegistry.h"
+#include "DuplicateFrameFilter.h"
+#include "FrameRecording.h"
+#include "LatencyHistogram.h"
+#include "MotionGate.h"
+#include "ProxyOptions.h"
+#include "ReorderDepthPolicy.h"
+#include "SeqLock.h"
+#include "TimestampOrderedRing.h"
+#include "WorkerPool.h"
 
 #include <api/pipeline/IAsyncRelocalizationPipeline.h>
 #include <api/display/IImageViewer.h>
@@ -25,12 +36,17 @@
 #include "xpcf/threading/SharedBuffer.h"
 #include "xpcf/threading/BaseTask.h"
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
 #include <mutex>
 
 namespace com::bcom::solar::gprc
 {
 
 #define BUFFER_SIZE_DISPLAY_SAVE_IMAGE 5
+#define BUFFER_SIZE_RECORD_FRAMES 32
 
 enum CameraMode : uint8_t {
   UNKNOWN_CAMERA_MODE = 0,
@@ -47,7 +63,7 @@ class Fps
         Fps(){}
         Fps(unsigned int computePeriodMs, unsigned int windowSize)
             :m_computePeriodMs{computePeriodMs},
-              m_windowSize{windowSize}
+              m_windowSize{std::max(1u, windowSize)}
         {}
 
         float update()
@@ -56,16 +72,19 @@ class Fps
             auto timeElapsed = now - m_lastTime;
             m_lastTime = now;
 
-            m_lastTenDeltas.push_back(std::chrono::duration_cast<ms>(timeElapsed).count());
-
-            if (m_lastTenDeltas.size() > m_windowSize)
-            {
-                m_lastTenDeltas.erase(m_lastTenDeltas.begin());
-            }
+            // Ring of the last deltas: the oldest one is replaced, with its part of the sum
+            int64_t delta = std::chrono::duration_cast<ms>(timeElapsed).count();
+            if (m_nbDeltas < m_windowSize)
+                m_nbDeltas++;
+            else
+                m_sumDeltas -= m_lastDeltas[m_nextDelta];
+            m_lastDeltas[m_nextDelta] = delta;
+            m_sumDeltas += delta;
+            m_nextDelta = (m_nextDelta + 1) % m_windowSize;
 
             if (now - m_lastTimeComputed > m_computePeriodMs)
             {
-                m_currentFps = 1000.f / (std::accumulate(m_lastTenDeltas.begin(), m_lastTenDeltas.end(), 0.f) / m_lastTenDeltas.size());
+                m_currentFps = 1000.f / (static_cast<float>(m_sumDeltas) / m_nbDeltas);
                 m_lastTimeComputed = now;
             }
 
@@ -77,11 +96,176 @@ class Fps
         unsigned int m_windowSize{10};
         float m_currentFps{0};
 
-        std::vector<float> m_lastTenDeltas;
+        std::vector<int64_t> m_lastDeltas = std::vector<int64_t>(m_windowSize);
+        unsigned int m_nextDelta = 0;
+        unsigned int m_nbDeltas = 0;
+        int64_t m_sumDeltas = 0;
         std::chrono::time_point<std::chrono::system_clock> m_lastTime;
         std::chrono::time_point<std::chrono::system_clock> m_lastTimeComputed;
 };
 
+/**
+ * @struct DecodedFrames
+ * @brief Images and poses of a received request, decoded once
+ *
+ * Read only once built: the same instance is shared by the reorder buffer,
+ * the front end call, the display and the backup of images.
+ */
+struct DecodedFrames
+{
+    DecodedFrames(std::vector<SRef<SolAR::datastructure::Image>>&& images,
+                  std::vector<SolAR::datastructure::Transform3Df>&& poses,
+                  long timestamp)
+        : images{std::move(images)}, poses{std::move(poses)}, timestamp{timestamp}
+    {}
+
+    const std::vector<SRef<SolAR::datastructure::Image>> images;
+    const std::vector<SolAR::datastructure::Transform3Df> poses;
+    const long timestamp;
+};
+
+/**
+ * @struct ReceivedFrame
+ * @brief Frame of a request, independent of the version of the gRPC API
+ */
+struct ReceivedFrame
+{
+    int32_t sensorId = 0;
+    long timestamp = 0;
+    const Image* image = nullptr;                   // Image of the request, read in place (nullptr if none)
+    SolAR::datastructure::Transform3Df pose;
+};
+
+/**
+ * @struct ReceivedFrames
+ * @brief Frames of a request, independent of the version of the gRPC API
+ *
+ * Built by each API from its request message: the images are not copied,
+ * only the poses are converted. Valid while the request is: owner keeps the
+ * request alive for the frames still waiting for it once the call is answered.
+ */
+struct ReceivedFrames
+{
+    int nbFrames = 0;                               // Number of frames of the request
+    std::array<ReceivedFrame, 2> frames;            // First frames of the request (mono or stereo)
+    std::shared_ptr<const void> owner;              // Owner of the request message (nullptr: images copied when kept)
+    std::chrono::steady_clock::time_point receivedTime;     // Request received by the proxy (latency statistics)
+};
+
+/**
+ * @struct PendingFrames
+ * @brief Frames of a received request, waiting in the reorder buffer
+ *
+ * Compressed images (JPEG, PNG) are kept encoded until the frames leave the
+ * reorder buffer: dropped frames are never decoded. Uncompressed images are
+ * built on reception. Frames are decoded once (decodeFlag), by the first of
+ * the worker that forwards them and the client strand.
+ * When recorded, all the images are kept as received (encodedImages) and are
+ * decoded only to be displayed.
+ * Encoded images are read in place in their request, which they keep alive.
+ */
+struct PendingFrames
+{
+    /// @brief Image kept as received, with the pose of its frame
+    struct EncodedImage
+    {
+        std::shared_ptr<const Image> image;         // Image of the request (shares the ownership of the request)
+        SolAR::datastructure::Transform3Df pose;
+    };
+
+    long timestamp = 0;
+    std::vector<SRef<SolAR::datastructure::Image>> images;     // Images built on reception (nullptr if encoded)
+    std::vector<EncodedImage> encodedImages;                    // Compressed (or recorded) images, same index as images
+    std::vector<SolAR::datastructure::Transform3Df> poses;      // Moved to the decoded frames once decoded
+    SolAR::datastructure::Transform3Df devicePose;              // Pose of the first frame, read by the motion gate
+    bool grey = false;                                          // RGB images converted to GREY_8
+    std::array<bool, 2> rotate180 = {false, false};             // Images rotated 180 degrees, same index as images
+    unsigned int downscaleFactor = 1;                           // Images downscaled by this factor
+    SRef<FrameRecordingWriter> recorder;                        // Recording of the client (nullptr if not recorded)
+    bool closeRecording = false;                                // No images: close the recording once written up to here
+    SolAR::datastructure::Transform3Df worldTransform;          // Ground truth world transform sent with the frames
+    bool fixedPose = false;
+    bool catchUp = false;                                       // Backlog of a batch: not gated nor coalesced
+
+    std::once_flag decodeFlag;
+    bool imageHashed = false;                                   // Duplicate detection: imageHash set once decoded
+    uint64_t imageHash = 0;                                     // Difference hash of the first image
+    grpc::Status decodeStatus;
+    SRef<const DecodedFrames> decoded;                          // Set once decoded
+
+    // Latency statistics
+    std::chrono::steady_clock::time_point reorderTime;          // Frames pushed in the reorder buffer
+    std::chrono::steady_clock::duration decodeDuration{};       // Set once decoded
+};
+
+/**
+ * @struct PoseResult
+ * @brief Result of the front end for frames, independent of the version of the gRPC API
+ *
+ * Converted to the result message of each API once the frames are answered.
+ * Also kept as the last result of a client, copied without lock by the readers.
+ */
+struct PoseResult
+{
+    uint64_t timestamp = 0;         // Timestamp of the processed frame (0: no result yet)
+    float pose[16] = {};            // Column major 4x4 matrix (Eigen layout)
+    float confidence = 0;
+    int32_t poseStatus = 0;         // gRPC RelocalizationPoseStatus
+    int32_t mappingStatus = 0;      // gRPC MappingStatus
+    uint32_t reserved = 0;
+};
+
+/**
+ * @struct ServiceStats
+ * @brief Latencies of the processing stages of the frames requests, and counters, of the proxy or of a client
+ *
+ * Lock free: updated by the workers and the client strands, read by GetStats.
+ */
+struct ServiceStats
+{
+    enum Stage : uint8_t {
+        QUEUE_WAIT = 0,         // Request received, to its processing started by a worker
+        DECODE,                 // Decoding of the images leaving the reorder buffer
+        REORDER,                // Frames held in the reorder buffer
+        FRONT_END,              // Call of the front end
+        TOTAL,                  // Request received, to request answered
+        NB_STAGES
+    };
+
+    enum Counter : uint8_t {
+        REQUESTS = 0,           // Frames requests answered (a batch is one request)
+        ERRORS,                 // Frames requests answered with an error
+        REJECTED,               // Frames requests rejected: too many frames waiting to be processed
+        LATE_DROPPED,           // Frames older than the last forwarded ones
+        SHRINK_DROPPED,         // Frames dropped when the reorder depth decreased
+        OVERLOAD_DROPPED,       // Frames over budget replaced by newer ones (never forwarded)
+        LATEST_POSE_REPLIES,    // Frames over budget answered at once with the last result
+        MOTION_GATED,           // Frames answered with the last result because the device did not move
+        DUPLICATES,             // Frames answered with the last result because visually identical to a recent one
+        MODE_SWITCHES,          // Camera mode (mono, stereo) and pipeline mode changes
+        NB_COUNTERS
+    };
+
+    std::array<LatencyHistogram, NB_STAGES> latencies;
+    std::array<std::atomic<uint64_t>, NB_COUNTERS> counters{};
+};
+
+/**
+ * @class TransformSubscriber
+ * @brief Receiver of the results of a client (SubscribeTransforms call)
+ */
+class TransformSubscriber
+{
+    public:
+        virtual ~TransformSubscriber() = default;
+
+        /// @brief Send a new result (called under the subscribers mutex of the client)
+        virtual void publish(const PoseResult& result) = 0;
+
+        /// @brief End the subscription (client unregistered, called under the subscribers mutex of the client)
+        virtual void close() = 0;
+};
+
 /**
  * @class ProxyClientContext
  * @brief Class that models each proxy client context
@@ -91,7 +275,12 @@ class Fps
 class ProxyClientContext
 {
     public:
-        ProxyClientContext()
+        ProxyClientContext(const ProxyOptions& options, WorkerPool& workerPool)
+            : m_ordered_images{options.reorderMaxDepth + 1},
+              m_reorderPolicy{options.reorderMaxDepth, options.reorderMaxLatencyMs},
+              m_motionGate{options.motionGateTranslation, options.motionGateRotationDeg, options.motionGateMaxIntervalMs},
+              m_forwardStrand{xpcf::utils::make_shared<Strand>(workerPool)},
+              m_duplicateFilter{options.duplicateDistance, options.duplicateHistory, options.duplicateMaxAgeMs}
         {
             // Initialize class members
             m_started = false;
@@ -103,16 +292,71 @@ class ProxyClientContext
         CameraMode m_cameraMode;        // Indicates the camera mode: mono or stereo
         long m_last_image_timestamp;    // Timestamp of the last image processed
 
-        // Vector of ordered tuple(images, poses, timestamp)
-        std::vector<std::tuple<std::vector<SRef<SolAR::datastructure::Image>>,
-                               std::vector<SolAR::datastructure::Transform3Df>, long>> m_ordered_images;
-        std::mutex m_images_vector_mutex;   // Mutex used to control vector access
+        // Reorder buffer: images and poses ordered by timestamp
+        TimestampOrderedRing<SRef<PendingFrames>> m_ordered_images;
+        ReorderDepthPolicy m_reorderPolicy;     // Number of frames held back in the reorder buffer
+        MotionGate m_motionGate;                // Frames forwarded when the device moved (protected by m_images_vector_mutex)
+        std::mutex m_images_vector_mutex;   // Mutex used to control reorder buffer access
+
+        SRef<Strand> m_forwardStrand;       // Frames are sent to the front end one at a time, in order
+        DuplicateFrameFilter m_duplicateFilter; // Frames visually identical to a recent one are not sent to the front end
 
         Fps m_relocAndMapFps;
+
+        std::atomic<bool> m_forwardGrey{false};     // RGB images sent to the front end in GREY_8 (set by Init)
+        std::atomic<unsigned int> m_downscaleFactor{1}; // Downscale of the images sent to the front end (set with the camera parameters)
+        // Images rotated 180 degrees, for each sensor (set with the camera parameters, default: right camera of a stereo rig)
+        std::array<std::atomic<bool>, 2> m_rotate180{{ {false}, {true} }};
+
+        // Recording of the frames (save mode), protected by m_images_vector_mutex
+        SRef<FrameRecordingWriter> m_recorder;              // Set from Start to Stop
+        std::vector<RecordingCamera> m_recordingCameras;    // Last camera parameters received, for each sensor
+
+        // Admission control, protected by m_images_vector_mutex
+        unsigned int m_nbInFlight = 0;                  // Frames posted to the forward strand and not answered yet
+        SRef<PendingFrames> m_coalescedFrames;          // Newest frames received over budget, forwarded next
+
+        // Latencies and counters of the client (also counted for the proxy)
+        ServiceStats m_stats;
+        std::atomic<int> m_pipelineMode{-1};            // Pipeline mode set by Init (-1: not initialized)
+
+        // Last result of the front end, given to the frames answered at once and to Get3DTransform
+        SeqLock<PoseResult> m_lastResult;
+
+        // Subscriptions to the results (SubscribeTransforms calls)
+        std::mutex m_subscribersMutex;
+        std::vector<TransformSubscriber*> m_subscribers;
+        bool m_subscriptionsClosed = false;     // Client unregistered: no new subscription
 };
 
+// Frames are received through the callback API: no gRPC thread is held while
+// a frame is processed, and requests are allocated on per-call arenas.
+// The other (control) methods use the synchronous API
+typedef SolARMappingAndRelocalizationProxy::ExperimentalWithCallbackMethod_RelocalizeAndMap<
+            SolARMappingAndRelocalizationProxy::ExperimentalWithCallbackMethod_RelocalizeAndMapGroundTruth<
+                SolARMappingAndRelocalizationProxy::ExperimentalWithCallbackMethod_RelocalizeAndMapStream<
+                    SolARMappingAndRelocalizationProxy::ExperimentalWithCallbackMethod_RelocalizeAndMapBatch<
+                        SolARMappingAndRelocalizationProxy::ExperimentalWithCallbackMethod_SubscribeTransforms<
+                            SolARMappingAndRelocalizationProxy::Service>>>>> RelocalizationAndMappingService;
+
+#ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+typedef grpc::CallbackServerContext CallbackServerContext;
+typedef grpc::ServerUnaryReactor ServerUnaryReactor;
+template <class Request, class Response>
+using ServerBidiReactor = grpc::ServerBidiReactor<Request, Response>;
+template <class Response>
+using ServerWriteReactor = grpc::ServerWriteReactor<Response>;
+#else
+typedef grpc::experimental::CallbackServerContext CallbackServerContext;
+typedef grpc::experimental::ServerUnaryReactor ServerUnaryReactor;
+template <class Request, class Response>
+using ServerBidiReactor = grpc::experimental::ServerBidiReactor<Request, Response>;
+template <class Response>
+using ServerWriteReactor = grpc::experimental::ServerWriteReactor<Response>;
+#endif
+
 class RelocalizationAndMappingGrpcServiceImpl
-    final : public SolARMappingAndRelocalizationProxy::Service
+    final : public RelocalizationAndMappingService
 {
 
 public:
@@ -121,13 +365,15 @@ public:
     RelocalizationAndMappingGrpcServiceImpl(SolAR::api::pipeline::IAsyncRelocalizationPipeline* pipeline);
 
     RelocalizationAndMappingGrpcServiceImpl(SolAR::api::pipeline::IAsyncRelocalizationPipeline* pipeline,
-                                            std::string saveFolder);
+                                            std::string saveFolder,
+                                            const ProxyOptions& options = ProxyOptions());
 
     RelocalizationAndMappingGrpcServiceImpl(SolAR::api::pipeline::IAsyncRelocalizationPipeline* pipeline,
                                             std::string saveFolder,
                                             uint8_t display_images,
                                             SRef<SolAR::api::display::IImageViewer> image_viewer_left,
-                                            SRef<SolAR::api::display::IImageViewer> image_viewer_right);
+                                            SRef<SolAR::api::display::IImageViewer> image_viewer_right,
+                                            const ProxyOptions& options = ProxyOptions());
 
     ~RelocalizationAndMappingGrpcServiceImpl() override;
 
@@ -164,18 +410,31 @@ public:
                                             const RectificationParameters* request,
                                             Empty* response)  override;
 
-    grpc::Status RelocalizeAndMap(grpc::ServerContext* context,
-                                  const Frames* request,
-                                  RelocalizationResult* response)  override;
+    ServerUnaryReactor* RelocalizeAndMap(CallbackServerContext* context,
+                                         const Frames* request,
+                                         RelocalizationResult* response)  override;
+
+    ServerUnaryReactor* RelocalizeAndMapGroundTruth(CallbackServerContext* context,
+                                                    const GroundTruthFrames* request,
+                                                    RelocalizationResult* response)  override;
 
-    grpc::Status RelocalizeAndMapGroundTruth(grpc::ServerContext* context,
-                                             const GroundTruthFrames* request,
-                                             RelocalizationResult* response)  override;
+    ServerBidiReactor<Frames, RelocalizationResult>* RelocalizeAndMapStream(CallbackServerContext* context)  override;
+
+    ServerUnaryReactor* RelocalizeAndMapBatch(CallbackServerContext* context,
+                                              const FramesBatch* request,
+                                              RelocalizationResults* response)  override;
 
     grpc::Status Get3DTransform(grpc::ServerContext* context,
                                 const ClientUUID* request,
                                 RelocalizationResult* response)  override;
 
+    ServerWriteReactor<RelocalizationResult>* SubscribeTransforms(CallbackServerContext* context,
+                                                                  const ClientUUID* request)  override;
+
+    grpc::Status GetStats(grpc::ServerContext* context,
+                          const ClientUUID* request,
+                          ProxyStatsResult* response)  override;
+
     grpc::Status Reset(grpc::ServerContext *context,
                        const Empty* request,
                        Empty *response) override;
@@ -184,56 +443,192 @@ public:
                              const Message* request,
                              Empty* response) override;
 
+    // Messages of this version of the API, and their conversions (used by the reactors)
+    typedef Frames FramesMessage;
+    typedef RelocalizationResult ResultMessage;
+    static grpc::Status toReceivedFrames(const Frames& request, ReceivedFrames& frames);
+    static void toGrpc(const PoseResult& result, RelocalizationResult& response);
 
 private:
 
+    // Version 2 of the API: served with the same clients and frames processing
+    friend class RelocalizationAndMappingGrpcServiceImplV2;
+
+    // Reactor of a RelocalizeAndMapStream call (Api: service of a version of the API)
+    template <class Api>
+    class RelocalizeAndMapStreamReactor;
+
+    // Reactor of a SubscribeTransforms call (Api: service of a version of the API)
+    template <class Api>
+    class SubscribeTransformsReactor;
+
     SolAR::api::pipeline::IAsyncRelocalizationPipeline* m_pipeline;
+    ProxyOptions m_options;
 
     // Map of current clients (UUID) with the context for each one
-    std::map<std::string, SRef<ProxyClientContext>> m_clientsMap;
-    mutable std::mutex                              m_mutexClientMap;
-
-    grpc::Status RelocalizeAndMapInternal(grpc::ServerContext* context,
-                                          const Frames* request,
-                                          const ::com::bcom::solar::gprc::Matrix4x4& worldTransform,
-                                          bool fixedPose,
-                                          RelocalizationResult* response);
+    ClientRegistry<ProxyClientContext> m_clients;
+
+    // Per-call arenas for the frames requests and their results
+    ArenaMessageAllocator<Frames, RelocalizationResult> m_framesAllocator;
+    ArenaMessageAllocator<GroundTruthFrames, RelocalizationResult> m_groundTruthFramesAllocator;
+    ArenaMessageAllocator<FramesBatch, RelocalizationResults> m_framesBatchAllocator;
+
+    // Register the per-call arena allocators of the callback methods
+    void setMessageAllocators();
+
+    /// @brief Answer of frames, with their result (valid during the call)
+    typedef std::function<void(const grpc::Status&, const PoseResult&)> ResultCallback;
+
+    /// @brief Answer of a batch of frames, with a result for each frames (or the newest one only)
+    typedef std::function<void(const grpc::Status&, std::vector<PoseResult>&)> BatchResultCallback;
+
+    /// @brief Process received frames: prepare, reorder, decode and forward to the front end
+    /// Decoding runs on the calling worker, forwarding on the client strand:
+    /// done is called once the result is known (possibly on another worker)
+    void RelocalizeAndMapInternal(const std::string& clientUUID,
+                                  const ReceivedFrames& request,
+                                  const SolAR::datastructure::Transform3Df& worldTransform,
+                                  bool fixedPose,
+                                  ResultCallback done);
+
+    /// @brief Process a batch of frames: each one is prepared, then all are reordered at once
+    /// Frames leaving the reorder buffer are all forwarded, in timestamp order: the motion gate,
+    /// the duplicate filter and the in-flight budget apply to live frames only.
+    /// done is called once all the frames are answered
+    void RelocalizeAndMapBatchInternal(const std::string& clientUUID,
+                                       const std::vector<ReceivedFrames>& request,
+                                       bool lastResultOnly,
+                                       BatchResultCallback done);
+
+    /// @brief Set the parameters of the cameras of a client (1 camera: mono, 2 cameras: stereo)
+    grpc::Status setCameraParametersInternal(const std::string& clientUUID,
+                                             SolAR::datastructure::CameraParameters* cameras,
+                                             const RecordingCamera* recordingCameras,
+                                             size_t nbCameras);
+
+    /// @brief Set the rectification parameters of the stereo cameras of a client
+    grpc::Status setRectificationParametersInternal(const std::string& clientUUID,
+                                                    SolAR::datastructure::RectificationParameters& cam1RectParams,
+                                                    SolAR::datastructure::RectificationParameters& cam2RectParams);
+
+    /// @brief Prepared frames to schedule, with their call
+    struct ScheduledFrames
+    {
+        SRef<PendingFrames> frames;                         // Received frames, then frames forwarded by this call
+        const SolAR::datastructure::Transform3Df* worldTransform;
+        bool fixedPose;
+        ResultCallback done;
+
+        enum class Answer : uint8_t {
+            FORWARDED,          // Answered once frames are processed by the front end
+            HELD,               // Answered at once, frames held in the reorder buffer
+            LATEST_RESULT       // Answered at once with the last result (frames gated or over budget)
+        } answer = Answer::HELD;
+    };
+
+    /// @brief Reorder, gate, admission, decode and forward stages of prepared frames
+    /// All the frames are reordered in one reorder buffer lock, then each call is answered
+    void scheduleFrames(const SRef<ProxyClientContext>& clientContext, const std::string& clientUUID,
+                        ScheduledFrames* batch, size_t size);
+
+    /// @brief Prepare stage: check a request and keep its frames for the reorder buffer (nullptr if the request is dropped)
+    grpc::Status prepareFrames(const std::string& clientUUID,
+                               const ReceivedFrames& request,
+                               ProxyClientContext& clientContext,
+                               SRef<PendingFrames>& frames);
+
+    /// @brief Decode stage: decode the compressed images of frames (once, thread safe)
+    grpc::Status decodeFrames(PendingFrames& frames) const;
+
+    /// @brief Give the downscale factor of the images of a camera, according to the target width
+    unsigned int downscaleFactor(uint32_t width) const;
+
+    /// @brief Set the encoding used to send an image to the front end
+    void setForwardEncoding(SolAR::datastructure::Image& image, ImageCompression receivedCompression) const;
+
+    /// @brief Forward stage: send reordered frames to the front end
+    grpc::Status forwardFrames(const std::string& clientUUID,
+                               const SRef<const DecodedFrames>& frames,
+                               const SolAR::datastructure::Transform3Df& worldTransform,
+                               bool fixedPose,
+                               PoseResult& result);
 private:
 
+    /// @brief Admission control: reserve an in-flight slot for frames of a client (called under the reorder buffer lock)
+    /// @return false if the client or the proxy is over budget
+    bool admitFrames(ProxyClientContext& clientContext);
+
+    /// @brief Post admitted frames to the forward strand of their client, then release their in-flight slot
+    void postForward(const SRef<ProxyClientContext>& clientContext, const std::string& clientUUID,
+                     SRef<PendingFrames> frames, ResultCallback done);
+
+    /// @brief Release the in-flight slot of forwarded frames, and forward the coalesced frames if any
+    void onForwarded(const SRef<ProxyClientContext>& clientContext, const std::string& clientUUID);
+
+    /// @brief Give the last result of the front end for a client, to answer frames at once (LATEST_POSE)
+    static PoseResult latestResult(ProxyClientContext& clientContext);
+
+    /// @brief Keep the last result of a client, and send it to the subscribers if the transform changed
+    static void setLastResult(ProxyClientContext& clientContext, const PoseResult& result);
+
+    /// @brief Indicates if frames duplicate a frame recently sent to the front end (frames decoded if needed)
+    bool isDuplicate(ProxyClientContext& clientContext, PendingFrames& frames) const;
+
+    /// @brief Record, decode and forward frames (run on the forward strand of their client)
+    grpc::Status forwardPendingFrames(ProxyClientContext& clientContext, const std::string& clientUUID,
+                                      const SRef<PendingFrames>& frames, PoseResult& result);
+
+    /// @brief Count an event of a client, for the client and the proxy
+    void count(ProxyClientContext& clientContext, ServiceStats::Counter counter);
+
+    /// @brief Record the latency of a processing stage of a client, for the client and the proxy
+    void recordLatency(ProxyClientContext& clientContext, ServiceStats::Stage stage,
+                       std::chrono::steady_clock::duration latency);
+
+    /// @brief Count an answered frames request, with its total latency, for the client and the proxy
+    void recordAnswer(ProxyClientContext& clientContext, std::chrono::steady_clock::time_point receivedTime,
+                      const grpc::Status& status);
+
+    /// @brief Count a frames request rejected before being processed (worker queue full)
+    void countRejected(const std::string& clientUUID);
+
+    /// @brief Stop a started client: its recording is closed once its forwarded frames are written,
+    /// and the display and record tasks are stopped with the last started client
+    void stopClient(const SRef<ProxyClientContext>& clientContext);
+
     // Variables used to display images on a view screen
     uint8_t m_display_images = 0;
     SRef<SolAR::api::display::IImageViewer> m_image_viewer_left, m_image_viewer_right;
 
-    // Variables used to save images on disk
-    long m_index_image;
-    std::ofstream m_poseFile1, m_poseFile2;
-    std::ofstream m_timestampFile;
-    std::string m_file_path, m_image1_path, m_image2_path;
-
-    // Buffers used to save or display images (poses and timestamps)
-    xpcf::SharedBuffer<std::vector<SRef<SolAR::datastructure::Image>>>
-                            m_sharedBufferImageToDisplay{BUFFER_SIZE_DISPLAY_SAVE_IMAGE};
-    xpcf::SharedBuffer<std::tuple<std::vector<SRef<SolAR::datastructure::Image>>,
-                                  std::vector<SolAR::datastructure::Transform3Df>,
-                                  long>>
-                            m_sharedBufferImagePoseToSave{BUFFER_SIZE_DISPLAY_SAVE_IMAGE};
-
-    // Delegate task dedicated to asynchronous processing
+    // Folder of the recordings (save mode if not empty)
+    std::string m_file_path;
+
+    // Buffer used to display images (poses and timestamps): decoded frames are shared, not copied
+    xpcf::SharedBuffer<SRef<const DecodedFrames>> m_sharedBufferImageToDisplay{BUFFER_SIZE_DISPLAY_SAVE_IMAGE};
+    // Buffer used to record frames: frames are shared, as received
+    xpcf::SharedBuffer<SRef<const PendingFrames>> m_sharedBufferFramesToRecord{BUFFER_SIZE_RECORD_FRAMES};
+
+    // Delegate task dedicated to asynchronous processing (running while at least one client is started)
     xpcf::DelegateTask * m_displayImagesTask = nullptr;
-    xpcf::DelegateTask * m_saveImagesTask = nullptr;
+    xpcf::DelegateTask * m_recordFramesTask = nullptr;
+    std::mutex m_startedClientsMutex;
+    unsigned int m_nbStartedClients = 0;
 
     // Asynchronous display of images
     void displayImages();
 
-    // Asynchronous backup of images and poses
-    void saveImages();
+    // Asynchronous recording of frames
+    void recordFrames();
 
-    // Sort vector of tuples according to the third element of tuple
-    static bool sortbythird (
-            const std::tuple<std::vector<SRef<SolAR::datastructure::Image>>,
-                             std::vector<SolAR::datastructure::Transform3Df>, long> a ,
-            const std::tuple<std::vector<SRef<SolAR::datastructure::Image>>,
-                             std::vector<SolAR::datastructure::Transform3Df>, long> b);
+    /// @brief Append frames to the recording file of their client
+    static void writeFrames(const PendingFrames& frames);
+
+    /// @brief Create the recording file of a client (save mode)
+    SRef<FrameRecordingWriter> createRecorder(const std::string& clientUUID,
+                                              const std::vector<RecordingCamera>& cameras) const;
+
+    /// @brief Keep the camera parameters of a sensor for the recording of a client
+    static void setRecordingCamera(ProxyClientContext& clientContext, const RecordingCamera& camera);
 
     /// @brief Give the context (ProxyClientContext instance) of the given client UUID
     SRef<ProxyClientContext> getClientContext(const std::string & clientUUID) const;
@@ -252,13 +647,41 @@ private:
     static SolAR::datastructure::StereoType toSolAR(StereoType type);
     static SolAR::datastructure::Transform3Df toSolAR(const Matrix4x4& gRpcPose);
     static void toGrpc(const SolAR::datastructure::Transform3Df& solARPose, Matrix4x4& gRpcPose);
-    static grpc::Status buildSolARImage(const Frame, const SolAR::datastructure::Transform3Df& solARPose, SRef<SolAR::datastructure::Image>& image);
+    /// @brief Pose of the frames sent without pose or world transform (all coefficients null)
+    static const SolAR::datastructure::Transform3Df& nullTransform();
+    static RecordingCamera toRecording(uint32_t sensorId, CameraType type, uint32_t width, uint32_t height,
+                                       const Matrix3x3& intrinsics, const CameraDistortion& distortion,
+                                       ImageRotation rotation);
+    static RecordingImage toRecording(uint32_t sensorId, const Image& gRpcImage,
+                                      const SolAR::datastructure::Transform3Df& pose);
+    /// @brief Build a SolAR image from a received image
+    /// The image is read in place: raw data are copied once, directly into the buffer owned by the SolAR image
+    /// The rotation is done in the same pass as the conversion of uncompressed and PNG images
+    static grpc::Status buildSolARImage(const Image& gRpcImage, SRef<SolAR::datastructure::Image>& image,
+                                        bool grey = false, bool rotate180 = false);
+    /// @brief Downscale an image by an integer factor (box filter)
+    static grpc::Status downscaleImage(SRef<SolAR::datastructure::Image>& image, unsigned int factor);
+    /// @brief Update camera parameters for images downscaled by an integer factor
+    static void downscaleCameraParameters(SolAR::datastructure::CameraParameters& cameraParameters, unsigned int factor);
+    static void downscaleRectificationParameters(SolAR::datastructure::RectificationParameters& rectificationParameters,
+                                                 unsigned int factor);
     static grpc::Status toGrpc(SolAR::api::pipeline::TransformStatus solARPoseStatus, RelocalizationPoseStatus& gRpcPoseStatus);
     static grpc::Status toGrpc(SolAR::api::pipeline::MappingStatus mappingStatus, MappingStatus& gRpcMappingStatus);
     static SolAR::api::pipeline::PipelineMode toSolAR(PipelineMode pipelineMode);
 
+    static void toGrpc(const ServiceStats& stats, ProxyStats& gRpcStats);
+    static void toGrpc(const LatencyHistogram& histogram, StageLatency& gRpcLatency);
+
     static grpc::Status gRpcError(std::string message, grpc::StatusCode gRpcStatus = grpc::StatusCode::INTERNAL);
 
+    std::atomic<unsigned int> m_nbInFlight{0};      // Frames of all the clients posted to the forward strands
+
+    // Latencies and counters of all the clients, since the proxy started
+    ServiceStats m_stats;
+
+    // Work-stealing workers running the frames processing outside of the gRPC threads
+    // (declared last: stopped before the other members are destroyed)
+    WorkerPool m_workerPool;
 };
 
 } // namespace com::bcom::solar::gprc
@@ -0,0 +1,464 @@
+/**
+ * @copyright Copyright (c) 2021 B-com http://www.b-com.com/
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "RelocalizationAndMappingGrpcServiceImplV2.h"
+#include "RelocalizationAndMappingReactors.h"
+
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include <core/Log.h>
+
+using grpc::Status;
+using grpc::StatusCode;
+
+using SolAR::Log;
+
+namespace com::bcom::solar::gprc
+{
+
+RelocalizationAndMappingGrpcServiceImplV2::RelocalizationAndMappingGrpcServiceImplV2(
+        RelocalizationAndMappingGrpcServiceImpl& service): m_service{ service }
+{
+    LOG_DEBUG("RelocalizationAndMappingGrpcServiceImplV2 constructor");
+
+    SetMessageAllocatorFor_RelocalizeAndMap(&m_framesAllocator);
+    SetMessageAllocatorFor_RelocalizeAndMapGroundTruth(&m_groundTruthFramesAllocator);
+    SetMessageAllocatorFor_RelocalizeAndMapBatch(&m_framesBatchAllocator);
+}
+
+grpc::Status
+RelocalizationAndMappingGrpcServiceImplV2::RegisterClient(grpc::ServerContext* context,
+                                                          const Empty* request,
+                                                          ClientUUID* response)
+{
+    return m_service.RegisterClient(context, request, response);
+}
+
+grpc::Status
+RelocalizationAndMappingGrpcServiceImplV2::UnregisterClient(grpc::ServerContext* context,
+                                                            const ClientUUID* request,
+                                                            Empty* response)
+{
+    return m_service.UnregisterClient(context, request, response);
+}
+
+grpc::Status
+RelocalizationAndMappingGrpcServiceImplV2::Init(grpc::ServerContext* context,
+                                                const PipelineModeValue* request,
+                                                Empty* response)
+{
+    return m_service.Init(context, request, response);
+}
+
+grpc::Status
+RelocalizationAndMappingGrpcServiceImplV2::Start(grpc::ServerContext* context,
+                                                 const ClientUUID* request,
+                                                 Empty* response)
+{
+    return m_service.Start(context, request, response);
+}
+
+grpc::Status
+RelocalizationAndMappingGrpcServiceImplV2::Stop(grpc::ServerContext* context,
+                                                const ClientUUID* request,
+                                                Empty* response)
+{
+    return m_service.Stop(context, request, response);
+}
+
+grpc::Status
+RelocalizationAndMappingGrpcServiceImplV2::SetCameraParameters(grpc::ServerContext* context,
+                                                               const v2::CameraParameters* request,
+                                                               Empty* response)
+{
+    LOG_INFO("Set camera parameters for relocalization and mapping (v2)");
+
+    SolAR::datastructure::CameraParameters solarCamParams;
+    auto status = toSolAR(request->camera(), solarCamParams);
+    if (!status.ok())
+        return status;
+
+    LOG_DEBUG("   name: {}", solarCamParams.name);
+    LOG_DEBUG("   id: {}", solarCamParams.id);
+    LOG_DEBUG("   resolution: {}x{}", solarCamParams.resolution.width, solarCamParams.resolution.height);
+    LOG_DEBUG("   intrinsics:\n{}", solarCamParams.intrinsic);
+    LOG_DEBUG("   distortion: {}", solarCamParams.distortion.transpose());
+
+    RecordingCamera camera = toRecording(0, request->camera());
+
+    status = m_service.setCameraParametersInternal(request->client_uuid(), &solarCamParams, &camera, 1);
+    if (!status.ok())
+        return status;
+
+    LOG_DEBUG("Set camera parameters for relocalization and mapping OK");
+
+    return Status::OK;
+}
+
+grpc::Status
+RelocalizationAndMappingGrpcServiceImplV2::SetCameraParametersStereo(grpc::ServerContext* context,
+                                                                     const v2::CameraParametersStereo* request,
+                                                                     Empty* response)
+{
+    LOG_INFO("Set camera parameters for relocalization and stereo mapping (v2)");
+
+    SolAR::datastructure::CameraParameters solarCamParams[2];
+    auto status = toSolAR(request->camera1(), solarCamParams[0]);
+    if (status.ok())
+        status = toSolAR(request->camera2(), solarCamParams[1]);
+    if (!status.ok())
+        return status;
+
+    for (const SolAR::datastructure::CameraParameters& camParams : solarCamParams) {
+        LOG_DEBUG("   Camera {}:", camParams.id);
+        LOG_DEBUG("   name: {}", camParams.name);
+        LOG_DEBUG("   resolution: {}x{}", camParams.resolution.width, camParams.resolution.height);
+        LOG_DEBUG("   intrinsics:\n{}", camParams.intrinsic);
+        LOG_DEBUG("   distortion: {}", camParams.distortion.transpose());
+    }
+
+    RecordingCamera cameras[2] = { toRecording(0, request->camera1()), toRecording(1, request->camera2()) };
+
+    status = m_service.setCameraParametersInternal(request->client_uuid(), solarCamParams, cameras, 2);
+    if (!status.ok())
+        return status;
+
+    LOG_DEBUG("Set camera parameters for relocalization and stereo mapping OK");
+
+    return Status::OK;
+}
+
+grpc::Status
+RelocalizationAndMappingGrpcServiceImplV2::SetRectificationParameters(grpc::ServerContext* context,
+                                                                      const v2::RectificationParameters* request,
+                                                                      Empty* response)
+{
+    LOG_INFO("Set camera rectification parameters for relocalization and mapping (v2)");
+
+    SolAR::datastructure::RectificationParameters solarCam1RectParams, solarCam2RectParams;
+    auto status = toSolAR(request->cam1(), solarCam1RectParams);
+    if (status.ok())
+        status = toSolAR(request->cam2(), solarCam2RectParams);
+    if (!status.ok())
+        return status;
+
+    LOG_DEBUG("Camera 1:\n   rotation:\n{}\n   projection:\n{}\n   baseline: {}",
+              solarCam1RectParams.rotation, solarCam1RectParams.projection, solarCam1RectParams.baseline);
+    LOG_DEBUG("Camera 2:\n   rotation:\n{}\n   projection:\n{}\n   baseline: {}",
+              solarCam2RectParams.rotation, solarCam2RectParams.projection, solarCam2RectParams.baseline);
+
+    status = m_service.setRectificationParametersInternal(request->client_uuid(), solarCam1RectParams, solarCam2RectParams);
+    if (!status.ok())
+        return status;
+
+    LOG_DEBUG("Set camera rectification parameters for relocalization and mapping OK");
+
+    return Status::OK;
+}
+
+ServerUnaryReactor*
+RelocalizationAndMappingGrpcServiceImplV2::RelocalizeAndMap(CallbackServerContext* context,
+                                                            const v2::Frames* request,
+                                                            v2::RelocalizationResult* response)
+{
+    ServerUnaryReactor* reactor = context->DefaultReactor();
+
+    // Request and response live on the call arena until the reactor is finished, or
+    // until the frames kept waiting for the front end are done with the request
+    bool submitted = m_service.m_workerPool.trySubmit([this, context, request, response, reactor,
+                                                       receivedTime = std::chrono::steady_clock::now()]() {
+        ReceivedFrames frames;
+        auto status = toReceivedFrames(*request, frames);
+        if (!status.ok()) {
+            reactor->Finish(status);
+            return;
+        }
+        frames.receivedTime = receivedTime;
+        frames.owner = RetainableMessages::retain(context->GetRpcAllocatorState());
+
+        m_service.RelocalizeAndMapInternal(request->client_uuid(), frames,
+                                           RelocalizationAndMappingGrpcServiceImpl::nullTransform(),
+                                           /* fixedpose = */ false,
+                                           [response, reactor](const grpc::Status& status, const PoseResult& result) {
+                                               toGrpc(result, *response);
+                                               reactor->Finish(status);
+                                           });
+    });
+
+    if (!submitted) {
+        LOG_WARNING("Too many frames waiting to be processed: drop frames");
+        m_service.countRejected(request->client_uuid());
+        reactor->Finish(RelocalizationAndMappingGrpcServiceImpl::gRpcError("Too many frames waiting to be processed: drop frames",
+                                                                           grpc::StatusCode::RESOURCE_EXHAUSTED));
+    }
+
+    return reactor;
+}
+
+ServerUnaryReactor*
+RelocalizationAndMappingGrpcServiceImplV2::RelocalizeAndMapGroundTruth(CallbackServerContext* context,
+                                                                       const v2::GroundTruthFrames* request,
+                                                                       v2::RelocalizationResult* response)
+{
+    ServerUnaryReactor* reactor = context->DefaultReactor();
+
+    // Request and response live on the call arena until the reactor is finished, or
+    // until the frames kept waiting for the front end are done with the request
+    bool submitted = m_service.m_workerPool.trySubmit([this, context, request, response, reactor,
+                                                       receivedTime = std::chrono::steady_clock::now()]() {
+        ReceivedFrames frames;
+        auto status = toReceivedFrames(request->frames(), frames);
+        if (!status.ok()) {
+            reactor->Finish(status);
+            return;
+        }
+        frames.receivedTime = receivedTime;
+        frames.owner = RetainableMessages::retain(context->GetRpcAllocatorState());
+
+        SolAR::datastructure::Transform3Df worldTransform;
+        if (!toSolAR(request->world_transform(), worldTransform.matrix())) {
+            reactor->Finish(RelocalizationAndMappingGrpcServiceImpl::gRpcError("Invalid world transform: 16 values expected",
+                                                                               grpc::StatusCode::INVALID_ARGUMENT));
+            return;
+        }
+
+        m_service.RelocalizeAndMapInternal(request->client_uuid(), frames, worldTransform, request->fixed_pose(),
+                                           [response, reactor](const grpc::Status& status, const PoseResult& result) {
+                                               toGrpc(result, *response);
+                                               reactor->Finish(status);
+                                           });
+    });
+
+    if (!submitted) {
+        LOG_WARNING("Too many frames waiting to be processed: drop frames");
+        m_service.countRejected(request->client_uuid());
+        reactor->Finish(RelocalizationAndMappingGrpcServiceImpl::gRpcError("Too many frames waiting to be processed: drop frames",
+                                                                           grpc::StatusCode::RESOURCE_EXHAUSTED));
+    }
+
+    return reactor;
+}
+
+ServerBidiReactor<v2::Frames, v2::RelocalizationResult>*
+RelocalizationAndMappingGrpcServiceImplV2::RelocalizeAndMapStream(CallbackServerContext* context)
+{
+    return new RelocalizationAndMappingGrpcServiceImpl::RelocalizeAndMapStreamReactor<RelocalizationAndMappingGrpcServiceImplV2>(
+                &m_service, context);
+}
+
+ServerUnaryReactor*
+RelocalizationAndMappingGrpcServiceImplV2::RelocalizeAndMapBatch(CallbackServerContext* context,
+                                                                 const v2::FramesBatch* request,
+                                                                 v2::RelocalizationResults* response)
+{
+    ServerUnaryReactor* reactor = context->DefaultReactor();
+
+    // Request and response live on the call arena until the reactor is finished, or
+    // until the frames kept waiting for the front end are done with the request
+    bool submitted = m_service.m_workerPool.trySubmit([this, context, request, response, reactor,
+                                                       receivedTime = std::chrono::steady_clock::now()]() {
+        std::shared_ptr<const void> owner = RetainableMessages::retain(context->GetRpcAllocatorState());
+        std::vector<ReceivedFrames> frames(request->frames_size());
+        for (int i = 0; i < request->frames_size(); i++) {
+            auto status = toReceivedFrames(request->frames(i), frames[i]);
+            if (!status.ok()) {
+                reactor->Finish(status);
+                return;
+            }
+            frames[i].receivedTime = receivedTime;
+            frames[i].owner = owner;
+        }
+
+        m_service.RelocalizeAndMapBatchInternal(request->client_uuid(), frames, request->last_result_only(),
+                                                [response, reactor](const grpc::Status& status,
+                                                                    std::vector<PoseResult>& results) {
+                                                    for (const PoseResult& result : results)
+                                                        toGrpc(result, *response->add_results());
+                                                    reactor->Finish(status);
+                                                });
+    });
+
+    if (!submitted) {
+        LOG_WARNING("Too many frames waiting to be processed: drop frames");
+        m_service.countRejected(request->client_uuid());
+        reactor->Finish(RelocalizationAndMappingGrpcServiceImpl::gRpcError("Too many frames waiting to be processed: drop frames",
+                                                                           grpc::StatusCode::RESOURCE_EXHAUSTED));
+    }
+
+    return reactor;
+}
+
+grpc::Status
+RelocalizationAndMappingGrpcServiceImplV2::Get3DTransform(grpc::ServerContext* context,
+                                                          const ClientUUID* request,
+                                                          v2::RelocalizationResult* response)
+{
+    LOG_DEBUG("Get3DTransform (v2)");
+
+    // Get context for current client
+    SRef<ProxyClientContext> clientContext = m_service.getClientContext(request->client_uuid());
+    if (clientContext == nullptr) {
+        LOG_ERROR("Unknown client with UUID: {}", request->client_uuid());
+        return RelocalizationAndMappingGrpcServiceImpl::gRpcError("Unknown client UUID");
+    }
+
+    // Last result of the front end, without waiting for the frames being processed
+    toGrpc(RelocalizationAndMappingGrpcServiceImpl::latestResult(*clientContext), *response);
+
+    return Status::OK;
+}
+
+ServerWriteReactor<v2::RelocalizationResult>*
+RelocalizationAndMappingGrpcServiceImplV2::SubscribeTransforms(CallbackServerContext* context,
+                                                               const ClientUUID* request)
+{
+    return new RelocalizationAndMappingGrpcServiceImpl::SubscribeTransformsReactor<RelocalizationAndMappingGrpcServiceImplV2>(
+                m_service.getClientContext(request->client_uuid()), request->client_uuid());
+}
+
+grpc::Status
+RelocalizationAndMappingGrpcServiceImplV2::GetStats(grpc::ServerContext* context,
+                                                    const ClientUUID* request,
+                                                    ProxyStatsResult* response)
+{
+    return m_service.GetStats(context, request, response);
+}
+
+grpc::Status
+RelocalizationAndMappingGrpcServiceImplV2::Reset(grpc::ServerContext *context,
+                                                 const Empty* request,
+                                                 Empty *response)
+{
+    return m_service.Reset(context, request, response);
+}
+
+grpc::Status
+RelocalizationAndMappingGrpcServiceImplV2::SendMessage(grpc::ServerContext* context,
+                                                       const Message* request,
+                                                       Empty* response)
+{
+    return m_service.SendMessage(context, request, response);
+}
+
+grpc::Status
+RelocalizationAndMappingGrpcServiceImplV2::toReceivedFrames(const v2::Frames& request, ReceivedFrames& frames)
+{
+    frames.nbFrames = request.frames_size();
+    for (int i = 0; (i < request.frames_size()) && (i < static_cast<int>(frames.frames.size())); i++) {
+        const v2::Frame& frame = request.frames(i);
+        ReceivedFrame& receivedFrame = frames.frames[i];
+        receivedFrame.sensorId = frame.sensor_id();
+        receivedFrame.timestamp = frame.timestamp();
+        receivedFrame.image = frame.has_image() ? &frame.image() : nullptr;
+        if (!toSolAR(frame.pose(), receivedFrame.pose.matrix()))
+            return RelocalizationAndMappingGrpcServiceImpl::gRpcError("Invalid frame pose: 16 values expected",
+                                                                      grpc::StatusCode::INVALID_ARGUMENT);
+    }
+
+    return Status::OK;
+}
+
+void
+RelocalizationAndMappingGrpcServiceImplV2::toGrpc(const PoseResult& result, v2::RelocalizationResult& response)
+{
+    response.set_timestamp(result.timestamp);
+    response.set_confidence(result.confidence);
+    response.set_pose_status(static_cast<RelocalizationPoseStatus>(result.poseStatus));
+    response.set_mapping_status(static_cast<MappingStatus>(result.mappingStatus));
+
+    // No result yet: no pose
+    if (result.timestamp == 0) {
+        response.clear_pose();
+        return;
+    }
+
+    // Same layout as the result (column major): one copy
+    google::protobuf::RepeatedField<float>& pose = *response.mutable_pose();
+    pose.Resize(16, 0.f);
+    std::copy(result.pose, result.pose + 16, pose.mutable_data());
+}
+
+template <class Matrix>
+bool
+RelocalizationAndMappingGrpcServiceImplV2::toSolAR(const google::protobuf::RepeatedField<float>& values, Matrix& matrix)
+{
+    if (values.empty()) {
+        matrix.setZero();
+        return true;
+    }
+
+    if (values.size() != Matrix::SizeAtCompileTime)
+        return false;
+
+    matrix = Eigen::Map<const Eigen::Matrix<float, Matrix::RowsAtCompileTime, Matrix::ColsAtCompileTime>>(values.data());
+    return true;
+}
+
+grpc::Status
+RelocalizationAndMappingGrpcServiceImplV2::toSolAR(const v2::Camera& camera,
+                                                   SolAR::datastructure::CameraParameters& cameraParameters)
+{
+    cameraParameters.name = camera.name();
+    cameraParameters.id = camera.id();
+    cameraParameters.type = RelocalizationAndMappingGrpcServiceImpl::toSolAR(camera.camera_type());
+    cameraParameters.resolution.width = camera.width();
+    cameraParameters.resolution.height = camera.height();
+
+    if (!toSolAR(camera.intrinsics(), cameraParameters.intrinsic)
+        || !toSolAR(camera.distortion(), cameraParameters.distortion))
+        return RelocalizationAndMappingGrpcServiceImpl::gRpcError("Invalid camera parameters: 9 intrinsics and 5 distortion values expected",
+                                                                  grpc::StatusCode::INVALID_ARGUMENT);
+
+    return Status::OK;
+}
+
+grpc::Status
+RelocalizationAndMappingGrpcServiceImplV2::toSolAR(const v2::Rectification& rectification,
+                                                   SolAR::datastructure::RectificationParameters& rectificationParameters)
+{
+    rectificationParameters.type = RelocalizationAndMappingGrpcServiceImpl::toSolAR(rectification.stereo_type());
+    rectificationParameters.baseline = rectification.baseline();
+
+    if (!toSolAR(rectification.rotation(), rectificationParameters.rotation)
+        || !toSolAR(rectification.projection(), rectificationParameters.projection))
+        return RelocalizationAndMappingGrpcServiceImpl::gRpcError("Invalid rectification parameters: 9 rotation and 12 projection values expected",
+                                                                  grpc::StatusCode::INVALID_ARGUMENT);
+
+    return Status::OK;
+}
+
+RecordingCamera
+RelocalizationAndMappingGrpcServiceImplV2::toRecording(uint32_t sensorId, const v2::Camera& camera)
+{
+    // Recorded as with version 1: intrinsics row major
+    RecordingCamera recordingCamera = {};
+    recordingCamera.sensorId = sensorId;
+    recordingCamera.cameraType = static_cast<uint32_t>(camera.camera_type());
+    recordingCamera.width = camera.width();
+    recordingCamera.height = camera.height();
+    if (camera.intrinsics_size() == 9)
+        Eigen::Map<Eigen::Matrix<float, 3, 3, Eigen::RowMajor>>(recordingCamera.intrinsics)
+                = Eigen::Map<const Eigen::Matrix3f>(camera.intrinsics().data());
+    if (camera.distortion_size() == 5)
+        std::copy(camera.distortion().begin(), camera.distortion().end(), recordingCamera.distortion);
+    recordingCamera.rotation = static_cast<uint32_t>(camera.rotation());
+    return recordingCamera;
+}
+
+} // namespace com::bcom::solar::gprc
@@ -0,0 +1,149 @@
+/**
+ * @copyright Copyright (c) 2021 B-com http://www.b-com.com/
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef RELOCALIZATION_AND_MAPPING_GRPC_SERVICE_IMPL_V2
+#define RELOCALIZATION_AND_MAPPING_GRPC_SERVICE_IMPL_V2
+
+#include "grpc/solar_mapping_and_relocalization_proxy_v2.grpc.pb.h"
+#include "RelocalizationAndMappingGrpcServiceImpl.h"
+
+namespace com::bcom::solar::gprc
+{
+
+// Same callback methods as version 1
+typedef v2::SolARMappingAndRelocalizationProxy::ExperimentalWithCallbackMethod_RelocalizeAndMap<
+            v2::SolARMappingAndRelocalizationProxy::ExperimentalWithCallbackMethod_RelocalizeAndMapGroundTruth<
+                v2::SolARMappingAndRelocalizationProxy::ExperimentalWithCallbackMethod_RelocalizeAndMapStream<
+                    v2::SolARMappingAndRelocalizationProxy::ExperimentalWithCallbackMethod_RelocalizeAndMapBatch<
+                        v2::SolARMappingAndRelocalizationProxy::ExperimentalWithCallbackMethod_SubscribeTransforms<
+                            v2::SolARMappingAndRelocalizationProxy::Service>>>>> RelocalizationAndMappingServiceV2;
+
+/**
+ * @class RelocalizationAndMappingGrpcServiceImplV2
+ * @brief Version 2 of the proxy API: matrices packed in column major order
+ *
+ * Served side by side with version 1, on the same port. Calls are processed
+ * by the version 1 service: both versions share the clients (a client can be
+ * registered with one version and send frames with the other one) and the
+ * frames processing. Only the conversions of the messages differ: packed
+ * matrices are read with Eigen::Map and poses written with one copy, instead
+ * of one accessor for each coefficient.
+ */
+class RelocalizationAndMappingGrpcServiceImplV2
+    final : public RelocalizationAndMappingServiceV2
+{
+
+public:
+    explicit RelocalizationAndMappingGrpcServiceImplV2(RelocalizationAndMappingGrpcServiceImpl& service);
+
+    ~RelocalizationAndMappingGrpcServiceImplV2() override = default;
+
+public:
+    grpc::Status RegisterClient(grpc::ServerContext* context,
+                                const Empty* request,
+                                ClientUUID* response)  override;
+
+    grpc::Status UnregisterClient(grpc::ServerContext* context,
+                                  const ClientUUID* request,
+                                  Empty* response)  override;
+
+    grpc::Status Init(grpc::ServerContext* context,
+                      const PipelineModeValue* request,
+                      Empty* response)  override;
+
+    grpc::Status Start(grpc::ServerContext* context,
+                       const ClientUUID* request,
+                       Empty* response)  override;
+
+    grpc::Status Stop(grpc::ServerContext* context,
+                      const ClientUUID* request,
+                      Empty* response)  override;
+
+    grpc::Status SetCameraParameters(grpc::ServerContext* context,
+                                     const v2::CameraParameters* request,
+                                     Empty* response)  override;
+
+    grpc::Status SetCameraParametersStereo(grpc::ServerContext* context,
+                                           const v2::CameraParametersStereo* request,
+                                           Empty* response)  override;
+
+    grpc::Status SetRectificationParameters(grpc::ServerContext* context,
+                                            const v2::RectificationParameters* request,
+                                            Empty* response)  override;
+
+    ServerUnaryReactor* RelocalizeAndMap(CallbackServerContext* context,
+                                         const v2::Frames* request,
+                                         v2::RelocalizationResult* response)  override;
+
+    ServerUnaryReactor* RelocalizeAndMapGroundTruth(CallbackServerContext* context,
+                                                    const v2::GroundTruthFrames* request,
+                                                    v2::RelocalizationResult* response)  override;
+
+    ServerBidiReactor<v2::Frames, v2::RelocalizationResult>* RelocalizeAndMapStream(CallbackServerContext* context)  override;
+
+    ServerUnaryReactor* RelocalizeAndMapBatch(CallbackServerContext* context,
+                                              const v2::FramesBatch* request,
+                                              v2::RelocalizationResults* response)  override;
+
+    grpc::Status Get3DTransform(grpc::ServerContext* context,
+                                const ClientUUID* request,
+                                v2::RelocalizationResult* response)  override;
+
+    ServerWriteReactor<v2::RelocalizationResult>* SubscribeTransforms(CallbackServerContext* context,
+                                                                      const ClientUUID* request)  override;
+
+    grpc::Status GetStats(grpc::ServerContext* context,
+                          const ClientUUID* request,
+                          ProxyStatsResult* response)  override;
+
+    grpc::Status Reset(grpc::ServerContext *context,
+                       const Empty* request,
+                       Empty *response) override;
+
+    grpc::Status SendMessage(grpc::ServerContext* context,
+                             const Message* request,
+                             Empty* response) override;
+
+    // Messages of this version of the API, and their conversions (used by the reactors)
+    typedef v2::Frames FramesMessage;
+    typedef v2::RelocalizationResult ResultMessage;
+    static grpc::Status toReceivedFrames(const v2::Frames& request, ReceivedFrames& frames);
+    static void toGrpc(const PoseResult& result, v2::RelocalizationResult& response);
+
+private:
+
+    /// @brief Read a packed matrix, column major (empty: all coefficients null)
+    /// @return false if the number of values does not match the matrix
+    template <class Matrix>
+    static bool toSolAR(const google::protobuf::RepeatedField<float>& values, Matrix& matrix);
+
+    static grpc::Status toSolAR(const v2::Camera& camera, SolAR::datastructure::CameraParameters& cameraParameters);
+    static grpc::Status toSolAR(const v2::Rectification& rectification,
+                                SolAR::datastructure::RectificationParameters& rectificationParameters);
+    static RecordingCamera toRecording(uint32_t sensorId, const v2::Camera& camera);
+
+    // Service of version 1, processing the calls
+    RelocalizationAndMappingGrpcServiceImpl& m_service;
+
+    // Per-call arenas for the frames requests and their results
+    ArenaMessageAllocator<v2::Frames, v2::RelocalizationResult> m_framesAllocator;
+    ArenaMessageAllocator<v2::GroundTruthFrames, v2::RelocalizationResult> m_groundTruthFramesAllocator;
+    ArenaMessageAllocator<v2::FramesBatch, v2::RelocalizationResults> m_framesBatchAllocator;
+};
+
+} // namespace com::bcom::solar::gprc
+
+#endif // RELOCALIZATION_AND_MAPPING_GRPC_SERVICE_IMPL_V2
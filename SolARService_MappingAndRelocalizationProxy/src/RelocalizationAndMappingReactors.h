@@ -0,0 +1,270 @@
+/**
+ * @copyright Copyright (c) 2021 B-com http://www.b-com.com/
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef RELOCALIZATION_AND_MAPPING_REACTORS_H
+#define RELOCALIZATION_AND_MAPPING_REACTORS_H
+
+#include "RelocalizationAndMappingGrpcServiceImpl.h"
+
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include <core/Log.h>
+
+// Reactors of the streaming calls, shared by the versions of the API.
+// Api is the service of a version: it gives the messages (FramesMessage,
+// ResultMessage) and their conversions (toReceivedFrames, toGrpc).
+
+namespace com::bcom::solar::gprc
+{
+
+/**
+ * @class RelocalizationAndMappingGrpcServiceImpl::RelocalizeAndMapStreamReactor
+ * @brief Reads the frames of a stream one at a time and writes back the results
+ *
+ * Only one operation (read, processing or write) is pending at a time.
+ * Processing is done by the worker pool: no thread is held between two frames
+ * or while a frame waits for the front end.
+ * The frames waiting for the front end share the ownership of their request
+ * message: the next frames are read in a new message while it is retained.
+ */
+template <class Api>
+class RelocalizationAndMappingGrpcServiceImpl::RelocalizeAndMapStreamReactor
+    : public ServerBidiReactor<typename Api::FramesMessage, typename Api::ResultMessage>
+{
+    public:
+        RelocalizeAndMapStreamReactor(RelocalizationAndMappingGrpcServiceImpl* service,
+                                      CallbackServerContext* context)
+            : m_service{service}, m_context{context}, m_request{std::make_shared<typename Api::FramesMessage>()}
+        {
+            LOG_INFO("Start relocalization and mapping stream");
+            this->StartRead(m_request.get());
+        }
+
+        void OnReadDone(bool ok) override
+        {
+            if (!ok) {
+                LOG_INFO("End of relocalization and mapping stream");
+                this->Finish(grpc::Status::OK);
+                return;
+            }
+
+            m_receivedTime = std::chrono::steady_clock::now();
+            if (!m_service->m_workerPool.trySubmit([this]() { process(); })) {
+                LOG_WARNING("Too many frames waiting to be processed: stop stream");
+                m_service->countRejected(m_request->client_uuid());
+                this->Finish(gRpcError("Too many frames waiting to be processed", grpc::StatusCode::RESOURCE_EXHAUSTED));
+            }
+        }
+
+        void OnWriteDone(bool ok) override
+        {
+            if (!ok) {
+                LOG_INFO("Relocalization and mapping stream closed by client");
+                this->Finish(grpc::Status::OK);
+                return;
+            }
+            startRead();
+        }
+
+        void OnDone() override
+        {
+            delete this;
+        }
+
+    private:
+        // Frames go through the same reorder buffer and pipeline as with RelocalizeAndMap:
+        // a result is sent back only when a frame has been processed
+        void process()
+        {
+            ReceivedFrames frames;
+            auto status = Api::toReceivedFrames(*m_request, frames);
+            if (!status.ok()) {
+                onProcessed(status, PoseResult{});
+                return;
+            }
+            frames.receivedTime = m_receivedTime;
+            frames.owner = m_request;
+
+            m_service->RelocalizeAndMapInternal(m_request->client_uuid(), frames, nullTransform(),
+                                                /* fixedpose = */ false,
+                                                [this](const grpc::Status& status, const PoseResult& result) {
+                                                    onProcessed(status, result);
+                                                });
+        }
+
+        void onProcessed(const grpc::Status& status, const PoseResult& result)
+        {
+            if (!status.ok()) {
+                LOG_ERROR("Relocalization and mapping stream stopped on error");
+                this->Finish(status);
+                return;
+            }
+
+            // Frames answered with the last result (client over budget): result already written
+            if (result.timestamp > m_lastWrittenTimestamp) {
+                m_lastWrittenTimestamp = result.timestamp;
+                m_response.Clear();
+                Api::toGrpc(result, m_response);
+                this->StartWrite(&m_response);
+            }
+            else
+                startRead();
+        }
+
+        void startRead()
+        {
+            // Request still read by frames waiting for the front end: not overwritten
+            if (m_request.use_count() > 1)
+                m_request = std::make_shared<typename Api::FramesMessage>();
+            this->StartRead(m_request.get());
+        }
+
+        RelocalizationAndMappingGrpcServiceImpl* m_service;
+        CallbackServerContext* m_context;
+        std::shared_ptr<typename Api::FramesMessage> m_request;    // Shared with the frames waiting for the front end
+        typename Api::ResultMessage m_response;
+        uint64_t m_lastWrittenTimestamp = 0;
+        std::chrono::steady_clock::time_point m_receivedTime;  // Reception of the frames being processed
+};
+
+/**
+ * @class RelocalizationAndMappingGrpcServiceImpl::SubscribeTransformsReactor
+ * @brief Writes the results of a client each time its transform changes
+ *
+ * Results are published by the client strand (no polling). Only one write is
+ * pending at a time: a result published meanwhile replaces the unwritten one,
+ * so a slow subscriber receives the latest result and never delays the
+ * client nor the other subscribers. No thread is held between two results.
+ * gRPC never calls OnDone from Finish or StartWrite: both can be called under
+ * the subscribers mutex of the client.
+ */
+template <class Api>
+class RelocalizationAndMappingGrpcServiceImpl::SubscribeTransformsReactor
+    : public ServerWriteReactor<typename Api::ResultMessage>, public TransformSubscriber
+{
+    public:
+        SubscribeTransformsReactor(SRef<ProxyClientContext> clientContext, const std::string& clientUUID)
+            : m_clientContext{std::move(clientContext)}, m_clientUUID{clientUUID}
+        {
+            if (m_clientContext == nullptr) {
+                LOG_ERROR("Unknown client with UUID: {}", m_clientUUID);
+                m_finished = true;
+                this->Finish(gRpcError("Unknown client UUID"));
+                return;
+            }
+
+            // The last result is sent first: a result set meanwhile is published after it
+            std::unique_lock<std::mutex> lock(m_clientContext->m_subscribersMutex);
+            if (m_clientContext->m_subscriptionsClosed) {
+                LOG_ERROR("Unknown client with UUID: {}", m_clientUUID);
+                m_finished = true;
+                this->Finish(gRpcError("Unknown client UUID"));
+                return;
+            }
+
+            LOG_INFO("[{}] Start transforms subscription", m_clientUUID);
+            m_clientContext->m_subscribers.push_back(this);
+            publish(m_clientContext->m_lastResult.load());
+        }
+
+        void publish(const PoseResult& result) override
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            if (m_finished)
+                return;
+
+            m_nextResult = result;
+            m_hasNextResult = true;
+            if (!m_writing)
+                startWrite();
+        }
+
+        void close() override
+        {
+            finish(grpc::Status::OK);
+        }
+
+        void OnWriteDone(bool ok) override
+        {
+            if (!ok) {
+                LOG_INFO("[{}] Transforms subscription closed by client", m_clientUUID);
+                finish(grpc::Status::OK);
+                return;
+            }
+
+            std::unique_lock<std::mutex> lock(m_mutex);
+            if (m_hasNextResult && !m_finished)
+                startWrite();
+            else
+                m_writing = false;
+        }
+
+        void OnCancel() override
+        {
+            finish(grpc::Status::CANCELLED);
+        }
+
+        void OnDone() override
+        {
+            if (m_clientContext != nullptr) {
+                std::unique_lock<std::mutex> lock(m_clientContext->m_subscribersMutex);
+                auto& subscribers = m_clientContext->m_subscribers;
+                subscribers.erase(std::remove(subscribers.begin(), subscribers.end(), this), subscribers.end());
+                LOG_INFO("[{}] End of transforms subscription", m_clientUUID);
+            }
+            delete this;
+        }
+
+    private:
+        // Called under m_mutex
+        void startWrite()
+        {
+            m_writing = true;
+            m_hasNextResult = false;
+            m_response.Clear();
+            Api::toGrpc(m_nextResult, m_response);
+            this->StartWrite(&m_response);
+        }
+
+        void finish(const grpc::Status& status)
+        {
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                if (m_finished)
+                    return;
+                m_finished = true;
+            }
+            this->Finish(status);
+        }
+
+        SRef<ProxyClientContext> m_clientContext;
+        std::string m_clientUUID;
+
+        std::mutex m_mutex;
+        bool m_writing = false;             // A write is pending (m_response in use)
+        bool m_hasNextResult = false;       // m_nextResult not written yet
+        bool m_finished = false;            // Finish called: no more writes
+        PoseResult m_nextResult;
+        typename Api::ResultMessage m_response;
+};
+
+} // namespace com::bcom::solar::gprc
+
+#endif // RELOCALIZATION_AND_MAPPING_REACTORS_H
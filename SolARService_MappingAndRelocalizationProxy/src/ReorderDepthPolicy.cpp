@@ -0,0 +1,122 @@
+/**
+ * @copyright Copyright (c) 2021 B-com http://www.b-com.com/
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ReorderDepthPolicy.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace com::bcom::solar::gprc
+{
+
+// Weight of a new sample in the mean values
+#define REORDER_EWMA_WEIGHT 0.0625f
+// Number of frames without lateness before the depth is decreased by one frame
+#define REORDER_DECAY_FRAMES 90
+
+ReorderDepthPolicy::ReorderDepthPolicy(unsigned int maxDepth, unsigned int maxLatencyMs)
+    : m_maxDepth{maxDepth}, m_maxLatencyMs{maxLatencyMs}
+{
+}
+
+void ReorderDepthPolicy::onFrame(long timestamp, Clock::time_point arrival)
+{
+    if (m_firstFrame) {
+        m_firstFrame = false;
+        m_newestTimestamp = timestamp;
+        m_lastTimestamp = timestamp;
+        m_lastArrival = arrival;
+        return;
+    }
+
+    unsigned int lateness = 0;
+
+    if (timestamp > m_newestTimestamp) {
+        // In order: update frame period and jitter (RFC 3550 interarrival jitter)
+        float timestampDeltaMs = static_cast<float>(timestamp - m_newestTimestamp);
+        if (m_framePeriodMs == 0)
+            m_framePeriodMs = timestampDeltaMs;
+        else
+            m_framePeriodMs += REORDER_EWMA_WEIGHT * (timestampDeltaMs - m_framePeriodMs);
+
+        // Jitter is measured between consecutive frames received in order
+        if (m_lastTimestamp == m_newestTimestamp) {
+            float arrivalDeltaMs = std::chrono::duration<float, std::milli>(arrival - m_lastArrival).count();
+            m_jitterMs += REORDER_EWMA_WEIGHT * (std::fabs(arrivalDeltaMs - timestampDeltaMs) - m_jitterMs);
+        }
+
+        m_newestTimestamp = timestamp;
+        m_outOfOrderRate -= REORDER_EWMA_WEIGHT * m_outOfOrderRate;
+    }
+    else {
+        // Late: number of newer frames received before this one
+        if (m_framePeriodMs > 0)
+            lateness = static_cast<unsigned int>(std::lround((m_newestTimestamp - timestamp) / m_framePeriodMs));
+        lateness = std::max(1u, lateness);
+        m_outOfOrderRate += REORDER_EWMA_WEIGHT * (1.f - m_outOfOrderRate);
+    }
+
+    m_lastTimestamp = timestamp;
+    m_lastArrival = arrival;
+
+    updateDepth(lateness);
+}
+
+void ReorderDepthPolicy::updateDepth(unsigned int lateness)
+{
+    if (lateness >= m_peakLateness) {
+        m_peakLateness = lateness;
+        m_framesSinceLateness = 0;
+    }
+    else if (++m_framesSinceLateness >= REORDER_DECAY_FRAMES) {
+        m_peakLateness--;
+        m_framesSinceLateness = 0;
+    }
+
+    unsigned int depth = m_peakLateness;
+    if ((m_framePeriodMs > 0) && (m_jitterMs * 2 >= m_framePeriodMs))
+        depth++;
+
+    // Latency budget
+    unsigned int maxDepth = m_maxDepth;
+    if (m_framePeriodMs > 0)
+        maxDepth = std::min(maxDepth, static_cast<unsigned int>(m_maxLatencyMs / m_framePeriodMs));
+
+    m_depth = std::min(depth, maxDepth);
+}
+
+void ReorderDepthPolicy::reset()
+{
+    m_depth = 0;
+    m_peakLateness = 0;
+    m_framesSinceLateness = 0;
+    m_firstFrame = true;
+    m_framePeriodMs = 0;
+    m_jitterMs = 0;
+    m_outOfOrderRate = 0;
+}
+
+ReorderStats ReorderDepthPolicy::stats() const
+{
+    ReorderStats stats;
+    stats.depth = m_depth;
+    stats.outOfOrderRate = m_outOfOrderRate;
+    stats.jitterMs = m_jitterMs;
+    stats.framePeriodMs = m_framePeriodMs;
+    return stats;
+}
+
+} // namespace com::bcom::solar::gprc
@@ -0,0 +1,91 @@
+/**
+ * @copyright Copyright (c) 2021 B-com http://www.b-com.com/
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef REORDER_DEPTH_POLICY_H
+#define REORDER_DEPTH_POLICY_H
+
+#include <chrono>
+
+namespace com::bcom::solar::gprc
+{
+
+/**
+ * @struct ReorderStats
+ * @brief Reorder buffer state of a client, for monitoring
+ */
+struct ReorderStats
+{
+    unsigned int depth = 0;         // Number of frames currently held back
+    float outOfOrderRate = 0;       // Mean rate of frames received after a newer one
+    float jitterMs = 0;             // Mean arrival jitter
+    float framePeriodMs = 0;        // Mean period between two frames (timestamps)
+};
+
+/**
+ * @class ReorderDepthPolicy
+ * @brief Adaptive depth of the reorder buffer of a client
+ *
+ * Frames arriving in order with a regular rate are forwarded without delay
+ * (depth 0). The depth grows to the lateness (in frames) of the late frames,
+ * plus one frame when the arrival jitter reaches half a frame period, and
+ * decreases by one frame after a period without lateness.
+ * The depth is bounded by a maximum number of frames and a maximum latency.
+ * Not thread safe: used under the client context mutex.
+ */
+class ReorderDepthPolicy
+{
+    public:
+        typedef std::chrono::steady_clock Clock;
+
+        /// @param[in] maxDepth: maximum number of frames held back
+        /// @param[in] maxLatencyMs: maximum delay added by the reorder buffer (milliseconds)
+        ReorderDepthPolicy(unsigned int maxDepth, unsigned int maxLatencyMs);
+
+        /// @brief Update the statistics with a received frame
+        /// @param[in] timestamp: frame timestamp (milliseconds)
+        /// @param[in] arrival: time of arrival of the frame on the proxy
+        void onFrame(long timestamp, Clock::time_point arrival = Clock::now());
+
+        /// @brief Number of frames to hold back in the reorder buffer
+        unsigned int depth() const { return m_depth; }
+
+        /// @brief Restart from the initial state (client restarted)
+        void reset();
+
+        ReorderStats stats() const;
+
+    private:
+        void updateDepth(unsigned int lateness);
+
+        unsigned int m_maxDepth;
+        unsigned int m_maxLatencyMs;
+
+        unsigned int m_depth = 0;
+        unsigned int m_peakLateness = 0;            // Highest lateness (frames) not yet decayed
+        unsigned int m_framesSinceLateness = 0;     // Frames received since the peak lateness was last observed
+
+        bool m_firstFrame = true;
+        long m_newestTimestamp = 0;
+        long m_lastTimestamp = 0;
+        Clock::time_point m_lastArrival;
+        float m_framePeriodMs = 0;
+        float m_jitterMs = 0;
+        float m_outOfOrderRate = 0;
+};
+
+} // namespace com::bcom::solar::gprc
+
+#endif // REORDER_DEPTH_POLICY_H
@@ -0,0 +1,96 @@
+/**
+ * @copyright Copyright (c) 2021 B-com http://www.b-com.com/
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef SEQ_LOCK_H
+#define SEQ_LOCK_H
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+
+namespace com::bcom::solar::gprc
+{
+
+/**
+ * @class SeqLock
+ * @brief Small value written from time to time and read very often, without lock for the readers
+ *
+ * Readers copy the value, then check that the sequence number did not change
+ * during the copy (retried otherwise): they never block the writers nor each
+ * other. The value is stored in atomic words, so concurrent copies are not
+ * data races. Writers are serialized by a mutex.
+ * T must be trivially copyable, with a size multiple of 4 bytes.
+ * Thread safe.
+ */
+template <class T>
+class SeqLock
+{
+    static_assert(std::is_trivially_copyable<T>::value, "SeqLock value must be trivially copyable");
+    static_assert(sizeof(T) % sizeof(uint32_t) == 0, "SeqLock value size must be a multiple of 4 bytes");
+
+    public:
+        SeqLock() { store(T{}); }
+
+        void store(const T& value)
+        {
+            std::array<uint32_t, NB_WORDS> words;
+            std::memcpy(words.data(), &value, sizeof(T));
+
+            std::unique_lock<std::mutex> lock(m_writeMutex);
+            uint32_t sequence = m_sequence.load(std::memory_order_relaxed);
+            // Odd sequence: write in progress
+            m_sequence.store(sequence + 1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+            for (size_t i = 0; i < NB_WORDS; i++)
+                m_words[i].store(words[i], std::memory_order_relaxed);
+            m_sequence.store(sequence + 2, std::memory_order_release);
+        }
+
+        T load() const
+        {
+            std::array<uint32_t, NB_WORDS> words;
+            for (;;) {
+                uint32_t sequence = m_sequence.load(std::memory_order_acquire);
+                if ((sequence & 1) == 0) {
+                    for (size_t i = 0; i < NB_WORDS; i++)
+                        words[i] = m_words[i].load(std::memory_order_relaxed);
+                    std::atomic_thread_fence(std::memory_order_acquire);
+                    if (m_sequence.load(std::memory_order_relaxed) == sequence)
+                        break;
+                }
+                std::this_thread::yield();
+            }
+
+            T value;
+            std::memcpy(static_cast<void*>(&value), words.data(), sizeof(T));
+            return value;
+        }
+
+    private:
+        static constexpr size_t NB_WORDS = sizeof(T) / sizeof(uint32_t);
+
+        std::mutex m_writeMutex;
+        std::atomic<uint32_t> m_sequence{0};
+        std::array<std::atomic<uint32_t>, NB_WORDS> m_words{};
+};
+
+} // namespace com::bcom::solar::gprc
+
+#endif // SEQ_LOCK_H
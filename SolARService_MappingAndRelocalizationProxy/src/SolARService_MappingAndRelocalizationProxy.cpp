@@ -15,7 +15,10 @@
  */
 
 #include "RelocalizationAndMappingGrpcServiceImpl.h"
+#include "RelocalizationAndMappingGrpcServiceImplV2.h"
+#include "ImageConversion.h"
 
+#include <algorithm>
 #include <iostream>
 #include <signal.h>
 
@@ -26,6 +29,7 @@
 // #include <grpcpp/ext/proto_server_reflection_plugin.h>
 #include <grpcpp/grpcpp.h>
 #include <grpcpp/health_check_service_interface.h>
+#include <grpcpp/resource_quota.h>
 
 #include <xpcf/xpcf.h>
 #include <xpcf/api/IComponentManager.h>
@@ -44,12 +48,17 @@ using namespace SolAR::datastructure;
 namespace xpcf=org::bcom::xpcf;
 
 using com::bcom::solar::gprc::RelocalizationAndMappingGrpcServiceImpl;
+using com::bcom::solar::gprc::RelocalizationAndMappingGrpcServiceImplV2;
+using com::bcom::solar::gprc::ProxyOptions;
+using com::bcom::solar::gprc::ForwardEncoding;
+using com::bcom::solar::gprc::GreyForward;
+namespace imageconversion = com::bcom::solar::gprc::imageconversion;
 
 const int DEFAULT_GRPC_LISTENING_PORT = 5010;
 
 SRef<pipeline::IAsyncRelocalizationPipeline> resolvePipeline(const string& configFile, uint8_t displayImages);
 void startService(pipeline::IAsyncRelocalizationPipeline* pipeline, string serverAddress,
-                  string saveFolder, uint8_t displayImages);
+                  string saveFolder, uint8_t displayImages, const ProxyOptions& proxyOptions);
 void print_help(const cxxopts::Options& options);
 
 SRef<SolAR::api::display::IImageViewer> gImageViewer_left, gImageViewer_right;
@@ -72,7 +81,44 @@ LOG_ADD_LOG_TO_CONSOLE();
                 (default: " + std::to_string(DEFAULT_GRPC_LISTENING_PORT) + ")", cxxopts::value<int>()->default_value(std::to_string(DEFAULT_GRPC_LISTENING_PORT)))
             ("s,save", "save images and poses on the given folder", cxxopts::value<string>())
             ("display-received-images", "display images received from client (before proxy processing)")
-            ("display-sent-images", "display images sent to Front End (after proxy processing)");
+            ("display-sent-images", "display images sent to Front End (after proxy processing)")
+            ("workers", "number of threads processing the received frames \
+                (default: " + std::to_string(ProxyOptions().nbWorkers) + ")", cxxopts::value<unsigned int>())
+            ("worker-queue", "maximum number of frames waiting for a worker, further frames are rejected \
+                (default: " + std::to_string(DEFAULT_WORKER_QUEUE_SIZE) + ")", cxxopts::value<unsigned int>())
+            ("grpc-pollers", "number of gRPC polling threads \
+                (default: " + std::to_string(DEFAULT_GRPC_POLLERS) + ")", cxxopts::value<unsigned int>())
+            ("reorder-max-depth", "maximum number of frames held back to reorder them \
+                (default: " + std::to_string(DEFAULT_REORDER_MAX_DEPTH) + ")", cxxopts::value<unsigned int>())
+            ("reorder-max-latency", "maximum delay in ms added to reorder frames \
+                (default: " + std::to_string(DEFAULT_REORDER_MAX_LATENCY_MS) + ")", cxxopts::value<unsigned int>())
+            ("forward-encoding", "encoding of the images sent to Front End: none, same (as received), jpeg or png. \
+                Reduces the proxy to Front End bandwidth only: the proxy decodes every image and encodes it again, \
+                which costs proxy CPU time even with same (default: none)", cxxopts::value<string>())
+            ("forward-jpeg-quality", "quality (0-100) of the JPEG images sent to Front End \
+                (default: " + std::to_string(DEFAULT_FORWARD_JPEG_QUALITY) + ")", cxxopts::value<unsigned int>())
+            ("grey-forward", "clients whose RGB images are sent in grey to Front End: off, relocalization (clients \
+                in relocalization only mode) or all (default: off)", cxxopts::value<string>())
+            ("target-width", "images are downscaled by an integer factor before being sent to Front End, \
+                down to this minimum width (default: 0, no downscale)", cxxopts::value<unsigned int>())
+            ("max-in-flight-per-client", "maximum number of frames of a client sent or waiting to be sent to Front End, \
+                further frames are answered with the latest pose (default: " + std::to_string(DEFAULT_MAX_IN_FLIGHT_PER_CLIENT) + ")",
+                cxxopts::value<unsigned int>())
+            ("max-in-flight", "maximum number of frames of all the clients sent or waiting to be sent to Front End, \
+                further frames are answered with the latest pose (default: " + std::to_string(DEFAULT_MAX_IN_FLIGHT) + ", no limit)",
+                cxxopts::value<unsigned int>())
+            ("motion-gate-translation", "device translation (meters) since the last frame sent to Front End to send a new one, \
+                other frames are answered with the latest pose (default: 0, not used)", cxxopts::value<float>())
+            ("motion-gate-rotation", "device rotation (degrees) since the last frame sent to Front End to send a new one, \
+                other frames are answered with the latest pose (default: 0, not used)", cxxopts::value<float>())
+            ("motion-gate-max-interval", "maximum time (ms) between two frames sent to Front End when the device does not move \
+                (default: " + std::to_string(DEFAULT_MOTION_GATE_MAX_INTERVAL_MS) + ", 0: no limit)", cxxopts::value<unsigned int>())
+            ("duplicate-distance", "maximum Hamming distance (0-64 bits) between the image hashes of a frame and of a recent frame \
+                sent to Front End to answer it with the latest pose (default: 0, no duplicate detection)", cxxopts::value<unsigned int>())
+            ("duplicate-history", "number of frames sent to Front End compared with a new frame to detect duplicates \
+                (default: " + std::to_string(DEFAULT_DUPLICATE_HISTORY) + ")", cxxopts::value<unsigned int>())
+            ("duplicate-max-age", "age (ms) after which a frame sent to Front End is no longer compared with new frames \
+                (default: " + std::to_string(DEFAULT_DUPLICATE_MAX_AGE_MS) + ")", cxxopts::value<unsigned int>());
 
     auto options = option_list.parse(argc, argv);
     if (options.count("help")) {
@@ -120,10 +166,102 @@ LOG_ADD_LOG_TO_CONSOLE();
         LOG_INFO("Sent images will be displayed on a view screen");
     }
 
+    ProxyOptions proxyOptions;
+    if (options.count("workers"))
+        proxyOptions.nbWorkers = options["workers"].as<unsigned int>();
+    if (options.count("worker-queue"))
+        proxyOptions.workerQueueSize = options["worker-queue"].as<unsigned int>();
+    if (options.count("grpc-pollers"))
+        proxyOptions.nbGrpcPollers = options["grpc-pollers"].as<unsigned int>();
+    if (options.count("reorder-max-depth"))
+        proxyOptions.reorderMaxDepth = options["reorder-max-depth"].as<unsigned int>();
+    if (options.count("reorder-max-latency"))
+        proxyOptions.reorderMaxLatencyMs = options["reorder-max-latency"].as<unsigned int>();
+    if (options.count("forward-encoding")) {
+        string forwardEncoding = options["forward-encoding"].as<string>();
+        if (forwardEncoding == "none")
+            proxyOptions.forwardEncoding = ForwardEncoding::NONE;
+        else if (forwardEncoding == "same")
+            proxyOptions.forwardEncoding = ForwardEncoding::SAME;
+        else if (forwardEncoding == "jpeg")
+            proxyOptions.forwardEncoding = ForwardEncoding::JPEG;
+        else if (forwardEncoding == "png")
+            proxyOptions.forwardEncoding = ForwardEncoding::PNG;
+        else {
+            LOG_ERROR("Unknown forward encoding: {}", forwardEncoding);
+            print_help(option_list);
+            return 1;
+        }
+        LOG_INFO("Images sent to Front End encoded as: {}", forwardEncoding);
+    }
+    if (options.count("forward-jpeg-quality"))
+        proxyOptions.forwardJpegQuality = std::min(100u, options["forward-jpeg-quality"].as<unsigned int>());
+    if (options.count("grey-forward")) {
+        string greyForward = options["grey-forward"].as<string>();
+        if (greyForward == "off")
+            proxyOptions.greyForward = GreyForward::OFF;
+        else if (greyForward == "relocalization")
+            proxyOptions.greyForward = GreyForward::RELOCALIZATION_ONLY;
+        else if (greyForward == "all")
+            proxyOptions.greyForward = GreyForward::ALL;
+        else {
+            LOG_ERROR("Unknown grey forward mode: {}", greyForward);
+            print_help(option_list);
+            return 1;
+        }
+        LOG_INFO("RGB images sent in grey to Front End: {}", greyForward);
+    }
+    if (options.count("target-width")) {
+        proxyOptions.targetWidth = options["target-width"].as<unsigned int>();
+        LOG_INFO("Target width of the images sent to Front End: {}", proxyOptions.targetWidth);
+    }
+
+    if (options.count("max-in-flight-per-client"))
+        proxyOptions.maxInFlightPerClient = options["max-in-flight-per-client"].as<unsigned int>();
+    if (options.count("max-in-flight"))
+        proxyOptions.maxInFlight = options["max-in-flight"].as<unsigned int>();
+
+    if (options.count("motion-gate-translation"))
+        proxyOptions.motionGateTranslation = options["motion-gate-translation"].as<float>();
+    if (options.count("motion-gate-rotation"))
+        proxyOptions.motionGateRotationDeg = options["motion-gate-rotation"].as<float>();
+    if (options.count("motion-gate-max-interval"))
+        proxyOptions.motionGateMaxIntervalMs = options["motion-gate-max-interval"].as<unsigned int>();
+
+    if (options.count("duplicate-distance"))
+        proxyOptions.duplicateDistance = options["duplicate-distance"].as<unsigned int>();
+    if (options.count("duplicate-history"))
+        proxyOptions.duplicateHistory = options["duplicate-history"].as<unsigned int>();
+    if (options.count("duplicate-max-age"))
+        proxyOptions.duplicateMaxAgeMs = options["duplicate-max-age"].as<unsigned int>();
+
+    if ((proxyOptions.nbWorkers == 0) || (proxyOptions.workerQueueSize == 0) || (proxyOptions.nbGrpcPollers == 0)
+            || (proxyOptions.maxInFlightPerClient == 0) || (proxyOptions.duplicateHistory == 0)
+            || (proxyOptions.motionGateTranslation < 0) || (proxyOptions.motionGateRotationDeg < 0)) {
+        LOG_ERROR("Number of workers, worker queue size, number of gRPC pollers, in-flight frames per client "
+                  "and duplicate history must be positive, "
+                  "motion gate thresholds must not be negative");
+        print_help(option_list);
+        return 1;
+    }
+
+    LOG_INFO("Workers: {} (queue size: {}), gRPC pollers: {}",
+             proxyOptions.nbWorkers, proxyOptions.workerQueueSize, proxyOptions.nbGrpcPollers);
+    LOG_INFO("Reorder buffer: up to {} frames, up to {} ms",
+             proxyOptions.reorderMaxDepth, proxyOptions.reorderMaxLatencyMs);
+    LOG_INFO("In-flight frames: up to {} per client, up to {} in total (0: no limit)",
+             proxyOptions.maxInFlightPerClient, proxyOptions.maxInFlight);
+    if ((proxyOptions.motionGateTranslation > 0) || (proxyOptions.motionGateRotationDeg > 0))
+        LOG_INFO("Motion gate: {} m, {} degrees, at least one frame every {} ms (0: no limit)",
+                 proxyOptions.motionGateTranslation, proxyOptions.motionGateRotationDeg, proxyOptions.motionGateMaxIntervalMs);
+    if (proxyOptions.duplicateDistance > 0)
+        LOG_INFO("Duplicate frames: image hash distance up to {} bits with the last {} frames sent, for {} ms",
+                 proxyOptions.duplicateDistance, proxyOptions.duplicateHistory, proxyOptions.duplicateMaxAgeMs);
+
     try
     {
         auto pipeline = resolvePipeline(configFile, displayImages);
-        startService(pipeline.get(), "0.0.0.0:" + std::to_string(port), saveFolder, displayImages);
+        startService(pipeline.get(), "0.0.0.0:" + std::to_string(port), saveFolder, displayImages, proxyOptions);
     }
     catch (const xpcf::Exception& e)
     {
@@ -163,7 +301,7 @@ SRef<pipeline::IAsyncRelocalizationPipeline> resolvePipeline(const string& confi
 }
 
 void startService(pipeline::IAsyncRelocalizationPipeline* pipeline, string serverAddress,
-                  string saveFolder, uint8_t displayImages)
+                  string saveFolder, uint8_t displayImages, const ProxyOptions& proxyOptions)
 {
     grpc::EnableDefaultHealthCheckService(true);
     // grpc::reflection::InitProtoReflectionServerBuilderPlugin();
@@ -171,11 +309,27 @@ void startService(pipeline::IAsyncRelocalizationPipeline* pipeline, string serve
 
     builder.AddListeningPort(serverAddress, grpc::InsecureServerCredentials());  
 
+    // Frames are processed by the worker pool (callback API): the synchronous threads
+    // only serve the control methods, their number does not depend on the number of clients
+    builder.SetSyncServerOption(grpc::ServerBuilder::SyncServerOption::NUM_CQS, proxyOptions.nbGrpcPollers);
+    builder.SetSyncServerOption(grpc::ServerBuilder::SyncServerOption::MIN_POLLERS, 1);
+    builder.SetSyncServerOption(grpc::ServerBuilder::SyncServerOption::MAX_POLLERS, proxyOptions.nbGrpcPollers);
+
+    grpc::ResourceQuota resourceQuota("SolARService_MappingAndRelocalizationProxy");
+    resourceQuota.SetMaxThreads(2 * proxyOptions.nbGrpcPollers);
+    builder.SetResourceQuota(resourceQuota);
+
+    LOG_INFO("Image conversion kernel: {}", imageconversion::to_string(imageconversion::activeKernel()));
+
     if (displayImages != 0) {
         RelocalizationAndMappingGrpcServiceImpl grpcServices(
-                    pipeline, saveFolder, displayImages, gImageViewer_left, gImageViewer_right);
+                    pipeline, saveFolder, displayImages, gImageViewer_left, gImageViewer_right, proxyOptions);
+
+        // Version 2 of the API served side by side, processed by the same service
+        RelocalizationAndMappingGrpcServiceImplV2 grpcServicesV2(grpcServices);
 
         builder.RegisterService(&grpcServices);
+        builder.RegisterService(&grpcServicesV2);
 
         LOG_INFO("Starting proxy gRPC service with Display option");
         unique_ptr<grpc::Server> grpcServer = builder.BuildAndStart();
@@ -185,9 +339,13 @@ void startService(pipeline::IAsyncRelocalizationPipeline* pipeline, string serve
         grpcServer->Wait();
     }
     else {
-        RelocalizationAndMappingGrpcServiceImpl grpcServices(pipeline, saveFolder);
+        RelocalizationAndMappingGrpcServiceImpl grpcServices(pipeline, saveFolder, proxyOptions);
+
+        // Version 2 of the API served side by side, processed by the same service
+        RelocalizationAndMappingGrpcServiceImplV2 grpcServicesV2(grpcServices);
 
         builder.RegisterService(&grpcServices);
+        builder.RegisterService(&grpcServicesV2);
 
         LOG_INFO("Starting proxy gRPC service");
         unique_ptr<grpc::Server> grpcServer = builder.BuildAndStart();
@@ -0,0 +1,132 @@
+/**
+ * @copyright Copyright (c) 2021 B-com http://www.b-com.com/
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef TIMESTAMP_ORDERED_RING_H
+#define TIMESTAMP_ORDERED_RING_H
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace com::bcom::solar::gprc
+{
+
+/**
+ * @class TimestampOrderedRing
+ * @brief Fixed capacity ring of values kept sorted by timestamp
+ *
+ * All the slots are allocated at construction: push and pop never allocate,
+ * values are moved in and out of the slots.
+ * The insertion position is found by binary search, then the shorter side of
+ * the ring is shifted by one slot: frames arriving in order (or slightly late)
+ * are inserted in constant time. The oldest value is popped in constant time.
+ * Values with the same timestamp are kept in arrival order.
+ * Not thread safe.
+ */
+template <class T>
+class TimestampOrderedRing
+{
+    public:
+        explicit TimestampOrderedRing(size_t capacity)
+            : m_slots(capacity > 0 ? capacity : 1)
+        {}
+
+        size_t capacity() const { return m_slots.size(); }
+        size_t size() const { return m_size; }
+        bool empty() const { return m_size == 0; }
+        bool full() const { return m_size == m_slots.size(); }
+
+        /// @brief Insert a value at its timestamp position
+        /// @return false if the ring is full (value is not moved)
+        bool push(long timestamp, T&& value)
+        {
+            if (full())
+                return false;
+
+            // First slot with a timestamp greater than the new one
+            size_t low = 0, high = m_size;
+            while (low < high) {
+                size_t middle = (low + high) / 2;
+                if (slot(middle).first <= timestamp)
+                    low = middle + 1;
+                else
+                    high = middle;
+            }
+            size_t position = low;
+
+            if (position < m_size - position) {
+                // Shift the older values one slot backward
+                m_head = (m_head + m_slots.size() - 1) % m_slots.size();
+                for (size_t i = 0; i < position; i++)
+                    slot(i) = std::move(slot(i + 1));
+            }
+            else {
+                // Shift the newer values one slot forward
+                for (size_t i = m_size; i > position; i--)
+                    slot(i) = std::move(slot(i - 1));
+            }
+
+            slot(position).first = timestamp;
+            slot(position).second = std::move(value);
+            m_size++;
+
+            return true;
+        }
+
+        /// @brief Timestamp of the oldest value (ring must not be empty)
+        long oldestTimestamp() const { return slot(0).first; }
+
+        /// @brief Timestamp of the newest value (ring must not be empty)
+        long newestTimestamp() const { return slot(m_size - 1).first; }
+
+        /// @brief Move out the oldest value
+        /// @return false if the ring is empty
+        bool pop(long& timestamp, T& value)
+        {
+            if (empty())
+                return false;
+
+            timestamp = slot(0).first;
+            value = std::move(slot(0).second);
+            m_head = (m_head + 1) % m_slots.size();
+            m_size--;
+
+            return true;
+        }
+
+        /// @brief Remove all the values (slots are kept)
+        void clear()
+        {
+            while (m_size > 0) {
+                slot(0).second = T();
+                m_head = (m_head + 1) % m_slots.size();
+                m_size--;
+            }
+            m_head = 0;
+        }
+
+    private:
+        std::pair<long, T>& slot(size_t index) { return m_slots[(m_head + index) % m_slots.size()]; }
+        const std::pair<long, T>& slot(size_t index) const { return m_slots[(m_head + index) % m_slots.size()]; }
+
+        std::vector<std::pair<long, T>> m_slots;
+        size_t m_head = 0;
+        size_t m_size = 0;
+};
+
+} // namespace com::bcom::solar::gprc
+
+#endif // TIMESTAMP_ORDERED_RING_H
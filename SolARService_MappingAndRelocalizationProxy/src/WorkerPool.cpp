@@ -0,0 +1,166 @@
+/**
+ * @copyright Copyright (c) 2021 B-com http://www.b-com.com/
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "WorkerPool.h"
+
+#include <algorithm>
+
+namespace com::bcom::solar::gprc
+{
+
+namespace {
+// Pool and queue of the current thread, when it is a worker
+thread_local const WorkerPool* tlsWorkerPool = nullptr;
+thread_local unsigned int tlsWorkerIndex = 0;
+}
+
+WorkerPool::WorkerPool(unsigned int nbThreads, unsigned int maxPendingTasks)
+    : m_maxPendingTasks{maxPendingTasks}
+{
+    nbThreads = std::max(1u, nbThreads);
+    for (unsigned int i = 0; i < nbThreads; i++)
+        m_queues.push_back(std::make_unique<TaskQueue>());
+
+    m_threads.reserve(nbThreads);
+    for (unsigned int i = 0; i < nbThreads; i++)
+        m_threads.emplace_back(&WorkerPool::run, this, i);
+}
+
+WorkerPool::~WorkerPool()
+{
+    {
+        std::unique_lock<std::mutex> lock(m_mutexSleep);
+        m_stopped = true;
+    }
+    m_tasksCondition.notify_all();
+
+    for (auto& thread : m_threads)
+        thread.join();
+}
+
+bool WorkerPool::trySubmit(std::function<void()> task)
+{
+    if ((m_maxPendingTasks != 0) && (m_nbPendingTasks.load(std::memory_order_relaxed) >= m_maxPendingTasks))
+        return false;
+
+    push(std::move(task));
+    return true;
+}
+
+void WorkerPool::post(std::function<void()> task)
+{
+    push(std::move(task));
+}
+
+unsigned int WorkerPool::defaultThreadCount()
+{
+    return std::max(4u, 2 * std::thread::hardware_concurrency());
+}
+
+void WorkerPool::push(std::function<void()> task)
+{
+    // Tasks posted by a worker stay on its queue (data still in its cache)
+    unsigned int queueIndex = (tlsWorkerPool == this) ?
+                tlsWorkerIndex : m_nextQueue.fetch_add(1, std::memory_order_relaxed) % m_queues.size();
+    {
+        // Counted under the queue lock: a worker can not pop the task before it is counted
+        std::unique_lock<std::mutex> lock(m_queues[queueIndex]->mutex);
+        m_queues[queueIndex]->tasks.push_back(std::move(task));
+        m_nbPendingTasks.fetch_add(1);
+    }
+
+    // Lock so that the notification can not be missed by a worker going to sleep
+    { std::unique_lock<std::mutex> lock(m_mutexSleep); }
+    m_tasksCondition.notify_one();
+}
+
+bool WorkerPool::pop(unsigned int workerIndex, std::function<void()>& task)
+{
+    // Own queue first (oldest task), then steal from the other queues (newest task)
+    for (unsigned int i = 0; i < m_queues.size(); i++) {
+        TaskQueue& queue = *m_queues[(workerIndex + i) % m_queues.size()];
+        std::unique_lock<std::mutex> lock(queue.mutex);
+        if (queue.tasks.empty())
+            continue;
+        if (i == 0) {
+            task = std::move(queue.tasks.front());
+            queue.tasks.pop_front();
+        }
+        else {
+            task = std::move(queue.tasks.back());
+            queue.tasks.pop_back();
+        }
+        m_nbPendingTasks.fetch_sub(1);
+        return true;
+    }
+    return false;
+}
+
+void WorkerPool::run(unsigned int workerIndex)
+{
+    tlsWorkerPool = this;
+    tlsWorkerIndex = workerIndex;
+
+    while (true) {
+        std::function<void()> task;
+        if (pop(workerIndex, task)) {
+            task();
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(m_mutexSleep);
+        // Pending tasks are still run when stopping: each one completes a gRPC call
+        if (m_stopped && (m_nbPendingTasks.load() == 0))
+            return;
+        m_tasksCondition.wait(lock, [this]() { return m_stopped || (m_nbPendingTasks.load() > 0); });
+    }
+}
+
+void Strand::post(std::function<void()> task)
+{
+    {
+        std::unique_lock<std::mutex> lock(m_mutexTasks);
+        m_tasks.push_back(std::move(task));
+        if (m_running)
+            return;
+        m_running = true;
+    }
+    m_pool.post([self = shared_from_this()]() { self->runNext(); });
+}
+
+void Strand::runNext()
+{
+    std::function<void()> task;
+    {
+        std::unique_lock<std::mutex> lock(m_mutexTasks);
+        task = std::move(m_tasks.front());
+        m_tasks.pop_front();
+    }
+
+    task();
+
+    // Next task is posted again, so that the strands share the workers fairly
+    {
+        std::unique_lock<std::mutex> lock(m_mutexTasks);
+        if (m_tasks.empty()) {
+            m_running = false;
+            return;
+        }
+    }
+    m_pool.post([self = shared_from_this()]() { self->runNext(); });
+}
+
+} // namespace com::bcom::solar::gprc
@@ -0,0 +1,115 @@
+/**
+ * @copyright Copyright (c) 2021 B-com http://www.b-com.com/
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef WORKER_POOL_H
+#define WORKER_POOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace com::bcom::solar::gprc
+{
+
+/**
+ * @class WorkerPool
+ * @brief Fixed set of work-stealing threads running the blocking part of the gRPC callback handlers
+ *
+ * gRPC callback handlers must not block the gRPC threads: the processing
+ * (decoding, call to the front end) is posted to this pool instead.
+ * Each worker has its own queue: tasks posted by a worker stay on its queue,
+ * tasks submitted from other threads are spread over the queues, and idle
+ * workers steal tasks from the other queues.
+ * The pool is bounded (threads and submitted tasks) so that the number of
+ * proxy threads does not depend on the number of clients.
+ */
+class WorkerPool
+{
+    public:
+        /// @param[in] nbThreads: number of worker threads
+        /// @param[in] maxPendingTasks: maximum number of tasks waiting for a worker (0: no limit)
+        explicit WorkerPool(unsigned int nbThreads = defaultThreadCount(), unsigned int maxPendingTasks = 0);
+        ~WorkerPool();
+
+        WorkerPool(const WorkerPool&) = delete;
+        WorkerPool& operator=(const WorkerPool&) = delete;
+
+        /// @brief Post a new task (received request) to be run by one of the workers
+        /// @return false if the task was rejected because too many tasks are pending
+        bool trySubmit(std::function<void()> task);
+
+        /// @brief Post the continuation of a task already accepted by the pool (never rejected)
+        void post(std::function<void()> task);
+
+        /// @brief Give the number of worker threads
+        unsigned int size() const { return static_cast<unsigned int>(m_threads.size()); }
+
+        /// @brief Default number of workers: tasks mostly wait for the front end
+        static unsigned int defaultThreadCount();
+
+    private:
+        struct TaskQueue
+        {
+            std::mutex mutex;
+            std::deque<std::function<void()>> tasks;
+        };
+
+        void push(std::function<void()> task);
+        bool pop(unsigned int workerIndex, std::function<void()>& task);
+        void run(unsigned int workerIndex);
+
+        std::vector<std::unique_ptr<TaskQueue>> m_queues;   // One queue per worker
+        std::vector<std::thread> m_threads;
+        std::atomic<unsigned int> m_nextQueue{0};           // Queue of the next task submitted from outside the pool
+        std::atomic<unsigned int> m_nbPendingTasks{0};
+        std::mutex m_mutexSleep;                            // Mutex used by idle workers to wait for tasks
+        std::condition_variable m_tasksCondition;
+        unsigned int m_maxPendingTasks;
+        bool m_stopped = false;
+};
+
+/**
+ * @class Strand
+ * @brief Runs the tasks posted to it one after the other, in order, on a worker pool
+ *
+ * Tasks of different strands run in parallel. A strand must be owned by a
+ * shared pointer: it is kept alive while it has tasks.
+ */
+class Strand : public std::enable_shared_from_this<Strand>
+{
+    public:
+        explicit Strand(WorkerPool& pool): m_pool{pool} {}
+
+        /// @brief Post a task to run after the tasks already posted
+        void post(std::function<void()> task);
+
+    private:
+        void runNext();
+
+        WorkerPool& m_pool;
+        std::mutex m_mutexTasks;                // Mutex used to control tasks access
+        std::deque<std::function<void()>> m_tasks;
+        bool m_running = false;                 // Indicates if a task of the strand is posted or running
+};
+
+} // namespace com::bcom::solar::gprc
+
+#endif // WORKER_POOL_H
@@ -35,7 +35,11 @@ static const char* SolARMappingAndRelocalizationProxy_method_names[] = {
   "/com.bcom.solar.gprc.SolARMappingAndRelocalizationProxy/setRectificationParameters",
   "/com.bcom.solar.gprc.SolARMappingAndRelocalizationProxy/RelocalizeAndMap",
   "/com.bcom.solar.gprc.SolARMappingAndRelocalizationProxy/RelocalizeAndMapGroundTruth",
+  "/com.bcom.solar.gprc.SolARMappingAndRelocalizationProxy/RelocalizeAndMapStream",
+  "/com.bcom.solar.gprc.SolARMappingAndRelocalizationProxy/RelocalizeAndMapBatch",
   "/com.bcom.solar.gprc.SolARMappingAndRelocalizationProxy/Get3DTransform",
+  "/com.bcom.solar.gprc.SolARMappingAndRelocalizationProxy/SubscribeTransforms",
+  "/com.bcom.solar.gprc.SolARMappingAndRelocalizationProxy/GetStats",
   "/com.bcom.solar.gprc.SolARMappingAndRelocalizationProxy/Reset",
   "/com.bcom.solar.gprc.SolARMappingAndRelocalizationProxy/SendMessage",
 };
@@ -57,9 +61,13 @@ SolARMappingAndRelocalizationProxy::Stub::Stub(const std::shared_ptr< ::grpc::Ch
   , rpcmethod_setRectificationParameters_(SolARMappingAndRelocalizationProxy_method_names[7], ::grpc::internal::RpcMethod::NORMAL_RPC, channel)
   , rpcmethod_RelocalizeAndMap_(SolARMappingAndRelocalizationProxy_method_names[8], ::grpc::internal::RpcMethod::NORMAL_RPC, channel)
   , rpcmethod_RelocalizeAndMapGroundTruth_(SolARMappingAndRelocalizationProxy_method_names[9], ::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  , rpcmethod_Get3DTransform_(SolARMappingAndRelocalizationProxy_method_names[10], ::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  , rpcmethod_Reset_(SolARMappingAndRelocalizationProxy_method_names[11], ::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  , rpcmethod_SendMessage_(SolARMappingAndRelocalizationProxy_method_names[12], ::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_RelocalizeAndMapStream_(SolARMappingAndRelocalizationProxy_method_names[10], ::grpc::internal::RpcMethod::BIDI_STREAMING, channel)
+  , rpcmethod_RelocalizeAndMapBatch_(SolARMappingAndRelocalizationProxy_method_names[11], ::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_Get3DTransform_(SolARMappingAndRelocalizationProxy_method_names[12], ::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_SubscribeTransforms_(SolARMappingAndRelocalizationProxy_method_names[13], ::grpc::internal::RpcMethod::SERVER_STREAMING, channel)
+  , rpcmethod_GetStats_(SolARMappingAndRelocalizationProxy_method_names[14], ::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_Reset_(SolARMappingAndRelocalizationProxy_method_names[15], ::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_SendMessage_(SolARMappingAndRelocalizationProxy_method_names[16], ::grpc::internal::RpcMethod::NORMAL_RPC, channel)
   {}
 
 ::grpc::Status SolARMappingAndRelocalizationProxy::Stub::RegisterClient(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::Empty& request, ::com::bcom::solar::gprc::ClientUUID* response) {
@@ -292,6 +300,45 @@ void SolARMappingAndRelocalizationProxy::Stub::experimental_async::RelocalizeAnd
   return result;
 }
 
+::grpc::ClientReaderWriter< ::com::bcom::solar::gprc::Frames, ::com::bcom::solar::gprc::RelocalizationResult>* SolARMappingAndRelocalizationProxy::Stub::RelocalizeAndMapStreamRaw(::grpc::ClientContext* context) {
+  return ::grpc::internal::ClientReaderWriterFactory< ::com::bcom::solar::gprc::Frames, ::com::bcom::solar::gprc::RelocalizationResult>::Create(channel_.get(), rpcmethod_RelocalizeAndMapStream_, context);
+}
+
+void SolARMappingAndRelocalizationProxy::Stub::experimental_async::RelocalizeAndMapStream(::grpc::ClientContext* context, ::grpc::experimental::ClientBidiReactor< ::com::bcom::solar::gprc::Frames,::com::bcom::solar::gprc::RelocalizationResult>* reactor) {
+  ::grpc::internal::ClientCallbackReaderWriterFactory< ::com::bcom::solar::gprc::Frames,::com::bcom::solar::gprc::RelocalizationResult>::Create(stub_->channel_.get(), stub_->rpcmethod_RelocalizeAndMapStream_, context, reactor);
+}
+
+::grpc::ClientAsyncReaderWriter< ::com::bcom::solar::gprc::Frames, ::com::bcom::solar::gprc::RelocalizationResult>* SolARMappingAndRelocalizationProxy::Stub::AsyncRelocalizeAndMapStreamRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag) {
+  return ::grpc::internal::ClientAsyncReaderWriterFactory< ::com::bcom::solar::gprc::Frames, ::com::bcom::solar::gprc::RelocalizationResult>::Create(channel_.get(), cq, rpcmethod_RelocalizeAndMapStream_, context, true, tag);
+}
+
+::grpc::ClientAsyncReaderWriter< ::com::bcom::solar::gprc::Frames, ::com::bcom::solar::gprc::RelocalizationResult>* SolARMappingAndRelocalizationProxy::Stub::PrepareAsyncRelocalizeAndMapStreamRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncReaderWriterFactory< ::com::bcom::solar::gprc::Frames, ::com::bcom::solar::gprc::RelocalizationResult>::Create(channel_.get(), cq, rpcmethod_RelocalizeAndMapStream_, context, false, nullptr);
+}
+
+::grpc::Status SolARMappingAndRelocalizationProxy::Stub::RelocalizeAndMapBatch(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::FramesBatch& request, ::com::bcom::solar::gprc::RelocalizationResults* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::com::bcom::solar::gprc::FramesBatch, ::com::bcom::solar::gprc::RelocalizationResults, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_RelocalizeAndMapBatch_, context, request, response);
+}
+
+void SolARMappingAndRelocalizationProxy::Stub::experimental_async::RelocalizeAndMapBatch(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::FramesBatch* request, ::com::bcom::solar::gprc::RelocalizationResults* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::com::bcom::solar::gprc::FramesBatch, ::com::bcom::solar::gprc::RelocalizationResults, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_RelocalizeAndMapBatch_, context, request, response, std::move(f));
+}
+
+void SolARMappingAndRelocalizationProxy::Stub::experimental_async::RelocalizeAndMapBatch(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::FramesBatch* request, ::com::bcom::solar::gprc::RelocalizationResults* response, ::grpc::experimental::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_RelocalizeAndMapBatch_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::com::bcom::solar::gprc::RelocalizationResults>* SolARMappingAndRelocalizationProxy::Stub::PrepareAsyncRelocalizeAndMapBatchRaw(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::FramesBatch& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::com::bcom::solar::gprc::RelocalizationResults, ::com::bcom::solar::gprc::FramesBatch, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_RelocalizeAndMapBatch_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::com::bcom::solar::gprc::RelocalizationResults>* SolARMappingAndRelocalizationProxy::Stub::AsyncRelocalizeAndMapBatchRaw(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::FramesBatch& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncRelocalizeAndMapBatchRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
 ::grpc::Status SolARMappingAndRelocalizationProxy::Stub::Get3DTransform(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::ClientUUID& request, ::com::bcom::solar::gprc::RelocalizationResult* response) {
   return ::grpc::internal::BlockingUnaryCall< ::com::bcom::solar::gprc::ClientUUID, ::com::bcom::solar::gprc::RelocalizationResult, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_Get3DTransform_, context, request, response);
 }
@@ -315,6 +362,45 @@ void SolARMappingAndRelocalizationProxy::Stub::experimental_async::Get3DTransfor
   return result;
 }
 
+::grpc::ClientReader< ::com::bcom::solar::gprc::RelocalizationResult>* SolARMappingAndRelocalizationProxy::Stub::SubscribeTransformsRaw(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::ClientUUID& request) {
+  return ::grpc::internal::ClientReaderFactory< ::com::bcom::solar::gprc::RelocalizationResult>::Create(channel_.get(), rpcmethod_SubscribeTransforms_, context, request);
+}
+
+void SolARMappingAndRelocalizationProxy::Stub::experimental_async::SubscribeTransforms(::grpc::ClientContext* context, ::com::bcom::solar::gprc::ClientUUID* request, ::grpc::experimental::ClientReadReactor< ::com::bcom::solar::gprc::RelocalizationResult>* reactor) {
+  ::grpc::internal::ClientCallbackReaderFactory< ::com::bcom::solar::gprc::RelocalizationResult>::Create(stub_->channel_.get(), stub_->rpcmethod_SubscribeTransforms_, context, request, reactor);
+}
+
+::grpc::ClientAsyncReader< ::com::bcom::solar::gprc::RelocalizationResult>* SolARMappingAndRelocalizationProxy::Stub::AsyncSubscribeTransformsRaw(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::ClientUUID& request, ::grpc::CompletionQueue* cq, void* tag) {
+  return ::grpc::internal::ClientAsyncReaderFactory< ::com::bcom::solar::gprc::RelocalizationResult>::Create(channel_.get(), cq, rpcmethod_SubscribeTransforms_, context, request, true, tag);
+}
+
+::grpc::ClientAsyncReader< ::com::bcom::solar::gprc::RelocalizationResult>* SolARMappingAndRelocalizationProxy::Stub::PrepareAsyncSubscribeTransformsRaw(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::ClientUUID& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncReaderFactory< ::com::bcom::solar::gprc::RelocalizationResult>::Create(channel_.get(), cq, rpcmethod_SubscribeTransforms_, context, request, false, nullptr);
+}
+
+::grpc::Status SolARMappingAndRelocalizationProxy::Stub::GetStats(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::ClientUUID& request, ::com::bcom::solar::gprc::ProxyStatsResult* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::com::bcom::solar::gprc::ClientUUID, ::com::bcom::solar::gprc::ProxyStatsResult, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_GetStats_, context, request, response);
+}
+
+void SolARMappingAndRelocalizationProxy::Stub::experimental_async::GetStats(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::ClientUUID* request, ::com::bcom::solar::gprc::ProxyStatsResult* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::com::bcom::solar::gprc::ClientUUID, ::com::bcom::solar::gprc::ProxyStatsResult, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_GetStats_, context, request, response, std::move(f));
+}
+
+void SolARMappingAndRelocalizationProxy::Stub::experimental_async::GetStats(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::ClientUUID* request, ::com::bcom::solar::gprc::ProxyStatsResult* response, ::grpc::experimental::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_GetStats_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::com::bcom::solar::gprc::ProxyStatsResult>* SolARMappingAndRelocalizationProxy::Stub::PrepareAsyncGetStatsRaw(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::ClientUUID& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::com::bcom::solar::gprc::ProxyStatsResult, ::com::bcom::solar::gprc::ClientUUID, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_GetStats_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::com::bcom::solar::gprc::ProxyStatsResult>* SolARMappingAndRelocalizationProxy::Stub::AsyncGetStatsRaw(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::ClientUUID& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncGetStatsRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
 ::grpc::Status SolARMappingAndRelocalizationProxy::Stub::Reset(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::Empty& request, ::com::bcom::solar::gprc::Empty* response) {
   return ::grpc::internal::BlockingUnaryCall< ::com::bcom::solar::gprc::Empty, ::com::bcom::solar::gprc::Empty, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_Reset_, context, request, response);
 }
@@ -464,6 +550,26 @@ SolARMappingAndRelocalizationProxy::Service::Service() {
              }, this)));
   AddMethod(new ::grpc::internal::RpcServiceMethod(
       SolARMappingAndRelocalizationProxy_method_names[10],
+      ::grpc::internal::RpcMethod::BIDI_STREAMING,
+      new ::grpc::internal::BidiStreamingHandler< SolARMappingAndRelocalizationProxy::Service, ::com::bcom::solar::gprc::Frames, ::com::bcom::solar::gprc::RelocalizationResult>(
+          [](SolARMappingAndRelocalizationProxy::Service* service,
+             ::grpc::ServerContext* ctx,
+             ::grpc::ServerReaderWriter<::com::bcom::solar::gprc::RelocalizationResult,
+             ::com::bcom::solar::gprc::Frames>* stream) {
+               return service->RelocalizeAndMapStream(ctx, stream);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      SolARMappingAndRelocalizationProxy_method_names[11],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< SolARMappingAndRelocalizationProxy::Service, ::com::bcom::solar::gprc::FramesBatch, ::com::bcom::solar::gprc::RelocalizationResults, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](SolARMappingAndRelocalizationProxy::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::com::bcom::solar::gprc::FramesBatch* req,
+             ::com::bcom::solar::gprc::RelocalizationResults* resp) {
+               return service->RelocalizeAndMapBatch(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      SolARMappingAndRelocalizationProxy_method_names[12],
       ::grpc::internal::RpcMethod::NORMAL_RPC,
       new ::grpc::internal::RpcMethodHandler< SolARMappingAndRelocalizationProxy::Service, ::com::bcom::solar::gprc::ClientUUID, ::com::bcom::solar::gprc::RelocalizationResult, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
           [](SolARMappingAndRelocalizationProxy::Service* service,
@@ -473,7 +579,27 @@ SolARMappingAndRelocalizationProxy::Service::Service() {
                return service->Get3DTransform(ctx, req, resp);
              }, this)));
   AddMethod(new ::grpc::internal::RpcServiceMethod(
-      SolARMappingAndRelocalizationProxy_method_names[11],
+      SolARMappingAndRelocalizationProxy_method_names[13],
+      ::grpc::internal::RpcMethod::SERVER_STREAMING,
+      new ::grpc::internal::ServerStreamingHandler< SolARMappingAndRelocalizationProxy::Service, ::com::bcom::solar::gprc::ClientUUID, ::com::bcom::solar::gprc::RelocalizationResult>(
+          [](SolARMappingAndRelocalizationProxy::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::com::bcom::solar::gprc::ClientUUID* req,
+             ::grpc::ServerWriter<::com::bcom::solar::gprc::RelocalizationResult>* writer) {
+               return service->SubscribeTransforms(ctx, req, writer);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      SolARMappingAndRelocalizationProxy_method_names[14],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< SolARMappingAndRelocalizationProxy::Service, ::com::bcom::solar::gprc::ClientUUID, ::com::bcom::solar::gprc::ProxyStatsResult, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](SolARMappingAndRelocalizationProxy::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::com::bcom::solar::gprc::ClientUUID* req,
+             ::com::bcom::solar::gprc::ProxyStatsResult* resp) {
+               return service->GetStats(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      SolARMappingAndRelocalizationProxy_method_names[15],
       ::grpc::internal::RpcMethod::NORMAL_RPC,
       new ::grpc::internal::RpcMethodHandler< SolARMappingAndRelocalizationProxy::Service, ::com::bcom::solar::gprc::Empty, ::com::bcom::solar::gprc::Empty, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
           [](SolARMappingAndRelocalizationProxy::Service* service,
@@ -483,7 +609,7 @@ SolARMappingAndRelocalizationProxy::Service::Service() {
                return service->Reset(ctx, req, resp);
              }, this)));
   AddMethod(new ::grpc::internal::RpcServiceMethod(
-      SolARMappingAndRelocalizationProxy_method_names[12],
+      SolARMappingAndRelocalizationProxy_method_names[16],
       ::grpc::internal::RpcMethod::NORMAL_RPC,
       new ::grpc::internal::RpcMethodHandler< SolARMappingAndRelocalizationProxy::Service, ::com::bcom::solar::gprc::Message, ::com::bcom::solar::gprc::Empty, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
           [](SolARMappingAndRelocalizationProxy::Service* service,
@@ -567,6 +693,19 @@ SolARMappingAndRelocalizationProxy::Service::~Service() {
   return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
 }
 
+::grpc::Status SolARMappingAndRelocalizationProxy::Service::RelocalizeAndMapStream(::grpc::ServerContext* context, ::grpc::ServerReaderWriter< ::com::bcom::solar::gprc::RelocalizationResult, ::com::bcom::solar::gprc::Frames>* stream) {
+  (void) context;
+  (void) stream;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status SolARMappingAndRelocalizationProxy::Service::RelocalizeAndMapBatch(::grpc::ServerContext* context, const ::com::bcom::solar::gprc::FramesBatch* request, ::com::bcom::solar::gprc::RelocalizationResults* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
 ::grpc::Status SolARMappingAndRelocalizationProxy::Service::Get3DTransform(::grpc::ServerContext* context, const ::com::bcom::solar::gprc::ClientUUID* request, ::com::bcom::solar::gprc::RelocalizationResult* response) {
   (void) context;
   (void) request;
@@ -574,6 +713,20 @@ SolARMappingAndRelocalizationProxy::Service::~Service() {
   return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
 }
 
+::grpc::Status SolARMappingAndRelocalizationProxy::Service::SubscribeTransforms(::grpc::ServerContext* context, const ::com::bcom::solar::gprc::ClientUUID* request, ::grpc::ServerWriter< ::com::bcom::solar::gprc::RelocalizationResult>* writer) {
+  (void) context;
+  (void) request;
+  (void) writer;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status SolARMappingAndRelocalizationProxy::Service::GetStats(::grpc::ServerContext* context, const ::com::bcom::solar::gprc::ClientUUID* request, ::com::bcom::solar::gprc::ProxyStatsResult* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
 ::grpc::Status SolARMappingAndRelocalizationProxy::Service::Reset(::grpc::ServerContext* context, const ::com::bcom::solar::gprc::Empty* request, ::com::bcom::solar::gprc::Empty* response) {
   (void) context;
   (void) request;
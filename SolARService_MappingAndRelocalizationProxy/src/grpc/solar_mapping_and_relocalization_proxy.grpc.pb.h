@@ -123,6 +123,27 @@ class SolARMappingAndRelocalizationProxy final {
     std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::com::bcom::solar::gprc::RelocalizationResult>> PrepareAsyncRelocalizeAndMapGroundTruth(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::GroundTruthFrames& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::com::bcom::solar::gprc::RelocalizationResult>>(PrepareAsyncRelocalizeAndMapGroundTruthRaw(context, request, cq));
     }
+    // Frames are streamed by the client, a result is streamed back for each frame
+    // processed by the pipeline (identified by its timestamp)
+    std::unique_ptr< ::grpc::ClientReaderWriterInterface< ::com::bcom::solar::gprc::Frames, ::com::bcom::solar::gprc::RelocalizationResult>> RelocalizeAndMapStream(::grpc::ClientContext* context) {
+      return std::unique_ptr< ::grpc::ClientReaderWriterInterface< ::com::bcom::solar::gprc::Frames, ::com::bcom::solar::gprc::RelocalizationResult>>(RelocalizeAndMapStreamRaw(context));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReaderWriterInterface< ::com::bcom::solar::gprc::Frames, ::com::bcom::solar::gprc::RelocalizationResult>> AsyncRelocalizeAndMapStream(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderWriterInterface< ::com::bcom::solar::gprc::Frames, ::com::bcom::solar::gprc::RelocalizationResult>>(AsyncRelocalizeAndMapStreamRaw(context, cq, tag));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReaderWriterInterface< ::com::bcom::solar::gprc::Frames, ::com::bcom::solar::gprc::RelocalizationResult>> PrepareAsyncRelocalizeAndMapStream(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderWriterInterface< ::com::bcom::solar::gprc::Frames, ::com::bcom::solar::gprc::RelocalizationResult>>(PrepareAsyncRelocalizeAndMapStreamRaw(context, cq));
+    }
+    // Frames sent at once (backlog of a client after a network stall), reordered
+    // like RelocalizeAndMap frames, then all sent to the front end in timestamp
+    // order (not dropped by the motion gate, the duplicate filter or the in-flight budget)
+    virtual ::grpc::Status RelocalizeAndMapBatch(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::FramesBatch& request, ::com::bcom::solar::gprc::RelocalizationResults* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::com::bcom::solar::gprc::RelocalizationResults>> AsyncRelocalizeAndMapBatch(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::FramesBatch& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::com::bcom::solar::gprc::RelocalizationResults>>(AsyncRelocalizeAndMapBatchRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::com::bcom::solar::gprc::RelocalizationResults>> PrepareAsyncRelocalizeAndMapBatch(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::FramesBatch& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::com::bcom::solar::gprc::RelocalizationResults>>(PrepareAsyncRelocalizeAndMapBatchRaw(context, request, cq));
+    }
     virtual ::grpc::Status Get3DTransform(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::ClientUUID& request, ::com::bcom::solar::gprc::RelocalizationResult* response) = 0;
     std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::com::bcom::solar::gprc::RelocalizationResult>> AsyncGet3DTransform(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::ClientUUID& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::com::bcom::solar::gprc::RelocalizationResult>>(AsyncGet3DTransformRaw(context, request, cq));
@@ -130,6 +151,27 @@ class SolARMappingAndRelocalizationProxy final {
     std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::com::bcom::solar::gprc::RelocalizationResult>> PrepareAsyncGet3DTransform(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::ClientUUID& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::com::bcom::solar::gprc::RelocalizationResult>>(PrepareAsyncGet3DTransformRaw(context, request, cq));
     }
+    // The last result of the client is streamed back at once, then each time the
+    // pose, its status or the mapping status changes (intermediate results may be
+    // skipped when the subscriber reads slower than the results are produced)
+    std::unique_ptr< ::grpc::ClientReaderInterface< ::com::bcom::solar::gprc::RelocalizationResult>> SubscribeTransforms(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::ClientUUID& request) {
+      return std::unique_ptr< ::grpc::ClientReaderInterface< ::com::bcom::solar::gprc::RelocalizationResult>>(SubscribeTransformsRaw(context, request));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::com::bcom::solar::gprc::RelocalizationResult>> AsyncSubscribeTransforms(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::ClientUUID& request, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::com::bcom::solar::gprc::RelocalizationResult>>(AsyncSubscribeTransformsRaw(context, request, cq, tag));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::com::bcom::solar::gprc::RelocalizationResult>> PrepareAsyncSubscribeTransforms(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::ClientUUID& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::com::bcom::solar::gprc::RelocalizationResult>>(PrepareAsyncSubscribeTransformsRaw(context, request, cq));
+    }
+    // Latency of each processing stage and counters of the proxy, and of the
+    // client if a client UUID is given
+    virtual ::grpc::Status GetStats(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::ClientUUID& request, ::com::bcom::solar::gprc::ProxyStatsResult* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::com::bcom::solar::gprc::ProxyStatsResult>> AsyncGetStats(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::ClientUUID& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::com::bcom::solar::gprc::ProxyStatsResult>>(AsyncGetStatsRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::com::bcom::solar::gprc::ProxyStatsResult>> PrepareAsyncGetStats(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::ClientUUID& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::com::bcom::solar::gprc::ProxyStatsResult>>(PrepareAsyncGetStatsRaw(context, request, cq));
+    }
     virtual ::grpc::Status Reset(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::Empty& request, ::com::bcom::solar::gprc::Empty* response) = 0;
     std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::com::bcom::solar::gprc::Empty>> AsyncReset(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::Empty& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::com::bcom::solar::gprc::Empty>>(AsyncResetRaw(context, request, cq));
@@ -207,12 +249,44 @@ class SolARMappingAndRelocalizationProxy final {
       #else
       virtual void RelocalizeAndMapGroundTruth(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::GroundTruthFrames* request, ::com::bcom::solar::gprc::RelocalizationResult* response, ::grpc::experimental::ClientUnaryReactor* reactor) = 0;
       #endif
+      // Frames are streamed by the client, a result is streamed back for each frame
+      // processed by the pipeline (identified by its timestamp)
+      #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+      virtual void RelocalizeAndMapStream(::grpc::ClientContext* context, ::grpc::ClientBidiReactor< ::com::bcom::solar::gprc::Frames,::com::bcom::solar::gprc::RelocalizationResult>* reactor) = 0;
+      #else
+      virtual void RelocalizeAndMapStream(::grpc::ClientContext* context, ::grpc::experimental::ClientBidiReactor< ::com::bcom::solar::gprc::Frames,::com::bcom::solar::gprc::RelocalizationResult>* reactor) = 0;
+      #endif
+      // Frames sent at once (backlog of a client after a network stall), reordered
+      // like RelocalizeAndMap frames, then all sent to the front end in timestamp
+      // order (not dropped by the motion gate, the duplicate filter or the in-flight budget)
+      virtual void RelocalizeAndMapBatch(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::FramesBatch* request, ::com::bcom::solar::gprc::RelocalizationResults* response, std::function<void(::grpc::Status)>) = 0;
+      #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+      virtual void RelocalizeAndMapBatch(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::FramesBatch* request, ::com::bcom::solar::gprc::RelocalizationResults* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      #else
+      virtual void RelocalizeAndMapBatch(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::FramesBatch* request, ::com::bcom::solar::gprc::RelocalizationResults* response, ::grpc::experimental::ClientUnaryReactor* reactor) = 0;
+      #endif
       virtual void Get3DTransform(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::ClientUUID* request, ::com::bcom::solar::gprc::RelocalizationResult* response, std::function<void(::grpc::Status)>) = 0;
       #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
       virtual void Get3DTransform(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::ClientUUID* request, ::com::bcom::solar::gprc::RelocalizationResult* response, ::grpc::ClientUnaryReactor* reactor) = 0;
       #else
       virtual void Get3DTransform(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::ClientUUID* request, ::com::bcom::solar::gprc::RelocalizationResult* response, ::grpc::experimental::ClientUnaryReactor* reactor) = 0;
       #endif
+      // The last result of the client is streamed back at once, then each time the
+      // pose, its status or the mapping status changes (intermediate results may be
+      // skipped when the subscriber reads slower than the results are produced)
+      #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+      virtual void SubscribeTransforms(::grpc::ClientContext* context, ::com::bcom::solar::gprc::ClientUUID* request, ::grpc::ClientReadReactor< ::com::bcom::solar::gprc::RelocalizationResult>* reactor) = 0;
+      #else
+      virtual void SubscribeTransforms(::grpc::ClientContext* context, ::com::bcom::solar::gprc::ClientUUID* request, ::grpc::experimental::ClientReadReactor< ::com::bcom::solar::gprc::RelocalizationResult>* reactor) = 0;
+      #endif
+      // Latency of each processing stage and counters of the proxy, and of the
+      // client if a client UUID is given
+      virtual void GetStats(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::ClientUUID* request, ::com::bcom::solar::gprc::ProxyStatsResult* response, std::function<void(::grpc::Status)>) = 0;
+      #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+      virtual void GetStats(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::ClientUUID* request, ::com::bcom::solar::gprc::ProxyStatsResult* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      #else
+      virtual void GetStats(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::ClientUUID* request, ::com::bcom::solar::gprc::ProxyStatsResult* response, ::grpc::experimental::ClientUnaryReactor* reactor) = 0;
+      #endif
       virtual void Reset(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::Empty* request, ::com::bcom::solar::gprc::Empty* response, std::function<void(::grpc::Status)>) = 0;
       #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
       virtual void Reset(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::Empty* request, ::com::bcom::solar::gprc::Empty* response, ::grpc::ClientUnaryReactor* reactor) = 0;
@@ -254,8 +328,18 @@ class SolARMappingAndRelocalizationProxy final {
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::com::bcom::solar::gprc::RelocalizationResult>* PrepareAsyncRelocalizeAndMapRaw(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::Frames& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::com::bcom::solar::gprc::RelocalizationResult>* AsyncRelocalizeAndMapGroundTruthRaw(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::GroundTruthFrames& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::com::bcom::solar::gprc::RelocalizationResult>* PrepareAsyncRelocalizeAndMapGroundTruthRaw(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::GroundTruthFrames& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientReaderWriterInterface< ::com::bcom::solar::gprc::Frames, ::com::bcom::solar::gprc::RelocalizationResult>* RelocalizeAndMapStreamRaw(::grpc::ClientContext* context) = 0;
+    virtual ::grpc::ClientAsyncReaderWriterInterface< ::com::bcom::solar::gprc::Frames, ::com::bcom::solar::gprc::RelocalizationResult>* AsyncRelocalizeAndMapStreamRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag) = 0;
+    virtual ::grpc::ClientAsyncReaderWriterInterface< ::com::bcom::solar::gprc::Frames, ::com::bcom::solar::gprc::RelocalizationResult>* PrepareAsyncRelocalizeAndMapStreamRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::com::bcom::solar::gprc::RelocalizationResults>* AsyncRelocalizeAndMapBatchRaw(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::FramesBatch& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::com::bcom::solar::gprc::RelocalizationResults>* PrepareAsyncRelocalizeAndMapBatchRaw(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::FramesBatch& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::com::bcom::solar::gprc::RelocalizationResult>* AsyncGet3DTransformRaw(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::ClientUUID& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::com::bcom::solar::gprc::RelocalizationResult>* PrepareAsyncGet3DTransformRaw(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::ClientUUID& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientReaderInterface< ::com::bcom::solar::gprc::RelocalizationResult>* SubscribeTransformsRaw(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::ClientUUID& request) = 0;
+    virtual ::grpc::ClientAsyncReaderInterface< ::com::bcom::solar::gprc::RelocalizationResult>* AsyncSubscribeTransformsRaw(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::ClientUUID& request, ::grpc::CompletionQueue* cq, void* tag) = 0;
+    virtual ::grpc::ClientAsyncReaderInterface< ::com::bcom::solar::gprc::RelocalizationResult>* PrepareAsyncSubscribeTransformsRaw(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::ClientUUID& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::com::bcom::solar::gprc::ProxyStatsResult>* AsyncGetStatsRaw(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::ClientUUID& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::com::bcom::solar::gprc::ProxyStatsResult>* PrepareAsyncGetStatsRaw(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::ClientUUID& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::com::bcom::solar::gprc::Empty>* AsyncResetRaw(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::Empty& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::com::bcom::solar::gprc::Empty>* PrepareAsyncResetRaw(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::Empty& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::com::bcom::solar::gprc::Empty>* AsyncSendMessageRaw(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::Message& request, ::grpc::CompletionQueue* cq) = 0;
@@ -334,6 +418,22 @@ class SolARMappingAndRelocalizationProxy final {
     std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::com::bcom::solar::gprc::RelocalizationResult>> PrepareAsyncRelocalizeAndMapGroundTruth(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::GroundTruthFrames& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::com::bcom::solar::gprc::RelocalizationResult>>(PrepareAsyncRelocalizeAndMapGroundTruthRaw(context, request, cq));
     }
+    std::unique_ptr< ::grpc::ClientReaderWriter< ::com::bcom::solar::gprc::Frames, ::com::bcom::solar::gprc::RelocalizationResult>> RelocalizeAndMapStream(::grpc::ClientContext* context) {
+      return std::unique_ptr< ::grpc::ClientReaderWriter< ::com::bcom::solar::gprc::Frames, ::com::bcom::solar::gprc::RelocalizationResult>>(RelocalizeAndMapStreamRaw(context));
+    }
+    std::unique_ptr<  ::grpc::ClientAsyncReaderWriter< ::com::bcom::solar::gprc::Frames, ::com::bcom::solar::gprc::RelocalizationResult>> AsyncRelocalizeAndMapStream(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderWriter< ::com::bcom::solar::gprc::Frames, ::com::bcom::solar::gprc::RelocalizationResult>>(AsyncRelocalizeAndMapStreamRaw(context, cq, tag));
+    }
+    std::unique_ptr<  ::grpc::ClientAsyncReaderWriter< ::com::bcom::solar::gprc::Frames, ::com::bcom::solar::gprc::RelocalizationResult>> PrepareAsyncRelocalizeAndMapStream(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderWriter< ::com::bcom::solar::gprc::Frames, ::com::bcom::solar::gprc::RelocalizationResult>>(PrepareAsyncRelocalizeAndMapStreamRaw(context, cq));
+    }
+    ::grpc::Status RelocalizeAndMapBatch(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::FramesBatch& request, ::com::bcom::solar::gprc::RelocalizationResults* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::com::bcom::solar::gprc::RelocalizationResults>> AsyncRelocalizeAndMapBatch(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::FramesBatch& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::com::bcom::solar::gprc::RelocalizationResults>>(AsyncRelocalizeAndMapBatchRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::com::bcom::solar::gprc::RelocalizationResults>> PrepareAsyncRelocalizeAndMapBatch(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::FramesBatch& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::com::bcom::solar::gprc::RelocalizationResults>>(PrepareAsyncRelocalizeAndMapBatchRaw(context, request, cq));
+    }
     ::grpc::Status Get3DTransform(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::ClientUUID& request, ::com::bcom::solar::gprc::RelocalizationResult* response) override;
     std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::com::bcom::solar::gprc::RelocalizationResult>> AsyncGet3DTransform(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::ClientUUID& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::com::bcom::solar::gprc::RelocalizationResult>>(AsyncGet3DTransformRaw(context, request, cq));
@@ -341,6 +441,22 @@ class SolARMappingAndRelocalizationProxy final {
     std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::com::bcom::solar::gprc::RelocalizationResult>> PrepareAsyncGet3DTransform(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::ClientUUID& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::com::bcom::solar::gprc::RelocalizationResult>>(PrepareAsyncGet3DTransformRaw(context, request, cq));
     }
+    std::unique_ptr< ::grpc::ClientReader< ::com::bcom::solar::gprc::RelocalizationResult>> SubscribeTransforms(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::ClientUUID& request) {
+      return std::unique_ptr< ::grpc::ClientReader< ::com::bcom::solar::gprc::RelocalizationResult>>(SubscribeTransformsRaw(context, request));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReader< ::com::bcom::solar::gprc::RelocalizationResult>> AsyncSubscribeTransforms(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::ClientUUID& request, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncReader< ::com::bcom::solar::gprc::RelocalizationResult>>(AsyncSubscribeTransformsRaw(context, request, cq, tag));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReader< ::com::bcom::solar::gprc::RelocalizationResult>> PrepareAsyncSubscribeTransforms(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::ClientUUID& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncReader< ::com::bcom::solar::gprc::RelocalizationResult>>(PrepareAsyncSubscribeTransformsRaw(context, request, cq));
+    }
+    ::grpc::Status GetStats(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::ClientUUID& request, ::com::bcom::solar::gprc::ProxyStatsResult* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::com::bcom::solar::gprc::ProxyStatsResult>> AsyncGetStats(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::ClientUUID& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::com::bcom::solar::gprc::ProxyStatsResult>>(AsyncGetStatsRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::com::bcom::solar::gprc::ProxyStatsResult>> PrepareAsyncGetStats(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::ClientUUID& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::com::bcom::solar::gprc::ProxyStatsResult>>(PrepareAsyncGetStatsRaw(context, request, cq));
+    }
     ::grpc::Status Reset(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::Empty& request, ::com::bcom::solar::gprc::Empty* response) override;
     std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::com::bcom::solar::gprc::Empty>> AsyncReset(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::Empty& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::com::bcom::solar::gprc::Empty>>(AsyncResetRaw(context, request, cq));
@@ -418,12 +534,34 @@ class SolARMappingAndRelocalizationProxy final {
       #else
       void RelocalizeAndMapGroundTruth(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::GroundTruthFrames* request, ::com::bcom::solar::gprc::RelocalizationResult* response, ::grpc::experimental::ClientUnaryReactor* reactor) override;
       #endif
+      #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+      void RelocalizeAndMapStream(::grpc::ClientContext* context, ::grpc::ClientBidiReactor< ::com::bcom::solar::gprc::Frames,::com::bcom::solar::gprc::RelocalizationResult>* reactor) override;
+      #else
+      void RelocalizeAndMapStream(::grpc::ClientContext* context, ::grpc::experimental::ClientBidiReactor< ::com::bcom::solar::gprc::Frames,::com::bcom::solar::gprc::RelocalizationResult>* reactor) override;
+      #endif
+      void RelocalizeAndMapBatch(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::FramesBatch* request, ::com::bcom::solar::gprc::RelocalizationResults* response, std::function<void(::grpc::Status)>) override;
+      #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+      void RelocalizeAndMapBatch(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::FramesBatch* request, ::com::bcom::solar::gprc::RelocalizationResults* response, ::grpc::ClientUnaryReactor* reactor) override;
+      #else
+      void RelocalizeAndMapBatch(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::FramesBatch* request, ::com::bcom::solar::gprc::RelocalizationResults* response, ::grpc::experimental::ClientUnaryReactor* reactor) override;
+      #endif
       void Get3DTransform(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::ClientUUID* request, ::com::bcom::solar::gprc::RelocalizationResult* response, std::function<void(::grpc::Status)>) override;
       #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
       void Get3DTransform(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::ClientUUID* request, ::com::bcom::solar::gprc::RelocalizationResult* response, ::grpc::ClientUnaryReactor* reactor) override;
       #else
       void Get3DTransform(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::ClientUUID* request, ::com::bcom::solar::gprc::RelocalizationResult* response, ::grpc::experimental::ClientUnaryReactor* reactor) override;
       #endif
+      #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+      void SubscribeTransforms(::grpc::ClientContext* context, ::com::bcom::solar::gprc::ClientUUID* request, ::grpc::ClientReadReactor< ::com::bcom::solar::gprc::RelocalizationResult>* reactor) override;
+      #else
+      void SubscribeTransforms(::grpc::ClientContext* context, ::com::bcom::solar::gprc::ClientUUID* request, ::grpc::experimental::ClientReadReactor< ::com::bcom::solar::gprc::RelocalizationResult>* reactor) override;
+      #endif
+      void GetStats(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::ClientUUID* request, ::com::bcom::solar::gprc::ProxyStatsResult* response, std::function<void(::grpc::Status)>) override;
+      #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+      void GetStats(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::ClientUUID* request, ::com::bcom::solar::gprc::ProxyStatsResult* response, ::grpc::ClientUnaryReactor* reactor) override;
+      #else
+      void GetStats(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::ClientUUID* request, ::com::bcom::solar::gprc::ProxyStatsResult* response, ::grpc::experimental::ClientUnaryReactor* reactor) override;
+      #endif
       void Reset(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::Empty* request, ::com::bcom::solar::gprc::Empty* response, std::function<void(::grpc::Status)>) override;
       #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
       void Reset(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::Empty* request, ::com::bcom::solar::gprc::Empty* response, ::grpc::ClientUnaryReactor* reactor) override;
@@ -467,8 +605,18 @@ class SolARMappingAndRelocalizationProxy final {
     ::grpc::ClientAsyncResponseReader< ::com::bcom::solar::gprc::RelocalizationResult>* PrepareAsyncRelocalizeAndMapRaw(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::Frames& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::com::bcom::solar::gprc::RelocalizationResult>* AsyncRelocalizeAndMapGroundTruthRaw(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::GroundTruthFrames& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::com::bcom::solar::gprc::RelocalizationResult>* PrepareAsyncRelocalizeAndMapGroundTruthRaw(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::GroundTruthFrames& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientReaderWriter< ::com::bcom::solar::gprc::Frames, ::com::bcom::solar::gprc::RelocalizationResult>* RelocalizeAndMapStreamRaw(::grpc::ClientContext* context) override;
+    ::grpc::ClientAsyncReaderWriter< ::com::bcom::solar::gprc::Frames, ::com::bcom::solar::gprc::RelocalizationResult>* AsyncRelocalizeAndMapStreamRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag) override;
+    ::grpc::ClientAsyncReaderWriter< ::com::bcom::solar::gprc::Frames, ::com::bcom::solar::gprc::RelocalizationResult>* PrepareAsyncRelocalizeAndMapStreamRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::com::bcom::solar::gprc::RelocalizationResults>* AsyncRelocalizeAndMapBatchRaw(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::FramesBatch& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::com::bcom::solar::gprc::RelocalizationResults>* PrepareAsyncRelocalizeAndMapBatchRaw(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::FramesBatch& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::com::bcom::solar::gprc::RelocalizationResult>* AsyncGet3DTransformRaw(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::ClientUUID& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::com::bcom::solar::gprc::RelocalizationResult>* PrepareAsyncGet3DTransformRaw(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::ClientUUID& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientReader< ::com::bcom::solar::gprc::RelocalizationResult>* SubscribeTransformsRaw(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::ClientUUID& request) override;
+    ::grpc::ClientAsyncReader< ::com::bcom::solar::gprc::RelocalizationResult>* AsyncSubscribeTransformsRaw(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::ClientUUID& request, ::grpc::CompletionQueue* cq, void* tag) override;
+    ::grpc::ClientAsyncReader< ::com::bcom::solar::gprc::RelocalizationResult>* PrepareAsyncSubscribeTransformsRaw(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::ClientUUID& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::com::bcom::solar::gprc::ProxyStatsResult>* AsyncGetStatsRaw(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::ClientUUID& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::com::bcom::solar::gprc::ProxyStatsResult>* PrepareAsyncGetStatsRaw(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::ClientUUID& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::com::bcom::solar::gprc::Empty>* AsyncResetRaw(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::Empty& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::com::bcom::solar::gprc::Empty>* PrepareAsyncResetRaw(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::Empty& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::com::bcom::solar::gprc::Empty>* AsyncSendMessageRaw(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::Message& request, ::grpc::CompletionQueue* cq) override;
@@ -483,7 +631,11 @@ class SolARMappingAndRelocalizationProxy final {
     const ::grpc::internal::RpcMethod rpcmethod_setRectificationParameters_;
     const ::grpc::internal::RpcMethod rpcmethod_RelocalizeAndMap_;
     const ::grpc::internal::RpcMethod rpcmethod_RelocalizeAndMapGroundTruth_;
+    const ::grpc::internal::RpcMethod rpcmethod_RelocalizeAndMapStream_;
+    const ::grpc::internal::RpcMethod rpcmethod_RelocalizeAndMapBatch_;
     const ::grpc::internal::RpcMethod rpcmethod_Get3DTransform_;
+    const ::grpc::internal::RpcMethod rpcmethod_SubscribeTransforms_;
+    const ::grpc::internal::RpcMethod rpcmethod_GetStats_;
     const ::grpc::internal::RpcMethod rpcmethod_Reset_;
     const ::grpc::internal::RpcMethod rpcmethod_SendMessage_;
   };
@@ -503,7 +655,21 @@ class SolARMappingAndRelocalizationProxy final {
     virtual ::grpc::Status setRectificationParameters(::grpc::ServerContext* context, const ::com::bcom::solar::gprc::RectificationParameters* request, ::com::bcom::solar::gprc::Empty* response);
     virtual ::grpc::Status RelocalizeAndMap(::grpc::ServerContext* context, const ::com::bcom::solar::gprc::Frames* request, ::com::bcom::solar::gprc::RelocalizationResult* response);
     virtual ::grpc::Status RelocalizeAndMapGroundTruth(::grpc::ServerContext* context, const ::com::bcom::solar::gprc::GroundTruthFrames* request, ::com::bcom::solar::gprc::RelocalizationResult* response);
+    // Frames are streamed by the client, a result is streamed back for each frame
+    // processed by the pipeline (identified by its timestamp)
+    virtual ::grpc::Status RelocalizeAndMapStream(::grpc::ServerContext* context, ::grpc::ServerReaderWriter< ::com::bcom::solar::gprc::RelocalizationResult, ::com::bcom::solar::gprc::Frames>* stream);
+    // Frames sent at once (backlog of a client after a network stall), reordered
+    // like RelocalizeAndMap frames, then all sent to the front end in timestamp
+    // order (not dropped by the motion gate, the duplicate filter or the in-flight budget)
+    virtual ::grpc::Status RelocalizeAndMapBatch(::grpc::ServerContext* context, const ::com::bcom::solar::gprc::FramesBatch* request, ::com::bcom::solar::gprc::RelocalizationResults* response);
     virtual ::grpc::Status Get3DTransform(::grpc::ServerContext* context, const ::com::bcom::solar::gprc::ClientUUID* request, ::com::bcom::solar::gprc::RelocalizationResult* response);
+    // The last result of the client is streamed back at once, then each time the
+    // pose, its status or the mapping status changes (intermediate results may be
+    // skipped when the subscriber reads slower than the results are produced)
+    virtual ::grpc::Status SubscribeTransforms(::grpc::ServerContext* context, const ::com::bcom::solar::gprc::ClientUUID* request, ::grpc::ServerWriter< ::com::bcom::solar::gprc::RelocalizationResult>* writer);
+    // Latency of each processing stage and counters of the proxy, and of the
+    // client if a client UUID is given
+    virtual ::grpc::Status GetStats(::grpc::ServerContext* context, const ::com::bcom::solar::gprc::ClientUUID* request, ::com::bcom::solar::gprc::ProxyStatsResult* response);
     virtual ::grpc::Status Reset(::grpc::ServerContext* context, const ::com::bcom::solar::gprc::Empty* request, ::com::bcom::solar::gprc::Empty* response);
     virtual ::grpc::Status SendMessage(::grpc::ServerContext* context, const ::com::bcom::solar::gprc::Message* request, ::com::bcom::solar::gprc::Empty* response);
   };
@@ -708,12 +874,52 @@ class SolARMappingAndRelocalizationProxy final {
     }
   };
   template <class BaseClass>
+  class WithAsyncMethod_RelocalizeAndMapStream : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_RelocalizeAndMapStream() {
+      ::grpc::Service::MarkMethodAsync(10);
+    }
+    ~WithAsyncMethod_RelocalizeAndMapStream() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status RelocalizeAndMapStream(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::com::bcom::solar::gprc::RelocalizationResult, ::com::bcom::solar::gprc::Frames>* /*stream*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestRelocalizeAndMapStream(::grpc::ServerContext* context, ::grpc::ServerAsyncReaderWriter< ::com::bcom::solar::gprc::RelocalizationResult, ::com::bcom::solar::gprc::Frames>* stream, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncBidiStreaming(10, context, stream, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_RelocalizeAndMapBatch : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_RelocalizeAndMapBatch() {
+      ::grpc::Service::MarkMethodAsync(11);
+    }
+    ~WithAsyncMethod_RelocalizeAndMapBatch() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status RelocalizeAndMapBatch(::grpc::ServerContext* /*context*/, const ::com::bcom::solar::gprc::FramesBatch* /*request*/, ::com::bcom::solar::gprc::RelocalizationResults* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestRelocalizeAndMapBatch(::grpc::ServerContext* context, ::com::bcom::solar::gprc::FramesBatch* request, ::grpc::ServerAsyncResponseWriter< ::com::bcom::solar::gprc::RelocalizationResults>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(11, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
   class WithAsyncMethod_Get3DTransform : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithAsyncMethod_Get3DTransform() {
-      ::grpc::Service::MarkMethodAsync(10);
+      ::grpc::Service::MarkMethodAsync(12);
     }
     ~WithAsyncMethod_Get3DTransform() override {
       BaseClassMustBeDerivedFromService(this);
@@ -724,7 +930,47 @@ class SolARMappingAndRelocalizationProxy final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void RequestGet3DTransform(::grpc::ServerContext* context, ::com::bcom::solar::gprc::ClientUUID* request, ::grpc::ServerAsyncResponseWriter< ::com::bcom::solar::gprc::RelocalizationResult>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(10, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(12, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_SubscribeTransforms : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_SubscribeTransforms() {
+      ::grpc::Service::MarkMethodAsync(13);
+    }
+    ~WithAsyncMethod_SubscribeTransforms() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SubscribeTransforms(::grpc::ServerContext* /*context*/, const ::com::bcom::solar::gprc::ClientUUID* /*request*/, ::grpc::ServerWriter< ::com::bcom::solar::gprc::RelocalizationResult>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestSubscribeTransforms(::grpc::ServerContext* context, ::com::bcom::solar::gprc::ClientUUID* request, ::grpc::ServerAsyncWriter< ::com::bcom::solar::gprc::RelocalizationResult>* writer, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncServerStreaming(13, context, request, writer, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_GetStats : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_GetStats() {
+      ::grpc::Service::MarkMethodAsync(14);
+    }
+    ~WithAsyncMethod_GetStats() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetStats(::grpc::ServerContext* /*context*/, const ::com::bcom::solar::gprc::ClientUUID* /*request*/, ::com::bcom::solar::gprc::ProxyStatsResult* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestGetStats(::grpc::ServerContext* context, ::com::bcom::solar::gprc::ClientUUID* request, ::grpc::ServerAsyncResponseWriter< ::com::bcom::solar::gprc::ProxyStatsResult>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(14, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
@@ -733,7 +979,7 @@ class SolARMappingAndRelocalizationProxy final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithAsyncMethod_Reset() {
-      ::grpc::Service::MarkMethodAsync(11);
+      ::grpc::Service::MarkMethodAsync(15);
     }
     ~WithAsyncMethod_Reset() override {
       BaseClassMustBeDerivedFromService(this);
@@ -744,7 +990,7 @@ class SolARMappingAndRelocalizationProxy final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void RequestReset(::grpc::ServerContext* context, ::com::bcom::solar::gprc::Empty* request, ::grpc::ServerAsyncResponseWriter< ::com::bcom::solar::gprc::Empty>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(11, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(15, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
@@ -753,7 +999,7 @@ class SolARMappingAndRelocalizationProxy final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithAsyncMethod_SendMessage() {
-      ::grpc::Service::MarkMethodAsync(12);
+      ::grpc::Service::MarkMethodAsync(16);
     }
     ~WithAsyncMethod_SendMessage() override {
       BaseClassMustBeDerivedFromService(this);
@@ -764,10 +1010,10 @@ class SolARMappingAndRelocalizationProxy final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void RequestSendMessage(::grpc::ServerContext* context, ::com::bcom::solar::gprc::Message* request, ::grpc::ServerAsyncResponseWriter< ::com::bcom::solar::gprc::Empty>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(12, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(16, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
-  typedef WithAsyncMethod_RegisterClient<WithAsyncMethod_UnregisterClient<WithAsyncMethod_Init<WithAsyncMethod_Start<WithAsyncMethod_Stop<WithAsyncMethod_SetCameraParameters<WithAsyncMethod_SetCameraParametersStereo<WithAsyncMethod_setRectificationParameters<WithAsyncMethod_RelocalizeAndMap<WithAsyncMethod_RelocalizeAndMapGroundTruth<WithAsyncMethod_Get3DTransform<WithAsyncMethod_Reset<WithAsyncMethod_SendMessage<Service > > > > > > > > > > > > > AsyncService;
+  typedef WithAsyncMethod_RegisterClient<WithAsyncMethod_UnregisterClient<WithAsyncMethod_Init<WithAsyncMethod_Start<WithAsyncMethod_Stop<WithAsyncMethod_SetCameraParameters<WithAsyncMethod_SetCameraParametersStereo<WithAsyncMethod_setRectificationParameters<WithAsyncMethod_RelocalizeAndMap<WithAsyncMethod_RelocalizeAndMapGroundTruth<WithAsyncMethod_RelocalizeAndMapStream<WithAsyncMethod_RelocalizeAndMapBatch<WithAsyncMethod_Get3DTransform<WithAsyncMethod_SubscribeTransforms<WithAsyncMethod_GetStats<WithAsyncMethod_Reset<WithAsyncMethod_SendMessage<Service > > > > > > > > > > > > > > > > > AsyncService;
   template <class BaseClass>
   class ExperimentalWithCallbackMethod_RegisterClient : public BaseClass {
    private:
@@ -1239,6 +1485,91 @@ class SolARMappingAndRelocalizationProxy final {
       { return nullptr; }
   };
   template <class BaseClass>
+  class ExperimentalWithCallbackMethod_RelocalizeAndMapStream : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    ExperimentalWithCallbackMethod_RelocalizeAndMapStream() {
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+      ::grpc::Service::
+    #else
+      ::grpc::Service::experimental().
+    #endif
+        MarkMethodCallback(10,
+          new ::grpc::internal::CallbackBidiHandler< ::com::bcom::solar::gprc::Frames, ::com::bcom::solar::gprc::RelocalizationResult>(
+            [this](
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+                   ::grpc::CallbackServerContext*
+    #else
+                   ::grpc::experimental::CallbackServerContext*
+    #endif
+                     context) { return this->RelocalizeAndMapStream(context); }));
+    }
+    ~ExperimentalWithCallbackMethod_RelocalizeAndMapStream() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status RelocalizeAndMapStream(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::com::bcom::solar::gprc::RelocalizationResult, ::com::bcom::solar::gprc::Frames>* /*stream*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+    virtual ::grpc::ServerBidiReactor< ::com::bcom::solar::gprc::Frames, ::com::bcom::solar::gprc::RelocalizationResult>* RelocalizeAndMapStream(
+      ::grpc::CallbackServerContext* /*context*/)
+    #else
+    virtual ::grpc::experimental::ServerBidiReactor< ::com::bcom::solar::gprc::Frames, ::com::bcom::solar::gprc::RelocalizationResult>* RelocalizeAndMapStream(
+      ::grpc::experimental::CallbackServerContext* /*context*/)
+    #endif
+      { return nullptr; }
+  };
+  template <class BaseClass>
+  class ExperimentalWithCallbackMethod_RelocalizeAndMapBatch : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    ExperimentalWithCallbackMethod_RelocalizeAndMapBatch() {
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+      ::grpc::Service::
+    #else
+      ::grpc::Service::experimental().
+    #endif
+        MarkMethodCallback(11,
+          new ::grpc::internal::CallbackUnaryHandler< ::com::bcom::solar::gprc::FramesBatch, ::com::bcom::solar::gprc::RelocalizationResults>(
+            [this](
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+                   ::grpc::CallbackServerContext*
+    #else
+                   ::grpc::experimental::CallbackServerContext*
+    #endif
+                     context, const ::com::bcom::solar::gprc::FramesBatch* request, ::com::bcom::solar::gprc::RelocalizationResults* response) { return this->RelocalizeAndMapBatch(context, request, response); }));}
+    void SetMessageAllocatorFor_RelocalizeAndMapBatch(
+        ::grpc::experimental::MessageAllocator< ::com::bcom::solar::gprc::FramesBatch, ::com::bcom::solar::gprc::RelocalizationResults>* allocator) {
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(11);
+    #else
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::experimental().GetHandler(11);
+    #endif
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::com::bcom::solar::gprc::FramesBatch, ::com::bcom::solar::gprc::RelocalizationResults>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~ExperimentalWithCallbackMethod_RelocalizeAndMapBatch() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status RelocalizeAndMapBatch(::grpc::ServerContext* /*context*/, const ::com::bcom::solar::gprc::FramesBatch* /*request*/, ::com::bcom::solar::gprc::RelocalizationResults* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+    virtual ::grpc::ServerUnaryReactor* RelocalizeAndMapBatch(
+      ::grpc::CallbackServerContext* /*context*/, const ::com::bcom::solar::gprc::FramesBatch* /*request*/, ::com::bcom::solar::gprc::RelocalizationResults* /*response*/)
+    #else
+    virtual ::grpc::experimental::ServerUnaryReactor* RelocalizeAndMapBatch(
+      ::grpc::experimental::CallbackServerContext* /*context*/, const ::com::bcom::solar::gprc::FramesBatch* /*request*/, ::com::bcom::solar::gprc::RelocalizationResults* /*response*/)
+    #endif
+      { return nullptr; }
+  };
+  template <class BaseClass>
   class ExperimentalWithCallbackMethod_Get3DTransform : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
@@ -1249,7 +1580,7 @@ class SolARMappingAndRelocalizationProxy final {
     #else
       ::grpc::Service::experimental().
     #endif
-        MarkMethodCallback(10,
+        MarkMethodCallback(12,
           new ::grpc::internal::CallbackUnaryHandler< ::com::bcom::solar::gprc::ClientUUID, ::com::bcom::solar::gprc::RelocalizationResult>(
             [this](
     #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
@@ -1261,9 +1592,9 @@ class SolARMappingAndRelocalizationProxy final {
     void SetMessageAllocatorFor_Get3DTransform(
         ::grpc::experimental::MessageAllocator< ::com::bcom::solar::gprc::ClientUUID, ::com::bcom::solar::gprc::RelocalizationResult>* allocator) {
     #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(10);
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(12);
     #else
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::experimental().GetHandler(10);
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::experimental().GetHandler(12);
     #endif
       static_cast<::grpc::internal::CallbackUnaryHandler< ::com::bcom::solar::gprc::ClientUUID, ::com::bcom::solar::gprc::RelocalizationResult>*>(handler)
               ->SetMessageAllocator(allocator);
@@ -1286,6 +1617,91 @@ class SolARMappingAndRelocalizationProxy final {
       { return nullptr; }
   };
   template <class BaseClass>
+  class ExperimentalWithCallbackMethod_SubscribeTransforms : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    ExperimentalWithCallbackMethod_SubscribeTransforms() {
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+      ::grpc::Service::
+    #else
+      ::grpc::Service::experimental().
+    #endif
+        MarkMethodCallback(13,
+          new ::grpc::internal::CallbackServerStreamingHandler< ::com::bcom::solar::gprc::ClientUUID, ::com::bcom::solar::gprc::RelocalizationResult>(
+            [this](
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+                   ::grpc::CallbackServerContext*
+    #else
+                   ::grpc::experimental::CallbackServerContext*
+    #endif
+                     context, const ::com::bcom::solar::gprc::ClientUUID* request) { return this->SubscribeTransforms(context, request); }));
+    }
+    ~ExperimentalWithCallbackMethod_SubscribeTransforms() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SubscribeTransforms(::grpc::ServerContext* /*context*/, const ::com::bcom::solar::gprc::ClientUUID* /*request*/, ::grpc::ServerWriter< ::com::bcom::solar::gprc::RelocalizationResult>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+    virtual ::grpc::ServerWriteReactor< ::com::bcom::solar::gprc::RelocalizationResult>* SubscribeTransforms(
+      ::grpc::CallbackServerContext* /*context*/, const ::com::bcom::solar::gprc::ClientUUID* /*request*/)
+    #else
+    virtual ::grpc::experimental::ServerWriteReactor< ::com::bcom::solar::gprc::RelocalizationResult>* SubscribeTransforms(
+      ::grpc::experimental::CallbackServerContext* /*context*/, const ::com::bcom::solar::gprc::ClientUUID* /*request*/)
+    #endif
+      { return nullptr; }
+  };
+  template <class BaseClass>
+  class ExperimentalWithCallbackMethod_GetStats : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    ExperimentalWithCallbackMethod_GetStats() {
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+      ::grpc::Service::
+    #else
+      ::grpc::Service::experimental().
+    #endif
+        MarkMethodCallback(14,
+          new ::grpc::internal::CallbackUnaryHandler< ::com::bcom::solar::gprc::ClientUUID, ::com::bcom::solar::gprc::ProxyStatsResult>(
+            [this](
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+                   ::grpc::CallbackServerContext*
+    #else
+                   ::grpc::experimental::CallbackServerContext*
+    #endif
+                     context, const ::com::bcom::solar::gprc::ClientUUID* request, ::com::bcom::solar::gprc::ProxyStatsResult* response) { return this->GetStats(context, request, response); }));}
+    void SetMessageAllocatorFor_GetStats(
+        ::grpc::experimental::MessageAllocator< ::com::bcom::solar::gprc::ClientUUID, ::com::bcom::solar::gprc::ProxyStatsResult>* allocator) {
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(14);
+    #else
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::experimental().GetHandler(14);
+    #endif
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::com::bcom::solar::gprc::ClientUUID, ::com::bcom::solar::gprc::ProxyStatsResult>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~ExperimentalWithCallbackMethod_GetStats() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetStats(::grpc::ServerContext* /*context*/, const ::com::bcom::solar::gprc::ClientUUID* /*request*/, ::com::bcom::solar::gprc::ProxyStatsResult* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+    virtual ::grpc::ServerUnaryReactor* GetStats(
+      ::grpc::CallbackServerContext* /*context*/, const ::com::bcom::solar::gprc::ClientUUID* /*request*/, ::com::bcom::solar::gprc::ProxyStatsResult* /*response*/)
+    #else
+    virtual ::grpc::experimental::ServerUnaryReactor* GetStats(
+      ::grpc::experimental::CallbackServerContext* /*context*/, const ::com::bcom::solar::gprc::ClientUUID* /*request*/, ::com::bcom::solar::gprc::ProxyStatsResult* /*response*/)
+    #endif
+      { return nullptr; }
+  };
+  template <class BaseClass>
   class ExperimentalWithCallbackMethod_Reset : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
@@ -1296,7 +1712,7 @@ class SolARMappingAndRelocalizationProxy final {
     #else
       ::grpc::Service::experimental().
     #endif
-        MarkMethodCallback(11,
+        MarkMethodCallback(15,
           new ::grpc::internal::CallbackUnaryHandler< ::com::bcom::solar::gprc::Empty, ::com::bcom::solar::gprc::Empty>(
             [this](
     #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
@@ -1308,9 +1724,9 @@ class SolARMappingAndRelocalizationProxy final {
     void SetMessageAllocatorFor_Reset(
         ::grpc::experimental::MessageAllocator< ::com::bcom::solar::gprc::Empty, ::com::bcom::solar::gprc::Empty>* allocator) {
     #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(11);
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(15);
     #else
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::experimental().GetHandler(11);
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::experimental().GetHandler(15);
     #endif
       static_cast<::grpc::internal::CallbackUnaryHandler< ::com::bcom::solar::gprc::Empty, ::com::bcom::solar::gprc::Empty>*>(handler)
               ->SetMessageAllocator(allocator);
@@ -1343,7 +1759,7 @@ class SolARMappingAndRelocalizationProxy final {
     #else
       ::grpc::Service::experimental().
     #endif
-        MarkMethodCallback(12,
+        MarkMethodCallback(16,
           new ::grpc::internal::CallbackUnaryHandler< ::com::bcom::solar::gprc::Message, ::com::bcom::solar::gprc::Empty>(
             [this](
     #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
@@ -1355,9 +1771,9 @@ class SolARMappingAndRelocalizationProxy final {
     void SetMessageAllocatorFor_SendMessage(
         ::grpc::experimental::MessageAllocator< ::com::bcom::solar::gprc::Message, ::com::bcom::solar::gprc::Empty>* allocator) {
     #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(12);
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(16);
     #else
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::experimental().GetHandler(12);
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::experimental().GetHandler(16);
     #endif
       static_cast<::grpc::internal::CallbackUnaryHandler< ::com::bcom::solar::gprc::Message, ::com::bcom::solar::gprc::Empty>*>(handler)
               ->SetMessageAllocator(allocator);
@@ -1380,10 +1796,10 @@ class SolARMappingAndRelocalizationProxy final {
       { return nullptr; }
   };
   #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
-  typedef ExperimentalWithCallbackMethod_RegisterClient<ExperimentalWithCallbackMethod_UnregisterClient<ExperimentalWithCallbackMethod_Init<ExperimentalWithCallbackMethod_Start<ExperimentalWithCallbackMethod_Stop<ExperimentalWithCallbackMethod_SetCameraParameters<ExperimentalWithCallbackMethod_SetCameraParametersStereo<ExperimentalWithCallbackMethod_setRectificationParameters<ExperimentalWithCallbackMethod_RelocalizeAndMap<ExperimentalWithCallbackMethod_RelocalizeAndMapGroundTruth<ExperimentalWithCallbackMethod_Get3DTransform<ExperimentalWithCallbackMethod_Reset<ExperimentalWithCallbackMethod_SendMessage<Service > > > > > > > > > > > > > CallbackService;
+  typedef ExperimentalWithCallbackMethod_RegisterClient<ExperimentalWithCallbackMethod_UnregisterClient<ExperimentalWithCallbackMethod_Init<ExperimentalWithCallbackMethod_Start<ExperimentalWithCallbackMethod_Stop<ExperimentalWithCallbackMethod_SetCameraParameters<ExperimentalWithCallbackMethod_SetCameraParametersStereo<ExperimentalWithCallbackMethod_setRectificationParameters<ExperimentalWithCallbackMethod_RelocalizeAndMap<ExperimentalWithCallbackMethod_RelocalizeAndMapGroundTruth<ExperimentalWithCallbackMethod_RelocalizeAndMapStream<ExperimentalWithCallbackMethod_RelocalizeAndMapBatch<ExperimentalWithCallbackMethod_Get3DTransform<ExperimentalWithCallbackMethod_SubscribeTransforms<ExperimentalWithCallbackMethod_GetStats<ExperimentalWithCallbackMethod_Reset<ExperimentalWithCallbackMethod_SendMessage<Service > > > > > > > > > > > > > > > > > CallbackService;
   #endif
 
-  typedef ExperimentalWithCallbackMethod_RegisterClient<ExperimentalWithCallbackMethod_UnregisterClient<ExperimentalWithCallbackMethod_Init<ExperimentalWithCallbackMethod_Start<ExperimentalWithCallbackMethod_Stop<ExperimentalWithCallbackMethod_SetCameraParameters<ExperimentalWithCallbackMethod_SetCameraParametersStereo<ExperimentalWithCallbackMethod_setRectificationParameters<ExperimentalWithCallbackMethod_RelocalizeAndMap<ExperimentalWithCallbackMethod_RelocalizeAndMapGroundTruth<ExperimentalWithCallbackMethod_Get3DTransform<ExperimentalWithCallbackMethod_Reset<ExperimentalWithCallbackMethod_SendMessage<Service > > > > > > > > > > > > > ExperimentalCallbackService;
+  typedef ExperimentalWithCallbackMethod_RegisterClient<ExperimentalWithCallbackMethod_UnregisterClient<ExperimentalWithCallbackMethod_Init<ExperimentalWithCallbackMethod_Start<ExperimentalWithCallbackMethod_Stop<ExperimentalWithCallbackMethod_SetCameraParameters<ExperimentalWithCallbackMethod_SetCameraParametersStereo<ExperimentalWithCallbackMethod_setRectificationParameters<ExperimentalWithCallbackMethod_RelocalizeAndMap<ExperimentalWithCallbackMethod_RelocalizeAndMapGroundTruth<ExperimentalWithCallbackMethod_RelocalizeAndMapStream<ExperimentalWithCallbackMethod_RelocalizeAndMapBatch<ExperimentalWithCallbackMethod_Get3DTransform<ExperimentalWithCallbackMethod_SubscribeTransforms<ExperimentalWithCallbackMethod_GetStats<ExperimentalWithCallbackMethod_Reset<ExperimentalWithCallbackMethod_SendMessage<Service > > > > > > > > > > > > > > > > > ExperimentalCallbackService;
   template <class BaseClass>
   class WithGenericMethod_RegisterClient : public BaseClass {
    private:
@@ -1555,65 +1971,133 @@ class SolARMappingAndRelocalizationProxy final {
     }
   };
   template <class BaseClass>
-  class WithGenericMethod_Get3DTransform : public BaseClass {
+  class WithGenericMethod_RelocalizeAndMapStream : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithGenericMethod_Get3DTransform() {
+    WithGenericMethod_RelocalizeAndMapStream() {
       ::grpc::Service::MarkMethodGeneric(10);
     }
-    ~WithGenericMethod_Get3DTransform() override {
+    ~WithGenericMethod_RelocalizeAndMapStream() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status Get3DTransform(::grpc::ServerContext* /*context*/, const ::com::bcom::solar::gprc::ClientUUID* /*request*/, ::com::bcom::solar::gprc::RelocalizationResult* /*response*/) override {
+    ::grpc::Status RelocalizeAndMapStream(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::com::bcom::solar::gprc::RelocalizationResult, ::com::bcom::solar::gprc::Frames>* /*stream*/)  override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
   };
   template <class BaseClass>
-  class WithGenericMethod_Reset : public BaseClass {
+  class WithGenericMethod_RelocalizeAndMapBatch : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithGenericMethod_Reset() {
+    WithGenericMethod_RelocalizeAndMapBatch() {
       ::grpc::Service::MarkMethodGeneric(11);
     }
-    ~WithGenericMethod_Reset() override {
+    ~WithGenericMethod_RelocalizeAndMapBatch() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status Reset(::grpc::ServerContext* /*context*/, const ::com::bcom::solar::gprc::Empty* /*request*/, ::com::bcom::solar::gprc::Empty* /*response*/) override {
+    ::grpc::Status RelocalizeAndMapBatch(::grpc::ServerContext* /*context*/, const ::com::bcom::solar::gprc::FramesBatch* /*request*/, ::com::bcom::solar::gprc::RelocalizationResults* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
   };
   template <class BaseClass>
-  class WithGenericMethod_SendMessage : public BaseClass {
+  class WithGenericMethod_Get3DTransform : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithGenericMethod_SendMessage() {
+    WithGenericMethod_Get3DTransform() {
       ::grpc::Service::MarkMethodGeneric(12);
     }
-    ~WithGenericMethod_SendMessage() override {
+    ~WithGenericMethod_Get3DTransform() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status SendMessage(::grpc::ServerContext* /*context*/, const ::com::bcom::solar::gprc::Message* /*request*/, ::com::bcom::solar::gprc::Empty* /*response*/) override {
+    ::grpc::Status Get3DTransform(::grpc::ServerContext* /*context*/, const ::com::bcom::solar::gprc::ClientUUID* /*request*/, ::com::bcom::solar::gprc::RelocalizationResult* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
   };
   template <class BaseClass>
-  class WithRawMethod_RegisterClient : public BaseClass {
+  class WithGenericMethod_SubscribeTransforms : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithRawMethod_RegisterClient() {
-      ::grpc::Service::MarkMethodRaw(0);
+    WithGenericMethod_SubscribeTransforms() {
+      ::grpc::Service::MarkMethodGeneric(13);
     }
-    ~WithRawMethod_RegisterClient() override {
+    ~WithGenericMethod_SubscribeTransforms() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SubscribeTransforms(::grpc::ServerContext* /*context*/, const ::com::bcom::solar::gprc::ClientUUID* /*request*/, ::grpc::ServerWriter< ::com::bcom::solar::gprc::RelocalizationResult>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_GetStats : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_GetStats() {
+      ::grpc::Service::MarkMethodGeneric(14);
+    }
+    ~WithGenericMethod_GetStats() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetStats(::grpc::ServerContext* /*context*/, const ::com::bcom::solar::gprc::ClientUUID* /*request*/, ::com::bcom::solar::gprc::ProxyStatsResult* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_Reset : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_Reset() {
+      ::grpc::Service::MarkMethodGeneric(15);
+    }
+    ~WithGenericMethod_Reset() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status Reset(::grpc::ServerContext* /*context*/, const ::com::bcom::solar::gprc::Empty* /*request*/, ::com::bcom::solar::gprc::Empty* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_SendMessage : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_SendMessage() {
+      ::grpc::Service::MarkMethodGeneric(16);
+    }
+    ~WithGenericMethod_SendMessage() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SendMessage(::grpc::ServerContext* /*context*/, const ::com::bcom::solar::gprc::Message* /*request*/, ::com::bcom::solar::gprc::Empty* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_RegisterClient : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_RegisterClient() {
+      ::grpc::Service::MarkMethodRaw(0);
+    }
+    ~WithRawMethod_RegisterClient() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
@@ -1806,12 +2290,52 @@ class SolARMappingAndRelocalizationProxy final {
     }
   };
   template <class BaseClass>
+  class WithRawMethod_RelocalizeAndMapStream : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_RelocalizeAndMapStream() {
+      ::grpc::Service::MarkMethodRaw(10);
+    }
+    ~WithRawMethod_RelocalizeAndMapStream() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status RelocalizeAndMapStream(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::com::bcom::solar::gprc::RelocalizationResult, ::com::bcom::solar::gprc::Frames>* /*stream*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestRelocalizeAndMapStream(::grpc::ServerContext* context, ::grpc::ServerAsyncReaderWriter< ::grpc::ByteBuffer, ::grpc::ByteBuffer>* stream, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncBidiStreaming(10, context, stream, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_RelocalizeAndMapBatch : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_RelocalizeAndMapBatch() {
+      ::grpc::Service::MarkMethodRaw(11);
+    }
+    ~WithRawMethod_RelocalizeAndMapBatch() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status RelocalizeAndMapBatch(::grpc::ServerContext* /*context*/, const ::com::bcom::solar::gprc::FramesBatch* /*request*/, ::com::bcom::solar::gprc::RelocalizationResults* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestRelocalizeAndMapBatch(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(11, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
   class WithRawMethod_Get3DTransform : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithRawMethod_Get3DTransform() {
-      ::grpc::Service::MarkMethodRaw(10);
+      ::grpc::Service::MarkMethodRaw(12);
     }
     ~WithRawMethod_Get3DTransform() override {
       BaseClassMustBeDerivedFromService(this);
@@ -1822,7 +2346,47 @@ class SolARMappingAndRelocalizationProxy final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void RequestGet3DTransform(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(10, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(12, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_SubscribeTransforms : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_SubscribeTransforms() {
+      ::grpc::Service::MarkMethodRaw(13);
+    }
+    ~WithRawMethod_SubscribeTransforms() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SubscribeTransforms(::grpc::ServerContext* /*context*/, const ::com::bcom::solar::gprc::ClientUUID* /*request*/, ::grpc::ServerWriter< ::com::bcom::solar::gprc::RelocalizationResult>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestSubscribeTransforms(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncWriter< ::grpc::ByteBuffer>* writer, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncServerStreaming(13, context, request, writer, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_GetStats : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_GetStats() {
+      ::grpc::Service::MarkMethodRaw(14);
+    }
+    ~WithRawMethod_GetStats() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetStats(::grpc::ServerContext* /*context*/, const ::com::bcom::solar::gprc::ClientUUID* /*request*/, ::com::bcom::solar::gprc::ProxyStatsResult* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestGetStats(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(14, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
@@ -1831,7 +2395,7 @@ class SolARMappingAndRelocalizationProxy final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithRawMethod_Reset() {
-      ::grpc::Service::MarkMethodRaw(11);
+      ::grpc::Service::MarkMethodRaw(15);
     }
     ~WithRawMethod_Reset() override {
       BaseClassMustBeDerivedFromService(this);
@@ -1842,7 +2406,7 @@ class SolARMappingAndRelocalizationProxy final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void RequestReset(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(11, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(15, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
@@ -1851,7 +2415,7 @@ class SolARMappingAndRelocalizationProxy final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithRawMethod_SendMessage() {
-      ::grpc::Service::MarkMethodRaw(12);
+      ::grpc::Service::MarkMethodRaw(16);
     }
     ~WithRawMethod_SendMessage() override {
       BaseClassMustBeDerivedFromService(this);
@@ -1862,7 +2426,7 @@ class SolARMappingAndRelocalizationProxy final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void RequestSendMessage(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(12, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(16, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
@@ -2246,6 +2810,82 @@ class SolARMappingAndRelocalizationProxy final {
       { return nullptr; }
   };
   template <class BaseClass>
+  class ExperimentalWithRawCallbackMethod_RelocalizeAndMapStream : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    ExperimentalWithRawCallbackMethod_RelocalizeAndMapStream() {
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+      ::grpc::Service::
+    #else
+      ::grpc::Service::experimental().
+    #endif
+        MarkMethodRawCallback(10,
+          new ::grpc::internal::CallbackBidiHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+                   ::grpc::CallbackServerContext*
+    #else
+                   ::grpc::experimental::CallbackServerContext*
+    #endif
+                     context) { return this->RelocalizeAndMapStream(context); }));
+    }
+    ~ExperimentalWithRawCallbackMethod_RelocalizeAndMapStream() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status RelocalizeAndMapStream(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::com::bcom::solar::gprc::RelocalizationResult, ::com::bcom::solar::gprc::Frames>* /*stream*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+    virtual ::grpc::ServerBidiReactor< ::grpc::ByteBuffer, ::grpc::ByteBuffer>* RelocalizeAndMapStream(
+      ::grpc::CallbackServerContext* /*context*/)
+    #else
+    virtual ::grpc::experimental::ServerBidiReactor< ::grpc::ByteBuffer, ::grpc::ByteBuffer>* RelocalizeAndMapStream(
+      ::grpc::experimental::CallbackServerContext* /*context*/)
+    #endif
+      { return nullptr; }
+  };
+  template <class BaseClass>
+  class ExperimentalWithRawCallbackMethod_RelocalizeAndMapBatch : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    ExperimentalWithRawCallbackMethod_RelocalizeAndMapBatch() {
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+      ::grpc::Service::
+    #else
+      ::grpc::Service::experimental().
+    #endif
+        MarkMethodRawCallback(11,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+                   ::grpc::CallbackServerContext*
+    #else
+                   ::grpc::experimental::CallbackServerContext*
+    #endif
+                     context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->RelocalizeAndMapBatch(context, request, response); }));
+    }
+    ~ExperimentalWithRawCallbackMethod_RelocalizeAndMapBatch() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status RelocalizeAndMapBatch(::grpc::ServerContext* /*context*/, const ::com::bcom::solar::gprc::FramesBatch* /*request*/, ::com::bcom::solar::gprc::RelocalizationResults* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+    virtual ::grpc::ServerUnaryReactor* RelocalizeAndMapBatch(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)
+    #else
+    virtual ::grpc::experimental::ServerUnaryReactor* RelocalizeAndMapBatch(
+      ::grpc::experimental::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)
+    #endif
+      { return nullptr; }
+  };
+  template <class BaseClass>
   class ExperimentalWithRawCallbackMethod_Get3DTransform : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
@@ -2256,7 +2896,7 @@ class SolARMappingAndRelocalizationProxy final {
     #else
       ::grpc::Service::experimental().
     #endif
-        MarkMethodRawCallback(10,
+        MarkMethodRawCallback(12,
           new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
             [this](
     #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
@@ -2284,6 +2924,82 @@ class SolARMappingAndRelocalizationProxy final {
       { return nullptr; }
   };
   template <class BaseClass>
+  class ExperimentalWithRawCallbackMethod_SubscribeTransforms : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    ExperimentalWithRawCallbackMethod_SubscribeTransforms() {
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+      ::grpc::Service::
+    #else
+      ::grpc::Service::experimental().
+    #endif
+        MarkMethodRawCallback(13,
+          new ::grpc::internal::CallbackServerStreamingHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+                   ::grpc::CallbackServerContext*
+    #else
+                   ::grpc::experimental::CallbackServerContext*
+    #endif
+                     context, const::grpc::ByteBuffer* request) { return this->SubscribeTransforms(context, request); }));
+    }
+    ~ExperimentalWithRawCallbackMethod_SubscribeTransforms() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SubscribeTransforms(::grpc::ServerContext* /*context*/, const ::com::bcom::solar::gprc::ClientUUID* /*request*/, ::grpc::ServerWriter< ::com::bcom::solar::gprc::RelocalizationResult>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+    virtual ::grpc::ServerWriteReactor< ::grpc::ByteBuffer>* SubscribeTransforms(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/)
+    #else
+    virtual ::grpc::experimental::ServerWriteReactor< ::grpc::ByteBuffer>* SubscribeTransforms(
+      ::grpc::experimental::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/)
+    #endif
+      { return nullptr; }
+  };
+  template <class BaseClass>
+  class ExperimentalWithRawCallbackMethod_GetStats : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    ExperimentalWithRawCallbackMethod_GetStats() {
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+      ::grpc::Service::
+    #else
+      ::grpc::Service::experimental().
+    #endif
+        MarkMethodRawCallback(14,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+                   ::grpc::CallbackServerContext*
+    #else
+                   ::grpc::experimental::CallbackServerContext*
+    #endif
+                     context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->GetStats(context, request, response); }));
+    }
+    ~ExperimentalWithRawCallbackMethod_GetStats() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetStats(::grpc::ServerContext* /*context*/, const ::com::bcom::solar::gprc::ClientUUID* /*request*/, ::com::bcom::solar::gprc::ProxyStatsResult* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+    virtual ::grpc::ServerUnaryReactor* GetStats(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)
+    #else
+    virtual ::grpc::experimental::ServerUnaryReactor* GetStats(
+      ::grpc::experimental::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)
+    #endif
+      { return nullptr; }
+  };
+  template <class BaseClass>
   class ExperimentalWithRawCallbackMethod_Reset : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
@@ -2294,7 +3010,7 @@ class SolARMappingAndRelocalizationProxy final {
     #else
       ::grpc::Service::experimental().
     #endif
-        MarkMethodRawCallback(11,
+        MarkMethodRawCallback(15,
           new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
             [this](
     #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
@@ -2332,7 +3048,7 @@ class SolARMappingAndRelocalizationProxy final {
     #else
       ::grpc::Service::experimental().
     #endif
-        MarkMethodRawCallback(12,
+        MarkMethodRawCallback(16,
           new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
             [this](
     #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
@@ -2630,12 +3346,39 @@ class SolARMappingAndRelocalizationProxy final {
     virtual ::grpc::Status StreamedRelocalizeAndMapGroundTruth(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::com::bcom::solar::gprc::GroundTruthFrames,::com::bcom::solar::gprc::RelocalizationResult>* server_unary_streamer) = 0;
   };
   template <class BaseClass>
+  class WithStreamedUnaryMethod_RelocalizeAndMapBatch : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_RelocalizeAndMapBatch() {
+      ::grpc::Service::MarkMethodStreamed(11,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::com::bcom::solar::gprc::FramesBatch, ::com::bcom::solar::gprc::RelocalizationResults>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::com::bcom::solar::gprc::FramesBatch, ::com::bcom::solar::gprc::RelocalizationResults>* streamer) {
+                       return this->StreamedRelocalizeAndMapBatch(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_RelocalizeAndMapBatch() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status RelocalizeAndMapBatch(::grpc::ServerContext* /*context*/, const ::com::bcom::solar::gprc::FramesBatch* /*request*/, ::com::bcom::solar::gprc::RelocalizationResults* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreamedRelocalizeAndMapBatch(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::com::bcom::solar::gprc::FramesBatch,::com::bcom::solar::gprc::RelocalizationResults>* server_unary_streamer) = 0;
+  };
+  template <class BaseClass>
   class WithStreamedUnaryMethod_Get3DTransform : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithStreamedUnaryMethod_Get3DTransform() {
-      ::grpc::Service::MarkMethodStreamed(10,
+      ::grpc::Service::MarkMethodStreamed(12,
         new ::grpc::internal::StreamedUnaryHandler<
           ::com::bcom::solar::gprc::ClientUUID, ::com::bcom::solar::gprc::RelocalizationResult>(
             [this](::grpc::ServerContext* context,
@@ -2657,12 +3400,39 @@ class SolARMappingAndRelocalizationProxy final {
     virtual ::grpc::Status StreamedGet3DTransform(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::com::bcom::solar::gprc::ClientUUID,::com::bcom::solar::gprc::RelocalizationResult>* server_unary_streamer) = 0;
   };
   template <class BaseClass>
+  class WithStreamedUnaryMethod_GetStats : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_GetStats() {
+      ::grpc::Service::MarkMethodStreamed(14,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::com::bcom::solar::gprc::ClientUUID, ::com::bcom::solar::gprc::ProxyStatsResult>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::com::bcom::solar::gprc::ClientUUID, ::com::bcom::solar::gprc::ProxyStatsResult>* streamer) {
+                       return this->StreamedGetStats(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_GetStats() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status GetStats(::grpc::ServerContext* /*context*/, const ::com::bcom::solar::gprc::ClientUUID* /*request*/, ::com::bcom::solar::gprc::ProxyStatsResult* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreamedGetStats(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::com::bcom::solar::gprc::ClientUUID,::com::bcom::solar::gprc::ProxyStatsResult>* server_unary_streamer) = 0;
+  };
+  template <class BaseClass>
   class WithStreamedUnaryMethod_Reset : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithStreamedUnaryMethod_Reset() {
-      ::grpc::Service::MarkMethodStreamed(11,
+      ::grpc::Service::MarkMethodStreamed(15,
         new ::grpc::internal::StreamedUnaryHandler<
           ::com::bcom::solar::gprc::Empty, ::com::bcom::solar::gprc::Empty>(
             [this](::grpc::ServerContext* context,
@@ -2689,7 +3459,7 @@ class SolARMappingAndRelocalizationProxy final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithStreamedUnaryMethod_SendMessage() {
-      ::grpc::Service::MarkMethodStreamed(12,
+      ::grpc::Service::MarkMethodStreamed(16,
         new ::grpc::internal::StreamedUnaryHandler<
           ::com::bcom::solar::gprc::Message, ::com::bcom::solar::gprc::Empty>(
             [this](::grpc::ServerContext* context,
@@ -2710,9 +3480,36 @@ class SolARMappingAndRelocalizationProxy final {
     // replace default version of method with streamed unary
     virtual ::grpc::Status StreamedSendMessage(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::com::bcom::solar::gprc::Message,::com::bcom::solar::gprc::Empty>* server_unary_streamer) = 0;
   };
-  typedef WithStreamedUnaryMethod_RegisterClient<WithStreamedUnaryMethod_UnregisterClient<WithStreamedUnaryMethod_Init<WithStreamedUnaryMethod_Start<WithStreamedUnaryMethod_Stop<WithStreamedUnaryMethod_SetCameraParameters<WithStreamedUnaryMethod_SetCameraParametersStereo<WithStreamedUnaryMethod_setRectificationParameters<WithStreamedUnaryMethod_RelocalizeAndMap<WithStreamedUnaryMethod_RelocalizeAndMapGroundTruth<WithStreamedUnaryMethod_Get3DTransform<WithStreamedUnaryMethod_Reset<WithStreamedUnaryMethod_SendMessage<Service > > > > > > > > > > > > > StreamedUnaryService;
-  typedef Service SplitStreamedService;
-  typedef WithStreamedUnaryMethod_RegisterClient<WithStreamedUnaryMethod_UnregisterClient<WithStreamedUnaryMethod_Init<WithStreamedUnaryMethod_Start<WithStreamedUnaryMethod_Stop<WithStreamedUnaryMethod_SetCameraParameters<WithStreamedUnaryMethod_SetCameraParametersStereo<WithStreamedUnaryMethod_setRectificationParameters<WithStreamedUnaryMethod_RelocalizeAndMap<WithStreamedUnaryMethod_RelocalizeAndMapGroundTruth<WithStreamedUnaryMethod_Get3DTransform<WithStreamedUnaryMethod_Reset<WithStreamedUnaryMethod_SendMessage<Service > > > > > > > > > > > > > StreamedService;
+  typedef WithStreamedUnaryMethod_RegisterClient<WithStreamedUnaryMethod_UnregisterClient<WithStreamedUnaryMethod_Init<WithStreamedUnaryMethod_Start<WithStreamedUnaryMethod_Stop<WithStreamedUnaryMethod_SetCameraParameters<WithStreamedUnaryMethod_SetCameraParametersStereo<WithStreamedUnaryMethod_setRectificationParameters<WithStreamedUnaryMethod_RelocalizeAndMap<WithStreamedUnaryMethod_RelocalizeAndMapGroundTruth<WithStreamedUnaryMethod_RelocalizeAndMapBatch<WithStreamedUnaryMethod_Get3DTransform<WithStreamedUnaryMethod_GetStats<WithStreamedUnaryMethod_Reset<WithStreamedUnaryMethod_SendMessage<Service > > > > > > > > > > > > > > > StreamedUnaryService;
+  template <class BaseClass>
+  class WithSplitStreamingMethod_SubscribeTransforms : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithSplitStreamingMethod_SubscribeTransforms() {
+      ::grpc::Service::MarkMethodStreamed(13,
+        new ::grpc::internal::SplitServerStreamingHandler<
+          ::com::bcom::solar::gprc::ClientUUID, ::com::bcom::solar::gprc::RelocalizationResult>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerSplitStreamer<
+                     ::com::bcom::solar::gprc::ClientUUID, ::com::bcom::solar::gprc::RelocalizationResult>* streamer) {
+                       return this->StreamedSubscribeTransforms(context,
+                         streamer);
+                  }));
+    }
+    ~WithSplitStreamingMethod_SubscribeTransforms() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status SubscribeTransforms(::grpc::ServerContext* /*context*/, const ::com::bcom::solar::gprc::ClientUUID* /*request*/, ::grpc::ServerWriter< ::com::bcom::solar::gprc::RelocalizationResult>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with split streamed
+    virtual ::grpc::Status StreamedSubscribeTransforms(::grpc::ServerContext* context, ::grpc::ServerSplitStreamer< ::com::bcom::solar::gprc::ClientUUID,::com::bcom::solar::gprc::RelocalizationResult>* server_split_streamer) = 0;
+  };
+  typedef WithSplitStreamingMethod_SubscribeTransforms<Service > SplitStreamedService;
+  typedef WithStreamedUnaryMethod_RegisterClient<WithStreamedUnaryMethod_UnregisterClient<WithStreamedUnaryMethod_Init<WithStreamedUnaryMethod_Start<WithStreamedUnaryMethod_Stop<WithStreamedUnaryMethod_SetCameraParameters<WithStreamedUnaryMethod_SetCameraParametersStereo<WithStreamedUnaryMethod_setRectificationParameters<WithStreamedUnaryMethod_RelocalizeAndMap<WithStreamedUnaryMethod_RelocalizeAndMapGroundTruth<WithStreamedUnaryMethod_RelocalizeAndMapBatch<WithStreamedUnaryMethod_Get3DTransform<WithSplitStreamingMethod_SubscribeTransforms<WithStreamedUnaryMethod_GetStats<WithStreamedUnaryMethod_Reset<WithStreamedUnaryMethod_SendMessage<Service > > > > > > > > > > > > > > > > StreamedService;
 };
 
 }  // namespace gprc
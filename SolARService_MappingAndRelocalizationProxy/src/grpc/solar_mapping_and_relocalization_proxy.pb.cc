@@ -80,7 +80,9 @@ constexpr CameraParameters::CameraParameters(
   , camera_type_(0)
 
   , width_(0u)
-  , height_(0u){}
+  , height_(0u)
+  , rotation_(0)
+{}
 struct CameraParametersDefaultTypeInternal {
   constexpr CameraParametersDefaultTypeInternal()
     : _instance(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized{}) {}
@@ -108,7 +110,11 @@ constexpr CameraParametersStereo::CameraParametersStereo(
   , camera_type2_(0)
 
   , width2_(0u)
-  , height2_(0u){}
+  , height2_(0u)
+  , rotation1_(0)
+
+  , rotation2_(0)
+{}
 struct CameraParametersStereoDefaultTypeInternal {
   constexpr CameraParametersStereoDefaultTypeInternal()
     : _instance(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized{}) {}
@@ -162,6 +168,7 @@ constexpr RelocalizationResult::RelocalizationResult(
   , pose_status_(0)
 
   , confidence_(0)
+  , timestamp_(PROTOBUF_ULONGLONG(0))
   , mapping_status_(0)
 {}
 struct RelocalizationResultDefaultTypeInternal {
@@ -173,6 +180,78 @@ struct RelocalizationResultDefaultTypeInternal {
   };
 };
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT RelocalizationResultDefaultTypeInternal _RelocalizationResult_default_instance_;
+constexpr RelocalizationResults::RelocalizationResults(
+  ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized)
+  : results_(){}
+struct RelocalizationResultsDefaultTypeInternal {
+  constexpr RelocalizationResultsDefaultTypeInternal()
+    : _instance(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized{}) {}
+  ~RelocalizationResultsDefaultTypeInternal() {}
+  union {
+    RelocalizationResults _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT RelocalizationResultsDefaultTypeInternal _RelocalizationResults_default_instance_;
+constexpr StageLatency::StageLatency(
+  ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized)
+  : count_(PROTOBUF_ULONGLONG(0))
+  , mean_ms_(0)
+  , p50_ms_(0)
+  , p90_ms_(0)
+  , p99_ms_(0)
+  , p999_ms_(0)
+  , max_ms_(0){}
+struct StageLatencyDefaultTypeInternal {
+  constexpr StageLatencyDefaultTypeInternal()
+    : _instance(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized{}) {}
+  ~StageLatencyDefaultTypeInternal() {}
+  union {
+    StageLatency _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT StageLatencyDefaultTypeInternal _StageLatency_default_instance_;
+constexpr ProxyStats::ProxyStats(
+  ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized)
+  : queue_wait_(nullptr)
+  , decode_(nullptr)
+  , reorder_(nullptr)
+  , front_end_(nullptr)
+  , total_(nullptr)
+  , nb_requests_(PROTOBUF_ULONGLONG(0))
+  , nb_errors_(PROTOBUF_ULONGLONG(0))
+  , nb_rejected_(PROTOBUF_ULONGLONG(0))
+  , nb_late_dropped_(PROTOBUF_ULONGLONG(0))
+  , nb_shrink_dropped_(PROTOBUF_ULONGLONG(0))
+  , nb_overload_dropped_(PROTOBUF_ULONGLONG(0))
+  , nb_latest_pose_replies_(PROTOBUF_ULONGLONG(0))
+  , nb_motion_gated_(PROTOBUF_ULONGLONG(0))
+  , nb_duplicates_(PROTOBUF_ULONGLONG(0))
+  , nb_mode_switches_(PROTOBUF_ULONGLONG(0))
+  , reorder_depth_(0u)
+  , jitter_ms_(0)
+  , out_of_order_rate_(0){}
+struct ProxyStatsDefaultTypeInternal {
+  constexpr ProxyStatsDefaultTypeInternal()
+    : _instance(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized{}) {}
+  ~ProxyStatsDefaultTypeInternal() {}
+  union {
+    ProxyStats _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT ProxyStatsDefaultTypeInternal _ProxyStats_default_instance_;
+constexpr ProxyStatsResult::ProxyStatsResult(
+  ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized)
+  : proxy_(nullptr)
+  , client_(nullptr){}
+struct ProxyStatsResultDefaultTypeInternal {
+  constexpr ProxyStatsResultDefaultTypeInternal()
+    : _instance(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized{}) {}
+  ~ProxyStatsResultDefaultTypeInternal() {}
+  union {
+    ProxyStatsResult _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT ProxyStatsResultDefaultTypeInternal _ProxyStatsResult_default_instance_;
 constexpr Image::Image(
   ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized)
   : data_(&::PROTOBUF_NAMESPACE_ID::internal::fixed_address_empty_string)
@@ -204,6 +283,20 @@ struct FramesDefaultTypeInternal {
   };
 };
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT FramesDefaultTypeInternal _Frames_default_instance_;
+constexpr FramesBatch::FramesBatch(
+  ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized)
+  : frames_()
+  , client_uuid_(&::PROTOBUF_NAMESPACE_ID::internal::fixed_address_empty_string)
+  , last_result_only_(false){}
+struct FramesBatchDefaultTypeInternal {
+  constexpr FramesBatchDefaultTypeInternal()
+    : _instance(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized{}) {}
+  ~FramesBatchDefaultTypeInternal() {}
+  union {
+    FramesBatch _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT FramesBatchDefaultTypeInternal _FramesBatch_default_instance_;
 constexpr GroundTruthFrames::GroundTruthFrames(
   ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized)
   : client_uuid_(&::PROTOBUF_NAMESPACE_ID::internal::fixed_address_empty_string)
@@ -308,8 +401,8 @@ PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT Matrix3x4DefaultTypeInternal _M
 }  // namespace solar
 }  // namespace bcom
 }  // namespace com
-static ::PROTOBUF_NAMESPACE_ID::Metadata file_level_metadata_solar_5fmapping_5fand_5frelocalization_5fproxy_2eproto[16];
-static const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* file_level_enum_descriptors_solar_5fmapping_5fand_5frelocalization_5fproxy_2eproto[7];
+static ::PROTOBUF_NAMESPACE_ID::Metadata file_level_metadata_solar_5fmapping_5fand_5frelocalization_5fproxy_2eproto[21];
+static const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* file_level_enum_descriptors_solar_5fmapping_5fand_5frelocalization_5fproxy_2eproto[8];
 static constexpr ::PROTOBUF_NAMESPACE_ID::ServiceDescriptor const** file_level_service_descriptors_solar_5fmapping_5fand_5frelocalization_5fproxy_2eproto = nullptr;
 
 const ::PROTOBUF_NAMESPACE_ID::uint32 TableStruct_solar_5fmapping_5fand_5frelocalization_5fproxy_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
@@ -351,6 +444,7 @@ const ::PROTOBUF_NAMESPACE_ID::uint32 TableStruct_solar_5fmapping_5fand_5freloca
   PROTOBUF_FIELD_OFFSET(::com::bcom::solar::gprc::CameraParameters, height_),
   PROTOBUF_FIELD_OFFSET(::com::bcom::solar::gprc::CameraParameters, intrinsics_),
   PROTOBUF_FIELD_OFFSET(::com::bcom::solar::gprc::CameraParameters, distortion_),
+  PROTOBUF_FIELD_OFFSET(::com::bcom::solar::gprc::CameraParameters, rotation_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::com::bcom::solar::gprc::CameraParametersStereo, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -371,6 +465,8 @@ const ::PROTOBUF_NAMESPACE_ID::uint32 TableStruct_solar_5fmapping_5fand_5freloca
   PROTOBUF_FIELD_OFFSET(::com::bcom::solar::gprc::CameraParametersStereo, height2_),
   PROTOBUF_FIELD_OFFSET(::com::bcom::solar::gprc::CameraParametersStereo, intrinsics2_),
   PROTOBUF_FIELD_OFFSET(::com::bcom::solar::gprc::CameraParametersStereo, distortion2_),
+  PROTOBUF_FIELD_OFFSET(::com::bcom::solar::gprc::CameraParametersStereo, rotation1_),
+  PROTOBUF_FIELD_OFFSET(::com::bcom::solar::gprc::CameraParametersStereo, rotation2_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::com::bcom::solar::gprc::CameraDistortion, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -404,6 +500,55 @@ const ::PROTOBUF_NAMESPACE_ID::uint32 TableStruct_solar_5fmapping_5fand_5freloca
   PROTOBUF_FIELD_OFFSET(::com::bcom::solar::gprc::RelocalizationResult, pose_),
   PROTOBUF_FIELD_OFFSET(::com::bcom::solar::gprc::RelocalizationResult, confidence_),
   PROTOBUF_FIELD_OFFSET(::com::bcom::solar::gprc::RelocalizationResult, mapping_status_),
+  PROTOBUF_FIELD_OFFSET(::com::bcom::solar::gprc::RelocalizationResult, timestamp_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::com::bcom::solar::gprc::RelocalizationResults, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::com::bcom::solar::gprc::RelocalizationResults, results_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::com::bcom::solar::gprc::StageLatency, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::com::bcom::solar::gprc::StageLatency, count_),
+  PROTOBUF_FIELD_OFFSET(::com::bcom::solar::gprc::StageLatency, mean_ms_),
+  PROTOBUF_FIELD_OFFSET(::com::bcom::solar::gprc::StageLatency, p50_ms_),
+  PROTOBUF_FIELD_OFFSET(::com::bcom::solar::gprc::StageLatency, p90_ms_),
+  PROTOBUF_FIELD_OFFSET(::com::bcom::solar::gprc::StageLatency, p99_ms_),
+  PROTOBUF_FIELD_OFFSET(::com::bcom::solar::gprc::StageLatency, p999_ms_),
+  PROTOBUF_FIELD_OFFSET(::com::bcom::solar::gprc::StageLatency, max_ms_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::com::bcom::solar::gprc::ProxyStats, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::com::bcom::solar::gprc::ProxyStats, queue_wait_),
+  PROTOBUF_FIELD_OFFSET(::com::bcom::solar::gprc::ProxyStats, decode_),
+  PROTOBUF_FIELD_OFFSET(::com::bcom::solar::gprc::ProxyStats, reorder_),
+  PROTOBUF_FIELD_OFFSET(::com::bcom::solar::gprc::ProxyStats, front_end_),
+  PROTOBUF_FIELD_OFFSET(::com::bcom::solar::gprc::ProxyStats, total_),
+  PROTOBUF_FIELD_OFFSET(::com::bcom::solar::gprc::ProxyStats, nb_requests_),
+  PROTOBUF_FIELD_OFFSET(::com::bcom::solar::gprc::ProxyStats, nb_errors_),
+  PROTOBUF_FIELD_OFFSET(::com::bcom::solar::gprc::ProxyStats, nb_rejected_),
+  PROTOBUF_FIELD_OFFSET(::com::bcom::solar::gprc::ProxyStats, nb_late_dropped_),
+  PROTOBUF_FIELD_OFFSET(::com::bcom::solar::gprc::ProxyStats, nb_shrink_dropped_),
+  PROTOBUF_FIELD_OFFSET(::com::bcom::solar::gprc::ProxyStats, nb_overload_dropped_),
+  PROTOBUF_FIELD_OFFSET(::com::bcom::solar::gprc::ProxyStats, nb_latest_pose_replies_),
+  PROTOBUF_FIELD_OFFSET(::com::bcom::solar::gprc::ProxyStats, nb_motion_gated_),
+  PROTOBUF_FIELD_OFFSET(::com::bcom::solar::gprc::ProxyStats, nb_duplicates_),
+  PROTOBUF_FIELD_OFFSET(::com::bcom::solar::gprc::ProxyStats, nb_mode_switches_),
+  PROTOBUF_FIELD_OFFSET(::com::bcom::solar::gprc::ProxyStats, reorder_depth_),
+  PROTOBUF_FIELD_OFFSET(::com::bcom::solar::gprc::ProxyStats, jitter_ms_),
+  PROTOBUF_FIELD_OFFSET(::com::bcom::solar::gprc::ProxyStats, out_of_order_rate_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::com::bcom::solar::gprc::ProxyStatsResult, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::com::bcom::solar::gprc::ProxyStatsResult, proxy_),
+  PROTOBUF_FIELD_OFFSET(::com::bcom::solar::gprc::ProxyStatsResult, client_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::com::bcom::solar::gprc::Image, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -422,6 +567,14 @@ const ::PROTOBUF_NAMESPACE_ID::uint32 TableStruct_solar_5fmapping_5fand_5freloca
   PROTOBUF_FIELD_OFFSET(::com::bcom::solar::gprc::Frames, client_uuid_),
   PROTOBUF_FIELD_OFFSET(::com::bcom::solar::gprc::Frames, frames_),
   ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::com::bcom::solar::gprc::FramesBatch, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::com::bcom::solar::gprc::FramesBatch, client_uuid_),
+  PROTOBUF_FIELD_OFFSET(::com::bcom::solar::gprc::FramesBatch, frames_),
+  PROTOBUF_FIELD_OFFSET(::com::bcom::solar::gprc::FramesBatch, last_result_only_),
+  ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::com::bcom::solar::gprc::GroundTruthFrames, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
@@ -498,17 +651,22 @@ static const ::PROTOBUF_NAMESPACE_ID::internal::MigrationSchema schemas[] PROTOB
   { 11, -1, sizeof(::com::bcom::solar::gprc::PipelineModeValue)},
   { 18, -1, sizeof(::com::bcom::solar::gprc::Message)},
   { 25, -1, sizeof(::com::bcom::solar::gprc::CameraParameters)},
-  { 38, -1, sizeof(::com::bcom::solar::gprc::CameraParametersStereo)},
-  { 58, -1, sizeof(::com::bcom::solar::gprc::CameraDistortion)},
-  { 68, -1, sizeof(::com::bcom::solar::gprc::RectificationParameters)},
-  { 82, -1, sizeof(::com::bcom::solar::gprc::RelocalizationResult)},
-  { 91, -1, sizeof(::com::bcom::solar::gprc::Image)},
-  { 101, -1, sizeof(::com::bcom::solar::gprc::Frames)},
-  { 108, -1, sizeof(::com::bcom::solar::gprc::GroundTruthFrames)},
-  { 117, -1, sizeof(::com::bcom::solar::gprc::Frame)},
-  { 126, -1, sizeof(::com::bcom::solar::gprc::Matrix4x4)},
-  { 147, -1, sizeof(::com::bcom::solar::gprc::Matrix3x3)},
-  { 161, -1, sizeof(::com::bcom::solar::gprc::Matrix3x4)},
+  { 39, -1, sizeof(::com::bcom::solar::gprc::CameraParametersStereo)},
+  { 61, -1, sizeof(::com::bcom::solar::gprc::CameraDistortion)},
+  { 71, -1, sizeof(::com::bcom::solar::gprc::RectificationParameters)},
+  { 85, -1, sizeof(::com::bcom::solar::gprc::RelocalizationResult)},
+  { 95, -1, sizeof(::com::bcom::solar::gprc::RelocalizationResults)},
+  { 101, -1, sizeof(::com::bcom::solar::gprc::StageLatency)},
+  { 113, -1, sizeof(::com::bcom::solar::gprc::ProxyStats)},
+  { 136, -1, sizeof(::com::bcom::solar::gprc::ProxyStatsResult)},
+  { 143, -1, sizeof(::com::bcom::solar::gprc::Image)},
+  { 153, -1, sizeof(::com::bcom::solar::gprc::Frames)},
+  { 160, -1, sizeof(::com::bcom::solar::gprc::FramesBatch)},
+  { 168, -1, sizeof(::com::bcom::solar::gprc::GroundTruthFrames)},
+  { 177, -1, sizeof(::com::bcom::solar::gprc::Frame)},
+  { 186, -1, sizeof(::com::bcom::solar::gprc::Matrix4x4)},
+  { 207, -1, sizeof(::com::bcom::solar::gprc::Matrix3x3)},
+  { 221, -1, sizeof(::com::bcom::solar::gprc::Matrix3x4)},
 };
 
 static ::PROTOBUF_NAMESPACE_ID::Message const * const file_default_instances[] = {
@@ -521,8 +679,13 @@ static ::PROTOBUF_NAMESPACE_ID::Message const * const file_default_instances[] =
   reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::com::bcom::solar::gprc::_CameraDistortion_default_instance_),
   reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::com::bcom::solar::gprc::_RectificationParameters_default_instance_),
   reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::com::bcom::solar::gprc::_RelocalizationResult_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::com::bcom::solar::gprc::_RelocalizationResults_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::com::bcom::solar::gprc::_StageLatency_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::com::bcom::solar::gprc::_ProxyStats_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::com::bcom::solar::gprc::_ProxyStatsResult_default_instance_),
   reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::com::bcom::solar::gprc::_Image_default_instance_),
   reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::com::bcom::solar::gprc::_Frames_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::com::bcom::solar::gprc::_FramesBatch_default_instance_),
   reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::com::bcom::solar::gprc::_GroundTruthFrames_default_instance_),
   reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::com::bcom::solar::gprc::_Frame_default_instance_),
   reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::com::bcom::solar::gprc::_Matrix4x4_default_instance_),
@@ -537,115 +700,158 @@ const char descriptor_table_protodef_solar_5fmapping_5fand_5frelocalization_5fpr
   "ineModeValue\022\023\n\013client_uuid\030\001 \001(\t\0228\n\rpip"
   "eline_mode\030\002 \001(\0162!.com.bcom.solar.gprc.P"
   "ipelineMode\"/\n\007Message\022\023\n\013client_uuid\030\001 "
-  "\001(\t\022\017\n\007message\030\002 \001(\t\"\205\002\n\020CameraParameter"
+  "\001(\t\022\017\n\007message\030\002 \001(\t\"\273\002\n\020CameraParameter"
   "s\022\023\n\013client_uuid\030\001 \001(\t\022\014\n\004name\030\002 \001(\t\022\n\n\002"
   "id\030\003 \001(\r\0224\n\013camera_type\030\004 \001(\0162\037.com.bcom"
   ".solar.gprc.CameraType\022\r\n\005width\030\005 \001(\r\022\016\n"
   "\006height\030\006 \001(\r\0222\n\nintrinsics\030\007 \001(\0132\036.com."
   "bcom.solar.gprc.Matrix3x3\0229\n\ndistortion\030"
   "\010 \001(\0132%.com.bcom.solar.gprc.CameraDistor"
-  "tion\"\367\003\n\026CameraParametersStereo\022\023\n\013clien"
-  "t_uuid\030\001 \001(\t\022\r\n\005name1\030\002 \001(\t\022\013\n\003id1\030\003 \001(\r"
-  "\0225\n\014camera_type1\030\004 \001(\0162\037.com.bcom.solar."
-  "gprc.CameraType\022\016\n\006width1\030\005 \001(\r\022\017\n\007heigh"
-  "t1\030\006 \001(\r\0223\n\013intrinsics1\030\007 \001(\0132\036.com.bcom"
-  ".solar.gprc.Matrix3x3\022:\n\013distortion1\030\010 \001"
-  "(\0132%.com.bcom.solar.gprc.CameraDistortio"
-  "n\022\r\n\005name2\030\t \001(\t\022\013\n\003id2\030\n \001(\r\0225\n\014camera_"
-  "type2\030\013 \001(\0162\037.com.bcom.solar.gprc.Camera"
-  "Type\022\016\n\006width2\030\014 \001(\r\022\017\n\007height2\030\r \001(\r\0223\n"
-  "\013intrinsics2\030\016 \001(\0132\036.com.bcom.solar.gprc"
-  ".Matrix3x3\022:\n\013distortion2\030\017 \001(\0132%.com.bc"
-  "om.solar.gprc.CameraDistortion\"S\n\020Camera"
-  "Distortion\022\013\n\003K_1\030\001 \001(\002\022\013\n\003K_2\030\002 \001(\002\022\013\n\003"
-  "P_1\030\003 \001(\002\022\013\n\003P_2\030\004 \001(\002\022\013\n\003K_3\030\005 \001(\002\"\262\003\n\027"
-  "RectificationParameters\022\023\n\013client_uuid\030\001"
-  " \001(\t\0225\n\rcam1_rotation\030\002 \001(\0132\036.com.bcom.s"
-  "olar.gprc.Matrix3x3\0227\n\017cam1_projection\030\003"
-  " \001(\0132\036.com.bcom.solar.gprc.Matrix3x4\0229\n\020"
-  "cam1_stereo_type\030\004 \001(\0162\037.com.bcom.solar."
-  "gprc.StereoType\022\025\n\rcam1_baseline\030\005 \001(\002\0225"
-  "\n\rcam2_rotation\030\006 \001(\0132\036.com.bcom.solar.g"
-  "prc.Matrix3x3\0227\n\017cam2_projection\030\007 \001(\0132\036"
-  ".com.bcom.solar.gprc.Matrix3x4\0229\n\020cam2_s"
-  "tereo_type\030\010 \001(\0162\037.com.bcom.solar.gprc.S"
-  "tereoType\022\025\n\rcam2_baseline\030\t \001(\002\"\330\001\n\024Rel"
-  "ocalizationResult\022B\n\013pose_status\030\001 \001(\0162-"
-  ".com.bcom.solar.gprc.RelocalizationPoseS"
-  "tatus\022,\n\004pose\030\002 \001(\0132\036.com.bcom.solar.gpr"
-  "c.Matrix4x4\022\022\n\nconfidence\030\003 \001(\002\022:\n\016mappi"
-  "ng_status\030\004 \001(\0162\".com.bcom.solar.gprc.Ma"
-  "ppingStatus\"\247\001\n\005Image\022\r\n\005width\030\001 \001(\r\022\016\n\006"
-  "height\030\002 \001(\r\022\014\n\004data\030\003 \001(\014\0220\n\006layout\030\004 \001"
-  "(\0162 .com.bcom.solar.gprc.ImageLayout\022\?\n\020"
-  "imageCompression\030\005 \001(\0162%.com.bcom.solar."
-  "gprc.ImageCompression\"I\n\006Frames\022\023\n\013clien"
-  "t_uuid\030\001 \001(\t\022*\n\006frames\030\002 \003(\0132\032.com.bcom."
-  "solar.gprc.Frame\"\241\001\n\021GroundTruthFrames\022\023"
-  "\n\013client_uuid\030\001 \001(\t\022+\n\006frames\030\002 \001(\0132\033.co"
-  "m.bcom.solar.gprc.Frames\0226\n\016world_transo"
-  "rm\030\003 \001(\0132\036.com.bcom.solar.gprc.Matrix4x4"
-  "\022\022\n\nfixed_pose\030\004 \001(\010\"\206\001\n\005Frame\022\021\n\tsensor"
-  "_id\030\001 \001(\005\022)\n\005image\030\002 \001(\0132\032.com.bcom.sola"
-  "r.gprc.Image\022\021\n\ttimestamp\030\003 \001(\004\022,\n\004pose\030"
-  "\004 \001(\0132\036.com.bcom.solar.gprc.Matrix4x4\"\333\001"
-  "\n\tMatrix4x4\022\013\n\003m11\030\001 \001(\002\022\013\n\003m12\030\002 \001(\002\022\013\n"
-  "\003m13\030\003 \001(\002\022\013\n\003m14\030\004 \001(\002\022\013\n\003m21\030\005 \001(\002\022\013\n\003"
-  "m22\030\006 \001(\002\022\013\n\003m23\030\007 \001(\002\022\013\n\003m24\030\010 \001(\002\022\013\n\003m"
-  "31\030\t \001(\002\022\013\n\003m32\030\n \001(\002\022\013\n\003m33\030\013 \001(\002\022\013\n\003m3"
-  "4\030\014 \001(\002\022\013\n\003m41\030\r \001(\002\022\013\n\003m42\030\016 \001(\002\022\013\n\003m43"
-  "\030\017 \001(\002\022\013\n\003m44\030\020 \001(\002\"\200\001\n\tMatrix3x3\022\013\n\003m11"
-  "\030\001 \001(\002\022\013\n\003m12\030\002 \001(\002\022\013\n\003m13\030\003 \001(\002\022\013\n\003m21\030"
-  "\004 \001(\002\022\013\n\003m22\030\005 \001(\002\022\013\n\003m23\030\006 \001(\002\022\013\n\003m31\030\007"
-  " \001(\002\022\013\n\003m32\030\010 \001(\002\022\013\n\003m33\030\t \001(\002\"\247\001\n\tMatri"
-  "x3x4\022\013\n\003m11\030\001 \001(\002\022\013\n\003m12\030\002 \001(\002\022\013\n\003m13\030\003 "
-  "\001(\002\022\013\n\003m14\030\004 \001(\002\022\013\n\003m21\030\005 \001(\002\022\013\n\003m22\030\006 \001"
-  "(\002\022\013\n\003m23\030\007 \001(\002\022\013\n\003m24\030\010 \001(\002\022\013\n\003m31\030\t \001("
-  "\002\022\013\n\003m32\030\n \001(\002\022\013\n\003m33\030\013 \001(\002\022\013\n\003m34\030\014 \001(\002"
-  "*G\n\014PipelineMode\022\036\n\032RELOCALIZATION_AND_M"
-  "APPING\020\000\022\027\n\023RELOCALIZATION_ONLY\020\001*\037\n\nCam"
-  "eraType\022\007\n\003RGB\020\000\022\010\n\004GRAY\020\001**\n\nStereoType"
-  "\022\016\n\nHorizontal\020\000\022\014\n\010Vertical\020\001*F\n\030Reloca"
-  "lizationPoseStatus\022\013\n\007NO_POSE\020\000\022\014\n\010NEW_P"
-  "OSE\020\001\022\017\n\013LATEST_POSE\020\002*P\n\rMappingStatus\022"
-  "\r\n\tBOOTSTRAP\020\000\022\013\n\007MAPPING\020\001\022\021\n\rTRACKING_"
-  "LOST\020\002\022\020\n\014LOOP_CLOSURE\020\003*2\n\013ImageLayout\022"
-  "\n\n\006RGB_24\020\000\022\n\n\006GREY_8\020\001\022\013\n\007GREY_16\020\002*.\n\020"
-  "ImageCompression\022\010\n\004NONE\020\000\022\007\n\003PNG\020\001\022\007\n\003J"
-  "PG\020\0022\371\010\n\"SolARMappingAndRelocalizationPr"
-  "oxy\022M\n\016RegisterClient\022\032.com.bcom.solar.g"
-  "prc.Empty\032\037.com.bcom.solar.gprc.ClientUU"
-  "ID\022O\n\020UnregisterClient\022\037.com.bcom.solar."
-  "gprc.ClientUUID\032\032.com.bcom.solar.gprc.Em"
-  "pty\022J\n\004Init\022&.com.bcom.solar.gprc.Pipeli"
-  "neModeValue\032\032.com.bcom.solar.gprc.Empty\022"
-  "D\n\005Start\022\037.com.bcom.solar.gprc.ClientUUI"
-  "D\032\032.com.bcom.solar.gprc.Empty\022C\n\004Stop\022\037."
-  "com.bcom.solar.gprc.ClientUUID\032\032.com.bco"
-  "m.solar.gprc.Empty\022X\n\023SetCameraParameter"
-  "s\022%.com.bcom.solar.gprc.CameraParameters"
-  "\032\032.com.bcom.solar.gprc.Empty\022d\n\031SetCamer"
-  "aParametersStereo\022+.com.bcom.solar.gprc."
-  "CameraParametersStereo\032\032.com.bcom.solar."
-  "gprc.Empty\022f\n\032setRectificationParameters"
-  "\022,.com.bcom.solar.gprc.RectificationPara"
-  "meters\032\032.com.bcom.solar.gprc.Empty\022Z\n\020Re"
-  "localizeAndMap\022\033.com.bcom.solar.gprc.Fra"
-  "mes\032).com.bcom.solar.gprc.Relocalization"
-  "Result\022p\n\033RelocalizeAndMapGroundTruth\022&."
-  "com.bcom.solar.gprc.GroundTruthFrames\032)."
-  "com.bcom.solar.gprc.RelocalizationResult"
-  "\022\\\n\016Get3DTransform\022\037.com.bcom.solar.gprc"
-  ".ClientUUID\032).com.bcom.solar.gprc.Reloca"
-  "lizationResult\022\?\n\005Reset\022\032.com.bcom.solar"
-  ".gprc.Empty\032\032.com.bcom.solar.gprc.Empty\022"
-  "G\n\013SendMessage\022\034.com.bcom.solar.gprc.Mes"
-  "sage\032\032.com.bcom.solar.gprc.Emptyb\006proto3"
+  "tion\0224\n\010rotation\030\t \001(\0162\".com.bcom.solar."
+  "gprc.ImageRotation\"\345\004\n\026CameraParametersS"
+  "tereo\022\023\n\013client_uuid\030\001 \001(\t\022\r\n\005name1\030\002 \001("
+  "\t\022\013\n\003id1\030\003 \001(\r\0225\n\014camera_type1\030\004 \001(\0162\037.c"
+  "om.bcom.solar.gprc.CameraType\022\016\n\006width1\030"
+  "\005 \001(\r\022\017\n\007height1\030\006 \001(\r\0223\n\013intrinsics1\030\007 "
+  "\001(\0132\036.com.bcom.solar.gprc.Matrix3x3\022:\n\013d"
+  "istortion1\030\010 \001(\0132%.com.bcom.solar.gprc.C"
+  "ameraDistortion\022\r\n\005name2\030\t \001(\t\022\013\n\003id2\030\n "
+  "\001(\r\0225\n\014camera_type2\030\013 \001(\0162\037.com.bcom.sol"
+  "ar.gprc.CameraType\022\016\n\006width2\030\014 \001(\r\022\017\n\007he"
+  "ight2\030\r \001(\r\0223\n\013intrinsics2\030\016 \001(\0132\036.com.b"
+  "com.solar.gprc.Matrix3x3\022:\n\013distortion2\030"
+  "\017 \001(\0132%.com.bcom.solar.gprc.CameraDistor"
+  "tion\0225\n\trotation1\030\020 \001(\0162\".com.bcom.solar"
+  ".gprc.ImageRotation\0225\n\trotation2\030\021 \001(\0162\""
+  ".com.bcom.solar.gprc.ImageRotation\"S\n\020Ca"
+  "meraDistortion\022\013\n\003K_1\030\001 \001(\002\022\013\n\003K_2\030\002 \001(\002"
+  "\022\013\n\003P_1\030\003 \001(\002\022\013\n\003P_2\030\004 \001(\002\022\013\n\003K_3\030\005 \001(\002\""
+  "\262\003\n\027RectificationParameters\022\023\n\013client_uu"
+  "id\030\001 \001(\t\0225\n\rcam1_rotation\030\002 \001(\0132\036.com.bc"
+  "om.solar.gprc.Matrix3x3\0227\n\017cam1_projecti"
+  "on\030\003 \001(\0132\036.com.bcom.solar.gprc.Matrix3x4"
+  "\0229\n\020cam1_stereo_type\030\004 \001(\0162\037.com.bcom.so"
+  "lar.gprc.StereoType\022\025\n\rcam1_baseline\030\005 \001"
+  "(\002\0225\n\rcam2_rotation\030\006 \001(\0132\036.com.bcom.sol"
+  "ar.gprc.Matrix3x3\0227\n\017cam2_projection\030\007 \001"
+  "(\0132\036.com.bcom.solar.gprc.Matrix3x4\0229\n\020ca"
+  "m2_stereo_type\030\010 \001(\0162\037.com.bcom.solar.gp"
+  "rc.StereoType\022\025\n\rcam2_baseline\030\t \001(\002\"\353\001\n"
+  "\024RelocalizationResult\022B\n\013pose_status\030\001 \001"
+  "(\0162-.com.bcom.solar.gprc.RelocalizationP"
+  "oseStatus\022,\n\004pose\030\002 \001(\0132\036.com.bcom.solar"
+  ".gprc.Matrix4x4\022\022\n\nconfidence\030\003 \001(\002\022:\n\016m"
+  "apping_status\030\004 \001(\0162\".com.bcom.solar.gpr"
+  "c.MappingStatus\022\021\n\ttimestamp\030\005 \001(\004\"S\n\025Re"
+  "localizationResults\022:\n\007results\030\001 \003(\0132).c"
+  "om.bcom.solar.gprc.RelocalizationResult\""
+  "\177\n\014StageLatency\022\r\n\005count\030\001 \001(\004\022\017\n\007mean_m"
+  "s\030\002 \001(\002\022\016\n\006p50_ms\030\003 \001(\002\022\016\n\006p90_ms\030\004 \001(\002\022"
+  "\016\n\006p99_ms\030\005 \001(\002\022\017\n\007p999_ms\030\006 \001(\002\022\016\n\006max_"
+  "ms\030\007 \001(\002\"\317\004\n\nProxyStats\0225\n\nqueue_wait\030\001 "
+  "\001(\0132!.com.bcom.solar.gprc.StageLatency\0221"
+  "\n\006decode\030\002 \001(\0132!.com.bcom.solar.gprc.Sta"
+  "geLatency\0222\n\007reorder\030\003 \001(\0132!.com.bcom.so"
+  "lar.gprc.StageLatency\0224\n\tfront_end\030\004 \001(\013"
+  "2!.com.bcom.solar.gprc.StageLatency\0220\n\005t"
+  "otal\030\005 \001(\0132!.com.bcom.solar.gprc.StageLa"
+  "tency\022\023\n\013nb_requests\030\006 \001(\004\022\021\n\tnb_errors\030"
+  "\007 \001(\004\022\023\n\013nb_rejected\030\010 \001(\004\022\027\n\017nb_late_dr"
+  "opped\030\t \001(\004\022\031\n\021nb_shrink_dropped\030\n \001(\004\022\033"
+  "\n\023nb_overload_dropped\030\013 \001(\004\022\036\n\026nb_latest"
+  "_pose_replies\030\014 \001(\004\022\027\n\017nb_motion_gated\030\r"
+  " \001(\004\022\025\n\rnb_duplicates\030\016 \001(\004\022\030\n\020nb_mode_s"
+  "witches\030\017 \001(\004\022\025\n\rreorder_depth\030\020 \001(\r\022\021\n\t"
+  "jitter_ms\030\021 \001(\002\022\031\n\021out_of_order_rate\030\022 \001"
+  "(\002\"s\n\020ProxyStatsResult\022.\n\005proxy\030\001 \001(\0132\037."
+  "com.bcom.solar.gprc.ProxyStats\022/\n\006client"
+  "\030\002 \001(\0132\037.com.bcom.solar.gprc.ProxyStats\""
+  "\247\001\n\005Image\022\r\n\005width\030\001 \001(\r\022\016\n\006height\030\002 \001(\r"
+  "\022\014\n\004data\030\003 \001(\014\0220\n\006layout\030\004 \001(\0162 .com.bco"
+  "m.solar.gprc.ImageLayout\022\?\n\020imageCompres"
+  "sion\030\005 \001(\0162%.com.bcom.solar.gprc.ImageCo"
+  "mpression\"I\n\006Frames\022\023\n\013client_uuid\030\001 \001(\t"
+  "\022*\n\006frames\030\002 \003(\0132\032.com.bcom.solar.gprc.F"
+  "rame\"i\n\013FramesBatch\022\023\n\013client_uuid\030\001 \001(\t"
+  "\022+\n\006frames\030\002 \003(\0132\033.com.bcom.solar.gprc.F"
+  "rames\022\030\n\020last_result_only\030\003 \001(\010\"\241\001\n\021Grou"
+  "ndTruthFrames\022\023\n\013client_uuid\030\001 \001(\t\022+\n\006fr"
+  "ames\030\002 \001(\0132\033.com.bcom.solar.gprc.Frames\022"
+  "6\n\016world_transorm\030\003 \001(\0132\036.com.bcom.solar"
+  ".gprc.Matrix4x4\022\022\n\nfixed_pose\030\004 \001(\010\"\206\001\n\005"
+  "Frame\022\021\n\tsensor_id\030\001 \001(\005\022)\n\005image\030\002 \001(\0132"
+  "\032.com.bcom.solar.gprc.Image\022\021\n\ttimestamp"
+  "\030\003 \001(\004\022,\n\004pose\030\004 \001(\0132\036.com.bcom.solar.gp"
+  "rc.Matrix4x4\"\333\001\n\tMatrix4x4\022\013\n\003m11\030\001 \001(\002\022"
+  "\013\n\003m12\030\002 \001(\002\022\013\n\003m13\030\003 \001(\002\022\013\n\003m14\030\004 \001(\002\022\013"
+  "\n\003m21\030\005 \001(\002\022\013\n\003m22\030\006 \001(\002\022\013\n\003m23\030\007 \001(\002\022\013\n"
+  "\003m24\030\010 \001(\002\022\013\n\003m31\030\t \001(\002\022\013\n\003m32\030\n \001(\002\022\013\n\003"
+  "m33\030\013 \001(\002\022\013\n\003m34\030\014 \001(\002\022\013\n\003m41\030\r \001(\002\022\013\n\003m"
+  "42\030\016 \001(\002\022\013\n\003m43\030\017 \001(\002\022\013\n\003m44\030\020 \001(\002\"\200\001\n\tM"
+  "atrix3x3\022\013\n\003m11\030\001 \001(\002\022\013\n\003m12\030\002 \001(\002\022\013\n\003m1"
+  "3\030\003 \001(\002\022\013\n\003m21\030\004 \001(\002\022\013\n\003m22\030\005 \001(\002\022\013\n\003m23"
+  "\030\006 \001(\002\022\013\n\003m31\030\007 \001(\002\022\013\n\003m32\030\010 \001(\002\022\013\n\003m33\030"
+  "\t \001(\002\"\247\001\n\tMatrix3x4\022\013\n\003m11\030\001 \001(\002\022\013\n\003m12\030"
+  "\002 \001(\002\022\013\n\003m13\030\003 \001(\002\022\013\n\003m14\030\004 \001(\002\022\013\n\003m21\030\005"
+  " \001(\002\022\013\n\003m22\030\006 \001(\002\022\013\n\003m23\030\007 \001(\002\022\013\n\003m24\030\010 "
+  "\001(\002\022\013\n\003m31\030\t \001(\002\022\013\n\003m32\030\n \001(\002\022\013\n\003m33\030\013 \001"
+  "(\002\022\013\n\003m34\030\014 \001(\002*G\n\014PipelineMode\022\036\n\032RELOC"
+  "ALIZATION_AND_MAPPING\020\000\022\027\n\023RELOCALIZATIO"
+  "N_ONLY\020\001*H\n\rImageRotation\022\024\n\020DEFAULT_ROT"
+  "ATION\020\000\022\017\n\013NO_ROTATION\020\001\022\020\n\014ROTATION_180"
+  "\020\002*\037\n\nCameraType\022\007\n\003RGB\020\000\022\010\n\004GRAY\020\001**\n\nS"
+  "tereoType\022\016\n\nHorizontal\020\000\022\014\n\010Vertical\020\001*"
+  "F\n\030RelocalizationPoseStatus\022\013\n\007NO_POSE\020\000"
+  "\022\014\n\010NEW_POSE\020\001\022\017\n\013LATEST_POSE\020\002*P\n\rMappi"
+  "ngStatus\022\r\n\tBOOTSTRAP\020\000\022\013\n\007MAPPING\020\001\022\021\n\r"
+  "TRACKING_LOST\020\002\022\020\n\014LOOP_CLOSURE\020\003*2\n\013Ima"
+  "geLayout\022\n\n\006RGB_24\020\000\022\n\n\006GREY_8\020\001\022\013\n\007GREY"
+  "_16\020\002*.\n\020ImageCompression\022\010\n\004NONE\020\000\022\007\n\003P"
+  "NG\020\001\022\007\n\003JPG\020\0022\377\013\n\"SolARMappingAndRelocal"
+  "izationProxy\022M\n\016RegisterClient\022\032.com.bco"
+  "m.solar.gprc.Empty\032\037.com.bcom.solar.gprc"
+  ".ClientUUID\022O\n\020UnregisterClient\022\037.com.bc"
+  "om.solar.gprc.ClientUUID\032\032.com.bcom.sola"
+  "r.gprc.Empty\022J\n\004Init\022&.com.bcom.solar.gp"
+  "rc.PipelineModeValue\032\032.com.bcom.solar.gp"
+  "rc.Empty\022D\n\005Start\022\037.com.bcom.solar.gprc."
+  "ClientUUID\032\032.com.bcom.solar.gprc.Empty\022C"
+  "\n\004Stop\022\037.com.bcom.solar.gprc.ClientUUID\032"
+  "\032.com.bcom.solar.gprc.Empty\022X\n\023SetCamera"
+  "Parameters\022%.com.bcom.solar.gprc.CameraP"
+  "arameters\032\032.com.bcom.solar.gprc.Empty\022d\n"
+  "\031SetCameraParametersStereo\022+.com.bcom.so"
+  "lar.gprc.CameraParametersStereo\032\032.com.bc"
+  "om.solar.gprc.Empty\022f\n\032setRectificationP"
+  "arameters\022,.com.bcom.solar.gprc.Rectific"
+  "ationParameters\032\032.com.bcom.solar.gprc.Em"
+  "pty\022Z\n\020RelocalizeAndMap\022\033.com.bcom.solar"
+  ".gprc.Frames\032).com.bcom.solar.gprc.Reloc"
+  "alizationResult\022p\n\033RelocalizeAndMapGroun"
+  "dTruth\022&.com.bcom.solar.gprc.GroundTruth"
+  "Frames\032).com.bcom.solar.gprc.Relocalizat"
+  "ionResult\022d\n\026RelocalizeAndMapStream\022\033.co"
+  "m.bcom.solar.gprc.Frames\032).com.bcom.sola"
+  "r.gprc.RelocalizationResult(\0010\001\022e\n\025Reloc"
+  "alizeAndMapBatch\022 .com.bcom.solar.gprc.F"
+  "ramesBatch\032*.com.bcom.solar.gprc.Relocal"
+  "izationResults\022\\\n\016Get3DTransform\022\037.com.b"
+  "com.solar.gprc.ClientUUID\032).com.bcom.sol"
+  "ar.gprc.RelocalizationResult\022c\n\023Subscrib"
+  "eTransforms\022\037.com.bcom.solar.gprc.Client"
+  "UUID\032).com.bcom.solar.gprc.Relocalizatio"
+  "nResult0\001\022R\n\010GetStats\022\037.com.bcom.solar.g"
+  "prc.ClientUUID\032%.com.bcom.solar.gprc.Pro"
+  "xyStatsResult\022\?\n\005Reset\022\032.com.bcom.solar."
+  "gprc.Empty\032\032.com.bcom.solar.gprc.Empty\022G"
+  "\n\013SendMessage\022\034.com.bcom.solar.gprc.Mess"
+  "age\032\032.com.bcom.solar.gprc.EmptyB\003\370\001\001b\006pr"
+  "oto3"
   ;
 static ::PROTOBUF_NAMESPACE_ID::internal::once_flag descriptor_table_solar_5fmapping_5fand_5frelocalization_5fproxy_2eproto_once;
 const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_solar_5fmapping_5fand_5frelocalization_5fproxy_2eproto = {
-  false, false, 4400, descriptor_table_protodef_solar_5fmapping_5fand_5frelocalization_5fproxy_2eproto, "solar_mapping_and_relocalization_proxy.proto", 
-  &descriptor_table_solar_5fmapping_5fand_5frelocalization_5fproxy_2eproto_once, nullptr, 0, 16,
+  false, false, 6084, descriptor_table_protodef_solar_5fmapping_5fand_5frelocalization_5fproxy_2eproto, "solar_mapping_and_relocalization_proxy.proto", 
+  &descriptor_table_solar_5fmapping_5fand_5frelocalization_5fproxy_2eproto_once, nullptr, 0, 21,
   schemas, file_default_instances, TableStruct_solar_5fmapping_5fand_5frelocalization_5fproxy_2eproto::offsets,
   file_level_metadata_solar_5fmapping_5fand_5frelocalization_5fproxy_2eproto, file_level_enum_descriptors_solar_5fmapping_5fand_5frelocalization_5fproxy_2eproto, file_level_service_descriptors_solar_5fmapping_5fand_5frelocalization_5fproxy_2eproto,
 };
@@ -675,10 +881,25 @@ bool PipelineMode_IsValid(int value) {
   }
 }
 
-const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* CameraType_descriptor() {
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* ImageRotation_descriptor() {
   ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_solar_5fmapping_5fand_5frelocalization_5fproxy_2eproto);
   return file_level_enum_descriptors_solar_5fmapping_5fand_5frelocalization_5fproxy_2eproto[1];
 }
+bool ImageRotation_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+      return true;
+    default:
+      return false;
+  }
+}
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* CameraType_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_solar_5fmapping_5fand_5frelocalization_5fproxy_2eproto);
+  return file_level_enum_descriptors_solar_5fmapping_5fand_5frelocalization_5fproxy_2eproto[2];
+}
 bool CameraType_IsValid(int value) {
   switch (value) {
     case 0:
@@ -691,7 +912,7 @@ bool CameraType_IsValid(int value) {
 
 const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* StereoType_descriptor() {
   ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_solar_5fmapping_5fand_5frelocalization_5fproxy_2eproto);
-  return file_level_enum_descriptors_solar_5fmapping_5fand_5frelocalization_5fproxy_2eproto[2];
+  return file_level_enum_descriptors_solar_5fmapping_5fand_5frelocalization_5fproxy_2eproto[3];
 }
 bool StereoType_IsValid(int value) {
   switch (value) {
@@ -705,7 +926,7 @@ bool StereoType_IsValid(int value) {
 
 const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* RelocalizationPoseStatus_descriptor() {
   ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_solar_5fmapping_5fand_5frelocalization_5fproxy_2eproto);
-  return file_level_enum_descriptors_solar_5fmapping_5fand_5frelocalization_5fproxy_2eproto[3];
+  return file_level_enum_descriptors_solar_5fmapping_5fand_5frelocalization_5fproxy_2eproto[4];
 }
 bool RelocalizationPoseStatus_IsValid(int value) {
   switch (value) {
@@ -720,7 +941,7 @@ bool RelocalizationPoseStatus_IsValid(int value) {
 
 const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* MappingStatus_descriptor() {
   ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_solar_5fmapping_5fand_5frelocalization_5fproxy_2eproto);
-  return file_level_enum_descriptors_solar_5fmapping_5fand_5frelocalization_5fproxy_2eproto[4];
+  return file_level_enum_descriptors_solar_5fmapping_5fand_5frelocalization_5fproxy_2eproto[5];
 }
 bool MappingStatus_IsValid(int value) {
   switch (value) {
@@ -736,7 +957,7 @@ bool MappingStatus_IsValid(int value) {
 
 const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* ImageLayout_descriptor() {
   ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_solar_5fmapping_5fand_5frelocalization_5fproxy_2eproto);
-  return file_level_enum_descriptors_solar_5fmapping_5fand_5frelocalization_5fproxy_2eproto[5];
+  return file_level_enum_descriptors_solar_5fmapping_5fand_5frelocalization_5fproxy_2eproto[6];
 }
 bool ImageLayout_IsValid(int value) {
   switch (value) {
@@ -751,7 +972,7 @@ bool ImageLayout_IsValid(int value) {
 
 const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* ImageCompression_descriptor() {
   ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_solar_5fmapping_5fand_5frelocalization_5fproxy_2eproto);
-  return file_level_enum_descriptors_solar_5fmapping_5fand_5frelocalization_5fproxy_2eproto[6];
+  return file_level_enum_descriptors_solar_5fmapping_5fand_5frelocalization_5fproxy_2eproto[7];
 }
 bool ImageCompression_IsValid(int value) {
   switch (value) {
@@ -1634,8 +1855,8 @@ CameraParameters::CameraParameters(const CameraParameters& from)
     distortion_ = nullptr;
   }
   ::memcpy(&id_, &from.id_,
-    static_cast<size_t>(reinterpret_cast<char*>(&height_) -
-    reinterpret_cast<char*>(&id_)) + sizeof(height_));
+    static_cast<size_t>(reinterpret_cast<char*>(&rotation_) -
+    reinterpret_cast<char*>(&id_)) + sizeof(rotation_));
   // @@protoc_insertion_point(copy_constructor:com.bcom.solar.gprc.CameraParameters)
 }
 
@@ -1644,8 +1865,8 @@ client_uuid_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString
 name_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
 ::memset(reinterpret_cast<char*>(this) + static_cast<size_t>(
     reinterpret_cast<char*>(&intrinsics_) - reinterpret_cast<char*>(this)),
-    0, static_cast<size_t>(reinterpret_cast<char*>(&height_) -
-    reinterpret_cast<char*>(&intrinsics_)) + sizeof(height_));
+    0, static_cast<size_t>(reinterpret_cast<char*>(&rotation_) -
+    reinterpret_cast<char*>(&intrinsics_)) + sizeof(rotation_));
 }
 
 CameraParameters::~CameraParameters() {
@@ -1689,8 +1910,8 @@ void CameraParameters::Clear() {
   }
   distortion_ = nullptr;
   ::memset(&id_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&height_) -
-      reinterpret_cast<char*>(&id_)) + sizeof(height_));
+      reinterpret_cast<char*>(&rotation_) -
+      reinterpret_cast<char*>(&id_)) + sizeof(rotation_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
@@ -1762,6 +1983,14 @@ const char* CameraParameters::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPA
           CHK_(ptr);
         } else goto handle_unusual;
         continue;
+      // .com.bcom.solar.gprc.ImageRotation rotation = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 72)) {
+          ::PROTOBUF_NAMESPACE_ID::uint64 val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_rotation(static_cast<::com::bcom::solar::gprc::ImageRotation>(val));
+        } else goto handle_unusual;
+        continue;
       default: {
       handle_unusual:
         if ((tag & 7) == 4 || tag == 0) {
@@ -1851,6 +2080,13 @@ failure:
         8, _Internal::distortion(this), target, stream);
   }
 
+  // .com.bcom.solar.gprc.ImageRotation rotation = 9;
+  if (this->rotation() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteEnumToArray(
+      9, this->_internal_rotation(), target);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
@@ -1922,6 +2158,12 @@ size_t CameraParameters::ByteSizeLong() const {
         this->_internal_height());
   }
 
+  // .com.bcom.solar.gprc.ImageRotation rotation = 9;
+  if (this->rotation() != 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::EnumSize(this->_internal_rotation());
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
         _internal_metadata_, total_size, &_cached_size_);
@@ -1977,6 +2219,9 @@ void CameraParameters::MergeFrom(const CameraParameters& from) {
   if (from.height() != 0) {
     _internal_set_height(from._internal_height());
   }
+  if (from.rotation() != 0) {
+    _internal_set_rotation(from._internal_rotation());
+  }
 }
 
 void CameraParameters::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
@@ -2003,8 +2248,8 @@ void CameraParameters::InternalSwap(CameraParameters* other) {
   client_uuid_.Swap(&other->client_uuid_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
   name_.Swap(&other->name_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(CameraParameters, height_)
-      + sizeof(CameraParameters::height_)
+      PROTOBUF_FIELD_OFFSET(CameraParameters, rotation_)
+      + sizeof(CameraParameters::rotation_)
       - PROTOBUF_FIELD_OFFSET(CameraParameters, intrinsics_)>(
           reinterpret_cast<char*>(&intrinsics_),
           reinterpret_cast<char*>(&other->intrinsics_));
@@ -2086,8 +2331,8 @@ CameraParametersStereo::CameraParametersStereo(const CameraParametersStereo& fro
     distortion2_ = nullptr;
   }
   ::memcpy(&id1_, &from.id1_,
-    static_cast<size_t>(reinterpret_cast<char*>(&height2_) -
-    reinterpret_cast<char*>(&id1_)) + sizeof(height2_));
+    static_cast<size_t>(reinterpret_cast<char*>(&rotation2_) -
+    reinterpret_cast<char*>(&id1_)) + sizeof(rotation2_));
   // @@protoc_insertion_point(copy_constructor:com.bcom.solar.gprc.CameraParametersStereo)
 }
 
@@ -2097,8 +2342,8 @@ name1_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlread
 name2_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
 ::memset(reinterpret_cast<char*>(this) + static_cast<size_t>(
     reinterpret_cast<char*>(&intrinsics1_) - reinterpret_cast<char*>(this)),
-    0, static_cast<size_t>(reinterpret_cast<char*>(&height2_) -
-    reinterpret_cast<char*>(&intrinsics1_)) + sizeof(height2_));
+    0, static_cast<size_t>(reinterpret_cast<char*>(&rotation2_) -
+    reinterpret_cast<char*>(&intrinsics1_)) + sizeof(rotation2_));
 }
 
 CameraParametersStereo::~CameraParametersStereo() {
@@ -2154,8 +2399,8 @@ void CameraParametersStereo::Clear() {
   }
   distortion2_ = nullptr;
   ::memset(&id1_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&height2_) -
-      reinterpret_cast<char*>(&id1_)) + sizeof(height2_));
+      reinterpret_cast<char*>(&rotation2_) -
+      reinterpret_cast<char*>(&id1_)) + sizeof(rotation2_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
@@ -2279,6 +2524,22 @@ const char* CameraParametersStereo::_InternalParse(const char* ptr, ::PROTOBUF_N
           CHK_(ptr);
         } else goto handle_unusual;
         continue;
+      // .com.bcom.solar.gprc.ImageRotation rotation1 = 16;
+      case 16:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 128)) {
+          ::PROTOBUF_NAMESPACE_ID::uint64 val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_rotation1(static_cast<::com::bcom::solar::gprc::ImageRotation>(val));
+        } else goto handle_unusual;
+        continue;
+      // .com.bcom.solar.gprc.ImageRotation rotation2 = 17;
+      case 17:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 136)) {
+          ::PROTOBUF_NAMESPACE_ID::uint64 val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_rotation2(static_cast<::com::bcom::solar::gprc::ImageRotation>(val));
+        } else goto handle_unusual;
+        continue;
       default: {
       handle_unusual:
         if ((tag & 7) == 4 || tag == 0) {
@@ -2419,6 +2680,20 @@ failure:
         15, _Internal::distortion2(this), target, stream);
   }
 
+  // .com.bcom.solar.gprc.ImageRotation rotation1 = 16;
+  if (this->rotation1() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteEnumToArray(
+      16, this->_internal_rotation1(), target);
+  }
+
+  // .com.bcom.solar.gprc.ImageRotation rotation2 = 17;
+  if (this->rotation2() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteEnumToArray(
+      17, this->_internal_rotation2(), target);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
@@ -2538,6 +2813,18 @@ size_t CameraParametersStereo::ByteSizeLong() const {
         this->_internal_height2());
   }
 
+  // .com.bcom.solar.gprc.ImageRotation rotation1 = 16;
+  if (this->rotation1() != 0) {
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::EnumSize(this->_internal_rotation1());
+  }
+
+  // .com.bcom.solar.gprc.ImageRotation rotation2 = 17;
+  if (this->rotation2() != 0) {
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::EnumSize(this->_internal_rotation2());
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
         _internal_metadata_, total_size, &_cached_size_);
@@ -2614,6 +2901,12 @@ void CameraParametersStereo::MergeFrom(const CameraParametersStereo& from) {
   if (from.height2() != 0) {
     _internal_set_height2(from._internal_height2());
   }
+  if (from.rotation1() != 0) {
+    _internal_set_rotation1(from._internal_rotation1());
+  }
+  if (from.rotation2() != 0) {
+    _internal_set_rotation2(from._internal_rotation2());
+  }
 }
 
 void CameraParametersStereo::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
@@ -2641,8 +2934,8 @@ void CameraParametersStereo::InternalSwap(CameraParametersStereo* other) {
   name1_.Swap(&other->name1_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
   name2_.Swap(&other->name2_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(CameraParametersStereo, height2_)
-      + sizeof(CameraParametersStereo::height2_)
+      PROTOBUF_FIELD_OFFSET(CameraParametersStereo, rotation2_)
+      + sizeof(CameraParametersStereo::rotation2_)
       - PROTOBUF_FIELD_OFFSET(CameraParametersStereo, intrinsics1_)>(
           reinterpret_cast<char*>(&intrinsics1_),
           reinterpret_cast<char*>(&other->intrinsics1_));
@@ -3514,6 +3807,13 @@ const char* RelocalizationResult::_InternalParse(const char* ptr, ::PROTOBUF_NAM
           _internal_set_mapping_status(static_cast<::com::bcom::solar::gprc::MappingStatus>(val));
         } else goto handle_unusual;
         continue;
+      // uint64 timestamp = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 40)) {
+          timestamp_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
       default: {
       handle_unusual:
         if ((tag & 7) == 4 || tag == 0) {
@@ -3570,6 +3870,12 @@ failure:
       4, this->_internal_mapping_status(), target);
   }
 
+  // uint64 timestamp = 5;
+  if (this->timestamp() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt64ToArray(5, this->_internal_timestamp(), target);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
@@ -3604,6 +3910,13 @@ size_t RelocalizationResult::ByteSizeLong() const {
     total_size += 1 + 4;
   }
 
+  // uint64 timestamp = 5;
+  if (this->timestamp() != 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt64Size(
+        this->_internal_timestamp());
+  }
+
   // .com.bcom.solar.gprc.MappingStatus mapping_status = 4;
   if (this->mapping_status() != 0) {
     total_size += 1 +
@@ -3650,6 +3963,9 @@ void RelocalizationResult::MergeFrom(const RelocalizationResult& from) {
   if (!(from.confidence() <= 0 && from.confidence() >= 0)) {
     _internal_set_confidence(from._internal_confidence());
   }
+  if (from.timestamp() != 0) {
+    _internal_set_timestamp(from._internal_timestamp());
+  }
   if (from.mapping_status() != 0) {
     _internal_set_mapping_status(from._internal_mapping_status());
   }
@@ -3691,115 +4007,74 @@ void RelocalizationResult::InternalSwap(RelocalizationResult* other) {
 
 // ===================================================================
 
-class Image::_Internal {
+class RelocalizationResults::_Internal {
  public:
 };
 
-Image::Image(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
+RelocalizationResults::RelocalizationResults(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena),
+  results_(arena) {
   SharedCtor();
   RegisterArenaDtor(arena);
-  // @@protoc_insertion_point(arena_constructor:com.bcom.solar.gprc.Image)
+  // @@protoc_insertion_point(arena_constructor:com.bcom.solar.gprc.RelocalizationResults)
 }
-Image::Image(const Image& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message() {
+RelocalizationResults::RelocalizationResults(const RelocalizationResults& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message(),
+      results_(from.results_) {
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  data_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (!from._internal_data().empty()) {
-    data_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, from._internal_data(), 
-      GetArena());
-  }
-  ::memcpy(&width_, &from.width_,
-    static_cast<size_t>(reinterpret_cast<char*>(&imagecompression_) -
-    reinterpret_cast<char*>(&width_)) + sizeof(imagecompression_));
-  // @@protoc_insertion_point(copy_constructor:com.bcom.solar.gprc.Image)
+  // @@protoc_insertion_point(copy_constructor:com.bcom.solar.gprc.RelocalizationResults)
 }
 
-void Image::SharedCtor() {
-data_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-::memset(reinterpret_cast<char*>(this) + static_cast<size_t>(
-    reinterpret_cast<char*>(&width_) - reinterpret_cast<char*>(this)),
-    0, static_cast<size_t>(reinterpret_cast<char*>(&imagecompression_) -
-    reinterpret_cast<char*>(&width_)) + sizeof(imagecompression_));
+void RelocalizationResults::SharedCtor() {
 }
 
-Image::~Image() {
-  // @@protoc_insertion_point(destructor:com.bcom.solar.gprc.Image)
+RelocalizationResults::~RelocalizationResults() {
+  // @@protoc_insertion_point(destructor:com.bcom.solar.gprc.RelocalizationResults)
   SharedDtor();
   _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void Image::SharedDtor() {
+void RelocalizationResults::SharedDtor() {
   GOOGLE_DCHECK(GetArena() == nullptr);
-  data_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
 }
 
-void Image::ArenaDtor(void* object) {
-  Image* _this = reinterpret_cast< Image* >(object);
+void RelocalizationResults::ArenaDtor(void* object) {
+  RelocalizationResults* _this = reinterpret_cast< RelocalizationResults* >(object);
   (void)_this;
 }
-void Image::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+void RelocalizationResults::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
 }
-void Image::SetCachedSize(int size) const {
+void RelocalizationResults::SetCachedSize(int size) const {
   _cached_size_.Set(size);
 }
 
-void Image::Clear() {
-// @@protoc_insertion_point(message_clear_start:com.bcom.solar.gprc.Image)
+void RelocalizationResults::Clear() {
+// @@protoc_insertion_point(message_clear_start:com.bcom.solar.gprc.RelocalizationResults)
   ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  data_.ClearToEmpty();
-  ::memset(&width_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&imagecompression_) -
-      reinterpret_cast<char*>(&width_)) + sizeof(imagecompression_));
+  results_.Clear();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* Image::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* RelocalizationResults::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     ::PROTOBUF_NAMESPACE_ID::uint32 tag;
     ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
     CHK_(ptr);
     switch (tag >> 3) {
-      // uint32 width = 1;
+      // repeated .com.bcom.solar.gprc.RelocalizationResult results = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 8)) {
-          width_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      // uint32 height = 2;
-      case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 16)) {
-          height_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      // bytes data = 3;
-      case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 26)) {
-          auto str = _internal_mutable_data();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      // .com.bcom.solar.gprc.ImageLayout layout = 4;
-      case 4:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 32)) {
-          ::PROTOBUF_NAMESPACE_ID::uint64 val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
-          CHK_(ptr);
-          _internal_set_layout(static_cast<::com::bcom::solar::gprc::ImageLayout>(val));
-        } else goto handle_unusual;
-        continue;
-      // .com.bcom.solar.gprc.ImageCompression imageCompression = 5;
-      case 5:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 40)) {
-          ::PROTOBUF_NAMESPACE_ID::uint64 val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
-          CHK_(ptr);
-          _internal_set_imagecompression(static_cast<::com::bcom::solar::gprc::ImageCompression>(val));
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_results(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
         } else goto handle_unusual;
         continue;
       default: {
@@ -3824,71 +4099,1558 @@ failure:
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* Image::_InternalSerialize(
+::PROTOBUF_NAMESPACE_ID::uint8* RelocalizationResults::_InternalSerialize(
     ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:com.bcom.solar.gprc.Image)
+  // @@protoc_insertion_point(serialize_to_array_start:com.bcom.solar.gprc.RelocalizationResults)
   ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // uint32 width = 1;
-  if (this->width() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt32ToArray(1, this->_internal_width(), target);
-  }
-
-  // uint32 height = 2;
-  if (this->height() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt32ToArray(2, this->_internal_height(), target);
-  }
-
-  // bytes data = 3;
-  if (this->data().size() > 0) {
-    target = stream->WriteBytesMaybeAliased(
-        3, this->_internal_data(), target);
-  }
-
-  // .com.bcom.solar.gprc.ImageLayout layout = 4;
-  if (this->layout() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteEnumToArray(
-      4, this->_internal_layout(), target);
-  }
-
-  // .com.bcom.solar.gprc.ImageCompression imageCompression = 5;
-  if (this->imagecompression() != 0) {
+  // repeated .com.bcom.solar.gprc.RelocalizationResult results = 1;
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->_internal_results_size()); i < n; i++) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteEnumToArray(
-      5, this->_internal_imagecompression(), target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, this->_internal_results(i), target, stream);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:com.bcom.solar.gprc.Image)
+  // @@protoc_insertion_point(serialize_to_array_end:com.bcom.solar.gprc.RelocalizationResults)
   return target;
 }
 
-size_t Image::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:com.bcom.solar.gprc.Image)
+size_t RelocalizationResults::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:com.bcom.solar.gprc.RelocalizationResults)
   size_t total_size = 0;
 
   ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // bytes data = 3;
-  if (this->data().size() > 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
-        this->_internal_data());
+  // repeated .com.bcom.solar.gprc.RelocalizationResult results = 1;
+  total_size += 1UL * this->_internal_results_size();
+  for (const auto& msg : this->results_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
-  // uint32 width = 1;
-  if (this->width() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt32Size(
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
+        _internal_metadata_, total_size, &_cached_size_);
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void RelocalizationResults::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:com.bcom.solar.gprc.RelocalizationResults)
+  GOOGLE_DCHECK_NE(&from, this);
+  const RelocalizationResults* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<RelocalizationResults>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:com.bcom.solar.gprc.RelocalizationResults)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:com.bcom.solar.gprc.RelocalizationResults)
+    MergeFrom(*source);
+  }
+}
+
+void RelocalizationResults::MergeFrom(const RelocalizationResults& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:com.bcom.solar.gprc.RelocalizationResults)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  results_.MergeFrom(from.results_);
+}
+
+void RelocalizationResults::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:com.bcom.solar.gprc.RelocalizationResults)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void RelocalizationResults::CopyFrom(const RelocalizationResults& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:com.bcom.solar.gprc.RelocalizationResults)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool RelocalizationResults::IsInitialized() const {
+  return true;
+}
+
+void RelocalizationResults::InternalSwap(RelocalizationResults* other) {
+  using std::swap;
+  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
+  results_.InternalSwap(&other->results_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata RelocalizationResults::GetMetadata() const {
+  return GetMetadataStatic();
+}
+
+
+// ===================================================================
+
+class StageLatency::_Internal {
+ public:
+};
+
+StageLatency::StageLatency(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:com.bcom.solar.gprc.StageLatency)
+}
+StageLatency::StageLatency(const StageLatency& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&count_, &from.count_,
+    static_cast<size_t>(reinterpret_cast<char*>(&max_ms_) -
+    reinterpret_cast<char*>(&count_)) + sizeof(max_ms_));
+  // @@protoc_insertion_point(copy_constructor:com.bcom.solar.gprc.StageLatency)
+}
+
+void StageLatency::SharedCtor() {
+::memset(reinterpret_cast<char*>(this) + static_cast<size_t>(
+    reinterpret_cast<char*>(&count_) - reinterpret_cast<char*>(this)),
+    0, static_cast<size_t>(reinterpret_cast<char*>(&max_ms_) -
+    reinterpret_cast<char*>(&count_)) + sizeof(max_ms_));
+}
+
+StageLatency::~StageLatency() {
+  // @@protoc_insertion_point(destructor:com.bcom.solar.gprc.StageLatency)
+  SharedDtor();
+  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+void StageLatency::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+}
+
+void StageLatency::ArenaDtor(void* object) {
+  StageLatency* _this = reinterpret_cast< StageLatency* >(object);
+  (void)_this;
+}
+void StageLatency::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void StageLatency::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+
+void StageLatency::Clear() {
+// @@protoc_insertion_point(message_clear_start:com.bcom.solar.gprc.StageLatency)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&count_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&max_ms_) -
+      reinterpret_cast<char*>(&count_)) + sizeof(max_ms_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* StageLatency::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // uint64 count = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 8)) {
+          count_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // float mean_ms = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 21)) {
+          mean_ms_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else goto handle_unusual;
+        continue;
+      // float p50_ms = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 29)) {
+          p50_ms_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else goto handle_unusual;
+        continue;
+      // float p90_ms = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 37)) {
+          p90_ms_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else goto handle_unusual;
+        continue;
+      // float p99_ms = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 45)) {
+          p99_ms_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else goto handle_unusual;
+        continue;
+      // float p999_ms = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 53)) {
+          p999_ms_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else goto handle_unusual;
+        continue;
+      // float max_ms = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 61)) {
+          max_ms_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag,
+            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+            ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* StageLatency::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:com.bcom.solar.gprc.StageLatency)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint64 count = 1;
+  if (this->count() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt64ToArray(1, this->_internal_count(), target);
+  }
+
+  // float mean_ms = 2;
+  if (!(this->mean_ms() <= 0 && this->mean_ms() >= 0)) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteFloatToArray(2, this->_internal_mean_ms(), target);
+  }
+
+  // float p50_ms = 3;
+  if (!(this->p50_ms() <= 0 && this->p50_ms() >= 0)) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteFloatToArray(3, this->_internal_p50_ms(), target);
+  }
+
+  // float p90_ms = 4;
+  if (!(this->p90_ms() <= 0 && this->p90_ms() >= 0)) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteFloatToArray(4, this->_internal_p90_ms(), target);
+  }
+
+  // float p99_ms = 5;
+  if (!(this->p99_ms() <= 0 && this->p99_ms() >= 0)) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteFloatToArray(5, this->_internal_p99_ms(), target);
+  }
+
+  // float p999_ms = 6;
+  if (!(this->p999_ms() <= 0 && this->p999_ms() >= 0)) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteFloatToArray(6, this->_internal_p999_ms(), target);
+  }
+
+  // float max_ms = 7;
+  if (!(this->max_ms() <= 0 && this->max_ms() >= 0)) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteFloatToArray(7, this->_internal_max_ms(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:com.bcom.solar.gprc.StageLatency)
+  return target;
+}
+
+size_t StageLatency::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:com.bcom.solar.gprc.StageLatency)
+  size_t total_size = 0;
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // uint64 count = 1;
+  if (this->count() != 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt64Size(
+        this->_internal_count());
+  }
+
+  // float mean_ms = 2;
+  if (!(this->mean_ms() <= 0 && this->mean_ms() >= 0)) {
+    total_size += 1 + 4;
+  }
+
+  // float p50_ms = 3;
+  if (!(this->p50_ms() <= 0 && this->p50_ms() >= 0)) {
+    total_size += 1 + 4;
+  }
+
+  // float p90_ms = 4;
+  if (!(this->p90_ms() <= 0 && this->p90_ms() >= 0)) {
+    total_size += 1 + 4;
+  }
+
+  // float p99_ms = 5;
+  if (!(this->p99_ms() <= 0 && this->p99_ms() >= 0)) {
+    total_size += 1 + 4;
+  }
+
+  // float p999_ms = 6;
+  if (!(this->p999_ms() <= 0 && this->p999_ms() >= 0)) {
+    total_size += 1 + 4;
+  }
+
+  // float max_ms = 7;
+  if (!(this->max_ms() <= 0 && this->max_ms() >= 0)) {
+    total_size += 1 + 4;
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
+        _internal_metadata_, total_size, &_cached_size_);
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void StageLatency::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:com.bcom.solar.gprc.StageLatency)
+  GOOGLE_DCHECK_NE(&from, this);
+  const StageLatency* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<StageLatency>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:com.bcom.solar.gprc.StageLatency)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:com.bcom.solar.gprc.StageLatency)
+    MergeFrom(*source);
+  }
+}
+
+void StageLatency::MergeFrom(const StageLatency& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:com.bcom.solar.gprc.StageLatency)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from.count() != 0) {
+    _internal_set_count(from._internal_count());
+  }
+  if (!(from.mean_ms() <= 0 && from.mean_ms() >= 0)) {
+    _internal_set_mean_ms(from._internal_mean_ms());
+  }
+  if (!(from.p50_ms() <= 0 && from.p50_ms() >= 0)) {
+    _internal_set_p50_ms(from._internal_p50_ms());
+  }
+  if (!(from.p90_ms() <= 0 && from.p90_ms() >= 0)) {
+    _internal_set_p90_ms(from._internal_p90_ms());
+  }
+  if (!(from.p99_ms() <= 0 && from.p99_ms() >= 0)) {
+    _internal_set_p99_ms(from._internal_p99_ms());
+  }
+  if (!(from.p999_ms() <= 0 && from.p999_ms() >= 0)) {
+    _internal_set_p999_ms(from._internal_p999_ms());
+  }
+  if (!(from.max_ms() <= 0 && from.max_ms() >= 0)) {
+    _internal_set_max_ms(from._internal_max_ms());
+  }
+}
+
+void StageLatency::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:com.bcom.solar.gprc.StageLatency)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void StageLatency::CopyFrom(const StageLatency& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:com.bcom.solar.gprc.StageLatency)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool StageLatency::IsInitialized() const {
+  return true;
+}
+
+void StageLatency::InternalSwap(StageLatency* other) {
+  using std::swap;
+  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(StageLatency, max_ms_)
+      + sizeof(StageLatency::max_ms_)
+      - PROTOBUF_FIELD_OFFSET(StageLatency, count_)>(
+          reinterpret_cast<char*>(&count_),
+          reinterpret_cast<char*>(&other->count_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata StageLatency::GetMetadata() const {
+  return GetMetadataStatic();
+}
+
+
+// ===================================================================
+
+class ProxyStats::_Internal {
+ public:
+  static const ::com::bcom::solar::gprc::StageLatency& queue_wait(const ProxyStats* msg);
+  static const ::com::bcom::solar::gprc::StageLatency& decode(const ProxyStats* msg);
+  static const ::com::bcom::solar::gprc::StageLatency& reorder(const ProxyStats* msg);
+  static const ::com::bcom::solar::gprc::StageLatency& front_end(const ProxyStats* msg);
+  static const ::com::bcom::solar::gprc::StageLatency& total(const ProxyStats* msg);
+};
+
+const ::com::bcom::solar::gprc::StageLatency&
+ProxyStats::_Internal::queue_wait(const ProxyStats* msg) {
+  return *msg->queue_wait_;
+}
+const ::com::bcom::solar::gprc::StageLatency&
+ProxyStats::_Internal::decode(const ProxyStats* msg) {
+  return *msg->decode_;
+}
+const ::com::bcom::solar::gprc::StageLatency&
+ProxyStats::_Internal::reorder(const ProxyStats* msg) {
+  return *msg->reorder_;
+}
+const ::com::bcom::solar::gprc::StageLatency&
+ProxyStats::_Internal::front_end(const ProxyStats* msg) {
+  return *msg->front_end_;
+}
+const ::com::bcom::solar::gprc::StageLatency&
+ProxyStats::_Internal::total(const ProxyStats* msg) {
+  return *msg->total_;
+}
+ProxyStats::ProxyStats(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:com.bcom.solar.gprc.ProxyStats)
+}
+ProxyStats::ProxyStats(const ProxyStats& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_queue_wait()) {
+    queue_wait_ = new ::com::bcom::solar::gprc::StageLatency(*from.queue_wait_);
+  } else {
+    queue_wait_ = nullptr;
+  }
+  if (from._internal_has_decode()) {
+    decode_ = new ::com::bcom::solar::gprc::StageLatency(*from.decode_);
+  } else {
+    decode_ = nullptr;
+  }
+  if (from._internal_has_reorder()) {
+    reorder_ = new ::com::bcom::solar::gprc::StageLatency(*from.reorder_);
+  } else {
+    reorder_ = nullptr;
+  }
+  if (from._internal_has_front_end()) {
+    front_end_ = new ::com::bcom::solar::gprc::StageLatency(*from.front_end_);
+  } else {
+    front_end_ = nullptr;
+  }
+  if (from._internal_has_total()) {
+    total_ = new ::com::bcom::solar::gprc::StageLatency(*from.total_);
+  } else {
+    total_ = nullptr;
+  }
+  ::memcpy(&nb_requests_, &from.nb_requests_,
+    static_cast<size_t>(reinterpret_cast<char*>(&out_of_order_rate_) -
+    reinterpret_cast<char*>(&nb_requests_)) + sizeof(out_of_order_rate_));
+  // @@protoc_insertion_point(copy_constructor:com.bcom.solar.gprc.ProxyStats)
+}
+
+void ProxyStats::SharedCtor() {
+::memset(reinterpret_cast<char*>(this) + static_cast<size_t>(
+    reinterpret_cast<char*>(&queue_wait_) - reinterpret_cast<char*>(this)),
+    0, static_cast<size_t>(reinterpret_cast<char*>(&out_of_order_rate_) -
+    reinterpret_cast<char*>(&queue_wait_)) + sizeof(out_of_order_rate_));
+}
+
+ProxyStats::~ProxyStats() {
+  // @@protoc_insertion_point(destructor:com.bcom.solar.gprc.ProxyStats)
+  SharedDtor();
+  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+void ProxyStats::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+  if (this != internal_default_instance()) delete queue_wait_;
+  if (this != internal_default_instance()) delete decode_;
+  if (this != internal_default_instance()) delete reorder_;
+  if (this != internal_default_instance()) delete front_end_;
+  if (this != internal_default_instance()) delete total_;
+}
+
+void ProxyStats::ArenaDtor(void* object) {
+  ProxyStats* _this = reinterpret_cast< ProxyStats* >(object);
+  (void)_this;
+}
+void ProxyStats::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void ProxyStats::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+
+void ProxyStats::Clear() {
+// @@protoc_insertion_point(message_clear_start:com.bcom.solar.gprc.ProxyStats)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  if (GetArena() == nullptr && queue_wait_ != nullptr) {
+    delete queue_wait_;
+  }
+  queue_wait_ = nullptr;
+  if (GetArena() == nullptr && decode_ != nullptr) {
+    delete decode_;
+  }
+  decode_ = nullptr;
+  if (GetArena() == nullptr && reorder_ != nullptr) {
+    delete reorder_;
+  }
+  reorder_ = nullptr;
+  if (GetArena() == nullptr && front_end_ != nullptr) {
+    delete front_end_;
+  }
+  front_end_ = nullptr;
+  if (GetArena() == nullptr && total_ != nullptr) {
+    delete total_;
+  }
+  total_ = nullptr;
+  ::memset(&nb_requests_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&out_of_order_rate_) -
+      reinterpret_cast<char*>(&nb_requests_)) + sizeof(out_of_order_rate_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ProxyStats::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // .com.bcom.solar.gprc.StageLatency queue_wait = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_queue_wait(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .com.bcom.solar.gprc.StageLatency decode = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_decode(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .com.bcom.solar.gprc.StageLatency reorder = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_reorder(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .com.bcom.solar.gprc.StageLatency front_end = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 34)) {
+          ptr = ctx->ParseMessage(_internal_mutable_front_end(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .com.bcom.solar.gprc.StageLatency total = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 42)) {
+          ptr = ctx->ParseMessage(_internal_mutable_total(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // uint64 nb_requests = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 48)) {
+          nb_requests_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // uint64 nb_errors = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 56)) {
+          nb_errors_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // uint64 nb_rejected = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 64)) {
+          nb_rejected_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // uint64 nb_late_dropped = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 72)) {
+          nb_late_dropped_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // uint64 nb_shrink_dropped = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 80)) {
+          nb_shrink_dropped_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // uint64 nb_overload_dropped = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 88)) {
+          nb_overload_dropped_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // uint64 nb_latest_pose_replies = 12;
+      case 12:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 96)) {
+          nb_latest_pose_replies_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // uint64 nb_motion_gated = 13;
+      case 13:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 104)) {
+          nb_motion_gated_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // uint64 nb_duplicates = 14;
+      case 14:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 112)) {
+          nb_duplicates_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // uint64 nb_mode_switches = 15;
+      case 15:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 120)) {
+          nb_mode_switches_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // uint32 reorder_depth = 16;
+      case 16:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 128)) {
+          reorder_depth_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // float jitter_ms = 17;
+      case 17:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 141)) {
+          jitter_ms_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else goto handle_unusual;
+        continue;
+      // float out_of_order_rate = 18;
+      case 18:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 149)) {
+          out_of_order_rate_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag,
+            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+            ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* ProxyStats::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:com.bcom.solar.gprc.ProxyStats)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .com.bcom.solar.gprc.StageLatency queue_wait = 1;
+  if (this->has_queue_wait()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        1, _Internal::queue_wait(this), target, stream);
+  }
+
+  // .com.bcom.solar.gprc.StageLatency decode = 2;
+  if (this->has_decode()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        2, _Internal::decode(this), target, stream);
+  }
+
+  // .com.bcom.solar.gprc.StageLatency reorder = 3;
+  if (this->has_reorder()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        3, _Internal::reorder(this), target, stream);
+  }
+
+  // .com.bcom.solar.gprc.StageLatency front_end = 4;
+  if (this->has_front_end()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        4, _Internal::front_end(this), target, stream);
+  }
+
+  // .com.bcom.solar.gprc.StageLatency total = 5;
+  if (this->has_total()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        5, _Internal::total(this), target, stream);
+  }
+
+  // uint64 nb_requests = 6;
+  if (this->nb_requests() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt64ToArray(6, this->_internal_nb_requests(), target);
+  }
+
+  // uint64 nb_errors = 7;
+  if (this->nb_errors() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt64ToArray(7, this->_internal_nb_errors(), target);
+  }
+
+  // uint64 nb_rejected = 8;
+  if (this->nb_rejected() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt64ToArray(8, this->_internal_nb_rejected(), target);
+  }
+
+  // uint64 nb_late_dropped = 9;
+  if (this->nb_late_dropped() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt64ToArray(9, this->_internal_nb_late_dropped(), target);
+  }
+
+  // uint64 nb_shrink_dropped = 10;
+  if (this->nb_shrink_dropped() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt64ToArray(10, this->_internal_nb_shrink_dropped(), target);
+  }
+
+  // uint64 nb_overload_dropped = 11;
+  if (this->nb_overload_dropped() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt64ToArray(11, this->_internal_nb_overload_dropped(), target);
+  }
+
+  // uint64 nb_latest_pose_replies = 12;
+  if (this->nb_latest_pose_replies() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt64ToArray(12, this->_internal_nb_latest_pose_replies(), target);
+  }
+
+  // uint64 nb_motion_gated = 13;
+  if (this->nb_motion_gated() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt64ToArray(13, this->_internal_nb_motion_gated(), target);
+  }
+
+  // uint64 nb_duplicates = 14;
+  if (this->nb_duplicates() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt64ToArray(14, this->_internal_nb_duplicates(), target);
+  }
+
+  // uint64 nb_mode_switches = 15;
+  if (this->nb_mode_switches() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt64ToArray(15, this->_internal_nb_mode_switches(), target);
+  }
+
+  // uint32 reorder_depth = 16;
+  if (this->reorder_depth() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt32ToArray(16, this->_internal_reorder_depth(), target);
+  }
+
+  // float jitter_ms = 17;
+  if (!(this->jitter_ms() <= 0 && this->jitter_ms() >= 0)) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteFloatToArray(17, this->_internal_jitter_ms(), target);
+  }
+
+  // float out_of_order_rate = 18;
+  if (!(this->out_of_order_rate() <= 0 && this->out_of_order_rate() >= 0)) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteFloatToArray(18, this->_internal_out_of_order_rate(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:com.bcom.solar.gprc.ProxyStats)
+  return target;
+}
+
+size_t ProxyStats::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:com.bcom.solar.gprc.ProxyStats)
+  size_t total_size = 0;
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // .com.bcom.solar.gprc.StageLatency queue_wait = 1;
+  if (this->has_queue_wait()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *queue_wait_);
+  }
+
+  // .com.bcom.solar.gprc.StageLatency decode = 2;
+  if (this->has_decode()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *decode_);
+  }
+
+  // .com.bcom.solar.gprc.StageLatency reorder = 3;
+  if (this->has_reorder()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *reorder_);
+  }
+
+  // .com.bcom.solar.gprc.StageLatency front_end = 4;
+  if (this->has_front_end()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *front_end_);
+  }
+
+  // .com.bcom.solar.gprc.StageLatency total = 5;
+  if (this->has_total()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *total_);
+  }
+
+  // uint64 nb_requests = 6;
+  if (this->nb_requests() != 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt64Size(
+        this->_internal_nb_requests());
+  }
+
+  // uint64 nb_errors = 7;
+  if (this->nb_errors() != 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt64Size(
+        this->_internal_nb_errors());
+  }
+
+  // uint64 nb_rejected = 8;
+  if (this->nb_rejected() != 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt64Size(
+        this->_internal_nb_rejected());
+  }
+
+  // uint64 nb_late_dropped = 9;
+  if (this->nb_late_dropped() != 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt64Size(
+        this->_internal_nb_late_dropped());
+  }
+
+  // uint64 nb_shrink_dropped = 10;
+  if (this->nb_shrink_dropped() != 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt64Size(
+        this->_internal_nb_shrink_dropped());
+  }
+
+  // uint64 nb_overload_dropped = 11;
+  if (this->nb_overload_dropped() != 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt64Size(
+        this->_internal_nb_overload_dropped());
+  }
+
+  // uint64 nb_latest_pose_replies = 12;
+  if (this->nb_latest_pose_replies() != 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt64Size(
+        this->_internal_nb_latest_pose_replies());
+  }
+
+  // uint64 nb_motion_gated = 13;
+  if (this->nb_motion_gated() != 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt64Size(
+        this->_internal_nb_motion_gated());
+  }
+
+  // uint64 nb_duplicates = 14;
+  if (this->nb_duplicates() != 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt64Size(
+        this->_internal_nb_duplicates());
+  }
+
+  // uint64 nb_mode_switches = 15;
+  if (this->nb_mode_switches() != 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt64Size(
+        this->_internal_nb_mode_switches());
+  }
+
+  // uint32 reorder_depth = 16;
+  if (this->reorder_depth() != 0) {
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt32Size(
+        this->_internal_reorder_depth());
+  }
+
+  // float jitter_ms = 17;
+  if (!(this->jitter_ms() <= 0 && this->jitter_ms() >= 0)) {
+    total_size += 2 + 4;
+  }
+
+  // float out_of_order_rate = 18;
+  if (!(this->out_of_order_rate() <= 0 && this->out_of_order_rate() >= 0)) {
+    total_size += 2 + 4;
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
+        _internal_metadata_, total_size, &_cached_size_);
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void ProxyStats::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:com.bcom.solar.gprc.ProxyStats)
+  GOOGLE_DCHECK_NE(&from, this);
+  const ProxyStats* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<ProxyStats>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:com.bcom.solar.gprc.ProxyStats)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:com.bcom.solar.gprc.ProxyStats)
+    MergeFrom(*source);
+  }
+}
+
+void ProxyStats::MergeFrom(const ProxyStats& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:com.bcom.solar.gprc.ProxyStats)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from.has_queue_wait()) {
+    _internal_mutable_queue_wait()->::com::bcom::solar::gprc::StageLatency::MergeFrom(from._internal_queue_wait());
+  }
+  if (from.has_decode()) {
+    _internal_mutable_decode()->::com::bcom::solar::gprc::StageLatency::MergeFrom(from._internal_decode());
+  }
+  if (from.has_reorder()) {
+    _internal_mutable_reorder()->::com::bcom::solar::gprc::StageLatency::MergeFrom(from._internal_reorder());
+  }
+  if (from.has_front_end()) {
+    _internal_mutable_front_end()->::com::bcom::solar::gprc::StageLatency::MergeFrom(from._internal_front_end());
+  }
+  if (from.has_total()) {
+    _internal_mutable_total()->::com::bcom::solar::gprc::StageLatency::MergeFrom(from._internal_total());
+  }
+  if (from.nb_requests() != 0) {
+    _internal_set_nb_requests(from._internal_nb_requests());
+  }
+  if (from.nb_errors() != 0) {
+    _internal_set_nb_errors(from._internal_nb_errors());
+  }
+  if (from.nb_rejected() != 0) {
+    _internal_set_nb_rejected(from._internal_nb_rejected());
+  }
+  if (from.nb_late_dropped() != 0) {
+    _internal_set_nb_late_dropped(from._internal_nb_late_dropped());
+  }
+  if (from.nb_shrink_dropped() != 0) {
+    _internal_set_nb_shrink_dropped(from._internal_nb_shrink_dropped());
+  }
+  if (from.nb_overload_dropped() != 0) {
+    _internal_set_nb_overload_dropped(from._internal_nb_overload_dropped());
+  }
+  if (from.nb_latest_pose_replies() != 0) {
+    _internal_set_nb_latest_pose_replies(from._internal_nb_latest_pose_replies());
+  }
+  if (from.nb_motion_gated() != 0) {
+    _internal_set_nb_motion_gated(from._internal_nb_motion_gated());
+  }
+  if (from.nb_duplicates() != 0) {
+    _internal_set_nb_duplicates(from._internal_nb_duplicates());
+  }
+  if (from.nb_mode_switches() != 0) {
+    _internal_set_nb_mode_switches(from._internal_nb_mode_switches());
+  }
+  if (from.reorder_depth() != 0) {
+    _internal_set_reorder_depth(from._internal_reorder_depth());
+  }
+  if (!(from.jitter_ms() <= 0 && from.jitter_ms() >= 0)) {
+    _internal_set_jitter_ms(from._internal_jitter_ms());
+  }
+  if (!(from.out_of_order_rate() <= 0 && from.out_of_order_rate() >= 0)) {
+    _internal_set_out_of_order_rate(from._internal_out_of_order_rate());
+  }
+}
+
+void ProxyStats::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:com.bcom.solar.gprc.ProxyStats)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void ProxyStats::CopyFrom(const ProxyStats& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:com.bcom.solar.gprc.ProxyStats)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ProxyStats::IsInitialized() const {
+  return true;
+}
+
+void ProxyStats::InternalSwap(ProxyStats* other) {
+  using std::swap;
+  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ProxyStats, out_of_order_rate_)
+      + sizeof(ProxyStats::out_of_order_rate_)
+      - PROTOBUF_FIELD_OFFSET(ProxyStats, queue_wait_)>(
+          reinterpret_cast<char*>(&queue_wait_),
+          reinterpret_cast<char*>(&other->queue_wait_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ProxyStats::GetMetadata() const {
+  return GetMetadataStatic();
+}
+
+
+// ===================================================================
+
+class ProxyStatsResult::_Internal {
+ public:
+  static const ::com::bcom::solar::gprc::ProxyStats& proxy(const ProxyStatsResult* msg);
+  static const ::com::bcom::solar::gprc::ProxyStats& client(const ProxyStatsResult* msg);
+};
+
+const ::com::bcom::solar::gprc::ProxyStats&
+ProxyStatsResult::_Internal::proxy(const ProxyStatsResult* msg) {
+  return *msg->proxy_;
+}
+const ::com::bcom::solar::gprc::ProxyStats&
+ProxyStatsResult::_Internal::client(const ProxyStatsResult* msg) {
+  return *msg->client_;
+}
+ProxyStatsResult::ProxyStatsResult(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:com.bcom.solar.gprc.ProxyStatsResult)
+}
+ProxyStatsResult::ProxyStatsResult(const ProxyStatsResult& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_proxy()) {
+    proxy_ = new ::com::bcom::solar::gprc::ProxyStats(*from.proxy_);
+  } else {
+    proxy_ = nullptr;
+  }
+  if (from._internal_has_client()) {
+    client_ = new ::com::bcom::solar::gprc::ProxyStats(*from.client_);
+  } else {
+    client_ = nullptr;
+  }
+  // @@protoc_insertion_point(copy_constructor:com.bcom.solar.gprc.ProxyStatsResult)
+}
+
+void ProxyStatsResult::SharedCtor() {
+::memset(reinterpret_cast<char*>(this) + static_cast<size_t>(
+    reinterpret_cast<char*>(&proxy_) - reinterpret_cast<char*>(this)),
+    0, static_cast<size_t>(reinterpret_cast<char*>(&client_) -
+    reinterpret_cast<char*>(&proxy_)) + sizeof(client_));
+}
+
+ProxyStatsResult::~ProxyStatsResult() {
+  // @@protoc_insertion_point(destructor:com.bcom.solar.gprc.ProxyStatsResult)
+  SharedDtor();
+  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+void ProxyStatsResult::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+  if (this != internal_default_instance()) delete proxy_;
+  if (this != internal_default_instance()) delete client_;
+}
+
+void ProxyStatsResult::ArenaDtor(void* object) {
+  ProxyStatsResult* _this = reinterpret_cast< ProxyStatsResult* >(object);
+  (void)_this;
+}
+void ProxyStatsResult::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void ProxyStatsResult::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+
+void ProxyStatsResult::Clear() {
+// @@protoc_insertion_point(message_clear_start:com.bcom.solar.gprc.ProxyStatsResult)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  if (GetArena() == nullptr && proxy_ != nullptr) {
+    delete proxy_;
+  }
+  proxy_ = nullptr;
+  if (GetArena() == nullptr && client_ != nullptr) {
+    delete client_;
+  }
+  client_ = nullptr;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ProxyStatsResult::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // .com.bcom.solar.gprc.ProxyStats proxy = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_proxy(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .com.bcom.solar.gprc.ProxyStats client = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_client(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag,
+            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+            ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* ProxyStatsResult::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:com.bcom.solar.gprc.ProxyStatsResult)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .com.bcom.solar.gprc.ProxyStats proxy = 1;
+  if (this->has_proxy()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        1, _Internal::proxy(this), target, stream);
+  }
+
+  // .com.bcom.solar.gprc.ProxyStats client = 2;
+  if (this->has_client()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        2, _Internal::client(this), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:com.bcom.solar.gprc.ProxyStatsResult)
+  return target;
+}
+
+size_t ProxyStatsResult::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:com.bcom.solar.gprc.ProxyStatsResult)
+  size_t total_size = 0;
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // .com.bcom.solar.gprc.ProxyStats proxy = 1;
+  if (this->has_proxy()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *proxy_);
+  }
+
+  // .com.bcom.solar.gprc.ProxyStats client = 2;
+  if (this->has_client()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *client_);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
+        _internal_metadata_, total_size, &_cached_size_);
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void ProxyStatsResult::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:com.bcom.solar.gprc.ProxyStatsResult)
+  GOOGLE_DCHECK_NE(&from, this);
+  const ProxyStatsResult* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<ProxyStatsResult>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:com.bcom.solar.gprc.ProxyStatsResult)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:com.bcom.solar.gprc.ProxyStatsResult)
+    MergeFrom(*source);
+  }
+}
+
+void ProxyStatsResult::MergeFrom(const ProxyStatsResult& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:com.bcom.solar.gprc.ProxyStatsResult)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from.has_proxy()) {
+    _internal_mutable_proxy()->::com::bcom::solar::gprc::ProxyStats::MergeFrom(from._internal_proxy());
+  }
+  if (from.has_client()) {
+    _internal_mutable_client()->::com::bcom::solar::gprc::ProxyStats::MergeFrom(from._internal_client());
+  }
+}
+
+void ProxyStatsResult::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:com.bcom.solar.gprc.ProxyStatsResult)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void ProxyStatsResult::CopyFrom(const ProxyStatsResult& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:com.bcom.solar.gprc.ProxyStatsResult)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ProxyStatsResult::IsInitialized() const {
+  return true;
+}
+
+void ProxyStatsResult::InternalSwap(ProxyStatsResult* other) {
+  using std::swap;
+  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ProxyStatsResult, client_)
+      + sizeof(ProxyStatsResult::client_)
+      - PROTOBUF_FIELD_OFFSET(ProxyStatsResult, proxy_)>(
+          reinterpret_cast<char*>(&proxy_),
+          reinterpret_cast<char*>(&other->proxy_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ProxyStatsResult::GetMetadata() const {
+  return GetMetadataStatic();
+}
+
+
+// ===================================================================
+
+class Image::_Internal {
+ public:
+};
+
+Image::Image(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:com.bcom.solar.gprc.Image)
+}
+Image::Image(const Image& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  data_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  if (!from._internal_data().empty()) {
+    data_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, from._internal_data(), 
+      GetArena());
+  }
+  ::memcpy(&width_, &from.width_,
+    static_cast<size_t>(reinterpret_cast<char*>(&imagecompression_) -
+    reinterpret_cast<char*>(&width_)) + sizeof(imagecompression_));
+  // @@protoc_insertion_point(copy_constructor:com.bcom.solar.gprc.Image)
+}
+
+void Image::SharedCtor() {
+data_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+::memset(reinterpret_cast<char*>(this) + static_cast<size_t>(
+    reinterpret_cast<char*>(&width_) - reinterpret_cast<char*>(this)),
+    0, static_cast<size_t>(reinterpret_cast<char*>(&imagecompression_) -
+    reinterpret_cast<char*>(&width_)) + sizeof(imagecompression_));
+}
+
+Image::~Image() {
+  // @@protoc_insertion_point(destructor:com.bcom.solar.gprc.Image)
+  SharedDtor();
+  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+void Image::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+  data_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+
+void Image::ArenaDtor(void* object) {
+  Image* _this = reinterpret_cast< Image* >(object);
+  (void)_this;
+}
+void Image::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void Image::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+
+void Image::Clear() {
+// @@protoc_insertion_point(message_clear_start:com.bcom.solar.gprc.Image)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  data_.ClearToEmpty();
+  ::memset(&width_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&imagecompression_) -
+      reinterpret_cast<char*>(&width_)) + sizeof(imagecompression_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Image::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // uint32 width = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 8)) {
+          width_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // uint32 height = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 16)) {
+          height_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // bytes data = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 26)) {
+          auto str = _internal_mutable_data();
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .com.bcom.solar.gprc.ImageLayout layout = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 32)) {
+          ::PROTOBUF_NAMESPACE_ID::uint64 val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_layout(static_cast<::com::bcom::solar::gprc::ImageLayout>(val));
+        } else goto handle_unusual;
+        continue;
+      // .com.bcom.solar.gprc.ImageCompression imageCompression = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 40)) {
+          ::PROTOBUF_NAMESPACE_ID::uint64 val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_imagecompression(static_cast<::com::bcom::solar::gprc::ImageCompression>(val));
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag,
+            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+            ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* Image::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:com.bcom.solar.gprc.Image)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint32 width = 1;
+  if (this->width() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt32ToArray(1, this->_internal_width(), target);
+  }
+
+  // uint32 height = 2;
+  if (this->height() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt32ToArray(2, this->_internal_height(), target);
+  }
+
+  // bytes data = 3;
+  if (this->data().size() > 0) {
+    target = stream->WriteBytesMaybeAliased(
+        3, this->_internal_data(), target);
+  }
+
+  // .com.bcom.solar.gprc.ImageLayout layout = 4;
+  if (this->layout() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteEnumToArray(
+      4, this->_internal_layout(), target);
+  }
+
+  // .com.bcom.solar.gprc.ImageCompression imageCompression = 5;
+  if (this->imagecompression() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteEnumToArray(
+      5, this->_internal_imagecompression(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:com.bcom.solar.gprc.Image)
+  return target;
+}
+
+size_t Image::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:com.bcom.solar.gprc.Image)
+  size_t total_size = 0;
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // bytes data = 3;
+  if (this->data().size() > 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_data());
+  }
+
+  // uint32 width = 1;
+  if (this->width() != 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt32Size(
         this->_internal_width());
   }
 
@@ -4226,6 +5988,263 @@ void Frames::InternalSwap(Frames* other) {
 }
 
 
+// ===================================================================
+
+class FramesBatch::_Internal {
+ public:
+};
+
+FramesBatch::FramesBatch(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena),
+  frames_(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:com.bcom.solar.gprc.FramesBatch)
+}
+FramesBatch::FramesBatch(const FramesBatch& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message(),
+      frames_(from.frames_) {
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  client_uuid_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  if (!from._internal_client_uuid().empty()) {
+    client_uuid_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, from._internal_client_uuid(), 
+      GetArena());
+  }
+  last_result_only_ = from.last_result_only_;
+  // @@protoc_insertion_point(copy_constructor:com.bcom.solar.gprc.FramesBatch)
+}
+
+void FramesBatch::SharedCtor() {
+client_uuid_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+last_result_only_ = false;
+}
+
+FramesBatch::~FramesBatch() {
+  // @@protoc_insertion_point(destructor:com.bcom.solar.gprc.FramesBatch)
+  SharedDtor();
+  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+void FramesBatch::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+  client_uuid_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+
+void FramesBatch::ArenaDtor(void* object) {
+  FramesBatch* _this = reinterpret_cast< FramesBatch* >(object);
+  (void)_this;
+}
+void FramesBatch::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void FramesBatch::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+
+void FramesBatch::Clear() {
+// @@protoc_insertion_point(message_clear_start:com.bcom.solar.gprc.FramesBatch)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  frames_.Clear();
+  client_uuid_.ClearToEmpty();
+  last_result_only_ = false;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* FramesBatch::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // string client_uuid = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+          auto str = _internal_mutable_client_uuid();
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "com.bcom.solar.gprc.FramesBatch.client_uuid"));
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // repeated .com.bcom.solar.gprc.Frames frames = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_frames(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else goto handle_unusual;
+        continue;
+      // bool last_result_only = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 24)) {
+          last_result_only_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag,
+            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+            ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* FramesBatch::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:com.bcom.solar.gprc.FramesBatch)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string client_uuid = 1;
+  if (this->client_uuid().size() > 0) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_client_uuid().data(), static_cast<int>(this->_internal_client_uuid().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "com.bcom.solar.gprc.FramesBatch.client_uuid");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_client_uuid(), target);
+  }
+
+  // repeated .com.bcom.solar.gprc.Frames frames = 2;
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->_internal_frames_size()); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, this->_internal_frames(i), target, stream);
+  }
+
+  // bool last_result_only = 3;
+  if (this->last_result_only() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteBoolToArray(3, this->_internal_last_result_only(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:com.bcom.solar.gprc.FramesBatch)
+  return target;
+}
+
+size_t FramesBatch::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:com.bcom.solar.gprc.FramesBatch)
+  size_t total_size = 0;
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .com.bcom.solar.gprc.Frames frames = 2;
+  total_size += 1UL * this->_internal_frames_size();
+  for (const auto& msg : this->frames_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // string client_uuid = 1;
+  if (this->client_uuid().size() > 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_client_uuid());
+  }
+
+  // bool last_result_only = 3;
+  if (this->last_result_only() != 0) {
+    total_size += 1 + 1;
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
+        _internal_metadata_, total_size, &_cached_size_);
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void FramesBatch::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:com.bcom.solar.gprc.FramesBatch)
+  GOOGLE_DCHECK_NE(&from, this);
+  const FramesBatch* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<FramesBatch>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:com.bcom.solar.gprc.FramesBatch)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:com.bcom.solar.gprc.FramesBatch)
+    MergeFrom(*source);
+  }
+}
+
+void FramesBatch::MergeFrom(const FramesBatch& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:com.bcom.solar.gprc.FramesBatch)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  frames_.MergeFrom(from.frames_);
+  if (from.client_uuid().size() > 0) {
+    _internal_set_client_uuid(from._internal_client_uuid());
+  }
+  if (from.last_result_only() != 0) {
+    _internal_set_last_result_only(from._internal_last_result_only());
+  }
+}
+
+void FramesBatch::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:com.bcom.solar.gprc.FramesBatch)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void FramesBatch::CopyFrom(const FramesBatch& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:com.bcom.solar.gprc.FramesBatch)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool FramesBatch::IsInitialized() const {
+  return true;
+}
+
+void FramesBatch::InternalSwap(FramesBatch* other) {
+  using std::swap;
+  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
+  frames_.InternalSwap(&other->frames_);
+  client_uuid_.Swap(&other->client_uuid_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  swap(last_result_only_, other->last_result_only_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata FramesBatch::GetMetadata() const {
+  return GetMetadataStatic();
+}
+
+
 // ===================================================================
 
 class GroundTruthFrames::_Internal {
@@ -6187,12 +8206,27 @@ template<> PROTOBUF_NOINLINE ::com::bcom::solar::gprc::RectificationParameters*
 template<> PROTOBUF_NOINLINE ::com::bcom::solar::gprc::RelocalizationResult* Arena::CreateMaybeMessage< ::com::bcom::solar::gprc::RelocalizationResult >(Arena* arena) {
   return Arena::CreateMessageInternal< ::com::bcom::solar::gprc::RelocalizationResult >(arena);
 }
+template<> PROTOBUF_NOINLINE ::com::bcom::solar::gprc::RelocalizationResults* Arena::CreateMaybeMessage< ::com::bcom::solar::gprc::RelocalizationResults >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::com::bcom::solar::gprc::RelocalizationResults >(arena);
+}
+template<> PROTOBUF_NOINLINE ::com::bcom::solar::gprc::StageLatency* Arena::CreateMaybeMessage< ::com::bcom::solar::gprc::StageLatency >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::com::bcom::solar::gprc::StageLatency >(arena);
+}
+template<> PROTOBUF_NOINLINE ::com::bcom::solar::gprc::ProxyStats* Arena::CreateMaybeMessage< ::com::bcom::solar::gprc::ProxyStats >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::com::bcom::solar::gprc::ProxyStats >(arena);
+}
+template<> PROTOBUF_NOINLINE ::com::bcom::solar::gprc::ProxyStatsResult* Arena::CreateMaybeMessage< ::com::bcom::solar::gprc::ProxyStatsResult >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::com::bcom::solar::gprc::ProxyStatsResult >(arena);
+}
 template<> PROTOBUF_NOINLINE ::com::bcom::solar::gprc::Image* Arena::CreateMaybeMessage< ::com::bcom::solar::gprc::Image >(Arena* arena) {
   return Arena::CreateMessageInternal< ::com::bcom::solar::gprc::Image >(arena);
 }
 template<> PROTOBUF_NOINLINE ::com::bcom::solar::gprc::Frames* Arena::CreateMaybeMessage< ::com::bcom::solar::gprc::Frames >(Arena* arena) {
   return Arena::CreateMessageInternal< ::com::bcom::solar::gprc::Frames >(arena);
 }
+template<> PROTOBUF_NOINLINE ::com::bcom::solar::gprc::FramesBatch* Arena::CreateMaybeMessage< ::com::bcom::solar::gprc::FramesBatch >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::com::bcom::solar::gprc::FramesBatch >(arena);
+}
 template<> PROTOBUF_NOINLINE ::com::bcom::solar::gprc::GroundTruthFrames* Arena::CreateMaybeMessage< ::com::bcom::solar::gprc::GroundTruthFrames >(Arena* arena) {
   return Arena::CreateMessageInternal< ::com::bcom::solar::gprc::GroundTruthFrames >(arena);
 }
@@ -47,7 +47,7 @@ struct TableStruct_solar_5fmapping_5fand_5frelocalization_5fproxy_2eproto {
     PROTOBUF_SECTION_VARIABLE(protodesc_cold);
   static const ::PROTOBUF_NAMESPACE_ID::internal::AuxiliaryParseTableField aux[]
     PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTable schema[16]
+  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTable schema[21]
     PROTOBUF_SECTION_VARIABLE(protodesc_cold);
   static const ::PROTOBUF_NAMESPACE_ID::internal::FieldMetadata field_metadata[];
   static const ::PROTOBUF_NAMESPACE_ID::internal::SerializationTable serialization_table[];
@@ -80,6 +80,9 @@ extern FrameDefaultTypeInternal _Frame_default_instance_;
 class Frames;
 struct FramesDefaultTypeInternal;
 extern FramesDefaultTypeInternal _Frames_default_instance_;
+class FramesBatch;
+struct FramesBatchDefaultTypeInternal;
+extern FramesBatchDefaultTypeInternal _FramesBatch_default_instance_;
 class GroundTruthFrames;
 struct GroundTruthFramesDefaultTypeInternal;
 extern GroundTruthFramesDefaultTypeInternal _GroundTruthFrames_default_instance_;
@@ -101,12 +104,24 @@ extern MessageDefaultTypeInternal _Message_default_instance_;
 class PipelineModeValue;
 struct PipelineModeValueDefaultTypeInternal;
 extern PipelineModeValueDefaultTypeInternal _PipelineModeValue_default_instance_;
+class ProxyStats;
+struct ProxyStatsDefaultTypeInternal;
+extern ProxyStatsDefaultTypeInternal _ProxyStats_default_instance_;
+class ProxyStatsResult;
+struct ProxyStatsResultDefaultTypeInternal;
+extern ProxyStatsResultDefaultTypeInternal _ProxyStatsResult_default_instance_;
 class RectificationParameters;
 struct RectificationParametersDefaultTypeInternal;
 extern RectificationParametersDefaultTypeInternal _RectificationParameters_default_instance_;
 class RelocalizationResult;
 struct RelocalizationResultDefaultTypeInternal;
 extern RelocalizationResultDefaultTypeInternal _RelocalizationResult_default_instance_;
+class RelocalizationResults;
+struct RelocalizationResultsDefaultTypeInternal;
+extern RelocalizationResultsDefaultTypeInternal _RelocalizationResults_default_instance_;
+class StageLatency;
+struct StageLatencyDefaultTypeInternal;
+extern StageLatencyDefaultTypeInternal _StageLatency_default_instance_;
 }  // namespace gprc
 }  // namespace solar
 }  // namespace bcom
@@ -119,6 +134,7 @@ template<> ::com::bcom::solar::gprc::ClientUUID* Arena::CreateMaybeMessage<::com
 template<> ::com::bcom::solar::gprc::Empty* Arena::CreateMaybeMessage<::com::bcom::solar::gprc::Empty>(Arena*);
 template<> ::com::bcom::solar::gprc::Frame* Arena::CreateMaybeMessage<::com::bcom::solar::gprc::Frame>(Arena*);
 template<> ::com::bcom::solar::gprc::Frames* Arena::CreateMaybeMessage<::com::bcom::solar::gprc::Frames>(Arena*);
+template<> ::com::bcom::solar::gprc::FramesBatch* Arena::CreateMaybeMessage<::com::bcom::solar::gprc::FramesBatch>(Arena*);
 template<> ::com::bcom::solar::gprc::GroundTruthFrames* Arena::CreateMaybeMessage<::com::bcom::solar::gprc::GroundTruthFrames>(Arena*);
 template<> ::com::bcom::solar::gprc::Image* Arena::CreateMaybeMessage<::com::bcom::solar::gprc::Image>(Arena*);
 template<> ::com::bcom::solar::gprc::Matrix3x3* Arena::CreateMaybeMessage<::com::bcom::solar::gprc::Matrix3x3>(Arena*);
@@ -126,8 +142,12 @@ template<> ::com::bcom::solar::gprc::Matrix3x4* Arena::CreateMaybeMessage<::com:
 template<> ::com::bcom::solar::gprc::Matrix4x4* Arena::CreateMaybeMessage<::com::bcom::solar::gprc::Matrix4x4>(Arena*);
 template<> ::com::bcom::solar::gprc::Message* Arena::CreateMaybeMessage<::com::bcom::solar::gprc::Message>(Arena*);
 template<> ::com::bcom::solar::gprc::PipelineModeValue* Arena::CreateMaybeMessage<::com::bcom::solar::gprc::PipelineModeValue>(Arena*);
+template<> ::com::bcom::solar::gprc::ProxyStats* Arena::CreateMaybeMessage<::com::bcom::solar::gprc::ProxyStats>(Arena*);
+template<> ::com::bcom::solar::gprc::ProxyStatsResult* Arena::CreateMaybeMessage<::com::bcom::solar::gprc::ProxyStatsResult>(Arena*);
 template<> ::com::bcom::solar::gprc::RectificationParameters* Arena::CreateMaybeMessage<::com::bcom::solar::gprc::RectificationParameters>(Arena*);
 template<> ::com::bcom::solar::gprc::RelocalizationResult* Arena::CreateMaybeMessage<::com::bcom::solar::gprc::RelocalizationResult>(Arena*);
+template<> ::com::bcom::solar::gprc::RelocalizationResults* Arena::CreateMaybeMessage<::com::bcom::solar::gprc::RelocalizationResults>(Arena*);
+template<> ::com::bcom::solar::gprc::StageLatency* Arena::CreateMaybeMessage<::com::bcom::solar::gprc::StageLatency>(Arena*);
 PROTOBUF_NAMESPACE_CLOSE
 namespace com {
 namespace bcom {
@@ -159,6 +179,32 @@ inline bool PipelineMode_Parse(
   return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<PipelineMode>(
     PipelineMode_descriptor(), name, value);
 }
+enum ImageRotation : int {
+  DEFAULT_ROTATION = 0,
+  NO_ROTATION = 1,
+  ROTATION_180 = 2,
+  ImageRotation_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<::PROTOBUF_NAMESPACE_ID::int32>::min(),
+  ImageRotation_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<::PROTOBUF_NAMESPACE_ID::int32>::max()
+};
+bool ImageRotation_IsValid(int value);
+constexpr ImageRotation ImageRotation_MIN = DEFAULT_ROTATION;
+constexpr ImageRotation ImageRotation_MAX = ROTATION_180;
+constexpr int ImageRotation_ARRAYSIZE = ImageRotation_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* ImageRotation_descriptor();
+template<typename T>
+inline const std::string& ImageRotation_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, ImageRotation>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function ImageRotation_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    ImageRotation_descriptor(), enum_t_value);
+}
+inline bool ImageRotation_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, ImageRotation* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<ImageRotation>(
+    ImageRotation_descriptor(), name, value);
+}
 enum CameraType : int {
   RGB = 0,
   GRAY = 1,
@@ -1022,6 +1068,7 @@ class CameraParameters PROTOBUF_FINAL :
     kCameraTypeFieldNumber = 4,
     kWidthFieldNumber = 5,
     kHeightFieldNumber = 6,
+    kRotationFieldNumber = 9,
   };
   // string client_uuid = 1;
   void clear_client_uuid();
@@ -1127,6 +1174,15 @@ class CameraParameters PROTOBUF_FINAL :
   void _internal_set_height(::PROTOBUF_NAMESPACE_ID::uint32 value);
   public:
 
+  // .com.bcom.solar.gprc.ImageRotation rotation = 9;
+  void clear_rotation();
+  ::com::bcom::solar::gprc::ImageRotation rotation() const;
+  void set_rotation(::com::bcom::solar::gprc::ImageRotation value);
+  private:
+  ::com::bcom::solar::gprc::ImageRotation _internal_rotation() const;
+  void _internal_set_rotation(::com::bcom::solar::gprc::ImageRotation value);
+  public:
+
   // @@protoc_insertion_point(class_scope:com.bcom.solar.gprc.CameraParameters)
  private:
   class _Internal;
@@ -1142,6 +1198,7 @@ class CameraParameters PROTOBUF_FINAL :
   int camera_type_;
   ::PROTOBUF_NAMESPACE_ID::uint32 width_;
   ::PROTOBUF_NAMESPACE_ID::uint32 height_;
+  int rotation_;
   mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   friend struct ::TableStruct_solar_5fmapping_5fand_5frelocalization_5fproxy_2eproto;
 };
@@ -1275,6 +1332,8 @@ class CameraParametersStereo PROTOBUF_FINAL :
     kCameraType2FieldNumber = 11,
     kWidth2FieldNumber = 12,
     kHeight2FieldNumber = 13,
+    kRotation1FieldNumber = 16,
+    kRotation2FieldNumber = 17,
   };
   // string client_uuid = 1;
   void clear_client_uuid();
@@ -1468,6 +1527,24 @@ class CameraParametersStereo PROTOBUF_FINAL :
   void _internal_set_height2(::PROTOBUF_NAMESPACE_ID::uint32 value);
   public:
 
+  // .com.bcom.solar.gprc.ImageRotation rotation1 = 16;
+  void clear_rotation1();
+  ::com::bcom::solar::gprc::ImageRotation rotation1() const;
+  void set_rotation1(::com::bcom::solar::gprc::ImageRotation value);
+  private:
+  ::com::bcom::solar::gprc::ImageRotation _internal_rotation1() const;
+  void _internal_set_rotation1(::com::bcom::solar::gprc::ImageRotation value);
+  public:
+
+  // .com.bcom.solar.gprc.ImageRotation rotation2 = 17;
+  void clear_rotation2();
+  ::com::bcom::solar::gprc::ImageRotation rotation2() const;
+  void set_rotation2(::com::bcom::solar::gprc::ImageRotation value);
+  private:
+  ::com::bcom::solar::gprc::ImageRotation _internal_rotation2() const;
+  void _internal_set_rotation2(::com::bcom::solar::gprc::ImageRotation value);
+  public:
+
   // @@protoc_insertion_point(class_scope:com.bcom.solar.gprc.CameraParametersStereo)
  private:
   class _Internal;
@@ -1490,6 +1567,8 @@ class CameraParametersStereo PROTOBUF_FINAL :
   int camera_type2_;
   ::PROTOBUF_NAMESPACE_ID::uint32 width2_;
   ::PROTOBUF_NAMESPACE_ID::uint32 height2_;
+  int rotation1_;
+  int rotation2_;
   mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   friend struct ::TableStruct_solar_5fmapping_5fand_5frelocalization_5fproxy_2eproto;
 };
@@ -2060,6 +2139,7 @@ class RelocalizationResult PROTOBUF_FINAL :
     kPoseFieldNumber = 2,
     kPoseStatusFieldNumber = 1,
     kConfidenceFieldNumber = 3,
+    kTimestampFieldNumber = 5,
     kMappingStatusFieldNumber = 4,
   };
   // .com.bcom.solar.gprc.Matrix4x4 pose = 2;
@@ -2098,6 +2178,15 @@ class RelocalizationResult PROTOBUF_FINAL :
   void _internal_set_confidence(float value);
   public:
 
+  // uint64 timestamp = 5;
+  void clear_timestamp();
+  ::PROTOBUF_NAMESPACE_ID::uint64 timestamp() const;
+  void set_timestamp(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::uint64 _internal_timestamp() const;
+  void _internal_set_timestamp(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  public:
+
   // .com.bcom.solar.gprc.MappingStatus mapping_status = 4;
   void clear_mapping_status();
   ::com::bcom::solar::gprc::MappingStatus mapping_status() const;
@@ -2117,30 +2206,31 @@ class RelocalizationResult PROTOBUF_FINAL :
   ::com::bcom::solar::gprc::Matrix4x4* pose_;
   int pose_status_;
   float confidence_;
+  ::PROTOBUF_NAMESPACE_ID::uint64 timestamp_;
   int mapping_status_;
   mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   friend struct ::TableStruct_solar_5fmapping_5fand_5frelocalization_5fproxy_2eproto;
 };
 // -------------------------------------------------------------------
 
-class Image PROTOBUF_FINAL :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:com.bcom.solar.gprc.Image) */ {
+class RelocalizationResults PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:com.bcom.solar.gprc.RelocalizationResults) */ {
  public:
-  inline Image() : Image(nullptr) {}
-  virtual ~Image();
-  explicit constexpr Image(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline RelocalizationResults() : RelocalizationResults(nullptr) {}
+  virtual ~RelocalizationResults();
+  explicit constexpr RelocalizationResults(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  Image(const Image& from);
-  Image(Image&& from) noexcept
-    : Image() {
+  RelocalizationResults(const RelocalizationResults& from);
+  RelocalizationResults(RelocalizationResults&& from) noexcept
+    : RelocalizationResults() {
     *this = ::std::move(from);
   }
 
-  inline Image& operator=(const Image& from) {
+  inline RelocalizationResults& operator=(const RelocalizationResults& from) {
     CopyFrom(from);
     return *this;
   }
-  inline Image& operator=(Image&& from) noexcept {
+  inline RelocalizationResults& operator=(RelocalizationResults&& from) noexcept {
     if (GetArena() == from.GetArena()) {
       if (this != &from) InternalSwap(&from);
     } else {
@@ -2158,20 +2248,20 @@ class Image PROTOBUF_FINAL :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return GetMetadataStatic().reflection;
   }
-  static const Image& default_instance() {
+  static const RelocalizationResults& default_instance() {
     return *internal_default_instance();
   }
-  static inline const Image* internal_default_instance() {
-    return reinterpret_cast<const Image*>(
-               &_Image_default_instance_);
+  static inline const RelocalizationResults* internal_default_instance() {
+    return reinterpret_cast<const RelocalizationResults*>(
+               &_RelocalizationResults_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     9;
 
-  friend void swap(Image& a, Image& b) {
+  friend void swap(RelocalizationResults& a, RelocalizationResults& b) {
     a.Swap(&b);
   }
-  inline void Swap(Image* other) {
+  inline void Swap(RelocalizationResults* other) {
     if (other == this) return;
     if (GetArena() == other->GetArena()) {
       InternalSwap(other);
@@ -2179,7 +2269,7 @@ class Image PROTOBUF_FINAL :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(Image* other) {
+  void UnsafeArenaSwap(RelocalizationResults* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetArena() == other->GetArena());
     InternalSwap(other);
@@ -2187,17 +2277,17 @@ class Image PROTOBUF_FINAL :
 
   // implements Message ----------------------------------------------
 
-  inline Image* New() const final {
-    return CreateMaybeMessage<Image>(nullptr);
+  inline RelocalizationResults* New() const final {
+    return CreateMaybeMessage<RelocalizationResults>(nullptr);
   }
 
-  Image* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
-    return CreateMaybeMessage<Image>(arena);
+  RelocalizationResults* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<RelocalizationResults>(arena);
   }
   void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
   void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void CopyFrom(const Image& from);
-  void MergeFrom(const Image& from);
+  void CopyFrom(const RelocalizationResults& from);
+  void MergeFrom(const RelocalizationResults& from);
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
@@ -2211,13 +2301,13 @@ class Image PROTOBUF_FINAL :
   inline void SharedCtor();
   inline void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(Image* other);
+  void InternalSwap(RelocalizationResults* other);
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "com.bcom.solar.gprc.Image";
+    return "com.bcom.solar.gprc.RelocalizationResults";
   }
   protected:
-  explicit Image(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit RelocalizationResults(::PROTOBUF_NAMESPACE_ID::Arena* arena);
   private:
   static void ArenaDtor(void* object);
   inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
@@ -2236,99 +2326,57 @@ class Image PROTOBUF_FINAL :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kDataFieldNumber = 3,
-    kWidthFieldNumber = 1,
-    kHeightFieldNumber = 2,
-    kLayoutFieldNumber = 4,
-    kImageCompressionFieldNumber = 5,
+    kResultsFieldNumber = 1,
   };
-  // bytes data = 3;
-  void clear_data();
-  const std::string& data() const;
-  void set_data(const std::string& value);
-  void set_data(std::string&& value);
-  void set_data(const char* value);
-  void set_data(const void* value, size_t size);
-  std::string* mutable_data();
-  std::string* release_data();
-  void set_allocated_data(std::string* data);
-  private:
-  const std::string& _internal_data() const;
-  void _internal_set_data(const std::string& value);
-  std::string* _internal_mutable_data();
-  public:
-
-  // uint32 width = 1;
-  void clear_width();
-  ::PROTOBUF_NAMESPACE_ID::uint32 width() const;
-  void set_width(::PROTOBUF_NAMESPACE_ID::uint32 value);
-  private:
-  ::PROTOBUF_NAMESPACE_ID::uint32 _internal_width() const;
-  void _internal_set_width(::PROTOBUF_NAMESPACE_ID::uint32 value);
-  public:
-
-  // uint32 height = 2;
-  void clear_height();
-  ::PROTOBUF_NAMESPACE_ID::uint32 height() const;
-  void set_height(::PROTOBUF_NAMESPACE_ID::uint32 value);
-  private:
-  ::PROTOBUF_NAMESPACE_ID::uint32 _internal_height() const;
-  void _internal_set_height(::PROTOBUF_NAMESPACE_ID::uint32 value);
-  public:
-
-  // .com.bcom.solar.gprc.ImageLayout layout = 4;
-  void clear_layout();
-  ::com::bcom::solar::gprc::ImageLayout layout() const;
-  void set_layout(::com::bcom::solar::gprc::ImageLayout value);
+  // repeated .com.bcom.solar.gprc.RelocalizationResult results = 1;
+  int results_size() const;
   private:
-  ::com::bcom::solar::gprc::ImageLayout _internal_layout() const;
-  void _internal_set_layout(::com::bcom::solar::gprc::ImageLayout value);
+  int _internal_results_size() const;
   public:
-
-  // .com.bcom.solar.gprc.ImageCompression imageCompression = 5;
-  void clear_imagecompression();
-  ::com::bcom::solar::gprc::ImageCompression imagecompression() const;
-  void set_imagecompression(::com::bcom::solar::gprc::ImageCompression value);
+  void clear_results();
+  ::com::bcom::solar::gprc::RelocalizationResult* mutable_results(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::com::bcom::solar::gprc::RelocalizationResult >*
+      mutable_results();
   private:
-  ::com::bcom::solar::gprc::ImageCompression _internal_imagecompression() const;
-  void _internal_set_imagecompression(::com::bcom::solar::gprc::ImageCompression value);
+  const ::com::bcom::solar::gprc::RelocalizationResult& _internal_results(int index) const;
+  ::com::bcom::solar::gprc::RelocalizationResult* _internal_add_results();
   public:
+  const ::com::bcom::solar::gprc::RelocalizationResult& results(int index) const;
+  ::com::bcom::solar::gprc::RelocalizationResult* add_results();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::com::bcom::solar::gprc::RelocalizationResult >&
+      results() const;
 
-  // @@protoc_insertion_point(class_scope:com.bcom.solar.gprc.Image)
+  // @@protoc_insertion_point(class_scope:com.bcom.solar.gprc.RelocalizationResults)
  private:
   class _Internal;
 
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr data_;
-  ::PROTOBUF_NAMESPACE_ID::uint32 width_;
-  ::PROTOBUF_NAMESPACE_ID::uint32 height_;
-  int layout_;
-  int imagecompression_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::com::bcom::solar::gprc::RelocalizationResult > results_;
   mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   friend struct ::TableStruct_solar_5fmapping_5fand_5frelocalization_5fproxy_2eproto;
 };
 // -------------------------------------------------------------------
 
-class Frames PROTOBUF_FINAL :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:com.bcom.solar.gprc.Frames) */ {
+class StageLatency PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:com.bcom.solar.gprc.StageLatency) */ {
  public:
-  inline Frames() : Frames(nullptr) {}
-  virtual ~Frames();
-  explicit constexpr Frames(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline StageLatency() : StageLatency(nullptr) {}
+  virtual ~StageLatency();
+  explicit constexpr StageLatency(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  Frames(const Frames& from);
-  Frames(Frames&& from) noexcept
-    : Frames() {
+  StageLatency(const StageLatency& from);
+  StageLatency(StageLatency&& from) noexcept
+    : StageLatency() {
     *this = ::std::move(from);
   }
 
-  inline Frames& operator=(const Frames& from) {
+  inline StageLatency& operator=(const StageLatency& from) {
     CopyFrom(from);
     return *this;
   }
-  inline Frames& operator=(Frames&& from) noexcept {
+  inline StageLatency& operator=(StageLatency&& from) noexcept {
     if (GetArena() == from.GetArena()) {
       if (this != &from) InternalSwap(&from);
     } else {
@@ -2346,20 +2394,20 @@ class Frames PROTOBUF_FINAL :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return GetMetadataStatic().reflection;
   }
-  static const Frames& default_instance() {
+  static const StageLatency& default_instance() {
     return *internal_default_instance();
   }
-  static inline const Frames* internal_default_instance() {
-    return reinterpret_cast<const Frames*>(
-               &_Frames_default_instance_);
+  static inline const StageLatency* internal_default_instance() {
+    return reinterpret_cast<const StageLatency*>(
+               &_StageLatency_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     10;
 
-  friend void swap(Frames& a, Frames& b) {
+  friend void swap(StageLatency& a, StageLatency& b) {
     a.Swap(&b);
   }
-  inline void Swap(Frames* other) {
+  inline void Swap(StageLatency* other) {
     if (other == this) return;
     if (GetArena() == other->GetArena()) {
       InternalSwap(other);
@@ -2367,7 +2415,7 @@ class Frames PROTOBUF_FINAL :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(Frames* other) {
+  void UnsafeArenaSwap(StageLatency* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetArena() == other->GetArena());
     InternalSwap(other);
@@ -2375,17 +2423,17 @@ class Frames PROTOBUF_FINAL :
 
   // implements Message ----------------------------------------------
 
-  inline Frames* New() const final {
-    return CreateMaybeMessage<Frames>(nullptr);
+  inline StageLatency* New() const final {
+    return CreateMaybeMessage<StageLatency>(nullptr);
   }
 
-  Frames* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
-    return CreateMaybeMessage<Frames>(arena);
+  StageLatency* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<StageLatency>(arena);
   }
   void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
   void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void CopyFrom(const Frames& from);
-  void MergeFrom(const Frames& from);
+  void CopyFrom(const StageLatency& from);
+  void MergeFrom(const StageLatency& from);
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
@@ -2399,13 +2447,13 @@ class Frames PROTOBUF_FINAL :
   inline void SharedCtor();
   inline void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(Frames* other);
+  void InternalSwap(StageLatency* other);
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "com.bcom.solar.gprc.Frames";
+    return "com.bcom.solar.gprc.StageLatency";
   }
   protected:
-  explicit Frames(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit StageLatency(::PROTOBUF_NAMESPACE_ID::Arena* arena);
   private:
   static void ArenaDtor(void* object);
   inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
@@ -2424,75 +2472,114 @@ class Frames PROTOBUF_FINAL :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kFramesFieldNumber = 2,
-    kClientUuidFieldNumber = 1,
+    kCountFieldNumber = 1,
+    kMeanMsFieldNumber = 2,
+    kP50MsFieldNumber = 3,
+    kP90MsFieldNumber = 4,
+    kP99MsFieldNumber = 5,
+    kP999MsFieldNumber = 6,
+    kMaxMsFieldNumber = 7,
   };
-  // repeated .com.bcom.solar.gprc.Frame frames = 2;
-  int frames_size() const;
+  // uint64 count = 1;
+  void clear_count();
+  ::PROTOBUF_NAMESPACE_ID::uint64 count() const;
+  void set_count(::PROTOBUF_NAMESPACE_ID::uint64 value);
   private:
-  int _internal_frames_size() const;
+  ::PROTOBUF_NAMESPACE_ID::uint64 _internal_count() const;
+  void _internal_set_count(::PROTOBUF_NAMESPACE_ID::uint64 value);
   public:
-  void clear_frames();
-  ::com::bcom::solar::gprc::Frame* mutable_frames(int index);
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::com::bcom::solar::gprc::Frame >*
-      mutable_frames();
+
+  // float mean_ms = 2;
+  void clear_mean_ms();
+  float mean_ms() const;
+  void set_mean_ms(float value);
   private:
-  const ::com::bcom::solar::gprc::Frame& _internal_frames(int index) const;
-  ::com::bcom::solar::gprc::Frame* _internal_add_frames();
+  float _internal_mean_ms() const;
+  void _internal_set_mean_ms(float value);
   public:
-  const ::com::bcom::solar::gprc::Frame& frames(int index) const;
-  ::com::bcom::solar::gprc::Frame* add_frames();
-  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::com::bcom::solar::gprc::Frame >&
-      frames() const;
 
-  // string client_uuid = 1;
-  void clear_client_uuid();
-  const std::string& client_uuid() const;
-  void set_client_uuid(const std::string& value);
-  void set_client_uuid(std::string&& value);
-  void set_client_uuid(const char* value);
-  void set_client_uuid(const char* value, size_t size);
-  std::string* mutable_client_uuid();
-  std::string* release_client_uuid();
-  void set_allocated_client_uuid(std::string* client_uuid);
+  // float p50_ms = 3;
+  void clear_p50_ms();
+  float p50_ms() const;
+  void set_p50_ms(float value);
   private:
-  const std::string& _internal_client_uuid() const;
-  void _internal_set_client_uuid(const std::string& value);
-  std::string* _internal_mutable_client_uuid();
+  float _internal_p50_ms() const;
+  void _internal_set_p50_ms(float value);
   public:
 
-  // @@protoc_insertion_point(class_scope:com.bcom.solar.gprc.Frames)
+  // float p90_ms = 4;
+  void clear_p90_ms();
+  float p90_ms() const;
+  void set_p90_ms(float value);
+  private:
+  float _internal_p90_ms() const;
+  void _internal_set_p90_ms(float value);
+  public:
+
+  // float p99_ms = 5;
+  void clear_p99_ms();
+  float p99_ms() const;
+  void set_p99_ms(float value);
+  private:
+  float _internal_p99_ms() const;
+  void _internal_set_p99_ms(float value);
+  public:
+
+  // float p999_ms = 6;
+  void clear_p999_ms();
+  float p999_ms() const;
+  void set_p999_ms(float value);
+  private:
+  float _internal_p999_ms() const;
+  void _internal_set_p999_ms(float value);
+  public:
+
+  // float max_ms = 7;
+  void clear_max_ms();
+  float max_ms() const;
+  void set_max_ms(float value);
+  private:
+  float _internal_max_ms() const;
+  void _internal_set_max_ms(float value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:com.bcom.solar.gprc.StageLatency)
  private:
   class _Internal;
 
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::com::bcom::solar::gprc::Frame > frames_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr client_uuid_;
+  ::PROTOBUF_NAMESPACE_ID::uint64 count_;
+  float mean_ms_;
+  float p50_ms_;
+  float p90_ms_;
+  float p99_ms_;
+  float p999_ms_;
+  float max_ms_;
   mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   friend struct ::TableStruct_solar_5fmapping_5fand_5frelocalization_5fproxy_2eproto;
 };
 // -------------------------------------------------------------------
 
-class GroundTruthFrames PROTOBUF_FINAL :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:com.bcom.solar.gprc.GroundTruthFrames) */ {
+class ProxyStats PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:com.bcom.solar.gprc.ProxyStats) */ {
  public:
-  inline GroundTruthFrames() : GroundTruthFrames(nullptr) {}
-  virtual ~GroundTruthFrames();
-  explicit constexpr GroundTruthFrames(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline ProxyStats() : ProxyStats(nullptr) {}
+  virtual ~ProxyStats();
+  explicit constexpr ProxyStats(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  GroundTruthFrames(const GroundTruthFrames& from);
-  GroundTruthFrames(GroundTruthFrames&& from) noexcept
-    : GroundTruthFrames() {
+  ProxyStats(const ProxyStats& from);
+  ProxyStats(ProxyStats&& from) noexcept
+    : ProxyStats() {
     *this = ::std::move(from);
   }
 
-  inline GroundTruthFrames& operator=(const GroundTruthFrames& from) {
+  inline ProxyStats& operator=(const ProxyStats& from) {
     CopyFrom(from);
     return *this;
   }
-  inline GroundTruthFrames& operator=(GroundTruthFrames&& from) noexcept {
+  inline ProxyStats& operator=(ProxyStats&& from) noexcept {
     if (GetArena() == from.GetArena()) {
       if (this != &from) InternalSwap(&from);
     } else {
@@ -2510,20 +2597,20 @@ class GroundTruthFrames PROTOBUF_FINAL :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return GetMetadataStatic().reflection;
   }
-  static const GroundTruthFrames& default_instance() {
+  static const ProxyStats& default_instance() {
     return *internal_default_instance();
   }
-  static inline const GroundTruthFrames* internal_default_instance() {
-    return reinterpret_cast<const GroundTruthFrames*>(
-               &_GroundTruthFrames_default_instance_);
+  static inline const ProxyStats* internal_default_instance() {
+    return reinterpret_cast<const ProxyStats*>(
+               &_ProxyStats_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     11;
 
-  friend void swap(GroundTruthFrames& a, GroundTruthFrames& b) {
+  friend void swap(ProxyStats& a, ProxyStats& b) {
     a.Swap(&b);
   }
-  inline void Swap(GroundTruthFrames* other) {
+  inline void Swap(ProxyStats* other) {
     if (other == this) return;
     if (GetArena() == other->GetArena()) {
       InternalSwap(other);
@@ -2531,7 +2618,7 @@ class GroundTruthFrames PROTOBUF_FINAL :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(GroundTruthFrames* other) {
+  void UnsafeArenaSwap(ProxyStats* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetArena() == other->GetArena());
     InternalSwap(other);
@@ -2539,17 +2626,17 @@ class GroundTruthFrames PROTOBUF_FINAL :
 
   // implements Message ----------------------------------------------
 
-  inline GroundTruthFrames* New() const final {
-    return CreateMaybeMessage<GroundTruthFrames>(nullptr);
+  inline ProxyStats* New() const final {
+    return CreateMaybeMessage<ProxyStats>(nullptr);
   }
 
-  GroundTruthFrames* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
-    return CreateMaybeMessage<GroundTruthFrames>(arena);
+  ProxyStats* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<ProxyStats>(arena);
   }
   void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
   void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void CopyFrom(const GroundTruthFrames& from);
-  void MergeFrom(const GroundTruthFrames& from);
+  void CopyFrom(const ProxyStats& from);
+  void MergeFrom(const ProxyStats& from);
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
@@ -2563,13 +2650,13 @@ class GroundTruthFrames PROTOBUF_FINAL :
   inline void SharedCtor();
   inline void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(GroundTruthFrames* other);
+  void InternalSwap(ProxyStats* other);
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "com.bcom.solar.gprc.GroundTruthFrames";
+    return "com.bcom.solar.gprc.ProxyStats";
   }
   protected:
-  explicit GroundTruthFrames(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit ProxyStats(::PROTOBUF_NAMESPACE_ID::Arena* arena);
   private:
   static void ArenaDtor(void* object);
   inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
@@ -2588,106 +2675,280 @@ class GroundTruthFrames PROTOBUF_FINAL :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kClientUuidFieldNumber = 1,
-    kFramesFieldNumber = 2,
-    kWorldTransormFieldNumber = 3,
-    kFixedPoseFieldNumber = 4,
+    kQueueWaitFieldNumber = 1,
+    kDecodeFieldNumber = 2,
+    kReorderFieldNumber = 3,
+    kFrontEndFieldNumber = 4,
+    kTotalFieldNumber = 5,
+    kNbRequestsFieldNumber = 6,
+    kNbErrorsFieldNumber = 7,
+    kNbRejectedFieldNumber = 8,
+    kNbLateDroppedFieldNumber = 9,
+    kNbShrinkDroppedFieldNumber = 10,
+    kNbOverloadDroppedFieldNumber = 11,
+    kNbLatestPoseRepliesFieldNumber = 12,
+    kNbMotionGatedFieldNumber = 13,
+    kNbDuplicatesFieldNumber = 14,
+    kNbModeSwitchesFieldNumber = 15,
+    kReorderDepthFieldNumber = 16,
+    kJitterMsFieldNumber = 17,
+    kOutOfOrderRateFieldNumber = 18,
   };
-  // string client_uuid = 1;
-  void clear_client_uuid();
-  const std::string& client_uuid() const;
-  void set_client_uuid(const std::string& value);
-  void set_client_uuid(std::string&& value);
-  void set_client_uuid(const char* value);
-  void set_client_uuid(const char* value, size_t size);
-  std::string* mutable_client_uuid();
-  std::string* release_client_uuid();
-  void set_allocated_client_uuid(std::string* client_uuid);
+  // .com.bcom.solar.gprc.StageLatency queue_wait = 1;
+  bool has_queue_wait() const;
   private:
-  const std::string& _internal_client_uuid() const;
-  void _internal_set_client_uuid(const std::string& value);
-  std::string* _internal_mutable_client_uuid();
+  bool _internal_has_queue_wait() const;
+  public:
+  void clear_queue_wait();
+  const ::com::bcom::solar::gprc::StageLatency& queue_wait() const;
+  ::com::bcom::solar::gprc::StageLatency* release_queue_wait();
+  ::com::bcom::solar::gprc::StageLatency* mutable_queue_wait();
+  void set_allocated_queue_wait(::com::bcom::solar::gprc::StageLatency* queue_wait);
+  private:
+  const ::com::bcom::solar::gprc::StageLatency& _internal_queue_wait() const;
+  ::com::bcom::solar::gprc::StageLatency* _internal_mutable_queue_wait();
   public:
+  void unsafe_arena_set_allocated_queue_wait(
+      ::com::bcom::solar::gprc::StageLatency* queue_wait);
+  ::com::bcom::solar::gprc::StageLatency* unsafe_arena_release_queue_wait();
 
-  // .com.bcom.solar.gprc.Frames frames = 2;
-  bool has_frames() const;
+  // .com.bcom.solar.gprc.StageLatency decode = 2;
+  bool has_decode() const;
   private:
-  bool _internal_has_frames() const;
+  bool _internal_has_decode() const;
   public:
-  void clear_frames();
-  const ::com::bcom::solar::gprc::Frames& frames() const;
-  ::com::bcom::solar::gprc::Frames* release_frames();
-  ::com::bcom::solar::gprc::Frames* mutable_frames();
-  void set_allocated_frames(::com::bcom::solar::gprc::Frames* frames);
+  void clear_decode();
+  const ::com::bcom::solar::gprc::StageLatency& decode() const;
+  ::com::bcom::solar::gprc::StageLatency* release_decode();
+  ::com::bcom::solar::gprc::StageLatency* mutable_decode();
+  void set_allocated_decode(::com::bcom::solar::gprc::StageLatency* decode);
   private:
-  const ::com::bcom::solar::gprc::Frames& _internal_frames() const;
-  ::com::bcom::solar::gprc::Frames* _internal_mutable_frames();
+  const ::com::bcom::solar::gprc::StageLatency& _internal_decode() const;
+  ::com::bcom::solar::gprc::StageLatency* _internal_mutable_decode();
   public:
-  void unsafe_arena_set_allocated_frames(
-      ::com::bcom::solar::gprc::Frames* frames);
-  ::com::bcom::solar::gprc::Frames* unsafe_arena_release_frames();
+  void unsafe_arena_set_allocated_decode(
+      ::com::bcom::solar::gprc::StageLatency* decode);
+  ::com::bcom::solar::gprc::StageLatency* unsafe_arena_release_decode();
 
-  // .com.bcom.solar.gprc.Matrix4x4 world_transorm = 3;
-  bool has_world_transorm() const;
+  // .com.bcom.solar.gprc.StageLatency reorder = 3;
+  bool has_reorder() const;
   private:
-  bool _internal_has_world_transorm() const;
+  bool _internal_has_reorder() const;
   public:
-  void clear_world_transorm();
-  const ::com::bcom::solar::gprc::Matrix4x4& world_transorm() const;
-  ::com::bcom::solar::gprc::Matrix4x4* release_world_transorm();
-  ::com::bcom::solar::gprc::Matrix4x4* mutable_world_transorm();
-  void set_allocated_world_transorm(::com::bcom::solar::gprc::Matrix4x4* world_transorm);
+  void clear_reorder();
+  const ::com::bcom::solar::gprc::StageLatency& reorder() const;
+  ::com::bcom::solar::gprc::StageLatency* release_reorder();
+  ::com::bcom::solar::gprc::StageLatency* mutable_reorder();
+  void set_allocated_reorder(::com::bcom::solar::gprc::StageLatency* reorder);
   private:
-  const ::com::bcom::solar::gprc::Matrix4x4& _internal_world_transorm() const;
-  ::com::bcom::solar::gprc::Matrix4x4* _internal_mutable_world_transorm();
+  const ::com::bcom::solar::gprc::StageLatency& _internal_reorder() const;
+  ::com::bcom::solar::gprc::StageLatency* _internal_mutable_reorder();
   public:
-  void unsafe_arena_set_allocated_world_transorm(
-      ::com::bcom::solar::gprc::Matrix4x4* world_transorm);
-  ::com::bcom::solar::gprc::Matrix4x4* unsafe_arena_release_world_transorm();
+  void unsafe_arena_set_allocated_reorder(
+      ::com::bcom::solar::gprc::StageLatency* reorder);
+  ::com::bcom::solar::gprc::StageLatency* unsafe_arena_release_reorder();
 
-  // bool fixed_pose = 4;
-  void clear_fixed_pose();
-  bool fixed_pose() const;
-  void set_fixed_pose(bool value);
+  // .com.bcom.solar.gprc.StageLatency front_end = 4;
+  bool has_front_end() const;
   private:
-  bool _internal_fixed_pose() const;
-  void _internal_set_fixed_pose(bool value);
+  bool _internal_has_front_end() const;
   public:
+  void clear_front_end();
+  const ::com::bcom::solar::gprc::StageLatency& front_end() const;
+  ::com::bcom::solar::gprc::StageLatency* release_front_end();
+  ::com::bcom::solar::gprc::StageLatency* mutable_front_end();
+  void set_allocated_front_end(::com::bcom::solar::gprc::StageLatency* front_end);
+  private:
+  const ::com::bcom::solar::gprc::StageLatency& _internal_front_end() const;
+  ::com::bcom::solar::gprc::StageLatency* _internal_mutable_front_end();
+  public:
+  void unsafe_arena_set_allocated_front_end(
+      ::com::bcom::solar::gprc::StageLatency* front_end);
+  ::com::bcom::solar::gprc::StageLatency* unsafe_arena_release_front_end();
 
-  // @@protoc_insertion_point(class_scope:com.bcom.solar.gprc.GroundTruthFrames)
+  // .com.bcom.solar.gprc.StageLatency total = 5;
+  bool has_total() const;
+  private:
+  bool _internal_has_total() const;
+  public:
+  void clear_total();
+  const ::com::bcom::solar::gprc::StageLatency& total() const;
+  ::com::bcom::solar::gprc::StageLatency* release_total();
+  ::com::bcom::solar::gprc::StageLatency* mutable_total();
+  void set_allocated_total(::com::bcom::solar::gprc::StageLatency* total);
+  private:
+  const ::com::bcom::solar::gprc::StageLatency& _internal_total() const;
+  ::com::bcom::solar::gprc::StageLatency* _internal_mutable_total();
+  public:
+  void unsafe_arena_set_allocated_total(
+      ::com::bcom::solar::gprc::StageLatency* total);
+  ::com::bcom::solar::gprc::StageLatency* unsafe_arena_release_total();
+
+  // uint64 nb_requests = 6;
+  void clear_nb_requests();
+  ::PROTOBUF_NAMESPACE_ID::uint64 nb_requests() const;
+  void set_nb_requests(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::uint64 _internal_nb_requests() const;
+  void _internal_set_nb_requests(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  public:
+
+  // uint64 nb_errors = 7;
+  void clear_nb_errors();
+  ::PROTOBUF_NAMESPACE_ID::uint64 nb_errors() const;
+  void set_nb_errors(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::uint64 _internal_nb_errors() const;
+  void _internal_set_nb_errors(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  public:
+
+  // uint64 nb_rejected = 8;
+  void clear_nb_rejected();
+  ::PROTOBUF_NAMESPACE_ID::uint64 nb_rejected() const;
+  void set_nb_rejected(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::uint64 _internal_nb_rejected() const;
+  void _internal_set_nb_rejected(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  public:
+
+  // uint64 nb_late_dropped = 9;
+  void clear_nb_late_dropped();
+  ::PROTOBUF_NAMESPACE_ID::uint64 nb_late_dropped() const;
+  void set_nb_late_dropped(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::uint64 _internal_nb_late_dropped() const;
+  void _internal_set_nb_late_dropped(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  public:
+
+  // uint64 nb_shrink_dropped = 10;
+  void clear_nb_shrink_dropped();
+  ::PROTOBUF_NAMESPACE_ID::uint64 nb_shrink_dropped() const;
+  void set_nb_shrink_dropped(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::uint64 _internal_nb_shrink_dropped() const;
+  void _internal_set_nb_shrink_dropped(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  public:
+
+  // uint64 nb_overload_dropped = 11;
+  void clear_nb_overload_dropped();
+  ::PROTOBUF_NAMESPACE_ID::uint64 nb_overload_dropped() const;
+  void set_nb_overload_dropped(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::uint64 _internal_nb_overload_dropped() const;
+  void _internal_set_nb_overload_dropped(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  public:
+
+  // uint64 nb_latest_pose_replies = 12;
+  void clear_nb_latest_pose_replies();
+  ::PROTOBUF_NAMESPACE_ID::uint64 nb_latest_pose_replies() const;
+  void set_nb_latest_pose_replies(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::uint64 _internal_nb_latest_pose_replies() const;
+  void _internal_set_nb_latest_pose_replies(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  public:
+
+  // uint64 nb_motion_gated = 13;
+  void clear_nb_motion_gated();
+  ::PROTOBUF_NAMESPACE_ID::uint64 nb_motion_gated() const;
+  void set_nb_motion_gated(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::uint64 _internal_nb_motion_gated() const;
+  void _internal_set_nb_motion_gated(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  public:
+
+  // uint64 nb_duplicates = 14;
+  void clear_nb_duplicates();
+  ::PROTOBUF_NAMESPACE_ID::uint64 nb_duplicates() const;
+  void set_nb_duplicates(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::uint64 _internal_nb_duplicates() const;
+  void _internal_set_nb_duplicates(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  public:
+
+  // uint64 nb_mode_switches = 15;
+  void clear_nb_mode_switches();
+  ::PROTOBUF_NAMESPACE_ID::uint64 nb_mode_switches() const;
+  void set_nb_mode_switches(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::uint64 _internal_nb_mode_switches() const;
+  void _internal_set_nb_mode_switches(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  public:
+
+  // uint32 reorder_depth = 16;
+  void clear_reorder_depth();
+  ::PROTOBUF_NAMESPACE_ID::uint32 reorder_depth() const;
+  void set_reorder_depth(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::uint32 _internal_reorder_depth() const;
+  void _internal_set_reorder_depth(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  public:
+
+  // float jitter_ms = 17;
+  void clear_jitter_ms();
+  float jitter_ms() const;
+  void set_jitter_ms(float value);
+  private:
+  float _internal_jitter_ms() const;
+  void _internal_set_jitter_ms(float value);
+  public:
+
+  // float out_of_order_rate = 18;
+  void clear_out_of_order_rate();
+  float out_of_order_rate() const;
+  void set_out_of_order_rate(float value);
+  private:
+  float _internal_out_of_order_rate() const;
+  void _internal_set_out_of_order_rate(float value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:com.bcom.solar.gprc.ProxyStats)
  private:
   class _Internal;
 
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr client_uuid_;
-  ::com::bcom::solar::gprc::Frames* frames_;
-  ::com::bcom::solar::gprc::Matrix4x4* world_transorm_;
-  bool fixed_pose_;
+  ::com::bcom::solar::gprc::StageLatency* queue_wait_;
+  ::com::bcom::solar::gprc::StageLatency* decode_;
+  ::com::bcom::solar::gprc::StageLatency* reorder_;
+  ::com::bcom::solar::gprc::StageLatency* front_end_;
+  ::com::bcom::solar::gprc::StageLatency* total_;
+  ::PROTOBUF_NAMESPACE_ID::uint64 nb_requests_;
+  ::PROTOBUF_NAMESPACE_ID::uint64 nb_errors_;
+  ::PROTOBUF_NAMESPACE_ID::uint64 nb_rejected_;
+  ::PROTOBUF_NAMESPACE_ID::uint64 nb_late_dropped_;
+  ::PROTOBUF_NAMESPACE_ID::uint64 nb_shrink_dropped_;
+  ::PROTOBUF_NAMESPACE_ID::uint64 nb_overload_dropped_;
+  ::PROTOBUF_NAMESPACE_ID::uint64 nb_latest_pose_replies_;
+  ::PROTOBUF_NAMESPACE_ID::uint64 nb_motion_gated_;
+  ::PROTOBUF_NAMESPACE_ID::uint64 nb_duplicates_;
+  ::PROTOBUF_NAMESPACE_ID::uint64 nb_mode_switches_;
+  ::PROTOBUF_NAMESPACE_ID::uint32 reorder_depth_;
+  float jitter_ms_;
+  float out_of_order_rate_;
   mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   friend struct ::TableStruct_solar_5fmapping_5fand_5frelocalization_5fproxy_2eproto;
 };
 // -------------------------------------------------------------------
 
-class Frame PROTOBUF_FINAL :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:com.bcom.solar.gprc.Frame) */ {
+class ProxyStatsResult PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:com.bcom.solar.gprc.ProxyStatsResult) */ {
  public:
-  inline Frame() : Frame(nullptr) {}
-  virtual ~Frame();
-  explicit constexpr Frame(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline ProxyStatsResult() : ProxyStatsResult(nullptr) {}
+  virtual ~ProxyStatsResult();
+  explicit constexpr ProxyStatsResult(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  Frame(const Frame& from);
-  Frame(Frame&& from) noexcept
-    : Frame() {
+  ProxyStatsResult(const ProxyStatsResult& from);
+  ProxyStatsResult(ProxyStatsResult&& from) noexcept
+    : ProxyStatsResult() {
     *this = ::std::move(from);
   }
 
-  inline Frame& operator=(const Frame& from) {
+  inline ProxyStatsResult& operator=(const ProxyStatsResult& from) {
     CopyFrom(from);
     return *this;
   }
-  inline Frame& operator=(Frame&& from) noexcept {
+  inline ProxyStatsResult& operator=(ProxyStatsResult&& from) noexcept {
     if (GetArena() == from.GetArena()) {
       if (this != &from) InternalSwap(&from);
     } else {
@@ -2705,20 +2966,20 @@ class Frame PROTOBUF_FINAL :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return GetMetadataStatic().reflection;
   }
-  static const Frame& default_instance() {
+  static const ProxyStatsResult& default_instance() {
     return *internal_default_instance();
   }
-  static inline const Frame* internal_default_instance() {
-    return reinterpret_cast<const Frame*>(
-               &_Frame_default_instance_);
+  static inline const ProxyStatsResult* internal_default_instance() {
+    return reinterpret_cast<const ProxyStatsResult*>(
+               &_ProxyStatsResult_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     12;
 
-  friend void swap(Frame& a, Frame& b) {
+  friend void swap(ProxyStatsResult& a, ProxyStatsResult& b) {
     a.Swap(&b);
   }
-  inline void Swap(Frame* other) {
+  inline void Swap(ProxyStatsResult* other) {
     if (other == this) return;
     if (GetArena() == other->GetArena()) {
       InternalSwap(other);
@@ -2726,7 +2987,7 @@ class Frame PROTOBUF_FINAL :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(Frame* other) {
+  void UnsafeArenaSwap(ProxyStatsResult* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetArena() == other->GetArena());
     InternalSwap(other);
@@ -2734,17 +2995,17 @@ class Frame PROTOBUF_FINAL :
 
   // implements Message ----------------------------------------------
 
-  inline Frame* New() const final {
-    return CreateMaybeMessage<Frame>(nullptr);
+  inline ProxyStatsResult* New() const final {
+    return CreateMaybeMessage<ProxyStatsResult>(nullptr);
   }
 
-  Frame* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
-    return CreateMaybeMessage<Frame>(arena);
+  ProxyStatsResult* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<ProxyStatsResult>(arena);
   }
   void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
   void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void CopyFrom(const Frame& from);
-  void MergeFrom(const Frame& from);
+  void CopyFrom(const ProxyStatsResult& from);
+  void MergeFrom(const ProxyStatsResult& from);
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
@@ -2758,13 +3019,13 @@ class Frame PROTOBUF_FINAL :
   inline void SharedCtor();
   inline void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(Frame* other);
+  void InternalSwap(ProxyStatsResult* other);
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "com.bcom.solar.gprc.Frame";
+    return "com.bcom.solar.gprc.ProxyStatsResult";
   }
   protected:
-  explicit Frame(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit ProxyStatsResult(::PROTOBUF_NAMESPACE_ID::Arena* arena);
   private:
   static void ArenaDtor(void* object);
   inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
@@ -2783,99 +3044,77 @@ class Frame PROTOBUF_FINAL :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kImageFieldNumber = 2,
-    kPoseFieldNumber = 4,
-    kTimestampFieldNumber = 3,
-    kSensorIdFieldNumber = 1,
+    kProxyFieldNumber = 1,
+    kClientFieldNumber = 2,
   };
-  // .com.bcom.solar.gprc.Image image = 2;
-  bool has_image() const;
-  private:
-  bool _internal_has_image() const;
-  public:
-  void clear_image();
-  const ::com::bcom::solar::gprc::Image& image() const;
-  ::com::bcom::solar::gprc::Image* release_image();
-  ::com::bcom::solar::gprc::Image* mutable_image();
-  void set_allocated_image(::com::bcom::solar::gprc::Image* image);
-  private:
-  const ::com::bcom::solar::gprc::Image& _internal_image() const;
-  ::com::bcom::solar::gprc::Image* _internal_mutable_image();
-  public:
-  void unsafe_arena_set_allocated_image(
-      ::com::bcom::solar::gprc::Image* image);
-  ::com::bcom::solar::gprc::Image* unsafe_arena_release_image();
-
-  // .com.bcom.solar.gprc.Matrix4x4 pose = 4;
-  bool has_pose() const;
+  // .com.bcom.solar.gprc.ProxyStats proxy = 1;
+  bool has_proxy() const;
   private:
-  bool _internal_has_pose() const;
+  bool _internal_has_proxy() const;
   public:
-  void clear_pose();
-  const ::com::bcom::solar::gprc::Matrix4x4& pose() const;
-  ::com::bcom::solar::gprc::Matrix4x4* release_pose();
-  ::com::bcom::solar::gprc::Matrix4x4* mutable_pose();
-  void set_allocated_pose(::com::bcom::solar::gprc::Matrix4x4* pose);
+  void clear_proxy();
+  const ::com::bcom::solar::gprc::ProxyStats& proxy() const;
+  ::com::bcom::solar::gprc::ProxyStats* release_proxy();
+  ::com::bcom::solar::gprc::ProxyStats* mutable_proxy();
+  void set_allocated_proxy(::com::bcom::solar::gprc::ProxyStats* proxy);
   private:
-  const ::com::bcom::solar::gprc::Matrix4x4& _internal_pose() const;
-  ::com::bcom::solar::gprc::Matrix4x4* _internal_mutable_pose();
+  const ::com::bcom::solar::gprc::ProxyStats& _internal_proxy() const;
+  ::com::bcom::solar::gprc::ProxyStats* _internal_mutable_proxy();
   public:
-  void unsafe_arena_set_allocated_pose(
-      ::com::bcom::solar::gprc::Matrix4x4* pose);
-  ::com::bcom::solar::gprc::Matrix4x4* unsafe_arena_release_pose();
+  void unsafe_arena_set_allocated_proxy(
+      ::com::bcom::solar::gprc::ProxyStats* proxy);
+  ::com::bcom::solar::gprc::ProxyStats* unsafe_arena_release_proxy();
 
-  // uint64 timestamp = 3;
-  void clear_timestamp();
-  ::PROTOBUF_NAMESPACE_ID::uint64 timestamp() const;
-  void set_timestamp(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  // .com.bcom.solar.gprc.ProxyStats client = 2;
+  bool has_client() const;
   private:
-  ::PROTOBUF_NAMESPACE_ID::uint64 _internal_timestamp() const;
-  void _internal_set_timestamp(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  bool _internal_has_client() const;
   public:
-
-  // int32 sensor_id = 1;
-  void clear_sensor_id();
-  ::PROTOBUF_NAMESPACE_ID::int32 sensor_id() const;
-  void set_sensor_id(::PROTOBUF_NAMESPACE_ID::int32 value);
+  void clear_client();
+  const ::com::bcom::solar::gprc::ProxyStats& client() const;
+  ::com::bcom::solar::gprc::ProxyStats* release_client();
+  ::com::bcom::solar::gprc::ProxyStats* mutable_client();
+  void set_allocated_client(::com::bcom::solar::gprc::ProxyStats* client);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_sensor_id() const;
-  void _internal_set_sensor_id(::PROTOBUF_NAMESPACE_ID::int32 value);
+  const ::com::bcom::solar::gprc::ProxyStats& _internal_client() const;
+  ::com::bcom::solar::gprc::ProxyStats* _internal_mutable_client();
   public:
+  void unsafe_arena_set_allocated_client(
+      ::com::bcom::solar::gprc::ProxyStats* client);
+  ::com::bcom::solar::gprc::ProxyStats* unsafe_arena_release_client();
 
-  // @@protoc_insertion_point(class_scope:com.bcom.solar.gprc.Frame)
+  // @@protoc_insertion_point(class_scope:com.bcom.solar.gprc.ProxyStatsResult)
  private:
   class _Internal;
 
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::com::bcom::solar::gprc::Image* image_;
-  ::com::bcom::solar::gprc::Matrix4x4* pose_;
-  ::PROTOBUF_NAMESPACE_ID::uint64 timestamp_;
-  ::PROTOBUF_NAMESPACE_ID::int32 sensor_id_;
+  ::com::bcom::solar::gprc::ProxyStats* proxy_;
+  ::com::bcom::solar::gprc::ProxyStats* client_;
   mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   friend struct ::TableStruct_solar_5fmapping_5fand_5frelocalization_5fproxy_2eproto;
 };
 // -------------------------------------------------------------------
 
-class Matrix4x4 PROTOBUF_FINAL :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:com.bcom.solar.gprc.Matrix4x4) */ {
+class Image PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:com.bcom.solar.gprc.Image) */ {
  public:
-  inline Matrix4x4() : Matrix4x4(nullptr) {}
-  virtual ~Matrix4x4();
-  explicit constexpr Matrix4x4(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline Image() : Image(nullptr) {}
+  virtual ~Image();
+  explicit constexpr Image(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  Matrix4x4(const Matrix4x4& from);
-  Matrix4x4(Matrix4x4&& from) noexcept
-    : Matrix4x4() {
+  Image(const Image& from);
+  Image(Image&& from) noexcept
+    : Image() {
     *this = ::std::move(from);
   }
 
-  inline Matrix4x4& operator=(const Matrix4x4& from) {
+  inline Image& operator=(const Image& from) {
     CopyFrom(from);
     return *this;
   }
-  inline Matrix4x4& operator=(Matrix4x4&& from) noexcept {
+  inline Image& operator=(Image&& from) noexcept {
     if (GetArena() == from.GetArena()) {
       if (this != &from) InternalSwap(&from);
     } else {
@@ -2893,20 +3132,20 @@ class Matrix4x4 PROTOBUF_FINAL :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return GetMetadataStatic().reflection;
   }
-  static const Matrix4x4& default_instance() {
+  static const Image& default_instance() {
     return *internal_default_instance();
   }
-  static inline const Matrix4x4* internal_default_instance() {
-    return reinterpret_cast<const Matrix4x4*>(
-               &_Matrix4x4_default_instance_);
+  static inline const Image* internal_default_instance() {
+    return reinterpret_cast<const Image*>(
+               &_Image_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     13;
 
-  friend void swap(Matrix4x4& a, Matrix4x4& b) {
+  friend void swap(Image& a, Image& b) {
     a.Swap(&b);
   }
-  inline void Swap(Matrix4x4* other) {
+  inline void Swap(Image* other) {
     if (other == this) return;
     if (GetArena() == other->GetArena()) {
       InternalSwap(other);
@@ -2914,7 +3153,7 @@ class Matrix4x4 PROTOBUF_FINAL :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(Matrix4x4* other) {
+  void UnsafeArenaSwap(Image* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetArena() == other->GetArena());
     InternalSwap(other);
@@ -2922,17 +3161,17 @@ class Matrix4x4 PROTOBUF_FINAL :
 
   // implements Message ----------------------------------------------
 
-  inline Matrix4x4* New() const final {
-    return CreateMaybeMessage<Matrix4x4>(nullptr);
+  inline Image* New() const final {
+    return CreateMaybeMessage<Image>(nullptr);
   }
 
-  Matrix4x4* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
-    return CreateMaybeMessage<Matrix4x4>(arena);
+  Image* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<Image>(arena);
   }
   void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
   void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void CopyFrom(const Matrix4x4& from);
-  void MergeFrom(const Matrix4x4& from);
+  void CopyFrom(const Image& from);
+  void MergeFrom(const Image& from);
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
@@ -2946,13 +3185,13 @@ class Matrix4x4 PROTOBUF_FINAL :
   inline void SharedCtor();
   inline void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(Matrix4x4* other);
+  void InternalSwap(Image* other);
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "com.bcom.solar.gprc.Matrix4x4";
+    return "com.bcom.solar.gprc.Image";
   }
   protected:
-  explicit Matrix4x4(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit Image(::PROTOBUF_NAMESPACE_ID::Arena* arena);
   private:
   static void ArenaDtor(void* object);
   inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
@@ -2971,213 +3210,99 @@ class Matrix4x4 PROTOBUF_FINAL :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kM11FieldNumber = 1,
-    kM12FieldNumber = 2,
-    kM13FieldNumber = 3,
-    kM14FieldNumber = 4,
-    kM21FieldNumber = 5,
-    kM22FieldNumber = 6,
-    kM23FieldNumber = 7,
-    kM24FieldNumber = 8,
-    kM31FieldNumber = 9,
-    kM32FieldNumber = 10,
-    kM33FieldNumber = 11,
-    kM34FieldNumber = 12,
-    kM41FieldNumber = 13,
-    kM42FieldNumber = 14,
-    kM43FieldNumber = 15,
-    kM44FieldNumber = 16,
+    kDataFieldNumber = 3,
+    kWidthFieldNumber = 1,
+    kHeightFieldNumber = 2,
+    kLayoutFieldNumber = 4,
+    kImageCompressionFieldNumber = 5,
   };
-  // float m11 = 1;
-  void clear_m11();
-  float m11() const;
-  void set_m11(float value);
+  // bytes data = 3;
+  void clear_data();
+  const std::string& data() const;
+  void set_data(const std::string& value);
+  void set_data(std::string&& value);
+  void set_data(const char* value);
+  void set_data(const void* value, size_t size);
+  std::string* mutable_data();
+  std::string* release_data();
+  void set_allocated_data(std::string* data);
   private:
-  float _internal_m11() const;
-  void _internal_set_m11(float value);
+  const std::string& _internal_data() const;
+  void _internal_set_data(const std::string& value);
+  std::string* _internal_mutable_data();
   public:
 
-  // float m12 = 2;
-  void clear_m12();
-  float m12() const;
-  void set_m12(float value);
+  // uint32 width = 1;
+  void clear_width();
+  ::PROTOBUF_NAMESPACE_ID::uint32 width() const;
+  void set_width(::PROTOBUF_NAMESPACE_ID::uint32 value);
   private:
-  float _internal_m12() const;
-  void _internal_set_m12(float value);
+  ::PROTOBUF_NAMESPACE_ID::uint32 _internal_width() const;
+  void _internal_set_width(::PROTOBUF_NAMESPACE_ID::uint32 value);
   public:
 
-  // float m13 = 3;
-  void clear_m13();
-  float m13() const;
-  void set_m13(float value);
+  // uint32 height = 2;
+  void clear_height();
+  ::PROTOBUF_NAMESPACE_ID::uint32 height() const;
+  void set_height(::PROTOBUF_NAMESPACE_ID::uint32 value);
   private:
-  float _internal_m13() const;
-  void _internal_set_m13(float value);
+  ::PROTOBUF_NAMESPACE_ID::uint32 _internal_height() const;
+  void _internal_set_height(::PROTOBUF_NAMESPACE_ID::uint32 value);
   public:
 
-  // float m14 = 4;
-  void clear_m14();
-  float m14() const;
-  void set_m14(float value);
+  // .com.bcom.solar.gprc.ImageLayout layout = 4;
+  void clear_layout();
+  ::com::bcom::solar::gprc::ImageLayout layout() const;
+  void set_layout(::com::bcom::solar::gprc::ImageLayout value);
   private:
-  float _internal_m14() const;
-  void _internal_set_m14(float value);
-  public:
-
-  // float m21 = 5;
-  void clear_m21();
-  float m21() const;
-  void set_m21(float value);
-  private:
-  float _internal_m21() const;
-  void _internal_set_m21(float value);
-  public:
-
-  // float m22 = 6;
-  void clear_m22();
-  float m22() const;
-  void set_m22(float value);
-  private:
-  float _internal_m22() const;
-  void _internal_set_m22(float value);
-  public:
-
-  // float m23 = 7;
-  void clear_m23();
-  float m23() const;
-  void set_m23(float value);
-  private:
-  float _internal_m23() const;
-  void _internal_set_m23(float value);
-  public:
-
-  // float m24 = 8;
-  void clear_m24();
-  float m24() const;
-  void set_m24(float value);
-  private:
-  float _internal_m24() const;
-  void _internal_set_m24(float value);
-  public:
-
-  // float m31 = 9;
-  void clear_m31();
-  float m31() const;
-  void set_m31(float value);
-  private:
-  float _internal_m31() const;
-  void _internal_set_m31(float value);
-  public:
-
-  // float m32 = 10;
-  void clear_m32();
-  float m32() const;
-  void set_m32(float value);
-  private:
-  float _internal_m32() const;
-  void _internal_set_m32(float value);
-  public:
-
-  // float m33 = 11;
-  void clear_m33();
-  float m33() const;
-  void set_m33(float value);
-  private:
-  float _internal_m33() const;
-  void _internal_set_m33(float value);
-  public:
-
-  // float m34 = 12;
-  void clear_m34();
-  float m34() const;
-  void set_m34(float value);
-  private:
-  float _internal_m34() const;
-  void _internal_set_m34(float value);
-  public:
-
-  // float m41 = 13;
-  void clear_m41();
-  float m41() const;
-  void set_m41(float value);
-  private:
-  float _internal_m41() const;
-  void _internal_set_m41(float value);
-  public:
-
-  // float m42 = 14;
-  void clear_m42();
-  float m42() const;
-  void set_m42(float value);
-  private:
-  float _internal_m42() const;
-  void _internal_set_m42(float value);
-  public:
-
-  // float m43 = 15;
-  void clear_m43();
-  float m43() const;
-  void set_m43(float value);
-  private:
-  float _internal_m43() const;
-  void _internal_set_m43(float value);
+  ::com::bcom::solar::gprc::ImageLayout _internal_layout() const;
+  void _internal_set_layout(::com::bcom::solar::gprc::ImageLayout value);
   public:
 
-  // float m44 = 16;
-  void clear_m44();
-  float m44() const;
-  void set_m44(float value);
+  // .com.bcom.solar.gprc.ImageCompression imageCompression = 5;
+  void clear_imagecompression();
+  ::com::bcom::solar::gprc::ImageCompression imagecompression() const;
+  void set_imagecompression(::com::bcom::solar::gprc::ImageCompression value);
   private:
-  float _internal_m44() const;
-  void _internal_set_m44(float value);
+  ::com::bcom::solar::gprc::ImageCompression _internal_imagecompression() const;
+  void _internal_set_imagecompression(::com::bcom::solar::gprc::ImageCompression value);
   public:
 
-  // @@protoc_insertion_point(class_scope:com.bcom.solar.gprc.Matrix4x4)
+  // @@protoc_insertion_point(class_scope:com.bcom.solar.gprc.Image)
  private:
   class _Internal;
 
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  float m11_;
-  float m12_;
-  float m13_;
-  float m14_;
-  float m21_;
-  float m22_;
-  float m23_;
-  float m24_;
-  float m31_;
-  float m32_;
-  float m33_;
-  float m34_;
-  float m41_;
-  float m42_;
-  float m43_;
-  float m44_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr data_;
+  ::PROTOBUF_NAMESPACE_ID::uint32 width_;
+  ::PROTOBUF_NAMESPACE_ID::uint32 height_;
+  int layout_;
+  int imagecompression_;
   mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   friend struct ::TableStruct_solar_5fmapping_5fand_5frelocalization_5fproxy_2eproto;
 };
 // -------------------------------------------------------------------
 
-class Matrix3x3 PROTOBUF_FINAL :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:com.bcom.solar.gprc.Matrix3x3) */ {
+class Frames PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:com.bcom.solar.gprc.Frames) */ {
  public:
-  inline Matrix3x3() : Matrix3x3(nullptr) {}
-  virtual ~Matrix3x3();
-  explicit constexpr Matrix3x3(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline Frames() : Frames(nullptr) {}
+  virtual ~Frames();
+  explicit constexpr Frames(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  Matrix3x3(const Matrix3x3& from);
-  Matrix3x3(Matrix3x3&& from) noexcept
-    : Matrix3x3() {
+  Frames(const Frames& from);
+  Frames(Frames&& from) noexcept
+    : Frames() {
     *this = ::std::move(from);
   }
 
-  inline Matrix3x3& operator=(const Matrix3x3& from) {
+  inline Frames& operator=(const Frames& from) {
     CopyFrom(from);
     return *this;
   }
-  inline Matrix3x3& operator=(Matrix3x3&& from) noexcept {
+  inline Frames& operator=(Frames&& from) noexcept {
     if (GetArena() == from.GetArena()) {
       if (this != &from) InternalSwap(&from);
     } else {
@@ -3195,20 +3320,20 @@ class Matrix3x3 PROTOBUF_FINAL :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return GetMetadataStatic().reflection;
   }
-  static const Matrix3x3& default_instance() {
+  static const Frames& default_instance() {
     return *internal_default_instance();
   }
-  static inline const Matrix3x3* internal_default_instance() {
-    return reinterpret_cast<const Matrix3x3*>(
-               &_Matrix3x3_default_instance_);
+  static inline const Frames* internal_default_instance() {
+    return reinterpret_cast<const Frames*>(
+               &_Frames_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     14;
 
-  friend void swap(Matrix3x3& a, Matrix3x3& b) {
+  friend void swap(Frames& a, Frames& b) {
     a.Swap(&b);
   }
-  inline void Swap(Matrix3x3* other) {
+  inline void Swap(Frames* other) {
     if (other == this) return;
     if (GetArena() == other->GetArena()) {
       InternalSwap(other);
@@ -3216,7 +3341,7 @@ class Matrix3x3 PROTOBUF_FINAL :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(Matrix3x3* other) {
+  void UnsafeArenaSwap(Frames* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetArena() == other->GetArena());
     InternalSwap(other);
@@ -3224,17 +3349,17 @@ class Matrix3x3 PROTOBUF_FINAL :
 
   // implements Message ----------------------------------------------
 
-  inline Matrix3x3* New() const final {
-    return CreateMaybeMessage<Matrix3x3>(nullptr);
+  inline Frames* New() const final {
+    return CreateMaybeMessage<Frames>(nullptr);
   }
 
-  Matrix3x3* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
-    return CreateMaybeMessage<Matrix3x3>(arena);
+  Frames* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<Frames>(arena);
   }
   void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
   void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void CopyFrom(const Matrix3x3& from);
-  void MergeFrom(const Matrix3x3& from);
+  void CopyFrom(const Frames& from);
+  void MergeFrom(const Frames& from);
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
@@ -3248,13 +3373,13 @@ class Matrix3x3 PROTOBUF_FINAL :
   inline void SharedCtor();
   inline void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(Matrix3x3* other);
+  void InternalSwap(Frames* other);
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "com.bcom.solar.gprc.Matrix3x3";
+    return "com.bcom.solar.gprc.Frames";
   }
   protected:
-  explicit Matrix3x3(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit Frames(::PROTOBUF_NAMESPACE_ID::Arena* arena);
   private:
   static void ArenaDtor(void* object);
   inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
@@ -3273,136 +3398,75 @@ class Matrix3x3 PROTOBUF_FINAL :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kM11FieldNumber = 1,
-    kM12FieldNumber = 2,
-    kM13FieldNumber = 3,
-    kM21FieldNumber = 4,
-    kM22FieldNumber = 5,
-    kM23FieldNumber = 6,
-    kM31FieldNumber = 7,
-    kM32FieldNumber = 8,
-    kM33FieldNumber = 9,
+    kFramesFieldNumber = 2,
+    kClientUuidFieldNumber = 1,
   };
-  // float m11 = 1;
-  void clear_m11();
-  float m11() const;
-  void set_m11(float value);
+  // repeated .com.bcom.solar.gprc.Frame frames = 2;
+  int frames_size() const;
   private:
-  float _internal_m11() const;
-  void _internal_set_m11(float value);
+  int _internal_frames_size() const;
   public:
-
-  // float m12 = 2;
-  void clear_m12();
-  float m12() const;
-  void set_m12(float value);
+  void clear_frames();
+  ::com::bcom::solar::gprc::Frame* mutable_frames(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::com::bcom::solar::gprc::Frame >*
+      mutable_frames();
   private:
-  float _internal_m12() const;
-  void _internal_set_m12(float value);
+  const ::com::bcom::solar::gprc::Frame& _internal_frames(int index) const;
+  ::com::bcom::solar::gprc::Frame* _internal_add_frames();
   public:
+  const ::com::bcom::solar::gprc::Frame& frames(int index) const;
+  ::com::bcom::solar::gprc::Frame* add_frames();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::com::bcom::solar::gprc::Frame >&
+      frames() const;
 
-  // float m13 = 3;
-  void clear_m13();
-  float m13() const;
-  void set_m13(float value);
+  // string client_uuid = 1;
+  void clear_client_uuid();
+  const std::string& client_uuid() const;
+  void set_client_uuid(const std::string& value);
+  void set_client_uuid(std::string&& value);
+  void set_client_uuid(const char* value);
+  void set_client_uuid(const char* value, size_t size);
+  std::string* mutable_client_uuid();
+  std::string* release_client_uuid();
+  void set_allocated_client_uuid(std::string* client_uuid);
   private:
-  float _internal_m13() const;
-  void _internal_set_m13(float value);
+  const std::string& _internal_client_uuid() const;
+  void _internal_set_client_uuid(const std::string& value);
+  std::string* _internal_mutable_client_uuid();
   public:
 
-  // float m21 = 4;
-  void clear_m21();
-  float m21() const;
-  void set_m21(float value);
-  private:
-  float _internal_m21() const;
-  void _internal_set_m21(float value);
-  public:
-
-  // float m22 = 5;
-  void clear_m22();
-  float m22() const;
-  void set_m22(float value);
-  private:
-  float _internal_m22() const;
-  void _internal_set_m22(float value);
-  public:
-
-  // float m23 = 6;
-  void clear_m23();
-  float m23() const;
-  void set_m23(float value);
-  private:
-  float _internal_m23() const;
-  void _internal_set_m23(float value);
-  public:
-
-  // float m31 = 7;
-  void clear_m31();
-  float m31() const;
-  void set_m31(float value);
-  private:
-  float _internal_m31() const;
-  void _internal_set_m31(float value);
-  public:
-
-  // float m32 = 8;
-  void clear_m32();
-  float m32() const;
-  void set_m32(float value);
-  private:
-  float _internal_m32() const;
-  void _internal_set_m32(float value);
-  public:
-
-  // float m33 = 9;
-  void clear_m33();
-  float m33() const;
-  void set_m33(float value);
-  private:
-  float _internal_m33() const;
-  void _internal_set_m33(float value);
-  public:
-
-  // @@protoc_insertion_point(class_scope:com.bcom.solar.gprc.Matrix3x3)
- private:
-  class _Internal;
+  // @@protoc_insertion_point(class_scope:com.bcom.solar.gprc.Frames)
+ private:
+  class _Internal;
 
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  float m11_;
-  float m12_;
-  float m13_;
-  float m21_;
-  float m22_;
-  float m23_;
-  float m31_;
-  float m32_;
-  float m33_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::com::bcom::solar::gprc::Frame > frames_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr client_uuid_;
   mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   friend struct ::TableStruct_solar_5fmapping_5fand_5frelocalization_5fproxy_2eproto;
 };
 // -------------------------------------------------------------------
 
-class Matrix3x4 PROTOBUF_FINAL :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:com.bcom.solar.gprc.Matrix3x4) */ {
+class FramesBatch PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:com.bcom.solar.gprc.FramesBatch) */ {
  public:
-  inline Matrix3x4() : Matrix3x4(nullptr) {}
-  virtual ~Matrix3x4();
-  explicit constexpr Matrix3x4(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline FramesBatch() : FramesBatch(nullptr) {}
+  virtual ~FramesBatch();
+  explicit constexpr FramesBatch(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  Matrix3x4(const Matrix3x4& from);
-  Matrix3x4(Matrix3x4&& from) noexcept
-    : Matrix3x4() {
+  FramesBatch(const FramesBatch& from);
+  FramesBatch(FramesBatch&& from) noexcept
+    : FramesBatch() {
     *this = ::std::move(from);
   }
 
-  inline Matrix3x4& operator=(const Matrix3x4& from) {
+  inline FramesBatch& operator=(const FramesBatch& from) {
     CopyFrom(from);
     return *this;
   }
-  inline Matrix3x4& operator=(Matrix3x4&& from) noexcept {
+  inline FramesBatch& operator=(FramesBatch&& from) noexcept {
     if (GetArena() == from.GetArena()) {
       if (this != &from) InternalSwap(&from);
     } else {
@@ -3420,20 +3484,20 @@ class Matrix3x4 PROTOBUF_FINAL :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return GetMetadataStatic().reflection;
   }
-  static const Matrix3x4& default_instance() {
+  static const FramesBatch& default_instance() {
     return *internal_default_instance();
   }
-  static inline const Matrix3x4* internal_default_instance() {
-    return reinterpret_cast<const Matrix3x4*>(
-               &_Matrix3x4_default_instance_);
+  static inline const FramesBatch* internal_default_instance() {
+    return reinterpret_cast<const FramesBatch*>(
+               &_FramesBatch_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     15;
 
-  friend void swap(Matrix3x4& a, Matrix3x4& b) {
+  friend void swap(FramesBatch& a, FramesBatch& b) {
     a.Swap(&b);
   }
-  inline void Swap(Matrix3x4* other) {
+  inline void Swap(FramesBatch* other) {
     if (other == this) return;
     if (GetArena() == other->GetArena()) {
       InternalSwap(other);
@@ -3441,7 +3505,7 @@ class Matrix3x4 PROTOBUF_FINAL :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(Matrix3x4* other) {
+  void UnsafeArenaSwap(FramesBatch* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetArena() == other->GetArena());
     InternalSwap(other);
@@ -3449,17 +3513,17 @@ class Matrix3x4 PROTOBUF_FINAL :
 
   // implements Message ----------------------------------------------
 
-  inline Matrix3x4* New() const final {
-    return CreateMaybeMessage<Matrix3x4>(nullptr);
+  inline FramesBatch* New() const final {
+    return CreateMaybeMessage<FramesBatch>(nullptr);
   }
 
-  Matrix3x4* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
-    return CreateMaybeMessage<Matrix3x4>(arena);
+  FramesBatch* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<FramesBatch>(arena);
   }
   void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
   void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void CopyFrom(const Matrix3x4& from);
-  void MergeFrom(const Matrix3x4& from);
+  void CopyFrom(const FramesBatch& from);
+  void MergeFrom(const FramesBatch& from);
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
@@ -3473,13 +3537,13 @@ class Matrix3x4 PROTOBUF_FINAL :
   inline void SharedCtor();
   inline void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(Matrix3x4* other);
+  void InternalSwap(FramesBatch* other);
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "com.bcom.solar.gprc.Matrix3x4";
+    return "com.bcom.solar.gprc.FramesBatch";
   }
   protected:
-  explicit Matrix3x4(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit FramesBatch(::PROTOBUF_NAMESPACE_ID::Arena* arena);
   private:
   static void ArenaDtor(void* object);
   inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
@@ -3498,280 +3562,1968 @@ class Matrix3x4 PROTOBUF_FINAL :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kM11FieldNumber = 1,
-    kM12FieldNumber = 2,
-    kM13FieldNumber = 3,
-    kM14FieldNumber = 4,
-    kM21FieldNumber = 5,
-    kM22FieldNumber = 6,
-    kM23FieldNumber = 7,
-    kM24FieldNumber = 8,
-    kM31FieldNumber = 9,
-    kM32FieldNumber = 10,
-    kM33FieldNumber = 11,
-    kM34FieldNumber = 12,
+    kFramesFieldNumber = 2,
+    kClientUuidFieldNumber = 1,
+    kLastResultOnlyFieldNumber = 3,
   };
-  // float m11 = 1;
-  void clear_m11();
-  float m11() const;
-  void set_m11(float value);
-  private:
-  float _internal_m11() const;
-  void _internal_set_m11(float value);
-  public:
-
-  // float m12 = 2;
-  void clear_m12();
-  float m12() const;
-  void set_m12(float value);
-  private:
-  float _internal_m12() const;
-  void _internal_set_m12(float value);
-  public:
-
-  // float m13 = 3;
-  void clear_m13();
-  float m13() const;
-  void set_m13(float value);
-  private:
-  float _internal_m13() const;
-  void _internal_set_m13(float value);
-  public:
-
-  // float m14 = 4;
-  void clear_m14();
-  float m14() const;
-  void set_m14(float value);
-  private:
-  float _internal_m14() const;
-  void _internal_set_m14(float value);
-  public:
-
-  // float m21 = 5;
-  void clear_m21();
-  float m21() const;
-  void set_m21(float value);
-  private:
-  float _internal_m21() const;
-  void _internal_set_m21(float value);
-  public:
-
-  // float m22 = 6;
-  void clear_m22();
-  float m22() const;
-  void set_m22(float value);
-  private:
-  float _internal_m22() const;
-  void _internal_set_m22(float value);
-  public:
-
-  // float m23 = 7;
-  void clear_m23();
-  float m23() const;
-  void set_m23(float value);
-  private:
-  float _internal_m23() const;
-  void _internal_set_m23(float value);
-  public:
-
-  // float m24 = 8;
-  void clear_m24();
-  float m24() const;
-  void set_m24(float value);
-  private:
-  float _internal_m24() const;
-  void _internal_set_m24(float value);
-  public:
-
-  // float m31 = 9;
-  void clear_m31();
-  float m31() const;
-  void set_m31(float value);
+  // repeated .com.bcom.solar.gprc.Frames frames = 2;
+  int frames_size() const;
   private:
-  float _internal_m31() const;
-  void _internal_set_m31(float value);
+  int _internal_frames_size() const;
   public:
-
-  // float m32 = 10;
-  void clear_m32();
-  float m32() const;
-  void set_m32(float value);
+  void clear_frames();
+  ::com::bcom::solar::gprc::Frames* mutable_frames(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::com::bcom::solar::gprc::Frames >*
+      mutable_frames();
   private:
-  float _internal_m32() const;
-  void _internal_set_m32(float value);
+  const ::com::bcom::solar::gprc::Frames& _internal_frames(int index) const;
+  ::com::bcom::solar::gprc::Frames* _internal_add_frames();
   public:
+  const ::com::bcom::solar::gprc::Frames& frames(int index) const;
+  ::com::bcom::solar::gprc::Frames* add_frames();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::com::bcom::solar::gprc::Frames >&
+      frames() const;
 
-  // float m33 = 11;
-  void clear_m33();
-  float m33() const;
-  void set_m33(float value);
+  // string client_uuid = 1;
+  void clear_client_uuid();
+  const std::string& client_uuid() const;
+  void set_client_uuid(const std::string& value);
+  void set_client_uuid(std::string&& value);
+  void set_client_uuid(const char* value);
+  void set_client_uuid(const char* value, size_t size);
+  std::string* mutable_client_uuid();
+  std::string* release_client_uuid();
+  void set_allocated_client_uuid(std::string* client_uuid);
   private:
-  float _internal_m33() const;
-  void _internal_set_m33(float value);
+  const std::string& _internal_client_uuid() const;
+  void _internal_set_client_uuid(const std::string& value);
+  std::string* _internal_mutable_client_uuid();
   public:
 
-  // float m34 = 12;
-  void clear_m34();
-  float m34() const;
-  void set_m34(float value);
+  // bool last_result_only = 3;
+  void clear_last_result_only();
+  bool last_result_only() const;
+  void set_last_result_only(bool value);
   private:
-  float _internal_m34() const;
-  void _internal_set_m34(float value);
+  bool _internal_last_result_only() const;
+  void _internal_set_last_result_only(bool value);
   public:
 
-  // @@protoc_insertion_point(class_scope:com.bcom.solar.gprc.Matrix3x4)
+  // @@protoc_insertion_point(class_scope:com.bcom.solar.gprc.FramesBatch)
  private:
   class _Internal;
 
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  float m11_;
-  float m12_;
-  float m13_;
-  float m14_;
-  float m21_;
-  float m22_;
-  float m23_;
-  float m24_;
-  float m31_;
-  float m32_;
-  float m33_;
-  float m34_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::com::bcom::solar::gprc::Frames > frames_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr client_uuid_;
+  bool last_result_only_;
   mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   friend struct ::TableStruct_solar_5fmapping_5fand_5frelocalization_5fproxy_2eproto;
 };
-// ===================================================================
-
-
-// ===================================================================
-
-#ifdef __GNUC__
-  #pragma GCC diagnostic push
-  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
-#endif  // __GNUC__
-// Empty
-
 // -------------------------------------------------------------------
 
-// ClientUUID
+class GroundTruthFrames PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:com.bcom.solar.gprc.GroundTruthFrames) */ {
+ public:
+  inline GroundTruthFrames() : GroundTruthFrames(nullptr) {}
+  virtual ~GroundTruthFrames();
+  explicit constexpr GroundTruthFrames(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-// string client_uuid = 1;
-inline void ClientUUID::clear_client_uuid() {
-  client_uuid_.ClearToEmpty();
-}
-inline const std::string& ClientUUID::client_uuid() const {
-  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.ClientUUID.client_uuid)
-  return _internal_client_uuid();
-}
-inline void ClientUUID::set_client_uuid(const std::string& value) {
-  _internal_set_client_uuid(value);
+  GroundTruthFrames(const GroundTruthFrames& from);
+  GroundTruthFrames(GroundTruthFrames&& from) noexcept
+    : GroundTruthFrames() {
+    *this = ::std::move(from);
+  }
+
+  inline GroundTruthFrames& operator=(const GroundTruthFrames& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline GroundTruthFrames& operator=(GroundTruthFrames&& from) noexcept {
+    if (GetArena() == from.GetArena()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return GetMetadataStatic().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return GetMetadataStatic().reflection;
+  }
+  static const GroundTruthFrames& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const GroundTruthFrames* internal_default_instance() {
+    return reinterpret_cast<const GroundTruthFrames*>(
+               &_GroundTruthFrames_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    16;
+
+  friend void swap(GroundTruthFrames& a, GroundTruthFrames& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(GroundTruthFrames* other) {
+    if (other == this) return;
+    if (GetArena() == other->GetArena()) {
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(GroundTruthFrames* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline GroundTruthFrames* New() const final {
+    return CreateMaybeMessage<GroundTruthFrames>(nullptr);
+  }
+
+  GroundTruthFrames* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<GroundTruthFrames>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const GroundTruthFrames& from);
+  void MergeFrom(const GroundTruthFrames& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(GroundTruthFrames* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "com.bcom.solar.gprc.GroundTruthFrames";
+  }
+  protected:
+  explicit GroundTruthFrames(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    return ::descriptor_table_solar_5fmapping_5fand_5frelocalization_5fproxy_2eproto_metadata_getter(kIndexInFileMessages);
+  }
+
+  public:
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kClientUuidFieldNumber = 1,
+    kFramesFieldNumber = 2,
+    kWorldTransormFieldNumber = 3,
+    kFixedPoseFieldNumber = 4,
+  };
+  // string client_uuid = 1;
+  void clear_client_uuid();
+  const std::string& client_uuid() const;
+  void set_client_uuid(const std::string& value);
+  void set_client_uuid(std::string&& value);
+  void set_client_uuid(const char* value);
+  void set_client_uuid(const char* value, size_t size);
+  std::string* mutable_client_uuid();
+  std::string* release_client_uuid();
+  void set_allocated_client_uuid(std::string* client_uuid);
+  private:
+  const std::string& _internal_client_uuid() const;
+  void _internal_set_client_uuid(const std::string& value);
+  std::string* _internal_mutable_client_uuid();
+  public:
+
+  // .com.bcom.solar.gprc.Frames frames = 2;
+  bool has_frames() const;
+  private:
+  bool _internal_has_frames() const;
+  public:
+  void clear_frames();
+  const ::com::bcom::solar::gprc::Frames& frames() const;
+  ::com::bcom::solar::gprc::Frames* release_frames();
+  ::com::bcom::solar::gprc::Frames* mutable_frames();
+  void set_allocated_frames(::com::bcom::solar::gprc::Frames* frames);
+  private:
+  const ::com::bcom::solar::gprc::Frames& _internal_frames() const;
+  ::com::bcom::solar::gprc::Frames* _internal_mutable_frames();
+  public:
+  void unsafe_arena_set_allocated_frames(
+      ::com::bcom::solar::gprc::Frames* frames);
+  ::com::bcom::solar::gprc::Frames* unsafe_arena_release_frames();
+
+  // .com.bcom.solar.gprc.Matrix4x4 world_transorm = 3;
+  bool has_world_transorm() const;
+  private:
+  bool _internal_has_world_transorm() const;
+  public:
+  void clear_world_transorm();
+  const ::com::bcom::solar::gprc::Matrix4x4& world_transorm() const;
+  ::com::bcom::solar::gprc::Matrix4x4* release_world_transorm();
+  ::com::bcom::solar::gprc::Matrix4x4* mutable_world_transorm();
+  void set_allocated_world_transorm(::com::bcom::solar::gprc::Matrix4x4* world_transorm);
+  private:
+  const ::com::bcom::solar::gprc::Matrix4x4& _internal_world_transorm() const;
+  ::com::bcom::solar::gprc::Matrix4x4* _internal_mutable_world_transorm();
+  public:
+  void unsafe_arena_set_allocated_world_transorm(
+      ::com::bcom::solar::gprc::Matrix4x4* world_transorm);
+  ::com::bcom::solar::gprc::Matrix4x4* unsafe_arena_release_world_transorm();
+
+  // bool fixed_pose = 4;
+  void clear_fixed_pose();
+  bool fixed_pose() const;
+  void set_fixed_pose(bool value);
+  private:
+  bool _internal_fixed_pose() const;
+  void _internal_set_fixed_pose(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:com.bcom.solar.gprc.GroundTruthFrames)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr client_uuid_;
+  ::com::bcom::solar::gprc::Frames* frames_;
+  ::com::bcom::solar::gprc::Matrix4x4* world_transorm_;
+  bool fixed_pose_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_solar_5fmapping_5fand_5frelocalization_5fproxy_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Frame PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:com.bcom.solar.gprc.Frame) */ {
+ public:
+  inline Frame() : Frame(nullptr) {}
+  virtual ~Frame();
+  explicit constexpr Frame(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Frame(const Frame& from);
+  Frame(Frame&& from) noexcept
+    : Frame() {
+    *this = ::std::move(from);
+  }
+
+  inline Frame& operator=(const Frame& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Frame& operator=(Frame&& from) noexcept {
+    if (GetArena() == from.GetArena()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return GetMetadataStatic().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return GetMetadataStatic().reflection;
+  }
+  static const Frame& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Frame* internal_default_instance() {
+    return reinterpret_cast<const Frame*>(
+               &_Frame_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    17;
+
+  friend void swap(Frame& a, Frame& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Frame* other) {
+    if (other == this) return;
+    if (GetArena() == other->GetArena()) {
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Frame* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline Frame* New() const final {
+    return CreateMaybeMessage<Frame>(nullptr);
+  }
+
+  Frame* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<Frame>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const Frame& from);
+  void MergeFrom(const Frame& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Frame* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "com.bcom.solar.gprc.Frame";
+  }
+  protected:
+  explicit Frame(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    return ::descriptor_table_solar_5fmapping_5fand_5frelocalization_5fproxy_2eproto_metadata_getter(kIndexInFileMessages);
+  }
+
+  public:
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kImageFieldNumber = 2,
+    kPoseFieldNumber = 4,
+    kTimestampFieldNumber = 3,
+    kSensorIdFieldNumber = 1,
+  };
+  // .com.bcom.solar.gprc.Image image = 2;
+  bool has_image() const;
+  private:
+  bool _internal_has_image() const;
+  public:
+  void clear_image();
+  const ::com::bcom::solar::gprc::Image& image() const;
+  ::com::bcom::solar::gprc::Image* release_image();
+  ::com::bcom::solar::gprc::Image* mutable_image();
+  void set_allocated_image(::com::bcom::solar::gprc::Image* image);
+  private:
+  const ::com::bcom::solar::gprc::Image& _internal_image() const;
+  ::com::bcom::solar::gprc::Image* _internal_mutable_image();
+  public:
+  void unsafe_arena_set_allocated_image(
+      ::com::bcom::solar::gprc::Image* image);
+  ::com::bcom::solar::gprc::Image* unsafe_arena_release_image();
+
+  // .com.bcom.solar.gprc.Matrix4x4 pose = 4;
+  bool has_pose() const;
+  private:
+  bool _internal_has_pose() const;
+  public:
+  void clear_pose();
+  const ::com::bcom::solar::gprc::Matrix4x4& pose() const;
+  ::com::bcom::solar::gprc::Matrix4x4* release_pose();
+  ::com::bcom::solar::gprc::Matrix4x4* mutable_pose();
+  void set_allocated_pose(::com::bcom::solar::gprc::Matrix4x4* pose);
+  private:
+  const ::com::bcom::solar::gprc::Matrix4x4& _internal_pose() const;
+  ::com::bcom::solar::gprc::Matrix4x4* _internal_mutable_pose();
+  public:
+  void unsafe_arena_set_allocated_pose(
+      ::com::bcom::solar::gprc::Matrix4x4* pose);
+  ::com::bcom::solar::gprc::Matrix4x4* unsafe_arena_release_pose();
+
+  // uint64 timestamp = 3;
+  void clear_timestamp();
+  ::PROTOBUF_NAMESPACE_ID::uint64 timestamp() const;
+  void set_timestamp(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::uint64 _internal_timestamp() const;
+  void _internal_set_timestamp(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  public:
+
+  // int32 sensor_id = 1;
+  void clear_sensor_id();
+  ::PROTOBUF_NAMESPACE_ID::int32 sensor_id() const;
+  void set_sensor_id(::PROTOBUF_NAMESPACE_ID::int32 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::int32 _internal_sensor_id() const;
+  void _internal_set_sensor_id(::PROTOBUF_NAMESPACE_ID::int32 value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:com.bcom.solar.gprc.Frame)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  ::com::bcom::solar::gprc::Image* image_;
+  ::com::bcom::solar::gprc::Matrix4x4* pose_;
+  ::PROTOBUF_NAMESPACE_ID::uint64 timestamp_;
+  ::PROTOBUF_NAMESPACE_ID::int32 sensor_id_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_solar_5fmapping_5fand_5frelocalization_5fproxy_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Matrix4x4 PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:com.bcom.solar.gprc.Matrix4x4) */ {
+ public:
+  inline Matrix4x4() : Matrix4x4(nullptr) {}
+  virtual ~Matrix4x4();
+  explicit constexpr Matrix4x4(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Matrix4x4(const Matrix4x4& from);
+  Matrix4x4(Matrix4x4&& from) noexcept
+    : Matrix4x4() {
+    *this = ::std::move(from);
+  }
+
+  inline Matrix4x4& operator=(const Matrix4x4& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Matrix4x4& operator=(Matrix4x4&& from) noexcept {
+    if (GetArena() == from.GetArena()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return GetMetadataStatic().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return GetMetadataStatic().reflection;
+  }
+  static const Matrix4x4& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Matrix4x4* internal_default_instance() {
+    return reinterpret_cast<const Matrix4x4*>(
+               &_Matrix4x4_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    18;
+
+  friend void swap(Matrix4x4& a, Matrix4x4& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Matrix4x4* other) {
+    if (other == this) return;
+    if (GetArena() == other->GetArena()) {
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Matrix4x4* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline Matrix4x4* New() const final {
+    return CreateMaybeMessage<Matrix4x4>(nullptr);
+  }
+
+  Matrix4x4* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<Matrix4x4>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const Matrix4x4& from);
+  void MergeFrom(const Matrix4x4& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Matrix4x4* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "com.bcom.solar.gprc.Matrix4x4";
+  }
+  protected:
+  explicit Matrix4x4(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    return ::descriptor_table_solar_5fmapping_5fand_5frelocalization_5fproxy_2eproto_metadata_getter(kIndexInFileMessages);
+  }
+
+  public:
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kM11FieldNumber = 1,
+    kM12FieldNumber = 2,
+    kM13FieldNumber = 3,
+    kM14FieldNumber = 4,
+    kM21FieldNumber = 5,
+    kM22FieldNumber = 6,
+    kM23FieldNumber = 7,
+    kM24FieldNumber = 8,
+    kM31FieldNumber = 9,
+    kM32FieldNumber = 10,
+    kM33FieldNumber = 11,
+    kM34FieldNumber = 12,
+    kM41FieldNumber = 13,
+    kM42FieldNumber = 14,
+    kM43FieldNumber = 15,
+    kM44FieldNumber = 16,
+  };
+  // float m11 = 1;
+  void clear_m11();
+  float m11() const;
+  void set_m11(float value);
+  private:
+  float _internal_m11() const;
+  void _internal_set_m11(float value);
+  public:
+
+  // float m12 = 2;
+  void clear_m12();
+  float m12() const;
+  void set_m12(float value);
+  private:
+  float _internal_m12() const;
+  void _internal_set_m12(float value);
+  public:
+
+  // float m13 = 3;
+  void clear_m13();
+  float m13() const;
+  void set_m13(float value);
+  private:
+  float _internal_m13() const;
+  void _internal_set_m13(float value);
+  public:
+
+  // float m14 = 4;
+  void clear_m14();
+  float m14() const;
+  void set_m14(float value);
+  private:
+  float _internal_m14() const;
+  void _internal_set_m14(float value);
+  public:
+
+  // float m21 = 5;
+  void clear_m21();
+  float m21() const;
+  void set_m21(float value);
+  private:
+  float _internal_m21() const;
+  void _internal_set_m21(float value);
+  public:
+
+  // float m22 = 6;
+  void clear_m22();
+  float m22() const;
+  void set_m22(float value);
+  private:
+  float _internal_m22() const;
+  void _internal_set_m22(float value);
+  public:
+
+  // float m23 = 7;
+  void clear_m23();
+  float m23() const;
+  void set_m23(float value);
+  private:
+  float _internal_m23() const;
+  void _internal_set_m23(float value);
+  public:
+
+  // float m24 = 8;
+  void clear_m24();
+  float m24() const;
+  void set_m24(float value);
+  private:
+  float _internal_m24() const;
+  void _internal_set_m24(float value);
+  public:
+
+  // float m31 = 9;
+  void clear_m31();
+  float m31() const;
+  void set_m31(float value);
+  private:
+  float _internal_m31() const;
+  void _internal_set_m31(float value);
+  public:
+
+  // float m32 = 10;
+  void clear_m32();
+  float m32() const;
+  void set_m32(float value);
+  private:
+  float _internal_m32() const;
+  void _internal_set_m32(float value);
+  public:
+
+  // float m33 = 11;
+  void clear_m33();
+  float m33() const;
+  void set_m33(float value);
+  private:
+  float _internal_m33() const;
+  void _internal_set_m33(float value);
+  public:
+
+  // float m34 = 12;
+  void clear_m34();
+  float m34() const;
+  void set_m34(float value);
+  private:
+  float _internal_m34() const;
+  void _internal_set_m34(float value);
+  public:
+
+  // float m41 = 13;
+  void clear_m41();
+  float m41() const;
+  void set_m41(float value);
+  private:
+  float _internal_m41() const;
+  void _internal_set_m41(float value);
+  public:
+
+  // float m42 = 14;
+  void clear_m42();
+  float m42() const;
+  void set_m42(float value);
+  private:
+  float _internal_m42() const;
+  void _internal_set_m42(float value);
+  public:
+
+  // float m43 = 15;
+  void clear_m43();
+  float m43() const;
+  void set_m43(float value);
+  private:
+  float _internal_m43() const;
+  void _internal_set_m43(float value);
+  public:
+
+  // float m44 = 16;
+  void clear_m44();
+  float m44() const;
+  void set_m44(float value);
+  private:
+  float _internal_m44() const;
+  void _internal_set_m44(float value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:com.bcom.solar.gprc.Matrix4x4)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  float m11_;
+  float m12_;
+  float m13_;
+  float m14_;
+  float m21_;
+  float m22_;
+  float m23_;
+  float m24_;
+  float m31_;
+  float m32_;
+  float m33_;
+  float m34_;
+  float m41_;
+  float m42_;
+  float m43_;
+  float m44_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_solar_5fmapping_5fand_5frelocalization_5fproxy_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Matrix3x3 PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:com.bcom.solar.gprc.Matrix3x3) */ {
+ public:
+  inline Matrix3x3() : Matrix3x3(nullptr) {}
+  virtual ~Matrix3x3();
+  explicit constexpr Matrix3x3(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Matrix3x3(const Matrix3x3& from);
+  Matrix3x3(Matrix3x3&& from) noexcept
+    : Matrix3x3() {
+    *this = ::std::move(from);
+  }
+
+  inline Matrix3x3& operator=(const Matrix3x3& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Matrix3x3& operator=(Matrix3x3&& from) noexcept {
+    if (GetArena() == from.GetArena()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return GetMetadataStatic().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return GetMetadataStatic().reflection;
+  }
+  static const Matrix3x3& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Matrix3x3* internal_default_instance() {
+    return reinterpret_cast<const Matrix3x3*>(
+               &_Matrix3x3_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    19;
+
+  friend void swap(Matrix3x3& a, Matrix3x3& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Matrix3x3* other) {
+    if (other == this) return;
+    if (GetArena() == other->GetArena()) {
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Matrix3x3* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline Matrix3x3* New() const final {
+    return CreateMaybeMessage<Matrix3x3>(nullptr);
+  }
+
+  Matrix3x3* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<Matrix3x3>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const Matrix3x3& from);
+  void MergeFrom(const Matrix3x3& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Matrix3x3* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "com.bcom.solar.gprc.Matrix3x3";
+  }
+  protected:
+  explicit Matrix3x3(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    return ::descriptor_table_solar_5fmapping_5fand_5frelocalization_5fproxy_2eproto_metadata_getter(kIndexInFileMessages);
+  }
+
+  public:
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kM11FieldNumber = 1,
+    kM12FieldNumber = 2,
+    kM13FieldNumber = 3,
+    kM21FieldNumber = 4,
+    kM22FieldNumber = 5,
+    kM23FieldNumber = 6,
+    kM31FieldNumber = 7,
+    kM32FieldNumber = 8,
+    kM33FieldNumber = 9,
+  };
+  // float m11 = 1;
+  void clear_m11();
+  float m11() const;
+  void set_m11(float value);
+  private:
+  float _internal_m11() const;
+  void _internal_set_m11(float value);
+  public:
+
+  // float m12 = 2;
+  void clear_m12();
+  float m12() const;
+  void set_m12(float value);
+  private:
+  float _internal_m12() const;
+  void _internal_set_m12(float value);
+  public:
+
+  // float m13 = 3;
+  void clear_m13();
+  float m13() const;
+  void set_m13(float value);
+  private:
+  float _internal_m13() const;
+  void _internal_set_m13(float value);
+  public:
+
+  // float m21 = 4;
+  void clear_m21();
+  float m21() const;
+  void set_m21(float value);
+  private:
+  float _internal_m21() const;
+  void _internal_set_m21(float value);
+  public:
+
+  // float m22 = 5;
+  void clear_m22();
+  float m22() const;
+  void set_m22(float value);
+  private:
+  float _internal_m22() const;
+  void _internal_set_m22(float value);
+  public:
+
+  // float m23 = 6;
+  void clear_m23();
+  float m23() const;
+  void set_m23(float value);
+  private:
+  float _internal_m23() const;
+  void _internal_set_m23(float value);
+  public:
+
+  // float m31 = 7;
+  void clear_m31();
+  float m31() const;
+  void set_m31(float value);
+  private:
+  float _internal_m31() const;
+  void _internal_set_m31(float value);
+  public:
+
+  // float m32 = 8;
+  void clear_m32();
+  float m32() const;
+  void set_m32(float value);
+  private:
+  float _internal_m32() const;
+  void _internal_set_m32(float value);
+  public:
+
+  // float m33 = 9;
+  void clear_m33();
+  float m33() const;
+  void set_m33(float value);
+  private:
+  float _internal_m33() const;
+  void _internal_set_m33(float value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:com.bcom.solar.gprc.Matrix3x3)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  float m11_;
+  float m12_;
+  float m13_;
+  float m21_;
+  float m22_;
+  float m23_;
+  float m31_;
+  float m32_;
+  float m33_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_solar_5fmapping_5fand_5frelocalization_5fproxy_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Matrix3x4 PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:com.bcom.solar.gprc.Matrix3x4) */ {
+ public:
+  inline Matrix3x4() : Matrix3x4(nullptr) {}
+  virtual ~Matrix3x4();
+  explicit constexpr Matrix3x4(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Matrix3x4(const Matrix3x4& from);
+  Matrix3x4(Matrix3x4&& from) noexcept
+    : Matrix3x4() {
+    *this = ::std::move(from);
+  }
+
+  inline Matrix3x4& operator=(const Matrix3x4& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Matrix3x4& operator=(Matrix3x4&& from) noexcept {
+    if (GetArena() == from.GetArena()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return GetMetadataStatic().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return GetMetadataStatic().reflection;
+  }
+  static const Matrix3x4& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Matrix3x4* internal_default_instance() {
+    return reinterpret_cast<const Matrix3x4*>(
+               &_Matrix3x4_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    20;
+
+  friend void swap(Matrix3x4& a, Matrix3x4& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Matrix3x4* other) {
+    if (other == this) return;
+    if (GetArena() == other->GetArena()) {
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Matrix3x4* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline Matrix3x4* New() const final {
+    return CreateMaybeMessage<Matrix3x4>(nullptr);
+  }
+
+  Matrix3x4* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<Matrix3x4>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const Matrix3x4& from);
+  void MergeFrom(const Matrix3x4& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Matrix3x4* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "com.bcom.solar.gprc.Matrix3x4";
+  }
+  protected:
+  explicit Matrix3x4(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    return ::descriptor_table_solar_5fmapping_5fand_5frelocalization_5fproxy_2eproto_metadata_getter(kIndexInFileMessages);
+  }
+
+  public:
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kM11FieldNumber = 1,
+    kM12FieldNumber = 2,
+    kM13FieldNumber = 3,
+    kM14FieldNumber = 4,
+    kM21FieldNumber = 5,
+    kM22FieldNumber = 6,
+    kM23FieldNumber = 7,
+    kM24FieldNumber = 8,
+    kM31FieldNumber = 9,
+    kM32FieldNumber = 10,
+    kM33FieldNumber = 11,
+    kM34FieldNumber = 12,
+  };
+  // float m11 = 1;
+  void clear_m11();
+  float m11() const;
+  void set_m11(float value);
+  private:
+  float _internal_m11() const;
+  void _internal_set_m11(float value);
+  public:
+
+  // float m12 = 2;
+  void clear_m12();
+  float m12() const;
+  void set_m12(float value);
+  private:
+  float _internal_m12() const;
+  void _internal_set_m12(float value);
+  public:
+
+  // float m13 = 3;
+  void clear_m13();
+  float m13() const;
+  void set_m13(float value);
+  private:
+  float _internal_m13() const;
+  void _internal_set_m13(float value);
+  public:
+
+  // float m14 = 4;
+  void clear_m14();
+  float m14() const;
+  void set_m14(float value);
+  private:
+  float _internal_m14() const;
+  void _internal_set_m14(float value);
+  public:
+
+  // float m21 = 5;
+  void clear_m21();
+  float m21() const;
+  void set_m21(float value);
+  private:
+  float _internal_m21() const;
+  void _internal_set_m21(float value);
+  public:
+
+  // float m22 = 6;
+  void clear_m22();
+  float m22() const;
+  void set_m22(float value);
+  private:
+  float _internal_m22() const;
+  void _internal_set_m22(float value);
+  public:
+
+  // float m23 = 7;
+  void clear_m23();
+  float m23() const;
+  void set_m23(float value);
+  private:
+  float _internal_m23() const;
+  void _internal_set_m23(float value);
+  public:
+
+  // float m24 = 8;
+  void clear_m24();
+  float m24() const;
+  void set_m24(float value);
+  private:
+  float _internal_m24() const;
+  void _internal_set_m24(float value);
+  public:
+
+  // float m31 = 9;
+  void clear_m31();
+  float m31() const;
+  void set_m31(float value);
+  private:
+  float _internal_m31() const;
+  void _internal_set_m31(float value);
+  public:
+
+  // float m32 = 10;
+  void clear_m32();
+  float m32() const;
+  void set_m32(float value);
+  private:
+  float _internal_m32() const;
+  void _internal_set_m32(float value);
+  public:
+
+  // float m33 = 11;
+  void clear_m33();
+  float m33() const;
+  void set_m33(float value);
+  private:
+  float _internal_m33() const;
+  void _internal_set_m33(float value);
+  public:
+
+  // float m34 = 12;
+  void clear_m34();
+  float m34() const;
+  void set_m34(float value);
+  private:
+  float _internal_m34() const;
+  void _internal_set_m34(float value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:com.bcom.solar.gprc.Matrix3x4)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  float m11_;
+  float m12_;
+  float m13_;
+  float m14_;
+  float m21_;
+  float m22_;
+  float m23_;
+  float m24_;
+  float m31_;
+  float m32_;
+  float m33_;
+  float m34_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_solar_5fmapping_5fand_5frelocalization_5fproxy_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// Empty
+
+// -------------------------------------------------------------------
+
+// ClientUUID
+
+// string client_uuid = 1;
+inline void ClientUUID::clear_client_uuid() {
+  client_uuid_.ClearToEmpty();
+}
+inline const std::string& ClientUUID::client_uuid() const {
+  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.ClientUUID.client_uuid)
+  return _internal_client_uuid();
+}
+inline void ClientUUID::set_client_uuid(const std::string& value) {
+  _internal_set_client_uuid(value);
   // @@protoc_insertion_point(field_set:com.bcom.solar.gprc.ClientUUID.client_uuid)
 }
-inline std::string* ClientUUID::mutable_client_uuid() {
-  // @@protoc_insertion_point(field_mutable:com.bcom.solar.gprc.ClientUUID.client_uuid)
-  return _internal_mutable_client_uuid();
+inline std::string* ClientUUID::mutable_client_uuid() {
+  // @@protoc_insertion_point(field_mutable:com.bcom.solar.gprc.ClientUUID.client_uuid)
+  return _internal_mutable_client_uuid();
+}
+inline const std::string& ClientUUID::_internal_client_uuid() const {
+  return client_uuid_.Get();
+}
+inline void ClientUUID::_internal_set_client_uuid(const std::string& value) {
+  
+  client_uuid_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArena());
+}
+inline void ClientUUID::set_client_uuid(std::string&& value) {
+  
+  client_uuid_.Set(
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::move(value), GetArena());
+  // @@protoc_insertion_point(field_set_rvalue:com.bcom.solar.gprc.ClientUUID.client_uuid)
+}
+inline void ClientUUID::set_client_uuid(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  
+  client_uuid_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(value), GetArena());
+  // @@protoc_insertion_point(field_set_char:com.bcom.solar.gprc.ClientUUID.client_uuid)
+}
+inline void ClientUUID::set_client_uuid(const char* value,
+    size_t size) {
+  
+  client_uuid_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArena());
+  // @@protoc_insertion_point(field_set_pointer:com.bcom.solar.gprc.ClientUUID.client_uuid)
+}
+inline std::string* ClientUUID::_internal_mutable_client_uuid() {
+  
+  return client_uuid_.Mutable(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArena());
+}
+inline std::string* ClientUUID::release_client_uuid() {
+  // @@protoc_insertion_point(field_release:com.bcom.solar.gprc.ClientUUID.client_uuid)
+  return client_uuid_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline void ClientUUID::set_allocated_client_uuid(std::string* client_uuid) {
+  if (client_uuid != nullptr) {
+    
+  } else {
+    
+  }
+  client_uuid_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), client_uuid,
+      GetArena());
+  // @@protoc_insertion_point(field_set_allocated:com.bcom.solar.gprc.ClientUUID.client_uuid)
+}
+
+// -------------------------------------------------------------------
+
+// PipelineModeValue
+
+// string client_uuid = 1;
+inline void PipelineModeValue::clear_client_uuid() {
+  client_uuid_.ClearToEmpty();
+}
+inline const std::string& PipelineModeValue::client_uuid() const {
+  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.PipelineModeValue.client_uuid)
+  return _internal_client_uuid();
+}
+inline void PipelineModeValue::set_client_uuid(const std::string& value) {
+  _internal_set_client_uuid(value);
+  // @@protoc_insertion_point(field_set:com.bcom.solar.gprc.PipelineModeValue.client_uuid)
+}
+inline std::string* PipelineModeValue::mutable_client_uuid() {
+  // @@protoc_insertion_point(field_mutable:com.bcom.solar.gprc.PipelineModeValue.client_uuid)
+  return _internal_mutable_client_uuid();
+}
+inline const std::string& PipelineModeValue::_internal_client_uuid() const {
+  return client_uuid_.Get();
+}
+inline void PipelineModeValue::_internal_set_client_uuid(const std::string& value) {
+  
+  client_uuid_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArena());
+}
+inline void PipelineModeValue::set_client_uuid(std::string&& value) {
+  
+  client_uuid_.Set(
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::move(value), GetArena());
+  // @@protoc_insertion_point(field_set_rvalue:com.bcom.solar.gprc.PipelineModeValue.client_uuid)
+}
+inline void PipelineModeValue::set_client_uuid(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  
+  client_uuid_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(value), GetArena());
+  // @@protoc_insertion_point(field_set_char:com.bcom.solar.gprc.PipelineModeValue.client_uuid)
+}
+inline void PipelineModeValue::set_client_uuid(const char* value,
+    size_t size) {
+  
+  client_uuid_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArena());
+  // @@protoc_insertion_point(field_set_pointer:com.bcom.solar.gprc.PipelineModeValue.client_uuid)
+}
+inline std::string* PipelineModeValue::_internal_mutable_client_uuid() {
+  
+  return client_uuid_.Mutable(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArena());
+}
+inline std::string* PipelineModeValue::release_client_uuid() {
+  // @@protoc_insertion_point(field_release:com.bcom.solar.gprc.PipelineModeValue.client_uuid)
+  return client_uuid_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline void PipelineModeValue::set_allocated_client_uuid(std::string* client_uuid) {
+  if (client_uuid != nullptr) {
+    
+  } else {
+    
+  }
+  client_uuid_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), client_uuid,
+      GetArena());
+  // @@protoc_insertion_point(field_set_allocated:com.bcom.solar.gprc.PipelineModeValue.client_uuid)
+}
+
+// .com.bcom.solar.gprc.PipelineMode pipeline_mode = 2;
+inline void PipelineModeValue::clear_pipeline_mode() {
+  pipeline_mode_ = 0;
+}
+inline ::com::bcom::solar::gprc::PipelineMode PipelineModeValue::_internal_pipeline_mode() const {
+  return static_cast< ::com::bcom::solar::gprc::PipelineMode >(pipeline_mode_);
+}
+inline ::com::bcom::solar::gprc::PipelineMode PipelineModeValue::pipeline_mode() const {
+  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.PipelineModeValue.pipeline_mode)
+  return _internal_pipeline_mode();
+}
+inline void PipelineModeValue::_internal_set_pipeline_mode(::com::bcom::solar::gprc::PipelineMode value) {
+  
+  pipeline_mode_ = value;
+}
+inline void PipelineModeValue::set_pipeline_mode(::com::bcom::solar::gprc::PipelineMode value) {
+  _internal_set_pipeline_mode(value);
+  // @@protoc_insertion_point(field_set:com.bcom.solar.gprc.PipelineModeValue.pipeline_mode)
+}
+
+// -------------------------------------------------------------------
+
+// Message
+
+// string client_uuid = 1;
+inline void Message::clear_client_uuid() {
+  client_uuid_.ClearToEmpty();
+}
+inline const std::string& Message::client_uuid() const {
+  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.Message.client_uuid)
+  return _internal_client_uuid();
+}
+inline void Message::set_client_uuid(const std::string& value) {
+  _internal_set_client_uuid(value);
+  // @@protoc_insertion_point(field_set:com.bcom.solar.gprc.Message.client_uuid)
+}
+inline std::string* Message::mutable_client_uuid() {
+  // @@protoc_insertion_point(field_mutable:com.bcom.solar.gprc.Message.client_uuid)
+  return _internal_mutable_client_uuid();
+}
+inline const std::string& Message::_internal_client_uuid() const {
+  return client_uuid_.Get();
+}
+inline void Message::_internal_set_client_uuid(const std::string& value) {
+  
+  client_uuid_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArena());
+}
+inline void Message::set_client_uuid(std::string&& value) {
+  
+  client_uuid_.Set(
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::move(value), GetArena());
+  // @@protoc_insertion_point(field_set_rvalue:com.bcom.solar.gprc.Message.client_uuid)
+}
+inline void Message::set_client_uuid(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  
+  client_uuid_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(value), GetArena());
+  // @@protoc_insertion_point(field_set_char:com.bcom.solar.gprc.Message.client_uuid)
+}
+inline void Message::set_client_uuid(const char* value,
+    size_t size) {
+  
+  client_uuid_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArena());
+  // @@protoc_insertion_point(field_set_pointer:com.bcom.solar.gprc.Message.client_uuid)
+}
+inline std::string* Message::_internal_mutable_client_uuid() {
+  
+  return client_uuid_.Mutable(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArena());
+}
+inline std::string* Message::release_client_uuid() {
+  // @@protoc_insertion_point(field_release:com.bcom.solar.gprc.Message.client_uuid)
+  return client_uuid_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline void Message::set_allocated_client_uuid(std::string* client_uuid) {
+  if (client_uuid != nullptr) {
+    
+  } else {
+    
+  }
+  client_uuid_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), client_uuid,
+      GetArena());
+  // @@protoc_insertion_point(field_set_allocated:com.bcom.solar.gprc.Message.client_uuid)
+}
+
+// string message = 2;
+inline void Message::clear_message() {
+  message_.ClearToEmpty();
+}
+inline const std::string& Message::message() const {
+  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.Message.message)
+  return _internal_message();
+}
+inline void Message::set_message(const std::string& value) {
+  _internal_set_message(value);
+  // @@protoc_insertion_point(field_set:com.bcom.solar.gprc.Message.message)
+}
+inline std::string* Message::mutable_message() {
+  // @@protoc_insertion_point(field_mutable:com.bcom.solar.gprc.Message.message)
+  return _internal_mutable_message();
+}
+inline const std::string& Message::_internal_message() const {
+  return message_.Get();
+}
+inline void Message::_internal_set_message(const std::string& value) {
+  
+  message_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArena());
+}
+inline void Message::set_message(std::string&& value) {
+  
+  message_.Set(
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::move(value), GetArena());
+  // @@protoc_insertion_point(field_set_rvalue:com.bcom.solar.gprc.Message.message)
+}
+inline void Message::set_message(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  
+  message_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(value), GetArena());
+  // @@protoc_insertion_point(field_set_char:com.bcom.solar.gprc.Message.message)
+}
+inline void Message::set_message(const char* value,
+    size_t size) {
+  
+  message_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArena());
+  // @@protoc_insertion_point(field_set_pointer:com.bcom.solar.gprc.Message.message)
+}
+inline std::string* Message::_internal_mutable_message() {
+  
+  return message_.Mutable(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArena());
+}
+inline std::string* Message::release_message() {
+  // @@protoc_insertion_point(field_release:com.bcom.solar.gprc.Message.message)
+  return message_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline void Message::set_allocated_message(std::string* message) {
+  if (message != nullptr) {
+    
+  } else {
+    
+  }
+  message_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), message,
+      GetArena());
+  // @@protoc_insertion_point(field_set_allocated:com.bcom.solar.gprc.Message.message)
+}
+
+// -------------------------------------------------------------------
+
+// CameraParameters
+
+// string client_uuid = 1;
+inline void CameraParameters::clear_client_uuid() {
+  client_uuid_.ClearToEmpty();
+}
+inline const std::string& CameraParameters::client_uuid() const {
+  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.CameraParameters.client_uuid)
+  return _internal_client_uuid();
+}
+inline void CameraParameters::set_client_uuid(const std::string& value) {
+  _internal_set_client_uuid(value);
+  // @@protoc_insertion_point(field_set:com.bcom.solar.gprc.CameraParameters.client_uuid)
+}
+inline std::string* CameraParameters::mutable_client_uuid() {
+  // @@protoc_insertion_point(field_mutable:com.bcom.solar.gprc.CameraParameters.client_uuid)
+  return _internal_mutable_client_uuid();
+}
+inline const std::string& CameraParameters::_internal_client_uuid() const {
+  return client_uuid_.Get();
+}
+inline void CameraParameters::_internal_set_client_uuid(const std::string& value) {
+  
+  client_uuid_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArena());
+}
+inline void CameraParameters::set_client_uuid(std::string&& value) {
+  
+  client_uuid_.Set(
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::move(value), GetArena());
+  // @@protoc_insertion_point(field_set_rvalue:com.bcom.solar.gprc.CameraParameters.client_uuid)
+}
+inline void CameraParameters::set_client_uuid(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  
+  client_uuid_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(value), GetArena());
+  // @@protoc_insertion_point(field_set_char:com.bcom.solar.gprc.CameraParameters.client_uuid)
+}
+inline void CameraParameters::set_client_uuid(const char* value,
+    size_t size) {
+  
+  client_uuid_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArena());
+  // @@protoc_insertion_point(field_set_pointer:com.bcom.solar.gprc.CameraParameters.client_uuid)
+}
+inline std::string* CameraParameters::_internal_mutable_client_uuid() {
+  
+  return client_uuid_.Mutable(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArena());
+}
+inline std::string* CameraParameters::release_client_uuid() {
+  // @@protoc_insertion_point(field_release:com.bcom.solar.gprc.CameraParameters.client_uuid)
+  return client_uuid_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline void CameraParameters::set_allocated_client_uuid(std::string* client_uuid) {
+  if (client_uuid != nullptr) {
+    
+  } else {
+    
+  }
+  client_uuid_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), client_uuid,
+      GetArena());
+  // @@protoc_insertion_point(field_set_allocated:com.bcom.solar.gprc.CameraParameters.client_uuid)
+}
+
+// string name = 2;
+inline void CameraParameters::clear_name() {
+  name_.ClearToEmpty();
+}
+inline const std::string& CameraParameters::name() const {
+  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.CameraParameters.name)
+  return _internal_name();
+}
+inline void CameraParameters::set_name(const std::string& value) {
+  _internal_set_name(value);
+  // @@protoc_insertion_point(field_set:com.bcom.solar.gprc.CameraParameters.name)
+}
+inline std::string* CameraParameters::mutable_name() {
+  // @@protoc_insertion_point(field_mutable:com.bcom.solar.gprc.CameraParameters.name)
+  return _internal_mutable_name();
+}
+inline const std::string& CameraParameters::_internal_name() const {
+  return name_.Get();
+}
+inline void CameraParameters::_internal_set_name(const std::string& value) {
+  
+  name_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArena());
+}
+inline void CameraParameters::set_name(std::string&& value) {
+  
+  name_.Set(
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::move(value), GetArena());
+  // @@protoc_insertion_point(field_set_rvalue:com.bcom.solar.gprc.CameraParameters.name)
+}
+inline void CameraParameters::set_name(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  
+  name_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(value), GetArena());
+  // @@protoc_insertion_point(field_set_char:com.bcom.solar.gprc.CameraParameters.name)
+}
+inline void CameraParameters::set_name(const char* value,
+    size_t size) {
+  
+  name_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArena());
+  // @@protoc_insertion_point(field_set_pointer:com.bcom.solar.gprc.CameraParameters.name)
+}
+inline std::string* CameraParameters::_internal_mutable_name() {
+  
+  return name_.Mutable(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArena());
+}
+inline std::string* CameraParameters::release_name() {
+  // @@protoc_insertion_point(field_release:com.bcom.solar.gprc.CameraParameters.name)
+  return name_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline void CameraParameters::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    
+  } else {
+    
+  }
+  name_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), name,
+      GetArena());
+  // @@protoc_insertion_point(field_set_allocated:com.bcom.solar.gprc.CameraParameters.name)
+}
+
+// uint32 id = 3;
+inline void CameraParameters::clear_id() {
+  id_ = 0u;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint32 CameraParameters::_internal_id() const {
+  return id_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint32 CameraParameters::id() const {
+  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.CameraParameters.id)
+  return _internal_id();
+}
+inline void CameraParameters::_internal_set_id(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  
+  id_ = value;
+}
+inline void CameraParameters::set_id(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  _internal_set_id(value);
+  // @@protoc_insertion_point(field_set:com.bcom.solar.gprc.CameraParameters.id)
+}
+
+// .com.bcom.solar.gprc.CameraType camera_type = 4;
+inline void CameraParameters::clear_camera_type() {
+  camera_type_ = 0;
+}
+inline ::com::bcom::solar::gprc::CameraType CameraParameters::_internal_camera_type() const {
+  return static_cast< ::com::bcom::solar::gprc::CameraType >(camera_type_);
+}
+inline ::com::bcom::solar::gprc::CameraType CameraParameters::camera_type() const {
+  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.CameraParameters.camera_type)
+  return _internal_camera_type();
+}
+inline void CameraParameters::_internal_set_camera_type(::com::bcom::solar::gprc::CameraType value) {
+  
+  camera_type_ = value;
+}
+inline void CameraParameters::set_camera_type(::com::bcom::solar::gprc::CameraType value) {
+  _internal_set_camera_type(value);
+  // @@protoc_insertion_point(field_set:com.bcom.solar.gprc.CameraParameters.camera_type)
+}
+
+// uint32 width = 5;
+inline void CameraParameters::clear_width() {
+  width_ = 0u;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint32 CameraParameters::_internal_width() const {
+  return width_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint32 CameraParameters::width() const {
+  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.CameraParameters.width)
+  return _internal_width();
+}
+inline void CameraParameters::_internal_set_width(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  
+  width_ = value;
+}
+inline void CameraParameters::set_width(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  _internal_set_width(value);
+  // @@protoc_insertion_point(field_set:com.bcom.solar.gprc.CameraParameters.width)
+}
+
+// uint32 height = 6;
+inline void CameraParameters::clear_height() {
+  height_ = 0u;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint32 CameraParameters::_internal_height() const {
+  return height_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint32 CameraParameters::height() const {
+  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.CameraParameters.height)
+  return _internal_height();
+}
+inline void CameraParameters::_internal_set_height(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  
+  height_ = value;
+}
+inline void CameraParameters::set_height(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  _internal_set_height(value);
+  // @@protoc_insertion_point(field_set:com.bcom.solar.gprc.CameraParameters.height)
+}
+
+// .com.bcom.solar.gprc.Matrix3x3 intrinsics = 7;
+inline bool CameraParameters::_internal_has_intrinsics() const {
+  return this != internal_default_instance() && intrinsics_ != nullptr;
+}
+inline bool CameraParameters::has_intrinsics() const {
+  return _internal_has_intrinsics();
+}
+inline void CameraParameters::clear_intrinsics() {
+  if (GetArena() == nullptr && intrinsics_ != nullptr) {
+    delete intrinsics_;
+  }
+  intrinsics_ = nullptr;
+}
+inline const ::com::bcom::solar::gprc::Matrix3x3& CameraParameters::_internal_intrinsics() const {
+  const ::com::bcom::solar::gprc::Matrix3x3* p = intrinsics_;
+  return p != nullptr ? *p : reinterpret_cast<const ::com::bcom::solar::gprc::Matrix3x3&>(
+      ::com::bcom::solar::gprc::_Matrix3x3_default_instance_);
+}
+inline const ::com::bcom::solar::gprc::Matrix3x3& CameraParameters::intrinsics() const {
+  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.CameraParameters.intrinsics)
+  return _internal_intrinsics();
+}
+inline void CameraParameters::unsafe_arena_set_allocated_intrinsics(
+    ::com::bcom::solar::gprc::Matrix3x3* intrinsics) {
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(intrinsics_);
+  }
+  intrinsics_ = intrinsics;
+  if (intrinsics) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:com.bcom.solar.gprc.CameraParameters.intrinsics)
+}
+inline ::com::bcom::solar::gprc::Matrix3x3* CameraParameters::release_intrinsics() {
+  
+  ::com::bcom::solar::gprc::Matrix3x3* temp = intrinsics_;
+  intrinsics_ = nullptr;
+  if (GetArena() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+  return temp;
+}
+inline ::com::bcom::solar::gprc::Matrix3x3* CameraParameters::unsafe_arena_release_intrinsics() {
+  // @@protoc_insertion_point(field_release:com.bcom.solar.gprc.CameraParameters.intrinsics)
+  
+  ::com::bcom::solar::gprc::Matrix3x3* temp = intrinsics_;
+  intrinsics_ = nullptr;
+  return temp;
+}
+inline ::com::bcom::solar::gprc::Matrix3x3* CameraParameters::_internal_mutable_intrinsics() {
+  
+  if (intrinsics_ == nullptr) {
+    auto* p = CreateMaybeMessage<::com::bcom::solar::gprc::Matrix3x3>(GetArena());
+    intrinsics_ = p;
+  }
+  return intrinsics_;
+}
+inline ::com::bcom::solar::gprc::Matrix3x3* CameraParameters::mutable_intrinsics() {
+  // @@protoc_insertion_point(field_mutable:com.bcom.solar.gprc.CameraParameters.intrinsics)
+  return _internal_mutable_intrinsics();
+}
+inline void CameraParameters::set_allocated_intrinsics(::com::bcom::solar::gprc::Matrix3x3* intrinsics) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  if (message_arena == nullptr) {
+    delete intrinsics_;
+  }
+  if (intrinsics) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(intrinsics);
+    if (message_arena != submessage_arena) {
+      intrinsics = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, intrinsics, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  intrinsics_ = intrinsics;
+  // @@protoc_insertion_point(field_set_allocated:com.bcom.solar.gprc.CameraParameters.intrinsics)
+}
+
+// .com.bcom.solar.gprc.CameraDistortion distortion = 8;
+inline bool CameraParameters::_internal_has_distortion() const {
+  return this != internal_default_instance() && distortion_ != nullptr;
 }
-inline const std::string& ClientUUID::_internal_client_uuid() const {
-  return client_uuid_.Get();
+inline bool CameraParameters::has_distortion() const {
+  return _internal_has_distortion();
 }
-inline void ClientUUID::_internal_set_client_uuid(const std::string& value) {
-  
-  client_uuid_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArena());
+inline void CameraParameters::clear_distortion() {
+  if (GetArena() == nullptr && distortion_ != nullptr) {
+    delete distortion_;
+  }
+  distortion_ = nullptr;
 }
-inline void ClientUUID::set_client_uuid(std::string&& value) {
-  
-  client_uuid_.Set(
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:com.bcom.solar.gprc.ClientUUID.client_uuid)
+inline const ::com::bcom::solar::gprc::CameraDistortion& CameraParameters::_internal_distortion() const {
+  const ::com::bcom::solar::gprc::CameraDistortion* p = distortion_;
+  return p != nullptr ? *p : reinterpret_cast<const ::com::bcom::solar::gprc::CameraDistortion&>(
+      ::com::bcom::solar::gprc::_CameraDistortion_default_instance_);
 }
-inline void ClientUUID::set_client_uuid(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
+inline const ::com::bcom::solar::gprc::CameraDistortion& CameraParameters::distortion() const {
+  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.CameraParameters.distortion)
+  return _internal_distortion();
+}
+inline void CameraParameters::unsafe_arena_set_allocated_distortion(
+    ::com::bcom::solar::gprc::CameraDistortion* distortion) {
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(distortion_);
+  }
+  distortion_ = distortion;
+  if (distortion) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:com.bcom.solar.gprc.CameraParameters.distortion)
+}
+inline ::com::bcom::solar::gprc::CameraDistortion* CameraParameters::release_distortion() {
   
-  client_uuid_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(value), GetArena());
-  // @@protoc_insertion_point(field_set_char:com.bcom.solar.gprc.ClientUUID.client_uuid)
+  ::com::bcom::solar::gprc::CameraDistortion* temp = distortion_;
+  distortion_ = nullptr;
+  if (GetArena() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+  return temp;
 }
-inline void ClientUUID::set_client_uuid(const char* value,
-    size_t size) {
+inline ::com::bcom::solar::gprc::CameraDistortion* CameraParameters::unsafe_arena_release_distortion() {
+  // @@protoc_insertion_point(field_release:com.bcom.solar.gprc.CameraParameters.distortion)
   
-  client_uuid_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:com.bcom.solar.gprc.ClientUUID.client_uuid)
+  ::com::bcom::solar::gprc::CameraDistortion* temp = distortion_;
+  distortion_ = nullptr;
+  return temp;
 }
-inline std::string* ClientUUID::_internal_mutable_client_uuid() {
+inline ::com::bcom::solar::gprc::CameraDistortion* CameraParameters::_internal_mutable_distortion() {
   
-  return client_uuid_.Mutable(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArena());
+  if (distortion_ == nullptr) {
+    auto* p = CreateMaybeMessage<::com::bcom::solar::gprc::CameraDistortion>(GetArena());
+    distortion_ = p;
+  }
+  return distortion_;
 }
-inline std::string* ClientUUID::release_client_uuid() {
-  // @@protoc_insertion_point(field_release:com.bcom.solar.gprc.ClientUUID.client_uuid)
-  return client_uuid_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline ::com::bcom::solar::gprc::CameraDistortion* CameraParameters::mutable_distortion() {
+  // @@protoc_insertion_point(field_mutable:com.bcom.solar.gprc.CameraParameters.distortion)
+  return _internal_mutable_distortion();
 }
-inline void ClientUUID::set_allocated_client_uuid(std::string* client_uuid) {
-  if (client_uuid != nullptr) {
+inline void CameraParameters::set_allocated_distortion(::com::bcom::solar::gprc::CameraDistortion* distortion) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  if (message_arena == nullptr) {
+    delete distortion_;
+  }
+  if (distortion) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(distortion);
+    if (message_arena != submessage_arena) {
+      distortion = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, distortion, submessage_arena);
+    }
     
   } else {
     
   }
-  client_uuid_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), client_uuid,
-      GetArena());
-  // @@protoc_insertion_point(field_set_allocated:com.bcom.solar.gprc.ClientUUID.client_uuid)
+  distortion_ = distortion;
+  // @@protoc_insertion_point(field_set_allocated:com.bcom.solar.gprc.CameraParameters.distortion)
+}
+
+// .com.bcom.solar.gprc.ImageRotation rotation = 9;
+inline void CameraParameters::clear_rotation() {
+  rotation_ = 0;
+}
+inline ::com::bcom::solar::gprc::ImageRotation CameraParameters::_internal_rotation() const {
+  return static_cast< ::com::bcom::solar::gprc::ImageRotation >(rotation_);
+}
+inline ::com::bcom::solar::gprc::ImageRotation CameraParameters::rotation() const {
+  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.CameraParameters.rotation)
+  return _internal_rotation();
+}
+inline void CameraParameters::_internal_set_rotation(::com::bcom::solar::gprc::ImageRotation value) {
+  
+  rotation_ = value;
+}
+inline void CameraParameters::set_rotation(::com::bcom::solar::gprc::ImageRotation value) {
+  _internal_set_rotation(value);
+  // @@protoc_insertion_point(field_set:com.bcom.solar.gprc.CameraParameters.rotation)
 }
 
 // -------------------------------------------------------------------
 
-// PipelineModeValue
+// CameraParametersStereo
 
 // string client_uuid = 1;
-inline void PipelineModeValue::clear_client_uuid() {
+inline void CameraParametersStereo::clear_client_uuid() {
   client_uuid_.ClearToEmpty();
 }
-inline const std::string& PipelineModeValue::client_uuid() const {
-  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.PipelineModeValue.client_uuid)
+inline const std::string& CameraParametersStereo::client_uuid() const {
+  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.CameraParametersStereo.client_uuid)
   return _internal_client_uuid();
 }
-inline void PipelineModeValue::set_client_uuid(const std::string& value) {
+inline void CameraParametersStereo::set_client_uuid(const std::string& value) {
   _internal_set_client_uuid(value);
-  // @@protoc_insertion_point(field_set:com.bcom.solar.gprc.PipelineModeValue.client_uuid)
+  // @@protoc_insertion_point(field_set:com.bcom.solar.gprc.CameraParametersStereo.client_uuid)
 }
-inline std::string* PipelineModeValue::mutable_client_uuid() {
-  // @@protoc_insertion_point(field_mutable:com.bcom.solar.gprc.PipelineModeValue.client_uuid)
+inline std::string* CameraParametersStereo::mutable_client_uuid() {
+  // @@protoc_insertion_point(field_mutable:com.bcom.solar.gprc.CameraParametersStereo.client_uuid)
   return _internal_mutable_client_uuid();
 }
-inline const std::string& PipelineModeValue::_internal_client_uuid() const {
+inline const std::string& CameraParametersStereo::_internal_client_uuid() const {
   return client_uuid_.Get();
 }
-inline void PipelineModeValue::_internal_set_client_uuid(const std::string& value) {
+inline void CameraParametersStereo::_internal_set_client_uuid(const std::string& value) {
   
   client_uuid_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArena());
 }
-inline void PipelineModeValue::set_client_uuid(std::string&& value) {
+inline void CameraParametersStereo::set_client_uuid(std::string&& value) {
   
   client_uuid_.Set(
     ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:com.bcom.solar.gprc.PipelineModeValue.client_uuid)
+  // @@protoc_insertion_point(field_set_rvalue:com.bcom.solar.gprc.CameraParametersStereo.client_uuid)
 }
-inline void PipelineModeValue::set_client_uuid(const char* value) {
+inline void CameraParametersStereo::set_client_uuid(const char* value) {
   GOOGLE_DCHECK(value != nullptr);
   
   client_uuid_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(value), GetArena());
-  // @@protoc_insertion_point(field_set_char:com.bcom.solar.gprc.PipelineModeValue.client_uuid)
+  // @@protoc_insertion_point(field_set_char:com.bcom.solar.gprc.CameraParametersStereo.client_uuid)
 }
-inline void PipelineModeValue::set_client_uuid(const char* value,
+inline void CameraParametersStereo::set_client_uuid(const char* value,
     size_t size) {
   
   client_uuid_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(
       reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:com.bcom.solar.gprc.PipelineModeValue.client_uuid)
+  // @@protoc_insertion_point(field_set_pointer:com.bcom.solar.gprc.CameraParametersStereo.client_uuid)
 }
-inline std::string* PipelineModeValue::_internal_mutable_client_uuid() {
+inline std::string* CameraParametersStereo::_internal_mutable_client_uuid() {
   
   return client_uuid_.Mutable(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArena());
 }
-inline std::string* PipelineModeValue::release_client_uuid() {
-  // @@protoc_insertion_point(field_release:com.bcom.solar.gprc.PipelineModeValue.client_uuid)
+inline std::string* CameraParametersStereo::release_client_uuid() {
+  // @@protoc_insertion_point(field_release:com.bcom.solar.gprc.CameraParametersStereo.client_uuid)
   return client_uuid_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
 }
-inline void PipelineModeValue::set_allocated_client_uuid(std::string* client_uuid) {
+inline void CameraParametersStereo::set_allocated_client_uuid(std::string* client_uuid) {
   if (client_uuid != nullptr) {
     
   } else {
@@ -3779,1932 +5531,2445 @@ inline void PipelineModeValue::set_allocated_client_uuid(std::string* client_uui
   }
   client_uuid_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), client_uuid,
       GetArena());
-  // @@protoc_insertion_point(field_set_allocated:com.bcom.solar.gprc.PipelineModeValue.client_uuid)
+  // @@protoc_insertion_point(field_set_allocated:com.bcom.solar.gprc.CameraParametersStereo.client_uuid)
 }
 
-// .com.bcom.solar.gprc.PipelineMode pipeline_mode = 2;
-inline void PipelineModeValue::clear_pipeline_mode() {
-  pipeline_mode_ = 0;
+// string name1 = 2;
+inline void CameraParametersStereo::clear_name1() {
+  name1_.ClearToEmpty();
 }
-inline ::com::bcom::solar::gprc::PipelineMode PipelineModeValue::_internal_pipeline_mode() const {
-  return static_cast< ::com::bcom::solar::gprc::PipelineMode >(pipeline_mode_);
+inline const std::string& CameraParametersStereo::name1() const {
+  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.CameraParametersStereo.name1)
+  return _internal_name1();
 }
-inline ::com::bcom::solar::gprc::PipelineMode PipelineModeValue::pipeline_mode() const {
-  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.PipelineModeValue.pipeline_mode)
-  return _internal_pipeline_mode();
+inline void CameraParametersStereo::set_name1(const std::string& value) {
+  _internal_set_name1(value);
+  // @@protoc_insertion_point(field_set:com.bcom.solar.gprc.CameraParametersStereo.name1)
+}
+inline std::string* CameraParametersStereo::mutable_name1() {
+  // @@protoc_insertion_point(field_mutable:com.bcom.solar.gprc.CameraParametersStereo.name1)
+  return _internal_mutable_name1();
+}
+inline const std::string& CameraParametersStereo::_internal_name1() const {
+  return name1_.Get();
+}
+inline void CameraParametersStereo::_internal_set_name1(const std::string& value) {
+  
+  name1_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArena());
+}
+inline void CameraParametersStereo::set_name1(std::string&& value) {
+  
+  name1_.Set(
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::move(value), GetArena());
+  // @@protoc_insertion_point(field_set_rvalue:com.bcom.solar.gprc.CameraParametersStereo.name1)
+}
+inline void CameraParametersStereo::set_name1(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  
+  name1_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(value), GetArena());
+  // @@protoc_insertion_point(field_set_char:com.bcom.solar.gprc.CameraParametersStereo.name1)
+}
+inline void CameraParametersStereo::set_name1(const char* value,
+    size_t size) {
+  
+  name1_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArena());
+  // @@protoc_insertion_point(field_set_pointer:com.bcom.solar.gprc.CameraParametersStereo.name1)
+}
+inline std::string* CameraParametersStereo::_internal_mutable_name1() {
+  
+  return name1_.Mutable(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArena());
+}
+inline std::string* CameraParametersStereo::release_name1() {
+  // @@protoc_insertion_point(field_release:com.bcom.solar.gprc.CameraParametersStereo.name1)
+  return name1_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline void CameraParametersStereo::set_allocated_name1(std::string* name1) {
+  if (name1 != nullptr) {
+    
+  } else {
+    
+  }
+  name1_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), name1,
+      GetArena());
+  // @@protoc_insertion_point(field_set_allocated:com.bcom.solar.gprc.CameraParametersStereo.name1)
+}
+
+// uint32 id1 = 3;
+inline void CameraParametersStereo::clear_id1() {
+  id1_ = 0u;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint32 CameraParametersStereo::_internal_id1() const {
+  return id1_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint32 CameraParametersStereo::id1() const {
+  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.CameraParametersStereo.id1)
+  return _internal_id1();
+}
+inline void CameraParametersStereo::_internal_set_id1(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  
+  id1_ = value;
+}
+inline void CameraParametersStereo::set_id1(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  _internal_set_id1(value);
+  // @@protoc_insertion_point(field_set:com.bcom.solar.gprc.CameraParametersStereo.id1)
+}
+
+// .com.bcom.solar.gprc.CameraType camera_type1 = 4;
+inline void CameraParametersStereo::clear_camera_type1() {
+  camera_type1_ = 0;
+}
+inline ::com::bcom::solar::gprc::CameraType CameraParametersStereo::_internal_camera_type1() const {
+  return static_cast< ::com::bcom::solar::gprc::CameraType >(camera_type1_);
+}
+inline ::com::bcom::solar::gprc::CameraType CameraParametersStereo::camera_type1() const {
+  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.CameraParametersStereo.camera_type1)
+  return _internal_camera_type1();
 }
-inline void PipelineModeValue::_internal_set_pipeline_mode(::com::bcom::solar::gprc::PipelineMode value) {
+inline void CameraParametersStereo::_internal_set_camera_type1(::com::bcom::solar::gprc::CameraType value) {
   
-  pipeline_mode_ = value;
+  camera_type1_ = value;
 }
-inline void PipelineModeValue::set_pipeline_mode(::com::bcom::solar::gprc::PipelineMode value) {
-  _internal_set_pipeline_mode(value);
-  // @@protoc_insertion_point(field_set:com.bcom.solar.gprc.PipelineModeValue.pipeline_mode)
+inline void CameraParametersStereo::set_camera_type1(::com::bcom::solar::gprc::CameraType value) {
+  _internal_set_camera_type1(value);
+  // @@protoc_insertion_point(field_set:com.bcom.solar.gprc.CameraParametersStereo.camera_type1)
 }
 
-// -------------------------------------------------------------------
-
-// Message
-
-// string client_uuid = 1;
-inline void Message::clear_client_uuid() {
-  client_uuid_.ClearToEmpty();
-}
-inline const std::string& Message::client_uuid() const {
-  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.Message.client_uuid)
-  return _internal_client_uuid();
-}
-inline void Message::set_client_uuid(const std::string& value) {
-  _internal_set_client_uuid(value);
-  // @@protoc_insertion_point(field_set:com.bcom.solar.gprc.Message.client_uuid)
+// uint32 width1 = 5;
+inline void CameraParametersStereo::clear_width1() {
+  width1_ = 0u;
 }
-inline std::string* Message::mutable_client_uuid() {
-  // @@protoc_insertion_point(field_mutable:com.bcom.solar.gprc.Message.client_uuid)
-  return _internal_mutable_client_uuid();
+inline ::PROTOBUF_NAMESPACE_ID::uint32 CameraParametersStereo::_internal_width1() const {
+  return width1_;
 }
-inline const std::string& Message::_internal_client_uuid() const {
-  return client_uuid_.Get();
+inline ::PROTOBUF_NAMESPACE_ID::uint32 CameraParametersStereo::width1() const {
+  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.CameraParametersStereo.width1)
+  return _internal_width1();
 }
-inline void Message::_internal_set_client_uuid(const std::string& value) {
+inline void CameraParametersStereo::_internal_set_width1(::PROTOBUF_NAMESPACE_ID::uint32 value) {
   
-  client_uuid_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArena());
+  width1_ = value;
 }
-inline void Message::set_client_uuid(std::string&& value) {
-  
-  client_uuid_.Set(
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:com.bcom.solar.gprc.Message.client_uuid)
+inline void CameraParametersStereo::set_width1(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  _internal_set_width1(value);
+  // @@protoc_insertion_point(field_set:com.bcom.solar.gprc.CameraParametersStereo.width1)
 }
-inline void Message::set_client_uuid(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  client_uuid_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(value), GetArena());
-  // @@protoc_insertion_point(field_set_char:com.bcom.solar.gprc.Message.client_uuid)
+
+// uint32 height1 = 6;
+inline void CameraParametersStereo::clear_height1() {
+  height1_ = 0u;
 }
-inline void Message::set_client_uuid(const char* value,
-    size_t size) {
-  
-  client_uuid_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:com.bcom.solar.gprc.Message.client_uuid)
+inline ::PROTOBUF_NAMESPACE_ID::uint32 CameraParametersStereo::_internal_height1() const {
+  return height1_;
 }
-inline std::string* Message::_internal_mutable_client_uuid() {
-  
-  return client_uuid_.Mutable(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArena());
+inline ::PROTOBUF_NAMESPACE_ID::uint32 CameraParametersStereo::height1() const {
+  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.CameraParametersStereo.height1)
+  return _internal_height1();
 }
-inline std::string* Message::release_client_uuid() {
-  // @@protoc_insertion_point(field_release:com.bcom.solar.gprc.Message.client_uuid)
-  return client_uuid_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline void CameraParametersStereo::_internal_set_height1(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  
+  height1_ = value;
 }
-inline void Message::set_allocated_client_uuid(std::string* client_uuid) {
-  if (client_uuid != nullptr) {
-    
-  } else {
-    
-  }
-  client_uuid_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), client_uuid,
-      GetArena());
-  // @@protoc_insertion_point(field_set_allocated:com.bcom.solar.gprc.Message.client_uuid)
+inline void CameraParametersStereo::set_height1(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  _internal_set_height1(value);
+  // @@protoc_insertion_point(field_set:com.bcom.solar.gprc.CameraParametersStereo.height1)
 }
 
-// string message = 2;
-inline void Message::clear_message() {
-  message_.ClearToEmpty();
-}
-inline const std::string& Message::message() const {
-  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.Message.message)
-  return _internal_message();
+// .com.bcom.solar.gprc.Matrix3x3 intrinsics1 = 7;
+inline bool CameraParametersStereo::_internal_has_intrinsics1() const {
+  return this != internal_default_instance() && intrinsics1_ != nullptr;
 }
-inline void Message::set_message(const std::string& value) {
-  _internal_set_message(value);
-  // @@protoc_insertion_point(field_set:com.bcom.solar.gprc.Message.message)
+inline bool CameraParametersStereo::has_intrinsics1() const {
+  return _internal_has_intrinsics1();
 }
-inline std::string* Message::mutable_message() {
-  // @@protoc_insertion_point(field_mutable:com.bcom.solar.gprc.Message.message)
-  return _internal_mutable_message();
+inline void CameraParametersStereo::clear_intrinsics1() {
+  if (GetArena() == nullptr && intrinsics1_ != nullptr) {
+    delete intrinsics1_;
+  }
+  intrinsics1_ = nullptr;
 }
-inline const std::string& Message::_internal_message() const {
-  return message_.Get();
+inline const ::com::bcom::solar::gprc::Matrix3x3& CameraParametersStereo::_internal_intrinsics1() const {
+  const ::com::bcom::solar::gprc::Matrix3x3* p = intrinsics1_;
+  return p != nullptr ? *p : reinterpret_cast<const ::com::bcom::solar::gprc::Matrix3x3&>(
+      ::com::bcom::solar::gprc::_Matrix3x3_default_instance_);
 }
-inline void Message::_internal_set_message(const std::string& value) {
-  
-  message_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArena());
+inline const ::com::bcom::solar::gprc::Matrix3x3& CameraParametersStereo::intrinsics1() const {
+  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.CameraParametersStereo.intrinsics1)
+  return _internal_intrinsics1();
 }
-inline void Message::set_message(std::string&& value) {
-  
-  message_.Set(
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:com.bcom.solar.gprc.Message.message)
+inline void CameraParametersStereo::unsafe_arena_set_allocated_intrinsics1(
+    ::com::bcom::solar::gprc::Matrix3x3* intrinsics1) {
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(intrinsics1_);
+  }
+  intrinsics1_ = intrinsics1;
+  if (intrinsics1) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:com.bcom.solar.gprc.CameraParametersStereo.intrinsics1)
 }
-inline void Message::set_message(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
+inline ::com::bcom::solar::gprc::Matrix3x3* CameraParametersStereo::release_intrinsics1() {
   
-  message_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(value), GetArena());
-  // @@protoc_insertion_point(field_set_char:com.bcom.solar.gprc.Message.message)
+  ::com::bcom::solar::gprc::Matrix3x3* temp = intrinsics1_;
+  intrinsics1_ = nullptr;
+  if (GetArena() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+  return temp;
 }
-inline void Message::set_message(const char* value,
-    size_t size) {
+inline ::com::bcom::solar::gprc::Matrix3x3* CameraParametersStereo::unsafe_arena_release_intrinsics1() {
+  // @@protoc_insertion_point(field_release:com.bcom.solar.gprc.CameraParametersStereo.intrinsics1)
   
-  message_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:com.bcom.solar.gprc.Message.message)
+  ::com::bcom::solar::gprc::Matrix3x3* temp = intrinsics1_;
+  intrinsics1_ = nullptr;
+  return temp;
 }
-inline std::string* Message::_internal_mutable_message() {
+inline ::com::bcom::solar::gprc::Matrix3x3* CameraParametersStereo::_internal_mutable_intrinsics1() {
   
-  return message_.Mutable(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArena());
+  if (intrinsics1_ == nullptr) {
+    auto* p = CreateMaybeMessage<::com::bcom::solar::gprc::Matrix3x3>(GetArena());
+    intrinsics1_ = p;
+  }
+  return intrinsics1_;
 }
-inline std::string* Message::release_message() {
-  // @@protoc_insertion_point(field_release:com.bcom.solar.gprc.Message.message)
-  return message_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline ::com::bcom::solar::gprc::Matrix3x3* CameraParametersStereo::mutable_intrinsics1() {
+  // @@protoc_insertion_point(field_mutable:com.bcom.solar.gprc.CameraParametersStereo.intrinsics1)
+  return _internal_mutable_intrinsics1();
 }
-inline void Message::set_allocated_message(std::string* message) {
-  if (message != nullptr) {
+inline void CameraParametersStereo::set_allocated_intrinsics1(::com::bcom::solar::gprc::Matrix3x3* intrinsics1) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  if (message_arena == nullptr) {
+    delete intrinsics1_;
+  }
+  if (intrinsics1) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(intrinsics1);
+    if (message_arena != submessage_arena) {
+      intrinsics1 = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, intrinsics1, submessage_arena);
+    }
     
   } else {
     
   }
-  message_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), message,
-      GetArena());
-  // @@protoc_insertion_point(field_set_allocated:com.bcom.solar.gprc.Message.message)
+  intrinsics1_ = intrinsics1;
+  // @@protoc_insertion_point(field_set_allocated:com.bcom.solar.gprc.CameraParametersStereo.intrinsics1)
 }
 
-// -------------------------------------------------------------------
-
-// CameraParameters
-
-// string client_uuid = 1;
-inline void CameraParameters::clear_client_uuid() {
-  client_uuid_.ClearToEmpty();
-}
-inline const std::string& CameraParameters::client_uuid() const {
-  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.CameraParameters.client_uuid)
-  return _internal_client_uuid();
+// .com.bcom.solar.gprc.CameraDistortion distortion1 = 8;
+inline bool CameraParametersStereo::_internal_has_distortion1() const {
+  return this != internal_default_instance() && distortion1_ != nullptr;
 }
-inline void CameraParameters::set_client_uuid(const std::string& value) {
-  _internal_set_client_uuid(value);
-  // @@protoc_insertion_point(field_set:com.bcom.solar.gprc.CameraParameters.client_uuid)
+inline bool CameraParametersStereo::has_distortion1() const {
+  return _internal_has_distortion1();
 }
-inline std::string* CameraParameters::mutable_client_uuid() {
-  // @@protoc_insertion_point(field_mutable:com.bcom.solar.gprc.CameraParameters.client_uuid)
-  return _internal_mutable_client_uuid();
+inline void CameraParametersStereo::clear_distortion1() {
+  if (GetArena() == nullptr && distortion1_ != nullptr) {
+    delete distortion1_;
+  }
+  distortion1_ = nullptr;
 }
-inline const std::string& CameraParameters::_internal_client_uuid() const {
-  return client_uuid_.Get();
+inline const ::com::bcom::solar::gprc::CameraDistortion& CameraParametersStereo::_internal_distortion1() const {
+  const ::com::bcom::solar::gprc::CameraDistortion* p = distortion1_;
+  return p != nullptr ? *p : reinterpret_cast<const ::com::bcom::solar::gprc::CameraDistortion&>(
+      ::com::bcom::solar::gprc::_CameraDistortion_default_instance_);
 }
-inline void CameraParameters::_internal_set_client_uuid(const std::string& value) {
-  
-  client_uuid_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArena());
+inline const ::com::bcom::solar::gprc::CameraDistortion& CameraParametersStereo::distortion1() const {
+  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.CameraParametersStereo.distortion1)
+  return _internal_distortion1();
 }
-inline void CameraParameters::set_client_uuid(std::string&& value) {
-  
-  client_uuid_.Set(
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:com.bcom.solar.gprc.CameraParameters.client_uuid)
+inline void CameraParametersStereo::unsafe_arena_set_allocated_distortion1(
+    ::com::bcom::solar::gprc::CameraDistortion* distortion1) {
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(distortion1_);
+  }
+  distortion1_ = distortion1;
+  if (distortion1) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:com.bcom.solar.gprc.CameraParametersStereo.distortion1)
 }
-inline void CameraParameters::set_client_uuid(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
+inline ::com::bcom::solar::gprc::CameraDistortion* CameraParametersStereo::release_distortion1() {
   
-  client_uuid_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(value), GetArena());
-  // @@protoc_insertion_point(field_set_char:com.bcom.solar.gprc.CameraParameters.client_uuid)
+  ::com::bcom::solar::gprc::CameraDistortion* temp = distortion1_;
+  distortion1_ = nullptr;
+  if (GetArena() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+  return temp;
 }
-inline void CameraParameters::set_client_uuid(const char* value,
-    size_t size) {
+inline ::com::bcom::solar::gprc::CameraDistortion* CameraParametersStereo::unsafe_arena_release_distortion1() {
+  // @@protoc_insertion_point(field_release:com.bcom.solar.gprc.CameraParametersStereo.distortion1)
   
-  client_uuid_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:com.bcom.solar.gprc.CameraParameters.client_uuid)
+  ::com::bcom::solar::gprc::CameraDistortion* temp = distortion1_;
+  distortion1_ = nullptr;
+  return temp;
 }
-inline std::string* CameraParameters::_internal_mutable_client_uuid() {
+inline ::com::bcom::solar::gprc::CameraDistortion* CameraParametersStereo::_internal_mutable_distortion1() {
   
-  return client_uuid_.Mutable(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArena());
+  if (distortion1_ == nullptr) {
+    auto* p = CreateMaybeMessage<::com::bcom::solar::gprc::CameraDistortion>(GetArena());
+    distortion1_ = p;
+  }
+  return distortion1_;
 }
-inline std::string* CameraParameters::release_client_uuid() {
-  // @@protoc_insertion_point(field_release:com.bcom.solar.gprc.CameraParameters.client_uuid)
-  return client_uuid_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline ::com::bcom::solar::gprc::CameraDistortion* CameraParametersStereo::mutable_distortion1() {
+  // @@protoc_insertion_point(field_mutable:com.bcom.solar.gprc.CameraParametersStereo.distortion1)
+  return _internal_mutable_distortion1();
 }
-inline void CameraParameters::set_allocated_client_uuid(std::string* client_uuid) {
-  if (client_uuid != nullptr) {
+inline void CameraParametersStereo::set_allocated_distortion1(::com::bcom::solar::gprc::CameraDistortion* distortion1) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  if (message_arena == nullptr) {
+    delete distortion1_;
+  }
+  if (distortion1) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(distortion1);
+    if (message_arena != submessage_arena) {
+      distortion1 = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, distortion1, submessage_arena);
+    }
     
   } else {
     
   }
-  client_uuid_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), client_uuid,
-      GetArena());
-  // @@protoc_insertion_point(field_set_allocated:com.bcom.solar.gprc.CameraParameters.client_uuid)
+  distortion1_ = distortion1;
+  // @@protoc_insertion_point(field_set_allocated:com.bcom.solar.gprc.CameraParametersStereo.distortion1)
 }
 
-// string name = 2;
-inline void CameraParameters::clear_name() {
-  name_.ClearToEmpty();
+// string name2 = 9;
+inline void CameraParametersStereo::clear_name2() {
+  name2_.ClearToEmpty();
 }
-inline const std::string& CameraParameters::name() const {
-  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.CameraParameters.name)
-  return _internal_name();
+inline const std::string& CameraParametersStereo::name2() const {
+  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.CameraParametersStereo.name2)
+  return _internal_name2();
 }
-inline void CameraParameters::set_name(const std::string& value) {
-  _internal_set_name(value);
-  // @@protoc_insertion_point(field_set:com.bcom.solar.gprc.CameraParameters.name)
+inline void CameraParametersStereo::set_name2(const std::string& value) {
+  _internal_set_name2(value);
+  // @@protoc_insertion_point(field_set:com.bcom.solar.gprc.CameraParametersStereo.name2)
 }
-inline std::string* CameraParameters::mutable_name() {
-  // @@protoc_insertion_point(field_mutable:com.bcom.solar.gprc.CameraParameters.name)
-  return _internal_mutable_name();
+inline std::string* CameraParametersStereo::mutable_name2() {
+  // @@protoc_insertion_point(field_mutable:com.bcom.solar.gprc.CameraParametersStereo.name2)
+  return _internal_mutable_name2();
 }
-inline const std::string& CameraParameters::_internal_name() const {
-  return name_.Get();
+inline const std::string& CameraParametersStereo::_internal_name2() const {
+  return name2_.Get();
 }
-inline void CameraParameters::_internal_set_name(const std::string& value) {
+inline void CameraParametersStereo::_internal_set_name2(const std::string& value) {
   
-  name_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArena());
+  name2_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArena());
 }
-inline void CameraParameters::set_name(std::string&& value) {
+inline void CameraParametersStereo::set_name2(std::string&& value) {
   
-  name_.Set(
+  name2_.Set(
     ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:com.bcom.solar.gprc.CameraParameters.name)
+  // @@protoc_insertion_point(field_set_rvalue:com.bcom.solar.gprc.CameraParametersStereo.name2)
 }
-inline void CameraParameters::set_name(const char* value) {
+inline void CameraParametersStereo::set_name2(const char* value) {
   GOOGLE_DCHECK(value != nullptr);
   
-  name_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(value), GetArena());
-  // @@protoc_insertion_point(field_set_char:com.bcom.solar.gprc.CameraParameters.name)
+  name2_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(value), GetArena());
+  // @@protoc_insertion_point(field_set_char:com.bcom.solar.gprc.CameraParametersStereo.name2)
 }
-inline void CameraParameters::set_name(const char* value,
+inline void CameraParametersStereo::set_name2(const char* value,
     size_t size) {
   
-  name_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(
+  name2_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(
       reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:com.bcom.solar.gprc.CameraParameters.name)
+  // @@protoc_insertion_point(field_set_pointer:com.bcom.solar.gprc.CameraParametersStereo.name2)
 }
-inline std::string* CameraParameters::_internal_mutable_name() {
+inline std::string* CameraParametersStereo::_internal_mutable_name2() {
   
-  return name_.Mutable(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArena());
+  return name2_.Mutable(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArena());
 }
-inline std::string* CameraParameters::release_name() {
-  // @@protoc_insertion_point(field_release:com.bcom.solar.gprc.CameraParameters.name)
-  return name_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline std::string* CameraParametersStereo::release_name2() {
+  // @@protoc_insertion_point(field_release:com.bcom.solar.gprc.CameraParametersStereo.name2)
+  return name2_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
 }
-inline void CameraParameters::set_allocated_name(std::string* name) {
-  if (name != nullptr) {
+inline void CameraParametersStereo::set_allocated_name2(std::string* name2) {
+  if (name2 != nullptr) {
     
   } else {
     
   }
-  name_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), name,
+  name2_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), name2,
       GetArena());
-  // @@protoc_insertion_point(field_set_allocated:com.bcom.solar.gprc.CameraParameters.name)
+  // @@protoc_insertion_point(field_set_allocated:com.bcom.solar.gprc.CameraParametersStereo.name2)
 }
 
-// uint32 id = 3;
-inline void CameraParameters::clear_id() {
-  id_ = 0u;
+// uint32 id2 = 10;
+inline void CameraParametersStereo::clear_id2() {
+  id2_ = 0u;
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint32 CameraParameters::_internal_id() const {
-  return id_;
+inline ::PROTOBUF_NAMESPACE_ID::uint32 CameraParametersStereo::_internal_id2() const {
+  return id2_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint32 CameraParameters::id() const {
-  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.CameraParameters.id)
-  return _internal_id();
+inline ::PROTOBUF_NAMESPACE_ID::uint32 CameraParametersStereo::id2() const {
+  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.CameraParametersStereo.id2)
+  return _internal_id2();
 }
-inline void CameraParameters::_internal_set_id(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+inline void CameraParametersStereo::_internal_set_id2(::PROTOBUF_NAMESPACE_ID::uint32 value) {
   
-  id_ = value;
+  id2_ = value;
 }
-inline void CameraParameters::set_id(::PROTOBUF_NAMESPACE_ID::uint32 value) {
-  _internal_set_id(value);
-  // @@protoc_insertion_point(field_set:com.bcom.solar.gprc.CameraParameters.id)
+inline void CameraParametersStereo::set_id2(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  _internal_set_id2(value);
+  // @@protoc_insertion_point(field_set:com.bcom.solar.gprc.CameraParametersStereo.id2)
 }
 
-// .com.bcom.solar.gprc.CameraType camera_type = 4;
-inline void CameraParameters::clear_camera_type() {
-  camera_type_ = 0;
+// .com.bcom.solar.gprc.CameraType camera_type2 = 11;
+inline void CameraParametersStereo::clear_camera_type2() {
+  camera_type2_ = 0;
 }
-inline ::com::bcom::solar::gprc::CameraType CameraParameters::_internal_camera_type() const {
-  return static_cast< ::com::bcom::solar::gprc::CameraType >(camera_type_);
+inline ::com::bcom::solar::gprc::CameraType CameraParametersStereo::_internal_camera_type2() const {
+  return static_cast< ::com::bcom::solar::gprc::CameraType >(camera_type2_);
 }
-inline ::com::bcom::solar::gprc::CameraType CameraParameters::camera_type() const {
-  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.CameraParameters.camera_type)
-  return _internal_camera_type();
+inline ::com::bcom::solar::gprc::CameraType CameraParametersStereo::camera_type2() const {
+  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.CameraParametersStereo.camera_type2)
+  return _internal_camera_type2();
 }
-inline void CameraParameters::_internal_set_camera_type(::com::bcom::solar::gprc::CameraType value) {
+inline void CameraParametersStereo::_internal_set_camera_type2(::com::bcom::solar::gprc::CameraType value) {
   
-  camera_type_ = value;
+  camera_type2_ = value;
 }
-inline void CameraParameters::set_camera_type(::com::bcom::solar::gprc::CameraType value) {
-  _internal_set_camera_type(value);
-  // @@protoc_insertion_point(field_set:com.bcom.solar.gprc.CameraParameters.camera_type)
+inline void CameraParametersStereo::set_camera_type2(::com::bcom::solar::gprc::CameraType value) {
+  _internal_set_camera_type2(value);
+  // @@protoc_insertion_point(field_set:com.bcom.solar.gprc.CameraParametersStereo.camera_type2)
 }
 
-// uint32 width = 5;
-inline void CameraParameters::clear_width() {
-  width_ = 0u;
+// uint32 width2 = 12;
+inline void CameraParametersStereo::clear_width2() {
+  width2_ = 0u;
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint32 CameraParameters::_internal_width() const {
-  return width_;
+inline ::PROTOBUF_NAMESPACE_ID::uint32 CameraParametersStereo::_internal_width2() const {
+  return width2_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint32 CameraParameters::width() const {
-  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.CameraParameters.width)
-  return _internal_width();
+inline ::PROTOBUF_NAMESPACE_ID::uint32 CameraParametersStereo::width2() const {
+  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.CameraParametersStereo.width2)
+  return _internal_width2();
 }
-inline void CameraParameters::_internal_set_width(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+inline void CameraParametersStereo::_internal_set_width2(::PROTOBUF_NAMESPACE_ID::uint32 value) {
   
-  width_ = value;
+  width2_ = value;
 }
-inline void CameraParameters::set_width(::PROTOBUF_NAMESPACE_ID::uint32 value) {
-  _internal_set_width(value);
-  // @@protoc_insertion_point(field_set:com.bcom.solar.gprc.CameraParameters.width)
+inline void CameraParametersStereo::set_width2(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  _internal_set_width2(value);
+  // @@protoc_insertion_point(field_set:com.bcom.solar.gprc.CameraParametersStereo.width2)
 }
 
-// uint32 height = 6;
-inline void CameraParameters::clear_height() {
-  height_ = 0u;
+// uint32 height2 = 13;
+inline void CameraParametersStereo::clear_height2() {
+  height2_ = 0u;
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint32 CameraParameters::_internal_height() const {
-  return height_;
+inline ::PROTOBUF_NAMESPACE_ID::uint32 CameraParametersStereo::_internal_height2() const {
+  return height2_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint32 CameraParameters::height() const {
-  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.CameraParameters.height)
-  return _internal_height();
+inline ::PROTOBUF_NAMESPACE_ID::uint32 CameraParametersStereo::height2() const {
+  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.CameraParametersStereo.height2)
+  return _internal_height2();
 }
-inline void CameraParameters::_internal_set_height(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+inline void CameraParametersStereo::_internal_set_height2(::PROTOBUF_NAMESPACE_ID::uint32 value) {
   
-  height_ = value;
+  height2_ = value;
 }
-inline void CameraParameters::set_height(::PROTOBUF_NAMESPACE_ID::uint32 value) {
-  _internal_set_height(value);
-  // @@protoc_insertion_point(field_set:com.bcom.solar.gprc.CameraParameters.height)
+inline void CameraParametersStereo::set_height2(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  _internal_set_height2(value);
+  // @@protoc_insertion_point(field_set:com.bcom.solar.gprc.CameraParametersStereo.height2)
 }
 
-// .com.bcom.solar.gprc.Matrix3x3 intrinsics = 7;
-inline bool CameraParameters::_internal_has_intrinsics() const {
-  return this != internal_default_instance() && intrinsics_ != nullptr;
+// .com.bcom.solar.gprc.Matrix3x3 intrinsics2 = 14;
+inline bool CameraParametersStereo::_internal_has_intrinsics2() const {
+  return this != internal_default_instance() && intrinsics2_ != nullptr;
 }
-inline bool CameraParameters::has_intrinsics() const {
-  return _internal_has_intrinsics();
+inline bool CameraParametersStereo::has_intrinsics2() const {
+  return _internal_has_intrinsics2();
 }
-inline void CameraParameters::clear_intrinsics() {
-  if (GetArena() == nullptr && intrinsics_ != nullptr) {
-    delete intrinsics_;
+inline void CameraParametersStereo::clear_intrinsics2() {
+  if (GetArena() == nullptr && intrinsics2_ != nullptr) {
+    delete intrinsics2_;
   }
-  intrinsics_ = nullptr;
+  intrinsics2_ = nullptr;
 }
-inline const ::com::bcom::solar::gprc::Matrix3x3& CameraParameters::_internal_intrinsics() const {
-  const ::com::bcom::solar::gprc::Matrix3x3* p = intrinsics_;
+inline const ::com::bcom::solar::gprc::Matrix3x3& CameraParametersStereo::_internal_intrinsics2() const {
+  const ::com::bcom::solar::gprc::Matrix3x3* p = intrinsics2_;
   return p != nullptr ? *p : reinterpret_cast<const ::com::bcom::solar::gprc::Matrix3x3&>(
       ::com::bcom::solar::gprc::_Matrix3x3_default_instance_);
 }
-inline const ::com::bcom::solar::gprc::Matrix3x3& CameraParameters::intrinsics() const {
-  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.CameraParameters.intrinsics)
-  return _internal_intrinsics();
+inline const ::com::bcom::solar::gprc::Matrix3x3& CameraParametersStereo::intrinsics2() const {
+  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.CameraParametersStereo.intrinsics2)
+  return _internal_intrinsics2();
 }
-inline void CameraParameters::unsafe_arena_set_allocated_intrinsics(
-    ::com::bcom::solar::gprc::Matrix3x3* intrinsics) {
+inline void CameraParametersStereo::unsafe_arena_set_allocated_intrinsics2(
+    ::com::bcom::solar::gprc::Matrix3x3* intrinsics2) {
   if (GetArena() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(intrinsics_);
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(intrinsics2_);
   }
-  intrinsics_ = intrinsics;
-  if (intrinsics) {
+  intrinsics2_ = intrinsics2;
+  if (intrinsics2) {
     
   } else {
     
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:com.bcom.solar.gprc.CameraParameters.intrinsics)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:com.bcom.solar.gprc.CameraParametersStereo.intrinsics2)
 }
-inline ::com::bcom::solar::gprc::Matrix3x3* CameraParameters::release_intrinsics() {
+inline ::com::bcom::solar::gprc::Matrix3x3* CameraParametersStereo::release_intrinsics2() {
   
-  ::com::bcom::solar::gprc::Matrix3x3* temp = intrinsics_;
-  intrinsics_ = nullptr;
+  ::com::bcom::solar::gprc::Matrix3x3* temp = intrinsics2_;
+  intrinsics2_ = nullptr;
   if (GetArena() != nullptr) {
     temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
   }
   return temp;
 }
-inline ::com::bcom::solar::gprc::Matrix3x3* CameraParameters::unsafe_arena_release_intrinsics() {
-  // @@protoc_insertion_point(field_release:com.bcom.solar.gprc.CameraParameters.intrinsics)
+inline ::com::bcom::solar::gprc::Matrix3x3* CameraParametersStereo::unsafe_arena_release_intrinsics2() {
+  // @@protoc_insertion_point(field_release:com.bcom.solar.gprc.CameraParametersStereo.intrinsics2)
   
-  ::com::bcom::solar::gprc::Matrix3x3* temp = intrinsics_;
-  intrinsics_ = nullptr;
+  ::com::bcom::solar::gprc::Matrix3x3* temp = intrinsics2_;
+  intrinsics2_ = nullptr;
   return temp;
 }
-inline ::com::bcom::solar::gprc::Matrix3x3* CameraParameters::_internal_mutable_intrinsics() {
+inline ::com::bcom::solar::gprc::Matrix3x3* CameraParametersStereo::_internal_mutable_intrinsics2() {
   
-  if (intrinsics_ == nullptr) {
+  if (intrinsics2_ == nullptr) {
     auto* p = CreateMaybeMessage<::com::bcom::solar::gprc::Matrix3x3>(GetArena());
-    intrinsics_ = p;
+    intrinsics2_ = p;
   }
-  return intrinsics_;
+  return intrinsics2_;
 }
-inline ::com::bcom::solar::gprc::Matrix3x3* CameraParameters::mutable_intrinsics() {
-  // @@protoc_insertion_point(field_mutable:com.bcom.solar.gprc.CameraParameters.intrinsics)
-  return _internal_mutable_intrinsics();
+inline ::com::bcom::solar::gprc::Matrix3x3* CameraParametersStereo::mutable_intrinsics2() {
+  // @@protoc_insertion_point(field_mutable:com.bcom.solar.gprc.CameraParametersStereo.intrinsics2)
+  return _internal_mutable_intrinsics2();
 }
-inline void CameraParameters::set_allocated_intrinsics(::com::bcom::solar::gprc::Matrix3x3* intrinsics) {
+inline void CameraParametersStereo::set_allocated_intrinsics2(::com::bcom::solar::gprc::Matrix3x3* intrinsics2) {
   ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
   if (message_arena == nullptr) {
-    delete intrinsics_;
+    delete intrinsics2_;
   }
-  if (intrinsics) {
+  if (intrinsics2) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(intrinsics);
+      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(intrinsics2);
     if (message_arena != submessage_arena) {
-      intrinsics = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, intrinsics, submessage_arena);
+      intrinsics2 = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, intrinsics2, submessage_arena);
     }
     
   } else {
     
   }
-  intrinsics_ = intrinsics;
-  // @@protoc_insertion_point(field_set_allocated:com.bcom.solar.gprc.CameraParameters.intrinsics)
+  intrinsics2_ = intrinsics2;
+  // @@protoc_insertion_point(field_set_allocated:com.bcom.solar.gprc.CameraParametersStereo.intrinsics2)
 }
 
-// .com.bcom.solar.gprc.CameraDistortion distortion = 8;
-inline bool CameraParameters::_internal_has_distortion() const {
-  return this != internal_default_instance() && distortion_ != nullptr;
+// .com.bcom.solar.gprc.CameraDistortion distortion2 = 15;
+inline bool CameraParametersStereo::_internal_has_distortion2() const {
+  return this != internal_default_instance() && distortion2_ != nullptr;
 }
-inline bool CameraParameters::has_distortion() const {
-  return _internal_has_distortion();
+inline bool CameraParametersStereo::has_distortion2() const {
+  return _internal_has_distortion2();
 }
-inline void CameraParameters::clear_distortion() {
-  if (GetArena() == nullptr && distortion_ != nullptr) {
-    delete distortion_;
+inline void CameraParametersStereo::clear_distortion2() {
+  if (GetArena() == nullptr && distortion2_ != nullptr) {
+    delete distortion2_;
   }
-  distortion_ = nullptr;
+  distortion2_ = nullptr;
 }
-inline const ::com::bcom::solar::gprc::CameraDistortion& CameraParameters::_internal_distortion() const {
-  const ::com::bcom::solar::gprc::CameraDistortion* p = distortion_;
+inline const ::com::bcom::solar::gprc::CameraDistortion& CameraParametersStereo::_internal_distortion2() const {
+  const ::com::bcom::solar::gprc::CameraDistortion* p = distortion2_;
   return p != nullptr ? *p : reinterpret_cast<const ::com::bcom::solar::gprc::CameraDistortion&>(
       ::com::bcom::solar::gprc::_CameraDistortion_default_instance_);
 }
-inline const ::com::bcom::solar::gprc::CameraDistortion& CameraParameters::distortion() const {
-  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.CameraParameters.distortion)
-  return _internal_distortion();
+inline const ::com::bcom::solar::gprc::CameraDistortion& CameraParametersStereo::distortion2() const {
+  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.CameraParametersStereo.distortion2)
+  return _internal_distortion2();
 }
-inline void CameraParameters::unsafe_arena_set_allocated_distortion(
-    ::com::bcom::solar::gprc::CameraDistortion* distortion) {
+inline void CameraParametersStereo::unsafe_arena_set_allocated_distortion2(
+    ::com::bcom::solar::gprc::CameraDistortion* distortion2) {
   if (GetArena() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(distortion_);
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(distortion2_);
   }
-  distortion_ = distortion;
-  if (distortion) {
+  distortion2_ = distortion2;
+  if (distortion2) {
     
   } else {
     
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:com.bcom.solar.gprc.CameraParameters.distortion)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:com.bcom.solar.gprc.CameraParametersStereo.distortion2)
 }
-inline ::com::bcom::solar::gprc::CameraDistortion* CameraParameters::release_distortion() {
+inline ::com::bcom::solar::gprc::CameraDistortion* CameraParametersStereo::release_distortion2() {
   
-  ::com::bcom::solar::gprc::CameraDistortion* temp = distortion_;
-  distortion_ = nullptr;
+  ::com::bcom::solar::gprc::CameraDistortion* temp = distortion2_;
+  distortion2_ = nullptr;
   if (GetArena() != nullptr) {
     temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
   }
   return temp;
 }
-inline ::com::bcom::solar::gprc::CameraDistortion* CameraParameters::unsafe_arena_release_distortion() {
-  // @@protoc_insertion_point(field_release:com.bcom.solar.gprc.CameraParameters.distortion)
+inline ::com::bcom::solar::gprc::CameraDistortion* CameraParametersStereo::unsafe_arena_release_distortion2() {
+  // @@protoc_insertion_point(field_release:com.bcom.solar.gprc.CameraParametersStereo.distortion2)
   
-  ::com::bcom::solar::gprc::CameraDistortion* temp = distortion_;
-  distortion_ = nullptr;
+  ::com::bcom::solar::gprc::CameraDistortion* temp = distortion2_;
+  distortion2_ = nullptr;
   return temp;
 }
-inline ::com::bcom::solar::gprc::CameraDistortion* CameraParameters::_internal_mutable_distortion() {
+inline ::com::bcom::solar::gprc::CameraDistortion* CameraParametersStereo::_internal_mutable_distortion2() {
   
-  if (distortion_ == nullptr) {
+  if (distortion2_ == nullptr) {
     auto* p = CreateMaybeMessage<::com::bcom::solar::gprc::CameraDistortion>(GetArena());
-    distortion_ = p;
+    distortion2_ = p;
   }
-  return distortion_;
+  return distortion2_;
 }
-inline ::com::bcom::solar::gprc::CameraDistortion* CameraParameters::mutable_distortion() {
-  // @@protoc_insertion_point(field_mutable:com.bcom.solar.gprc.CameraParameters.distortion)
-  return _internal_mutable_distortion();
+inline ::com::bcom::solar::gprc::CameraDistortion* CameraParametersStereo::mutable_distortion2() {
+  // @@protoc_insertion_point(field_mutable:com.bcom.solar.gprc.CameraParametersStereo.distortion2)
+  return _internal_mutable_distortion2();
 }
-inline void CameraParameters::set_allocated_distortion(::com::bcom::solar::gprc::CameraDistortion* distortion) {
+inline void CameraParametersStereo::set_allocated_distortion2(::com::bcom::solar::gprc::CameraDistortion* distortion2) {
   ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
   if (message_arena == nullptr) {
-    delete distortion_;
+    delete distortion2_;
   }
-  if (distortion) {
+  if (distortion2) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(distortion);
+      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(distortion2);
     if (message_arena != submessage_arena) {
-      distortion = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, distortion, submessage_arena);
+      distortion2 = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, distortion2, submessage_arena);
     }
     
   } else {
     
   }
-  distortion_ = distortion;
-  // @@protoc_insertion_point(field_set_allocated:com.bcom.solar.gprc.CameraParameters.distortion)
+  distortion2_ = distortion2;
+  // @@protoc_insertion_point(field_set_allocated:com.bcom.solar.gprc.CameraParametersStereo.distortion2)
 }
 
-// -------------------------------------------------------------------
-
-// CameraParametersStereo
-
-// string client_uuid = 1;
-inline void CameraParametersStereo::clear_client_uuid() {
-  client_uuid_.ClearToEmpty();
+// .com.bcom.solar.gprc.ImageRotation rotation1 = 16;
+inline void CameraParametersStereo::clear_rotation1() {
+  rotation1_ = 0;
 }
-inline const std::string& CameraParametersStereo::client_uuid() const {
-  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.CameraParametersStereo.client_uuid)
-  return _internal_client_uuid();
+inline ::com::bcom::solar::gprc::ImageRotation CameraParametersStereo::_internal_rotation1() const {
+  return static_cast< ::com::bcom::solar::gprc::ImageRotation >(rotation1_);
 }
-inline void CameraParametersStereo::set_client_uuid(const std::string& value) {
-  _internal_set_client_uuid(value);
-  // @@protoc_insertion_point(field_set:com.bcom.solar.gprc.CameraParametersStereo.client_uuid)
+inline ::com::bcom::solar::gprc::ImageRotation CameraParametersStereo::rotation1() const {
+  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.CameraParametersStereo.rotation1)
+  return _internal_rotation1();
 }
-inline std::string* CameraParametersStereo::mutable_client_uuid() {
-  // @@protoc_insertion_point(field_mutable:com.bcom.solar.gprc.CameraParametersStereo.client_uuid)
-  return _internal_mutable_client_uuid();
+inline void CameraParametersStereo::_internal_set_rotation1(::com::bcom::solar::gprc::ImageRotation value) {
+  
+  rotation1_ = value;
 }
-inline const std::string& CameraParametersStereo::_internal_client_uuid() const {
-  return client_uuid_.Get();
+inline void CameraParametersStereo::set_rotation1(::com::bcom::solar::gprc::ImageRotation value) {
+  _internal_set_rotation1(value);
+  // @@protoc_insertion_point(field_set:com.bcom.solar.gprc.CameraParametersStereo.rotation1)
 }
-inline void CameraParametersStereo::_internal_set_client_uuid(const std::string& value) {
-  
-  client_uuid_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArena());
+
+// .com.bcom.solar.gprc.ImageRotation rotation2 = 17;
+inline void CameraParametersStereo::clear_rotation2() {
+  rotation2_ = 0;
 }
-inline void CameraParametersStereo::set_client_uuid(std::string&& value) {
-  
-  client_uuid_.Set(
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:com.bcom.solar.gprc.CameraParametersStereo.client_uuid)
+inline ::com::bcom::solar::gprc::ImageRotation CameraParametersStereo::_internal_rotation2() const {
+  return static_cast< ::com::bcom::solar::gprc::ImageRotation >(rotation2_);
 }
-inline void CameraParametersStereo::set_client_uuid(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  client_uuid_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(value), GetArena());
-  // @@protoc_insertion_point(field_set_char:com.bcom.solar.gprc.CameraParametersStereo.client_uuid)
+inline ::com::bcom::solar::gprc::ImageRotation CameraParametersStereo::rotation2() const {
+  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.CameraParametersStereo.rotation2)
+  return _internal_rotation2();
 }
-inline void CameraParametersStereo::set_client_uuid(const char* value,
-    size_t size) {
+inline void CameraParametersStereo::_internal_set_rotation2(::com::bcom::solar::gprc::ImageRotation value) {
   
-  client_uuid_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:com.bcom.solar.gprc.CameraParametersStereo.client_uuid)
+  rotation2_ = value;
 }
-inline std::string* CameraParametersStereo::_internal_mutable_client_uuid() {
-  
-  return client_uuid_.Mutable(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArena());
+inline void CameraParametersStereo::set_rotation2(::com::bcom::solar::gprc::ImageRotation value) {
+  _internal_set_rotation2(value);
+  // @@protoc_insertion_point(field_set:com.bcom.solar.gprc.CameraParametersStereo.rotation2)
 }
-inline std::string* CameraParametersStereo::release_client_uuid() {
-  // @@protoc_insertion_point(field_release:com.bcom.solar.gprc.CameraParametersStereo.client_uuid)
-  return client_uuid_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+
+// -------------------------------------------------------------------
+
+// CameraDistortion
+
+// float K_1 = 1;
+inline void CameraDistortion::clear_k_1() {
+  k_1_ = 0;
 }
-inline void CameraParametersStereo::set_allocated_client_uuid(std::string* client_uuid) {
-  if (client_uuid != nullptr) {
-    
-  } else {
-    
-  }
-  client_uuid_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), client_uuid,
-      GetArena());
-  // @@protoc_insertion_point(field_set_allocated:com.bcom.solar.gprc.CameraParametersStereo.client_uuid)
+inline float CameraDistortion::_internal_k_1() const {
+  return k_1_;
 }
-
-// string name1 = 2;
-inline void CameraParametersStereo::clear_name1() {
-  name1_.ClearToEmpty();
+inline float CameraDistortion::k_1() const {
+  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.CameraDistortion.K_1)
+  return _internal_k_1();
 }
-inline const std::string& CameraParametersStereo::name1() const {
-  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.CameraParametersStereo.name1)
-  return _internal_name1();
+inline void CameraDistortion::_internal_set_k_1(float value) {
+  
+  k_1_ = value;
 }
-inline void CameraParametersStereo::set_name1(const std::string& value) {
-  _internal_set_name1(value);
-  // @@protoc_insertion_point(field_set:com.bcom.solar.gprc.CameraParametersStereo.name1)
+inline void CameraDistortion::set_k_1(float value) {
+  _internal_set_k_1(value);
+  // @@protoc_insertion_point(field_set:com.bcom.solar.gprc.CameraDistortion.K_1)
 }
-inline std::string* CameraParametersStereo::mutable_name1() {
-  // @@protoc_insertion_point(field_mutable:com.bcom.solar.gprc.CameraParametersStereo.name1)
-  return _internal_mutable_name1();
+
+// float K_2 = 2;
+inline void CameraDistortion::clear_k_2() {
+  k_2_ = 0;
 }
-inline const std::string& CameraParametersStereo::_internal_name1() const {
-  return name1_.Get();
+inline float CameraDistortion::_internal_k_2() const {
+  return k_2_;
 }
-inline void CameraParametersStereo::_internal_set_name1(const std::string& value) {
-  
-  name1_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArena());
+inline float CameraDistortion::k_2() const {
+  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.CameraDistortion.K_2)
+  return _internal_k_2();
 }
-inline void CameraParametersStereo::set_name1(std::string&& value) {
+inline void CameraDistortion::_internal_set_k_2(float value) {
   
-  name1_.Set(
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:com.bcom.solar.gprc.CameraParametersStereo.name1)
+  k_2_ = value;
 }
-inline void CameraParametersStereo::set_name1(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  name1_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(value), GetArena());
-  // @@protoc_insertion_point(field_set_char:com.bcom.solar.gprc.CameraParametersStereo.name1)
+inline void CameraDistortion::set_k_2(float value) {
+  _internal_set_k_2(value);
+  // @@protoc_insertion_point(field_set:com.bcom.solar.gprc.CameraDistortion.K_2)
+}
+
+// float P_1 = 3;
+inline void CameraDistortion::clear_p_1() {
+  p_1_ = 0;
+}
+inline float CameraDistortion::_internal_p_1() const {
+  return p_1_;
 }
-inline void CameraParametersStereo::set_name1(const char* value,
-    size_t size) {
-  
-  name1_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:com.bcom.solar.gprc.CameraParametersStereo.name1)
+inline float CameraDistortion::p_1() const {
+  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.CameraDistortion.P_1)
+  return _internal_p_1();
 }
-inline std::string* CameraParametersStereo::_internal_mutable_name1() {
+inline void CameraDistortion::_internal_set_p_1(float value) {
   
-  return name1_.Mutable(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArena());
-}
-inline std::string* CameraParametersStereo::release_name1() {
-  // @@protoc_insertion_point(field_release:com.bcom.solar.gprc.CameraParametersStereo.name1)
-  return name1_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  p_1_ = value;
 }
-inline void CameraParametersStereo::set_allocated_name1(std::string* name1) {
-  if (name1 != nullptr) {
-    
-  } else {
-    
-  }
-  name1_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), name1,
-      GetArena());
-  // @@protoc_insertion_point(field_set_allocated:com.bcom.solar.gprc.CameraParametersStereo.name1)
+inline void CameraDistortion::set_p_1(float value) {
+  _internal_set_p_1(value);
+  // @@protoc_insertion_point(field_set:com.bcom.solar.gprc.CameraDistortion.P_1)
 }
 
-// uint32 id1 = 3;
-inline void CameraParametersStereo::clear_id1() {
-  id1_ = 0u;
+// float P_2 = 4;
+inline void CameraDistortion::clear_p_2() {
+  p_2_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint32 CameraParametersStereo::_internal_id1() const {
-  return id1_;
+inline float CameraDistortion::_internal_p_2() const {
+  return p_2_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint32 CameraParametersStereo::id1() const {
-  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.CameraParametersStereo.id1)
-  return _internal_id1();
+inline float CameraDistortion::p_2() const {
+  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.CameraDistortion.P_2)
+  return _internal_p_2();
 }
-inline void CameraParametersStereo::_internal_set_id1(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+inline void CameraDistortion::_internal_set_p_2(float value) {
   
-  id1_ = value;
+  p_2_ = value;
 }
-inline void CameraParametersStereo::set_id1(::PROTOBUF_NAMESPACE_ID::uint32 value) {
-  _internal_set_id1(value);
-  // @@protoc_insertion_point(field_set:com.bcom.solar.gprc.CameraParametersStereo.id1)
+inline void CameraDistortion::set_p_2(float value) {
+  _internal_set_p_2(value);
+  // @@protoc_insertion_point(field_set:com.bcom.solar.gprc.CameraDistortion.P_2)
 }
 
-// .com.bcom.solar.gprc.CameraType camera_type1 = 4;
-inline void CameraParametersStereo::clear_camera_type1() {
-  camera_type1_ = 0;
+// float K_3 = 5;
+inline void CameraDistortion::clear_k_3() {
+  k_3_ = 0;
 }
-inline ::com::bcom::solar::gprc::CameraType CameraParametersStereo::_internal_camera_type1() const {
-  return static_cast< ::com::bcom::solar::gprc::CameraType >(camera_type1_);
+inline float CameraDistortion::_internal_k_3() const {
+  return k_3_;
 }
-inline ::com::bcom::solar::gprc::CameraType CameraParametersStereo::camera_type1() const {
-  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.CameraParametersStereo.camera_type1)
-  return _internal_camera_type1();
+inline float CameraDistortion::k_3() const {
+  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.CameraDistortion.K_3)
+  return _internal_k_3();
 }
-inline void CameraParametersStereo::_internal_set_camera_type1(::com::bcom::solar::gprc::CameraType value) {
+inline void CameraDistortion::_internal_set_k_3(float value) {
   
-  camera_type1_ = value;
+  k_3_ = value;
 }
-inline void CameraParametersStereo::set_camera_type1(::com::bcom::solar::gprc::CameraType value) {
-  _internal_set_camera_type1(value);
-  // @@protoc_insertion_point(field_set:com.bcom.solar.gprc.CameraParametersStereo.camera_type1)
+inline void CameraDistortion::set_k_3(float value) {
+  _internal_set_k_3(value);
+  // @@protoc_insertion_point(field_set:com.bcom.solar.gprc.CameraDistortion.K_3)
 }
 
-// uint32 width1 = 5;
-inline void CameraParametersStereo::clear_width1() {
-  width1_ = 0u;
+// -------------------------------------------------------------------
+
+// RectificationParameters
+
+// string client_uuid = 1;
+inline void RectificationParameters::clear_client_uuid() {
+  client_uuid_.ClearToEmpty();
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint32 CameraParametersStereo::_internal_width1() const {
-  return width1_;
+inline const std::string& RectificationParameters::client_uuid() const {
+  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.RectificationParameters.client_uuid)
+  return _internal_client_uuid();
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint32 CameraParametersStereo::width1() const {
-  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.CameraParametersStereo.width1)
-  return _internal_width1();
+inline void RectificationParameters::set_client_uuid(const std::string& value) {
+  _internal_set_client_uuid(value);
+  // @@protoc_insertion_point(field_set:com.bcom.solar.gprc.RectificationParameters.client_uuid)
 }
-inline void CameraParametersStereo::_internal_set_width1(::PROTOBUF_NAMESPACE_ID::uint32 value) {
-  
-  width1_ = value;
+inline std::string* RectificationParameters::mutable_client_uuid() {
+  // @@protoc_insertion_point(field_mutable:com.bcom.solar.gprc.RectificationParameters.client_uuid)
+  return _internal_mutable_client_uuid();
 }
-inline void CameraParametersStereo::set_width1(::PROTOBUF_NAMESPACE_ID::uint32 value) {
-  _internal_set_width1(value);
-  // @@protoc_insertion_point(field_set:com.bcom.solar.gprc.CameraParametersStereo.width1)
+inline const std::string& RectificationParameters::_internal_client_uuid() const {
+  return client_uuid_.Get();
 }
-
-// uint32 height1 = 6;
-inline void CameraParametersStereo::clear_height1() {
-  height1_ = 0u;
+inline void RectificationParameters::_internal_set_client_uuid(const std::string& value) {
+  
+  client_uuid_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArena());
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint32 CameraParametersStereo::_internal_height1() const {
-  return height1_;
+inline void RectificationParameters::set_client_uuid(std::string&& value) {
+  
+  client_uuid_.Set(
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::move(value), GetArena());
+  // @@protoc_insertion_point(field_set_rvalue:com.bcom.solar.gprc.RectificationParameters.client_uuid)
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint32 CameraParametersStereo::height1() const {
-  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.CameraParametersStereo.height1)
-  return _internal_height1();
+inline void RectificationParameters::set_client_uuid(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  
+  client_uuid_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(value), GetArena());
+  // @@protoc_insertion_point(field_set_char:com.bcom.solar.gprc.RectificationParameters.client_uuid)
 }
-inline void CameraParametersStereo::_internal_set_height1(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+inline void RectificationParameters::set_client_uuid(const char* value,
+    size_t size) {
   
-  height1_ = value;
+  client_uuid_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArena());
+  // @@protoc_insertion_point(field_set_pointer:com.bcom.solar.gprc.RectificationParameters.client_uuid)
 }
-inline void CameraParametersStereo::set_height1(::PROTOBUF_NAMESPACE_ID::uint32 value) {
-  _internal_set_height1(value);
-  // @@protoc_insertion_point(field_set:com.bcom.solar.gprc.CameraParametersStereo.height1)
+inline std::string* RectificationParameters::_internal_mutable_client_uuid() {
+  
+  return client_uuid_.Mutable(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArena());
+}
+inline std::string* RectificationParameters::release_client_uuid() {
+  // @@protoc_insertion_point(field_release:com.bcom.solar.gprc.RectificationParameters.client_uuid)
+  return client_uuid_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline void RectificationParameters::set_allocated_client_uuid(std::string* client_uuid) {
+  if (client_uuid != nullptr) {
+    
+  } else {
+    
+  }
+  client_uuid_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), client_uuid,
+      GetArena());
+  // @@protoc_insertion_point(field_set_allocated:com.bcom.solar.gprc.RectificationParameters.client_uuid)
 }
 
-// .com.bcom.solar.gprc.Matrix3x3 intrinsics1 = 7;
-inline bool CameraParametersStereo::_internal_has_intrinsics1() const {
-  return this != internal_default_instance() && intrinsics1_ != nullptr;
+// .com.bcom.solar.gprc.Matrix3x3 cam1_rotation = 2;
+inline bool RectificationParameters::_internal_has_cam1_rotation() const {
+  return this != internal_default_instance() && cam1_rotation_ != nullptr;
 }
-inline bool CameraParametersStereo::has_intrinsics1() const {
-  return _internal_has_intrinsics1();
+inline bool RectificationParameters::has_cam1_rotation() const {
+  return _internal_has_cam1_rotation();
 }
-inline void CameraParametersStereo::clear_intrinsics1() {
-  if (GetArena() == nullptr && intrinsics1_ != nullptr) {
-    delete intrinsics1_;
+inline void RectificationParameters::clear_cam1_rotation() {
+  if (GetArena() == nullptr && cam1_rotation_ != nullptr) {
+    delete cam1_rotation_;
   }
-  intrinsics1_ = nullptr;
+  cam1_rotation_ = nullptr;
 }
-inline const ::com::bcom::solar::gprc::Matrix3x3& CameraParametersStereo::_internal_intrinsics1() const {
-  const ::com::bcom::solar::gprc::Matrix3x3* p = intrinsics1_;
+inline const ::com::bcom::solar::gprc::Matrix3x3& RectificationParameters::_internal_cam1_rotation() const {
+  const ::com::bcom::solar::gprc::Matrix3x3* p = cam1_rotation_;
   return p != nullptr ? *p : reinterpret_cast<const ::com::bcom::solar::gprc::Matrix3x3&>(
       ::com::bcom::solar::gprc::_Matrix3x3_default_instance_);
 }
-inline const ::com::bcom::solar::gprc::Matrix3x3& CameraParametersStereo::intrinsics1() const {
-  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.CameraParametersStereo.intrinsics1)
-  return _internal_intrinsics1();
+inline const ::com::bcom::solar::gprc::Matrix3x3& RectificationParameters::cam1_rotation() const {
+  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.RectificationParameters.cam1_rotation)
+  return _internal_cam1_rotation();
 }
-inline void CameraParametersStereo::unsafe_arena_set_allocated_intrinsics1(
-    ::com::bcom::solar::gprc::Matrix3x3* intrinsics1) {
+inline void RectificationParameters::unsafe_arena_set_allocated_cam1_rotation(
+    ::com::bcom::solar::gprc::Matrix3x3* cam1_rotation) {
   if (GetArena() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(intrinsics1_);
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(cam1_rotation_);
   }
-  intrinsics1_ = intrinsics1;
-  if (intrinsics1) {
+  cam1_rotation_ = cam1_rotation;
+  if (cam1_rotation) {
     
   } else {
     
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:com.bcom.solar.gprc.CameraParametersStereo.intrinsics1)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:com.bcom.solar.gprc.RectificationParameters.cam1_rotation)
 }
-inline ::com::bcom::solar::gprc::Matrix3x3* CameraParametersStereo::release_intrinsics1() {
+inline ::com::bcom::solar::gprc::Matrix3x3* RectificationParameters::release_cam1_rotation() {
   
-  ::com::bcom::solar::gprc::Matrix3x3* temp = intrinsics1_;
-  intrinsics1_ = nullptr;
+  ::com::bcom::solar::gprc::Matrix3x3* temp = cam1_rotation_;
+  cam1_rotation_ = nullptr;
   if (GetArena() != nullptr) {
     temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
   }
   return temp;
 }
-inline ::com::bcom::solar::gprc::Matrix3x3* CameraParametersStereo::unsafe_arena_release_intrinsics1() {
-  // @@protoc_insertion_point(field_release:com.bcom.solar.gprc.CameraParametersStereo.intrinsics1)
+inline ::com::bcom::solar::gprc::Matrix3x3* RectificationParameters::unsafe_arena_release_cam1_rotation() {
+  // @@protoc_insertion_point(field_release:com.bcom.solar.gprc.RectificationParameters.cam1_rotation)
   
-  ::com::bcom::solar::gprc::Matrix3x3* temp = intrinsics1_;
-  intrinsics1_ = nullptr;
+  ::com::bcom::solar::gprc::Matrix3x3* temp = cam1_rotation_;
+  cam1_rotation_ = nullptr;
   return temp;
 }
-inline ::com::bcom::solar::gprc::Matrix3x3* CameraParametersStereo::_internal_mutable_intrinsics1() {
+inline ::com::bcom::solar::gprc::Matrix3x3* RectificationParameters::_internal_mutable_cam1_rotation() {
   
-  if (intrinsics1_ == nullptr) {
+  if (cam1_rotation_ == nullptr) {
     auto* p = CreateMaybeMessage<::com::bcom::solar::gprc::Matrix3x3>(GetArena());
-    intrinsics1_ = p;
+    cam1_rotation_ = p;
   }
-  return intrinsics1_;
+  return cam1_rotation_;
 }
-inline ::com::bcom::solar::gprc::Matrix3x3* CameraParametersStereo::mutable_intrinsics1() {
-  // @@protoc_insertion_point(field_mutable:com.bcom.solar.gprc.CameraParametersStereo.intrinsics1)
-  return _internal_mutable_intrinsics1();
+inline ::com::bcom::solar::gprc::Matrix3x3* RectificationParameters::mutable_cam1_rotation() {
+  // @@protoc_insertion_point(field_mutable:com.bcom.solar.gprc.RectificationParameters.cam1_rotation)
+  return _internal_mutable_cam1_rotation();
 }
-inline void CameraParametersStereo::set_allocated_intrinsics1(::com::bcom::solar::gprc::Matrix3x3* intrinsics1) {
+inline void RectificationParameters::set_allocated_cam1_rotation(::com::bcom::solar::gprc::Matrix3x3* cam1_rotation) {
   ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
   if (message_arena == nullptr) {
-    delete intrinsics1_;
+    delete cam1_rotation_;
   }
-  if (intrinsics1) {
+  if (cam1_rotation) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(intrinsics1);
+      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(cam1_rotation);
     if (message_arena != submessage_arena) {
-      intrinsics1 = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, intrinsics1, submessage_arena);
+      cam1_rotation = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, cam1_rotation, submessage_arena);
     }
     
   } else {
     
   }
-  intrinsics1_ = intrinsics1;
-  // @@protoc_insertion_point(field_set_allocated:com.bcom.solar.gprc.CameraParametersStereo.intrinsics1)
+  cam1_rotation_ = cam1_rotation;
+  // @@protoc_insertion_point(field_set_allocated:com.bcom.solar.gprc.RectificationParameters.cam1_rotation)
 }
 
-// .com.bcom.solar.gprc.CameraDistortion distortion1 = 8;
-inline bool CameraParametersStereo::_internal_has_distortion1() const {
-  return this != internal_default_instance() && distortion1_ != nullptr;
+// .com.bcom.solar.gprc.Matrix3x4 cam1_projection = 3;
+inline bool RectificationParameters::_internal_has_cam1_projection() const {
+  return this != internal_default_instance() && cam1_projection_ != nullptr;
 }
-inline bool CameraParametersStereo::has_distortion1() const {
-  return _internal_has_distortion1();
+inline bool RectificationParameters::has_cam1_projection() const {
+  return _internal_has_cam1_projection();
 }
-inline void CameraParametersStereo::clear_distortion1() {
-  if (GetArena() == nullptr && distortion1_ != nullptr) {
-    delete distortion1_;
+inline void RectificationParameters::clear_cam1_projection() {
+  if (GetArena() == nullptr && cam1_projection_ != nullptr) {
+    delete cam1_projection_;
   }
-  distortion1_ = nullptr;
+  cam1_projection_ = nullptr;
 }
-inline const ::com::bcom::solar::gprc::CameraDistortion& CameraParametersStereo::_internal_distortion1() const {
-  const ::com::bcom::solar::gprc::CameraDistortion* p = distortion1_;
-  return p != nullptr ? *p : reinterpret_cast<const ::com::bcom::solar::gprc::CameraDistortion&>(
-      ::com::bcom::solar::gprc::_CameraDistortion_default_instance_);
+inline const ::com::bcom::solar::gprc::Matrix3x4& RectificationParameters::_internal_cam1_projection() const {
+  const ::com::bcom::solar::gprc::Matrix3x4* p = cam1_projection_;
+  return p != nullptr ? *p : reinterpret_cast<const ::com::bcom::solar::gprc::Matrix3x4&>(
+      ::com::bcom::solar::gprc::_Matrix3x4_default_instance_);
 }
-inline const ::com::bcom::solar::gprc::CameraDistortion& CameraParametersStereo::distortion1() const {
-  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.CameraParametersStereo.distortion1)
-  return _internal_distortion1();
+inline const ::com::bcom::solar::gprc::Matrix3x4& RectificationParameters::cam1_projection() const {
+  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.RectificationParameters.cam1_projection)
+  return _internal_cam1_projection();
 }
-inline void CameraParametersStereo::unsafe_arena_set_allocated_distortion1(
-    ::com::bcom::solar::gprc::CameraDistortion* distortion1) {
+inline void RectificationParameters::unsafe_arena_set_allocated_cam1_projection(
+    ::com::bcom::solar::gprc::Matrix3x4* cam1_projection) {
   if (GetArena() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(distortion1_);
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(cam1_projection_);
   }
-  distortion1_ = distortion1;
-  if (distortion1) {
+  cam1_projection_ = cam1_projection;
+  if (cam1_projection) {
     
   } else {
     
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:com.bcom.solar.gprc.CameraParametersStereo.distortion1)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:com.bcom.solar.gprc.RectificationParameters.cam1_projection)
 }
-inline ::com::bcom::solar::gprc::CameraDistortion* CameraParametersStereo::release_distortion1() {
+inline ::com::bcom::solar::gprc::Matrix3x4* RectificationParameters::release_cam1_projection() {
   
-  ::com::bcom::solar::gprc::CameraDistortion* temp = distortion1_;
-  distortion1_ = nullptr;
+  ::com::bcom::solar::gprc::Matrix3x4* temp = cam1_projection_;
+  cam1_projection_ = nullptr;
   if (GetArena() != nullptr) {
     temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
   }
   return temp;
 }
-inline ::com::bcom::solar::gprc::CameraDistortion* CameraParametersStereo::unsafe_arena_release_distortion1() {
-  // @@protoc_insertion_point(field_release:com.bcom.solar.gprc.CameraParametersStereo.distortion1)
+inline ::com::bcom::solar::gprc::Matrix3x4* RectificationParameters::unsafe_arena_release_cam1_projection() {
+  // @@protoc_insertion_point(field_release:com.bcom.solar.gprc.RectificationParameters.cam1_projection)
   
-  ::com::bcom::solar::gprc::CameraDistortion* temp = distortion1_;
-  distortion1_ = nullptr;
+  ::com::bcom::solar::gprc::Matrix3x4* temp = cam1_projection_;
+  cam1_projection_ = nullptr;
   return temp;
 }
-inline ::com::bcom::solar::gprc::CameraDistortion* CameraParametersStereo::_internal_mutable_distortion1() {
+inline ::com::bcom::solar::gprc::Matrix3x4* RectificationParameters::_internal_mutable_cam1_projection() {
   
-  if (distortion1_ == nullptr) {
-    auto* p = CreateMaybeMessage<::com::bcom::solar::gprc::CameraDistortion>(GetArena());
-    distortion1_ = p;
+  if (cam1_projection_ == nullptr) {
+    auto* p = CreateMaybeMessage<::com::bcom::solar::gprc::Matrix3x4>(GetArena());
+    cam1_projection_ = p;
   }
-  return distortion1_;
+  return cam1_projection_;
 }
-inline ::com::bcom::solar::gprc::CameraDistortion* CameraParametersStereo::mutable_distortion1() {
-  // @@protoc_insertion_point(field_mutable:com.bcom.solar.gprc.CameraParametersStereo.distortion1)
-  return _internal_mutable_distortion1();
+inline ::com::bcom::solar::gprc::Matrix3x4* RectificationParameters::mutable_cam1_projection() {
+  // @@protoc_insertion_point(field_mutable:com.bcom.solar.gprc.RectificationParameters.cam1_projection)
+  return _internal_mutable_cam1_projection();
 }
-inline void CameraParametersStereo::set_allocated_distortion1(::com::bcom::solar::gprc::CameraDistortion* distortion1) {
+inline void RectificationParameters::set_allocated_cam1_projection(::com::bcom::solar::gprc::Matrix3x4* cam1_projection) {
   ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
   if (message_arena == nullptr) {
-    delete distortion1_;
+    delete cam1_projection_;
   }
-  if (distortion1) {
+  if (cam1_projection) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(distortion1);
+      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(cam1_projection);
     if (message_arena != submessage_arena) {
-      distortion1 = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, distortion1, submessage_arena);
+      cam1_projection = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, cam1_projection, submessage_arena);
     }
     
   } else {
     
   }
-  distortion1_ = distortion1;
-  // @@protoc_insertion_point(field_set_allocated:com.bcom.solar.gprc.CameraParametersStereo.distortion1)
+  cam1_projection_ = cam1_projection;
+  // @@protoc_insertion_point(field_set_allocated:com.bcom.solar.gprc.RectificationParameters.cam1_projection)
 }
 
-// string name2 = 9;
-inline void CameraParametersStereo::clear_name2() {
-  name2_.ClearToEmpty();
-}
-inline const std::string& CameraParametersStereo::name2() const {
-  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.CameraParametersStereo.name2)
-  return _internal_name2();
-}
-inline void CameraParametersStereo::set_name2(const std::string& value) {
-  _internal_set_name2(value);
-  // @@protoc_insertion_point(field_set:com.bcom.solar.gprc.CameraParametersStereo.name2)
-}
-inline std::string* CameraParametersStereo::mutable_name2() {
-  // @@protoc_insertion_point(field_mutable:com.bcom.solar.gprc.CameraParametersStereo.name2)
-  return _internal_mutable_name2();
-}
-inline const std::string& CameraParametersStereo::_internal_name2() const {
-  return name2_.Get();
-}
-inline void CameraParametersStereo::_internal_set_name2(const std::string& value) {
-  
-  name2_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArena());
-}
-inline void CameraParametersStereo::set_name2(std::string&& value) {
-  
-  name2_.Set(
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:com.bcom.solar.gprc.CameraParametersStereo.name2)
+// .com.bcom.solar.gprc.StereoType cam1_stereo_type = 4;
+inline void RectificationParameters::clear_cam1_stereo_type() {
+  cam1_stereo_type_ = 0;
 }
-inline void CameraParametersStereo::set_name2(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  name2_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(value), GetArena());
-  // @@protoc_insertion_point(field_set_char:com.bcom.solar.gprc.CameraParametersStereo.name2)
+inline ::com::bcom::solar::gprc::StereoType RectificationParameters::_internal_cam1_stereo_type() const {
+  return static_cast< ::com::bcom::solar::gprc::StereoType >(cam1_stereo_type_);
 }
-inline void CameraParametersStereo::set_name2(const char* value,
-    size_t size) {
-  
-  name2_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:com.bcom.solar.gprc.CameraParametersStereo.name2)
+inline ::com::bcom::solar::gprc::StereoType RectificationParameters::cam1_stereo_type() const {
+  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.RectificationParameters.cam1_stereo_type)
+  return _internal_cam1_stereo_type();
 }
-inline std::string* CameraParametersStereo::_internal_mutable_name2() {
+inline void RectificationParameters::_internal_set_cam1_stereo_type(::com::bcom::solar::gprc::StereoType value) {
   
-  return name2_.Mutable(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArena());
-}
-inline std::string* CameraParametersStereo::release_name2() {
-  // @@protoc_insertion_point(field_release:com.bcom.solar.gprc.CameraParametersStereo.name2)
-  return name2_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  cam1_stereo_type_ = value;
 }
-inline void CameraParametersStereo::set_allocated_name2(std::string* name2) {
-  if (name2 != nullptr) {
-    
-  } else {
-    
-  }
-  name2_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), name2,
-      GetArena());
-  // @@protoc_insertion_point(field_set_allocated:com.bcom.solar.gprc.CameraParametersStereo.name2)
+inline void RectificationParameters::set_cam1_stereo_type(::com::bcom::solar::gprc::StereoType value) {
+  _internal_set_cam1_stereo_type(value);
+  // @@protoc_insertion_point(field_set:com.bcom.solar.gprc.RectificationParameters.cam1_stereo_type)
 }
 
-// uint32 id2 = 10;
-inline void CameraParametersStereo::clear_id2() {
-  id2_ = 0u;
+// float cam1_baseline = 5;
+inline void RectificationParameters::clear_cam1_baseline() {
+  cam1_baseline_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint32 CameraParametersStereo::_internal_id2() const {
-  return id2_;
+inline float RectificationParameters::_internal_cam1_baseline() const {
+  return cam1_baseline_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint32 CameraParametersStereo::id2() const {
-  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.CameraParametersStereo.id2)
-  return _internal_id2();
+inline float RectificationParameters::cam1_baseline() const {
+  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.RectificationParameters.cam1_baseline)
+  return _internal_cam1_baseline();
 }
-inline void CameraParametersStereo::_internal_set_id2(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+inline void RectificationParameters::_internal_set_cam1_baseline(float value) {
   
-  id2_ = value;
+  cam1_baseline_ = value;
 }
-inline void CameraParametersStereo::set_id2(::PROTOBUF_NAMESPACE_ID::uint32 value) {
-  _internal_set_id2(value);
-  // @@protoc_insertion_point(field_set:com.bcom.solar.gprc.CameraParametersStereo.id2)
+inline void RectificationParameters::set_cam1_baseline(float value) {
+  _internal_set_cam1_baseline(value);
+  // @@protoc_insertion_point(field_set:com.bcom.solar.gprc.RectificationParameters.cam1_baseline)
 }
 
-// .com.bcom.solar.gprc.CameraType camera_type2 = 11;
-inline void CameraParametersStereo::clear_camera_type2() {
-  camera_type2_ = 0;
-}
-inline ::com::bcom::solar::gprc::CameraType CameraParametersStereo::_internal_camera_type2() const {
-  return static_cast< ::com::bcom::solar::gprc::CameraType >(camera_type2_);
-}
-inline ::com::bcom::solar::gprc::CameraType CameraParametersStereo::camera_type2() const {
-  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.CameraParametersStereo.camera_type2)
-  return _internal_camera_type2();
+// .com.bcom.solar.gprc.Matrix3x3 cam2_rotation = 6;
+inline bool RectificationParameters::_internal_has_cam2_rotation() const {
+  return this != internal_default_instance() && cam2_rotation_ != nullptr;
 }
-inline void CameraParametersStereo::_internal_set_camera_type2(::com::bcom::solar::gprc::CameraType value) {
-  
-  camera_type2_ = value;
+inline bool RectificationParameters::has_cam2_rotation() const {
+  return _internal_has_cam2_rotation();
 }
-inline void CameraParametersStereo::set_camera_type2(::com::bcom::solar::gprc::CameraType value) {
-  _internal_set_camera_type2(value);
-  // @@protoc_insertion_point(field_set:com.bcom.solar.gprc.CameraParametersStereo.camera_type2)
+inline void RectificationParameters::clear_cam2_rotation() {
+  if (GetArena() == nullptr && cam2_rotation_ != nullptr) {
+    delete cam2_rotation_;
+  }
+  cam2_rotation_ = nullptr;
 }
-
-// uint32 width2 = 12;
-inline void CameraParametersStereo::clear_width2() {
-  width2_ = 0u;
+inline const ::com::bcom::solar::gprc::Matrix3x3& RectificationParameters::_internal_cam2_rotation() const {
+  const ::com::bcom::solar::gprc::Matrix3x3* p = cam2_rotation_;
+  return p != nullptr ? *p : reinterpret_cast<const ::com::bcom::solar::gprc::Matrix3x3&>(
+      ::com::bcom::solar::gprc::_Matrix3x3_default_instance_);
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint32 CameraParametersStereo::_internal_width2() const {
-  return width2_;
+inline const ::com::bcom::solar::gprc::Matrix3x3& RectificationParameters::cam2_rotation() const {
+  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.RectificationParameters.cam2_rotation)
+  return _internal_cam2_rotation();
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint32 CameraParametersStereo::width2() const {
-  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.CameraParametersStereo.width2)
-  return _internal_width2();
+inline void RectificationParameters::unsafe_arena_set_allocated_cam2_rotation(
+    ::com::bcom::solar::gprc::Matrix3x3* cam2_rotation) {
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(cam2_rotation_);
+  }
+  cam2_rotation_ = cam2_rotation;
+  if (cam2_rotation) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:com.bcom.solar.gprc.RectificationParameters.cam2_rotation)
 }
-inline void CameraParametersStereo::_internal_set_width2(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+inline ::com::bcom::solar::gprc::Matrix3x3* RectificationParameters::release_cam2_rotation() {
   
-  width2_ = value;
-}
-inline void CameraParametersStereo::set_width2(::PROTOBUF_NAMESPACE_ID::uint32 value) {
-  _internal_set_width2(value);
-  // @@protoc_insertion_point(field_set:com.bcom.solar.gprc.CameraParametersStereo.width2)
-}
-
-// uint32 height2 = 13;
-inline void CameraParametersStereo::clear_height2() {
-  height2_ = 0u;
-}
-inline ::PROTOBUF_NAMESPACE_ID::uint32 CameraParametersStereo::_internal_height2() const {
-  return height2_;
+  ::com::bcom::solar::gprc::Matrix3x3* temp = cam2_rotation_;
+  cam2_rotation_ = nullptr;
+  if (GetArena() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+  return temp;
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint32 CameraParametersStereo::height2() const {
-  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.CameraParametersStereo.height2)
-  return _internal_height2();
+inline ::com::bcom::solar::gprc::Matrix3x3* RectificationParameters::unsafe_arena_release_cam2_rotation() {
+  // @@protoc_insertion_point(field_release:com.bcom.solar.gprc.RectificationParameters.cam2_rotation)
+  
+  ::com::bcom::solar::gprc::Matrix3x3* temp = cam2_rotation_;
+  cam2_rotation_ = nullptr;
+  return temp;
 }
-inline void CameraParametersStereo::_internal_set_height2(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+inline ::com::bcom::solar::gprc::Matrix3x3* RectificationParameters::_internal_mutable_cam2_rotation() {
   
-  height2_ = value;
+  if (cam2_rotation_ == nullptr) {
+    auto* p = CreateMaybeMessage<::com::bcom::solar::gprc::Matrix3x3>(GetArena());
+    cam2_rotation_ = p;
+  }
+  return cam2_rotation_;
 }
-inline void CameraParametersStereo::set_height2(::PROTOBUF_NAMESPACE_ID::uint32 value) {
-  _internal_set_height2(value);
-  // @@protoc_insertion_point(field_set:com.bcom.solar.gprc.CameraParametersStereo.height2)
+inline ::com::bcom::solar::gprc::Matrix3x3* RectificationParameters::mutable_cam2_rotation() {
+  // @@protoc_insertion_point(field_mutable:com.bcom.solar.gprc.RectificationParameters.cam2_rotation)
+  return _internal_mutable_cam2_rotation();
+}
+inline void RectificationParameters::set_allocated_cam2_rotation(::com::bcom::solar::gprc::Matrix3x3* cam2_rotation) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  if (message_arena == nullptr) {
+    delete cam2_rotation_;
+  }
+  if (cam2_rotation) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(cam2_rotation);
+    if (message_arena != submessage_arena) {
+      cam2_rotation = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, cam2_rotation, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  cam2_rotation_ = cam2_rotation;
+  // @@protoc_insertion_point(field_set_allocated:com.bcom.solar.gprc.RectificationParameters.cam2_rotation)
 }
 
-// .com.bcom.solar.gprc.Matrix3x3 intrinsics2 = 14;
-inline bool CameraParametersStereo::_internal_has_intrinsics2() const {
-  return this != internal_default_instance() && intrinsics2_ != nullptr;
+// .com.bcom.solar.gprc.Matrix3x4 cam2_projection = 7;
+inline bool RectificationParameters::_internal_has_cam2_projection() const {
+  return this != internal_default_instance() && cam2_projection_ != nullptr;
 }
-inline bool CameraParametersStereo::has_intrinsics2() const {
-  return _internal_has_intrinsics2();
+inline bool RectificationParameters::has_cam2_projection() const {
+  return _internal_has_cam2_projection();
 }
-inline void CameraParametersStereo::clear_intrinsics2() {
-  if (GetArena() == nullptr && intrinsics2_ != nullptr) {
-    delete intrinsics2_;
+inline void RectificationParameters::clear_cam2_projection() {
+  if (GetArena() == nullptr && cam2_projection_ != nullptr) {
+    delete cam2_projection_;
   }
-  intrinsics2_ = nullptr;
+  cam2_projection_ = nullptr;
 }
-inline const ::com::bcom::solar::gprc::Matrix3x3& CameraParametersStereo::_internal_intrinsics2() const {
-  const ::com::bcom::solar::gprc::Matrix3x3* p = intrinsics2_;
-  return p != nullptr ? *p : reinterpret_cast<const ::com::bcom::solar::gprc::Matrix3x3&>(
-      ::com::bcom::solar::gprc::_Matrix3x3_default_instance_);
+inline const ::com::bcom::solar::gprc::Matrix3x4& RectificationParameters::_internal_cam2_projection() const {
+  const ::com::bcom::solar::gprc::Matrix3x4* p = cam2_projection_;
+  return p != nullptr ? *p : reinterpret_cast<const ::com::bcom::solar::gprc::Matrix3x4&>(
+      ::com::bcom::solar::gprc::_Matrix3x4_default_instance_);
 }
-inline const ::com::bcom::solar::gprc::Matrix3x3& CameraParametersStereo::intrinsics2() const {
-  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.CameraParametersStereo.intrinsics2)
-  return _internal_intrinsics2();
+inline const ::com::bcom::solar::gprc::Matrix3x4& RectificationParameters::cam2_projection() const {
+  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.RectificationParameters.cam2_projection)
+  return _internal_cam2_projection();
 }
-inline void CameraParametersStereo::unsafe_arena_set_allocated_intrinsics2(
-    ::com::bcom::solar::gprc::Matrix3x3* intrinsics2) {
+inline void RectificationParameters::unsafe_arena_set_allocated_cam2_projection(
+    ::com::bcom::solar::gprc::Matrix3x4* cam2_projection) {
   if (GetArena() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(intrinsics2_);
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(cam2_projection_);
   }
-  intrinsics2_ = intrinsics2;
-  if (intrinsics2) {
+  cam2_projection_ = cam2_projection;
+  if (cam2_projection) {
     
   } else {
     
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:com.bcom.solar.gprc.CameraParametersStereo.intrinsics2)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:com.bcom.solar.gprc.RectificationParameters.cam2_projection)
 }
-inline ::com::bcom::solar::gprc::Matrix3x3* CameraParametersStereo::release_intrinsics2() {
+inline ::com::bcom::solar::gprc::Matrix3x4* RectificationParameters::release_cam2_projection() {
   
-  ::com::bcom::solar::gprc::Matrix3x3* temp = intrinsics2_;
-  intrinsics2_ = nullptr;
+  ::com::bcom::solar::gprc::Matrix3x4* temp = cam2_projection_;
+  cam2_projection_ = nullptr;
   if (GetArena() != nullptr) {
     temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
   }
   return temp;
 }
-inline ::com::bcom::solar::gprc::Matrix3x3* CameraParametersStereo::unsafe_arena_release_intrinsics2() {
-  // @@protoc_insertion_point(field_release:com.bcom.solar.gprc.CameraParametersStereo.intrinsics2)
+inline ::com::bcom::solar::gprc::Matrix3x4* RectificationParameters::unsafe_arena_release_cam2_projection() {
+  // @@protoc_insertion_point(field_release:com.bcom.solar.gprc.RectificationParameters.cam2_projection)
   
-  ::com::bcom::solar::gprc::Matrix3x3* temp = intrinsics2_;
-  intrinsics2_ = nullptr;
+  ::com::bcom::solar::gprc::Matrix3x4* temp = cam2_projection_;
+  cam2_projection_ = nullptr;
   return temp;
 }
-inline ::com::bcom::solar::gprc::Matrix3x3* CameraParametersStereo::_internal_mutable_intrinsics2() {
+inline ::com::bcom::solar::gprc::Matrix3x4* RectificationParameters::_internal_mutable_cam2_projection() {
   
-  if (intrinsics2_ == nullptr) {
-    auto* p = CreateMaybeMessage<::com::bcom::solar::gprc::Matrix3x3>(GetArena());
-    intrinsics2_ = p;
+  if (cam2_projection_ == nullptr) {
+    auto* p = CreateMaybeMessage<::com::bcom::solar::gprc::Matrix3x4>(GetArena());
+    cam2_projection_ = p;
   }
-  return intrinsics2_;
+  return cam2_projection_;
 }
-inline ::com::bcom::solar::gprc::Matrix3x3* CameraParametersStereo::mutable_intrinsics2() {
-  // @@protoc_insertion_point(field_mutable:com.bcom.solar.gprc.CameraParametersStereo.intrinsics2)
-  return _internal_mutable_intrinsics2();
+inline ::com::bcom::solar::gprc::Matrix3x4* RectificationParameters::mutable_cam2_projection() {
+  // @@protoc_insertion_point(field_mutable:com.bcom.solar.gprc.RectificationParameters.cam2_projection)
+  return _internal_mutable_cam2_projection();
 }
-inline void CameraParametersStereo::set_allocated_intrinsics2(::com::bcom::solar::gprc::Matrix3x3* intrinsics2) {
+inline void RectificationParameters::set_allocated_cam2_projection(::com::bcom::solar::gprc::Matrix3x4* cam2_projection) {
   ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
   if (message_arena == nullptr) {
-    delete intrinsics2_;
+    delete cam2_projection_;
   }
-  if (intrinsics2) {
+  if (cam2_projection) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(intrinsics2);
+      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(cam2_projection);
     if (message_arena != submessage_arena) {
-      intrinsics2 = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, intrinsics2, submessage_arena);
+      cam2_projection = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, cam2_projection, submessage_arena);
     }
     
   } else {
     
   }
-  intrinsics2_ = intrinsics2;
-  // @@protoc_insertion_point(field_set_allocated:com.bcom.solar.gprc.CameraParametersStereo.intrinsics2)
+  cam2_projection_ = cam2_projection;
+  // @@protoc_insertion_point(field_set_allocated:com.bcom.solar.gprc.RectificationParameters.cam2_projection)
 }
 
-// .com.bcom.solar.gprc.CameraDistortion distortion2 = 15;
-inline bool CameraParametersStereo::_internal_has_distortion2() const {
-  return this != internal_default_instance() && distortion2_ != nullptr;
+// .com.bcom.solar.gprc.StereoType cam2_stereo_type = 8;
+inline void RectificationParameters::clear_cam2_stereo_type() {
+  cam2_stereo_type_ = 0;
 }
-inline bool CameraParametersStereo::has_distortion2() const {
-  return _internal_has_distortion2();
+inline ::com::bcom::solar::gprc::StereoType RectificationParameters::_internal_cam2_stereo_type() const {
+  return static_cast< ::com::bcom::solar::gprc::StereoType >(cam2_stereo_type_);
 }
-inline void CameraParametersStereo::clear_distortion2() {
-  if (GetArena() == nullptr && distortion2_ != nullptr) {
-    delete distortion2_;
+inline ::com::bcom::solar::gprc::StereoType RectificationParameters::cam2_stereo_type() const {
+  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.RectificationParameters.cam2_stereo_type)
+  return _internal_cam2_stereo_type();
+}
+inline void RectificationParameters::_internal_set_cam2_stereo_type(::com::bcom::solar::gprc::StereoType value) {
+  
+  cam2_stereo_type_ = value;
+}
+inline void RectificationParameters::set_cam2_stereo_type(::com::bcom::solar::gprc::StereoType value) {
+  _internal_set_cam2_stereo_type(value);
+  // @@protoc_insertion_point(field_set:com.bcom.solar.gprc.RectificationParameters.cam2_stereo_type)
+}
+
+// float cam2_baseline = 9;
+inline void RectificationParameters::clear_cam2_baseline() {
+  cam2_baseline_ = 0;
+}
+inline float RectificationParameters::_internal_cam2_baseline() const {
+  return cam2_baseline_;
+}
+inline float RectificationParameters::cam2_baseline() const {
+  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.RectificationParameters.cam2_baseline)
+  return _internal_cam2_baseline();
+}
+inline void RectificationParameters::_internal_set_cam2_baseline(float value) {
+  
+  cam2_baseline_ = value;
+}
+inline void RectificationParameters::set_cam2_baseline(float value) {
+  _internal_set_cam2_baseline(value);
+  // @@protoc_insertion_point(field_set:com.bcom.solar.gprc.RectificationParameters.cam2_baseline)
+}
+
+// -------------------------------------------------------------------
+
+// RelocalizationResult
+
+// .com.bcom.solar.gprc.RelocalizationPoseStatus pose_status = 1;
+inline void RelocalizationResult::clear_pose_status() {
+  pose_status_ = 0;
+}
+inline ::com::bcom::solar::gprc::RelocalizationPoseStatus RelocalizationResult::_internal_pose_status() const {
+  return static_cast< ::com::bcom::solar::gprc::RelocalizationPoseStatus >(pose_status_);
+}
+inline ::com::bcom::solar::gprc::RelocalizationPoseStatus RelocalizationResult::pose_status() const {
+  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.RelocalizationResult.pose_status)
+  return _internal_pose_status();
+}
+inline void RelocalizationResult::_internal_set_pose_status(::com::bcom::solar::gprc::RelocalizationPoseStatus value) {
+  
+  pose_status_ = value;
+}
+inline void RelocalizationResult::set_pose_status(::com::bcom::solar::gprc::RelocalizationPoseStatus value) {
+  _internal_set_pose_status(value);
+  // @@protoc_insertion_point(field_set:com.bcom.solar.gprc.RelocalizationResult.pose_status)
+}
+
+// .com.bcom.solar.gprc.Matrix4x4 pose = 2;
+inline bool RelocalizationResult::_internal_has_pose() const {
+  return this != internal_default_instance() && pose_ != nullptr;
+}
+inline bool RelocalizationResult::has_pose() const {
+  return _internal_has_pose();
+}
+inline void RelocalizationResult::clear_pose() {
+  if (GetArena() == nullptr && pose_ != nullptr) {
+    delete pose_;
   }
-  distortion2_ = nullptr;
+  pose_ = nullptr;
 }
-inline const ::com::bcom::solar::gprc::CameraDistortion& CameraParametersStereo::_internal_distortion2() const {
-  const ::com::bcom::solar::gprc::CameraDistortion* p = distortion2_;
-  return p != nullptr ? *p : reinterpret_cast<const ::com::bcom::solar::gprc::CameraDistortion&>(
-      ::com::bcom::solar::gprc::_CameraDistortion_default_instance_);
+inline const ::com::bcom::solar::gprc::Matrix4x4& RelocalizationResult::_internal_pose() const {
+  const ::com::bcom::solar::gprc::Matrix4x4* p = pose_;
+  return p != nullptr ? *p : reinterpret_cast<const ::com::bcom::solar::gprc::Matrix4x4&>(
+      ::com::bcom::solar::gprc::_Matrix4x4_default_instance_);
 }
-inline const ::com::bcom::solar::gprc::CameraDistortion& CameraParametersStereo::distortion2() const {
-  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.CameraParametersStereo.distortion2)
-  return _internal_distortion2();
+inline const ::com::bcom::solar::gprc::Matrix4x4& RelocalizationResult::pose() const {
+  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.RelocalizationResult.pose)
+  return _internal_pose();
 }
-inline void CameraParametersStereo::unsafe_arena_set_allocated_distortion2(
-    ::com::bcom::solar::gprc::CameraDistortion* distortion2) {
+inline void RelocalizationResult::unsafe_arena_set_allocated_pose(
+    ::com::bcom::solar::gprc::Matrix4x4* pose) {
   if (GetArena() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(distortion2_);
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(pose_);
   }
-  distortion2_ = distortion2;
-  if (distortion2) {
+  pose_ = pose;
+  if (pose) {
     
   } else {
     
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:com.bcom.solar.gprc.CameraParametersStereo.distortion2)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:com.bcom.solar.gprc.RelocalizationResult.pose)
 }
-inline ::com::bcom::solar::gprc::CameraDistortion* CameraParametersStereo::release_distortion2() {
+inline ::com::bcom::solar::gprc::Matrix4x4* RelocalizationResult::release_pose() {
   
-  ::com::bcom::solar::gprc::CameraDistortion* temp = distortion2_;
-  distortion2_ = nullptr;
+  ::com::bcom::solar::gprc::Matrix4x4* temp = pose_;
+  pose_ = nullptr;
   if (GetArena() != nullptr) {
     temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
   }
   return temp;
 }
-inline ::com::bcom::solar::gprc::CameraDistortion* CameraParametersStereo::unsafe_arena_release_distortion2() {
-  // @@protoc_insertion_point(field_release:com.bcom.solar.gprc.CameraParametersStereo.distortion2)
+inline ::com::bcom::solar::gprc::Matrix4x4* RelocalizationResult::unsafe_arena_release_pose() {
+  // @@protoc_insertion_point(field_release:com.bcom.solar.gprc.RelocalizationResult.pose)
   
-  ::com::bcom::solar::gprc::CameraDistortion* temp = distortion2_;
-  distortion2_ = nullptr;
+  ::com::bcom::solar::gprc::Matrix4x4* temp = pose_;
+  pose_ = nullptr;
   return temp;
 }
-inline ::com::bcom::solar::gprc::CameraDistortion* CameraParametersStereo::_internal_mutable_distortion2() {
+inline ::com::bcom::solar::gprc::Matrix4x4* RelocalizationResult::_internal_mutable_pose() {
   
-  if (distortion2_ == nullptr) {
-    auto* p = CreateMaybeMessage<::com::bcom::solar::gprc::CameraDistortion>(GetArena());
-    distortion2_ = p;
+  if (pose_ == nullptr) {
+    auto* p = CreateMaybeMessage<::com::bcom::solar::gprc::Matrix4x4>(GetArena());
+    pose_ = p;
   }
-  return distortion2_;
+  return pose_;
 }
-inline ::com::bcom::solar::gprc::CameraDistortion* CameraParametersStereo::mutable_distortion2() {
-  // @@protoc_insertion_point(field_mutable:com.bcom.solar.gprc.CameraParametersStereo.distortion2)
-  return _internal_mutable_distortion2();
+inline ::com::bcom::solar::gprc::Matrix4x4* RelocalizationResult::mutable_pose() {
+  // @@protoc_insertion_point(field_mutable:com.bcom.solar.gprc.RelocalizationResult.pose)
+  return _internal_mutable_pose();
 }
-inline void CameraParametersStereo::set_allocated_distortion2(::com::bcom::solar::gprc::CameraDistortion* distortion2) {
+inline void RelocalizationResult::set_allocated_pose(::com::bcom::solar::gprc::Matrix4x4* pose) {
   ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
   if (message_arena == nullptr) {
-    delete distortion2_;
+    delete pose_;
   }
-  if (distortion2) {
+  if (pose) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(distortion2);
+      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(pose);
     if (message_arena != submessage_arena) {
-      distortion2 = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, distortion2, submessage_arena);
+      pose = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, pose, submessage_arena);
     }
     
   } else {
     
   }
-  distortion2_ = distortion2;
-  // @@protoc_insertion_point(field_set_allocated:com.bcom.solar.gprc.CameraParametersStereo.distortion2)
+  pose_ = pose;
+  // @@protoc_insertion_point(field_set_allocated:com.bcom.solar.gprc.RelocalizationResult.pose)
+}
+
+// float confidence = 3;
+inline void RelocalizationResult::clear_confidence() {
+  confidence_ = 0;
+}
+inline float RelocalizationResult::_internal_confidence() const {
+  return confidence_;
+}
+inline float RelocalizationResult::confidence() const {
+  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.RelocalizationResult.confidence)
+  return _internal_confidence();
+}
+inline void RelocalizationResult::_internal_set_confidence(float value) {
+  
+  confidence_ = value;
+}
+inline void RelocalizationResult::set_confidence(float value) {
+  _internal_set_confidence(value);
+  // @@protoc_insertion_point(field_set:com.bcom.solar.gprc.RelocalizationResult.confidence)
+}
+
+// .com.bcom.solar.gprc.MappingStatus mapping_status = 4;
+inline void RelocalizationResult::clear_mapping_status() {
+  mapping_status_ = 0;
+}
+inline ::com::bcom::solar::gprc::MappingStatus RelocalizationResult::_internal_mapping_status() const {
+  return static_cast< ::com::bcom::solar::gprc::MappingStatus >(mapping_status_);
+}
+inline ::com::bcom::solar::gprc::MappingStatus RelocalizationResult::mapping_status() const {
+  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.RelocalizationResult.mapping_status)
+  return _internal_mapping_status();
+}
+inline void RelocalizationResult::_internal_set_mapping_status(::com::bcom::solar::gprc::MappingStatus value) {
+  
+  mapping_status_ = value;
+}
+inline void RelocalizationResult::set_mapping_status(::com::bcom::solar::gprc::MappingStatus value) {
+  _internal_set_mapping_status(value);
+  // @@protoc_insertion_point(field_set:com.bcom.solar.gprc.RelocalizationResult.mapping_status)
+}
+
+// uint64 timestamp = 5;
+inline void RelocalizationResult::clear_timestamp() {
+  timestamp_ = PROTOBUF_ULONGLONG(0);
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 RelocalizationResult::_internal_timestamp() const {
+  return timestamp_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 RelocalizationResult::timestamp() const {
+  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.RelocalizationResult.timestamp)
+  return _internal_timestamp();
+}
+inline void RelocalizationResult::_internal_set_timestamp(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  
+  timestamp_ = value;
+}
+inline void RelocalizationResult::set_timestamp(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  _internal_set_timestamp(value);
+  // @@protoc_insertion_point(field_set:com.bcom.solar.gprc.RelocalizationResult.timestamp)
 }
 
 // -------------------------------------------------------------------
 
-// CameraDistortion
+// RelocalizationResults
 
-// float K_1 = 1;
-inline void CameraDistortion::clear_k_1() {
-  k_1_ = 0;
+// repeated .com.bcom.solar.gprc.RelocalizationResult results = 1;
+inline int RelocalizationResults::_internal_results_size() const {
+  return results_.size();
 }
-inline float CameraDistortion::_internal_k_1() const {
-  return k_1_;
+inline int RelocalizationResults::results_size() const {
+  return _internal_results_size();
 }
-inline float CameraDistortion::k_1() const {
-  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.CameraDistortion.K_1)
-  return _internal_k_1();
+inline void RelocalizationResults::clear_results() {
+  results_.Clear();
 }
-inline void CameraDistortion::_internal_set_k_1(float value) {
+inline ::com::bcom::solar::gprc::RelocalizationResult* RelocalizationResults::mutable_results(int index) {
+  // @@protoc_insertion_point(field_mutable:com.bcom.solar.gprc.RelocalizationResults.results)
+  return results_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::com::bcom::solar::gprc::RelocalizationResult >*
+RelocalizationResults::mutable_results() {
+  // @@protoc_insertion_point(field_mutable_list:com.bcom.solar.gprc.RelocalizationResults.results)
+  return &results_;
+}
+inline const ::com::bcom::solar::gprc::RelocalizationResult& RelocalizationResults::_internal_results(int index) const {
+  return results_.Get(index);
+}
+inline const ::com::bcom::solar::gprc::RelocalizationResult& RelocalizationResults::results(int index) const {
+  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.RelocalizationResults.results)
+  return _internal_results(index);
+}
+inline ::com::bcom::solar::gprc::RelocalizationResult* RelocalizationResults::_internal_add_results() {
+  return results_.Add();
+}
+inline ::com::bcom::solar::gprc::RelocalizationResult* RelocalizationResults::add_results() {
+  // @@protoc_insertion_point(field_add:com.bcom.solar.gprc.RelocalizationResults.results)
+  return _internal_add_results();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::com::bcom::solar::gprc::RelocalizationResult >&
+RelocalizationResults::results() const {
+  // @@protoc_insertion_point(field_list:com.bcom.solar.gprc.RelocalizationResults.results)
+  return results_;
+}
+
+// -------------------------------------------------------------------
+
+// StageLatency
+
+// uint64 count = 1;
+inline void StageLatency::clear_count() {
+  count_ = PROTOBUF_ULONGLONG(0);
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 StageLatency::_internal_count() const {
+  return count_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 StageLatency::count() const {
+  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.StageLatency.count)
+  return _internal_count();
+}
+inline void StageLatency::_internal_set_count(::PROTOBUF_NAMESPACE_ID::uint64 value) {
   
-  k_1_ = value;
+  count_ = value;
 }
-inline void CameraDistortion::set_k_1(float value) {
-  _internal_set_k_1(value);
-  // @@protoc_insertion_point(field_set:com.bcom.solar.gprc.CameraDistortion.K_1)
+inline void StageLatency::set_count(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  _internal_set_count(value);
+  // @@protoc_insertion_point(field_set:com.bcom.solar.gprc.StageLatency.count)
 }
 
-// float K_2 = 2;
-inline void CameraDistortion::clear_k_2() {
-  k_2_ = 0;
+// float mean_ms = 2;
+inline void StageLatency::clear_mean_ms() {
+  mean_ms_ = 0;
 }
-inline float CameraDistortion::_internal_k_2() const {
-  return k_2_;
+inline float StageLatency::_internal_mean_ms() const {
+  return mean_ms_;
 }
-inline float CameraDistortion::k_2() const {
-  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.CameraDistortion.K_2)
-  return _internal_k_2();
+inline float StageLatency::mean_ms() const {
+  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.StageLatency.mean_ms)
+  return _internal_mean_ms();
 }
-inline void CameraDistortion::_internal_set_k_2(float value) {
+inline void StageLatency::_internal_set_mean_ms(float value) {
   
-  k_2_ = value;
+  mean_ms_ = value;
 }
-inline void CameraDistortion::set_k_2(float value) {
-  _internal_set_k_2(value);
-  // @@protoc_insertion_point(field_set:com.bcom.solar.gprc.CameraDistortion.K_2)
+inline void StageLatency::set_mean_ms(float value) {
+  _internal_set_mean_ms(value);
+  // @@protoc_insertion_point(field_set:com.bcom.solar.gprc.StageLatency.mean_ms)
 }
 
-// float P_1 = 3;
-inline void CameraDistortion::clear_p_1() {
-  p_1_ = 0;
+// float p50_ms = 3;
+inline void StageLatency::clear_p50_ms() {
+  p50_ms_ = 0;
 }
-inline float CameraDistortion::_internal_p_1() const {
-  return p_1_;
+inline float StageLatency::_internal_p50_ms() const {
+  return p50_ms_;
 }
-inline float CameraDistortion::p_1() const {
-  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.CameraDistortion.P_1)
-  return _internal_p_1();
+inline float StageLatency::p50_ms() const {
+  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.StageLatency.p50_ms)
+  return _internal_p50_ms();
 }
-inline void CameraDistortion::_internal_set_p_1(float value) {
+inline void StageLatency::_internal_set_p50_ms(float value) {
   
-  p_1_ = value;
+  p50_ms_ = value;
 }
-inline void CameraDistortion::set_p_1(float value) {
-  _internal_set_p_1(value);
-  // @@protoc_insertion_point(field_set:com.bcom.solar.gprc.CameraDistortion.P_1)
+inline void StageLatency::set_p50_ms(float value) {
+  _internal_set_p50_ms(value);
+  // @@protoc_insertion_point(field_set:com.bcom.solar.gprc.StageLatency.p50_ms)
 }
 
-// float P_2 = 4;
-inline void CameraDistortion::clear_p_2() {
-  p_2_ = 0;
+// float p90_ms = 4;
+inline void StageLatency::clear_p90_ms() {
+  p90_ms_ = 0;
 }
-inline float CameraDistortion::_internal_p_2() const {
-  return p_2_;
+inline float StageLatency::_internal_p90_ms() const {
+  return p90_ms_;
 }
-inline float CameraDistortion::p_2() const {
-  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.CameraDistortion.P_2)
-  return _internal_p_2();
+inline float StageLatency::p90_ms() const {
+  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.StageLatency.p90_ms)
+  return _internal_p90_ms();
 }
-inline void CameraDistortion::_internal_set_p_2(float value) {
+inline void StageLatency::_internal_set_p90_ms(float value) {
   
-  p_2_ = value;
+  p90_ms_ = value;
 }
-inline void CameraDistortion::set_p_2(float value) {
-  _internal_set_p_2(value);
-  // @@protoc_insertion_point(field_set:com.bcom.solar.gprc.CameraDistortion.P_2)
+inline void StageLatency::set_p90_ms(float value) {
+  _internal_set_p90_ms(value);
+  // @@protoc_insertion_point(field_set:com.bcom.solar.gprc.StageLatency.p90_ms)
 }
 
-// float K_3 = 5;
-inline void CameraDistortion::clear_k_3() {
-  k_3_ = 0;
+// float p99_ms = 5;
+inline void StageLatency::clear_p99_ms() {
+  p99_ms_ = 0;
 }
-inline float CameraDistortion::_internal_k_3() const {
-  return k_3_;
+inline float StageLatency::_internal_p99_ms() const {
+  return p99_ms_;
 }
-inline float CameraDistortion::k_3() const {
-  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.CameraDistortion.K_3)
-  return _internal_k_3();
+inline float StageLatency::p99_ms() const {
+  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.StageLatency.p99_ms)
+  return _internal_p99_ms();
 }
-inline void CameraDistortion::_internal_set_k_3(float value) {
+inline void StageLatency::_internal_set_p99_ms(float value) {
   
-  k_3_ = value;
+  p99_ms_ = value;
 }
-inline void CameraDistortion::set_k_3(float value) {
-  _internal_set_k_3(value);
-  // @@protoc_insertion_point(field_set:com.bcom.solar.gprc.CameraDistortion.K_3)
+inline void StageLatency::set_p99_ms(float value) {
+  _internal_set_p99_ms(value);
+  // @@protoc_insertion_point(field_set:com.bcom.solar.gprc.StageLatency.p99_ms)
+}
+
+// float p999_ms = 6;
+inline void StageLatency::clear_p999_ms() {
+  p999_ms_ = 0;
+}
+inline float StageLatency::_internal_p999_ms() const {
+  return p999_ms_;
+}
+inline float StageLatency::p999_ms() const {
+  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.StageLatency.p999_ms)
+  return _internal_p999_ms();
+}
+inline void StageLatency::_internal_set_p999_ms(float value) {
+  
+  p999_ms_ = value;
+}
+inline void StageLatency::set_p999_ms(float value) {
+  _internal_set_p999_ms(value);
+  // @@protoc_insertion_point(field_set:com.bcom.solar.gprc.StageLatency.p999_ms)
+}
+
+// float max_ms = 7;
+inline void StageLatency::clear_max_ms() {
+  max_ms_ = 0;
+}
+inline float StageLatency::_internal_max_ms() const {
+  return max_ms_;
+}
+inline float StageLatency::max_ms() const {
+  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.StageLatency.max_ms)
+  return _internal_max_ms();
+}
+inline void StageLatency::_internal_set_max_ms(float value) {
+  
+  max_ms_ = value;
+}
+inline void StageLatency::set_max_ms(float value) {
+  _internal_set_max_ms(value);
+  // @@protoc_insertion_point(field_set:com.bcom.solar.gprc.StageLatency.max_ms)
 }
 
 // -------------------------------------------------------------------
 
-// RectificationParameters
+// ProxyStats
 
-// string client_uuid = 1;
-inline void RectificationParameters::clear_client_uuid() {
-  client_uuid_.ClearToEmpty();
-}
-inline const std::string& RectificationParameters::client_uuid() const {
-  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.RectificationParameters.client_uuid)
-  return _internal_client_uuid();
+// .com.bcom.solar.gprc.StageLatency queue_wait = 1;
+inline bool ProxyStats::_internal_has_queue_wait() const {
+  return this != internal_default_instance() && queue_wait_ != nullptr;
 }
-inline void RectificationParameters::set_client_uuid(const std::string& value) {
-  _internal_set_client_uuid(value);
-  // @@protoc_insertion_point(field_set:com.bcom.solar.gprc.RectificationParameters.client_uuid)
+inline bool ProxyStats::has_queue_wait() const {
+  return _internal_has_queue_wait();
 }
-inline std::string* RectificationParameters::mutable_client_uuid() {
-  // @@protoc_insertion_point(field_mutable:com.bcom.solar.gprc.RectificationParameters.client_uuid)
-  return _internal_mutable_client_uuid();
+inline void ProxyStats::clear_queue_wait() {
+  if (GetArena() == nullptr && queue_wait_ != nullptr) {
+    delete queue_wait_;
+  }
+  queue_wait_ = nullptr;
 }
-inline const std::string& RectificationParameters::_internal_client_uuid() const {
-  return client_uuid_.Get();
+inline const ::com::bcom::solar::gprc::StageLatency& ProxyStats::_internal_queue_wait() const {
+  const ::com::bcom::solar::gprc::StageLatency* p = queue_wait_;
+  return p != nullptr ? *p : reinterpret_cast<const ::com::bcom::solar::gprc::StageLatency&>(
+      ::com::bcom::solar::gprc::_StageLatency_default_instance_);
 }
-inline void RectificationParameters::_internal_set_client_uuid(const std::string& value) {
-  
-  client_uuid_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArena());
+inline const ::com::bcom::solar::gprc::StageLatency& ProxyStats::queue_wait() const {
+  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.ProxyStats.queue_wait)
+  return _internal_queue_wait();
 }
-inline void RectificationParameters::set_client_uuid(std::string&& value) {
-  
-  client_uuid_.Set(
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:com.bcom.solar.gprc.RectificationParameters.client_uuid)
+inline void ProxyStats::unsafe_arena_set_allocated_queue_wait(
+    ::com::bcom::solar::gprc::StageLatency* queue_wait) {
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(queue_wait_);
+  }
+  queue_wait_ = queue_wait;
+  if (queue_wait) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:com.bcom.solar.gprc.ProxyStats.queue_wait)
 }
-inline void RectificationParameters::set_client_uuid(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
+inline ::com::bcom::solar::gprc::StageLatency* ProxyStats::release_queue_wait() {
   
-  client_uuid_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(value), GetArena());
-  // @@protoc_insertion_point(field_set_char:com.bcom.solar.gprc.RectificationParameters.client_uuid)
+  ::com::bcom::solar::gprc::StageLatency* temp = queue_wait_;
+  queue_wait_ = nullptr;
+  if (GetArena() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+  return temp;
 }
-inline void RectificationParameters::set_client_uuid(const char* value,
-    size_t size) {
+inline ::com::bcom::solar::gprc::StageLatency* ProxyStats::unsafe_arena_release_queue_wait() {
+  // @@protoc_insertion_point(field_release:com.bcom.solar.gprc.ProxyStats.queue_wait)
   
-  client_uuid_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:com.bcom.solar.gprc.RectificationParameters.client_uuid)
+  ::com::bcom::solar::gprc::StageLatency* temp = queue_wait_;
+  queue_wait_ = nullptr;
+  return temp;
 }
-inline std::string* RectificationParameters::_internal_mutable_client_uuid() {
+inline ::com::bcom::solar::gprc::StageLatency* ProxyStats::_internal_mutable_queue_wait() {
   
-  return client_uuid_.Mutable(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArena());
+  if (queue_wait_ == nullptr) {
+    auto* p = CreateMaybeMessage<::com::bcom::solar::gprc::StageLatency>(GetArena());
+    queue_wait_ = p;
+  }
+  return queue_wait_;
 }
-inline std::string* RectificationParameters::release_client_uuid() {
-  // @@protoc_insertion_point(field_release:com.bcom.solar.gprc.RectificationParameters.client_uuid)
-  return client_uuid_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline ::com::bcom::solar::gprc::StageLatency* ProxyStats::mutable_queue_wait() {
+  // @@protoc_insertion_point(field_mutable:com.bcom.solar.gprc.ProxyStats.queue_wait)
+  return _internal_mutable_queue_wait();
 }
-inline void RectificationParameters::set_allocated_client_uuid(std::string* client_uuid) {
-  if (client_uuid != nullptr) {
+inline void ProxyStats::set_allocated_queue_wait(::com::bcom::solar::gprc::StageLatency* queue_wait) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  if (message_arena == nullptr) {
+    delete queue_wait_;
+  }
+  if (queue_wait) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(queue_wait);
+    if (message_arena != submessage_arena) {
+      queue_wait = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, queue_wait, submessage_arena);
+    }
     
   } else {
     
   }
-  client_uuid_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), client_uuid,
-      GetArena());
-  // @@protoc_insertion_point(field_set_allocated:com.bcom.solar.gprc.RectificationParameters.client_uuid)
+  queue_wait_ = queue_wait;
+  // @@protoc_insertion_point(field_set_allocated:com.bcom.solar.gprc.ProxyStats.queue_wait)
 }
 
-// .com.bcom.solar.gprc.Matrix3x3 cam1_rotation = 2;
-inline bool RectificationParameters::_internal_has_cam1_rotation() const {
-  return this != internal_default_instance() && cam1_rotation_ != nullptr;
+// .com.bcom.solar.gprc.StageLatency decode = 2;
+inline bool ProxyStats::_internal_has_decode() const {
+  return this != internal_default_instance() && decode_ != nullptr;
 }
-inline bool RectificationParameters::has_cam1_rotation() const {
-  return _internal_has_cam1_rotation();
+inline bool ProxyStats::has_decode() const {
+  return _internal_has_decode();
 }
-inline void RectificationParameters::clear_cam1_rotation() {
-  if (GetArena() == nullptr && cam1_rotation_ != nullptr) {
-    delete cam1_rotation_;
+inline void ProxyStats::clear_decode() {
+  if (GetArena() == nullptr && decode_ != nullptr) {
+    delete decode_;
   }
-  cam1_rotation_ = nullptr;
+  decode_ = nullptr;
 }
-inline const ::com::bcom::solar::gprc::Matrix3x3& RectificationParameters::_internal_cam1_rotation() const {
-  const ::com::bcom::solar::gprc::Matrix3x3* p = cam1_rotation_;
-  return p != nullptr ? *p : reinterpret_cast<const ::com::bcom::solar::gprc::Matrix3x3&>(
-      ::com::bcom::solar::gprc::_Matrix3x3_default_instance_);
+inline const ::com::bcom::solar::gprc::StageLatency& ProxyStats::_internal_decode() const {
+  const ::com::bcom::solar::gprc::StageLatency* p = decode_;
+  return p != nullptr ? *p : reinterpret_cast<const ::com::bcom::solar::gprc::StageLatency&>(
+      ::com::bcom::solar::gprc::_StageLatency_default_instance_);
 }
-inline const ::com::bcom::solar::gprc::Matrix3x3& RectificationParameters::cam1_rotation() const {
-  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.RectificationParameters.cam1_rotation)
-  return _internal_cam1_rotation();
+inline const ::com::bcom::solar::gprc::StageLatency& ProxyStats::decode() const {
+  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.ProxyStats.decode)
+  return _internal_decode();
 }
-inline void RectificationParameters::unsafe_arena_set_allocated_cam1_rotation(
-    ::com::bcom::solar::gprc::Matrix3x3* cam1_rotation) {
+inline void ProxyStats::unsafe_arena_set_allocated_decode(
+    ::com::bcom::solar::gprc::StageLatency* decode) {
   if (GetArena() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(cam1_rotation_);
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(decode_);
   }
-  cam1_rotation_ = cam1_rotation;
-  if (cam1_rotation) {
+  decode_ = decode;
+  if (decode) {
     
   } else {
     
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:com.bcom.solar.gprc.RectificationParameters.cam1_rotation)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:com.bcom.solar.gprc.ProxyStats.decode)
 }
-inline ::com::bcom::solar::gprc::Matrix3x3* RectificationParameters::release_cam1_rotation() {
+inline ::com::bcom::solar::gprc::StageLatency* ProxyStats::release_decode() {
   
-  ::com::bcom::solar::gprc::Matrix3x3* temp = cam1_rotation_;
-  cam1_rotation_ = nullptr;
+  ::com::bcom::solar::gprc::StageLatency* temp = decode_;
+  decode_ = nullptr;
   if (GetArena() != nullptr) {
     temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
   }
   return temp;
 }
-inline ::com::bcom::solar::gprc::Matrix3x3* RectificationParameters::unsafe_arena_release_cam1_rotation() {
-  // @@protoc_insertion_point(field_release:com.bcom.solar.gprc.RectificationParameters.cam1_rotation)
+inline ::com::bcom::solar::gprc::StageLatency* ProxyStats::unsafe_arena_release_decode() {
+  // @@protoc_insertion_point(field_release:com.bcom.solar.gprc.ProxyStats.decode)
   
-  ::com::bcom::solar::gprc::Matrix3x3* temp = cam1_rotation_;
-  cam1_rotation_ = nullptr;
+  ::com::bcom::solar::gprc::StageLatency* temp = decode_;
+  decode_ = nullptr;
   return temp;
 }
-inline ::com::bcom::solar::gprc::Matrix3x3* RectificationParameters::_internal_mutable_cam1_rotation() {
+inline ::com::bcom::solar::gprc::StageLatency* ProxyStats::_internal_mutable_decode() {
   
-  if (cam1_rotation_ == nullptr) {
-    auto* p = CreateMaybeMessage<::com::bcom::solar::gprc::Matrix3x3>(GetArena());
-    cam1_rotation_ = p;
+  if (decode_ == nullptr) {
+    auto* p = CreateMaybeMessage<::com::bcom::solar::gprc::StageLatency>(GetArena());
+    decode_ = p;
   }
-  return cam1_rotation_;
+  return decode_;
 }
-inline ::com::bcom::solar::gprc::Matrix3x3* RectificationParameters::mutable_cam1_rotation() {
-  // @@protoc_insertion_point(field_mutable:com.bcom.solar.gprc.RectificationParameters.cam1_rotation)
-  return _internal_mutable_cam1_rotation();
+inline ::com::bcom::solar::gprc::StageLatency* ProxyStats::mutable_decode() {
+  // @@protoc_insertion_point(field_mutable:com.bcom.solar.gprc.ProxyStats.decode)
+  return _internal_mutable_decode();
 }
-inline void RectificationParameters::set_allocated_cam1_rotation(::com::bcom::solar::gprc::Matrix3x3* cam1_rotation) {
+inline void ProxyStats::set_allocated_decode(::com::bcom::solar::gprc::StageLatency* decode) {
   ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
   if (message_arena == nullptr) {
-    delete cam1_rotation_;
+    delete decode_;
   }
-  if (cam1_rotation) {
+  if (decode) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(cam1_rotation);
+      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(decode);
     if (message_arena != submessage_arena) {
-      cam1_rotation = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, cam1_rotation, submessage_arena);
+      decode = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, decode, submessage_arena);
     }
     
   } else {
     
   }
-  cam1_rotation_ = cam1_rotation;
-  // @@protoc_insertion_point(field_set_allocated:com.bcom.solar.gprc.RectificationParameters.cam1_rotation)
+  decode_ = decode;
+  // @@protoc_insertion_point(field_set_allocated:com.bcom.solar.gprc.ProxyStats.decode)
 }
 
-// .com.bcom.solar.gprc.Matrix3x4 cam1_projection = 3;
-inline bool RectificationParameters::_internal_has_cam1_projection() const {
-  return this != internal_default_instance() && cam1_projection_ != nullptr;
+// .com.bcom.solar.gprc.StageLatency reorder = 3;
+inline bool ProxyStats::_internal_has_reorder() const {
+  return this != internal_default_instance() && reorder_ != nullptr;
 }
-inline bool RectificationParameters::has_cam1_projection() const {
-  return _internal_has_cam1_projection();
+inline bool ProxyStats::has_reorder() const {
+  return _internal_has_reorder();
 }
-inline void RectificationParameters::clear_cam1_projection() {
-  if (GetArena() == nullptr && cam1_projection_ != nullptr) {
-    delete cam1_projection_;
+inline void ProxyStats::clear_reorder() {
+  if (GetArena() == nullptr && reorder_ != nullptr) {
+    delete reorder_;
   }
-  cam1_projection_ = nullptr;
+  reorder_ = nullptr;
 }
-inline const ::com::bcom::solar::gprc::Matrix3x4& RectificationParameters::_internal_cam1_projection() const {
-  const ::com::bcom::solar::gprc::Matrix3x4* p = cam1_projection_;
-  return p != nullptr ? *p : reinterpret_cast<const ::com::bcom::solar::gprc::Matrix3x4&>(
-      ::com::bcom::solar::gprc::_Matrix3x4_default_instance_);
+inline const ::com::bcom::solar::gprc::StageLatency& ProxyStats::_internal_reorder() const {
+  const ::com::bcom::solar::gprc::StageLatency* p = reorder_;
+  return p != nullptr ? *p : reinterpret_cast<const ::com::bcom::solar::gprc::StageLatency&>(
+      ::com::bcom::solar::gprc::_StageLatency_default_instance_);
 }
-inline const ::com::bcom::solar::gprc::Matrix3x4& RectificationParameters::cam1_projection() const {
-  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.RectificationParameters.cam1_projection)
-  return _internal_cam1_projection();
+inline const ::com::bcom::solar::gprc::StageLatency& ProxyStats::reorder() const {
+  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.ProxyStats.reorder)
+  return _internal_reorder();
 }
-inline void RectificationParameters::unsafe_arena_set_allocated_cam1_projection(
-    ::com::bcom::solar::gprc::Matrix3x4* cam1_projection) {
+inline void ProxyStats::unsafe_arena_set_allocated_reorder(
+    ::com::bcom::solar::gprc::StageLatency* reorder) {
   if (GetArena() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(cam1_projection_);
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(reorder_);
   }
-  cam1_projection_ = cam1_projection;
-  if (cam1_projection) {
+  reorder_ = reorder;
+  if (reorder) {
     
   } else {
     
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:com.bcom.solar.gprc.RectificationParameters.cam1_projection)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:com.bcom.solar.gprc.ProxyStats.reorder)
 }
-inline ::com::bcom::solar::gprc::Matrix3x4* RectificationParameters::release_cam1_projection() {
+inline ::com::bcom::solar::gprc::StageLatency* ProxyStats::release_reorder() {
   
-  ::com::bcom::solar::gprc::Matrix3x4* temp = cam1_projection_;
-  cam1_projection_ = nullptr;
+  ::com::bcom::solar::gprc::StageLatency* temp = reorder_;
+  reorder_ = nullptr;
   if (GetArena() != nullptr) {
     temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
   }
   return temp;
 }
-inline ::com::bcom::solar::gprc::Matrix3x4* RectificationParameters::unsafe_arena_release_cam1_projection() {
-  // @@protoc_insertion_point(field_release:com.bcom.solar.gprc.RectificationParameters.cam1_projection)
+inline ::com::bcom::solar::gprc::StageLatency* ProxyStats::unsafe_arena_release_reorder() {
+  // @@protoc_insertion_point(field_release:com.bcom.solar.gprc.ProxyStats.reorder)
   
-  ::com::bcom::solar::gprc::Matrix3x4* temp = cam1_projection_;
-  cam1_projection_ = nullptr;
+  ::com::bcom::solar::gprc::StageLatency* temp = reorder_;
+  reorder_ = nullptr;
   return temp;
 }
-inline ::com::bcom::solar::gprc::Matrix3x4* RectificationParameters::_internal_mutable_cam1_projection() {
+inline ::com::bcom::solar::gprc::StageLatency* ProxyStats::_internal_mutable_reorder() {
   
-  if (cam1_projection_ == nullptr) {
-    auto* p = CreateMaybeMessage<::com::bcom::solar::gprc::Matrix3x4>(GetArena());
-    cam1_projection_ = p;
+  if (reorder_ == nullptr) {
+    auto* p = CreateMaybeMessage<::com::bcom::solar::gprc::StageLatency>(GetArena());
+    reorder_ = p;
   }
-  return cam1_projection_;
+  return reorder_;
 }
-inline ::com::bcom::solar::gprc::Matrix3x4* RectificationParameters::mutable_cam1_projection() {
-  // @@protoc_insertion_point(field_mutable:com.bcom.solar.gprc.RectificationParameters.cam1_projection)
-  return _internal_mutable_cam1_projection();
+inline ::com::bcom::solar::gprc::StageLatency* ProxyStats::mutable_reorder() {
+  // @@protoc_insertion_point(field_mutable:com.bcom.solar.gprc.ProxyStats.reorder)
+  return _internal_mutable_reorder();
 }
-inline void RectificationParameters::set_allocated_cam1_projection(::com::bcom::solar::gprc::Matrix3x4* cam1_projection) {
+inline void ProxyStats::set_allocated_reorder(::com::bcom::solar::gprc::StageLatency* reorder) {
   ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
   if (message_arena == nullptr) {
-    delete cam1_projection_;
+    delete reorder_;
   }
-  if (cam1_projection) {
+  if (reorder) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(cam1_projection);
+      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(reorder);
     if (message_arena != submessage_arena) {
-      cam1_projection = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, cam1_projection, submessage_arena);
+      reorder = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, reorder, submessage_arena);
     }
     
   } else {
     
   }
-  cam1_projection_ = cam1_projection;
-  // @@protoc_insertion_point(field_set_allocated:com.bcom.solar.gprc.RectificationParameters.cam1_projection)
-}
-
-// .com.bcom.solar.gprc.StereoType cam1_stereo_type = 4;
-inline void RectificationParameters::clear_cam1_stereo_type() {
-  cam1_stereo_type_ = 0;
-}
-inline ::com::bcom::solar::gprc::StereoType RectificationParameters::_internal_cam1_stereo_type() const {
-  return static_cast< ::com::bcom::solar::gprc::StereoType >(cam1_stereo_type_);
-}
-inline ::com::bcom::solar::gprc::StereoType RectificationParameters::cam1_stereo_type() const {
-  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.RectificationParameters.cam1_stereo_type)
-  return _internal_cam1_stereo_type();
-}
-inline void RectificationParameters::_internal_set_cam1_stereo_type(::com::bcom::solar::gprc::StereoType value) {
-  
-  cam1_stereo_type_ = value;
-}
-inline void RectificationParameters::set_cam1_stereo_type(::com::bcom::solar::gprc::StereoType value) {
-  _internal_set_cam1_stereo_type(value);
-  // @@protoc_insertion_point(field_set:com.bcom.solar.gprc.RectificationParameters.cam1_stereo_type)
-}
-
-// float cam1_baseline = 5;
-inline void RectificationParameters::clear_cam1_baseline() {
-  cam1_baseline_ = 0;
-}
-inline float RectificationParameters::_internal_cam1_baseline() const {
-  return cam1_baseline_;
-}
-inline float RectificationParameters::cam1_baseline() const {
-  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.RectificationParameters.cam1_baseline)
-  return _internal_cam1_baseline();
-}
-inline void RectificationParameters::_internal_set_cam1_baseline(float value) {
-  
-  cam1_baseline_ = value;
-}
-inline void RectificationParameters::set_cam1_baseline(float value) {
-  _internal_set_cam1_baseline(value);
-  // @@protoc_insertion_point(field_set:com.bcom.solar.gprc.RectificationParameters.cam1_baseline)
+  reorder_ = reorder;
+  // @@protoc_insertion_point(field_set_allocated:com.bcom.solar.gprc.ProxyStats.reorder)
 }
 
-// .com.bcom.solar.gprc.Matrix3x3 cam2_rotation = 6;
-inline bool RectificationParameters::_internal_has_cam2_rotation() const {
-  return this != internal_default_instance() && cam2_rotation_ != nullptr;
+// .com.bcom.solar.gprc.StageLatency front_end = 4;
+inline bool ProxyStats::_internal_has_front_end() const {
+  return this != internal_default_instance() && front_end_ != nullptr;
 }
-inline bool RectificationParameters::has_cam2_rotation() const {
-  return _internal_has_cam2_rotation();
+inline bool ProxyStats::has_front_end() const {
+  return _internal_has_front_end();
 }
-inline void RectificationParameters::clear_cam2_rotation() {
-  if (GetArena() == nullptr && cam2_rotation_ != nullptr) {
-    delete cam2_rotation_;
+inline void ProxyStats::clear_front_end() {
+  if (GetArena() == nullptr && front_end_ != nullptr) {
+    delete front_end_;
   }
-  cam2_rotation_ = nullptr;
+  front_end_ = nullptr;
 }
-inline const ::com::bcom::solar::gprc::Matrix3x3& RectificationParameters::_internal_cam2_rotation() const {
-  const ::com::bcom::solar::gprc::Matrix3x3* p = cam2_rotation_;
-  return p != nullptr ? *p : reinterpret_cast<const ::com::bcom::solar::gprc::Matrix3x3&>(
-      ::com::bcom::solar::gprc::_Matrix3x3_default_instance_);
+inline const ::com::bcom::solar::gprc::StageLatency& ProxyStats::_internal_front_end() const {
+  const ::com::bcom::solar::gprc::StageLatency* p = front_end_;
+  return p != nullptr ? *p : reinterpret_cast<const ::com::bcom::solar::gprc::StageLatency&>(
+      ::com::bcom::solar::gprc::_StageLatency_default_instance_);
 }
-inline const ::com::bcom::solar::gprc::Matrix3x3& RectificationParameters::cam2_rotation() const {
-  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.RectificationParameters.cam2_rotation)
-  return _internal_cam2_rotation();
+inline const ::com::bcom::solar::gprc::StageLatency& ProxyStats::front_end() const {
+  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.ProxyStats.front_end)
+  return _internal_front_end();
 }
-inline void RectificationParameters::unsafe_arena_set_allocated_cam2_rotation(
-    ::com::bcom::solar::gprc::Matrix3x3* cam2_rotation) {
+inline void ProxyStats::unsafe_arena_set_allocated_front_end(
+    ::com::bcom::solar::gprc::StageLatency* front_end) {
   if (GetArena() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(cam2_rotation_);
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(front_end_);
   }
-  cam2_rotation_ = cam2_rotation;
-  if (cam2_rotation) {
+  front_end_ = front_end;
+  if (front_end) {
     
   } else {
     
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:com.bcom.solar.gprc.RectificationParameters.cam2_rotation)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:com.bcom.solar.gprc.ProxyStats.front_end)
 }
-inline ::com::bcom::solar::gprc::Matrix3x3* RectificationParameters::release_cam2_rotation() {
+inline ::com::bcom::solar::gprc::StageLatency* ProxyStats::release_front_end() {
   
-  ::com::bcom::solar::gprc::Matrix3x3* temp = cam2_rotation_;
-  cam2_rotation_ = nullptr;
+  ::com::bcom::solar::gprc::StageLatency* temp = front_end_;
+  front_end_ = nullptr;
   if (GetArena() != nullptr) {
     temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
   }
   return temp;
 }
-inline ::com::bcom::solar::gprc::Matrix3x3* RectificationParameters::unsafe_arena_release_cam2_rotation() {
-  // @@protoc_insertion_point(field_release:com.bcom.solar.gprc.RectificationParameters.cam2_rotation)
+inline ::com::bcom::solar::gprc::StageLatency* ProxyStats::unsafe_arena_release_front_end() {
+  // @@protoc_insertion_point(field_release:com.bcom.solar.gprc.ProxyStats.front_end)
   
-  ::com::bcom::solar::gprc::Matrix3x3* temp = cam2_rotation_;
-  cam2_rotation_ = nullptr;
+  ::com::bcom::solar::gprc::StageLatency* temp = front_end_;
+  front_end_ = nullptr;
   return temp;
 }
-inline ::com::bcom::solar::gprc::Matrix3x3* RectificationParameters::_internal_mutable_cam2_rotation() {
+inline ::com::bcom::solar::gprc::StageLatency* ProxyStats::_internal_mutable_front_end() {
   
-  if (cam2_rotation_ == nullptr) {
-    auto* p = CreateMaybeMessage<::com::bcom::solar::gprc::Matrix3x3>(GetArena());
-    cam2_rotation_ = p;
+  if (front_end_ == nullptr) {
+    auto* p = CreateMaybeMessage<::com::bcom::solar::gprc::StageLatency>(GetArena());
+    front_end_ = p;
   }
-  return cam2_rotation_;
+  return front_end_;
 }
-inline ::com::bcom::solar::gprc::Matrix3x3* RectificationParameters::mutable_cam2_rotation() {
-  // @@protoc_insertion_point(field_mutable:com.bcom.solar.gprc.RectificationParameters.cam2_rotation)
-  return _internal_mutable_cam2_rotation();
+inline ::com::bcom::solar::gprc::StageLatency* ProxyStats::mutable_front_end() {
+  // @@protoc_insertion_point(field_mutable:com.bcom.solar.gprc.ProxyStats.front_end)
+  return _internal_mutable_front_end();
 }
-inline void RectificationParameters::set_allocated_cam2_rotation(::com::bcom::solar::gprc::Matrix3x3* cam2_rotation) {
+inline void ProxyStats::set_allocated_front_end(::com::bcom::solar::gprc::StageLatency* front_end) {
   ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
   if (message_arena == nullptr) {
-    delete cam2_rotation_;
+    delete front_end_;
   }
-  if (cam2_rotation) {
+  if (front_end) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(cam2_rotation);
+      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(front_end);
     if (message_arena != submessage_arena) {
-      cam2_rotation = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, cam2_rotation, submessage_arena);
+      front_end = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, front_end, submessage_arena);
     }
     
   } else {
     
   }
-  cam2_rotation_ = cam2_rotation;
-  // @@protoc_insertion_point(field_set_allocated:com.bcom.solar.gprc.RectificationParameters.cam2_rotation)
+  front_end_ = front_end;
+  // @@protoc_insertion_point(field_set_allocated:com.bcom.solar.gprc.ProxyStats.front_end)
 }
 
-// .com.bcom.solar.gprc.Matrix3x4 cam2_projection = 7;
-inline bool RectificationParameters::_internal_has_cam2_projection() const {
-  return this != internal_default_instance() && cam2_projection_ != nullptr;
+// .com.bcom.solar.gprc.StageLatency total = 5;
+inline bool ProxyStats::_internal_has_total() const {
+  return this != internal_default_instance() && total_ != nullptr;
 }
-inline bool RectificationParameters::has_cam2_projection() const {
-  return _internal_has_cam2_projection();
+inline bool ProxyStats::has_total() const {
+  return _internal_has_total();
 }
-inline void RectificationParameters::clear_cam2_projection() {
-  if (GetArena() == nullptr && cam2_projection_ != nullptr) {
-    delete cam2_projection_;
+inline void ProxyStats::clear_total() {
+  if (GetArena() == nullptr && total_ != nullptr) {
+    delete total_;
   }
-  cam2_projection_ = nullptr;
+  total_ = nullptr;
 }
-inline const ::com::bcom::solar::gprc::Matrix3x4& RectificationParameters::_internal_cam2_projection() const {
-  const ::com::bcom::solar::gprc::Matrix3x4* p = cam2_projection_;
-  return p != nullptr ? *p : reinterpret_cast<const ::com::bcom::solar::gprc::Matrix3x4&>(
-      ::com::bcom::solar::gprc::_Matrix3x4_default_instance_);
+inline const ::com::bcom::solar::gprc::StageLatency& ProxyStats::_internal_total() const {
+  const ::com::bcom::solar::gprc::StageLatency* p = total_;
+  return p != nullptr ? *p : reinterpret_cast<const ::com::bcom::solar::gprc::StageLatency&>(
+      ::com::bcom::solar::gprc::_StageLatency_default_instance_);
 }
-inline const ::com::bcom::solar::gprc::Matrix3x4& RectificationParameters::cam2_projection() const {
-  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.RectificationParameters.cam2_projection)
-  return _internal_cam2_projection();
+inline const ::com::bcom::solar::gprc::StageLatency& ProxyStats::total() const {
+  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.ProxyStats.total)
+  return _internal_total();
 }
-inline void RectificationParameters::unsafe_arena_set_allocated_cam2_projection(
-    ::com::bcom::solar::gprc::Matrix3x4* cam2_projection) {
+inline void ProxyStats::unsafe_arena_set_allocated_total(
+    ::com::bcom::solar::gprc::StageLatency* total) {
   if (GetArena() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(cam2_projection_);
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(total_);
   }
-  cam2_projection_ = cam2_projection;
-  if (cam2_projection) {
+  total_ = total;
+  if (total) {
     
   } else {
     
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:com.bcom.solar.gprc.RectificationParameters.cam2_projection)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:com.bcom.solar.gprc.ProxyStats.total)
 }
-inline ::com::bcom::solar::gprc::Matrix3x4* RectificationParameters::release_cam2_projection() {
+inline ::com::bcom::solar::gprc::StageLatency* ProxyStats::release_total() {
   
-  ::com::bcom::solar::gprc::Matrix3x4* temp = cam2_projection_;
-  cam2_projection_ = nullptr;
+  ::com::bcom::solar::gprc::StageLatency* temp = total_;
+  total_ = nullptr;
   if (GetArena() != nullptr) {
     temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
   }
   return temp;
 }
-inline ::com::bcom::solar::gprc::Matrix3x4* RectificationParameters::unsafe_arena_release_cam2_projection() {
-  // @@protoc_insertion_point(field_release:com.bcom.solar.gprc.RectificationParameters.cam2_projection)
+inline ::com::bcom::solar::gprc::StageLatency* ProxyStats::unsafe_arena_release_total() {
+  // @@protoc_insertion_point(field_release:com.bcom.solar.gprc.ProxyStats.total)
   
-  ::com::bcom::solar::gprc::Matrix3x4* temp = cam2_projection_;
-  cam2_projection_ = nullptr;
+  ::com::bcom::solar::gprc::StageLatency* temp = total_;
+  total_ = nullptr;
   return temp;
 }
-inline ::com::bcom::solar::gprc::Matrix3x4* RectificationParameters::_internal_mutable_cam2_projection() {
+inline ::com::bcom::solar::gprc::StageLatency* ProxyStats::_internal_mutable_total() {
   
-  if (cam2_projection_ == nullptr) {
-    auto* p = CreateMaybeMessage<::com::bcom::solar::gprc::Matrix3x4>(GetArena());
-    cam2_projection_ = p;
+  if (total_ == nullptr) {
+    auto* p = CreateMaybeMessage<::com::bcom::solar::gprc::StageLatency>(GetArena());
+    total_ = p;
   }
-  return cam2_projection_;
+  return total_;
+}
+inline ::com::bcom::solar::gprc::StageLatency* ProxyStats::mutable_total() {
+  // @@protoc_insertion_point(field_mutable:com.bcom.solar.gprc.ProxyStats.total)
+  return _internal_mutable_total();
+}
+inline void ProxyStats::set_allocated_total(::com::bcom::solar::gprc::StageLatency* total) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  if (message_arena == nullptr) {
+    delete total_;
+  }
+  if (total) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(total);
+    if (message_arena != submessage_arena) {
+      total = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, total, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  total_ = total;
+  // @@protoc_insertion_point(field_set_allocated:com.bcom.solar.gprc.ProxyStats.total)
+}
+
+// uint64 nb_requests = 6;
+inline void ProxyStats::clear_nb_requests() {
+  nb_requests_ = PROTOBUF_ULONGLONG(0);
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 ProxyStats::_internal_nb_requests() const {
+  return nb_requests_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 ProxyStats::nb_requests() const {
+  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.ProxyStats.nb_requests)
+  return _internal_nb_requests();
+}
+inline void ProxyStats::_internal_set_nb_requests(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  
+  nb_requests_ = value;
+}
+inline void ProxyStats::set_nb_requests(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  _internal_set_nb_requests(value);
+  // @@protoc_insertion_point(field_set:com.bcom.solar.gprc.ProxyStats.nb_requests)
+}
+
+// uint64 nb_errors = 7;
+inline void ProxyStats::clear_nb_errors() {
+  nb_errors_ = PROTOBUF_ULONGLONG(0);
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 ProxyStats::_internal_nb_errors() const {
+  return nb_errors_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 ProxyStats::nb_errors() const {
+  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.ProxyStats.nb_errors)
+  return _internal_nb_errors();
+}
+inline void ProxyStats::_internal_set_nb_errors(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  
+  nb_errors_ = value;
+}
+inline void ProxyStats::set_nb_errors(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  _internal_set_nb_errors(value);
+  // @@protoc_insertion_point(field_set:com.bcom.solar.gprc.ProxyStats.nb_errors)
+}
+
+// uint64 nb_rejected = 8;
+inline void ProxyStats::clear_nb_rejected() {
+  nb_rejected_ = PROTOBUF_ULONGLONG(0);
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 ProxyStats::_internal_nb_rejected() const {
+  return nb_rejected_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 ProxyStats::nb_rejected() const {
+  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.ProxyStats.nb_rejected)
+  return _internal_nb_rejected();
+}
+inline void ProxyStats::_internal_set_nb_rejected(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  
+  nb_rejected_ = value;
+}
+inline void ProxyStats::set_nb_rejected(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  _internal_set_nb_rejected(value);
+  // @@protoc_insertion_point(field_set:com.bcom.solar.gprc.ProxyStats.nb_rejected)
+}
+
+// uint64 nb_late_dropped = 9;
+inline void ProxyStats::clear_nb_late_dropped() {
+  nb_late_dropped_ = PROTOBUF_ULONGLONG(0);
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 ProxyStats::_internal_nb_late_dropped() const {
+  return nb_late_dropped_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 ProxyStats::nb_late_dropped() const {
+  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.ProxyStats.nb_late_dropped)
+  return _internal_nb_late_dropped();
+}
+inline void ProxyStats::_internal_set_nb_late_dropped(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  
+  nb_late_dropped_ = value;
+}
+inline void ProxyStats::set_nb_late_dropped(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  _internal_set_nb_late_dropped(value);
+  // @@protoc_insertion_point(field_set:com.bcom.solar.gprc.ProxyStats.nb_late_dropped)
+}
+
+// uint64 nb_shrink_dropped = 10;
+inline void ProxyStats::clear_nb_shrink_dropped() {
+  nb_shrink_dropped_ = PROTOBUF_ULONGLONG(0);
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 ProxyStats::_internal_nb_shrink_dropped() const {
+  return nb_shrink_dropped_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 ProxyStats::nb_shrink_dropped() const {
+  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.ProxyStats.nb_shrink_dropped)
+  return _internal_nb_shrink_dropped();
+}
+inline void ProxyStats::_internal_set_nb_shrink_dropped(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  
+  nb_shrink_dropped_ = value;
+}
+inline void ProxyStats::set_nb_shrink_dropped(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  _internal_set_nb_shrink_dropped(value);
+  // @@protoc_insertion_point(field_set:com.bcom.solar.gprc.ProxyStats.nb_shrink_dropped)
+}
+
+// uint64 nb_overload_dropped = 11;
+inline void ProxyStats::clear_nb_overload_dropped() {
+  nb_overload_dropped_ = PROTOBUF_ULONGLONG(0);
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 ProxyStats::_internal_nb_overload_dropped() const {
+  return nb_overload_dropped_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 ProxyStats::nb_overload_dropped() const {
+  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.ProxyStats.nb_overload_dropped)
+  return _internal_nb_overload_dropped();
+}
+inline void ProxyStats::_internal_set_nb_overload_dropped(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  
+  nb_overload_dropped_ = value;
+}
+inline void ProxyStats::set_nb_overload_dropped(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  _internal_set_nb_overload_dropped(value);
+  // @@protoc_insertion_point(field_set:com.bcom.solar.gprc.ProxyStats.nb_overload_dropped)
+}
+
+// uint64 nb_latest_pose_replies = 12;
+inline void ProxyStats::clear_nb_latest_pose_replies() {
+  nb_latest_pose_replies_ = PROTOBUF_ULONGLONG(0);
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 ProxyStats::_internal_nb_latest_pose_replies() const {
+  return nb_latest_pose_replies_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 ProxyStats::nb_latest_pose_replies() const {
+  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.ProxyStats.nb_latest_pose_replies)
+  return _internal_nb_latest_pose_replies();
+}
+inline void ProxyStats::_internal_set_nb_latest_pose_replies(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  
+  nb_latest_pose_replies_ = value;
+}
+inline void ProxyStats::set_nb_latest_pose_replies(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  _internal_set_nb_latest_pose_replies(value);
+  // @@protoc_insertion_point(field_set:com.bcom.solar.gprc.ProxyStats.nb_latest_pose_replies)
+}
+
+// uint64 nb_motion_gated = 13;
+inline void ProxyStats::clear_nb_motion_gated() {
+  nb_motion_gated_ = PROTOBUF_ULONGLONG(0);
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 ProxyStats::_internal_nb_motion_gated() const {
+  return nb_motion_gated_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 ProxyStats::nb_motion_gated() const {
+  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.ProxyStats.nb_motion_gated)
+  return _internal_nb_motion_gated();
+}
+inline void ProxyStats::_internal_set_nb_motion_gated(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  
+  nb_motion_gated_ = value;
+}
+inline void ProxyStats::set_nb_motion_gated(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  _internal_set_nb_motion_gated(value);
+  // @@protoc_insertion_point(field_set:com.bcom.solar.gprc.ProxyStats.nb_motion_gated)
+}
+
+// uint64 nb_duplicates = 14;
+inline void ProxyStats::clear_nb_duplicates() {
+  nb_duplicates_ = PROTOBUF_ULONGLONG(0);
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 ProxyStats::_internal_nb_duplicates() const {
+  return nb_duplicates_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 ProxyStats::nb_duplicates() const {
+  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.ProxyStats.nb_duplicates)
+  return _internal_nb_duplicates();
 }
-inline ::com::bcom::solar::gprc::Matrix3x4* RectificationParameters::mutable_cam2_projection() {
-  // @@protoc_insertion_point(field_mutable:com.bcom.solar.gprc.RectificationParameters.cam2_projection)
-  return _internal_mutable_cam2_projection();
+inline void ProxyStats::_internal_set_nb_duplicates(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  
+  nb_duplicates_ = value;
 }
-inline void RectificationParameters::set_allocated_cam2_projection(::com::bcom::solar::gprc::Matrix3x4* cam2_projection) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
-  if (message_arena == nullptr) {
-    delete cam2_projection_;
-  }
-  if (cam2_projection) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(cam2_projection);
-    if (message_arena != submessage_arena) {
-      cam2_projection = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, cam2_projection, submessage_arena);
-    }
-    
-  } else {
-    
-  }
-  cam2_projection_ = cam2_projection;
-  // @@protoc_insertion_point(field_set_allocated:com.bcom.solar.gprc.RectificationParameters.cam2_projection)
+inline void ProxyStats::set_nb_duplicates(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  _internal_set_nb_duplicates(value);
+  // @@protoc_insertion_point(field_set:com.bcom.solar.gprc.ProxyStats.nb_duplicates)
 }
 
-// .com.bcom.solar.gprc.StereoType cam2_stereo_type = 8;
-inline void RectificationParameters::clear_cam2_stereo_type() {
-  cam2_stereo_type_ = 0;
+// uint64 nb_mode_switches = 15;
+inline void ProxyStats::clear_nb_mode_switches() {
+  nb_mode_switches_ = PROTOBUF_ULONGLONG(0);
 }
-inline ::com::bcom::solar::gprc::StereoType RectificationParameters::_internal_cam2_stereo_type() const {
-  return static_cast< ::com::bcom::solar::gprc::StereoType >(cam2_stereo_type_);
+inline ::PROTOBUF_NAMESPACE_ID::uint64 ProxyStats::_internal_nb_mode_switches() const {
+  return nb_mode_switches_;
 }
-inline ::com::bcom::solar::gprc::StereoType RectificationParameters::cam2_stereo_type() const {
-  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.RectificationParameters.cam2_stereo_type)
-  return _internal_cam2_stereo_type();
+inline ::PROTOBUF_NAMESPACE_ID::uint64 ProxyStats::nb_mode_switches() const {
+  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.ProxyStats.nb_mode_switches)
+  return _internal_nb_mode_switches();
 }
-inline void RectificationParameters::_internal_set_cam2_stereo_type(::com::bcom::solar::gprc::StereoType value) {
+inline void ProxyStats::_internal_set_nb_mode_switches(::PROTOBUF_NAMESPACE_ID::uint64 value) {
   
-  cam2_stereo_type_ = value;
+  nb_mode_switches_ = value;
 }
-inline void RectificationParameters::set_cam2_stereo_type(::com::bcom::solar::gprc::StereoType value) {
-  _internal_set_cam2_stereo_type(value);
-  // @@protoc_insertion_point(field_set:com.bcom.solar.gprc.RectificationParameters.cam2_stereo_type)
+inline void ProxyStats::set_nb_mode_switches(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  _internal_set_nb_mode_switches(value);
+  // @@protoc_insertion_point(field_set:com.bcom.solar.gprc.ProxyStats.nb_mode_switches)
 }
 
-// float cam2_baseline = 9;
-inline void RectificationParameters::clear_cam2_baseline() {
-  cam2_baseline_ = 0;
+// uint32 reorder_depth = 16;
+inline void ProxyStats::clear_reorder_depth() {
+  reorder_depth_ = 0u;
 }
-inline float RectificationParameters::_internal_cam2_baseline() const {
-  return cam2_baseline_;
+inline ::PROTOBUF_NAMESPACE_ID::uint32 ProxyStats::_internal_reorder_depth() const {
+  return reorder_depth_;
 }
-inline float RectificationParameters::cam2_baseline() const {
-  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.RectificationParameters.cam2_baseline)
-  return _internal_cam2_baseline();
+inline ::PROTOBUF_NAMESPACE_ID::uint32 ProxyStats::reorder_depth() const {
+  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.ProxyStats.reorder_depth)
+  return _internal_reorder_depth();
 }
-inline void RectificationParameters::_internal_set_cam2_baseline(float value) {
+inline void ProxyStats::_internal_set_reorder_depth(::PROTOBUF_NAMESPACE_ID::uint32 value) {
   
-  cam2_baseline_ = value;
+  reorder_depth_ = value;
 }
-inline void RectificationParameters::set_cam2_baseline(float value) {
-  _internal_set_cam2_baseline(value);
-  // @@protoc_insertion_point(field_set:com.bcom.solar.gprc.RectificationParameters.cam2_baseline)
+inline void ProxyStats::set_reorder_depth(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  _internal_set_reorder_depth(value);
+  // @@protoc_insertion_point(field_set:com.bcom.solar.gprc.ProxyStats.reorder_depth)
 }
 
-// -------------------------------------------------------------------
-
-// RelocalizationResult
+// float jitter_ms = 17;
+inline void ProxyStats::clear_jitter_ms() {
+  jitter_ms_ = 0;
+}
+inline float ProxyStats::_internal_jitter_ms() const {
+  return jitter_ms_;
+}
+inline float ProxyStats::jitter_ms() const {
+  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.ProxyStats.jitter_ms)
+  return _internal_jitter_ms();
+}
+inline void ProxyStats::_internal_set_jitter_ms(float value) {
+  
+  jitter_ms_ = value;
+}
+inline void ProxyStats::set_jitter_ms(float value) {
+  _internal_set_jitter_ms(value);
+  // @@protoc_insertion_point(field_set:com.bcom.solar.gprc.ProxyStats.jitter_ms)
+}
 
-// .com.bcom.solar.gprc.RelocalizationPoseStatus pose_status = 1;
-inline void RelocalizationResult::clear_pose_status() {
-  pose_status_ = 0;
+// float out_of_order_rate = 18;
+inline void ProxyStats::clear_out_of_order_rate() {
+  out_of_order_rate_ = 0;
 }
-inline ::com::bcom::solar::gprc::RelocalizationPoseStatus RelocalizationResult::_internal_pose_status() const {
-  return static_cast< ::com::bcom::solar::gprc::RelocalizationPoseStatus >(pose_status_);
+inline float ProxyStats::_internal_out_of_order_rate() const {
+  return out_of_order_rate_;
 }
-inline ::com::bcom::solar::gprc::RelocalizationPoseStatus RelocalizationResult::pose_status() const {
-  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.RelocalizationResult.pose_status)
-  return _internal_pose_status();
+inline float ProxyStats::out_of_order_rate() const {
+  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.ProxyStats.out_of_order_rate)
+  return _internal_out_of_order_rate();
 }
-inline void RelocalizationResult::_internal_set_pose_status(::com::bcom::solar::gprc::RelocalizationPoseStatus value) {
+inline void ProxyStats::_internal_set_out_of_order_rate(float value) {
   
-  pose_status_ = value;
+  out_of_order_rate_ = value;
 }
-inline void RelocalizationResult::set_pose_status(::com::bcom::solar::gprc::RelocalizationPoseStatus value) {
-  _internal_set_pose_status(value);
-  // @@protoc_insertion_point(field_set:com.bcom.solar.gprc.RelocalizationResult.pose_status)
+inline void ProxyStats::set_out_of_order_rate(float value) {
+  _internal_set_out_of_order_rate(value);
+  // @@protoc_insertion_point(field_set:com.bcom.solar.gprc.ProxyStats.out_of_order_rate)
 }
 
-// .com.bcom.solar.gprc.Matrix4x4 pose = 2;
-inline bool RelocalizationResult::_internal_has_pose() const {
-  return this != internal_default_instance() && pose_ != nullptr;
+// -------------------------------------------------------------------
+
+// ProxyStatsResult
+
+// .com.bcom.solar.gprc.ProxyStats proxy = 1;
+inline bool ProxyStatsResult::_internal_has_proxy() const {
+  return this != internal_default_instance() && proxy_ != nullptr;
 }
-inline bool RelocalizationResult::has_pose() const {
-  return _internal_has_pose();
+inline bool ProxyStatsResult::has_proxy() const {
+  return _internal_has_proxy();
 }
-inline void RelocalizationResult::clear_pose() {
-  if (GetArena() == nullptr && pose_ != nullptr) {
-    delete pose_;
+inline void ProxyStatsResult::clear_proxy() {
+  if (GetArena() == nullptr && proxy_ != nullptr) {
+    delete proxy_;
   }
-  pose_ = nullptr;
+  proxy_ = nullptr;
 }
-inline const ::com::bcom::solar::gprc::Matrix4x4& RelocalizationResult::_internal_pose() const {
-  const ::com::bcom::solar::gprc::Matrix4x4* p = pose_;
-  return p != nullptr ? *p : reinterpret_cast<const ::com::bcom::solar::gprc::Matrix4x4&>(
-      ::com::bcom::solar::gprc::_Matrix4x4_default_instance_);
+inline const ::com::bcom::solar::gprc::ProxyStats& ProxyStatsResult::_internal_proxy() const {
+  const ::com::bcom::solar::gprc::ProxyStats* p = proxy_;
+  return p != nullptr ? *p : reinterpret_cast<const ::com::bcom::solar::gprc::ProxyStats&>(
+      ::com::bcom::solar::gprc::_ProxyStats_default_instance_);
 }
-inline const ::com::bcom::solar::gprc::Matrix4x4& RelocalizationResult::pose() const {
-  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.RelocalizationResult.pose)
-  return _internal_pose();
+inline const ::com::bcom::solar::gprc::ProxyStats& ProxyStatsResult::proxy() const {
+  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.ProxyStatsResult.proxy)
+  return _internal_proxy();
 }
-inline void RelocalizationResult::unsafe_arena_set_allocated_pose(
-    ::com::bcom::solar::gprc::Matrix4x4* pose) {
+inline void ProxyStatsResult::unsafe_arena_set_allocated_proxy(
+    ::com::bcom::solar::gprc::ProxyStats* proxy) {
   if (GetArena() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(pose_);
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(proxy_);
   }
-  pose_ = pose;
-  if (pose) {
+  proxy_ = proxy;
+  if (proxy) {
     
   } else {
     
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:com.bcom.solar.gprc.RelocalizationResult.pose)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:com.bcom.solar.gprc.ProxyStatsResult.proxy)
 }
-inline ::com::bcom::solar::gprc::Matrix4x4* RelocalizationResult::release_pose() {
+inline ::com::bcom::solar::gprc::ProxyStats* ProxyStatsResult::release_proxy() {
   
-  ::com::bcom::solar::gprc::Matrix4x4* temp = pose_;
-  pose_ = nullptr;
+  ::com::bcom::solar::gprc::ProxyStats* temp = proxy_;
+  proxy_ = nullptr;
   if (GetArena() != nullptr) {
     temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
   }
   return temp;
 }
-inline ::com::bcom::solar::gprc::Matrix4x4* RelocalizationResult::unsafe_arena_release_pose() {
-  // @@protoc_insertion_point(field_release:com.bcom.solar.gprc.RelocalizationResult.pose)
+inline ::com::bcom::solar::gprc::ProxyStats* ProxyStatsResult::unsafe_arena_release_proxy() {
+  // @@protoc_insertion_point(field_release:com.bcom.solar.gprc.ProxyStatsResult.proxy)
   
-  ::com::bcom::solar::gprc::Matrix4x4* temp = pose_;
-  pose_ = nullptr;
+  ::com::bcom::solar::gprc::ProxyStats* temp = proxy_;
+  proxy_ = nullptr;
   return temp;
 }
-inline ::com::bcom::solar::gprc::Matrix4x4* RelocalizationResult::_internal_mutable_pose() {
+inline ::com::bcom::solar::gprc::ProxyStats* ProxyStatsResult::_internal_mutable_proxy() {
   
-  if (pose_ == nullptr) {
-    auto* p = CreateMaybeMessage<::com::bcom::solar::gprc::Matrix4x4>(GetArena());
-    pose_ = p;
+  if (proxy_ == nullptr) {
+    auto* p = CreateMaybeMessage<::com::bcom::solar::gprc::ProxyStats>(GetArena());
+    proxy_ = p;
   }
-  return pose_;
+  return proxy_;
 }
-inline ::com::bcom::solar::gprc::Matrix4x4* RelocalizationResult::mutable_pose() {
-  // @@protoc_insertion_point(field_mutable:com.bcom.solar.gprc.RelocalizationResult.pose)
-  return _internal_mutable_pose();
+inline ::com::bcom::solar::gprc::ProxyStats* ProxyStatsResult::mutable_proxy() {
+  // @@protoc_insertion_point(field_mutable:com.bcom.solar.gprc.ProxyStatsResult.proxy)
+  return _internal_mutable_proxy();
 }
-inline void RelocalizationResult::set_allocated_pose(::com::bcom::solar::gprc::Matrix4x4* pose) {
+inline void ProxyStatsResult::set_allocated_proxy(::com::bcom::solar::gprc::ProxyStats* proxy) {
   ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
   if (message_arena == nullptr) {
-    delete pose_;
+    delete proxy_;
   }
-  if (pose) {
+  if (proxy) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(pose);
+      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(proxy);
     if (message_arena != submessage_arena) {
-      pose = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, pose, submessage_arena);
+      proxy = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, proxy, submessage_arena);
     }
     
   } else {
     
   }
-  pose_ = pose;
-  // @@protoc_insertion_point(field_set_allocated:com.bcom.solar.gprc.RelocalizationResult.pose)
+  proxy_ = proxy;
+  // @@protoc_insertion_point(field_set_allocated:com.bcom.solar.gprc.ProxyStatsResult.proxy)
 }
 
-// float confidence = 3;
-inline void RelocalizationResult::clear_confidence() {
-  confidence_ = 0;
+// .com.bcom.solar.gprc.ProxyStats client = 2;
+inline bool ProxyStatsResult::_internal_has_client() const {
+  return this != internal_default_instance() && client_ != nullptr;
 }
-inline float RelocalizationResult::_internal_confidence() const {
-  return confidence_;
+inline bool ProxyStatsResult::has_client() const {
+  return _internal_has_client();
 }
-inline float RelocalizationResult::confidence() const {
-  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.RelocalizationResult.confidence)
-  return _internal_confidence();
+inline void ProxyStatsResult::clear_client() {
+  if (GetArena() == nullptr && client_ != nullptr) {
+    delete client_;
+  }
+  client_ = nullptr;
 }
-inline void RelocalizationResult::_internal_set_confidence(float value) {
-  
-  confidence_ = value;
+inline const ::com::bcom::solar::gprc::ProxyStats& ProxyStatsResult::_internal_client() const {
+  const ::com::bcom::solar::gprc::ProxyStats* p = client_;
+  return p != nullptr ? *p : reinterpret_cast<const ::com::bcom::solar::gprc::ProxyStats&>(
+      ::com::bcom::solar::gprc::_ProxyStats_default_instance_);
 }
-inline void RelocalizationResult::set_confidence(float value) {
-  _internal_set_confidence(value);
-  // @@protoc_insertion_point(field_set:com.bcom.solar.gprc.RelocalizationResult.confidence)
+inline const ::com::bcom::solar::gprc::ProxyStats& ProxyStatsResult::client() const {
+  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.ProxyStatsResult.client)
+  return _internal_client();
 }
-
-// .com.bcom.solar.gprc.MappingStatus mapping_status = 4;
-inline void RelocalizationResult::clear_mapping_status() {
-  mapping_status_ = 0;
+inline void ProxyStatsResult::unsafe_arena_set_allocated_client(
+    ::com::bcom::solar::gprc::ProxyStats* client) {
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(client_);
+  }
+  client_ = client;
+  if (client) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:com.bcom.solar.gprc.ProxyStatsResult.client)
 }
-inline ::com::bcom::solar::gprc::MappingStatus RelocalizationResult::_internal_mapping_status() const {
-  return static_cast< ::com::bcom::solar::gprc::MappingStatus >(mapping_status_);
+inline ::com::bcom::solar::gprc::ProxyStats* ProxyStatsResult::release_client() {
+  
+  ::com::bcom::solar::gprc::ProxyStats* temp = client_;
+  client_ = nullptr;
+  if (GetArena() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+  return temp;
 }
-inline ::com::bcom::solar::gprc::MappingStatus RelocalizationResult::mapping_status() const {
-  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.RelocalizationResult.mapping_status)
-  return _internal_mapping_status();
+inline ::com::bcom::solar::gprc::ProxyStats* ProxyStatsResult::unsafe_arena_release_client() {
+  // @@protoc_insertion_point(field_release:com.bcom.solar.gprc.ProxyStatsResult.client)
+  
+  ::com::bcom::solar::gprc::ProxyStats* temp = client_;
+  client_ = nullptr;
+  return temp;
 }
-inline void RelocalizationResult::_internal_set_mapping_status(::com::bcom::solar::gprc::MappingStatus value) {
+inline ::com::bcom::solar::gprc::ProxyStats* ProxyStatsResult::_internal_mutable_client() {
   
-  mapping_status_ = value;
+  if (client_ == nullptr) {
+    auto* p = CreateMaybeMessage<::com::bcom::solar::gprc::ProxyStats>(GetArena());
+    client_ = p;
+  }
+  return client_;
 }
-inline void RelocalizationResult::set_mapping_status(::com::bcom::solar::gprc::MappingStatus value) {
-  _internal_set_mapping_status(value);
-  // @@protoc_insertion_point(field_set:com.bcom.solar.gprc.RelocalizationResult.mapping_status)
+inline ::com::bcom::solar::gprc::ProxyStats* ProxyStatsResult::mutable_client() {
+  // @@protoc_insertion_point(field_mutable:com.bcom.solar.gprc.ProxyStatsResult.client)
+  return _internal_mutable_client();
+}
+inline void ProxyStatsResult::set_allocated_client(::com::bcom::solar::gprc::ProxyStats* client) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  if (message_arena == nullptr) {
+    delete client_;
+  }
+  if (client) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(client);
+    if (message_arena != submessage_arena) {
+      client = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, client, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  client_ = client;
+  // @@protoc_insertion_point(field_set_allocated:com.bcom.solar.gprc.ProxyStatsResult.client)
 }
 
 // -------------------------------------------------------------------
@@ -5958,6 +8223,130 @@ Frames::frames() const {
 
 // -------------------------------------------------------------------
 
+// FramesBatch
+
+// string client_uuid = 1;
+inline void FramesBatch::clear_client_uuid() {
+  client_uuid_.ClearToEmpty();
+}
+inline const std::string& FramesBatch::client_uuid() const {
+  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.FramesBatch.client_uuid)
+  return _internal_client_uuid();
+}
+inline void FramesBatch::set_client_uuid(const std::string& value) {
+  _internal_set_client_uuid(value);
+  // @@protoc_insertion_point(field_set:com.bcom.solar.gprc.FramesBatch.client_uuid)
+}
+inline std::string* FramesBatch::mutable_client_uuid() {
+  // @@protoc_insertion_point(field_mutable:com.bcom.solar.gprc.FramesBatch.client_uuid)
+  return _internal_mutable_client_uuid();
+}
+inline const std::string& FramesBatch::_internal_client_uuid() const {
+  return client_uuid_.Get();
+}
+inline void FramesBatch::_internal_set_client_uuid(const std::string& value) {
+  
+  client_uuid_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArena());
+}
+inline void FramesBatch::set_client_uuid(std::string&& value) {
+  
+  client_uuid_.Set(
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::move(value), GetArena());
+  // @@protoc_insertion_point(field_set_rvalue:com.bcom.solar.gprc.FramesBatch.client_uuid)
+}
+inline void FramesBatch::set_client_uuid(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  
+  client_uuid_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(value), GetArena());
+  // @@protoc_insertion_point(field_set_char:com.bcom.solar.gprc.FramesBatch.client_uuid)
+}
+inline void FramesBatch::set_client_uuid(const char* value,
+    size_t size) {
+  
+  client_uuid_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArena());
+  // @@protoc_insertion_point(field_set_pointer:com.bcom.solar.gprc.FramesBatch.client_uuid)
+}
+inline std::string* FramesBatch::_internal_mutable_client_uuid() {
+  
+  return client_uuid_.Mutable(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArena());
+}
+inline std::string* FramesBatch::release_client_uuid() {
+  // @@protoc_insertion_point(field_release:com.bcom.solar.gprc.FramesBatch.client_uuid)
+  return client_uuid_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline void FramesBatch::set_allocated_client_uuid(std::string* client_uuid) {
+  if (client_uuid != nullptr) {
+    
+  } else {
+    
+  }
+  client_uuid_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), client_uuid,
+      GetArena());
+  // @@protoc_insertion_point(field_set_allocated:com.bcom.solar.gprc.FramesBatch.client_uuid)
+}
+
+// repeated .com.bcom.solar.gprc.Frames frames = 2;
+inline int FramesBatch::_internal_frames_size() const {
+  return frames_.size();
+}
+inline int FramesBatch::frames_size() const {
+  return _internal_frames_size();
+}
+inline void FramesBatch::clear_frames() {
+  frames_.Clear();
+}
+inline ::com::bcom::solar::gprc::Frames* FramesBatch::mutable_frames(int index) {
+  // @@protoc_insertion_point(field_mutable:com.bcom.solar.gprc.FramesBatch.frames)
+  return frames_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::com::bcom::solar::gprc::Frames >*
+FramesBatch::mutable_frames() {
+  // @@protoc_insertion_point(field_mutable_list:com.bcom.solar.gprc.FramesBatch.frames)
+  return &frames_;
+}
+inline const ::com::bcom::solar::gprc::Frames& FramesBatch::_internal_frames(int index) const {
+  return frames_.Get(index);
+}
+inline const ::com::bcom::solar::gprc::Frames& FramesBatch::frames(int index) const {
+  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.FramesBatch.frames)
+  return _internal_frames(index);
+}
+inline ::com::bcom::solar::gprc::Frames* FramesBatch::_internal_add_frames() {
+  return frames_.Add();
+}
+inline ::com::bcom::solar::gprc::Frames* FramesBatch::add_frames() {
+  // @@protoc_insertion_point(field_add:com.bcom.solar.gprc.FramesBatch.frames)
+  return _internal_add_frames();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::com::bcom::solar::gprc::Frames >&
+FramesBatch::frames() const {
+  // @@protoc_insertion_point(field_list:com.bcom.solar.gprc.FramesBatch.frames)
+  return frames_;
+}
+
+// bool last_result_only = 3;
+inline void FramesBatch::clear_last_result_only() {
+  last_result_only_ = false;
+}
+inline bool FramesBatch::_internal_last_result_only() const {
+  return last_result_only_;
+}
+inline bool FramesBatch::last_result_only() const {
+  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.FramesBatch.last_result_only)
+  return _internal_last_result_only();
+}
+inline void FramesBatch::_internal_set_last_result_only(bool value) {
+  
+  last_result_only_ = value;
+}
+inline void FramesBatch::set_last_result_only(bool value) {
+  _internal_set_last_result_only(value);
+  // @@protoc_insertion_point(field_set:com.bcom.solar.gprc.FramesBatch.last_result_only)
+}
+
+// -------------------------------------------------------------------
+
 // GroundTruthFrames
 
 // string client_uuid = 1;
@@ -7202,6 +9591,16 @@ inline void Matrix3x4::set_m34(float value) {
 
 // -------------------------------------------------------------------
 
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 
@@ -7217,6 +9616,11 @@ template <>
 inline const EnumDescriptor* GetEnumDescriptor< ::com::bcom::solar::gprc::PipelineMode>() {
   return ::com::bcom::solar::gprc::PipelineMode_descriptor();
 }
+template <> struct is_proto_enum< ::com::bcom::solar::gprc::ImageRotation> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::com::bcom::solar::gprc::ImageRotation>() {
+  return ::com::bcom::solar::gprc::ImageRotation_descriptor();
+}
 template <> struct is_proto_enum< ::com::bcom::solar::gprc::CameraType> : ::std::true_type {};
 template <>
 inline const EnumDescriptor* GetEnumDescriptor< ::com::bcom::solar::gprc::CameraType>() {
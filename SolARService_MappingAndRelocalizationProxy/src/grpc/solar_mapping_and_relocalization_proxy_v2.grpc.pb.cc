@@ -0,0 +1,751 @@
+// Generated by the gRPC C++ plugin.
+// If you make any local change, they will be lost.
+// source: solar_mapping_and_relocalization_proxy_v2.proto
+
+#include "solar_mapping_and_relocalization_proxy_v2.pb.h"
+#include "solar_mapping_and_relocalization_proxy_v2.grpc.pb.h"
+
+#include <functional>
+#include <grpcpp/impl/codegen/async_stream.h>
+#include <grpcpp/impl/codegen/async_unary_call.h>
+#include <grpcpp/impl/codegen/channel_interface.h>
+#include <grpcpp/impl/codegen/client_unary_call.h>
+#include <grpcpp/impl/codegen/client_callback.h>
+#include <grpcpp/impl/codegen/message_allocator.h>
+#include <grpcpp/impl/codegen/method_handler.h>
+#include <grpcpp/impl/codegen/rpc_service_method.h>
+#include <grpcpp/impl/codegen/server_callback.h>
+#include <grpcpp/impl/codegen/server_callback_handlers.h>
+#include <grpcpp/impl/codegen/server_context.h>
+#include <grpcpp/impl/codegen/service_type.h>
+#include <grpcpp/impl/codegen/sync_stream.h>
+namespace com {
+namespace bcom {
+namespace solar {
+namespace gprc {
+namespace v2 {
+
+static const char* SolARMappingAndRelocalizationProxy_method_names[] = {
+  "/com.bcom.solar.gprc.v2.SolARMappingAndRelocalizationProxy/RegisterClient",
+  "/com.bcom.solar.gprc.v2.SolARMappingAndRelocalizationProxy/UnregisterClient",
+  "/com.bcom.solar.gprc.v2.SolARMappingAndRelocalizationProxy/Init",
+  "/com.bcom.solar.gprc.v2.SolARMappingAndRelocalizationProxy/Start",
+  "/com.bcom.solar.gprc.v2.SolARMappingAndRelocalizationProxy/Stop",
+  "/com.bcom.solar.gprc.v2.SolARMappingAndRelocalizationProxy/SetCameraParameters",
+  "/com.bcom.solar.gprc.v2.SolARMappingAndRelocalizationProxy/SetCameraParametersStereo",
+  "/com.bcom.solar.gprc.v2.SolARMappingAndRelocalizationProxy/SetRectificationParameters",
+  "/com.bcom.solar.gprc.v2.SolARMappingAndRelocalizationProxy/RelocalizeAndMap",
+  "/com.bcom.solar.gprc.v2.SolARMappingAndRelocalizationProxy/RelocalizeAndMapGroundTruth",
+  "/com.bcom.solar.gprc.v2.SolARMappingAndRelocalizationProxy/RelocalizeAndMapStream",
+  "/com.bcom.solar.gprc.v2.SolARMappingAndRelocalizationProxy/RelocalizeAndMapBatch",
+  "/com.bcom.solar.gprc.v2.SolARMappingAndRelocalizationProxy/Get3DTransform",
+  "/com.bcom.solar.gprc.v2.SolARMappingAndRelocalizationProxy/SubscribeTransforms",
+  "/com.bcom.solar.gprc.v2.SolARMappingAndRelocalizationProxy/GetStats",
+  "/com.bcom.solar.gprc.v2.SolARMappingAndRelocalizationProxy/Reset",
+  "/com.bcom.solar.gprc.v2.SolARMappingAndRelocalizationProxy/SendMessage",
+};
+
+std::unique_ptr< SolARMappingAndRelocalizationProxy::Stub> SolARMappingAndRelocalizationProxy::NewStub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options) {
+  (void)options;
+  std::unique_ptr< SolARMappingAndRelocalizationProxy::Stub> stub(new SolARMappingAndRelocalizationProxy::Stub(channel));
+  return stub;
+}
+
+SolARMappingAndRelocalizationProxy::Stub::Stub(const std::shared_ptr< ::grpc::ChannelInterface>& channel)
+  : channel_(channel), rpcmethod_RegisterClient_(SolARMappingAndRelocalizationProxy_method_names[0], ::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_UnregisterClient_(SolARMappingAndRelocalizationProxy_method_names[1], ::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_Init_(SolARMappingAndRelocalizationProxy_method_names[2], ::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_Start_(SolARMappingAndRelocalizationProxy_method_names[3], ::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_Stop_(SolARMappingAndRelocalizationProxy_method_names[4], ::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_SetCameraParameters_(SolARMappingAndRelocalizationProxy_method_names[5], ::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_SetCameraParametersStereo_(SolARMappingAndRelocalizationProxy_method_names[6], ::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_SetRectificationParameters_(SolARMappingAndRelocalizationProxy_method_names[7], ::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_RelocalizeAndMap_(SolARMappingAndRelocalizationProxy_method_names[8], ::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_RelocalizeAndMapGroundTruth_(SolARMappingAndRelocalizationProxy_method_names[9], ::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_RelocalizeAndMapStream_(SolARMappingAndRelocalizationProxy_method_names[10], ::grpc::internal::RpcMethod::BIDI_STREAMING, channel)
+  , rpcmethod_RelocalizeAndMapBatch_(SolARMappingAndRelocalizationProxy_method_names[11], ::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_Get3DTransform_(SolARMappingAndRelocalizationProxy_method_names[12], ::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_SubscribeTransforms_(SolARMappingAndRelocalizationProxy_method_names[13], ::grpc::internal::RpcMethod::SERVER_STREAMING, channel)
+  , rpcmethod_GetStats_(SolARMappingAndRelocalizationProxy_method_names[14], ::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_Reset_(SolARMappingAndRelocalizationProxy_method_names[15], ::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_SendMessage_(SolARMappingAndRelocalizationProxy_method_names[16], ::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  {}
+
+::grpc::Status SolARMappingAndRelocalizationProxy::Stub::RegisterClient(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::Empty& request, ::com::bcom::solar::gprc::ClientUUID* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::com::bcom::solar::gprc::Empty, ::com::bcom::solar::gprc::ClientUUID, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_RegisterClient_, context, request, response);
+}
+
+void SolARMappingAndRelocalizationProxy::Stub::experimental_async::RegisterClient(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::Empty* request, ::com::bcom::solar::gprc::ClientUUID* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::com::bcom::solar::gprc::Empty, ::com::bcom::solar::gprc::ClientUUID, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_RegisterClient_, context, request, response, std::move(f));
+}
+
+void SolARMappingAndRelocalizationProxy::Stub::experimental_async::RegisterClient(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::Empty* request, ::com::bcom::solar::gprc::ClientUUID* response, ::grpc::experimental::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_RegisterClient_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::com::bcom::solar::gprc::ClientUUID>* SolARMappingAndRelocalizationProxy::Stub::PrepareAsyncRegisterClientRaw(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::Empty& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::com::bcom::solar::gprc::ClientUUID, ::com::bcom::solar::gprc::Empty, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_RegisterClient_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::com::bcom::solar::gprc::ClientUUID>* SolARMappingAndRelocalizationProxy::Stub::AsyncRegisterClientRaw(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::Empty& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncRegisterClientRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
+::grpc::Status SolARMappingAndRelocalizationProxy::Stub::UnregisterClient(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::ClientUUID& request, ::com::bcom::solar::gprc::Empty* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::com::bcom::solar::gprc::ClientUUID, ::com::bcom::solar::gprc::Empty, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_UnregisterClient_, context, request, response);
+}
+
+void SolARMappingAndRelocalizationProxy::Stub::experimental_async::UnregisterClient(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::ClientUUID* request, ::com::bcom::solar::gprc::Empty* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::com::bcom::solar::gprc::ClientUUID, ::com::bcom::solar::gprc::Empty, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_UnregisterClient_, context, request, response, std::move(f));
+}
+
+void SolARMappingAndRelocalizationProxy::Stub::experimental_async::UnregisterClient(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::ClientUUID* request, ::com::bcom::solar::gprc::Empty* response, ::grpc::experimental::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_UnregisterClient_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::com::bcom::solar::gprc::Empty>* SolARMappingAndRelocalizationProxy::Stub::PrepareAsyncUnregisterClientRaw(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::ClientUUID& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::com::bcom::solar::gprc::Empty, ::com::bcom::solar::gprc::ClientUUID, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_UnregisterClient_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::com::bcom::solar::gprc::Empty>* SolARMappingAndRelocalizationProxy::Stub::AsyncUnregisterClientRaw(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::ClientUUID& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncUnregisterClientRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
+::grpc::Status SolARMappingAndRelocalizationProxy::Stub::Init(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::PipelineModeValue& request, ::com::bcom::solar::gprc::Empty* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::com::bcom::solar::gprc::PipelineModeValue, ::com::bcom::solar::gprc::Empty, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_Init_, context, request, response);
+}
+
+void SolARMappingAndRelocalizationProxy::Stub::experimental_async::Init(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::PipelineModeValue* request, ::com::bcom::solar::gprc::Empty* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::com::bcom::solar::gprc::PipelineModeValue, ::com::bcom::solar::gprc::Empty, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_Init_, context, request, response, std::move(f));
+}
+
+void SolARMappingAndRelocalizationProxy::Stub::experimental_async::Init(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::PipelineModeValue* request, ::com::bcom::solar::gprc::Empty* response, ::grpc::experimental::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_Init_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::com::bcom::solar::gprc::Empty>* SolARMappingAndRelocalizationProxy::Stub::PrepareAsyncInitRaw(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::PipelineModeValue& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::com::bcom::solar::gprc::Empty, ::com::bcom::solar::gprc::PipelineModeValue, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_Init_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::com::bcom::solar::gprc::Empty>* SolARMappingAndRelocalizationProxy::Stub::AsyncInitRaw(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::PipelineModeValue& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncInitRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
+::grpc::Status SolARMappingAndRelocalizationProxy::Stub::Start(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::ClientUUID& request, ::com::bcom::solar::gprc::Empty* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::com::bcom::solar::gprc::ClientUUID, ::com::bcom::solar::gprc::Empty, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_Start_, context, request, response);
+}
+
+void SolARMappingAndRelocalizationProxy::Stub::experimental_async::Start(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::ClientUUID* request, ::com::bcom::solar::gprc::Empty* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::com::bcom::solar::gprc::ClientUUID, ::com::bcom::solar::gprc::Empty, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_Start_, context, request, response, std::move(f));
+}
+
+void SolARMappingAndRelocalizationProxy::Stub::experimental_async::Start(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::ClientUUID* request, ::com::bcom::solar::gprc::Empty* response, ::grpc::experimental::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_Start_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::com::bcom::solar::gprc::Empty>* SolARMappingAndRelocalizationProxy::Stub::PrepareAsyncStartRaw(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::ClientUUID& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::com::bcom::solar::gprc::Empty, ::com::bcom::solar::gprc::ClientUUID, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_Start_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::com::bcom::solar::gprc::Empty>* SolARMappingAndRelocalizationProxy::Stub::AsyncStartRaw(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::ClientUUID& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncStartRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
+::grpc::Status SolARMappingAndRelocalizationProxy::Stub::Stop(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::ClientUUID& request, ::com::bcom::solar::gprc::Empty* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::com::bcom::solar::gprc::ClientUUID, ::com::bcom::solar::gprc::Empty, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_Stop_, context, request, response);
+}
+
+void SolARMappingAndRelocalizationProxy::Stub::experimental_async::Stop(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::ClientUUID* request, ::com::bcom::solar::gprc::Empty* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::com::bcom::solar::gprc::ClientUUID, ::com::bcom::solar::gprc::Empty, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_Stop_, context, request, response, std::move(f));
+}
+
+void SolARMappingAndRelocalizationProxy::Stub::experimental_async::Stop(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::ClientUUID* request, ::com::bcom::solar::gprc::Empty* response, ::grpc::experimental::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_Stop_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::com::bcom::solar::gprc::Empty>* SolARMappingAndRelocalizationProxy::Stub::PrepareAsyncStopRaw(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::ClientUUID& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::com::bcom::solar::gprc::Empty, ::com::bcom::solar::gprc::ClientUUID, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_Stop_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::com::bcom::solar::gprc::Empty>* SolARMappingAndRelocalizationProxy::Stub::AsyncStopRaw(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::ClientUUID& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncStopRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
+::grpc::Status SolARMappingAndRelocalizationProxy::Stub::SetCameraParameters(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::v2::CameraParameters& request, ::com::bcom::solar::gprc::Empty* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::com::bcom::solar::gprc::v2::CameraParameters, ::com::bcom::solar::gprc::Empty, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_SetCameraParameters_, context, request, response);
+}
+
+void SolARMappingAndRelocalizationProxy::Stub::experimental_async::SetCameraParameters(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::v2::CameraParameters* request, ::com::bcom::solar::gprc::Empty* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::com::bcom::solar::gprc::v2::CameraParameters, ::com::bcom::solar::gprc::Empty, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_SetCameraParameters_, context, request, response, std::move(f));
+}
+
+void SolARMappingAndRelocalizationProxy::Stub::experimental_async::SetCameraParameters(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::v2::CameraParameters* request, ::com::bcom::solar::gprc::Empty* response, ::grpc::experimental::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_SetCameraParameters_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::com::bcom::solar::gprc::Empty>* SolARMappingAndRelocalizationProxy::Stub::PrepareAsyncSetCameraParametersRaw(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::v2::CameraParameters& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::com::bcom::solar::gprc::Empty, ::com::bcom::solar::gprc::v2::CameraParameters, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_SetCameraParameters_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::com::bcom::solar::gprc::Empty>* SolARMappingAndRelocalizationProxy::Stub::AsyncSetCameraParametersRaw(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::v2::CameraParameters& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncSetCameraParametersRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
+::grpc::Status SolARMappingAndRelocalizationProxy::Stub::SetCameraParametersStereo(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::v2::CameraParametersStereo& request, ::com::bcom::solar::gprc::Empty* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::com::bcom::solar::gprc::v2::CameraParametersStereo, ::com::bcom::solar::gprc::Empty, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_SetCameraParametersStereo_, context, request, response);
+}
+
+void SolARMappingAndRelocalizationProxy::Stub::experimental_async::SetCameraParametersStereo(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::v2::CameraParametersStereo* request, ::com::bcom::solar::gprc::Empty* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::com::bcom::solar::gprc::v2::CameraParametersStereo, ::com::bcom::solar::gprc::Empty, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_SetCameraParametersStereo_, context, request, response, std::move(f));
+}
+
+void SolARMappingAndRelocalizationProxy::Stub::experimental_async::SetCameraParametersStereo(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::v2::CameraParametersStereo* request, ::com::bcom::solar::gprc::Empty* response, ::grpc::experimental::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_SetCameraParametersStereo_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::com::bcom::solar::gprc::Empty>* SolARMappingAndRelocalizationProxy::Stub::PrepareAsyncSetCameraParametersStereoRaw(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::v2::CameraParametersStereo& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::com::bcom::solar::gprc::Empty, ::com::bcom::solar::gprc::v2::CameraParametersStereo, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_SetCameraParametersStereo_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::com::bcom::solar::gprc::Empty>* SolARMappingAndRelocalizationProxy::Stub::AsyncSetCameraParametersStereoRaw(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::v2::CameraParametersStereo& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncSetCameraParametersStereoRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
+::grpc::Status SolARMappingAndRelocalizationProxy::Stub::SetRectificationParameters(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::v2::RectificationParameters& request, ::com::bcom::solar::gprc::Empty* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::com::bcom::solar::gprc::v2::RectificationParameters, ::com::bcom::solar::gprc::Empty, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_SetRectificationParameters_, context, request, response);
+}
+
+void SolARMappingAndRelocalizationProxy::Stub::experimental_async::SetRectificationParameters(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::v2::RectificationParameters* request, ::com::bcom::solar::gprc::Empty* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::com::bcom::solar::gprc::v2::RectificationParameters, ::com::bcom::solar::gprc::Empty, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_SetRectificationParameters_, context, request, response, std::move(f));
+}
+
+void SolARMappingAndRelocalizationProxy::Stub::experimental_async::SetRectificationParameters(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::v2::RectificationParameters* request, ::com::bcom::solar::gprc::Empty* response, ::grpc::experimental::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_SetRectificationParameters_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::com::bcom::solar::gprc::Empty>* SolARMappingAndRelocalizationProxy::Stub::PrepareAsyncSetRectificationParametersRaw(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::v2::RectificationParameters& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::com::bcom::solar::gprc::Empty, ::com::bcom::solar::gprc::v2::RectificationParameters, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_SetRectificationParameters_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::com::bcom::solar::gprc::Empty>* SolARMappingAndRelocalizationProxy::Stub::AsyncSetRectificationParametersRaw(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::v2::RectificationParameters& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncSetRectificationParametersRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
+::grpc::Status SolARMappingAndRelocalizationProxy::Stub::RelocalizeAndMap(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::v2::Frames& request, ::com::bcom::solar::gprc::v2::RelocalizationResult* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::com::bcom::solar::gprc::v2::Frames, ::com::bcom::solar::gprc::v2::RelocalizationResult, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_RelocalizeAndMap_, context, request, response);
+}
+
+void SolARMappingAndRelocalizationProxy::Stub::experimental_async::RelocalizeAndMap(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::v2::Frames* request, ::com::bcom::solar::gprc::v2::RelocalizationResult* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::com::bcom::solar::gprc::v2::Frames, ::com::bcom::solar::gprc::v2::RelocalizationResult, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_RelocalizeAndMap_, context, request, response, std::move(f));
+}
+
+void SolARMappingAndRelocalizationProxy::Stub::experimental_async::RelocalizeAndMap(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::v2::Frames* request, ::com::bcom::solar::gprc::v2::RelocalizationResult* response, ::grpc::experimental::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_RelocalizeAndMap_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::com::bcom::solar::gprc::v2::RelocalizationResult>* SolARMappingAndRelocalizationProxy::Stub::PrepareAsyncRelocalizeAndMapRaw(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::v2::Frames& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::com::bcom::solar::gprc::v2::RelocalizationResult, ::com::bcom::solar::gprc::v2::Frames, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_RelocalizeAndMap_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::com::bcom::solar::gprc::v2::RelocalizationResult>* SolARMappingAndRelocalizationProxy::Stub::AsyncRelocalizeAndMapRaw(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::v2::Frames& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncRelocalizeAndMapRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
+::grpc::Status SolARMappingAndRelocalizationProxy::Stub::RelocalizeAndMapGroundTruth(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::v2::GroundTruthFrames& request, ::com::bcom::solar::gprc::v2::RelocalizationResult* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::com::bcom::solar::gprc::v2::GroundTruthFrames, ::com::bcom::solar::gprc::v2::RelocalizationResult, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_RelocalizeAndMapGroundTruth_, context, request, response);
+}
+
+void SolARMappingAndRelocalizationProxy::Stub::experimental_async::RelocalizeAndMapGroundTruth(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::v2::GroundTruthFrames* request, ::com::bcom::solar::gprc::v2::RelocalizationResult* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::com::bcom::solar::gprc::v2::GroundTruthFrames, ::com::bcom::solar::gprc::v2::RelocalizationResult, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_RelocalizeAndMapGroundTruth_, context, request, response, std::move(f));
+}
+
+void SolARMappingAndRelocalizationProxy::Stub::experimental_async::RelocalizeAndMapGroundTruth(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::v2::GroundTruthFrames* request, ::com::bcom::solar::gprc::v2::RelocalizationResult* response, ::grpc::experimental::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_RelocalizeAndMapGroundTruth_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::com::bcom::solar::gprc::v2::RelocalizationResult>* SolARMappingAndRelocalizationProxy::Stub::PrepareAsyncRelocalizeAndMapGroundTruthRaw(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::v2::GroundTruthFrames& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::com::bcom::solar::gprc::v2::RelocalizationResult, ::com::bcom::solar::gprc::v2::GroundTruthFrames, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_RelocalizeAndMapGroundTruth_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::com::bcom::solar::gprc::v2::RelocalizationResult>* SolARMappingAndRelocalizationProxy::Stub::AsyncRelocalizeAndMapGroundTruthRaw(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::v2::GroundTruthFrames& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncRelocalizeAndMapGroundTruthRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
+::grpc::ClientReaderWriter< ::com::bcom::solar::gprc::v2::Frames, ::com::bcom::solar::gprc::v2::RelocalizationResult>* SolARMappingAndRelocalizationProxy::Stub::RelocalizeAndMapStreamRaw(::grpc::ClientContext* context) {
+  return ::grpc::internal::ClientReaderWriterFactory< ::com::bcom::solar::gprc::v2::Frames, ::com::bcom::solar::gprc::v2::RelocalizationResult>::Create(channel_.get(), rpcmethod_RelocalizeAndMapStream_, context);
+}
+
+void SolARMappingAndRelocalizationProxy::Stub::experimental_async::RelocalizeAndMapStream(::grpc::ClientContext* context, ::grpc::experimental::ClientBidiReactor< ::com::bcom::solar::gprc::v2::Frames,::com::bcom::solar::gprc::v2::RelocalizationResult>* reactor) {
+  ::grpc::internal::ClientCallbackReaderWriterFactory< ::com::bcom::solar::gprc::v2::Frames,::com::bcom::solar::gprc::v2::RelocalizationResult>::Create(stub_->channel_.get(), stub_->rpcmethod_RelocalizeAndMapStream_, context, reactor);
+}
+
+::grpc::ClientAsyncReaderWriter< ::com::bcom::solar::gprc::v2::Frames, ::com::bcom::solar::gprc::v2::RelocalizationResult>* SolARMappingAndRelocalizationProxy::Stub::AsyncRelocalizeAndMapStreamRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag) {
+  return ::grpc::internal::ClientAsyncReaderWriterFactory< ::com::bcom::solar::gprc::v2::Frames, ::com::bcom::solar::gprc::v2::RelocalizationResult>::Create(channel_.get(), cq, rpcmethod_RelocalizeAndMapStream_, context, true, tag);
+}
+
+::grpc::ClientAsyncReaderWriter< ::com::bcom::solar::gprc::v2::Frames, ::com::bcom::solar::gprc::v2::RelocalizationResult>* SolARMappingAndRelocalizationProxy::Stub::PrepareAsyncRelocalizeAndMapStreamRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncReaderWriterFactory< ::com::bcom::solar::gprc::v2::Frames, ::com::bcom::solar::gprc::v2::RelocalizationResult>::Create(channel_.get(), cq, rpcmethod_RelocalizeAndMapStream_, context, false, nullptr);
+}
+
+::grpc::Status SolARMappingAndRelocalizationProxy::Stub::RelocalizeAndMapBatch(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::v2::FramesBatch& request, ::com::bcom::solar::gprc::v2::RelocalizationResults* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::com::bcom::solar::gprc::v2::FramesBatch, ::com::bcom::solar::gprc::v2::RelocalizationResults, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_RelocalizeAndMapBatch_, context, request, response);
+}
+
+void SolARMappingAndRelocalizationProxy::Stub::experimental_async::RelocalizeAndMapBatch(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::v2::FramesBatch* request, ::com::bcom::solar::gprc::v2::RelocalizationResults* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::com::bcom::solar::gprc::v2::FramesBatch, ::com::bcom::solar::gprc::v2::RelocalizationResults, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_RelocalizeAndMapBatch_, context, request, response, std::move(f));
+}
+
+void SolARMappingAndRelocalizationProxy::Stub::experimental_async::RelocalizeAndMapBatch(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::v2::FramesBatch* request, ::com::bcom::solar::gprc::v2::RelocalizationResults* response, ::grpc::experimental::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_RelocalizeAndMapBatch_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::com::bcom::solar::gprc::v2::RelocalizationResults>* SolARMappingAndRelocalizationProxy::Stub::PrepareAsyncRelocalizeAndMapBatchRaw(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::v2::FramesBatch& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::com::bcom::solar::gprc::v2::RelocalizationResults, ::com::bcom::solar::gprc::v2::FramesBatch, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_RelocalizeAndMapBatch_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::com::bcom::solar::gprc::v2::RelocalizationResults>* SolARMappingAndRelocalizationProxy::Stub::AsyncRelocalizeAndMapBatchRaw(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::v2::FramesBatch& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncRelocalizeAndMapBatchRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
+::grpc::Status SolARMappingAndRelocalizationProxy::Stub::Get3DTransform(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::ClientUUID& request, ::com::bcom::solar::gprc::v2::RelocalizationResult* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::com::bcom::solar::gprc::ClientUUID, ::com::bcom::solar::gprc::v2::RelocalizationResult, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_Get3DTransform_, context, request, response);
+}
+
+void SolARMappingAndRelocalizationProxy::Stub::experimental_async::Get3DTransform(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::ClientUUID* request, ::com::bcom::solar::gprc::v2::RelocalizationResult* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::com::bcom::solar::gprc::ClientUUID, ::com::bcom::solar::gprc::v2::RelocalizationResult, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_Get3DTransform_, context, request, response, std::move(f));
+}
+
+void SolARMappingAndRelocalizationProxy::Stub::experimental_async::Get3DTransform(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::ClientUUID* request, ::com::bcom::solar::gprc::v2::RelocalizationResult* response, ::grpc::experimental::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_Get3DTransform_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::com::bcom::solar::gprc::v2::RelocalizationResult>* SolARMappingAndRelocalizationProxy::Stub::PrepareAsyncGet3DTransformRaw(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::ClientUUID& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::com::bcom::solar::gprc::v2::RelocalizationResult, ::com::bcom::solar::gprc::ClientUUID, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_Get3DTransform_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::com::bcom::solar::gprc::v2::RelocalizationResult>* SolARMappingAndRelocalizationProxy::Stub::AsyncGet3DTransformRaw(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::ClientUUID& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncGet3DTransformRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
+::grpc::ClientReader< ::com::bcom::solar::gprc::v2::RelocalizationResult>* SolARMappingAndRelocalizationProxy::Stub::SubscribeTransformsRaw(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::ClientUUID& request) {
+  return ::grpc::internal::ClientReaderFactory< ::com::bcom::solar::gprc::v2::RelocalizationResult>::Create(channel_.get(), rpcmethod_SubscribeTransforms_, context, request);
+}
+
+void SolARMappingAndRelocalizationProxy::Stub::experimental_async::SubscribeTransforms(::grpc::ClientContext* context, ::com::bcom::solar::gprc::ClientUUID* request, ::grpc::experimental::ClientReadReactor< ::com::bcom::solar::gprc::v2::RelocalizationResult>* reactor) {
+  ::grpc::internal::ClientCallbackReaderFactory< ::com::bcom::solar::gprc::v2::RelocalizationResult>::Create(stub_->channel_.get(), stub_->rpcmethod_SubscribeTransforms_, context, request, reactor);
+}
+
+::grpc::ClientAsyncReader< ::com::bcom::solar::gprc::v2::RelocalizationResult>* SolARMappingAndRelocalizationProxy::Stub::AsyncSubscribeTransformsRaw(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::ClientUUID& request, ::grpc::CompletionQueue* cq, void* tag) {
+  return ::grpc::internal::ClientAsyncReaderFactory< ::com::bcom::solar::gprc::v2::RelocalizationResult>::Create(channel_.get(), cq, rpcmethod_SubscribeTransforms_, context, request, true, tag);
+}
+
+::grpc::ClientAsyncReader< ::com::bcom::solar::gprc::v2::RelocalizationResult>* SolARMappingAndRelocalizationProxy::Stub::PrepareAsyncSubscribeTransformsRaw(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::ClientUUID& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncReaderFactory< ::com::bcom::solar::gprc::v2::RelocalizationResult>::Create(channel_.get(), cq, rpcmethod_SubscribeTransforms_, context, request, false, nullptr);
+}
+
+::grpc::Status SolARMappingAndRelocalizationProxy::Stub::GetStats(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::ClientUUID& request, ::com::bcom::solar::gprc::ProxyStatsResult* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::com::bcom::solar::gprc::ClientUUID, ::com::bcom::solar::gprc::ProxyStatsResult, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_GetStats_, context, request, response);
+}
+
+void SolARMappingAndRelocalizationProxy::Stub::experimental_async::GetStats(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::ClientUUID* request, ::com::bcom::solar::gprc::ProxyStatsResult* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::com::bcom::solar::gprc::ClientUUID, ::com::bcom::solar::gprc::ProxyStatsResult, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_GetStats_, context, request, response, std::move(f));
+}
+
+void SolARMappingAndRelocalizationProxy::Stub::experimental_async::GetStats(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::ClientUUID* request, ::com::bcom::solar::gprc::ProxyStatsResult* response, ::grpc::experimental::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_GetStats_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::com::bcom::solar::gprc::ProxyStatsResult>* SolARMappingAndRelocalizationProxy::Stub::PrepareAsyncGetStatsRaw(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::ClientUUID& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::com::bcom::solar::gprc::ProxyStatsResult, ::com::bcom::solar::gprc::ClientUUID, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_GetStats_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::com::bcom::solar::gprc::ProxyStatsResult>* SolARMappingAndRelocalizationProxy::Stub::AsyncGetStatsRaw(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::ClientUUID& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncGetStatsRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
+::grpc::Status SolARMappingAndRelocalizationProxy::Stub::Reset(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::Empty& request, ::com::bcom::solar::gprc::Empty* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::com::bcom::solar::gprc::Empty, ::com::bcom::solar::gprc::Empty, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_Reset_, context, request, response);
+}
+
+void SolARMappingAndRelocalizationProxy::Stub::experimental_async::Reset(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::Empty* request, ::com::bcom::solar::gprc::Empty* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::com::bcom::solar::gprc::Empty, ::com::bcom::solar::gprc::Empty, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_Reset_, context, request, response, std::move(f));
+}
+
+void SolARMappingAndRelocalizationProxy::Stub::experimental_async::Reset(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::Empty* request, ::com::bcom::solar::gprc::Empty* response, ::grpc::experimental::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_Reset_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::com::bcom::solar::gprc::Empty>* SolARMappingAndRelocalizationProxy::Stub::PrepareAsyncResetRaw(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::Empty& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::com::bcom::solar::gprc::Empty, ::com::bcom::solar::gprc::Empty, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_Reset_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::com::bcom::solar::gprc::Empty>* SolARMappingAndRelocalizationProxy::Stub::AsyncResetRaw(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::Empty& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncResetRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
+::grpc::Status SolARMappingAndRelocalizationProxy::Stub::SendMessage(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::Message& request, ::com::bcom::solar::gprc::Empty* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::com::bcom::solar::gprc::Message, ::com::bcom::solar::gprc::Empty, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_SendMessage_, context, request, response);
+}
+
+void SolARMappingAndRelocalizationProxy::Stub::experimental_async::SendMessage(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::Message* request, ::com::bcom::solar::gprc::Empty* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::com::bcom::solar::gprc::Message, ::com::bcom::solar::gprc::Empty, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_SendMessage_, context, request, response, std::move(f));
+}
+
+void SolARMappingAndRelocalizationProxy::Stub::experimental_async::SendMessage(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::Message* request, ::com::bcom::solar::gprc::Empty* response, ::grpc::experimental::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_SendMessage_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::com::bcom::solar::gprc::Empty>* SolARMappingAndRelocalizationProxy::Stub::PrepareAsyncSendMessageRaw(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::Message& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::com::bcom::solar::gprc::Empty, ::com::bcom::solar::gprc::Message, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_SendMessage_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::com::bcom::solar::gprc::Empty>* SolARMappingAndRelocalizationProxy::Stub::AsyncSendMessageRaw(::grpc::ClientContext* context, const ::com::bcom::solar::gprc::Message& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncSendMessageRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
+SolARMappingAndRelocalizationProxy::Service::Service() {
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      SolARMappingAndRelocalizationProxy_method_names[0],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< SolARMappingAndRelocalizationProxy::Service, ::com::bcom::solar::gprc::Empty, ::com::bcom::solar::gprc::ClientUUID, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](SolARMappingAndRelocalizationProxy::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::com::bcom::solar::gprc::Empty* req,
+             ::com::bcom::solar::gprc::ClientUUID* resp) {
+               return service->RegisterClient(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      SolARMappingAndRelocalizationProxy_method_names[1],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< SolARMappingAndRelocalizationProxy::Service, ::com::bcom::solar::gprc::ClientUUID, ::com::bcom::solar::gprc::Empty, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](SolARMappingAndRelocalizationProxy::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::com::bcom::solar::gprc::ClientUUID* req,
+             ::com::bcom::solar::gprc::Empty* resp) {
+               return service->UnregisterClient(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      SolARMappingAndRelocalizationProxy_method_names[2],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< SolARMappingAndRelocalizationProxy::Service, ::com::bcom::solar::gprc::PipelineModeValue, ::com::bcom::solar::gprc::Empty, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](SolARMappingAndRelocalizationProxy::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::com::bcom::solar::gprc::PipelineModeValue* req,
+             ::com::bcom::solar::gprc::Empty* resp) {
+               return service->Init(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      SolARMappingAndRelocalizationProxy_method_names[3],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< SolARMappingAndRelocalizationProxy::Service, ::com::bcom::solar::gprc::ClientUUID, ::com::bcom::solar::gprc::Empty, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](SolARMappingAndRelocalizationProxy::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::com::bcom::solar::gprc::ClientUUID* req,
+             ::com::bcom::solar::gprc::Empty* resp) {
+               return service->Start(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      SolARMappingAndRelocalizationProxy_method_names[4],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< SolARMappingAndRelocalizationProxy::Service, ::com::bcom::solar::gprc::ClientUUID, ::com::bcom::solar::gprc::Empty, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](SolARMappingAndRelocalizationProxy::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::com::bcom::solar::gprc::ClientUUID* req,
+             ::com::bcom::solar::gprc::Empty* resp) {
+               return service->Stop(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      SolARMappingAndRelocalizationProxy_method_names[5],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< SolARMappingAndRelocalizationProxy::Service, ::com::bcom::solar::gprc::v2::CameraParameters, ::com::bcom::solar::gprc::Empty, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](SolARMappingAndRelocalizationProxy::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::com::bcom::solar::gprc::v2::CameraParameters* req,
+             ::com::bcom::solar::gprc::Empty* resp) {
+               return service->SetCameraParameters(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      SolARMappingAndRelocalizationProxy_method_names[6],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< SolARMappingAndRelocalizationProxy::Service, ::com::bcom::solar::gprc::v2::CameraParametersStereo, ::com::bcom::solar::gprc::Empty, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](SolARMappingAndRelocalizationProxy::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::com::bcom::solar::gprc::v2::CameraParametersStereo* req,
+             ::com::bcom::solar::gprc::Empty* resp) {
+               return service->SetCameraParametersStereo(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      SolARMappingAndRelocalizationProxy_method_names[7],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< SolARMappingAndRelocalizationProxy::Service, ::com::bcom::solar::gprc::v2::RectificationParameters, ::com::bcom::solar::gprc::Empty, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](SolARMappingAndRelocalizationProxy::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::com::bcom::solar::gprc::v2::RectificationParameters* req,
+             ::com::bcom::solar::gprc::Empty* resp) {
+               return service->SetRectificationParameters(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      SolARMappingAndRelocalizationProxy_method_names[8],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< SolARMappingAndRelocalizationProxy::Service, ::com::bcom::solar::gprc::v2::Frames, ::com::bcom::solar::gprc::v2::RelocalizationResult, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](SolARMappingAndRelocalizationProxy::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::com::bcom::solar::gprc::v2::Frames* req,
+             ::com::bcom::solar::gprc::v2::RelocalizationResult* resp) {
+               return service->RelocalizeAndMap(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      SolARMappingAndRelocalizationProxy_method_names[9],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< SolARMappingAndRelocalizationProxy::Service, ::com::bcom::solar::gprc::v2::GroundTruthFrames, ::com::bcom::solar::gprc::v2::RelocalizationResult, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](SolARMappingAndRelocalizationProxy::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::com::bcom::solar::gprc::v2::GroundTruthFrames* req,
+             ::com::bcom::solar::gprc::v2::RelocalizationResult* resp) {
+               return service->RelocalizeAndMapGroundTruth(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      SolARMappingAndRelocalizationProxy_method_names[10],
+      ::grpc::internal::RpcMethod::BIDI_STREAMING,
+      new ::grpc::internal::BidiStreamingHandler< SolARMappingAndRelocalizationProxy::Service, ::com::bcom::solar::gprc::v2::Frames, ::com::bcom::solar::gprc::v2::RelocalizationResult>(
+          [](SolARMappingAndRelocalizationProxy::Service* service,
+             ::grpc::ServerContext* ctx,
+             ::grpc::ServerReaderWriter<::com::bcom::solar::gprc::v2::RelocalizationResult,
+             ::com::bcom::solar::gprc::v2::Frames>* stream) {
+               return service->RelocalizeAndMapStream(ctx, stream);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      SolARMappingAndRelocalizationProxy_method_names[11],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< SolARMappingAndRelocalizationProxy::Service, ::com::bcom::solar::gprc::v2::FramesBatch, ::com::bcom::solar::gprc::v2::RelocalizationResults, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](SolARMappingAndRelocalizationProxy::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::com::bcom::solar::gprc::v2::FramesBatch* req,
+             ::com::bcom::solar::gprc::v2::RelocalizationResults* resp) {
+               return service->RelocalizeAndMapBatch(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      SolARMappingAndRelocalizationProxy_method_names[12],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< SolARMappingAndRelocalizationProxy::Service, ::com::bcom::solar::gprc::ClientUUID, ::com::bcom::solar::gprc::v2::RelocalizationResult, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](SolARMappingAndRelocalizationProxy::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::com::bcom::solar::gprc::ClientUUID* req,
+             ::com::bcom::solar::gprc::v2::RelocalizationResult* resp) {
+               return service->Get3DTransform(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      SolARMappingAndRelocalizationProxy_method_names[13],
+      ::grpc::internal::RpcMethod::SERVER_STREAMING,
+      new ::grpc::internal::ServerStreamingHandler< SolARMappingAndRelocalizationProxy::Service, ::com::bcom::solar::gprc::ClientUUID, ::com::bcom::solar::gprc::v2::RelocalizationResult>(
+          [](SolARMappingAndRelocalizationProxy::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::com::bcom::solar::gprc::ClientUUID* req,
+             ::grpc::ServerWriter<::com::bcom::solar::gprc::v2::RelocalizationResult>* writer) {
+               return service->SubscribeTransforms(ctx, req, writer);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      SolARMappingAndRelocalizationProxy_method_names[14],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< SolARMappingAndRelocalizationProxy::Service, ::com::bcom::solar::gprc::ClientUUID, ::com::bcom::solar::gprc::ProxyStatsResult, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](SolARMappingAndRelocalizationProxy::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::com::bcom::solar::gprc::ClientUUID* req,
+             ::com::bcom::solar::gprc::ProxyStatsResult* resp) {
+               return service->GetStats(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      SolARMappingAndRelocalizationProxy_method_names[15],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< SolARMappingAndRelocalizationProxy::Service, ::com::bcom::solar::gprc::Empty, ::com::bcom::solar::gprc::Empty, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](SolARMappingAndRelocalizationProxy::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::com::bcom::solar::gprc::Empty* req,
+             ::com::bcom::solar::gprc::Empty* resp) {
+               return service->Reset(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      SolARMappingAndRelocalizationProxy_method_names[16],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< SolARMappingAndRelocalizationProxy::Service, ::com::bcom::solar::gprc::Message, ::com::bcom::solar::gprc::Empty, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](SolARMappingAndRelocalizationProxy::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::com::bcom::solar::gprc::Message* req,
+             ::com::bcom::solar::gprc::Empty* resp) {
+               return service->SendMessage(ctx, req, resp);
+             }, this)));
+}
+
+SolARMappingAndRelocalizationProxy::Service::~Service() {
+}
+
+::grpc::Status SolARMappingAndRelocalizationProxy::Service::RegisterClient(::grpc::ServerContext* context, const ::com::bcom::solar::gprc::Empty* request, ::com::bcom::solar::gprc::ClientUUID* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status SolARMappingAndRelocalizationProxy::Service::UnregisterClient(::grpc::ServerContext* context, const ::com::bcom::solar::gprc::ClientUUID* request, ::com::bcom::solar::gprc::Empty* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status SolARMappingAndRelocalizationProxy::Service::Init(::grpc::ServerContext* context, const ::com::bcom::solar::gprc::PipelineModeValue* request, ::com::bcom::solar::gprc::Empty* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status SolARMappingAndRelocalizationProxy::Service::Start(::grpc::ServerContext* context, const ::com::bcom::solar::gprc::ClientUUID* request, ::com::bcom::solar::gprc::Empty* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status SolARMappingAndRelocalizationProxy::Service::Stop(::grpc::ServerContext* context, const ::com::bcom::solar::gprc::ClientUUID* request, ::com::bcom::solar::gprc::Empty* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status SolARMappingAndRelocalizationProxy::Service::SetCameraParameters(::grpc::ServerContext* context, const ::com::bcom::solar::gprc::v2::CameraParameters* request, ::com::bcom::solar::gprc::Empty* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status SolARMappingAndRelocalizationProxy::Service::SetCameraParametersStereo(::grpc::ServerContext* context, const ::com::bcom::solar::gprc::v2::CameraParametersStereo* request, ::com::bcom::solar::gprc::Empty* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status SolARMappingAndRelocalizationProxy::Service::SetRectificationParameters(::grpc::ServerContext* context, const ::com::bcom::solar::gprc::v2::RectificationParameters* request, ::com::bcom::solar::gprc::Empty* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status SolARMappingAndRelocalizationProxy::Service::RelocalizeAndMap(::grpc::ServerContext* context, const ::com::bcom::solar::gprc::v2::Frames* request, ::com::bcom::solar::gprc::v2::RelocalizationResult* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status SolARMappingAndRelocalizationProxy::Service::RelocalizeAndMapGroundTruth(::grpc::ServerContext* context, const ::com::bcom::solar::gprc::v2::GroundTruthFrames* request, ::com::bcom::solar::gprc::v2::RelocalizationResult* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status SolARMappingAndRelocalizationProxy::Service::RelocalizeAndMapStream(::grpc::ServerContext* context, ::grpc::ServerReaderWriter< ::com::bcom::solar::gprc::v2::RelocalizationResult, ::com::bcom::solar::gprc::v2::Frames>* stream) {
+  (void) context;
+  (void) stream;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status SolARMappingAndRelocalizationProxy::Service::RelocalizeAndMapBatch(::grpc::ServerContext* context, const ::com::bcom::solar::gprc::v2::FramesBatch* request, ::com::bcom::solar::gprc::v2::RelocalizationResults* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status SolARMappingAndRelocalizationProxy::Service::Get3DTransform(::grpc::ServerContext* context, const ::com::bcom::solar::gprc::ClientUUID* request, ::com::bcom::solar::gprc::v2::RelocalizationResult* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status SolARMappingAndRelocalizationProxy::Service::SubscribeTransforms(::grpc::ServerContext* context, const ::com::bcom::solar::gprc::ClientUUID* request, ::grpc::ServerWriter< ::com::bcom::solar::gprc::v2::RelocalizationResult>* writer) {
+  (void) context;
+  (void) request;
+  (void) writer;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status SolARMappingAndRelocalizationProxy::Service::GetStats(::grpc::ServerContext* context, const ::com::bcom::solar::gprc::ClientUUID* request, ::com::bcom::solar::gprc::ProxyStatsResult* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status SolARMappingAndRelocalizationProxy::Service::Reset(::grpc::ServerContext* context, const ::com::bcom::solar::gprc::Empty* request, ::com::bcom::solar::gprc::Empty* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status SolARMappingAndRelocalizationProxy::Service::SendMessage(::grpc::ServerContext* context, const ::com::bcom::solar::gprc::Message* request, ::com::bcom::solar::gprc::Empty* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+
+}  // namespace com
+}  // namespace bcom
+}  // namespace solar
+}  // namespace gprc
+}  // namespace v2
+
@@ -0,0 +1,3569 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: solar_mapping_and_relocalization_proxy_v2.proto
+
+#include "solar_mapping_and_relocalization_proxy_v2.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+namespace com {
+namespace bcom {
+namespace solar {
+namespace gprc {
+namespace v2 {
+constexpr Camera::Camera(
+  ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized)
+  : intrinsics_()
+  , distortion_()
+  , name_(&::PROTOBUF_NAMESPACE_ID::internal::fixed_address_empty_string)
+  , id_(0u)
+  , camera_type_(0)
+
+  , width_(0u)
+  , height_(0u)
+  , rotation_(0)
+{}
+struct CameraDefaultTypeInternal {
+  constexpr CameraDefaultTypeInternal()
+    : _instance(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized{}) {}
+  ~CameraDefaultTypeInternal() {}
+  union {
+    Camera _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT CameraDefaultTypeInternal _Camera_default_instance_;
+constexpr CameraParameters::CameraParameters(
+  ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized)
+  : client_uuid_(&::PROTOBUF_NAMESPACE_ID::internal::fixed_address_empty_string)
+  , camera_(nullptr){}
+struct CameraParametersDefaultTypeInternal {
+  constexpr CameraParametersDefaultTypeInternal()
+    : _instance(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized{}) {}
+  ~CameraParametersDefaultTypeInternal() {}
+  union {
+    CameraParameters _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT CameraParametersDefaultTypeInternal _CameraParameters_default_instance_;
+constexpr CameraParametersStereo::CameraParametersStereo(
+  ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized)
+  : client_uuid_(&::PROTOBUF_NAMESPACE_ID::internal::fixed_address_empty_string)
+  , camera1_(nullptr)
+  , camera2_(nullptr){}
+struct CameraParametersStereoDefaultTypeInternal {
+  constexpr CameraParametersStereoDefaultTypeInternal()
+    : _instance(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized{}) {}
+  ~CameraParametersStereoDefaultTypeInternal() {}
+  union {
+    CameraParametersStereo _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT CameraParametersStereoDefaultTypeInternal _CameraParametersStereo_default_instance_;
+constexpr Rectification::Rectification(
+  ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized)
+  : rotation_()
+  , projection_()
+  , stereo_type_(0)
+
+  , baseline_(0){}
+struct RectificationDefaultTypeInternal {
+  constexpr RectificationDefaultTypeInternal()
+    : _instance(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized{}) {}
+  ~RectificationDefaultTypeInternal() {}
+  union {
+    Rectification _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT RectificationDefaultTypeInternal _Rectification_default_instance_;
+constexpr RectificationParameters::RectificationParameters(
+  ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized)
+  : client_uuid_(&::PROTOBUF_NAMESPACE_ID::internal::fixed_address_empty_string)
+  , cam1_(nullptr)
+  , cam2_(nullptr){}
+struct RectificationParametersDefaultTypeInternal {
+  constexpr RectificationParametersDefaultTypeInternal()
+    : _instance(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized{}) {}
+  ~RectificationParametersDefaultTypeInternal() {}
+  union {
+    RectificationParameters _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT RectificationParametersDefaultTypeInternal _RectificationParameters_default_instance_;
+constexpr RelocalizationResult::RelocalizationResult(
+  ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized)
+  : pose_()
+  , pose_status_(0)
+
+  , confidence_(0)
+  , timestamp_(PROTOBUF_ULONGLONG(0))
+  , mapping_status_(0)
+{}
+struct RelocalizationResultDefaultTypeInternal {
+  constexpr RelocalizationResultDefaultTypeInternal()
+    : _instance(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized{}) {}
+  ~RelocalizationResultDefaultTypeInternal() {}
+  union {
+    RelocalizationResult _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT RelocalizationResultDefaultTypeInternal _RelocalizationResult_default_instance_;
+constexpr RelocalizationResults::RelocalizationResults(
+  ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized)
+  : results_(){}
+struct RelocalizationResultsDefaultTypeInternal {
+  constexpr RelocalizationResultsDefaultTypeInternal()
+    : _instance(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized{}) {}
+  ~RelocalizationResultsDefaultTypeInternal() {}
+  union {
+    RelocalizationResults _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT RelocalizationResultsDefaultTypeInternal _RelocalizationResults_default_instance_;
+constexpr Frames::Frames(
+  ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized)
+  : frames_()
+  , client_uuid_(&::PROTOBUF_NAMESPACE_ID::internal::fixed_address_empty_string){}
+struct FramesDefaultTypeInternal {
+  constexpr FramesDefaultTypeInternal()
+    : _instance(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized{}) {}
+  ~FramesDefaultTypeInternal() {}
+  union {
+    Frames _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT FramesDefaultTypeInternal _Frames_default_instance_;
+constexpr FramesBatch::FramesBatch(
+  ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized)
+  : frames_()
+  , client_uuid_(&::PROTOBUF_NAMESPACE_ID::internal::fixed_address_empty_string)
+  , last_result_only_(false){}
+struct FramesBatchDefaultTypeInternal {
+  constexpr FramesBatchDefaultTypeInternal()
+    : _instance(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized{}) {}
+  ~FramesBatchDefaultTypeInternal() {}
+  union {
+    FramesBatch _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT FramesBatchDefaultTypeInternal _FramesBatch_default_instance_;
+constexpr GroundTruthFrames::GroundTruthFrames(
+  ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized)
+  : world_transform_()
+  , client_uuid_(&::PROTOBUF_NAMESPACE_ID::internal::fixed_address_empty_string)
+  , frames_(nullptr)
+  , fixed_pose_(false){}
+struct GroundTruthFramesDefaultTypeInternal {
+  constexpr GroundTruthFramesDefaultTypeInternal()
+    : _instance(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized{}) {}
+  ~GroundTruthFramesDefaultTypeInternal() {}
+  union {
+    GroundTruthFrames _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT GroundTruthFramesDefaultTypeInternal _GroundTruthFrames_default_instance_;
+constexpr Frame::Frame(
+  ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized)
+  : pose_()
+  , image_(nullptr)
+  , timestamp_(PROTOBUF_ULONGLONG(0))
+  , sensor_id_(0){}
+struct FrameDefaultTypeInternal {
+  constexpr FrameDefaultTypeInternal()
+    : _instance(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized{}) {}
+  ~FrameDefaultTypeInternal() {}
+  union {
+    Frame _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT FrameDefaultTypeInternal _Frame_default_instance_;
+}  // namespace v2
+}  // namespace gprc
+}  // namespace solar
+}  // namespace bcom
+}  // namespace com
+static ::PROTOBUF_NAMESPACE_ID::Metadata file_level_metadata_solar_5fmapping_5fand_5frelocalization_5fproxy_5fv2_2eproto[11];
+static constexpr ::PROTOBUF_NAMESPACE_ID::EnumDescriptor const** file_level_enum_descriptors_solar_5fmapping_5fand_5frelocalization_5fproxy_5fv2_2eproto = nullptr;
+static constexpr ::PROTOBUF_NAMESPACE_ID::ServiceDescriptor const** file_level_service_descriptors_solar_5fmapping_5fand_5frelocalization_5fproxy_5fv2_2eproto = nullptr;
+
+const ::PROTOBUF_NAMESPACE_ID::uint32 TableStruct_solar_5fmapping_5fand_5frelocalization_5fproxy_5fv2_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::com::bcom::solar::gprc::v2::Camera, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::com::bcom::solar::gprc::v2::Camera, name_),
+  PROTOBUF_FIELD_OFFSET(::com::bcom::solar::gprc::v2::Camera, id_),
+  PROTOBUF_FIELD_OFFSET(::com::bcom::solar::gprc::v2::Camera, camera_type_),
+  PROTOBUF_FIELD_OFFSET(::com::bcom::solar::gprc::v2::Camera, width_),
+  PROTOBUF_FIELD_OFFSET(::com::bcom::solar::gprc::v2::Camera, height_),
+  PROTOBUF_FIELD_OFFSET(::com::bcom::solar::gprc::v2::Camera, intrinsics_),
+  PROTOBUF_FIELD_OFFSET(::com::bcom::solar::gprc::v2::Camera, distortion_),
+  PROTOBUF_FIELD_OFFSET(::com::bcom::solar::gprc::v2::Camera, rotation_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::com::bcom::solar::gprc::v2::CameraParameters, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::com::bcom::solar::gprc::v2::CameraParameters, client_uuid_),
+  PROTOBUF_FIELD_OFFSET(::com::bcom::solar::gprc::v2::CameraParameters, camera_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::com::bcom::solar::gprc::v2::CameraParametersStereo, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::com::bcom::solar::gprc::v2::CameraParametersStereo, client_uuid_),
+  PROTOBUF_FIELD_OFFSET(::com::bcom::solar::gprc::v2::CameraParametersStereo, camera1_),
+  PROTOBUF_FIELD_OFFSET(::com::bcom::solar::gprc::v2::CameraParametersStereo, camera2_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::com::bcom::solar::gprc::v2::Rectification, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::com::bcom::solar::gprc::v2::Rectification, rotation_),
+  PROTOBUF_FIELD_OFFSET(::com::bcom::solar::gprc::v2::Rectification, projection_),
+  PROTOBUF_FIELD_OFFSET(::com::bcom::solar::gprc::v2::Rectification, stereo_type_),
+  PROTOBUF_FIELD_OFFSET(::com::bcom::solar::gprc::v2::Rectification, baseline_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::com::bcom::solar::gprc::v2::RectificationParameters, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::com::bcom::solar::gprc::v2::RectificationParameters, client_uuid_),
+  PROTOBUF_FIELD_OFFSET(::com::bcom::solar::gprc::v2::RectificationParameters, cam1_),
+  PROTOBUF_FIELD_OFFSET(::com::bcom::solar::gprc::v2::RectificationParameters, cam2_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::com::bcom::solar::gprc::v2::RelocalizationResult, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::com::bcom::solar::gprc::v2::RelocalizationResult, pose_status_),
+  PROTOBUF_FIELD_OFFSET(::com::bcom::solar::gprc::v2::RelocalizationResult, pose_),
+  PROTOBUF_FIELD_OFFSET(::com::bcom::solar::gprc::v2::RelocalizationResult, confidence_),
+  PROTOBUF_FIELD_OFFSET(::com::bcom::solar::gprc::v2::RelocalizationResult, mapping_status_),
+  PROTOBUF_FIELD_OFFSET(::com::bcom::solar::gprc::v2::RelocalizationResult, timestamp_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::com::bcom::solar::gprc::v2::RelocalizationResults, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::com::bcom::solar::gprc::v2::RelocalizationResults, results_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::com::bcom::solar::gprc::v2::Frames, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::com::bcom::solar::gprc::v2::Frames, client_uuid_),
+  PROTOBUF_FIELD_OFFSET(::com::bcom::solar::gprc::v2::Frames, frames_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::com::bcom::solar::gprc::v2::FramesBatch, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::com::bcom::solar::gprc::v2::FramesBatch, client_uuid_),
+  PROTOBUF_FIELD_OFFSET(::com::bcom::solar::gprc::v2::FramesBatch, frames_),
+  PROTOBUF_FIELD_OFFSET(::com::bcom::solar::gprc::v2::FramesBatch, last_result_only_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::com::bcom::solar::gprc::v2::GroundTruthFrames, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::com::bcom::solar::gprc::v2::GroundTruthFrames, client_uuid_),
+  PROTOBUF_FIELD_OFFSET(::com::bcom::solar::gprc::v2::GroundTruthFrames, frames_),
+  PROTOBUF_FIELD_OFFSET(::com::bcom::solar::gprc::v2::GroundTruthFrames, world_transform_),
+  PROTOBUF_FIELD_OFFSET(::com::bcom::solar::gprc::v2::GroundTruthFrames, fixed_pose_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::com::bcom::solar::gprc::v2::Frame, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::com::bcom::solar::gprc::v2::Frame, sensor_id_),
+  PROTOBUF_FIELD_OFFSET(::com::bcom::solar::gprc::v2::Frame, image_),
+  PROTOBUF_FIELD_OFFSET(::com::bcom::solar::gprc::v2::Frame, timestamp_),
+  PROTOBUF_FIELD_OFFSET(::com::bcom::solar::gprc::v2::Frame, pose_),
+};
+static const ::PROTOBUF_NAMESPACE_ID::internal::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, -1, sizeof(::com::bcom::solar::gprc::v2::Camera)},
+  { 13, -1, sizeof(::com::bcom::solar::gprc::v2::CameraParameters)},
+  { 20, -1, sizeof(::com::bcom::solar::gprc::v2::CameraParametersStereo)},
+  { 28, -1, sizeof(::com::bcom::solar::gprc::v2::Rectification)},
+  { 37, -1, sizeof(::com::bcom::solar::gprc::v2::RectificationParameters)},
+  { 45, -1, sizeof(::com::bcom::solar::gprc::v2::RelocalizationResult)},
+  { 55, -1, sizeof(::com::bcom::solar::gprc::v2::RelocalizationResults)},
+  { 61, -1, sizeof(::com::bcom::solar::gprc::v2::Frames)},
+  { 68, -1, sizeof(::com::bcom::solar::gprc::v2::FramesBatch)},
+  { 76, -1, sizeof(::com::bcom::solar::gprc::v2::GroundTruthFrames)},
+  { 85, -1, sizeof(::com::bcom::solar::gprc::v2::Frame)},
+};
+
+static ::PROTOBUF_NAMESPACE_ID::Message const * const file_default_instances[] = {
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::com::bcom::solar::gprc::v2::_Camera_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::com::bcom::solar::gprc::v2::_CameraParameters_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::com::bcom::solar::gprc::v2::_CameraParametersStereo_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::com::bcom::solar::gprc::v2::_Rectification_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::com::bcom::solar::gprc::v2::_RectificationParameters_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::com::bcom::solar::gprc::v2::_RelocalizationResult_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::com::bcom::solar::gprc::v2::_RelocalizationResults_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::com::bcom::solar::gprc::v2::_Frames_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::com::bcom::solar::gprc::v2::_FramesBatch_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::com::bcom::solar::gprc::v2::_GroundTruthFrames_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::com::bcom::solar::gprc::v2::_Frame_default_instance_),
+};
+
+const char descriptor_table_protodef_solar_5fmapping_5fand_5frelocalization_5fproxy_5fv2_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n/solar_mapping_and_relocalization_proxy"
+  "_v2.proto\022\026com.bcom.solar.gprc.v2\032,solar"
+  "_mapping_and_relocalization_proxy.proto\""
+  "\325\001\n\006Camera\022\014\n\004name\030\001 \001(\t\022\n\n\002id\030\002 \001(\r\0224\n\013"
+  "camera_type\030\003 \001(\0162\037.com.bcom.solar.gprc."
+  "CameraType\022\r\n\005width\030\004 \001(\r\022\016\n\006height\030\005 \001("
+  "\r\022\022\n\nintrinsics\030\006 \003(\002\022\022\n\ndistortion\030\007 \003("
+  "\002\0224\n\010rotation\030\010 \001(\0162\".com.bcom.solar.gpr"
+  "c.ImageRotation\"W\n\020CameraParameters\022\023\n\013c"
+  "lient_uuid\030\001 \001(\t\022.\n\006camera\030\002 \001(\0132\036.com.b"
+  "com.solar.gprc.v2.Camera\"\217\001\n\026CameraParam"
+  "etersStereo\022\023\n\013client_uuid\030\001 \001(\t\022/\n\007came"
+  "ra1\030\002 \001(\0132\036.com.bcom.solar.gprc.v2.Camer"
+  "a\022/\n\007camera2\030\003 \001(\0132\036.com.bcom.solar.gprc"
+  ".v2.Camera\"}\n\rRectification\022\020\n\010rotation\030"
+  "\001 \003(\002\022\022\n\nprojection\030\002 \003(\002\0224\n\013stereo_type"
+  "\030\003 \001(\0162\037.com.bcom.solar.gprc.StereoType\022"
+  "\020\n\010baseline\030\004 \001(\002\"\230\001\n\027RectificationParam"
+  "eters\022\023\n\013client_uuid\030\001 \001(\t\0223\n\004cam1\030\002 \001(\013"
+  "2%.com.bcom.solar.gprc.v2.Rectification\022"
+  "3\n\004cam2\030\003 \001(\0132%.com.bcom.solar.gprc.v2.R"
+  "ectification\"\313\001\n\024RelocalizationResult\022B\n"
+  "\013pose_status\030\001 \001(\0162-.com.bcom.solar.gprc"
+  ".RelocalizationPoseStatus\022\014\n\004pose\030\002 \003(\002\022"
+  "\022\n\nconfidence\030\003 \001(\002\022:\n\016mapping_status\030\004 "
+  "\001(\0162\".com.bcom.solar.gprc.MappingStatus\022"
+  "\021\n\ttimestamp\030\005 \001(\004\"V\n\025RelocalizationResu"
+  "lts\022=\n\007results\030\001 \003(\0132,.com.bcom.solar.gp"
+  "rc.v2.RelocalizationResult\"L\n\006Frames\022\023\n\013"
+  "client_uuid\030\001 \001(\t\022-\n\006frames\030\002 \003(\0132\035.com."
+  "bcom.solar.gprc.v2.Frame\"l\n\013FramesBatch\022"
+  "\023\n\013client_uuid\030\001 \001(\t\022.\n\006frames\030\002 \003(\0132\036.c"
+  "om.bcom.solar.gprc.v2.Frames\022\030\n\020last_res"
+  "ult_only\030\003 \001(\010\"\205\001\n\021GroundTruthFrames\022\023\n\013"
+  "client_uuid\030\001 \001(\t\022.\n\006frames\030\002 \001(\0132\036.com."
+  "bcom.solar.gprc.v2.Frames\022\027\n\017world_trans"
+  "form\030\003 \003(\002\022\022\n\nfixed_pose\030\004 \001(\010\"f\n\005Frame\022"
+  "\021\n\tsensor_id\030\001 \001(\005\022)\n\005image\030\002 \001(\0132\032.com."
+  "bcom.solar.gprc.Image\022\021\n\ttimestamp\030\003 \001(\004"
+  "\022\014\n\004pose\030\004 \003(\0022\246\014\n\"SolARMappingAndReloca"
+  "lizationProxy\022M\n\016RegisterClient\022\032.com.bc"
+  "om.solar.gprc.Empty\032\037.com.bcom.solar.gpr"
+  "c.ClientUUID\022O\n\020UnregisterClient\022\037.com.b"
+  "com.solar.gprc.ClientUUID\032\032.com.bcom.sol"
+  "ar.gprc.Empty\022J\n\004Init\022&.com.bcom.solar.g"
+  "prc.PipelineModeValue\032\032.com.bcom.solar.g"
+  "prc.Empty\022D\n\005Start\022\037.com.bcom.solar.gprc"
+  ".ClientUUID\032\032.com.bcom.solar.gprc.Empty\022"
+  "C\n\004Stop\022\037.com.bcom.solar.gprc.ClientUUID"
+  "\032\032.com.bcom.solar.gprc.Empty\022[\n\023SetCamer"
+  "aParameters\022(.com.bcom.solar.gprc.v2.Cam"
+  "eraParameters\032\032.com.bcom.solar.gprc.Empt"
+  "y\022g\n\031SetCameraParametersStereo\022..com.bco"
+  "m.solar.gprc.v2.CameraParametersStereo\032\032"
+  ".com.bcom.solar.gprc.Empty\022i\n\032SetRectifi"
+  "cationParameters\022/.com.bcom.solar.gprc.v"
+  "2.RectificationParameters\032\032.com.bcom.sol"
+  "ar.gprc.Empty\022`\n\020RelocalizeAndMap\022\036.com."
+  "bcom.solar.gprc.v2.Frames\032,.com.bcom.sol"
+  "ar.gprc.v2.RelocalizationResult\022v\n\033Reloc"
+  "alizeAndMapGroundTruth\022).com.bcom.solar."
+  "gprc.v2.GroundTruthFrames\032,.com.bcom.sol"
+  "ar.gprc.v2.RelocalizationResult\022j\n\026Reloc"
+  "alizeAndMapStream\022\036.com.bcom.solar.gprc."
+  "v2.Frames\032,.com.bcom.solar.gprc.v2.Reloc"
+  "alizationResult(\0010\001\022k\n\025RelocalizeAndMapB"
+  "atch\022#.com.bcom.solar.gprc.v2.FramesBatc"
+  "h\032-.com.bcom.solar.gprc.v2.Relocalizatio"
+  "nResults\022_\n\016Get3DTransform\022\037.com.bcom.so"
+  "lar.gprc.ClientUUID\032,.com.bcom.solar.gpr"
+  "c.v2.RelocalizationResult\022f\n\023SubscribeTr"
+  "ansforms\022\037.com.bcom.solar.gprc.ClientUUI"
+  "D\032,.com.bcom.solar.gprc.v2.Relocalizatio"
+  "nResult0\001\022R\n\010GetStats\022\037.com.bcom.solar.g"
+  "prc.ClientUUID\032%.com.bcom.solar.gprc.Pro"
+  "xyStatsResult\022\?\n\005Reset\022\032.com.bcom.solar."
+  "gprc.Empty\032\032.com.bcom.solar.gprc.Empty\022G"
+  "\n\013SendMessage\022\034.com.bcom.solar.gprc.Mess"
+  "age\032\032.com.bcom.solar.gprc.EmptyB\003\370\001\001b\006pr"
+  "oto3"
+  ;
+static const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable*const descriptor_table_solar_5fmapping_5fand_5frelocalization_5fproxy_5fv2_2eproto_deps[1] = {
+  &::descriptor_table_solar_5fmapping_5fand_5frelocalization_5fproxy_2eproto,
+};
+static ::PROTOBUF_NAMESPACE_ID::internal::once_flag descriptor_table_solar_5fmapping_5fand_5frelocalization_5fproxy_5fv2_2eproto_once;
+const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_solar_5fmapping_5fand_5frelocalization_5fproxy_5fv2_2eproto = {
+  false, false, 3164, descriptor_table_protodef_solar_5fmapping_5fand_5frelocalization_5fproxy_5fv2_2eproto, "solar_mapping_and_relocalization_proxy_v2.proto", 
+  &descriptor_table_solar_5fmapping_5fand_5frelocalization_5fproxy_5fv2_2eproto_once, descriptor_table_solar_5fmapping_5fand_5frelocalization_5fproxy_5fv2_2eproto_deps, 1, 11,
+  schemas, file_default_instances, TableStruct_solar_5fmapping_5fand_5frelocalization_5fproxy_5fv2_2eproto::offsets,
+  file_level_metadata_solar_5fmapping_5fand_5frelocalization_5fproxy_5fv2_2eproto, file_level_enum_descriptors_solar_5fmapping_5fand_5frelocalization_5fproxy_5fv2_2eproto, file_level_service_descriptors_solar_5fmapping_5fand_5frelocalization_5fproxy_5fv2_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK ::PROTOBUF_NAMESPACE_ID::Metadata
+descriptor_table_solar_5fmapping_5fand_5frelocalization_5fproxy_5fv2_2eproto_metadata_getter(int index) {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_solar_5fmapping_5fand_5frelocalization_5fproxy_5fv2_2eproto);
+  return descriptor_table_solar_5fmapping_5fand_5frelocalization_5fproxy_5fv2_2eproto.file_level_metadata[index];
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY static ::PROTOBUF_NAMESPACE_ID::internal::AddDescriptorsRunner dynamic_init_dummy_solar_5fmapping_5fand_5frelocalization_5fproxy_5fv2_2eproto(&descriptor_table_solar_5fmapping_5fand_5frelocalization_5fproxy_5fv2_2eproto);
+namespace com {
+namespace bcom {
+namespace solar {
+namespace gprc {
+namespace v2 {
+
+// ===================================================================
+
+class Camera::_Internal {
+ public:
+};
+
+Camera::Camera(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena),
+  intrinsics_(arena),
+  distortion_(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:com.bcom.solar.gprc.v2.Camera)
+}
+Camera::Camera(const Camera& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message(),
+      intrinsics_(from.intrinsics_),
+      distortion_(from.distortion_) {
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  name_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  if (!from._internal_name().empty()) {
+    name_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, from._internal_name(), 
+      GetArena());
+  }
+  ::memcpy(&id_, &from.id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&rotation_) -
+    reinterpret_cast<char*>(&id_)) + sizeof(rotation_));
+  // @@protoc_insertion_point(copy_constructor:com.bcom.solar.gprc.v2.Camera)
+}
+
+void Camera::SharedCtor() {
+name_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+::memset(reinterpret_cast<char*>(this) + static_cast<size_t>(
+    reinterpret_cast<char*>(&id_) - reinterpret_cast<char*>(this)),
+    0, static_cast<size_t>(reinterpret_cast<char*>(&rotation_) -
+    reinterpret_cast<char*>(&id_)) + sizeof(rotation_));
+}
+
+Camera::~Camera() {
+  // @@protoc_insertion_point(destructor:com.bcom.solar.gprc.v2.Camera)
+  SharedDtor();
+  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+void Camera::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+  name_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+
+void Camera::ArenaDtor(void* object) {
+  Camera* _this = reinterpret_cast< Camera* >(object);
+  (void)_this;
+}
+void Camera::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void Camera::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+
+void Camera::Clear() {
+// @@protoc_insertion_point(message_clear_start:com.bcom.solar.gprc.v2.Camera)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  intrinsics_.Clear();
+  distortion_.Clear();
+  name_.ClearToEmpty();
+  ::memset(&id_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&rotation_) -
+      reinterpret_cast<char*>(&id_)) + sizeof(rotation_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Camera::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // string name = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+          auto str = _internal_mutable_name();
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "com.bcom.solar.gprc.v2.Camera.name"));
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // uint32 id = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 16)) {
+          id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .com.bcom.solar.gprc.CameraType camera_type = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 24)) {
+          ::PROTOBUF_NAMESPACE_ID::uint64 val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_camera_type(static_cast<::com::bcom::solar::gprc::CameraType>(val));
+        } else goto handle_unusual;
+        continue;
+      // uint32 width = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 32)) {
+          width_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // uint32 height = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 40)) {
+          height_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // repeated float intrinsics = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 50)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedFloatParser(_internal_mutable_intrinsics(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 53) {
+          _internal_add_intrinsics(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr));
+          ptr += sizeof(float);
+        } else goto handle_unusual;
+        continue;
+      // repeated float distortion = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 58)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedFloatParser(_internal_mutable_distortion(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 61) {
+          _internal_add_distortion(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr));
+          ptr += sizeof(float);
+        } else goto handle_unusual;
+        continue;
+      // .com.bcom.solar.gprc.ImageRotation rotation = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 64)) {
+          ::PROTOBUF_NAMESPACE_ID::uint64 val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_rotation(static_cast<::com::bcom::solar::gprc::ImageRotation>(val));
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag,
+            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+            ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* Camera::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:com.bcom.solar.gprc.v2.Camera)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string name = 1;
+  if (this->name().size() > 0) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "com.bcom.solar.gprc.v2.Camera.name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_name(), target);
+  }
+
+  // uint32 id = 2;
+  if (this->id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt32ToArray(2, this->_internal_id(), target);
+  }
+
+  // .com.bcom.solar.gprc.CameraType camera_type = 3;
+  if (this->camera_type() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteEnumToArray(
+      3, this->_internal_camera_type(), target);
+  }
+
+  // uint32 width = 4;
+  if (this->width() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt32ToArray(4, this->_internal_width(), target);
+  }
+
+  // uint32 height = 5;
+  if (this->height() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt32ToArray(5, this->_internal_height(), target);
+  }
+
+  // repeated float intrinsics = 6;
+  if (this->_internal_intrinsics_size() > 0) {
+    target = stream->WriteFixedPacked(6, _internal_intrinsics(), target);
+  }
+
+  // repeated float distortion = 7;
+  if (this->_internal_distortion_size() > 0) {
+    target = stream->WriteFixedPacked(7, _internal_distortion(), target);
+  }
+
+  // .com.bcom.solar.gprc.ImageRotation rotation = 8;
+  if (this->rotation() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteEnumToArray(
+      8, this->_internal_rotation(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:com.bcom.solar.gprc.v2.Camera)
+  return target;
+}
+
+size_t Camera::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:com.bcom.solar.gprc.v2.Camera)
+  size_t total_size = 0;
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated float intrinsics = 6;
+  {
+    unsigned int count = static_cast<unsigned int>(this->_internal_intrinsics_size());
+    size_t data_size = 4UL * count;
+    if (data_size > 0) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+            static_cast<::PROTOBUF_NAMESPACE_ID::int32>(data_size));
+    }
+    total_size += data_size;
+  }
+
+  // repeated float distortion = 7;
+  {
+    unsigned int count = static_cast<unsigned int>(this->_internal_distortion_size());
+    size_t data_size = 4UL * count;
+    if (data_size > 0) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+            static_cast<::PROTOBUF_NAMESPACE_ID::int32>(data_size));
+    }
+    total_size += data_size;
+  }
+
+  // string name = 1;
+  if (this->name().size() > 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_name());
+  }
+
+  // uint32 id = 2;
+  if (this->id() != 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt32Size(
+        this->_internal_id());
+  }
+
+  // .com.bcom.solar.gprc.CameraType camera_type = 3;
+  if (this->camera_type() != 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::EnumSize(this->_internal_camera_type());
+  }
+
+  // uint32 width = 4;
+  if (this->width() != 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt32Size(
+        this->_internal_width());
+  }
+
+  // uint32 height = 5;
+  if (this->height() != 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt32Size(
+        this->_internal_height());
+  }
+
+  // .com.bcom.solar.gprc.ImageRotation rotation = 8;
+  if (this->rotation() != 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::EnumSize(this->_internal_rotation());
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
+        _internal_metadata_, total_size, &_cached_size_);
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void Camera::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:com.bcom.solar.gprc.v2.Camera)
+  GOOGLE_DCHECK_NE(&from, this);
+  const Camera* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<Camera>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:com.bcom.solar.gprc.v2.Camera)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:com.bcom.solar.gprc.v2.Camera)
+    MergeFrom(*source);
+  }
+}
+
+void Camera::MergeFrom(const Camera& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:com.bcom.solar.gprc.v2.Camera)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  intrinsics_.MergeFrom(from.intrinsics_);
+  distortion_.MergeFrom(from.distortion_);
+  if (from.name().size() > 0) {
+    _internal_set_name(from._internal_name());
+  }
+  if (from.id() != 0) {
+    _internal_set_id(from._internal_id());
+  }
+  if (from.camera_type() != 0) {
+    _internal_set_camera_type(from._internal_camera_type());
+  }
+  if (from.width() != 0) {
+    _internal_set_width(from._internal_width());
+  }
+  if (from.height() != 0) {
+    _internal_set_height(from._internal_height());
+  }
+  if (from.rotation() != 0) {
+    _internal_set_rotation(from._internal_rotation());
+  }
+}
+
+void Camera::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:com.bcom.solar.gprc.v2.Camera)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void Camera::CopyFrom(const Camera& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:com.bcom.solar.gprc.v2.Camera)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Camera::IsInitialized() const {
+  return true;
+}
+
+void Camera::InternalSwap(Camera* other) {
+  using std::swap;
+  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
+  intrinsics_.InternalSwap(&other->intrinsics_);
+  distortion_.InternalSwap(&other->distortion_);
+  name_.Swap(&other->name_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Camera, rotation_)
+      + sizeof(Camera::rotation_)
+      - PROTOBUF_FIELD_OFFSET(Camera, id_)>(
+          reinterpret_cast<char*>(&id_),
+          reinterpret_cast<char*>(&other->id_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Camera::GetMetadata() const {
+  return GetMetadataStatic();
+}
+
+
+// ===================================================================
+
+class CameraParameters::_Internal {
+ public:
+  static const ::com::bcom::solar::gprc::v2::Camera& camera(const CameraParameters* msg);
+};
+
+const ::com::bcom::solar::gprc::v2::Camera&
+CameraParameters::_Internal::camera(const CameraParameters* msg) {
+  return *msg->camera_;
+}
+CameraParameters::CameraParameters(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:com.bcom.solar.gprc.v2.CameraParameters)
+}
+CameraParameters::CameraParameters(const CameraParameters& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  client_uuid_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  if (!from._internal_client_uuid().empty()) {
+    client_uuid_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, from._internal_client_uuid(), 
+      GetArena());
+  }
+  if (from._internal_has_camera()) {
+    camera_ = new ::com::bcom::solar::gprc::v2::Camera(*from.camera_);
+  } else {
+    camera_ = nullptr;
+  }
+  // @@protoc_insertion_point(copy_constructor:com.bcom.solar.gprc.v2.CameraParameters)
+}
+
+void CameraParameters::SharedCtor() {
+client_uuid_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+camera_ = nullptr;
+}
+
+CameraParameters::~CameraParameters() {
+  // @@protoc_insertion_point(destructor:com.bcom.solar.gprc.v2.CameraParameters)
+  SharedDtor();
+  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+void CameraParameters::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+  client_uuid_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  if (this != internal_default_instance()) delete camera_;
+}
+
+void CameraParameters::ArenaDtor(void* object) {
+  CameraParameters* _this = reinterpret_cast< CameraParameters* >(object);
+  (void)_this;
+}
+void CameraParameters::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void CameraParameters::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+
+void CameraParameters::Clear() {
+// @@protoc_insertion_point(message_clear_start:com.bcom.solar.gprc.v2.CameraParameters)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  client_uuid_.ClearToEmpty();
+  if (GetArena() == nullptr && camera_ != nullptr) {
+    delete camera_;
+  }
+  camera_ = nullptr;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CameraParameters::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // string client_uuid = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+          auto str = _internal_mutable_client_uuid();
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "com.bcom.solar.gprc.v2.CameraParameters.client_uuid"));
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .com.bcom.solar.gprc.v2.Camera camera = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_camera(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag,
+            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+            ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* CameraParameters::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:com.bcom.solar.gprc.v2.CameraParameters)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string client_uuid = 1;
+  if (this->client_uuid().size() > 0) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_client_uuid().data(), static_cast<int>(this->_internal_client_uuid().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "com.bcom.solar.gprc.v2.CameraParameters.client_uuid");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_client_uuid(), target);
+  }
+
+  // .com.bcom.solar.gprc.v2.Camera camera = 2;
+  if (this->has_camera()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        2, _Internal::camera(this), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:com.bcom.solar.gprc.v2.CameraParameters)
+  return target;
+}
+
+size_t CameraParameters::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:com.bcom.solar.gprc.v2.CameraParameters)
+  size_t total_size = 0;
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string client_uuid = 1;
+  if (this->client_uuid().size() > 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_client_uuid());
+  }
+
+  // .com.bcom.solar.gprc.v2.Camera camera = 2;
+  if (this->has_camera()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *camera_);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
+        _internal_metadata_, total_size, &_cached_size_);
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void CameraParameters::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:com.bcom.solar.gprc.v2.CameraParameters)
+  GOOGLE_DCHECK_NE(&from, this);
+  const CameraParameters* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<CameraParameters>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:com.bcom.solar.gprc.v2.CameraParameters)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:com.bcom.solar.gprc.v2.CameraParameters)
+    MergeFrom(*source);
+  }
+}
+
+void CameraParameters::MergeFrom(const CameraParameters& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:com.bcom.solar.gprc.v2.CameraParameters)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from.client_uuid().size() > 0) {
+    _internal_set_client_uuid(from._internal_client_uuid());
+  }
+  if (from.has_camera()) {
+    _internal_mutable_camera()->::com::bcom::solar::gprc::v2::Camera::MergeFrom(from._internal_camera());
+  }
+}
+
+void CameraParameters::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:com.bcom.solar.gprc.v2.CameraParameters)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void CameraParameters::CopyFrom(const CameraParameters& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:com.bcom.solar.gprc.v2.CameraParameters)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CameraParameters::IsInitialized() const {
+  return true;
+}
+
+void CameraParameters::InternalSwap(CameraParameters* other) {
+  using std::swap;
+  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
+  client_uuid_.Swap(&other->client_uuid_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  swap(camera_, other->camera_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CameraParameters::GetMetadata() const {
+  return GetMetadataStatic();
+}
+
+
+// ===================================================================
+
+class CameraParametersStereo::_Internal {
+ public:
+  static const ::com::bcom::solar::gprc::v2::Camera& camera1(const CameraParametersStereo* msg);
+  static const ::com::bcom::solar::gprc::v2::Camera& camera2(const CameraParametersStereo* msg);
+};
+
+const ::com::bcom::solar::gprc::v2::Camera&
+CameraParametersStereo::_Internal::camera1(const CameraParametersStereo* msg) {
+  return *msg->camera1_;
+}
+const ::com::bcom::solar::gprc::v2::Camera&
+CameraParametersStereo::_Internal::camera2(const CameraParametersStereo* msg) {
+  return *msg->camera2_;
+}
+CameraParametersStereo::CameraParametersStereo(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:com.bcom.solar.gprc.v2.CameraParametersStereo)
+}
+CameraParametersStereo::CameraParametersStereo(const CameraParametersStereo& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  client_uuid_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  if (!from._internal_client_uuid().empty()) {
+    client_uuid_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, from._internal_client_uuid(), 
+      GetArena());
+  }
+  if (from._internal_has_camera1()) {
+    camera1_ = new ::com::bcom::solar::gprc::v2::Camera(*from.camera1_);
+  } else {
+    camera1_ = nullptr;
+  }
+  if (from._internal_has_camera2()) {
+    camera2_ = new ::com::bcom::solar::gprc::v2::Camera(*from.camera2_);
+  } else {
+    camera2_ = nullptr;
+  }
+  // @@protoc_insertion_point(copy_constructor:com.bcom.solar.gprc.v2.CameraParametersStereo)
+}
+
+void CameraParametersStereo::SharedCtor() {
+client_uuid_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+::memset(reinterpret_cast<char*>(this) + static_cast<size_t>(
+    reinterpret_cast<char*>(&camera1_) - reinterpret_cast<char*>(this)),
+    0, static_cast<size_t>(reinterpret_cast<char*>(&camera2_) -
+    reinterpret_cast<char*>(&camera1_)) + sizeof(camera2_));
+}
+
+CameraParametersStereo::~CameraParametersStereo() {
+  // @@protoc_insertion_point(destructor:com.bcom.solar.gprc.v2.CameraParametersStereo)
+  SharedDtor();
+  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+void CameraParametersStereo::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+  client_uuid_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  if (this != internal_default_instance()) delete camera1_;
+  if (this != internal_default_instance()) delete camera2_;
+}
+
+void CameraParametersStereo::ArenaDtor(void* object) {
+  CameraParametersStereo* _this = reinterpret_cast< CameraParametersStereo* >(object);
+  (void)_this;
+}
+void CameraParametersStereo::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void CameraParametersStereo::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+
+void CameraParametersStereo::Clear() {
+// @@protoc_insertion_point(message_clear_start:com.bcom.solar.gprc.v2.CameraParametersStereo)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  client_uuid_.ClearToEmpty();
+  if (GetArena() == nullptr && camera1_ != nullptr) {
+    delete camera1_;
+  }
+  camera1_ = nullptr;
+  if (GetArena() == nullptr && camera2_ != nullptr) {
+    delete camera2_;
+  }
+  camera2_ = nullptr;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CameraParametersStereo::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // string client_uuid = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+          auto str = _internal_mutable_client_uuid();
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "com.bcom.solar.gprc.v2.CameraParametersStereo.client_uuid"));
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .com.bcom.solar.gprc.v2.Camera camera1 = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_camera1(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .com.bcom.solar.gprc.v2.Camera camera2 = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_camera2(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag,
+            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+            ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* CameraParametersStereo::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:com.bcom.solar.gprc.v2.CameraParametersStereo)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string client_uuid = 1;
+  if (this->client_uuid().size() > 0) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_client_uuid().data(), static_cast<int>(this->_internal_client_uuid().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "com.bcom.solar.gprc.v2.CameraParametersStereo.client_uuid");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_client_uuid(), target);
+  }
+
+  // .com.bcom.solar.gprc.v2.Camera camera1 = 2;
+  if (this->has_camera1()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        2, _Internal::camera1(this), target, stream);
+  }
+
+  // .com.bcom.solar.gprc.v2.Camera camera2 = 3;
+  if (this->has_camera2()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        3, _Internal::camera2(this), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:com.bcom.solar.gprc.v2.CameraParametersStereo)
+  return target;
+}
+
+size_t CameraParametersStereo::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:com.bcom.solar.gprc.v2.CameraParametersStereo)
+  size_t total_size = 0;
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string client_uuid = 1;
+  if (this->client_uuid().size() > 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_client_uuid());
+  }
+
+  // .com.bcom.solar.gprc.v2.Camera camera1 = 2;
+  if (this->has_camera1()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *camera1_);
+  }
+
+  // .com.bcom.solar.gprc.v2.Camera camera2 = 3;
+  if (this->has_camera2()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *camera2_);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
+        _internal_metadata_, total_size, &_cached_size_);
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void CameraParametersStereo::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:com.bcom.solar.gprc.v2.CameraParametersStereo)
+  GOOGLE_DCHECK_NE(&from, this);
+  const CameraParametersStereo* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<CameraParametersStereo>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:com.bcom.solar.gprc.v2.CameraParametersStereo)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:com.bcom.solar.gprc.v2.CameraParametersStereo)
+    MergeFrom(*source);
+  }
+}
+
+void CameraParametersStereo::MergeFrom(const CameraParametersStereo& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:com.bcom.solar.gprc.v2.CameraParametersStereo)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from.client_uuid().size() > 0) {
+    _internal_set_client_uuid(from._internal_client_uuid());
+  }
+  if (from.has_camera1()) {
+    _internal_mutable_camera1()->::com::bcom::solar::gprc::v2::Camera::MergeFrom(from._internal_camera1());
+  }
+  if (from.has_camera2()) {
+    _internal_mutable_camera2()->::com::bcom::solar::gprc::v2::Camera::MergeFrom(from._internal_camera2());
+  }
+}
+
+void CameraParametersStereo::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:com.bcom.solar.gprc.v2.CameraParametersStereo)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void CameraParametersStereo::CopyFrom(const CameraParametersStereo& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:com.bcom.solar.gprc.v2.CameraParametersStereo)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CameraParametersStereo::IsInitialized() const {
+  return true;
+}
+
+void CameraParametersStereo::InternalSwap(CameraParametersStereo* other) {
+  using std::swap;
+  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
+  client_uuid_.Swap(&other->client_uuid_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(CameraParametersStereo, camera2_)
+      + sizeof(CameraParametersStereo::camera2_)
+      - PROTOBUF_FIELD_OFFSET(CameraParametersStereo, camera1_)>(
+          reinterpret_cast<char*>(&camera1_),
+          reinterpret_cast<char*>(&other->camera1_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CameraParametersStereo::GetMetadata() const {
+  return GetMetadataStatic();
+}
+
+
+// ===================================================================
+
+class Rectification::_Internal {
+ public:
+};
+
+Rectification::Rectification(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena),
+  rotation_(arena),
+  projection_(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:com.bcom.solar.gprc.v2.Rectification)
+}
+Rectification::Rectification(const Rectification& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message(),
+      rotation_(from.rotation_),
+      projection_(from.projection_) {
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&stereo_type_, &from.stereo_type_,
+    static_cast<size_t>(reinterpret_cast<char*>(&baseline_) -
+    reinterpret_cast<char*>(&stereo_type_)) + sizeof(baseline_));
+  // @@protoc_insertion_point(copy_constructor:com.bcom.solar.gprc.v2.Rectification)
+}
+
+void Rectification::SharedCtor() {
+::memset(reinterpret_cast<char*>(this) + static_cast<size_t>(
+    reinterpret_cast<char*>(&stereo_type_) - reinterpret_cast<char*>(this)),
+    0, static_cast<size_t>(reinterpret_cast<char*>(&baseline_) -
+    reinterpret_cast<char*>(&stereo_type_)) + sizeof(baseline_));
+}
+
+Rectification::~Rectification() {
+  // @@protoc_insertion_point(destructor:com.bcom.solar.gprc.v2.Rectification)
+  SharedDtor();
+  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+void Rectification::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+}
+
+void Rectification::ArenaDtor(void* object) {
+  Rectification* _this = reinterpret_cast< Rectification* >(object);
+  (void)_this;
+}
+void Rectification::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void Rectification::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+
+void Rectification::Clear() {
+// @@protoc_insertion_point(message_clear_start:com.bcom.solar.gprc.v2.Rectification)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  rotation_.Clear();
+  projection_.Clear();
+  ::memset(&stereo_type_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&baseline_) -
+      reinterpret_cast<char*>(&stereo_type_)) + sizeof(baseline_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Rectification::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // repeated float rotation = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedFloatParser(_internal_mutable_rotation(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 13) {
+          _internal_add_rotation(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr));
+          ptr += sizeof(float);
+        } else goto handle_unusual;
+        continue;
+      // repeated float projection = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedFloatParser(_internal_mutable_projection(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 21) {
+          _internal_add_projection(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr));
+          ptr += sizeof(float);
+        } else goto handle_unusual;
+        continue;
+      // .com.bcom.solar.gprc.StereoType stereo_type = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 24)) {
+          ::PROTOBUF_NAMESPACE_ID::uint64 val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_stereo_type(static_cast<::com::bcom::solar::gprc::StereoType>(val));
+        } else goto handle_unusual;
+        continue;
+      // float baseline = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 37)) {
+          baseline_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag,
+            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+            ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* Rectification::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:com.bcom.solar.gprc.v2.Rectification)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated float rotation = 1;
+  if (this->_internal_rotation_size() > 0) {
+    target = stream->WriteFixedPacked(1, _internal_rotation(), target);
+  }
+
+  // repeated float projection = 2;
+  if (this->_internal_projection_size() > 0) {
+    target = stream->WriteFixedPacked(2, _internal_projection(), target);
+  }
+
+  // .com.bcom.solar.gprc.StereoType stereo_type = 3;
+  if (this->stereo_type() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteEnumToArray(
+      3, this->_internal_stereo_type(), target);
+  }
+
+  // float baseline = 4;
+  if (!(this->baseline() <= 0 && this->baseline() >= 0)) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteFloatToArray(4, this->_internal_baseline(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:com.bcom.solar.gprc.v2.Rectification)
+  return target;
+}
+
+size_t Rectification::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:com.bcom.solar.gprc.v2.Rectification)
+  size_t total_size = 0;
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated float rotation = 1;
+  {
+    unsigned int count = static_cast<unsigned int>(this->_internal_rotation_size());
+    size_t data_size = 4UL * count;
+    if (data_size > 0) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+            static_cast<::PROTOBUF_NAMESPACE_ID::int32>(data_size));
+    }
+    total_size += data_size;
+  }
+
+  // repeated float projection = 2;
+  {
+    unsigned int count = static_cast<unsigned int>(this->_internal_projection_size());
+    size_t data_size = 4UL * count;
+    if (data_size > 0) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+            static_cast<::PROTOBUF_NAMESPACE_ID::int32>(data_size));
+    }
+    total_size += data_size;
+  }
+
+  // .com.bcom.solar.gprc.StereoType stereo_type = 3;
+  if (this->stereo_type() != 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::EnumSize(this->_internal_stereo_type());
+  }
+
+  // float baseline = 4;
+  if (!(this->baseline() <= 0 && this->baseline() >= 0)) {
+    total_size += 1 + 4;
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
+        _internal_metadata_, total_size, &_cached_size_);
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void Rectification::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:com.bcom.solar.gprc.v2.Rectification)
+  GOOGLE_DCHECK_NE(&from, this);
+  const Rectification* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<Rectification>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:com.bcom.solar.gprc.v2.Rectification)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:com.bcom.solar.gprc.v2.Rectification)
+    MergeFrom(*source);
+  }
+}
+
+void Rectification::MergeFrom(const Rectification& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:com.bcom.solar.gprc.v2.Rectification)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  rotation_.MergeFrom(from.rotation_);
+  projection_.MergeFrom(from.projection_);
+  if (from.stereo_type() != 0) {
+    _internal_set_stereo_type(from._internal_stereo_type());
+  }
+  if (!(from.baseline() <= 0 && from.baseline() >= 0)) {
+    _internal_set_baseline(from._internal_baseline());
+  }
+}
+
+void Rectification::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:com.bcom.solar.gprc.v2.Rectification)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void Rectification::CopyFrom(const Rectification& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:com.bcom.solar.gprc.v2.Rectification)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Rectification::IsInitialized() const {
+  return true;
+}
+
+void Rectification::InternalSwap(Rectification* other) {
+  using std::swap;
+  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
+  rotation_.InternalSwap(&other->rotation_);
+  projection_.InternalSwap(&other->projection_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Rectification, baseline_)
+      + sizeof(Rectification::baseline_)
+      - PROTOBUF_FIELD_OFFSET(Rectification, stereo_type_)>(
+          reinterpret_cast<char*>(&stereo_type_),
+          reinterpret_cast<char*>(&other->stereo_type_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Rectification::GetMetadata() const {
+  return GetMetadataStatic();
+}
+
+
+// ===================================================================
+
+class RectificationParameters::_Internal {
+ public:
+  static const ::com::bcom::solar::gprc::v2::Rectification& cam1(const RectificationParameters* msg);
+  static const ::com::bcom::solar::gprc::v2::Rectification& cam2(const RectificationParameters* msg);
+};
+
+const ::com::bcom::solar::gprc::v2::Rectification&
+RectificationParameters::_Internal::cam1(const RectificationParameters* msg) {
+  return *msg->cam1_;
+}
+const ::com::bcom::solar::gprc::v2::Rectification&
+RectificationParameters::_Internal::cam2(const RectificationParameters* msg) {
+  return *msg->cam2_;
+}
+RectificationParameters::RectificationParameters(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:com.bcom.solar.gprc.v2.RectificationParameters)
+}
+RectificationParameters::RectificationParameters(const RectificationParameters& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  client_uuid_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  if (!from._internal_client_uuid().empty()) {
+    client_uuid_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, from._internal_client_uuid(), 
+      GetArena());
+  }
+  if (from._internal_has_cam1()) {
+    cam1_ = new ::com::bcom::solar::gprc::v2::Rectification(*from.cam1_);
+  } else {
+    cam1_ = nullptr;
+  }
+  if (from._internal_has_cam2()) {
+    cam2_ = new ::com::bcom::solar::gprc::v2::Rectification(*from.cam2_);
+  } else {
+    cam2_ = nullptr;
+  }
+  // @@protoc_insertion_point(copy_constructor:com.bcom.solar.gprc.v2.RectificationParameters)
+}
+
+void RectificationParameters::SharedCtor() {
+client_uuid_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+::memset(reinterpret_cast<char*>(this) + static_cast<size_t>(
+    reinterpret_cast<char*>(&cam1_) - reinterpret_cast<char*>(this)),
+    0, static_cast<size_t>(reinterpret_cast<char*>(&cam2_) -
+    reinterpret_cast<char*>(&cam1_)) + sizeof(cam2_));
+}
+
+RectificationParameters::~RectificationParameters() {
+  // @@protoc_insertion_point(destructor:com.bcom.solar.gprc.v2.RectificationParameters)
+  SharedDtor();
+  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+void RectificationParameters::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+  client_uuid_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  if (this != internal_default_instance()) delete cam1_;
+  if (this != internal_default_instance()) delete cam2_;
+}
+
+void RectificationParameters::ArenaDtor(void* object) {
+  RectificationParameters* _this = reinterpret_cast< RectificationParameters* >(object);
+  (void)_this;
+}
+void RectificationParameters::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void RectificationParameters::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+
+void RectificationParameters::Clear() {
+// @@protoc_insertion_point(message_clear_start:com.bcom.solar.gprc.v2.RectificationParameters)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  client_uuid_.ClearToEmpty();
+  if (GetArena() == nullptr && cam1_ != nullptr) {
+    delete cam1_;
+  }
+  cam1_ = nullptr;
+  if (GetArena() == nullptr && cam2_ != nullptr) {
+    delete cam2_;
+  }
+  cam2_ = nullptr;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* RectificationParameters::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // string client_uuid = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+          auto str = _internal_mutable_client_uuid();
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "com.bcom.solar.gprc.v2.RectificationParameters.client_uuid"));
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .com.bcom.solar.gprc.v2.Rectification cam1 = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_cam1(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .com.bcom.solar.gprc.v2.Rectification cam2 = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_cam2(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag,
+            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+            ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* RectificationParameters::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:com.bcom.solar.gprc.v2.RectificationParameters)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string client_uuid = 1;
+  if (this->client_uuid().size() > 0) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_client_uuid().data(), static_cast<int>(this->_internal_client_uuid().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "com.bcom.solar.gprc.v2.RectificationParameters.client_uuid");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_client_uuid(), target);
+  }
+
+  // .com.bcom.solar.gprc.v2.Rectification cam1 = 2;
+  if (this->has_cam1()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        2, _Internal::cam1(this), target, stream);
+  }
+
+  // .com.bcom.solar.gprc.v2.Rectification cam2 = 3;
+  if (this->has_cam2()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        3, _Internal::cam2(this), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:com.bcom.solar.gprc.v2.RectificationParameters)
+  return target;
+}
+
+size_t RectificationParameters::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:com.bcom.solar.gprc.v2.RectificationParameters)
+  size_t total_size = 0;
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string client_uuid = 1;
+  if (this->client_uuid().size() > 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_client_uuid());
+  }
+
+  // .com.bcom.solar.gprc.v2.Rectification cam1 = 2;
+  if (this->has_cam1()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *cam1_);
+  }
+
+  // .com.bcom.solar.gprc.v2.Rectification cam2 = 3;
+  if (this->has_cam2()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *cam2_);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
+        _internal_metadata_, total_size, &_cached_size_);
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void RectificationParameters::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:com.bcom.solar.gprc.v2.RectificationParameters)
+  GOOGLE_DCHECK_NE(&from, this);
+  const RectificationParameters* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<RectificationParameters>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:com.bcom.solar.gprc.v2.RectificationParameters)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:com.bcom.solar.gprc.v2.RectificationParameters)
+    MergeFrom(*source);
+  }
+}
+
+void RectificationParameters::MergeFrom(const RectificationParameters& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:com.bcom.solar.gprc.v2.RectificationParameters)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from.client_uuid().size() > 0) {
+    _internal_set_client_uuid(from._internal_client_uuid());
+  }
+  if (from.has_cam1()) {
+    _internal_mutable_cam1()->::com::bcom::solar::gprc::v2::Rectification::MergeFrom(from._internal_cam1());
+  }
+  if (from.has_cam2()) {
+    _internal_mutable_cam2()->::com::bcom::solar::gprc::v2::Rectification::MergeFrom(from._internal_cam2());
+  }
+}
+
+void RectificationParameters::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:com.bcom.solar.gprc.v2.RectificationParameters)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void RectificationParameters::CopyFrom(const RectificationParameters& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:com.bcom.solar.gprc.v2.RectificationParameters)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool RectificationParameters::IsInitialized() const {
+  return true;
+}
+
+void RectificationParameters::InternalSwap(RectificationParameters* other) {
+  using std::swap;
+  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
+  client_uuid_.Swap(&other->client_uuid_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(RectificationParameters, cam2_)
+      + sizeof(RectificationParameters::cam2_)
+      - PROTOBUF_FIELD_OFFSET(RectificationParameters, cam1_)>(
+          reinterpret_cast<char*>(&cam1_),
+          reinterpret_cast<char*>(&other->cam1_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata RectificationParameters::GetMetadata() const {
+  return GetMetadataStatic();
+}
+
+
+// ===================================================================
+
+class RelocalizationResult::_Internal {
+ public:
+};
+
+RelocalizationResult::RelocalizationResult(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena),
+  pose_(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:com.bcom.solar.gprc.v2.RelocalizationResult)
+}
+RelocalizationResult::RelocalizationResult(const RelocalizationResult& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message(),
+      pose_(from.pose_) {
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&pose_status_, &from.pose_status_,
+    static_cast<size_t>(reinterpret_cast<char*>(&mapping_status_) -
+    reinterpret_cast<char*>(&pose_status_)) + sizeof(mapping_status_));
+  // @@protoc_insertion_point(copy_constructor:com.bcom.solar.gprc.v2.RelocalizationResult)
+}
+
+void RelocalizationResult::SharedCtor() {
+::memset(reinterpret_cast<char*>(this) + static_cast<size_t>(
+    reinterpret_cast<char*>(&pose_status_) - reinterpret_cast<char*>(this)),
+    0, static_cast<size_t>(reinterpret_cast<char*>(&mapping_status_) -
+    reinterpret_cast<char*>(&pose_status_)) + sizeof(mapping_status_));
+}
+
+RelocalizationResult::~RelocalizationResult() {
+  // @@protoc_insertion_point(destructor:com.bcom.solar.gprc.v2.RelocalizationResult)
+  SharedDtor();
+  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+void RelocalizationResult::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+}
+
+void RelocalizationResult::ArenaDtor(void* object) {
+  RelocalizationResult* _this = reinterpret_cast< RelocalizationResult* >(object);
+  (void)_this;
+}
+void RelocalizationResult::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void RelocalizationResult::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+
+void RelocalizationResult::Clear() {
+// @@protoc_insertion_point(message_clear_start:com.bcom.solar.gprc.v2.RelocalizationResult)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  pose_.Clear();
+  ::memset(&pose_status_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&mapping_status_) -
+      reinterpret_cast<char*>(&pose_status_)) + sizeof(mapping_status_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* RelocalizationResult::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // .com.bcom.solar.gprc.RelocalizationPoseStatus pose_status = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 8)) {
+          ::PROTOBUF_NAMESPACE_ID::uint64 val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_pose_status(static_cast<::com::bcom::solar::gprc::RelocalizationPoseStatus>(val));
+        } else goto handle_unusual;
+        continue;
+      // repeated float pose = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedFloatParser(_internal_mutable_pose(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 21) {
+          _internal_add_pose(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr));
+          ptr += sizeof(float);
+        } else goto handle_unusual;
+        continue;
+      // float confidence = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 29)) {
+          confidence_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else goto handle_unusual;
+        continue;
+      // .com.bcom.solar.gprc.MappingStatus mapping_status = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 32)) {
+          ::PROTOBUF_NAMESPACE_ID::uint64 val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_mapping_status(static_cast<::com::bcom::solar::gprc::MappingStatus>(val));
+        } else goto handle_unusual;
+        continue;
+      // uint64 timestamp = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 40)) {
+          timestamp_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag,
+            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+            ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* RelocalizationResult::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:com.bcom.solar.gprc.v2.RelocalizationResult)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .com.bcom.solar.gprc.RelocalizationPoseStatus pose_status = 1;
+  if (this->pose_status() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_pose_status(), target);
+  }
+
+  // repeated float pose = 2;
+  if (this->_internal_pose_size() > 0) {
+    target = stream->WriteFixedPacked(2, _internal_pose(), target);
+  }
+
+  // float confidence = 3;
+  if (!(this->confidence() <= 0 && this->confidence() >= 0)) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteFloatToArray(3, this->_internal_confidence(), target);
+  }
+
+  // .com.bcom.solar.gprc.MappingStatus mapping_status = 4;
+  if (this->mapping_status() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteEnumToArray(
+      4, this->_internal_mapping_status(), target);
+  }
+
+  // uint64 timestamp = 5;
+  if (this->timestamp() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt64ToArray(5, this->_internal_timestamp(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:com.bcom.solar.gprc.v2.RelocalizationResult)
+  return target;
+}
+
+size_t RelocalizationResult::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:com.bcom.solar.gprc.v2.RelocalizationResult)
+  size_t total_size = 0;
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated float pose = 2;
+  {
+    unsigned int count = static_cast<unsigned int>(this->_internal_pose_size());
+    size_t data_size = 4UL * count;
+    if (data_size > 0) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+            static_cast<::PROTOBUF_NAMESPACE_ID::int32>(data_size));
+    }
+    total_size += data_size;
+  }
+
+  // .com.bcom.solar.gprc.RelocalizationPoseStatus pose_status = 1;
+  if (this->pose_status() != 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::EnumSize(this->_internal_pose_status());
+  }
+
+  // float confidence = 3;
+  if (!(this->confidence() <= 0 && this->confidence() >= 0)) {
+    total_size += 1 + 4;
+  }
+
+  // uint64 timestamp = 5;
+  if (this->timestamp() != 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt64Size(
+        this->_internal_timestamp());
+  }
+
+  // .com.bcom.solar.gprc.MappingStatus mapping_status = 4;
+  if (this->mapping_status() != 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::EnumSize(this->_internal_mapping_status());
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
+        _internal_metadata_, total_size, &_cached_size_);
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void RelocalizationResult::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:com.bcom.solar.gprc.v2.RelocalizationResult)
+  GOOGLE_DCHECK_NE(&from, this);
+  const RelocalizationResult* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<RelocalizationResult>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:com.bcom.solar.gprc.v2.RelocalizationResult)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:com.bcom.solar.gprc.v2.RelocalizationResult)
+    MergeFrom(*source);
+  }
+}
+
+void RelocalizationResult::MergeFrom(const RelocalizationResult& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:com.bcom.solar.gprc.v2.RelocalizationResult)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  pose_.MergeFrom(from.pose_);
+  if (from.pose_status() != 0) {
+    _internal_set_pose_status(from._internal_pose_status());
+  }
+  if (!(from.confidence() <= 0 && from.confidence() >= 0)) {
+    _internal_set_confidence(from._internal_confidence());
+  }
+  if (from.timestamp() != 0) {
+    _internal_set_timestamp(from._internal_timestamp());
+  }
+  if (from.mapping_status() != 0) {
+    _internal_set_mapping_status(from._internal_mapping_status());
+  }
+}
+
+void RelocalizationResult::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:com.bcom.solar.gprc.v2.RelocalizationResult)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void RelocalizationResult::CopyFrom(const RelocalizationResult& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:com.bcom.solar.gprc.v2.RelocalizationResult)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool RelocalizationResult::IsInitialized() const {
+  return true;
+}
+
+void RelocalizationResult::InternalSwap(RelocalizationResult* other) {
+  using std::swap;
+  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
+  pose_.InternalSwap(&other->pose_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(RelocalizationResult, mapping_status_)
+      + sizeof(RelocalizationResult::mapping_status_)
+      - PROTOBUF_FIELD_OFFSET(RelocalizationResult, pose_status_)>(
+          reinterpret_cast<char*>(&pose_status_),
+          reinterpret_cast<char*>(&other->pose_status_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata RelocalizationResult::GetMetadata() const {
+  return GetMetadataStatic();
+}
+
+
+// ===================================================================
+
+class RelocalizationResults::_Internal {
+ public:
+};
+
+RelocalizationResults::RelocalizationResults(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena),
+  results_(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:com.bcom.solar.gprc.v2.RelocalizationResults)
+}
+RelocalizationResults::RelocalizationResults(const RelocalizationResults& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message(),
+      results_(from.results_) {
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:com.bcom.solar.gprc.v2.RelocalizationResults)
+}
+
+void RelocalizationResults::SharedCtor() {
+}
+
+RelocalizationResults::~RelocalizationResults() {
+  // @@protoc_insertion_point(destructor:com.bcom.solar.gprc.v2.RelocalizationResults)
+  SharedDtor();
+  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+void RelocalizationResults::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+}
+
+void RelocalizationResults::ArenaDtor(void* object) {
+  RelocalizationResults* _this = reinterpret_cast< RelocalizationResults* >(object);
+  (void)_this;
+}
+void RelocalizationResults::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void RelocalizationResults::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+
+void RelocalizationResults::Clear() {
+// @@protoc_insertion_point(message_clear_start:com.bcom.solar.gprc.v2.RelocalizationResults)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  results_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* RelocalizationResults::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // repeated .com.bcom.solar.gprc.v2.RelocalizationResult results = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_results(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag,
+            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+            ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* RelocalizationResults::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:com.bcom.solar.gprc.v2.RelocalizationResults)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .com.bcom.solar.gprc.v2.RelocalizationResult results = 1;
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->_internal_results_size()); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, this->_internal_results(i), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:com.bcom.solar.gprc.v2.RelocalizationResults)
+  return target;
+}
+
+size_t RelocalizationResults::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:com.bcom.solar.gprc.v2.RelocalizationResults)
+  size_t total_size = 0;
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .com.bcom.solar.gprc.v2.RelocalizationResult results = 1;
+  total_size += 1UL * this->_internal_results_size();
+  for (const auto& msg : this->results_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
+        _internal_metadata_, total_size, &_cached_size_);
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void RelocalizationResults::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:com.bcom.solar.gprc.v2.RelocalizationResults)
+  GOOGLE_DCHECK_NE(&from, this);
+  const RelocalizationResults* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<RelocalizationResults>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:com.bcom.solar.gprc.v2.RelocalizationResults)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:com.bcom.solar.gprc.v2.RelocalizationResults)
+    MergeFrom(*source);
+  }
+}
+
+void RelocalizationResults::MergeFrom(const RelocalizationResults& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:com.bcom.solar.gprc.v2.RelocalizationResults)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  results_.MergeFrom(from.results_);
+}
+
+void RelocalizationResults::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:com.bcom.solar.gprc.v2.RelocalizationResults)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void RelocalizationResults::CopyFrom(const RelocalizationResults& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:com.bcom.solar.gprc.v2.RelocalizationResults)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool RelocalizationResults::IsInitialized() const {
+  return true;
+}
+
+void RelocalizationResults::InternalSwap(RelocalizationResults* other) {
+  using std::swap;
+  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
+  results_.InternalSwap(&other->results_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata RelocalizationResults::GetMetadata() const {
+  return GetMetadataStatic();
+}
+
+
+// ===================================================================
+
+class Frames::_Internal {
+ public:
+};
+
+Frames::Frames(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena),
+  frames_(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:com.bcom.solar.gprc.v2.Frames)
+}
+Frames::Frames(const Frames& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message(),
+      frames_(from.frames_) {
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  client_uuid_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  if (!from._internal_client_uuid().empty()) {
+    client_uuid_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, from._internal_client_uuid(), 
+      GetArena());
+  }
+  // @@protoc_insertion_point(copy_constructor:com.bcom.solar.gprc.v2.Frames)
+}
+
+void Frames::SharedCtor() {
+client_uuid_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+
+Frames::~Frames() {
+  // @@protoc_insertion_point(destructor:com.bcom.solar.gprc.v2.Frames)
+  SharedDtor();
+  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+void Frames::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+  client_uuid_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+
+void Frames::ArenaDtor(void* object) {
+  Frames* _this = reinterpret_cast< Frames* >(object);
+  (void)_this;
+}
+void Frames::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void Frames::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+
+void Frames::Clear() {
+// @@protoc_insertion_point(message_clear_start:com.bcom.solar.gprc.v2.Frames)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  frames_.Clear();
+  client_uuid_.ClearToEmpty();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Frames::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // string client_uuid = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+          auto str = _internal_mutable_client_uuid();
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "com.bcom.solar.gprc.v2.Frames.client_uuid"));
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // repeated .com.bcom.solar.gprc.v2.Frame frames = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_frames(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag,
+            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+            ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* Frames::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:com.bcom.solar.gprc.v2.Frames)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string client_uuid = 1;
+  if (this->client_uuid().size() > 0) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_client_uuid().data(), static_cast<int>(this->_internal_client_uuid().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "com.bcom.solar.gprc.v2.Frames.client_uuid");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_client_uuid(), target);
+  }
+
+  // repeated .com.bcom.solar.gprc.v2.Frame frames = 2;
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->_internal_frames_size()); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, this->_internal_frames(i), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:com.bcom.solar.gprc.v2.Frames)
+  return target;
+}
+
+size_t Frames::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:com.bcom.solar.gprc.v2.Frames)
+  size_t total_size = 0;
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .com.bcom.solar.gprc.v2.Frame frames = 2;
+  total_size += 1UL * this->_internal_frames_size();
+  for (const auto& msg : this->frames_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // string client_uuid = 1;
+  if (this->client_uuid().size() > 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_client_uuid());
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
+        _internal_metadata_, total_size, &_cached_size_);
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void Frames::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:com.bcom.solar.gprc.v2.Frames)
+  GOOGLE_DCHECK_NE(&from, this);
+  const Frames* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<Frames>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:com.bcom.solar.gprc.v2.Frames)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:com.bcom.solar.gprc.v2.Frames)
+    MergeFrom(*source);
+  }
+}
+
+void Frames::MergeFrom(const Frames& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:com.bcom.solar.gprc.v2.Frames)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  frames_.MergeFrom(from.frames_);
+  if (from.client_uuid().size() > 0) {
+    _internal_set_client_uuid(from._internal_client_uuid());
+  }
+}
+
+void Frames::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:com.bcom.solar.gprc.v2.Frames)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void Frames::CopyFrom(const Frames& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:com.bcom.solar.gprc.v2.Frames)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Frames::IsInitialized() const {
+  return true;
+}
+
+void Frames::InternalSwap(Frames* other) {
+  using std::swap;
+  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
+  frames_.InternalSwap(&other->frames_);
+  client_uuid_.Swap(&other->client_uuid_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Frames::GetMetadata() const {
+  return GetMetadataStatic();
+}
+
+
+// ===================================================================
+
+class FramesBatch::_Internal {
+ public:
+};
+
+FramesBatch::FramesBatch(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena),
+  frames_(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:com.bcom.solar.gprc.v2.FramesBatch)
+}
+FramesBatch::FramesBatch(const FramesBatch& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message(),
+      frames_(from.frames_) {
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  client_uuid_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  if (!from._internal_client_uuid().empty()) {
+    client_uuid_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, from._internal_client_uuid(), 
+      GetArena());
+  }
+  last_result_only_ = from.last_result_only_;
+  // @@protoc_insertion_point(copy_constructor:com.bcom.solar.gprc.v2.FramesBatch)
+}
+
+void FramesBatch::SharedCtor() {
+client_uuid_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+last_result_only_ = false;
+}
+
+FramesBatch::~FramesBatch() {
+  // @@protoc_insertion_point(destructor:com.bcom.solar.gprc.v2.FramesBatch)
+  SharedDtor();
+  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+void FramesBatch::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+  client_uuid_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+
+void FramesBatch::ArenaDtor(void* object) {
+  FramesBatch* _this = reinterpret_cast< FramesBatch* >(object);
+  (void)_this;
+}
+void FramesBatch::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void FramesBatch::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+
+void FramesBatch::Clear() {
+// @@protoc_insertion_point(message_clear_start:com.bcom.solar.gprc.v2.FramesBatch)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  frames_.Clear();
+  client_uuid_.ClearToEmpty();
+  last_result_only_ = false;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* FramesBatch::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // string client_uuid = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+          auto str = _internal_mutable_client_uuid();
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "com.bcom.solar.gprc.v2.FramesBatch.client_uuid"));
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // repeated .com.bcom.solar.gprc.v2.Frames frames = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_frames(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else goto handle_unusual;
+        continue;
+      // bool last_result_only = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 24)) {
+          last_result_only_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag,
+            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+            ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* FramesBatch::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:com.bcom.solar.gprc.v2.FramesBatch)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string client_uuid = 1;
+  if (this->client_uuid().size() > 0) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_client_uuid().data(), static_cast<int>(this->_internal_client_uuid().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "com.bcom.solar.gprc.v2.FramesBatch.client_uuid");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_client_uuid(), target);
+  }
+
+  // repeated .com.bcom.solar.gprc.v2.Frames frames = 2;
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->_internal_frames_size()); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, this->_internal_frames(i), target, stream);
+  }
+
+  // bool last_result_only = 3;
+  if (this->last_result_only() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteBoolToArray(3, this->_internal_last_result_only(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:com.bcom.solar.gprc.v2.FramesBatch)
+  return target;
+}
+
+size_t FramesBatch::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:com.bcom.solar.gprc.v2.FramesBatch)
+  size_t total_size = 0;
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .com.bcom.solar.gprc.v2.Frames frames = 2;
+  total_size += 1UL * this->_internal_frames_size();
+  for (const auto& msg : this->frames_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // string client_uuid = 1;
+  if (this->client_uuid().size() > 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_client_uuid());
+  }
+
+  // bool last_result_only = 3;
+  if (this->last_result_only() != 0) {
+    total_size += 1 + 1;
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
+        _internal_metadata_, total_size, &_cached_size_);
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void FramesBatch::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:com.bcom.solar.gprc.v2.FramesBatch)
+  GOOGLE_DCHECK_NE(&from, this);
+  const FramesBatch* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<FramesBatch>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:com.bcom.solar.gprc.v2.FramesBatch)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:com.bcom.solar.gprc.v2.FramesBatch)
+    MergeFrom(*source);
+  }
+}
+
+void FramesBatch::MergeFrom(const FramesBatch& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:com.bcom.solar.gprc.v2.FramesBatch)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  frames_.MergeFrom(from.frames_);
+  if (from.client_uuid().size() > 0) {
+    _internal_set_client_uuid(from._internal_client_uuid());
+  }
+  if (from.last_result_only() != 0) {
+    _internal_set_last_result_only(from._internal_last_result_only());
+  }
+}
+
+void FramesBatch::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:com.bcom.solar.gprc.v2.FramesBatch)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void FramesBatch::CopyFrom(const FramesBatch& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:com.bcom.solar.gprc.v2.FramesBatch)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool FramesBatch::IsInitialized() const {
+  return true;
+}
+
+void FramesBatch::InternalSwap(FramesBatch* other) {
+  using std::swap;
+  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
+  frames_.InternalSwap(&other->frames_);
+  client_uuid_.Swap(&other->client_uuid_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  swap(last_result_only_, other->last_result_only_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata FramesBatch::GetMetadata() const {
+  return GetMetadataStatic();
+}
+
+
+// ===================================================================
+
+class GroundTruthFrames::_Internal {
+ public:
+  static const ::com::bcom::solar::gprc::v2::Frames& frames(const GroundTruthFrames* msg);
+};
+
+const ::com::bcom::solar::gprc::v2::Frames&
+GroundTruthFrames::_Internal::frames(const GroundTruthFrames* msg) {
+  return *msg->frames_;
+}
+GroundTruthFrames::GroundTruthFrames(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena),
+  world_transform_(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:com.bcom.solar.gprc.v2.GroundTruthFrames)
+}
+GroundTruthFrames::GroundTruthFrames(const GroundTruthFrames& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message(),
+      world_transform_(from.world_transform_) {
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  client_uuid_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  if (!from._internal_client_uuid().empty()) {
+    client_uuid_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, from._internal_client_uuid(), 
+      GetArena());
+  }
+  if (from._internal_has_frames()) {
+    frames_ = new ::com::bcom::solar::gprc::v2::Frames(*from.frames_);
+  } else {
+    frames_ = nullptr;
+  }
+  fixed_pose_ = from.fixed_pose_;
+  // @@protoc_insertion_point(copy_constructor:com.bcom.solar.gprc.v2.GroundTruthFrames)
+}
+
+void GroundTruthFrames::SharedCtor() {
+client_uuid_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+::memset(reinterpret_cast<char*>(this) + static_cast<size_t>(
+    reinterpret_cast<char*>(&frames_) - reinterpret_cast<char*>(this)),
+    0, static_cast<size_t>(reinterpret_cast<char*>(&fixed_pose_) -
+    reinterpret_cast<char*>(&frames_)) + sizeof(fixed_pose_));
+}
+
+GroundTruthFrames::~GroundTruthFrames() {
+  // @@protoc_insertion_point(destructor:com.bcom.solar.gprc.v2.GroundTruthFrames)
+  SharedDtor();
+  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+void GroundTruthFrames::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+  client_uuid_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  if (this != internal_default_instance()) delete frames_;
+}
+
+void GroundTruthFrames::ArenaDtor(void* object) {
+  GroundTruthFrames* _this = reinterpret_cast< GroundTruthFrames* >(object);
+  (void)_this;
+}
+void GroundTruthFrames::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void GroundTruthFrames::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+
+void GroundTruthFrames::Clear() {
+// @@protoc_insertion_point(message_clear_start:com.bcom.solar.gprc.v2.GroundTruthFrames)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  world_transform_.Clear();
+  client_uuid_.ClearToEmpty();
+  if (GetArena() == nullptr && frames_ != nullptr) {
+    delete frames_;
+  }
+  frames_ = nullptr;
+  fixed_pose_ = false;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* GroundTruthFrames::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // string client_uuid = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+          auto str = _internal_mutable_client_uuid();
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "com.bcom.solar.gprc.v2.GroundTruthFrames.client_uuid"));
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .com.bcom.solar.gprc.v2.Frames frames = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_frames(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // repeated float world_transform = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 26)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedFloatParser(_internal_mutable_world_transform(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 29) {
+          _internal_add_world_transform(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr));
+          ptr += sizeof(float);
+        } else goto handle_unusual;
+        continue;
+      // bool fixed_pose = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 32)) {
+          fixed_pose_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag,
+            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+            ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* GroundTruthFrames::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:com.bcom.solar.gprc.v2.GroundTruthFrames)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string client_uuid = 1;
+  if (this->client_uuid().size() > 0) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_client_uuid().data(), static_cast<int>(this->_internal_client_uuid().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "com.bcom.solar.gprc.v2.GroundTruthFrames.client_uuid");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_client_uuid(), target);
+  }
+
+  // .com.bcom.solar.gprc.v2.Frames frames = 2;
+  if (this->has_frames()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        2, _Internal::frames(this), target, stream);
+  }
+
+  // repeated float world_transform = 3;
+  if (this->_internal_world_transform_size() > 0) {
+    target = stream->WriteFixedPacked(3, _internal_world_transform(), target);
+  }
+
+  // bool fixed_pose = 4;
+  if (this->fixed_pose() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteBoolToArray(4, this->_internal_fixed_pose(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:com.bcom.solar.gprc.v2.GroundTruthFrames)
+  return target;
+}
+
+size_t GroundTruthFrames::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:com.bcom.solar.gprc.v2.GroundTruthFrames)
+  size_t total_size = 0;
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated float world_transform = 3;
+  {
+    unsigned int count = static_cast<unsigned int>(this->_internal_world_transform_size());
+    size_t data_size = 4UL * count;
+    if (data_size > 0) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+            static_cast<::PROTOBUF_NAMESPACE_ID::int32>(data_size));
+    }
+    total_size += data_size;
+  }
+
+  // string client_uuid = 1;
+  if (this->client_uuid().size() > 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_client_uuid());
+  }
+
+  // .com.bcom.solar.gprc.v2.Frames frames = 2;
+  if (this->has_frames()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *frames_);
+  }
+
+  // bool fixed_pose = 4;
+  if (this->fixed_pose() != 0) {
+    total_size += 1 + 1;
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
+        _internal_metadata_, total_size, &_cached_size_);
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void GroundTruthFrames::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:com.bcom.solar.gprc.v2.GroundTruthFrames)
+  GOOGLE_DCHECK_NE(&from, this);
+  const GroundTruthFrames* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<GroundTruthFrames>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:com.bcom.solar.gprc.v2.GroundTruthFrames)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:com.bcom.solar.gprc.v2.GroundTruthFrames)
+    MergeFrom(*source);
+  }
+}
+
+void GroundTruthFrames::MergeFrom(const GroundTruthFrames& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:com.bcom.solar.gprc.v2.GroundTruthFrames)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  world_transform_.MergeFrom(from.world_transform_);
+  if (from.client_uuid().size() > 0) {
+    _internal_set_client_uuid(from._internal_client_uuid());
+  }
+  if (from.has_frames()) {
+    _internal_mutable_frames()->::com::bcom::solar::gprc::v2::Frames::MergeFrom(from._internal_frames());
+  }
+  if (from.fixed_pose() != 0) {
+    _internal_set_fixed_pose(from._internal_fixed_pose());
+  }
+}
+
+void GroundTruthFrames::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:com.bcom.solar.gprc.v2.GroundTruthFrames)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void GroundTruthFrames::CopyFrom(const GroundTruthFrames& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:com.bcom.solar.gprc.v2.GroundTruthFrames)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool GroundTruthFrames::IsInitialized() const {
+  return true;
+}
+
+void GroundTruthFrames::InternalSwap(GroundTruthFrames* other) {
+  using std::swap;
+  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
+  world_transform_.InternalSwap(&other->world_transform_);
+  client_uuid_.Swap(&other->client_uuid_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(GroundTruthFrames, fixed_pose_)
+      + sizeof(GroundTruthFrames::fixed_pose_)
+      - PROTOBUF_FIELD_OFFSET(GroundTruthFrames, frames_)>(
+          reinterpret_cast<char*>(&frames_),
+          reinterpret_cast<char*>(&other->frames_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata GroundTruthFrames::GetMetadata() const {
+  return GetMetadataStatic();
+}
+
+
+// ===================================================================
+
+class Frame::_Internal {
+ public:
+  static const ::com::bcom::solar::gprc::Image& image(const Frame* msg);
+};
+
+const ::com::bcom::solar::gprc::Image&
+Frame::_Internal::image(const Frame* msg) {
+  return *msg->image_;
+}
+void Frame::clear_image() {
+  if (GetArena() == nullptr && image_ != nullptr) {
+    delete image_;
+  }
+  image_ = nullptr;
+}
+Frame::Frame(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena),
+  pose_(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:com.bcom.solar.gprc.v2.Frame)
+}
+Frame::Frame(const Frame& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message(),
+      pose_(from.pose_) {
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_image()) {
+    image_ = new ::com::bcom::solar::gprc::Image(*from.image_);
+  } else {
+    image_ = nullptr;
+  }
+  ::memcpy(&timestamp_, &from.timestamp_,
+    static_cast<size_t>(reinterpret_cast<char*>(&sensor_id_) -
+    reinterpret_cast<char*>(&timestamp_)) + sizeof(sensor_id_));
+  // @@protoc_insertion_point(copy_constructor:com.bcom.solar.gprc.v2.Frame)
+}
+
+void Frame::SharedCtor() {
+::memset(reinterpret_cast<char*>(this) + static_cast<size_t>(
+    reinterpret_cast<char*>(&image_) - reinterpret_cast<char*>(this)),
+    0, static_cast<size_t>(reinterpret_cast<char*>(&sensor_id_) -
+    reinterpret_cast<char*>(&image_)) + sizeof(sensor_id_));
+}
+
+Frame::~Frame() {
+  // @@protoc_insertion_point(destructor:com.bcom.solar.gprc.v2.Frame)
+  SharedDtor();
+  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+void Frame::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+  if (this != internal_default_instance()) delete image_;
+}
+
+void Frame::ArenaDtor(void* object) {
+  Frame* _this = reinterpret_cast< Frame* >(object);
+  (void)_this;
+}
+void Frame::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void Frame::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+
+void Frame::Clear() {
+// @@protoc_insertion_point(message_clear_start:com.bcom.solar.gprc.v2.Frame)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  pose_.Clear();
+  if (GetArena() == nullptr && image_ != nullptr) {
+    delete image_;
+  }
+  image_ = nullptr;
+  ::memset(&timestamp_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&sensor_id_) -
+      reinterpret_cast<char*>(&timestamp_)) + sizeof(sensor_id_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Frame::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // int32 sensor_id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 8)) {
+          sensor_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .com.bcom.solar.gprc.Image image = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_image(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // uint64 timestamp = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 24)) {
+          timestamp_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // repeated float pose = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 34)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedFloatParser(_internal_mutable_pose(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 37) {
+          _internal_add_pose(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr));
+          ptr += sizeof(float);
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag,
+            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+            ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* Frame::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:com.bcom.solar.gprc.v2.Frame)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int32 sensor_id = 1;
+  if (this->sensor_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(1, this->_internal_sensor_id(), target);
+  }
+
+  // .com.bcom.solar.gprc.Image image = 2;
+  if (this->has_image()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        2, _Internal::image(this), target, stream);
+  }
+
+  // uint64 timestamp = 3;
+  if (this->timestamp() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt64ToArray(3, this->_internal_timestamp(), target);
+  }
+
+  // repeated float pose = 4;
+  if (this->_internal_pose_size() > 0) {
+    target = stream->WriteFixedPacked(4, _internal_pose(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:com.bcom.solar.gprc.v2.Frame)
+  return target;
+}
+
+size_t Frame::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:com.bcom.solar.gprc.v2.Frame)
+  size_t total_size = 0;
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated float pose = 4;
+  {
+    unsigned int count = static_cast<unsigned int>(this->_internal_pose_size());
+    size_t data_size = 4UL * count;
+    if (data_size > 0) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+            static_cast<::PROTOBUF_NAMESPACE_ID::int32>(data_size));
+    }
+    total_size += data_size;
+  }
+
+  // .com.bcom.solar.gprc.Image image = 2;
+  if (this->has_image()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *image_);
+  }
+
+  // uint64 timestamp = 3;
+  if (this->timestamp() != 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt64Size(
+        this->_internal_timestamp());
+  }
+
+  // int32 sensor_id = 1;
+  if (this->sensor_id() != 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+        this->_internal_sensor_id());
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
+        _internal_metadata_, total_size, &_cached_size_);
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void Frame::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:com.bcom.solar.gprc.v2.Frame)
+  GOOGLE_DCHECK_NE(&from, this);
+  const Frame* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<Frame>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:com.bcom.solar.gprc.v2.Frame)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:com.bcom.solar.gprc.v2.Frame)
+    MergeFrom(*source);
+  }
+}
+
+void Frame::MergeFrom(const Frame& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:com.bcom.solar.gprc.v2.Frame)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  pose_.MergeFrom(from.pose_);
+  if (from.has_image()) {
+    _internal_mutable_image()->::com::bcom::solar::gprc::Image::MergeFrom(from._internal_image());
+  }
+  if (from.timestamp() != 0) {
+    _internal_set_timestamp(from._internal_timestamp());
+  }
+  if (from.sensor_id() != 0) {
+    _internal_set_sensor_id(from._internal_sensor_id());
+  }
+}
+
+void Frame::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:com.bcom.solar.gprc.v2.Frame)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void Frame::CopyFrom(const Frame& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:com.bcom.solar.gprc.v2.Frame)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Frame::IsInitialized() const {
+  return true;
+}
+
+void Frame::InternalSwap(Frame* other) {
+  using std::swap;
+  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
+  pose_.InternalSwap(&other->pose_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Frame, sensor_id_)
+      + sizeof(Frame::sensor_id_)
+      - PROTOBUF_FIELD_OFFSET(Frame, image_)>(
+          reinterpret_cast<char*>(&image_),
+          reinterpret_cast<char*>(&other->image_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Frame::GetMetadata() const {
+  return GetMetadataStatic();
+}
+
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace v2
+}  // namespace gprc
+}  // namespace solar
+}  // namespace bcom
+}  // namespace com
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::com::bcom::solar::gprc::v2::Camera* Arena::CreateMaybeMessage< ::com::bcom::solar::gprc::v2::Camera >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::com::bcom::solar::gprc::v2::Camera >(arena);
+}
+template<> PROTOBUF_NOINLINE ::com::bcom::solar::gprc::v2::CameraParameters* Arena::CreateMaybeMessage< ::com::bcom::solar::gprc::v2::CameraParameters >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::com::bcom::solar::gprc::v2::CameraParameters >(arena);
+}
+template<> PROTOBUF_NOINLINE ::com::bcom::solar::gprc::v2::CameraParametersStereo* Arena::CreateMaybeMessage< ::com::bcom::solar::gprc::v2::CameraParametersStereo >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::com::bcom::solar::gprc::v2::CameraParametersStereo >(arena);
+}
+template<> PROTOBUF_NOINLINE ::com::bcom::solar::gprc::v2::Rectification* Arena::CreateMaybeMessage< ::com::bcom::solar::gprc::v2::Rectification >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::com::bcom::solar::gprc::v2::Rectification >(arena);
+}
+template<> PROTOBUF_NOINLINE ::com::bcom::solar::gprc::v2::RectificationParameters* Arena::CreateMaybeMessage< ::com::bcom::solar::gprc::v2::RectificationParameters >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::com::bcom::solar::gprc::v2::RectificationParameters >(arena);
+}
+template<> PROTOBUF_NOINLINE ::com::bcom::solar::gprc::v2::RelocalizationResult* Arena::CreateMaybeMessage< ::com::bcom::solar::gprc::v2::RelocalizationResult >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::com::bcom::solar::gprc::v2::RelocalizationResult >(arena);
+}
+template<> PROTOBUF_NOINLINE ::com::bcom::solar::gprc::v2::RelocalizationResults* Arena::CreateMaybeMessage< ::com::bcom::solar::gprc::v2::RelocalizationResults >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::com::bcom::solar::gprc::v2::RelocalizationResults >(arena);
+}
+template<> PROTOBUF_NOINLINE ::com::bcom::solar::gprc::v2::Frames* Arena::CreateMaybeMessage< ::com::bcom::solar::gprc::v2::Frames >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::com::bcom::solar::gprc::v2::Frames >(arena);
+}
+template<> PROTOBUF_NOINLINE ::com::bcom::solar::gprc::v2::FramesBatch* Arena::CreateMaybeMessage< ::com::bcom::solar::gprc::v2::FramesBatch >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::com::bcom::solar::gprc::v2::FramesBatch >(arena);
+}
+template<> PROTOBUF_NOINLINE ::com::bcom::solar::gprc::v2::GroundTruthFrames* Arena::CreateMaybeMessage< ::com::bcom::solar::gprc::v2::GroundTruthFrames >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::com::bcom::solar::gprc::v2::GroundTruthFrames >(arena);
+}
+template<> PROTOBUF_NOINLINE ::com::bcom::solar::gprc::v2::Frame* Arena::CreateMaybeMessage< ::com::bcom::solar::gprc::v2::Frame >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::com::bcom::solar::gprc::v2::Frame >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
@@ -0,0 +1,3999 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: solar_mapping_and_relocalization_proxy_v2.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_solar_5fmapping_5fand_5frelocalization_5fproxy_5fv2_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_solar_5fmapping_5fand_5frelocalization_5fproxy_5fv2_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3015000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3015002 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_table_driven.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/unknown_field_set.h>
+#include "solar_mapping_and_relocalization_proxy.pb.h"
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_solar_5fmapping_5fand_5frelocalization_5fproxy_5fv2_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_solar_5fmapping_5fand_5frelocalization_5fproxy_5fv2_2eproto {
+  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTableField entries[]
+    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
+  static const ::PROTOBUF_NAMESPACE_ID::internal::AuxiliaryParseTableField aux[]
+    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
+  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTable schema[11]
+    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
+  static const ::PROTOBUF_NAMESPACE_ID::internal::FieldMetadata field_metadata[];
+  static const ::PROTOBUF_NAMESPACE_ID::internal::SerializationTable serialization_table[];
+  static const ::PROTOBUF_NAMESPACE_ID::uint32 offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_solar_5fmapping_5fand_5frelocalization_5fproxy_5fv2_2eproto;
+::PROTOBUF_NAMESPACE_ID::Metadata descriptor_table_solar_5fmapping_5fand_5frelocalization_5fproxy_5fv2_2eproto_metadata_getter(int index);
+namespace com {
+namespace bcom {
+namespace solar {
+namespace gprc {
+namespace v2 {
+class Camera;
+struct CameraDefaultTypeInternal;
+extern CameraDefaultTypeInternal _Camera_default_instance_;
+class CameraParameters;
+struct CameraParametersDefaultTypeInternal;
+extern CameraParametersDefaultTypeInternal _CameraParameters_default_instance_;
+class CameraParametersStereo;
+struct CameraParametersStereoDefaultTypeInternal;
+extern CameraParametersStereoDefaultTypeInternal _CameraParametersStereo_default_instance_;
+class Frame;
+struct FrameDefaultTypeInternal;
+extern FrameDefaultTypeInternal _Frame_default_instance_;
+class Frames;
+struct FramesDefaultTypeInternal;
+extern FramesDefaultTypeInternal _Frames_default_instance_;
+class FramesBatch;
+struct FramesBatchDefaultTypeInternal;
+extern FramesBatchDefaultTypeInternal _FramesBatch_default_instance_;
+class GroundTruthFrames;
+struct GroundTruthFramesDefaultTypeInternal;
+extern GroundTruthFramesDefaultTypeInternal _GroundTruthFrames_default_instance_;
+class Rectification;
+struct RectificationDefaultTypeInternal;
+extern RectificationDefaultTypeInternal _Rectification_default_instance_;
+class RectificationParameters;
+struct RectificationParametersDefaultTypeInternal;
+extern RectificationParametersDefaultTypeInternal _RectificationParameters_default_instance_;
+class RelocalizationResult;
+struct RelocalizationResultDefaultTypeInternal;
+extern RelocalizationResultDefaultTypeInternal _RelocalizationResult_default_instance_;
+class RelocalizationResults;
+struct RelocalizationResultsDefaultTypeInternal;
+extern RelocalizationResultsDefaultTypeInternal _RelocalizationResults_default_instance_;
+}  // namespace v2
+}  // namespace gprc
+}  // namespace solar
+}  // namespace bcom
+}  // namespace com
+PROTOBUF_NAMESPACE_OPEN
+template<> ::com::bcom::solar::gprc::v2::Camera* Arena::CreateMaybeMessage<::com::bcom::solar::gprc::v2::Camera>(Arena*);
+template<> ::com::bcom::solar::gprc::v2::CameraParameters* Arena::CreateMaybeMessage<::com::bcom::solar::gprc::v2::CameraParameters>(Arena*);
+template<> ::com::bcom::solar::gprc::v2::CameraParametersStereo* Arena::CreateMaybeMessage<::com::bcom::solar::gprc::v2::CameraParametersStereo>(Arena*);
+template<> ::com::bcom::solar::gprc::v2::Frame* Arena::CreateMaybeMessage<::com::bcom::solar::gprc::v2::Frame>(Arena*);
+template<> ::com::bcom::solar::gprc::v2::Frames* Arena::CreateMaybeMessage<::com::bcom::solar::gprc::v2::Frames>(Arena*);
+template<> ::com::bcom::solar::gprc::v2::FramesBatch* Arena::CreateMaybeMessage<::com::bcom::solar::gprc::v2::FramesBatch>(Arena*);
+template<> ::com::bcom::solar::gprc::v2::GroundTruthFrames* Arena::CreateMaybeMessage<::com::bcom::solar::gprc::v2::GroundTruthFrames>(Arena*);
+template<> ::com::bcom::solar::gprc::v2::Rectification* Arena::CreateMaybeMessage<::com::bcom::solar::gprc::v2::Rectification>(Arena*);
+template<> ::com::bcom::solar::gprc::v2::RectificationParameters* Arena::CreateMaybeMessage<::com::bcom::solar::gprc::v2::RectificationParameters>(Arena*);
+template<> ::com::bcom::solar::gprc::v2::RelocalizationResult* Arena::CreateMaybeMessage<::com::bcom::solar::gprc::v2::RelocalizationResult>(Arena*);
+template<> ::com::bcom::solar::gprc::v2::RelocalizationResults* Arena::CreateMaybeMessage<::com::bcom::solar::gprc::v2::RelocalizationResults>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace com {
+namespace bcom {
+namespace solar {
+namespace gprc {
+namespace v2 {
+
+// ===================================================================
+
+class Camera PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:com.bcom.solar.gprc.v2.Camera) */ {
+ public:
+  inline Camera() : Camera(nullptr) {}
+  virtual ~Camera();
+  explicit constexpr Camera(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Camera(const Camera& from);
+  Camera(Camera&& from) noexcept
+    : Camera() {
+    *this = ::std::move(from);
+  }
+
+  inline Camera& operator=(const Camera& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Camera& operator=(Camera&& from) noexcept {
+    if (GetArena() == from.GetArena()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return GetMetadataStatic().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return GetMetadataStatic().reflection;
+  }
+  static const Camera& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Camera* internal_default_instance() {
+    return reinterpret_cast<const Camera*>(
+               &_Camera_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(Camera& a, Camera& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Camera* other) {
+    if (other == this) return;
+    if (GetArena() == other->GetArena()) {
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Camera* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline Camera* New() const final {
+    return CreateMaybeMessage<Camera>(nullptr);
+  }
+
+  Camera* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<Camera>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const Camera& from);
+  void MergeFrom(const Camera& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Camera* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "com.bcom.solar.gprc.v2.Camera";
+  }
+  protected:
+  explicit Camera(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    return ::descriptor_table_solar_5fmapping_5fand_5frelocalization_5fproxy_5fv2_2eproto_metadata_getter(kIndexInFileMessages);
+  }
+
+  public:
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kIntrinsicsFieldNumber = 6,
+    kDistortionFieldNumber = 7,
+    kNameFieldNumber = 1,
+    kIdFieldNumber = 2,
+    kCameraTypeFieldNumber = 3,
+    kWidthFieldNumber = 4,
+    kHeightFieldNumber = 5,
+    kRotationFieldNumber = 8,
+  };
+  // repeated float intrinsics = 6;
+  int intrinsics_size() const;
+  private:
+  int _internal_intrinsics_size() const;
+  public:
+  void clear_intrinsics();
+  private:
+  float _internal_intrinsics(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+      _internal_intrinsics() const;
+  void _internal_add_intrinsics(float value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+      _internal_mutable_intrinsics();
+  public:
+  float intrinsics(int index) const;
+  void set_intrinsics(int index, float value);
+  void add_intrinsics(float value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+      intrinsics() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+      mutable_intrinsics();
+
+  // repeated float distortion = 7;
+  int distortion_size() const;
+  private:
+  int _internal_distortion_size() const;
+  public:
+  void clear_distortion();
+  private:
+  float _internal_distortion(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+      _internal_distortion() const;
+  void _internal_add_distortion(float value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+      _internal_mutable_distortion();
+  public:
+  float distortion(int index) const;
+  void set_distortion(int index, float value);
+  void add_distortion(float value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+      distortion() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+      mutable_distortion();
+
+  // string name = 1;
+  void clear_name();
+  const std::string& name() const;
+  void set_name(const std::string& value);
+  void set_name(std::string&& value);
+  void set_name(const char* value);
+  void set_name(const char* value, size_t size);
+  std::string* mutable_name();
+  std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
+
+  // uint32 id = 2;
+  void clear_id();
+  ::PROTOBUF_NAMESPACE_ID::uint32 id() const;
+  void set_id(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::uint32 _internal_id() const;
+  void _internal_set_id(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  public:
+
+  // .com.bcom.solar.gprc.CameraType camera_type = 3;
+  void clear_camera_type();
+  ::com::bcom::solar::gprc::CameraType camera_type() const;
+  void set_camera_type(::com::bcom::solar::gprc::CameraType value);
+  private:
+  ::com::bcom::solar::gprc::CameraType _internal_camera_type() const;
+  void _internal_set_camera_type(::com::bcom::solar::gprc::CameraType value);
+  public:
+
+  // uint32 width = 4;
+  void clear_width();
+  ::PROTOBUF_NAMESPACE_ID::uint32 width() const;
+  void set_width(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::uint32 _internal_width() const;
+  void _internal_set_width(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  public:
+
+  // uint32 height = 5;
+  void clear_height();
+  ::PROTOBUF_NAMESPACE_ID::uint32 height() const;
+  void set_height(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::uint32 _internal_height() const;
+  void _internal_set_height(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  public:
+
+  // .com.bcom.solar.gprc.ImageRotation rotation = 8;
+  void clear_rotation();
+  ::com::bcom::solar::gprc::ImageRotation rotation() const;
+  void set_rotation(::com::bcom::solar::gprc::ImageRotation value);
+  private:
+  ::com::bcom::solar::gprc::ImageRotation _internal_rotation() const;
+  void _internal_set_rotation(::com::bcom::solar::gprc::ImageRotation value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:com.bcom.solar.gprc.v2.Camera)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< float > intrinsics_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< float > distortion_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+  ::PROTOBUF_NAMESPACE_ID::uint32 id_;
+  int camera_type_;
+  ::PROTOBUF_NAMESPACE_ID::uint32 width_;
+  ::PROTOBUF_NAMESPACE_ID::uint32 height_;
+  int rotation_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_solar_5fmapping_5fand_5frelocalization_5fproxy_5fv2_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CameraParameters PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:com.bcom.solar.gprc.v2.CameraParameters) */ {
+ public:
+  inline CameraParameters() : CameraParameters(nullptr) {}
+  virtual ~CameraParameters();
+  explicit constexpr CameraParameters(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CameraParameters(const CameraParameters& from);
+  CameraParameters(CameraParameters&& from) noexcept
+    : CameraParameters() {
+    *this = ::std::move(from);
+  }
+
+  inline CameraParameters& operator=(const CameraParameters& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CameraParameters& operator=(CameraParameters&& from) noexcept {
+    if (GetArena() == from.GetArena()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return GetMetadataStatic().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return GetMetadataStatic().reflection;
+  }
+  static const CameraParameters& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CameraParameters* internal_default_instance() {
+    return reinterpret_cast<const CameraParameters*>(
+               &_CameraParameters_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(CameraParameters& a, CameraParameters& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CameraParameters* other) {
+    if (other == this) return;
+    if (GetArena() == other->GetArena()) {
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CameraParameters* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline CameraParameters* New() const final {
+    return CreateMaybeMessage<CameraParameters>(nullptr);
+  }
+
+  CameraParameters* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<CameraParameters>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const CameraParameters& from);
+  void MergeFrom(const CameraParameters& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CameraParameters* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "com.bcom.solar.gprc.v2.CameraParameters";
+  }
+  protected:
+  explicit CameraParameters(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    return ::descriptor_table_solar_5fmapping_5fand_5frelocalization_5fproxy_5fv2_2eproto_metadata_getter(kIndexInFileMessages);
+  }
+
+  public:
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kClientUuidFieldNumber = 1,
+    kCameraFieldNumber = 2,
+  };
+  // string client_uuid = 1;
+  void clear_client_uuid();
+  const std::string& client_uuid() const;
+  void set_client_uuid(const std::string& value);
+  void set_client_uuid(std::string&& value);
+  void set_client_uuid(const char* value);
+  void set_client_uuid(const char* value, size_t size);
+  std::string* mutable_client_uuid();
+  std::string* release_client_uuid();
+  void set_allocated_client_uuid(std::string* client_uuid);
+  private:
+  const std::string& _internal_client_uuid() const;
+  void _internal_set_client_uuid(const std::string& value);
+  std::string* _internal_mutable_client_uuid();
+  public:
+
+  // .com.bcom.solar.gprc.v2.Camera camera = 2;
+  bool has_camera() const;
+  private:
+  bool _internal_has_camera() const;
+  public:
+  void clear_camera();
+  const ::com::bcom::solar::gprc::v2::Camera& camera() const;
+  ::com::bcom::solar::gprc::v2::Camera* release_camera();
+  ::com::bcom::solar::gprc::v2::Camera* mutable_camera();
+  void set_allocated_camera(::com::bcom::solar::gprc::v2::Camera* camera);
+  private:
+  const ::com::bcom::solar::gprc::v2::Camera& _internal_camera() const;
+  ::com::bcom::solar::gprc::v2::Camera* _internal_mutable_camera();
+  public:
+  void unsafe_arena_set_allocated_camera(
+      ::com::bcom::solar::gprc::v2::Camera* camera);
+  ::com::bcom::solar::gprc::v2::Camera* unsafe_arena_release_camera();
+
+  // @@protoc_insertion_point(class_scope:com.bcom.solar.gprc.v2.CameraParameters)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr client_uuid_;
+  ::com::bcom::solar::gprc::v2::Camera* camera_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_solar_5fmapping_5fand_5frelocalization_5fproxy_5fv2_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CameraParametersStereo PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:com.bcom.solar.gprc.v2.CameraParametersStereo) */ {
+ public:
+  inline CameraParametersStereo() : CameraParametersStereo(nullptr) {}
+  virtual ~CameraParametersStereo();
+  explicit constexpr CameraParametersStereo(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CameraParametersStereo(const CameraParametersStereo& from);
+  CameraParametersStereo(CameraParametersStereo&& from) noexcept
+    : CameraParametersStereo() {
+    *this = ::std::move(from);
+  }
+
+  inline CameraParametersStereo& operator=(const CameraParametersStereo& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CameraParametersStereo& operator=(CameraParametersStereo&& from) noexcept {
+    if (GetArena() == from.GetArena()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return GetMetadataStatic().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return GetMetadataStatic().reflection;
+  }
+  static const CameraParametersStereo& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CameraParametersStereo* internal_default_instance() {
+    return reinterpret_cast<const CameraParametersStereo*>(
+               &_CameraParametersStereo_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  friend void swap(CameraParametersStereo& a, CameraParametersStereo& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CameraParametersStereo* other) {
+    if (other == this) return;
+    if (GetArena() == other->GetArena()) {
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CameraParametersStereo* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline CameraParametersStereo* New() const final {
+    return CreateMaybeMessage<CameraParametersStereo>(nullptr);
+  }
+
+  CameraParametersStereo* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<CameraParametersStereo>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const CameraParametersStereo& from);
+  void MergeFrom(const CameraParametersStereo& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CameraParametersStereo* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "com.bcom.solar.gprc.v2.CameraParametersStereo";
+  }
+  protected:
+  explicit CameraParametersStereo(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    return ::descriptor_table_solar_5fmapping_5fand_5frelocalization_5fproxy_5fv2_2eproto_metadata_getter(kIndexInFileMessages);
+  }
+
+  public:
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kClientUuidFieldNumber = 1,
+    kCamera1FieldNumber = 2,
+    kCamera2FieldNumber = 3,
+  };
+  // string client_uuid = 1;
+  void clear_client_uuid();
+  const std::string& client_uuid() const;
+  void set_client_uuid(const std::string& value);
+  void set_client_uuid(std::string&& value);
+  void set_client_uuid(const char* value);
+  void set_client_uuid(const char* value, size_t size);
+  std::string* mutable_client_uuid();
+  std::string* release_client_uuid();
+  void set_allocated_client_uuid(std::string* client_uuid);
+  private:
+  const std::string& _internal_client_uuid() const;
+  void _internal_set_client_uuid(const std::string& value);
+  std::string* _internal_mutable_client_uuid();
+  public:
+
+  // .com.bcom.solar.gprc.v2.Camera camera1 = 2;
+  bool has_camera1() const;
+  private:
+  bool _internal_has_camera1() const;
+  public:
+  void clear_camera1();
+  const ::com::bcom::solar::gprc::v2::Camera& camera1() const;
+  ::com::bcom::solar::gprc::v2::Camera* release_camera1();
+  ::com::bcom::solar::gprc::v2::Camera* mutable_camera1();
+  void set_allocated_camera1(::com::bcom::solar::gprc::v2::Camera* camera1);
+  private:
+  const ::com::bcom::solar::gprc::v2::Camera& _internal_camera1() const;
+  ::com::bcom::solar::gprc::v2::Camera* _internal_mutable_camera1();
+  public:
+  void unsafe_arena_set_allocated_camera1(
+      ::com::bcom::solar::gprc::v2::Camera* camera1);
+  ::com::bcom::solar::gprc::v2::Camera* unsafe_arena_release_camera1();
+
+  // .com.bcom.solar.gprc.v2.Camera camera2 = 3;
+  bool has_camera2() const;
+  private:
+  bool _internal_has_camera2() const;
+  public:
+  void clear_camera2();
+  const ::com::bcom::solar::gprc::v2::Camera& camera2() const;
+  ::com::bcom::solar::gprc::v2::Camera* release_camera2();
+  ::com::bcom::solar::gprc::v2::Camera* mutable_camera2();
+  void set_allocated_camera2(::com::bcom::solar::gprc::v2::Camera* camera2);
+  private:
+  const ::com::bcom::solar::gprc::v2::Camera& _internal_camera2() const;
+  ::com::bcom::solar::gprc::v2::Camera* _internal_mutable_camera2();
+  public:
+  void unsafe_arena_set_allocated_camera2(
+      ::com::bcom::solar::gprc::v2::Camera* camera2);
+  ::com::bcom::solar::gprc::v2::Camera* unsafe_arena_release_camera2();
+
+  // @@protoc_insertion_point(class_scope:com.bcom.solar.gprc.v2.CameraParametersStereo)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr client_uuid_;
+  ::com::bcom::solar::gprc::v2::Camera* camera1_;
+  ::com::bcom::solar::gprc::v2::Camera* camera2_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_solar_5fmapping_5fand_5frelocalization_5fproxy_5fv2_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Rectification PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:com.bcom.solar.gprc.v2.Rectification) */ {
+ public:
+  inline Rectification() : Rectification(nullptr) {}
+  virtual ~Rectification();
+  explicit constexpr Rectification(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Rectification(const Rectification& from);
+  Rectification(Rectification&& from) noexcept
+    : Rectification() {
+    *this = ::std::move(from);
+  }
+
+  inline Rectification& operator=(const Rectification& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Rectification& operator=(Rectification&& from) noexcept {
+    if (GetArena() == from.GetArena()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return GetMetadataStatic().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return GetMetadataStatic().reflection;
+  }
+  static const Rectification& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Rectification* internal_default_instance() {
+    return reinterpret_cast<const Rectification*>(
+               &_Rectification_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    3;
+
+  friend void swap(Rectification& a, Rectification& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Rectification* other) {
+    if (other == this) return;
+    if (GetArena() == other->GetArena()) {
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Rectification* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline Rectification* New() const final {
+    return CreateMaybeMessage<Rectification>(nullptr);
+  }
+
+  Rectification* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<Rectification>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const Rectification& from);
+  void MergeFrom(const Rectification& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Rectification* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "com.bcom.solar.gprc.v2.Rectification";
+  }
+  protected:
+  explicit Rectification(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    return ::descriptor_table_solar_5fmapping_5fand_5frelocalization_5fproxy_5fv2_2eproto_metadata_getter(kIndexInFileMessages);
+  }
+
+  public:
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRotationFieldNumber = 1,
+    kProjectionFieldNumber = 2,
+    kStereoTypeFieldNumber = 3,
+    kBaselineFieldNumber = 4,
+  };
+  // repeated float rotation = 1;
+  int rotation_size() const;
+  private:
+  int _internal_rotation_size() const;
+  public:
+  void clear_rotation();
+  private:
+  float _internal_rotation(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+      _internal_rotation() const;
+  void _internal_add_rotation(float value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+      _internal_mutable_rotation();
+  public:
+  float rotation(int index) const;
+  void set_rotation(int index, float value);
+  void add_rotation(float value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+      rotation() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+      mutable_rotation();
+
+  // repeated float projection = 2;
+  int projection_size() const;
+  private:
+  int _internal_projection_size() const;
+  public:
+  void clear_projection();
+  private:
+  float _internal_projection(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+      _internal_projection() const;
+  void _internal_add_projection(float value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+      _internal_mutable_projection();
+  public:
+  float projection(int index) const;
+  void set_projection(int index, float value);
+  void add_projection(float value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+      projection() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+      mutable_projection();
+
+  // .com.bcom.solar.gprc.StereoType stereo_type = 3;
+  void clear_stereo_type();
+  ::com::bcom::solar::gprc::StereoType stereo_type() const;
+  void set_stereo_type(::com::bcom::solar::gprc::StereoType value);
+  private:
+  ::com::bcom::solar::gprc::StereoType _internal_stereo_type() const;
+  void _internal_set_stereo_type(::com::bcom::solar::gprc::StereoType value);
+  public:
+
+  // float baseline = 4;
+  void clear_baseline();
+  float baseline() const;
+  void set_baseline(float value);
+  private:
+  float _internal_baseline() const;
+  void _internal_set_baseline(float value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:com.bcom.solar.gprc.v2.Rectification)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< float > rotation_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< float > projection_;
+  int stereo_type_;
+  float baseline_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_solar_5fmapping_5fand_5frelocalization_5fproxy_5fv2_2eproto;
+};
+// -------------------------------------------------------------------
+
+class RectificationParameters PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:com.bcom.solar.gprc.v2.RectificationParameters) */ {
+ public:
+  inline RectificationParameters() : RectificationParameters(nullptr) {}
+  virtual ~RectificationParameters();
+  explicit constexpr RectificationParameters(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  RectificationParameters(const RectificationParameters& from);
+  RectificationParameters(RectificationParameters&& from) noexcept
+    : RectificationParameters() {
+    *this = ::std::move(from);
+  }
+
+  inline RectificationParameters& operator=(const RectificationParameters& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline RectificationParameters& operator=(RectificationParameters&& from) noexcept {
+    if (GetArena() == from.GetArena()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return GetMetadataStatic().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return GetMetadataStatic().reflection;
+  }
+  static const RectificationParameters& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const RectificationParameters* internal_default_instance() {
+    return reinterpret_cast<const RectificationParameters*>(
+               &_RectificationParameters_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    4;
+
+  friend void swap(RectificationParameters& a, RectificationParameters& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(RectificationParameters* other) {
+    if (other == this) return;
+    if (GetArena() == other->GetArena()) {
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(RectificationParameters* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline RectificationParameters* New() const final {
+    return CreateMaybeMessage<RectificationParameters>(nullptr);
+  }
+
+  RectificationParameters* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<RectificationParameters>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const RectificationParameters& from);
+  void MergeFrom(const RectificationParameters& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(RectificationParameters* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "com.bcom.solar.gprc.v2.RectificationParameters";
+  }
+  protected:
+  explicit RectificationParameters(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    return ::descriptor_table_solar_5fmapping_5fand_5frelocalization_5fproxy_5fv2_2eproto_metadata_getter(kIndexInFileMessages);
+  }
+
+  public:
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kClientUuidFieldNumber = 1,
+    kCam1FieldNumber = 2,
+    kCam2FieldNumber = 3,
+  };
+  // string client_uuid = 1;
+  void clear_client_uuid();
+  const std::string& client_uuid() const;
+  void set_client_uuid(const std::string& value);
+  void set_client_uuid(std::string&& value);
+  void set_client_uuid(const char* value);
+  void set_client_uuid(const char* value, size_t size);
+  std::string* mutable_client_uuid();
+  std::string* release_client_uuid();
+  void set_allocated_client_uuid(std::string* client_uuid);
+  private:
+  const std::string& _internal_client_uuid() const;
+  void _internal_set_client_uuid(const std::string& value);
+  std::string* _internal_mutable_client_uuid();
+  public:
+
+  // .com.bcom.solar.gprc.v2.Rectification cam1 = 2;
+  bool has_cam1() const;
+  private:
+  bool _internal_has_cam1() const;
+  public:
+  void clear_cam1();
+  const ::com::bcom::solar::gprc::v2::Rectification& cam1() const;
+  ::com::bcom::solar::gprc::v2::Rectification* release_cam1();
+  ::com::bcom::solar::gprc::v2::Rectification* mutable_cam1();
+  void set_allocated_cam1(::com::bcom::solar::gprc::v2::Rectification* cam1);
+  private:
+  const ::com::bcom::solar::gprc::v2::Rectification& _internal_cam1() const;
+  ::com::bcom::solar::gprc::v2::Rectification* _internal_mutable_cam1();
+  public:
+  void unsafe_arena_set_allocated_cam1(
+      ::com::bcom::solar::gprc::v2::Rectification* cam1);
+  ::com::bcom::solar::gprc::v2::Rectification* unsafe_arena_release_cam1();
+
+  // .com.bcom.solar.gprc.v2.Rectification cam2 = 3;
+  bool has_cam2() const;
+  private:
+  bool _internal_has_cam2() const;
+  public:
+  void clear_cam2();
+  const ::com::bcom::solar::gprc::v2::Rectification& cam2() const;
+  ::com::bcom::solar::gprc::v2::Rectification* release_cam2();
+  ::com::bcom::solar::gprc::v2::Rectification* mutable_cam2();
+  void set_allocated_cam2(::com::bcom::solar::gprc::v2::Rectification* cam2);
+  private:
+  const ::com::bcom::solar::gprc::v2::Rectification& _internal_cam2() const;
+  ::com::bcom::solar::gprc::v2::Rectification* _internal_mutable_cam2();
+  public:
+  void unsafe_arena_set_allocated_cam2(
+      ::com::bcom::solar::gprc::v2::Rectification* cam2);
+  ::com::bcom::solar::gprc::v2::Rectification* unsafe_arena_release_cam2();
+
+  // @@protoc_insertion_point(class_scope:com.bcom.solar.gprc.v2.RectificationParameters)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr client_uuid_;
+  ::com::bcom::solar::gprc::v2::Rectification* cam1_;
+  ::com::bcom::solar::gprc::v2::Rectification* cam2_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_solar_5fmapping_5fand_5frelocalization_5fproxy_5fv2_2eproto;
+};
+// -------------------------------------------------------------------
+
+class RelocalizationResult PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:com.bcom.solar.gprc.v2.RelocalizationResult) */ {
+ public:
+  inline RelocalizationResult() : RelocalizationResult(nullptr) {}
+  virtual ~RelocalizationResult();
+  explicit constexpr RelocalizationResult(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  RelocalizationResult(const RelocalizationResult& from);
+  RelocalizationResult(RelocalizationResult&& from) noexcept
+    : RelocalizationResult() {
+    *this = ::std::move(from);
+  }
+
+  inline RelocalizationResult& operator=(const RelocalizationResult& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline RelocalizationResult& operator=(RelocalizationResult&& from) noexcept {
+    if (GetArena() == from.GetArena()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return GetMetadataStatic().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return GetMetadataStatic().reflection;
+  }
+  static const RelocalizationResult& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const RelocalizationResult* internal_default_instance() {
+    return reinterpret_cast<const RelocalizationResult*>(
+               &_RelocalizationResult_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    5;
+
+  friend void swap(RelocalizationResult& a, RelocalizationResult& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(RelocalizationResult* other) {
+    if (other == this) return;
+    if (GetArena() == other->GetArena()) {
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(RelocalizationResult* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline RelocalizationResult* New() const final {
+    return CreateMaybeMessage<RelocalizationResult>(nullptr);
+  }
+
+  RelocalizationResult* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<RelocalizationResult>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const RelocalizationResult& from);
+  void MergeFrom(const RelocalizationResult& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(RelocalizationResult* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "com.bcom.solar.gprc.v2.RelocalizationResult";
+  }
+  protected:
+  explicit RelocalizationResult(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    return ::descriptor_table_solar_5fmapping_5fand_5frelocalization_5fproxy_5fv2_2eproto_metadata_getter(kIndexInFileMessages);
+  }
+
+  public:
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kPoseFieldNumber = 2,
+    kPoseStatusFieldNumber = 1,
+    kConfidenceFieldNumber = 3,
+    kTimestampFieldNumber = 5,
+    kMappingStatusFieldNumber = 4,
+  };
+  // repeated float pose = 2;
+  int pose_size() const;
+  private:
+  int _internal_pose_size() const;
+  public:
+  void clear_pose();
+  private:
+  float _internal_pose(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+      _internal_pose() const;
+  void _internal_add_pose(float value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+      _internal_mutable_pose();
+  public:
+  float pose(int index) const;
+  void set_pose(int index, float value);
+  void add_pose(float value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+      pose() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+      mutable_pose();
+
+  // .com.bcom.solar.gprc.RelocalizationPoseStatus pose_status = 1;
+  void clear_pose_status();
+  ::com::bcom::solar::gprc::RelocalizationPoseStatus pose_status() const;
+  void set_pose_status(::com::bcom::solar::gprc::RelocalizationPoseStatus value);
+  private:
+  ::com::bcom::solar::gprc::RelocalizationPoseStatus _internal_pose_status() const;
+  void _internal_set_pose_status(::com::bcom::solar::gprc::RelocalizationPoseStatus value);
+  public:
+
+  // float confidence = 3;
+  void clear_confidence();
+  float confidence() const;
+  void set_confidence(float value);
+  private:
+  float _internal_confidence() const;
+  void _internal_set_confidence(float value);
+  public:
+
+  // uint64 timestamp = 5;
+  void clear_timestamp();
+  ::PROTOBUF_NAMESPACE_ID::uint64 timestamp() const;
+  void set_timestamp(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::uint64 _internal_timestamp() const;
+  void _internal_set_timestamp(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  public:
+
+  // .com.bcom.solar.gprc.MappingStatus mapping_status = 4;
+  void clear_mapping_status();
+  ::com::bcom::solar::gprc::MappingStatus mapping_status() const;
+  void set_mapping_status(::com::bcom::solar::gprc::MappingStatus value);
+  private:
+  ::com::bcom::solar::gprc::MappingStatus _internal_mapping_status() const;
+  void _internal_set_mapping_status(::com::bcom::solar::gprc::MappingStatus value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:com.bcom.solar.gprc.v2.RelocalizationResult)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< float > pose_;
+  int pose_status_;
+  float confidence_;
+  ::PROTOBUF_NAMESPACE_ID::uint64 timestamp_;
+  int mapping_status_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_solar_5fmapping_5fand_5frelocalization_5fproxy_5fv2_2eproto;
+};
+// -------------------------------------------------------------------
+
+class RelocalizationResults PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:com.bcom.solar.gprc.v2.RelocalizationResults) */ {
+ public:
+  inline RelocalizationResults() : RelocalizationResults(nullptr) {}
+  virtual ~RelocalizationResults();
+  explicit constexpr RelocalizationResults(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  RelocalizationResults(const RelocalizationResults& from);
+  RelocalizationResults(RelocalizationResults&& from) noexcept
+    : RelocalizationResults() {
+    *this = ::std::move(from);
+  }
+
+  inline RelocalizationResults& operator=(const RelocalizationResults& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline RelocalizationResults& operator=(RelocalizationResults&& from) noexcept {
+    if (GetArena() == from.GetArena()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return GetMetadataStatic().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return GetMetadataStatic().reflection;
+  }
+  static const RelocalizationResults& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const RelocalizationResults* internal_default_instance() {
+    return reinterpret_cast<const RelocalizationResults*>(
+               &_RelocalizationResults_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    6;
+
+  friend void swap(RelocalizationResults& a, RelocalizationResults& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(RelocalizationResults* other) {
+    if (other == this) return;
+    if (GetArena() == other->GetArena()) {
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(RelocalizationResults* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline RelocalizationResults* New() const final {
+    return CreateMaybeMessage<RelocalizationResults>(nullptr);
+  }
+
+  RelocalizationResults* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<RelocalizationResults>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const RelocalizationResults& from);
+  void MergeFrom(const RelocalizationResults& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(RelocalizationResults* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "com.bcom.solar.gprc.v2.RelocalizationResults";
+  }
+  protected:
+  explicit RelocalizationResults(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    return ::descriptor_table_solar_5fmapping_5fand_5frelocalization_5fproxy_5fv2_2eproto_metadata_getter(kIndexInFileMessages);
+  }
+
+  public:
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kResultsFieldNumber = 1,
+  };
+  // repeated .com.bcom.solar.gprc.v2.RelocalizationResult results = 1;
+  int results_size() const;
+  private:
+  int _internal_results_size() const;
+  public:
+  void clear_results();
+  ::com::bcom::solar::gprc::v2::RelocalizationResult* mutable_results(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::com::bcom::solar::gprc::v2::RelocalizationResult >*
+      mutable_results();
+  private:
+  const ::com::bcom::solar::gprc::v2::RelocalizationResult& _internal_results(int index) const;
+  ::com::bcom::solar::gprc::v2::RelocalizationResult* _internal_add_results();
+  public:
+  const ::com::bcom::solar::gprc::v2::RelocalizationResult& results(int index) const;
+  ::com::bcom::solar::gprc::v2::RelocalizationResult* add_results();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::com::bcom::solar::gprc::v2::RelocalizationResult >&
+      results() const;
+
+  // @@protoc_insertion_point(class_scope:com.bcom.solar.gprc.v2.RelocalizationResults)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::com::bcom::solar::gprc::v2::RelocalizationResult > results_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_solar_5fmapping_5fand_5frelocalization_5fproxy_5fv2_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Frames PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:com.bcom.solar.gprc.v2.Frames) */ {
+ public:
+  inline Frames() : Frames(nullptr) {}
+  virtual ~Frames();
+  explicit constexpr Frames(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Frames(const Frames& from);
+  Frames(Frames&& from) noexcept
+    : Frames() {
+    *this = ::std::move(from);
+  }
+
+  inline Frames& operator=(const Frames& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Frames& operator=(Frames&& from) noexcept {
+    if (GetArena() == from.GetArena()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return GetMetadataStatic().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return GetMetadataStatic().reflection;
+  }
+  static const Frames& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Frames* internal_default_instance() {
+    return reinterpret_cast<const Frames*>(
+               &_Frames_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    7;
+
+  friend void swap(Frames& a, Frames& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Frames* other) {
+    if (other == this) return;
+    if (GetArena() == other->GetArena()) {
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Frames* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline Frames* New() const final {
+    return CreateMaybeMessage<Frames>(nullptr);
+  }
+
+  Frames* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<Frames>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const Frames& from);
+  void MergeFrom(const Frames& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Frames* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "com.bcom.solar.gprc.v2.Frames";
+  }
+  protected:
+  explicit Frames(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    return ::descriptor_table_solar_5fmapping_5fand_5frelocalization_5fproxy_5fv2_2eproto_metadata_getter(kIndexInFileMessages);
+  }
+
+  public:
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kFramesFieldNumber = 2,
+    kClientUuidFieldNumber = 1,
+  };
+  // repeated .com.bcom.solar.gprc.v2.Frame frames = 2;
+  int frames_size() const;
+  private:
+  int _internal_frames_size() const;
+  public:
+  void clear_frames();
+  ::com::bcom::solar::gprc::v2::Frame* mutable_frames(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::com::bcom::solar::gprc::v2::Frame >*
+      mutable_frames();
+  private:
+  const ::com::bcom::solar::gprc::v2::Frame& _internal_frames(int index) const;
+  ::com::bcom::solar::gprc::v2::Frame* _internal_add_frames();
+  public:
+  const ::com::bcom::solar::gprc::v2::Frame& frames(int index) const;
+  ::com::bcom::solar::gprc::v2::Frame* add_frames();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::com::bcom::solar::gprc::v2::Frame >&
+      frames() const;
+
+  // string client_uuid = 1;
+  void clear_client_uuid();
+  const std::string& client_uuid() const;
+  void set_client_uuid(const std::string& value);
+  void set_client_uuid(std::string&& value);
+  void set_client_uuid(const char* value);
+  void set_client_uuid(const char* value, size_t size);
+  std::string* mutable_client_uuid();
+  std::string* release_client_uuid();
+  void set_allocated_client_uuid(std::string* client_uuid);
+  private:
+  const std::string& _internal_client_uuid() const;
+  void _internal_set_client_uuid(const std::string& value);
+  std::string* _internal_mutable_client_uuid();
+  public:
+
+  // @@protoc_insertion_point(class_scope:com.bcom.solar.gprc.v2.Frames)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::com::bcom::solar::gprc::v2::Frame > frames_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr client_uuid_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_solar_5fmapping_5fand_5frelocalization_5fproxy_5fv2_2eproto;
+};
+// -------------------------------------------------------------------
+
+class FramesBatch PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:com.bcom.solar.gprc.v2.FramesBatch) */ {
+ public:
+  inline FramesBatch() : FramesBatch(nullptr) {}
+  virtual ~FramesBatch();
+  explicit constexpr FramesBatch(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  FramesBatch(const FramesBatch& from);
+  FramesBatch(FramesBatch&& from) noexcept
+    : FramesBatch() {
+    *this = ::std::move(from);
+  }
+
+  inline FramesBatch& operator=(const FramesBatch& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline FramesBatch& operator=(FramesBatch&& from) noexcept {
+    if (GetArena() == from.GetArena()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return GetMetadataStatic().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return GetMetadataStatic().reflection;
+  }
+  static const FramesBatch& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const FramesBatch* internal_default_instance() {
+    return reinterpret_cast<const FramesBatch*>(
+               &_FramesBatch_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    8;
+
+  friend void swap(FramesBatch& a, FramesBatch& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(FramesBatch* other) {
+    if (other == this) return;
+    if (GetArena() == other->GetArena()) {
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(FramesBatch* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline FramesBatch* New() const final {
+    return CreateMaybeMessage<FramesBatch>(nullptr);
+  }
+
+  FramesBatch* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<FramesBatch>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const FramesBatch& from);
+  void MergeFrom(const FramesBatch& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(FramesBatch* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "com.bcom.solar.gprc.v2.FramesBatch";
+  }
+  protected:
+  explicit FramesBatch(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    return ::descriptor_table_solar_5fmapping_5fand_5frelocalization_5fproxy_5fv2_2eproto_metadata_getter(kIndexInFileMessages);
+  }
+
+  public:
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kFramesFieldNumber = 2,
+    kClientUuidFieldNumber = 1,
+    kLastResultOnlyFieldNumber = 3,
+  };
+  // repeated .com.bcom.solar.gprc.v2.Frames frames = 2;
+  int frames_size() const;
+  private:
+  int _internal_frames_size() const;
+  public:
+  void clear_frames();
+  ::com::bcom::solar::gprc::v2::Frames* mutable_frames(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::com::bcom::solar::gprc::v2::Frames >*
+      mutable_frames();
+  private:
+  const ::com::bcom::solar::gprc::v2::Frames& _internal_frames(int index) const;
+  ::com::bcom::solar::gprc::v2::Frames* _internal_add_frames();
+  public:
+  const ::com::bcom::solar::gprc::v2::Frames& frames(int index) const;
+  ::com::bcom::solar::gprc::v2::Frames* add_frames();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::com::bcom::solar::gprc::v2::Frames >&
+      frames() const;
+
+  // string client_uuid = 1;
+  void clear_client_uuid();
+  const std::string& client_uuid() const;
+  void set_client_uuid(const std::string& value);
+  void set_client_uuid(std::string&& value);
+  void set_client_uuid(const char* value);
+  void set_client_uuid(const char* value, size_t size);
+  std::string* mutable_client_uuid();
+  std::string* release_client_uuid();
+  void set_allocated_client_uuid(std::string* client_uuid);
+  private:
+  const std::string& _internal_client_uuid() const;
+  void _internal_set_client_uuid(const std::string& value);
+  std::string* _internal_mutable_client_uuid();
+  public:
+
+  // bool last_result_only = 3;
+  void clear_last_result_only();
+  bool last_result_only() const;
+  void set_last_result_only(bool value);
+  private:
+  bool _internal_last_result_only() const;
+  void _internal_set_last_result_only(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:com.bcom.solar.gprc.v2.FramesBatch)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::com::bcom::solar::gprc::v2::Frames > frames_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr client_uuid_;
+  bool last_result_only_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_solar_5fmapping_5fand_5frelocalization_5fproxy_5fv2_2eproto;
+};
+// -------------------------------------------------------------------
+
+class GroundTruthFrames PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:com.bcom.solar.gprc.v2.GroundTruthFrames) */ {
+ public:
+  inline GroundTruthFrames() : GroundTruthFrames(nullptr) {}
+  virtual ~GroundTruthFrames();
+  explicit constexpr GroundTruthFrames(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  GroundTruthFrames(const GroundTruthFrames& from);
+  GroundTruthFrames(GroundTruthFrames&& from) noexcept
+    : GroundTruthFrames() {
+    *this = ::std::move(from);
+  }
+
+  inline GroundTruthFrames& operator=(const GroundTruthFrames& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline GroundTruthFrames& operator=(GroundTruthFrames&& from) noexcept {
+    if (GetArena() == from.GetArena()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return GetMetadataStatic().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return GetMetadataStatic().reflection;
+  }
+  static const GroundTruthFrames& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const GroundTruthFrames* internal_default_instance() {
+    return reinterpret_cast<const GroundTruthFrames*>(
+               &_GroundTruthFrames_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    9;
+
+  friend void swap(GroundTruthFrames& a, GroundTruthFrames& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(GroundTruthFrames* other) {
+    if (other == this) return;
+    if (GetArena() == other->GetArena()) {
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(GroundTruthFrames* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline GroundTruthFrames* New() const final {
+    return CreateMaybeMessage<GroundTruthFrames>(nullptr);
+  }
+
+  GroundTruthFrames* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<GroundTruthFrames>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const GroundTruthFrames& from);
+  void MergeFrom(const GroundTruthFrames& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(GroundTruthFrames* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "com.bcom.solar.gprc.v2.GroundTruthFrames";
+  }
+  protected:
+  explicit GroundTruthFrames(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    return ::descriptor_table_solar_5fmapping_5fand_5frelocalization_5fproxy_5fv2_2eproto_metadata_getter(kIndexInFileMessages);
+  }
+
+  public:
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kWorldTransformFieldNumber = 3,
+    kClientUuidFieldNumber = 1,
+    kFramesFieldNumber = 2,
+    kFixedPoseFieldNumber = 4,
+  };
+  // repeated float world_transform = 3;
+  int world_transform_size() const;
+  private:
+  int _internal_world_transform_size() const;
+  public:
+  void clear_world_transform();
+  private:
+  float _internal_world_transform(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+      _internal_world_transform() const;
+  void _internal_add_world_transform(float value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+      _internal_mutable_world_transform();
+  public:
+  float world_transform(int index) const;
+  void set_world_transform(int index, float value);
+  void add_world_transform(float value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+      world_transform() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+      mutable_world_transform();
+
+  // string client_uuid = 1;
+  void clear_client_uuid();
+  const std::string& client_uuid() const;
+  void set_client_uuid(const std::string& value);
+  void set_client_uuid(std::string&& value);
+  void set_client_uuid(const char* value);
+  void set_client_uuid(const char* value, size_t size);
+  std::string* mutable_client_uuid();
+  std::string* release_client_uuid();
+  void set_allocated_client_uuid(std::string* client_uuid);
+  private:
+  const std::string& _internal_client_uuid() const;
+  void _internal_set_client_uuid(const std::string& value);
+  std::string* _internal_mutable_client_uuid();
+  public:
+
+  // .com.bcom.solar.gprc.v2.Frames frames = 2;
+  bool has_frames() const;
+  private:
+  bool _internal_has_frames() const;
+  public:
+  void clear_frames();
+  const ::com::bcom::solar::gprc::v2::Frames& frames() const;
+  ::com::bcom::solar::gprc::v2::Frames* release_frames();
+  ::com::bcom::solar::gprc::v2::Frames* mutable_frames();
+  void set_allocated_frames(::com::bcom::solar::gprc::v2::Frames* frames);
+  private:
+  const ::com::bcom::solar::gprc::v2::Frames& _internal_frames() const;
+  ::com::bcom::solar::gprc::v2::Frames* _internal_mutable_frames();
+  public:
+  void unsafe_arena_set_allocated_frames(
+      ::com::bcom::solar::gprc::v2::Frames* frames);
+  ::com::bcom::solar::gprc::v2::Frames* unsafe_arena_release_frames();
+
+  // bool fixed_pose = 4;
+  void clear_fixed_pose();
+  bool fixed_pose() const;
+  void set_fixed_pose(bool value);
+  private:
+  bool _internal_fixed_pose() const;
+  void _internal_set_fixed_pose(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:com.bcom.solar.gprc.v2.GroundTruthFrames)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< float > world_transform_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr client_uuid_;
+  ::com::bcom::solar::gprc::v2::Frames* frames_;
+  bool fixed_pose_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_solar_5fmapping_5fand_5frelocalization_5fproxy_5fv2_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Frame PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:com.bcom.solar.gprc.v2.Frame) */ {
+ public:
+  inline Frame() : Frame(nullptr) {}
+  virtual ~Frame();
+  explicit constexpr Frame(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Frame(const Frame& from);
+  Frame(Frame&& from) noexcept
+    : Frame() {
+    *this = ::std::move(from);
+  }
+
+  inline Frame& operator=(const Frame& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Frame& operator=(Frame&& from) noexcept {
+    if (GetArena() == from.GetArena()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return GetMetadataStatic().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return GetMetadataStatic().reflection;
+  }
+  static const Frame& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Frame* internal_default_instance() {
+    return reinterpret_cast<const Frame*>(
+               &_Frame_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    10;
+
+  friend void swap(Frame& a, Frame& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Frame* other) {
+    if (other == this) return;
+    if (GetArena() == other->GetArena()) {
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Frame* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline Frame* New() const final {
+    return CreateMaybeMessage<Frame>(nullptr);
+  }
+
+  Frame* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<Frame>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const Frame& from);
+  void MergeFrom(const Frame& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Frame* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "com.bcom.solar.gprc.v2.Frame";
+  }
+  protected:
+  explicit Frame(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    return ::descriptor_table_solar_5fmapping_5fand_5frelocalization_5fproxy_5fv2_2eproto_metadata_getter(kIndexInFileMessages);
+  }
+
+  public:
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kPoseFieldNumber = 4,
+    kImageFieldNumber = 2,
+    kTimestampFieldNumber = 3,
+    kSensorIdFieldNumber = 1,
+  };
+  // repeated float pose = 4;
+  int pose_size() const;
+  private:
+  int _internal_pose_size() const;
+  public:
+  void clear_pose();
+  private:
+  float _internal_pose(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+      _internal_pose() const;
+  void _internal_add_pose(float value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+      _internal_mutable_pose();
+  public:
+  float pose(int index) const;
+  void set_pose(int index, float value);
+  void add_pose(float value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+      pose() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+      mutable_pose();
+
+  // .com.bcom.solar.gprc.Image image = 2;
+  bool has_image() const;
+  private:
+  bool _internal_has_image() const;
+  public:
+  void clear_image();
+  const ::com::bcom::solar::gprc::Image& image() const;
+  ::com::bcom::solar::gprc::Image* release_image();
+  ::com::bcom::solar::gprc::Image* mutable_image();
+  void set_allocated_image(::com::bcom::solar::gprc::Image* image);
+  private:
+  const ::com::bcom::solar::gprc::Image& _internal_image() const;
+  ::com::bcom::solar::gprc::Image* _internal_mutable_image();
+  public:
+  void unsafe_arena_set_allocated_image(
+      ::com::bcom::solar::gprc::Image* image);
+  ::com::bcom::solar::gprc::Image* unsafe_arena_release_image();
+
+  // uint64 timestamp = 3;
+  void clear_timestamp();
+  ::PROTOBUF_NAMESPACE_ID::uint64 timestamp() const;
+  void set_timestamp(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::uint64 _internal_timestamp() const;
+  void _internal_set_timestamp(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  public:
+
+  // int32 sensor_id = 1;
+  void clear_sensor_id();
+  ::PROTOBUF_NAMESPACE_ID::int32 sensor_id() const;
+  void set_sensor_id(::PROTOBUF_NAMESPACE_ID::int32 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::int32 _internal_sensor_id() const;
+  void _internal_set_sensor_id(::PROTOBUF_NAMESPACE_ID::int32 value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:com.bcom.solar.gprc.v2.Frame)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< float > pose_;
+  ::com::bcom::solar::gprc::Image* image_;
+  ::PROTOBUF_NAMESPACE_ID::uint64 timestamp_;
+  ::PROTOBUF_NAMESPACE_ID::int32 sensor_id_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_solar_5fmapping_5fand_5frelocalization_5fproxy_5fv2_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// Camera
+
+// string name = 1;
+inline void Camera::clear_name() {
+  name_.ClearToEmpty();
+}
+inline const std::string& Camera::name() const {
+  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.v2.Camera.name)
+  return _internal_name();
+}
+inline void Camera::set_name(const std::string& value) {
+  _internal_set_name(value);
+  // @@protoc_insertion_point(field_set:com.bcom.solar.gprc.v2.Camera.name)
+}
+inline std::string* Camera::mutable_name() {
+  // @@protoc_insertion_point(field_mutable:com.bcom.solar.gprc.v2.Camera.name)
+  return _internal_mutable_name();
+}
+inline const std::string& Camera::_internal_name() const {
+  return name_.Get();
+}
+inline void Camera::_internal_set_name(const std::string& value) {
+  
+  name_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArena());
+}
+inline void Camera::set_name(std::string&& value) {
+  
+  name_.Set(
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::move(value), GetArena());
+  // @@protoc_insertion_point(field_set_rvalue:com.bcom.solar.gprc.v2.Camera.name)
+}
+inline void Camera::set_name(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  
+  name_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(value), GetArena());
+  // @@protoc_insertion_point(field_set_char:com.bcom.solar.gprc.v2.Camera.name)
+}
+inline void Camera::set_name(const char* value,
+    size_t size) {
+  
+  name_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArena());
+  // @@protoc_insertion_point(field_set_pointer:com.bcom.solar.gprc.v2.Camera.name)
+}
+inline std::string* Camera::_internal_mutable_name() {
+  
+  return name_.Mutable(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArena());
+}
+inline std::string* Camera::release_name() {
+  // @@protoc_insertion_point(field_release:com.bcom.solar.gprc.v2.Camera.name)
+  return name_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline void Camera::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    
+  } else {
+    
+  }
+  name_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), name,
+      GetArena());
+  // @@protoc_insertion_point(field_set_allocated:com.bcom.solar.gprc.v2.Camera.name)
+}
+
+// uint32 id = 2;
+inline void Camera::clear_id() {
+  id_ = 0u;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint32 Camera::_internal_id() const {
+  return id_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint32 Camera::id() const {
+  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.v2.Camera.id)
+  return _internal_id();
+}
+inline void Camera::_internal_set_id(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  
+  id_ = value;
+}
+inline void Camera::set_id(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  _internal_set_id(value);
+  // @@protoc_insertion_point(field_set:com.bcom.solar.gprc.v2.Camera.id)
+}
+
+// .com.bcom.solar.gprc.CameraType camera_type = 3;
+inline void Camera::clear_camera_type() {
+  camera_type_ = 0;
+}
+inline ::com::bcom::solar::gprc::CameraType Camera::_internal_camera_type() const {
+  return static_cast< ::com::bcom::solar::gprc::CameraType >(camera_type_);
+}
+inline ::com::bcom::solar::gprc::CameraType Camera::camera_type() const {
+  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.v2.Camera.camera_type)
+  return _internal_camera_type();
+}
+inline void Camera::_internal_set_camera_type(::com::bcom::solar::gprc::CameraType value) {
+  
+  camera_type_ = value;
+}
+inline void Camera::set_camera_type(::com::bcom::solar::gprc::CameraType value) {
+  _internal_set_camera_type(value);
+  // @@protoc_insertion_point(field_set:com.bcom.solar.gprc.v2.Camera.camera_type)
+}
+
+// uint32 width = 4;
+inline void Camera::clear_width() {
+  width_ = 0u;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint32 Camera::_internal_width() const {
+  return width_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint32 Camera::width() const {
+  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.v2.Camera.width)
+  return _internal_width();
+}
+inline void Camera::_internal_set_width(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  
+  width_ = value;
+}
+inline void Camera::set_width(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  _internal_set_width(value);
+  // @@protoc_insertion_point(field_set:com.bcom.solar.gprc.v2.Camera.width)
+}
+
+// uint32 height = 5;
+inline void Camera::clear_height() {
+  height_ = 0u;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint32 Camera::_internal_height() const {
+  return height_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint32 Camera::height() const {
+  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.v2.Camera.height)
+  return _internal_height();
+}
+inline void Camera::_internal_set_height(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  
+  height_ = value;
+}
+inline void Camera::set_height(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  _internal_set_height(value);
+  // @@protoc_insertion_point(field_set:com.bcom.solar.gprc.v2.Camera.height)
+}
+
+// repeated float intrinsics = 6;
+inline int Camera::_internal_intrinsics_size() const {
+  return intrinsics_.size();
+}
+inline int Camera::intrinsics_size() const {
+  return _internal_intrinsics_size();
+}
+inline void Camera::clear_intrinsics() {
+  intrinsics_.Clear();
+}
+inline float Camera::_internal_intrinsics(int index) const {
+  return intrinsics_.Get(index);
+}
+inline float Camera::intrinsics(int index) const {
+  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.v2.Camera.intrinsics)
+  return _internal_intrinsics(index);
+}
+inline void Camera::set_intrinsics(int index, float value) {
+  intrinsics_.Set(index, value);
+  // @@protoc_insertion_point(field_set:com.bcom.solar.gprc.v2.Camera.intrinsics)
+}
+inline void Camera::_internal_add_intrinsics(float value) {
+  intrinsics_.Add(value);
+}
+inline void Camera::add_intrinsics(float value) {
+  _internal_add_intrinsics(value);
+  // @@protoc_insertion_point(field_add:com.bcom.solar.gprc.v2.Camera.intrinsics)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+Camera::_internal_intrinsics() const {
+  return intrinsics_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+Camera::intrinsics() const {
+  // @@protoc_insertion_point(field_list:com.bcom.solar.gprc.v2.Camera.intrinsics)
+  return _internal_intrinsics();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+Camera::_internal_mutable_intrinsics() {
+  return &intrinsics_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+Camera::mutable_intrinsics() {
+  // @@protoc_insertion_point(field_mutable_list:com.bcom.solar.gprc.v2.Camera.intrinsics)
+  return _internal_mutable_intrinsics();
+}
+
+// repeated float distortion = 7;
+inline int Camera::_internal_distortion_size() const {
+  return distortion_.size();
+}
+inline int Camera::distortion_size() const {
+  return _internal_distortion_size();
+}
+inline void Camera::clear_distortion() {
+  distortion_.Clear();
+}
+inline float Camera::_internal_distortion(int index) const {
+  return distortion_.Get(index);
+}
+inline float Camera::distortion(int index) const {
+  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.v2.Camera.distortion)
+  return _internal_distortion(index);
+}
+inline void Camera::set_distortion(int index, float value) {
+  distortion_.Set(index, value);
+  // @@protoc_insertion_point(field_set:com.bcom.solar.gprc.v2.Camera.distortion)
+}
+inline void Camera::_internal_add_distortion(float value) {
+  distortion_.Add(value);
+}
+inline void Camera::add_distortion(float value) {
+  _internal_add_distortion(value);
+  // @@protoc_insertion_point(field_add:com.bcom.solar.gprc.v2.Camera.distortion)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+Camera::_internal_distortion() const {
+  return distortion_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+Camera::distortion() const {
+  // @@protoc_insertion_point(field_list:com.bcom.solar.gprc.v2.Camera.distortion)
+  return _internal_distortion();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+Camera::_internal_mutable_distortion() {
+  return &distortion_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+Camera::mutable_distortion() {
+  // @@protoc_insertion_point(field_mutable_list:com.bcom.solar.gprc.v2.Camera.distortion)
+  return _internal_mutable_distortion();
+}
+
+// .com.bcom.solar.gprc.ImageRotation rotation = 8;
+inline void Camera::clear_rotation() {
+  rotation_ = 0;
+}
+inline ::com::bcom::solar::gprc::ImageRotation Camera::_internal_rotation() const {
+  return static_cast< ::com::bcom::solar::gprc::ImageRotation >(rotation_);
+}
+inline ::com::bcom::solar::gprc::ImageRotation Camera::rotation() const {
+  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.v2.Camera.rotation)
+  return _internal_rotation();
+}
+inline void Camera::_internal_set_rotation(::com::bcom::solar::gprc::ImageRotation value) {
+  
+  rotation_ = value;
+}
+inline void Camera::set_rotation(::com::bcom::solar::gprc::ImageRotation value) {
+  _internal_set_rotation(value);
+  // @@protoc_insertion_point(field_set:com.bcom.solar.gprc.v2.Camera.rotation)
+}
+
+// -------------------------------------------------------------------
+
+// CameraParameters
+
+// string client_uuid = 1;
+inline void CameraParameters::clear_client_uuid() {
+  client_uuid_.ClearToEmpty();
+}
+inline const std::string& CameraParameters::client_uuid() const {
+  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.v2.CameraParameters.client_uuid)
+  return _internal_client_uuid();
+}
+inline void CameraParameters::set_client_uuid(const std::string& value) {
+  _internal_set_client_uuid(value);
+  // @@protoc_insertion_point(field_set:com.bcom.solar.gprc.v2.CameraParameters.client_uuid)
+}
+inline std::string* CameraParameters::mutable_client_uuid() {
+  // @@protoc_insertion_point(field_mutable:com.bcom.solar.gprc.v2.CameraParameters.client_uuid)
+  return _internal_mutable_client_uuid();
+}
+inline const std::string& CameraParameters::_internal_client_uuid() const {
+  return client_uuid_.Get();
+}
+inline void CameraParameters::_internal_set_client_uuid(const std::string& value) {
+  
+  client_uuid_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArena());
+}
+inline void CameraParameters::set_client_uuid(std::string&& value) {
+  
+  client_uuid_.Set(
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::move(value), GetArena());
+  // @@protoc_insertion_point(field_set_rvalue:com.bcom.solar.gprc.v2.CameraParameters.client_uuid)
+}
+inline void CameraParameters::set_client_uuid(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  
+  client_uuid_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(value), GetArena());
+  // @@protoc_insertion_point(field_set_char:com.bcom.solar.gprc.v2.CameraParameters.client_uuid)
+}
+inline void CameraParameters::set_client_uuid(const char* value,
+    size_t size) {
+  
+  client_uuid_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArena());
+  // @@protoc_insertion_point(field_set_pointer:com.bcom.solar.gprc.v2.CameraParameters.client_uuid)
+}
+inline std::string* CameraParameters::_internal_mutable_client_uuid() {
+  
+  return client_uuid_.Mutable(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArena());
+}
+inline std::string* CameraParameters::release_client_uuid() {
+  // @@protoc_insertion_point(field_release:com.bcom.solar.gprc.v2.CameraParameters.client_uuid)
+  return client_uuid_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline void CameraParameters::set_allocated_client_uuid(std::string* client_uuid) {
+  if (client_uuid != nullptr) {
+    
+  } else {
+    
+  }
+  client_uuid_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), client_uuid,
+      GetArena());
+  // @@protoc_insertion_point(field_set_allocated:com.bcom.solar.gprc.v2.CameraParameters.client_uuid)
+}
+
+// .com.bcom.solar.gprc.v2.Camera camera = 2;
+inline bool CameraParameters::_internal_has_camera() const {
+  return this != internal_default_instance() && camera_ != nullptr;
+}
+inline bool CameraParameters::has_camera() const {
+  return _internal_has_camera();
+}
+inline void CameraParameters::clear_camera() {
+  if (GetArena() == nullptr && camera_ != nullptr) {
+    delete camera_;
+  }
+  camera_ = nullptr;
+}
+inline const ::com::bcom::solar::gprc::v2::Camera& CameraParameters::_internal_camera() const {
+  const ::com::bcom::solar::gprc::v2::Camera* p = camera_;
+  return p != nullptr ? *p : reinterpret_cast<const ::com::bcom::solar::gprc::v2::Camera&>(
+      ::com::bcom::solar::gprc::v2::_Camera_default_instance_);
+}
+inline const ::com::bcom::solar::gprc::v2::Camera& CameraParameters::camera() const {
+  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.v2.CameraParameters.camera)
+  return _internal_camera();
+}
+inline void CameraParameters::unsafe_arena_set_allocated_camera(
+    ::com::bcom::solar::gprc::v2::Camera* camera) {
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(camera_);
+  }
+  camera_ = camera;
+  if (camera) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:com.bcom.solar.gprc.v2.CameraParameters.camera)
+}
+inline ::com::bcom::solar::gprc::v2::Camera* CameraParameters::release_camera() {
+  
+  ::com::bcom::solar::gprc::v2::Camera* temp = camera_;
+  camera_ = nullptr;
+  if (GetArena() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+  return temp;
+}
+inline ::com::bcom::solar::gprc::v2::Camera* CameraParameters::unsafe_arena_release_camera() {
+  // @@protoc_insertion_point(field_release:com.bcom.solar.gprc.v2.CameraParameters.camera)
+  
+  ::com::bcom::solar::gprc::v2::Camera* temp = camera_;
+  camera_ = nullptr;
+  return temp;
+}
+inline ::com::bcom::solar::gprc::v2::Camera* CameraParameters::_internal_mutable_camera() {
+  
+  if (camera_ == nullptr) {
+    auto* p = CreateMaybeMessage<::com::bcom::solar::gprc::v2::Camera>(GetArena());
+    camera_ = p;
+  }
+  return camera_;
+}
+inline ::com::bcom::solar::gprc::v2::Camera* CameraParameters::mutable_camera() {
+  // @@protoc_insertion_point(field_mutable:com.bcom.solar.gprc.v2.CameraParameters.camera)
+  return _internal_mutable_camera();
+}
+inline void CameraParameters::set_allocated_camera(::com::bcom::solar::gprc::v2::Camera* camera) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  if (message_arena == nullptr) {
+    delete camera_;
+  }
+  if (camera) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(camera);
+    if (message_arena != submessage_arena) {
+      camera = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, camera, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  camera_ = camera;
+  // @@protoc_insertion_point(field_set_allocated:com.bcom.solar.gprc.v2.CameraParameters.camera)
+}
+
+// -------------------------------------------------------------------
+
+// CameraParametersStereo
+
+// string client_uuid = 1;
+inline void CameraParametersStereo::clear_client_uuid() {
+  client_uuid_.ClearToEmpty();
+}
+inline const std::string& CameraParametersStereo::client_uuid() const {
+  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.v2.CameraParametersStereo.client_uuid)
+  return _internal_client_uuid();
+}
+inline void CameraParametersStereo::set_client_uuid(const std::string& value) {
+  _internal_set_client_uuid(value);
+  // @@protoc_insertion_point(field_set:com.bcom.solar.gprc.v2.CameraParametersStereo.client_uuid)
+}
+inline std::string* CameraParametersStereo::mutable_client_uuid() {
+  // @@protoc_insertion_point(field_mutable:com.bcom.solar.gprc.v2.CameraParametersStereo.client_uuid)
+  return _internal_mutable_client_uuid();
+}
+inline const std::string& CameraParametersStereo::_internal_client_uuid() const {
+  return client_uuid_.Get();
+}
+inline void CameraParametersStereo::_internal_set_client_uuid(const std::string& value) {
+  
+  client_uuid_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArena());
+}
+inline void CameraParametersStereo::set_client_uuid(std::string&& value) {
+  
+  client_uuid_.Set(
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::move(value), GetArena());
+  // @@protoc_insertion_point(field_set_rvalue:com.bcom.solar.gprc.v2.CameraParametersStereo.client_uuid)
+}
+inline void CameraParametersStereo::set_client_uuid(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  
+  client_uuid_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(value), GetArena());
+  // @@protoc_insertion_point(field_set_char:com.bcom.solar.gprc.v2.CameraParametersStereo.client_uuid)
+}
+inline void CameraParametersStereo::set_client_uuid(const char* value,
+    size_t size) {
+  
+  client_uuid_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArena());
+  // @@protoc_insertion_point(field_set_pointer:com.bcom.solar.gprc.v2.CameraParametersStereo.client_uuid)
+}
+inline std::string* CameraParametersStereo::_internal_mutable_client_uuid() {
+  
+  return client_uuid_.Mutable(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArena());
+}
+inline std::string* CameraParametersStereo::release_client_uuid() {
+  // @@protoc_insertion_point(field_release:com.bcom.solar.gprc.v2.CameraParametersStereo.client_uuid)
+  return client_uuid_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline void CameraParametersStereo::set_allocated_client_uuid(std::string* client_uuid) {
+  if (client_uuid != nullptr) {
+    
+  } else {
+    
+  }
+  client_uuid_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), client_uuid,
+      GetArena());
+  // @@protoc_insertion_point(field_set_allocated:com.bcom.solar.gprc.v2.CameraParametersStereo.client_uuid)
+}
+
+// .com.bcom.solar.gprc.v2.Camera camera1 = 2;
+inline bool CameraParametersStereo::_internal_has_camera1() const {
+  return this != internal_default_instance() && camera1_ != nullptr;
+}
+inline bool CameraParametersStereo::has_camera1() const {
+  return _internal_has_camera1();
+}
+inline void CameraParametersStereo::clear_camera1() {
+  if (GetArena() == nullptr && camera1_ != nullptr) {
+    delete camera1_;
+  }
+  camera1_ = nullptr;
+}
+inline const ::com::bcom::solar::gprc::v2::Camera& CameraParametersStereo::_internal_camera1() const {
+  const ::com::bcom::solar::gprc::v2::Camera* p = camera1_;
+  return p != nullptr ? *p : reinterpret_cast<const ::com::bcom::solar::gprc::v2::Camera&>(
+      ::com::bcom::solar::gprc::v2::_Camera_default_instance_);
+}
+inline const ::com::bcom::solar::gprc::v2::Camera& CameraParametersStereo::camera1() const {
+  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.v2.CameraParametersStereo.camera1)
+  return _internal_camera1();
+}
+inline void CameraParametersStereo::unsafe_arena_set_allocated_camera1(
+    ::com::bcom::solar::gprc::v2::Camera* camera1) {
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(camera1_);
+  }
+  camera1_ = camera1;
+  if (camera1) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:com.bcom.solar.gprc.v2.CameraParametersStereo.camera1)
+}
+inline ::com::bcom::solar::gprc::v2::Camera* CameraParametersStereo::release_camera1() {
+  
+  ::com::bcom::solar::gprc::v2::Camera* temp = camera1_;
+  camera1_ = nullptr;
+  if (GetArena() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+  return temp;
+}
+inline ::com::bcom::solar::gprc::v2::Camera* CameraParametersStereo::unsafe_arena_release_camera1() {
+  // @@protoc_insertion_point(field_release:com.bcom.solar.gprc.v2.CameraParametersStereo.camera1)
+  
+  ::com::bcom::solar::gprc::v2::Camera* temp = camera1_;
+  camera1_ = nullptr;
+  return temp;
+}
+inline ::com::bcom::solar::gprc::v2::Camera* CameraParametersStereo::_internal_mutable_camera1() {
+  
+  if (camera1_ == nullptr) {
+    auto* p = CreateMaybeMessage<::com::bcom::solar::gprc::v2::Camera>(GetArena());
+    camera1_ = p;
+  }
+  return camera1_;
+}
+inline ::com::bcom::solar::gprc::v2::Camera* CameraParametersStereo::mutable_camera1() {
+  // @@protoc_insertion_point(field_mutable:com.bcom.solar.gprc.v2.CameraParametersStereo.camera1)
+  return _internal_mutable_camera1();
+}
+inline void CameraParametersStereo::set_allocated_camera1(::com::bcom::solar::gprc::v2::Camera* camera1) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  if (message_arena == nullptr) {
+    delete camera1_;
+  }
+  if (camera1) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(camera1);
+    if (message_arena != submessage_arena) {
+      camera1 = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, camera1, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  camera1_ = camera1;
+  // @@protoc_insertion_point(field_set_allocated:com.bcom.solar.gprc.v2.CameraParametersStereo.camera1)
+}
+
+// .com.bcom.solar.gprc.v2.Camera camera2 = 3;
+inline bool CameraParametersStereo::_internal_has_camera2() const {
+  return this != internal_default_instance() && camera2_ != nullptr;
+}
+inline bool CameraParametersStereo::has_camera2() const {
+  return _internal_has_camera2();
+}
+inline void CameraParametersStereo::clear_camera2() {
+  if (GetArena() == nullptr && camera2_ != nullptr) {
+    delete camera2_;
+  }
+  camera2_ = nullptr;
+}
+inline const ::com::bcom::solar::gprc::v2::Camera& CameraParametersStereo::_internal_camera2() const {
+  const ::com::bcom::solar::gprc::v2::Camera* p = camera2_;
+  return p != nullptr ? *p : reinterpret_cast<const ::com::bcom::solar::gprc::v2::Camera&>(
+      ::com::bcom::solar::gprc::v2::_Camera_default_instance_);
+}
+inline const ::com::bcom::solar::gprc::v2::Camera& CameraParametersStereo::camera2() const {
+  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.v2.CameraParametersStereo.camera2)
+  return _internal_camera2();
+}
+inline void CameraParametersStereo::unsafe_arena_set_allocated_camera2(
+    ::com::bcom::solar::gprc::v2::Camera* camera2) {
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(camera2_);
+  }
+  camera2_ = camera2;
+  if (camera2) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:com.bcom.solar.gprc.v2.CameraParametersStereo.camera2)
+}
+inline ::com::bcom::solar::gprc::v2::Camera* CameraParametersStereo::release_camera2() {
+  
+  ::com::bcom::solar::gprc::v2::Camera* temp = camera2_;
+  camera2_ = nullptr;
+  if (GetArena() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+  return temp;
+}
+inline ::com::bcom::solar::gprc::v2::Camera* CameraParametersStereo::unsafe_arena_release_camera2() {
+  // @@protoc_insertion_point(field_release:com.bcom.solar.gprc.v2.CameraParametersStereo.camera2)
+  
+  ::com::bcom::solar::gprc::v2::Camera* temp = camera2_;
+  camera2_ = nullptr;
+  return temp;
+}
+inline ::com::bcom::solar::gprc::v2::Camera* CameraParametersStereo::_internal_mutable_camera2() {
+  
+  if (camera2_ == nullptr) {
+    auto* p = CreateMaybeMessage<::com::bcom::solar::gprc::v2::Camera>(GetArena());
+    camera2_ = p;
+  }
+  return camera2_;
+}
+inline ::com::bcom::solar::gprc::v2::Camera* CameraParametersStereo::mutable_camera2() {
+  // @@protoc_insertion_point(field_mutable:com.bcom.solar.gprc.v2.CameraParametersStereo.camera2)
+  return _internal_mutable_camera2();
+}
+inline void CameraParametersStereo::set_allocated_camera2(::com::bcom::solar::gprc::v2::Camera* camera2) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  if (message_arena == nullptr) {
+    delete camera2_;
+  }
+  if (camera2) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(camera2);
+    if (message_arena != submessage_arena) {
+      camera2 = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, camera2, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  camera2_ = camera2;
+  // @@protoc_insertion_point(field_set_allocated:com.bcom.solar.gprc.v2.CameraParametersStereo.camera2)
+}
+
+// -------------------------------------------------------------------
+
+// Rectification
+
+// repeated float rotation = 1;
+inline int Rectification::_internal_rotation_size() const {
+  return rotation_.size();
+}
+inline int Rectification::rotation_size() const {
+  return _internal_rotation_size();
+}
+inline void Rectification::clear_rotation() {
+  rotation_.Clear();
+}
+inline float Rectification::_internal_rotation(int index) const {
+  return rotation_.Get(index);
+}
+inline float Rectification::rotation(int index) const {
+  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.v2.Rectification.rotation)
+  return _internal_rotation(index);
+}
+inline void Rectification::set_rotation(int index, float value) {
+  rotation_.Set(index, value);
+  // @@protoc_insertion_point(field_set:com.bcom.solar.gprc.v2.Rectification.rotation)
+}
+inline void Rectification::_internal_add_rotation(float value) {
+  rotation_.Add(value);
+}
+inline void Rectification::add_rotation(float value) {
+  _internal_add_rotation(value);
+  // @@protoc_insertion_point(field_add:com.bcom.solar.gprc.v2.Rectification.rotation)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+Rectification::_internal_rotation() const {
+  return rotation_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+Rectification::rotation() const {
+  // @@protoc_insertion_point(field_list:com.bcom.solar.gprc.v2.Rectification.rotation)
+  return _internal_rotation();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+Rectification::_internal_mutable_rotation() {
+  return &rotation_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+Rectification::mutable_rotation() {
+  // @@protoc_insertion_point(field_mutable_list:com.bcom.solar.gprc.v2.Rectification.rotation)
+  return _internal_mutable_rotation();
+}
+
+// repeated float projection = 2;
+inline int Rectification::_internal_projection_size() const {
+  return projection_.size();
+}
+inline int Rectification::projection_size() const {
+  return _internal_projection_size();
+}
+inline void Rectification::clear_projection() {
+  projection_.Clear();
+}
+inline float Rectification::_internal_projection(int index) const {
+  return projection_.Get(index);
+}
+inline float Rectification::projection(int index) const {
+  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.v2.Rectification.projection)
+  return _internal_projection(index);
+}
+inline void Rectification::set_projection(int index, float value) {
+  projection_.Set(index, value);
+  // @@protoc_insertion_point(field_set:com.bcom.solar.gprc.v2.Rectification.projection)
+}
+inline void Rectification::_internal_add_projection(float value) {
+  projection_.Add(value);
+}
+inline void Rectification::add_projection(float value) {
+  _internal_add_projection(value);
+  // @@protoc_insertion_point(field_add:com.bcom.solar.gprc.v2.Rectification.projection)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+Rectification::_internal_projection() const {
+  return projection_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+Rectification::projection() const {
+  // @@protoc_insertion_point(field_list:com.bcom.solar.gprc.v2.Rectification.projection)
+  return _internal_projection();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+Rectification::_internal_mutable_projection() {
+  return &projection_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+Rectification::mutable_projection() {
+  // @@protoc_insertion_point(field_mutable_list:com.bcom.solar.gprc.v2.Rectification.projection)
+  return _internal_mutable_projection();
+}
+
+// .com.bcom.solar.gprc.StereoType stereo_type = 3;
+inline void Rectification::clear_stereo_type() {
+  stereo_type_ = 0;
+}
+inline ::com::bcom::solar::gprc::StereoType Rectification::_internal_stereo_type() const {
+  return static_cast< ::com::bcom::solar::gprc::StereoType >(stereo_type_);
+}
+inline ::com::bcom::solar::gprc::StereoType Rectification::stereo_type() const {
+  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.v2.Rectification.stereo_type)
+  return _internal_stereo_type();
+}
+inline void Rectification::_internal_set_stereo_type(::com::bcom::solar::gprc::StereoType value) {
+  
+  stereo_type_ = value;
+}
+inline void Rectification::set_stereo_type(::com::bcom::solar::gprc::StereoType value) {
+  _internal_set_stereo_type(value);
+  // @@protoc_insertion_point(field_set:com.bcom.solar.gprc.v2.Rectification.stereo_type)
+}
+
+// float baseline = 4;
+inline void Rectification::clear_baseline() {
+  baseline_ = 0;
+}
+inline float Rectification::_internal_baseline() const {
+  return baseline_;
+}
+inline float Rectification::baseline() const {
+  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.v2.Rectification.baseline)
+  return _internal_baseline();
+}
+inline void Rectification::_internal_set_baseline(float value) {
+  
+  baseline_ = value;
+}
+inline void Rectification::set_baseline(float value) {
+  _internal_set_baseline(value);
+  // @@protoc_insertion_point(field_set:com.bcom.solar.gprc.v2.Rectification.baseline)
+}
+
+// -------------------------------------------------------------------
+
+// RectificationParameters
+
+// string client_uuid = 1;
+inline void RectificationParameters::clear_client_uuid() {
+  client_uuid_.ClearToEmpty();
+}
+inline const std::string& RectificationParameters::client_uuid() const {
+  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.v2.RectificationParameters.client_uuid)
+  return _internal_client_uuid();
+}
+inline void RectificationParameters::set_client_uuid(const std::string& value) {
+  _internal_set_client_uuid(value);
+  // @@protoc_insertion_point(field_set:com.bcom.solar.gprc.v2.RectificationParameters.client_uuid)
+}
+inline std::string* RectificationParameters::mutable_client_uuid() {
+  // @@protoc_insertion_point(field_mutable:com.bcom.solar.gprc.v2.RectificationParameters.client_uuid)
+  return _internal_mutable_client_uuid();
+}
+inline const std::string& RectificationParameters::_internal_client_uuid() const {
+  return client_uuid_.Get();
+}
+inline void RectificationParameters::_internal_set_client_uuid(const std::string& value) {
+  
+  client_uuid_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArena());
+}
+inline void RectificationParameters::set_client_uuid(std::string&& value) {
+  
+  client_uuid_.Set(
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::move(value), GetArena());
+  // @@protoc_insertion_point(field_set_rvalue:com.bcom.solar.gprc.v2.RectificationParameters.client_uuid)
+}
+inline void RectificationParameters::set_client_uuid(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  
+  client_uuid_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(value), GetArena());
+  // @@protoc_insertion_point(field_set_char:com.bcom.solar.gprc.v2.RectificationParameters.client_uuid)
+}
+inline void RectificationParameters::set_client_uuid(const char* value,
+    size_t size) {
+  
+  client_uuid_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArena());
+  // @@protoc_insertion_point(field_set_pointer:com.bcom.solar.gprc.v2.RectificationParameters.client_uuid)
+}
+inline std::string* RectificationParameters::_internal_mutable_client_uuid() {
+  
+  return client_uuid_.Mutable(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArena());
+}
+inline std::string* RectificationParameters::release_client_uuid() {
+  // @@protoc_insertion_point(field_release:com.bcom.solar.gprc.v2.RectificationParameters.client_uuid)
+  return client_uuid_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline void RectificationParameters::set_allocated_client_uuid(std::string* client_uuid) {
+  if (client_uuid != nullptr) {
+    
+  } else {
+    
+  }
+  client_uuid_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), client_uuid,
+      GetArena());
+  // @@protoc_insertion_point(field_set_allocated:com.bcom.solar.gprc.v2.RectificationParameters.client_uuid)
+}
+
+// .com.bcom.solar.gprc.v2.Rectification cam1 = 2;
+inline bool RectificationParameters::_internal_has_cam1() const {
+  return this != internal_default_instance() && cam1_ != nullptr;
+}
+inline bool RectificationParameters::has_cam1() const {
+  return _internal_has_cam1();
+}
+inline void RectificationParameters::clear_cam1() {
+  if (GetArena() == nullptr && cam1_ != nullptr) {
+    delete cam1_;
+  }
+  cam1_ = nullptr;
+}
+inline const ::com::bcom::solar::gprc::v2::Rectification& RectificationParameters::_internal_cam1() const {
+  const ::com::bcom::solar::gprc::v2::Rectification* p = cam1_;
+  return p != nullptr ? *p : reinterpret_cast<const ::com::bcom::solar::gprc::v2::Rectification&>(
+      ::com::bcom::solar::gprc::v2::_Rectification_default_instance_);
+}
+inline const ::com::bcom::solar::gprc::v2::Rectification& RectificationParameters::cam1() const {
+  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.v2.RectificationParameters.cam1)
+  return _internal_cam1();
+}
+inline void RectificationParameters::unsafe_arena_set_allocated_cam1(
+    ::com::bcom::solar::gprc::v2::Rectification* cam1) {
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(cam1_);
+  }
+  cam1_ = cam1;
+  if (cam1) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:com.bcom.solar.gprc.v2.RectificationParameters.cam1)
+}
+inline ::com::bcom::solar::gprc::v2::Rectification* RectificationParameters::release_cam1() {
+  
+  ::com::bcom::solar::gprc::v2::Rectification* temp = cam1_;
+  cam1_ = nullptr;
+  if (GetArena() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+  return temp;
+}
+inline ::com::bcom::solar::gprc::v2::Rectification* RectificationParameters::unsafe_arena_release_cam1() {
+  // @@protoc_insertion_point(field_release:com.bcom.solar.gprc.v2.RectificationParameters.cam1)
+  
+  ::com::bcom::solar::gprc::v2::Rectification* temp = cam1_;
+  cam1_ = nullptr;
+  return temp;
+}
+inline ::com::bcom::solar::gprc::v2::Rectification* RectificationParameters::_internal_mutable_cam1() {
+  
+  if (cam1_ == nullptr) {
+    auto* p = CreateMaybeMessage<::com::bcom::solar::gprc::v2::Rectification>(GetArena());
+    cam1_ = p;
+  }
+  return cam1_;
+}
+inline ::com::bcom::solar::gprc::v2::Rectification* RectificationParameters::mutable_cam1() {
+  // @@protoc_insertion_point(field_mutable:com.bcom.solar.gprc.v2.RectificationParameters.cam1)
+  return _internal_mutable_cam1();
+}
+inline void RectificationParameters::set_allocated_cam1(::com::bcom::solar::gprc::v2::Rectification* cam1) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  if (message_arena == nullptr) {
+    delete cam1_;
+  }
+  if (cam1) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(cam1);
+    if (message_arena != submessage_arena) {
+      cam1 = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, cam1, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  cam1_ = cam1;
+  // @@protoc_insertion_point(field_set_allocated:com.bcom.solar.gprc.v2.RectificationParameters.cam1)
+}
+
+// .com.bcom.solar.gprc.v2.Rectification cam2 = 3;
+inline bool RectificationParameters::_internal_has_cam2() const {
+  return this != internal_default_instance() && cam2_ != nullptr;
+}
+inline bool RectificationParameters::has_cam2() const {
+  return _internal_has_cam2();
+}
+inline void RectificationParameters::clear_cam2() {
+  if (GetArena() == nullptr && cam2_ != nullptr) {
+    delete cam2_;
+  }
+  cam2_ = nullptr;
+}
+inline const ::com::bcom::solar::gprc::v2::Rectification& RectificationParameters::_internal_cam2() const {
+  const ::com::bcom::solar::gprc::v2::Rectification* p = cam2_;
+  return p != nullptr ? *p : reinterpret_cast<const ::com::bcom::solar::gprc::v2::Rectification&>(
+      ::com::bcom::solar::gprc::v2::_Rectification_default_instance_);
+}
+inline const ::com::bcom::solar::gprc::v2::Rectification& RectificationParameters::cam2() const {
+  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.v2.RectificationParameters.cam2)
+  return _internal_cam2();
+}
+inline void RectificationParameters::unsafe_arena_set_allocated_cam2(
+    ::com::bcom::solar::gprc::v2::Rectification* cam2) {
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(cam2_);
+  }
+  cam2_ = cam2;
+  if (cam2) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:com.bcom.solar.gprc.v2.RectificationParameters.cam2)
+}
+inline ::com::bcom::solar::gprc::v2::Rectification* RectificationParameters::release_cam2() {
+  
+  ::com::bcom::solar::gprc::v2::Rectification* temp = cam2_;
+  cam2_ = nullptr;
+  if (GetArena() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+  return temp;
+}
+inline ::com::bcom::solar::gprc::v2::Rectification* RectificationParameters::unsafe_arena_release_cam2() {
+  // @@protoc_insertion_point(field_release:com.bcom.solar.gprc.v2.RectificationParameters.cam2)
+  
+  ::com::bcom::solar::gprc::v2::Rectification* temp = cam2_;
+  cam2_ = nullptr;
+  return temp;
+}
+inline ::com::bcom::solar::gprc::v2::Rectification* RectificationParameters::_internal_mutable_cam2() {
+  
+  if (cam2_ == nullptr) {
+    auto* p = CreateMaybeMessage<::com::bcom::solar::gprc::v2::Rectification>(GetArena());
+    cam2_ = p;
+  }
+  return cam2_;
+}
+inline ::com::bcom::solar::gprc::v2::Rectification* RectificationParameters::mutable_cam2() {
+  // @@protoc_insertion_point(field_mutable:com.bcom.solar.gprc.v2.RectificationParameters.cam2)
+  return _internal_mutable_cam2();
+}
+inline void RectificationParameters::set_allocated_cam2(::com::bcom::solar::gprc::v2::Rectification* cam2) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  if (message_arena == nullptr) {
+    delete cam2_;
+  }
+  if (cam2) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(cam2);
+    if (message_arena != submessage_arena) {
+      cam2 = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, cam2, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  cam2_ = cam2;
+  // @@protoc_insertion_point(field_set_allocated:com.bcom.solar.gprc.v2.RectificationParameters.cam2)
+}
+
+// -------------------------------------------------------------------
+
+// RelocalizationResult
+
+// .com.bcom.solar.gprc.RelocalizationPoseStatus pose_status = 1;
+inline void RelocalizationResult::clear_pose_status() {
+  pose_status_ = 0;
+}
+inline ::com::bcom::solar::gprc::RelocalizationPoseStatus RelocalizationResult::_internal_pose_status() const {
+  return static_cast< ::com::bcom::solar::gprc::RelocalizationPoseStatus >(pose_status_);
+}
+inline ::com::bcom::solar::gprc::RelocalizationPoseStatus RelocalizationResult::pose_status() const {
+  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.v2.RelocalizationResult.pose_status)
+  return _internal_pose_status();
+}
+inline void RelocalizationResult::_internal_set_pose_status(::com::bcom::solar::gprc::RelocalizationPoseStatus value) {
+  
+  pose_status_ = value;
+}
+inline void RelocalizationResult::set_pose_status(::com::bcom::solar::gprc::RelocalizationPoseStatus value) {
+  _internal_set_pose_status(value);
+  // @@protoc_insertion_point(field_set:com.bcom.solar.gprc.v2.RelocalizationResult.pose_status)
+}
+
+// repeated float pose = 2;
+inline int RelocalizationResult::_internal_pose_size() const {
+  return pose_.size();
+}
+inline int RelocalizationResult::pose_size() const {
+  return _internal_pose_size();
+}
+inline void RelocalizationResult::clear_pose() {
+  pose_.Clear();
+}
+inline float RelocalizationResult::_internal_pose(int index) const {
+  return pose_.Get(index);
+}
+inline float RelocalizationResult::pose(int index) const {
+  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.v2.RelocalizationResult.pose)
+  return _internal_pose(index);
+}
+inline void RelocalizationResult::set_pose(int index, float value) {
+  pose_.Set(index, value);
+  // @@protoc_insertion_point(field_set:com.bcom.solar.gprc.v2.RelocalizationResult.pose)
+}
+inline void RelocalizationResult::_internal_add_pose(float value) {
+  pose_.Add(value);
+}
+inline void RelocalizationResult::add_pose(float value) {
+  _internal_add_pose(value);
+  // @@protoc_insertion_point(field_add:com.bcom.solar.gprc.v2.RelocalizationResult.pose)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+RelocalizationResult::_internal_pose() const {
+  return pose_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+RelocalizationResult::pose() const {
+  // @@protoc_insertion_point(field_list:com.bcom.solar.gprc.v2.RelocalizationResult.pose)
+  return _internal_pose();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+RelocalizationResult::_internal_mutable_pose() {
+  return &pose_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+RelocalizationResult::mutable_pose() {
+  // @@protoc_insertion_point(field_mutable_list:com.bcom.solar.gprc.v2.RelocalizationResult.pose)
+  return _internal_mutable_pose();
+}
+
+// float confidence = 3;
+inline void RelocalizationResult::clear_confidence() {
+  confidence_ = 0;
+}
+inline float RelocalizationResult::_internal_confidence() const {
+  return confidence_;
+}
+inline float RelocalizationResult::confidence() const {
+  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.v2.RelocalizationResult.confidence)
+  return _internal_confidence();
+}
+inline void RelocalizationResult::_internal_set_confidence(float value) {
+  
+  confidence_ = value;
+}
+inline void RelocalizationResult::set_confidence(float value) {
+  _internal_set_confidence(value);
+  // @@protoc_insertion_point(field_set:com.bcom.solar.gprc.v2.RelocalizationResult.confidence)
+}
+
+// .com.bcom.solar.gprc.MappingStatus mapping_status = 4;
+inline void RelocalizationResult::clear_mapping_status() {
+  mapping_status_ = 0;
+}
+inline ::com::bcom::solar::gprc::MappingStatus RelocalizationResult::_internal_mapping_status() const {
+  return static_cast< ::com::bcom::solar::gprc::MappingStatus >(mapping_status_);
+}
+inline ::com::bcom::solar::gprc::MappingStatus RelocalizationResult::mapping_status() const {
+  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.v2.RelocalizationResult.mapping_status)
+  return _internal_mapping_status();
+}
+inline void RelocalizationResult::_internal_set_mapping_status(::com::bcom::solar::gprc::MappingStatus value) {
+  
+  mapping_status_ = value;
+}
+inline void RelocalizationResult::set_mapping_status(::com::bcom::solar::gprc::MappingStatus value) {
+  _internal_set_mapping_status(value);
+  // @@protoc_insertion_point(field_set:com.bcom.solar.gprc.v2.RelocalizationResult.mapping_status)
+}
+
+// uint64 timestamp = 5;
+inline void RelocalizationResult::clear_timestamp() {
+  timestamp_ = PROTOBUF_ULONGLONG(0);
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 RelocalizationResult::_internal_timestamp() const {
+  return timestamp_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 RelocalizationResult::timestamp() const {
+  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.v2.RelocalizationResult.timestamp)
+  return _internal_timestamp();
+}
+inline void RelocalizationResult::_internal_set_timestamp(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  
+  timestamp_ = value;
+}
+inline void RelocalizationResult::set_timestamp(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  _internal_set_timestamp(value);
+  // @@protoc_insertion_point(field_set:com.bcom.solar.gprc.v2.RelocalizationResult.timestamp)
+}
+
+// -------------------------------------------------------------------
+
+// RelocalizationResults
+
+// repeated .com.bcom.solar.gprc.v2.RelocalizationResult results = 1;
+inline int RelocalizationResults::_internal_results_size() const {
+  return results_.size();
+}
+inline int RelocalizationResults::results_size() const {
+  return _internal_results_size();
+}
+inline void RelocalizationResults::clear_results() {
+  results_.Clear();
+}
+inline ::com::bcom::solar::gprc::v2::RelocalizationResult* RelocalizationResults::mutable_results(int index) {
+  // @@protoc_insertion_point(field_mutable:com.bcom.solar.gprc.v2.RelocalizationResults.results)
+  return results_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::com::bcom::solar::gprc::v2::RelocalizationResult >*
+RelocalizationResults::mutable_results() {
+  // @@protoc_insertion_point(field_mutable_list:com.bcom.solar.gprc.v2.RelocalizationResults.results)
+  return &results_;
+}
+inline const ::com::bcom::solar::gprc::v2::RelocalizationResult& RelocalizationResults::_internal_results(int index) const {
+  return results_.Get(index);
+}
+inline const ::com::bcom::solar::gprc::v2::RelocalizationResult& RelocalizationResults::results(int index) const {
+  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.v2.RelocalizationResults.results)
+  return _internal_results(index);
+}
+inline ::com::bcom::solar::gprc::v2::RelocalizationResult* RelocalizationResults::_internal_add_results() {
+  return results_.Add();
+}
+inline ::com::bcom::solar::gprc::v2::RelocalizationResult* RelocalizationResults::add_results() {
+  // @@protoc_insertion_point(field_add:com.bcom.solar.gprc.v2.RelocalizationResults.results)
+  return _internal_add_results();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::com::bcom::solar::gprc::v2::RelocalizationResult >&
+RelocalizationResults::results() const {
+  // @@protoc_insertion_point(field_list:com.bcom.solar.gprc.v2.RelocalizationResults.results)
+  return results_;
+}
+
+// -------------------------------------------------------------------
+
+// Frames
+
+// string client_uuid = 1;
+inline void Frames::clear_client_uuid() {
+  client_uuid_.ClearToEmpty();
+}
+inline const std::string& Frames::client_uuid() const {
+  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.v2.Frames.client_uuid)
+  return _internal_client_uuid();
+}
+inline void Frames::set_client_uuid(const std::string& value) {
+  _internal_set_client_uuid(value);
+  // @@protoc_insertion_point(field_set:com.bcom.solar.gprc.v2.Frames.client_uuid)
+}
+inline std::string* Frames::mutable_client_uuid() {
+  // @@protoc_insertion_point(field_mutable:com.bcom.solar.gprc.v2.Frames.client_uuid)
+  return _internal_mutable_client_uuid();
+}
+inline const std::string& Frames::_internal_client_uuid() const {
+  return client_uuid_.Get();
+}
+inline void Frames::_internal_set_client_uuid(const std::string& value) {
+  
+  client_uuid_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArena());
+}
+inline void Frames::set_client_uuid(std::string&& value) {
+  
+  client_uuid_.Set(
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::move(value), GetArena());
+  // @@protoc_insertion_point(field_set_rvalue:com.bcom.solar.gprc.v2.Frames.client_uuid)
+}
+inline void Frames::set_client_uuid(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  
+  client_uuid_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(value), GetArena());
+  // @@protoc_insertion_point(field_set_char:com.bcom.solar.gprc.v2.Frames.client_uuid)
+}
+inline void Frames::set_client_uuid(const char* value,
+    size_t size) {
+  
+  client_uuid_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArena());
+  // @@protoc_insertion_point(field_set_pointer:com.bcom.solar.gprc.v2.Frames.client_uuid)
+}
+inline std::string* Frames::_internal_mutable_client_uuid() {
+  
+  return client_uuid_.Mutable(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArena());
+}
+inline std::string* Frames::release_client_uuid() {
+  // @@protoc_insertion_point(field_release:com.bcom.solar.gprc.v2.Frames.client_uuid)
+  return client_uuid_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline void Frames::set_allocated_client_uuid(std::string* client_uuid) {
+  if (client_uuid != nullptr) {
+    
+  } else {
+    
+  }
+  client_uuid_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), client_uuid,
+      GetArena());
+  // @@protoc_insertion_point(field_set_allocated:com.bcom.solar.gprc.v2.Frames.client_uuid)
+}
+
+// repeated .com.bcom.solar.gprc.v2.Frame frames = 2;
+inline int Frames::_internal_frames_size() const {
+  return frames_.size();
+}
+inline int Frames::frames_size() const {
+  return _internal_frames_size();
+}
+inline void Frames::clear_frames() {
+  frames_.Clear();
+}
+inline ::com::bcom::solar::gprc::v2::Frame* Frames::mutable_frames(int index) {
+  // @@protoc_insertion_point(field_mutable:com.bcom.solar.gprc.v2.Frames.frames)
+  return frames_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::com::bcom::solar::gprc::v2::Frame >*
+Frames::mutable_frames() {
+  // @@protoc_insertion_point(field_mutable_list:com.bcom.solar.gprc.v2.Frames.frames)
+  return &frames_;
+}
+inline const ::com::bcom::solar::gprc::v2::Frame& Frames::_internal_frames(int index) const {
+  return frames_.Get(index);
+}
+inline const ::com::bcom::solar::gprc::v2::Frame& Frames::frames(int index) const {
+  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.v2.Frames.frames)
+  return _internal_frames(index);
+}
+inline ::com::bcom::solar::gprc::v2::Frame* Frames::_internal_add_frames() {
+  return frames_.Add();
+}
+inline ::com::bcom::solar::gprc::v2::Frame* Frames::add_frames() {
+  // @@protoc_insertion_point(field_add:com.bcom.solar.gprc.v2.Frames.frames)
+  return _internal_add_frames();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::com::bcom::solar::gprc::v2::Frame >&
+Frames::frames() const {
+  // @@protoc_insertion_point(field_list:com.bcom.solar.gprc.v2.Frames.frames)
+  return frames_;
+}
+
+// -------------------------------------------------------------------
+
+// FramesBatch
+
+// string client_uuid = 1;
+inline void FramesBatch::clear_client_uuid() {
+  client_uuid_.ClearToEmpty();
+}
+inline const std::string& FramesBatch::client_uuid() const {
+  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.v2.FramesBatch.client_uuid)
+  return _internal_client_uuid();
+}
+inline void FramesBatch::set_client_uuid(const std::string& value) {
+  _internal_set_client_uuid(value);
+  // @@protoc_insertion_point(field_set:com.bcom.solar.gprc.v2.FramesBatch.client_uuid)
+}
+inline std::string* FramesBatch::mutable_client_uuid() {
+  // @@protoc_insertion_point(field_mutable:com.bcom.solar.gprc.v2.FramesBatch.client_uuid)
+  return _internal_mutable_client_uuid();
+}
+inline const std::string& FramesBatch::_internal_client_uuid() const {
+  return client_uuid_.Get();
+}
+inline void FramesBatch::_internal_set_client_uuid(const std::string& value) {
+  
+  client_uuid_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArena());
+}
+inline void FramesBatch::set_client_uuid(std::string&& value) {
+  
+  client_uuid_.Set(
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::move(value), GetArena());
+  // @@protoc_insertion_point(field_set_rvalue:com.bcom.solar.gprc.v2.FramesBatch.client_uuid)
+}
+inline void FramesBatch::set_client_uuid(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  
+  client_uuid_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(value), GetArena());
+  // @@protoc_insertion_point(field_set_char:com.bcom.solar.gprc.v2.FramesBatch.client_uuid)
+}
+inline void FramesBatch::set_client_uuid(const char* value,
+    size_t size) {
+  
+  client_uuid_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArena());
+  // @@protoc_insertion_point(field_set_pointer:com.bcom.solar.gprc.v2.FramesBatch.client_uuid)
+}
+inline std::string* FramesBatch::_internal_mutable_client_uuid() {
+  
+  return client_uuid_.Mutable(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArena());
+}
+inline std::string* FramesBatch::release_client_uuid() {
+  // @@protoc_insertion_point(field_release:com.bcom.solar.gprc.v2.FramesBatch.client_uuid)
+  return client_uuid_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline void FramesBatch::set_allocated_client_uuid(std::string* client_uuid) {
+  if (client_uuid != nullptr) {
+    
+  } else {
+    
+  }
+  client_uuid_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), client_uuid,
+      GetArena());
+  // @@protoc_insertion_point(field_set_allocated:com.bcom.solar.gprc.v2.FramesBatch.client_uuid)
+}
+
+// repeated .com.bcom.solar.gprc.v2.Frames frames = 2;
+inline int FramesBatch::_internal_frames_size() const {
+  return frames_.size();
+}
+inline int FramesBatch::frames_size() const {
+  return _internal_frames_size();
+}
+inline void FramesBatch::clear_frames() {
+  frames_.Clear();
+}
+inline ::com::bcom::solar::gprc::v2::Frames* FramesBatch::mutable_frames(int index) {
+  // @@protoc_insertion_point(field_mutable:com.bcom.solar.gprc.v2.FramesBatch.frames)
+  return frames_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::com::bcom::solar::gprc::v2::Frames >*
+FramesBatch::mutable_frames() {
+  // @@protoc_insertion_point(field_mutable_list:com.bcom.solar.gprc.v2.FramesBatch.frames)
+  return &frames_;
+}
+inline const ::com::bcom::solar::gprc::v2::Frames& FramesBatch::_internal_frames(int index) const {
+  return frames_.Get(index);
+}
+inline const ::com::bcom::solar::gprc::v2::Frames& FramesBatch::frames(int index) const {
+  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.v2.FramesBatch.frames)
+  return _internal_frames(index);
+}
+inline ::com::bcom::solar::gprc::v2::Frames* FramesBatch::_internal_add_frames() {
+  return frames_.Add();
+}
+inline ::com::bcom::solar::gprc::v2::Frames* FramesBatch::add_frames() {
+  // @@protoc_insertion_point(field_add:com.bcom.solar.gprc.v2.FramesBatch.frames)
+  return _internal_add_frames();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::com::bcom::solar::gprc::v2::Frames >&
+FramesBatch::frames() const {
+  // @@protoc_insertion_point(field_list:com.bcom.solar.gprc.v2.FramesBatch.frames)
+  return frames_;
+}
+
+// bool last_result_only = 3;
+inline void FramesBatch::clear_last_result_only() {
+  last_result_only_ = false;
+}
+inline bool FramesBatch::_internal_last_result_only() const {
+  return last_result_only_;
+}
+inline bool FramesBatch::last_result_only() const {
+  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.v2.FramesBatch.last_result_only)
+  return _internal_last_result_only();
+}
+inline void FramesBatch::_internal_set_last_result_only(bool value) {
+  
+  last_result_only_ = value;
+}
+inline void FramesBatch::set_last_result_only(bool value) {
+  _internal_set_last_result_only(value);
+  // @@protoc_insertion_point(field_set:com.bcom.solar.gprc.v2.FramesBatch.last_result_only)
+}
+
+// -------------------------------------------------------------------
+
+// GroundTruthFrames
+
+// string client_uuid = 1;
+inline void GroundTruthFrames::clear_client_uuid() {
+  client_uuid_.ClearToEmpty();
+}
+inline const std::string& GroundTruthFrames::client_uuid() const {
+  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.v2.GroundTruthFrames.client_uuid)
+  return _internal_client_uuid();
+}
+inline void GroundTruthFrames::set_client_uuid(const std::string& value) {
+  _internal_set_client_uuid(value);
+  // @@protoc_insertion_point(field_set:com.bcom.solar.gprc.v2.GroundTruthFrames.client_uuid)
+}
+inline std::string* GroundTruthFrames::mutable_client_uuid() {
+  // @@protoc_insertion_point(field_mutable:com.bcom.solar.gprc.v2.GroundTruthFrames.client_uuid)
+  return _internal_mutable_client_uuid();
+}
+inline const std::string& GroundTruthFrames::_internal_client_uuid() const {
+  return client_uuid_.Get();
+}
+inline void GroundTruthFrames::_internal_set_client_uuid(const std::string& value) {
+  
+  client_uuid_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArena());
+}
+inline void GroundTruthFrames::set_client_uuid(std::string&& value) {
+  
+  client_uuid_.Set(
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::move(value), GetArena());
+  // @@protoc_insertion_point(field_set_rvalue:com.bcom.solar.gprc.v2.GroundTruthFrames.client_uuid)
+}
+inline void GroundTruthFrames::set_client_uuid(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  
+  client_uuid_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(value), GetArena());
+  // @@protoc_insertion_point(field_set_char:com.bcom.solar.gprc.v2.GroundTruthFrames.client_uuid)
+}
+inline void GroundTruthFrames::set_client_uuid(const char* value,
+    size_t size) {
+  
+  client_uuid_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArena());
+  // @@protoc_insertion_point(field_set_pointer:com.bcom.solar.gprc.v2.GroundTruthFrames.client_uuid)
+}
+inline std::string* GroundTruthFrames::_internal_mutable_client_uuid() {
+  
+  return client_uuid_.Mutable(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArena());
+}
+inline std::string* GroundTruthFrames::release_client_uuid() {
+  // @@protoc_insertion_point(field_release:com.bcom.solar.gprc.v2.GroundTruthFrames.client_uuid)
+  return client_uuid_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline void GroundTruthFrames::set_allocated_client_uuid(std::string* client_uuid) {
+  if (client_uuid != nullptr) {
+    
+  } else {
+    
+  }
+  client_uuid_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), client_uuid,
+      GetArena());
+  // @@protoc_insertion_point(field_set_allocated:com.bcom.solar.gprc.v2.GroundTruthFrames.client_uuid)
+}
+
+// .com.bcom.solar.gprc.v2.Frames frames = 2;
+inline bool GroundTruthFrames::_internal_has_frames() const {
+  return this != internal_default_instance() && frames_ != nullptr;
+}
+inline bool GroundTruthFrames::has_frames() const {
+  return _internal_has_frames();
+}
+inline void GroundTruthFrames::clear_frames() {
+  if (GetArena() == nullptr && frames_ != nullptr) {
+    delete frames_;
+  }
+  frames_ = nullptr;
+}
+inline const ::com::bcom::solar::gprc::v2::Frames& GroundTruthFrames::_internal_frames() const {
+  const ::com::bcom::solar::gprc::v2::Frames* p = frames_;
+  return p != nullptr ? *p : reinterpret_cast<const ::com::bcom::solar::gprc::v2::Frames&>(
+      ::com::bcom::solar::gprc::v2::_Frames_default_instance_);
+}
+inline const ::com::bcom::solar::gprc::v2::Frames& GroundTruthFrames::frames() const {
+  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.v2.GroundTruthFrames.frames)
+  return _internal_frames();
+}
+inline void GroundTruthFrames::unsafe_arena_set_allocated_frames(
+    ::com::bcom::solar::gprc::v2::Frames* frames) {
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(frames_);
+  }
+  frames_ = frames;
+  if (frames) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:com.bcom.solar.gprc.v2.GroundTruthFrames.frames)
+}
+inline ::com::bcom::solar::gprc::v2::Frames* GroundTruthFrames::release_frames() {
+  
+  ::com::bcom::solar::gprc::v2::Frames* temp = frames_;
+  frames_ = nullptr;
+  if (GetArena() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+  return temp;
+}
+inline ::com::bcom::solar::gprc::v2::Frames* GroundTruthFrames::unsafe_arena_release_frames() {
+  // @@protoc_insertion_point(field_release:com.bcom.solar.gprc.v2.GroundTruthFrames.frames)
+  
+  ::com::bcom::solar::gprc::v2::Frames* temp = frames_;
+  frames_ = nullptr;
+  return temp;
+}
+inline ::com::bcom::solar::gprc::v2::Frames* GroundTruthFrames::_internal_mutable_frames() {
+  
+  if (frames_ == nullptr) {
+    auto* p = CreateMaybeMessage<::com::bcom::solar::gprc::v2::Frames>(GetArena());
+    frames_ = p;
+  }
+  return frames_;
+}
+inline ::com::bcom::solar::gprc::v2::Frames* GroundTruthFrames::mutable_frames() {
+  // @@protoc_insertion_point(field_mutable:com.bcom.solar.gprc.v2.GroundTruthFrames.frames)
+  return _internal_mutable_frames();
+}
+inline void GroundTruthFrames::set_allocated_frames(::com::bcom::solar::gprc::v2::Frames* frames) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  if (message_arena == nullptr) {
+    delete frames_;
+  }
+  if (frames) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(frames);
+    if (message_arena != submessage_arena) {
+      frames = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, frames, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  frames_ = frames;
+  // @@protoc_insertion_point(field_set_allocated:com.bcom.solar.gprc.v2.GroundTruthFrames.frames)
+}
+
+// repeated float world_transform = 3;
+inline int GroundTruthFrames::_internal_world_transform_size() const {
+  return world_transform_.size();
+}
+inline int GroundTruthFrames::world_transform_size() const {
+  return _internal_world_transform_size();
+}
+inline void GroundTruthFrames::clear_world_transform() {
+  world_transform_.Clear();
+}
+inline float GroundTruthFrames::_internal_world_transform(int index) const {
+  return world_transform_.Get(index);
+}
+inline float GroundTruthFrames::world_transform(int index) const {
+  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.v2.GroundTruthFrames.world_transform)
+  return _internal_world_transform(index);
+}
+inline void GroundTruthFrames::set_world_transform(int index, float value) {
+  world_transform_.Set(index, value);
+  // @@protoc_insertion_point(field_set:com.bcom.solar.gprc.v2.GroundTruthFrames.world_transform)
+}
+inline void GroundTruthFrames::_internal_add_world_transform(float value) {
+  world_transform_.Add(value);
+}
+inline void GroundTruthFrames::add_world_transform(float value) {
+  _internal_add_world_transform(value);
+  // @@protoc_insertion_point(field_add:com.bcom.solar.gprc.v2.GroundTruthFrames.world_transform)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+GroundTruthFrames::_internal_world_transform() const {
+  return world_transform_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+GroundTruthFrames::world_transform() const {
+  // @@protoc_insertion_point(field_list:com.bcom.solar.gprc.v2.GroundTruthFrames.world_transform)
+  return _internal_world_transform();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+GroundTruthFrames::_internal_mutable_world_transform() {
+  return &world_transform_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+GroundTruthFrames::mutable_world_transform() {
+  // @@protoc_insertion_point(field_mutable_list:com.bcom.solar.gprc.v2.GroundTruthFrames.world_transform)
+  return _internal_mutable_world_transform();
+}
+
+// bool fixed_pose = 4;
+inline void GroundTruthFrames::clear_fixed_pose() {
+  fixed_pose_ = false;
+}
+inline bool GroundTruthFrames::_internal_fixed_pose() const {
+  return fixed_pose_;
+}
+inline bool GroundTruthFrames::fixed_pose() const {
+  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.v2.GroundTruthFrames.fixed_pose)
+  return _internal_fixed_pose();
+}
+inline void GroundTruthFrames::_internal_set_fixed_pose(bool value) {
+  
+  fixed_pose_ = value;
+}
+inline void GroundTruthFrames::set_fixed_pose(bool value) {
+  _internal_set_fixed_pose(value);
+  // @@protoc_insertion_point(field_set:com.bcom.solar.gprc.v2.GroundTruthFrames.fixed_pose)
+}
+
+// -------------------------------------------------------------------
+
+// Frame
+
+// int32 sensor_id = 1;
+inline void Frame::clear_sensor_id() {
+  sensor_id_ = 0;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 Frame::_internal_sensor_id() const {
+  return sensor_id_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 Frame::sensor_id() const {
+  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.v2.Frame.sensor_id)
+  return _internal_sensor_id();
+}
+inline void Frame::_internal_set_sensor_id(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  
+  sensor_id_ = value;
+}
+inline void Frame::set_sensor_id(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  _internal_set_sensor_id(value);
+  // @@protoc_insertion_point(field_set:com.bcom.solar.gprc.v2.Frame.sensor_id)
+}
+
+// .com.bcom.solar.gprc.Image image = 2;
+inline bool Frame::_internal_has_image() const {
+  return this != internal_default_instance() && image_ != nullptr;
+}
+inline bool Frame::has_image() const {
+  return _internal_has_image();
+}
+inline const ::com::bcom::solar::gprc::Image& Frame::_internal_image() const {
+  const ::com::bcom::solar::gprc::Image* p = image_;
+  return p != nullptr ? *p : reinterpret_cast<const ::com::bcom::solar::gprc::Image&>(
+      ::com::bcom::solar::gprc::_Image_default_instance_);
+}
+inline const ::com::bcom::solar::gprc::Image& Frame::image() const {
+  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.v2.Frame.image)
+  return _internal_image();
+}
+inline void Frame::unsafe_arena_set_allocated_image(
+    ::com::bcom::solar::gprc::Image* image) {
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(image_);
+  }
+  image_ = image;
+  if (image) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:com.bcom.solar.gprc.v2.Frame.image)
+}
+inline ::com::bcom::solar::gprc::Image* Frame::release_image() {
+  
+  ::com::bcom::solar::gprc::Image* temp = image_;
+  image_ = nullptr;
+  if (GetArena() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+  return temp;
+}
+inline ::com::bcom::solar::gprc::Image* Frame::unsafe_arena_release_image() {
+  // @@protoc_insertion_point(field_release:com.bcom.solar.gprc.v2.Frame.image)
+  
+  ::com::bcom::solar::gprc::Image* temp = image_;
+  image_ = nullptr;
+  return temp;
+}
+inline ::com::bcom::solar::gprc::Image* Frame::_internal_mutable_image() {
+  
+  if (image_ == nullptr) {
+    auto* p = CreateMaybeMessage<::com::bcom::solar::gprc::Image>(GetArena());
+    image_ = p;
+  }
+  return image_;
+}
+inline ::com::bcom::solar::gprc::Image* Frame::mutable_image() {
+  // @@protoc_insertion_point(field_mutable:com.bcom.solar.gprc.v2.Frame.image)
+  return _internal_mutable_image();
+}
+inline void Frame::set_allocated_image(::com::bcom::solar::gprc::Image* image) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(image_);
+  }
+  if (image) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(image)->GetArena();
+    if (message_arena != submessage_arena) {
+      image = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, image, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  image_ = image;
+  // @@protoc_insertion_point(field_set_allocated:com.bcom.solar.gprc.v2.Frame.image)
+}
+
+// uint64 timestamp = 3;
+inline void Frame::clear_timestamp() {
+  timestamp_ = PROTOBUF_ULONGLONG(0);
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 Frame::_internal_timestamp() const {
+  return timestamp_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 Frame::timestamp() const {
+  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.v2.Frame.timestamp)
+  return _internal_timestamp();
+}
+inline void Frame::_internal_set_timestamp(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  
+  timestamp_ = value;
+}
+inline void Frame::set_timestamp(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  _internal_set_timestamp(value);
+  // @@protoc_insertion_point(field_set:com.bcom.solar.gprc.v2.Frame.timestamp)
+}
+
+// repeated float pose = 4;
+inline int Frame::_internal_pose_size() const {
+  return pose_.size();
+}
+inline int Frame::pose_size() const {
+  return _internal_pose_size();
+}
+inline void Frame::clear_pose() {
+  pose_.Clear();
+}
+inline float Frame::_internal_pose(int index) const {
+  return pose_.Get(index);
+}
+inline float Frame::pose(int index) const {
+  // @@protoc_insertion_point(field_get:com.bcom.solar.gprc.v2.Frame.pose)
+  return _internal_pose(index);
+}
+inline void Frame::set_pose(int index, float value) {
+  pose_.Set(index, value);
+  // @@protoc_insertion_point(field_set:com.bcom.solar.gprc.v2.Frame.pose)
+}
+inline void Frame::_internal_add_pose(float value) {
+  pose_.Add(value);
+}
+inline void Frame::add_pose(float value) {
+  _internal_add_pose(value);
+  // @@protoc_insertion_point(field_add:com.bcom.solar.gprc.v2.Frame.pose)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+Frame::_internal_pose() const {
+  return pose_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+Frame::pose() const {
+  // @@protoc_insertion_point(field_list:com.bcom.solar.gprc.v2.Frame.pose)
+  return _internal_pose();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+Frame::_internal_mutable_pose() {
+  return &pose_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+Frame::mutable_pose() {
+  // @@protoc_insertion_point(field_mutable_list:com.bcom.solar.gprc.v2.Frame.pose)
+  return _internal_mutable_pose();
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace v2
+}  // namespace gprc
+}  // namespace solar
+}  // namespace bcom
+}  // namespace com
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_solar_5fmapping_5fand_5frelocalization_5fproxy_5fv2_2eproto
@@ -0,0 +1,928 @@
+/**
+ * @copyright Copyright (c) 2021 B-com http://www.b-com.com/
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <new>
+#include <random>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+#include <cxxopts.hpp>
+
+#include <google/protobuf/arena.h>
+
+#include <datastructure/Image.h>
+#include <datastructure/MathDefinitions.h>
+
+#include "grpc/solar_mapping_and_relocalization_proxy.pb.h"
+#include "grpc/solar_mapping_and_relocalization_proxy_v2.pb.h"
+#include "ClientRegistry.h"
+#include "FrameRecording.h"
+#include "ImageConversion.h"
+#include "LatencyHistogram.h"
+#include "TimestampOrderedRing.h"
+
+using namespace std;
+using namespace com::bcom::solar::gprc;
+
+// Count heap allocations made through operator new (protobuf messages and strings)
+std::atomic<size_t> gNbAllocations{0};
+
+void* operator new(size_t size)
+{
+    gNbAllocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* ptr = std::malloc(size == 0 ? 1 : size))
+        return ptr;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, size_t) noexcept
+{
+    std::free(ptr);
+}
+
+// Default frame size: HoloLens 2 PV camera
+const int DEFAULT_WIDTH = 1280;
+const int DEFAULT_HEIGHT = 720;
+const int DEFAULT_ITERATIONS = 200;
+const int DEFAULT_CLIENTS = 8;
+const int DEFAULT_THREADS = 16;
+
+// Same initial block size as the proxy per-call arenas
+#define ARENA_BENCH_INITIAL_BLOCK_SIZE (16 * 1024)
+
+// print help options
+void print_help(const cxxopts::Options& options)
+{
+    cout << options.help({""}) << '\n';
+}
+
+// Run a function several times and return the mean duration of one run in seconds
+double measure(int iterations, const std::function<void()>& fn)
+{
+    // Warm up (page faults, caches, CPU frequency)
+    fn();
+
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; i++)
+        fn();
+    auto end = std::chrono::steady_clock::now();
+
+    return std::chrono::duration<double>(end - start).count() / iterations;
+}
+
+void printResult(const string& name, double seconds, size_t bytes)
+{
+    cout << "  " << left << setw(36) << name
+         << right << setw(10) << fixed << setprecision(3) << seconds * 1e3 << " ms"
+         << setw(12) << setprecision(2) << (bytes / seconds) / 1e9 << " GB/s" << endl;
+}
+
+// BGRA to BGR repack as done before the conversion kernels (one push_back per byte, no reserve)
+vector<char> legacyRepack(const string& data)
+{
+    const char* image_buffer = data.c_str();
+    std::vector<char> bgr_buffer;
+    for (long j = 0; j < (long)data.size(); j += 4)
+    {
+      bgr_buffer.push_back(image_buffer[j]);
+      bgr_buffer.push_back(image_buffer[j + 1]);
+      bgr_buffer.push_back(image_buffer[j + 2]);
+    }
+    return bgr_buffer;
+}
+
+bool benchmarkImageConversion(int width, int height, int iterations)
+{
+    const size_t nbPixels = static_cast<size_t>(width) * height;
+    const size_t srcBytes = 4 * nbPixels;
+
+    cout << "BGRA32 -> BGR24 repack (" << width << "x" << height << ", "
+         << iterations << " iterations, throughput on source bytes)" << endl;
+
+    // Same container as the payload of a gRPC Image message
+    string src(srcBytes, '\0');
+    std::mt19937 rng(42);
+    for (auto& c : src)
+        c = static_cast<char>(rng());
+
+    vector<uint8_t> reference(3 * nbPixels);
+    imageconversion::packBGRA32ToBGR24Scalar(reinterpret_cast<const uint8_t*>(src.data()),
+                                             reference.data(), nbPixels);
+
+    double legacy = measure(iterations, [&]() {
+        vector<char> bgr = legacyRepack(src);
+        if (bgr.size() != reference.size())
+            std::abort();
+    });
+    printResult("legacy push_back loop", legacy, srcBytes);
+
+    bool ok = true;
+    vector<uint8_t> dst(3 * nbPixels);
+    for (auto kernel : { imageconversion::Kernel::SCALAR,
+                         imageconversion::Kernel::SSSE3,
+                         imageconversion::Kernel::AVX2 }) {
+        if (imageconversion::forceKernel(kernel) != kernel) {
+            cout << "  " << imageconversion::to_string(kernel) << ": not supported by this CPU" << endl;
+            continue;
+        }
+
+        std::fill(dst.begin(), dst.end(), 0);
+        double seconds = measure(iterations, [&]() {
+            imageconversion::packBGRA32ToBGR24(reinterpret_cast<const uint8_t*>(src.data()),
+                                               dst.data(), nbPixels);
+        });
+
+        bool same = (std::memcmp(dst.data(), reference.data(), dst.size()) == 0);
+        ok = ok && same;
+        printResult(string(imageconversion::to_string(kernel)) + " kernel"
+                    + (same ? "" : " (MISMATCH)"), seconds, srcBytes);
+        cout << "    speed-up vs legacy: " << setprecision(1) << legacy / seconds << "x" << endl;
+    }
+
+    imageconversion::forceKernel(imageconversion::bestKernel());
+    return ok;
+}
+
+bool benchmarkGreyConversion(int width, int height, int iterations)
+{
+    const size_t nbPixels = static_cast<size_t>(width) * height;
+    const size_t srcBytes = 4 * nbPixels;
+
+    cout << "BGRA32 -> GREY8 fused unpack (" << width << "x" << height << ", "
+         << iterations << " iterations, throughput on source bytes)" << endl;
+    cout << "  bytes forwarded per image: " << 3 * nbPixels << " (BGR24) -> " << nbPixels << " (GREY8)" << endl;
+
+    string src(srcBytes, '\0');
+    std::mt19937 rng(42);
+    for (auto& c : src)
+        c = static_cast<char>(rng());
+
+    vector<uint8_t> reference(nbPixels);
+    imageconversion::convertBGRA32ToGrey8Scalar(reinterpret_cast<const uint8_t*>(src.data()),
+                                                reference.data(), nbPixels);
+
+    bool ok = true;
+    vector<uint8_t> bgr(3 * nbPixels);
+    vector<uint8_t> dst(nbPixels);
+    for (auto kernel : { imageconversion::Kernel::SCALAR,
+                         imageconversion::Kernel::SSSE3,
+                         imageconversion::Kernel::AVX2 }) {
+        if (imageconversion::forceKernel(kernel) != kernel) {
+            cout << "  " << imageconversion::to_string(kernel) << ": not supported by this CPU" << endl;
+            continue;
+        }
+
+        double repack = measure(iterations, [&]() {
+            imageconversion::packBGRA32ToBGR24(reinterpret_cast<const uint8_t*>(src.data()),
+                                               bgr.data(), nbPixels);
+        });
+
+        std::fill(dst.begin(), dst.end(), 0);
+        double seconds = measure(iterations, [&]() {
+            imageconversion::convertBGRA32ToGrey8(reinterpret_cast<const uint8_t*>(src.data()),
+                                                  dst.data(), nbPixels);
+        });
+
+        bool same = (std::memcmp(dst.data(), reference.data(), dst.size()) == 0);
+        ok = ok && same;
+        printResult(string(imageconversion::to_string(kernel)) + " BGR24 repack", repack, srcBytes);
+        printResult(string(imageconversion::to_string(kernel)) + " GREY8 kernel"
+                    + (same ? "" : " (MISMATCH)"), seconds, srcBytes);
+    }
+
+    imageconversion::forceKernel(imageconversion::bestKernel());
+    return ok;
+}
+
+// In place 180 degrees rotation of a BGR24 image: second pass done after the repack before the fused kernels
+void flipBGR24(uint8_t* data, size_t nbPixels)
+{
+    for (size_t i = 0, j = nbPixels - 1; i < j; i++, j--) {
+        std::swap(data[3 * i], data[3 * j]);
+        std::swap(data[3 * i + 1], data[3 * j + 1]);
+        std::swap(data[3 * i + 2], data[3 * j + 2]);
+    }
+}
+
+bool benchmarkRotation(int width, int height, int iterations)
+{
+    const size_t nbPixels = static_cast<size_t>(width) * height;
+    const size_t srcBytes = 4 * nbPixels;
+
+    cout << "BGRA32 -> BGR24 repack + 180 degrees rotation (" << width << "x" << height << ", "
+         << iterations << " iterations, throughput on source bytes)" << endl;
+
+    string src(srcBytes, '\0');
+    std::mt19937 rng(42);
+    for (auto& c : src)
+        c = static_cast<char>(rng());
+    const uint8_t* in = reinterpret_cast<const uint8_t*>(src.data());
+
+    vector<uint8_t> reference(3 * nbPixels);
+    imageconversion::packBGRA32ToBGR24Scalar(in, reference.data(), nbPixels);
+    flipBGR24(reference.data(), nbPixels);
+
+    bool ok = true;
+    vector<uint8_t> dst(3 * nbPixels);
+    for (auto kernel : { imageconversion::Kernel::SCALAR,
+                         imageconversion::Kernel::SSSE3,
+                         imageconversion::Kernel::AVX2 }) {
+        if (imageconversion::forceKernel(kernel) != kernel)
+            continue;
+
+        double twoPasses = measure(iterations, [&]() {
+            imageconversion::packBGRA32ToBGR24(in, dst.data(), nbPixels);
+            flipBGR24(dst.data(), nbPixels);
+        });
+
+        std::fill(dst.begin(), dst.end(), 0);
+        double fused = measure(iterations, [&]() {
+            imageconversion::packBGRA32ToBGR24Rotate180(in, dst.data(), nbPixels);
+        });
+
+        bool same = (dst == reference);
+        ok = ok && same;
+        printResult(string(imageconversion::to_string(kernel)) + " repack + flip pass", twoPasses, srcBytes);
+        printResult(string(imageconversion::to_string(kernel)) + " fused kernel"
+                    + (same ? "" : " (MISMATCH)"), fused, srcBytes);
+    }
+
+    imageconversion::forceKernel(imageconversion::bestKernel());
+    return ok;
+}
+
+bool benchmarkDownscale(int width, int height, int iterations)
+{
+    cout << "Box filter downscale by 2 (" << width << "x" << height << ", "
+         << iterations << " iterations, throughput on source bytes)" << endl;
+
+    bool ok = true;
+    std::mt19937 rng(42);
+    for (uint32_t nbChannels : { 1u, 3u }) {
+        const size_t srcBytes = static_cast<size_t>(width) * height * nbChannels;
+        vector<uint8_t> src(srcBytes);
+        for (auto& c : src)
+            c = static_cast<uint8_t>(rng());
+
+        const size_t dstBytes = static_cast<size_t>(width / 2) * (height / 2) * nbChannels;
+        vector<uint8_t> reference(dstBytes);
+        imageconversion::downscaleBox8Scalar(src.data(), reference.data(), width, height, nbChannels, 2);
+
+        vector<uint8_t> dst(dstBytes);
+        for (auto kernel : { imageconversion::Kernel::SCALAR,
+                             imageconversion::Kernel::SSSE3,
+                             imageconversion::Kernel::AVX2 }) {
+            if (imageconversion::forceKernel(kernel) != kernel)
+                continue;
+
+            std::fill(dst.begin(), dst.end(), 0);
+            double seconds = measure(iterations, [&]() {
+                imageconversion::downscaleBox8(src.data(), dst.data(), width, height, nbChannels, 2);
+            });
+
+            bool same = (dst == reference);
+            ok = ok && same;
+            printResult(string(nbChannels == 1 ? "GREY8 " : "BGR24 ") + imageconversion::to_string(kernel)
+                        + (same ? "" : " (MISMATCH)"), seconds, srcBytes);
+        }
+    }
+
+    imageconversion::forceKernel(imageconversion::bestKernel());
+    return ok;
+}
+
+// Serialized stereo Frames request, as sent by a HoloLens client
+string buildSerializedFrames(int width, int height)
+{
+    Frames frames;
+    frames.set_client_uuid("3f2504e0-4f89-11d3-9a0c-0305e82c3301");
+    for (int sensor = 0; sensor < 2; sensor++) {
+        Frame* frame = frames.add_frames();
+        frame->set_sensor_id(sensor);
+        frame->set_timestamp(1650000000000 + sensor);
+        frame->mutable_image()->set_width(width);
+        frame->mutable_image()->set_height(height);
+        frame->mutable_image()->set_layout(ImageLayout::GREY_8);
+        frame->mutable_image()->set_imagecompression(ImageCompression::NONE);
+        frame->mutable_image()->set_data(string(static_cast<size_t>(width) * height, '\x7f'));
+        frame->mutable_pose()->set_m11(1.f);
+        frame->mutable_pose()->set_m22(1.f);
+        frame->mutable_pose()->set_m33(1.f);
+        frame->mutable_pose()->set_m44(1.f);
+    }
+    return frames.SerializeAsString();
+}
+
+// Parse a request and fill a result as the proxy does for each RelocalizeAndMap call
+void handleRequest(const string& serialized, Frames* request, RelocalizationResult* response)
+{
+    if (!request->ParseFromString(serialized))
+        std::abort();
+    response->set_confidence(1.f);
+    response->set_pose_status(RelocalizationPoseStatus::NEW_POSE);
+    response->mutable_pose()->set_m44(request->frames(0).pose().m44());
+}
+
+struct CallStats
+{
+    double allocationsPerCall;
+    double p50Us;
+    double p99Us;
+};
+
+// Run the calls on several threads (one per simulated client)
+CallStats runCalls(const string& serialized, int nbClients, int iterations, bool useArena)
+{
+    std::vector<std::vector<double>> latencies(nbClients);
+    size_t allocationsBefore = gNbAllocations.load();
+
+    std::vector<std::thread> clients;
+    for (int c = 0; c < nbClients; c++) {
+        clients.emplace_back([&, c]() {
+            std::vector<char> initialBlock(ARENA_BENCH_INITIAL_BLOCK_SIZE);
+            latencies[c].reserve(iterations);
+            for (int i = 0; i < iterations; i++) {
+                auto start = std::chrono::steady_clock::now();
+                if (useArena) {
+                    google::protobuf::ArenaOptions options;
+                    options.initial_block = initialBlock.data();
+                    options.initial_block_size = initialBlock.size();
+                    google::protobuf::Arena arena(options);
+                    handleRequest(serialized,
+                                  google::protobuf::Arena::CreateMessage<Frames>(&arena),
+                                  google::protobuf::Arena::CreateMessage<RelocalizationResult>(&arena));
+                }
+                else {
+                    std::unique_ptr<Frames> request(new Frames());
+                    std::unique_ptr<RelocalizationResult> response(new RelocalizationResult());
+                    handleRequest(serialized, request.get(), response.get());
+                }
+                auto end = std::chrono::steady_clock::now();
+                latencies[c].push_back(std::chrono::duration<double, std::micro>(end - start).count());
+            }
+        });
+    }
+    for (auto& client : clients)
+        client.join();
+
+    // Allocations of the latency vectors are made before the measure (reserve)
+    size_t allocations = gNbAllocations.load() - allocationsBefore;
+
+    std::vector<double> all;
+    for (auto& l : latencies)
+        all.insert(all.end(), l.begin(), l.end());
+    std::sort(all.begin(), all.end());
+
+    CallStats stats;
+    stats.allocationsPerCall = static_cast<double>(allocations) / (static_cast<double>(nbClients) * iterations);
+    stats.p50Us = all[all.size() / 2];
+    stats.p99Us = all[std::min(all.size() - 1, all.size() * 99 / 100)];
+    return stats;
+}
+
+bool benchmarkArenaAllocation(int width, int height, int iterations, int nbClients)
+{
+    cout << "Frames request allocation: heap vs per-call arena (stereo GREY_8 " << width << "x" << height
+         << ", " << nbClients << " clients, " << iterations << " calls per client)" << endl;
+
+    string serialized = buildSerializedFrames(width, height);
+
+    for (bool useArena : { false, true }) {
+        // Warm up
+        runCalls(serialized, 1, 2, useArena);
+        CallStats stats = runCalls(serialized, nbClients, iterations, useArena);
+        cout << "  " << left << setw(12) << (useArena ? "arena" : "heap")
+             << right << fixed << setprecision(1)
+             << setw(8) << stats.allocationsPerCall << " allocations/call"
+             << setw(10) << stats.p50Us << " us p50"
+             << setw(10) << stats.p99Us << " us p99" << endl;
+    }
+
+    return true;
+}
+
+// Pose written field by field, as with version 1 of the API (row major accessors)
+void toMatrix4x4(const SolAR::datastructure::Transform3Df& pose, Matrix4x4& gRpcPose)
+{
+    gRpcPose.set_m11(pose(0,0)); gRpcPose.set_m12(pose(0,1)); gRpcPose.set_m13(pose(0,2)); gRpcPose.set_m14(pose(0,3));
+    gRpcPose.set_m21(pose(1,0)); gRpcPose.set_m22(pose(1,1)); gRpcPose.set_m23(pose(1,2)); gRpcPose.set_m24(pose(1,3));
+    gRpcPose.set_m31(pose(2,0)); gRpcPose.set_m32(pose(2,1)); gRpcPose.set_m33(pose(2,2)); gRpcPose.set_m34(pose(2,3));
+    gRpcPose.set_m41(pose(3,0)); gRpcPose.set_m42(pose(3,1)); gRpcPose.set_m43(pose(3,2)); gRpcPose.set_m44(pose(3,3));
+}
+
+void fromMatrix4x4(const Matrix4x4& gRpcPose, SolAR::datastructure::Transform3Df& pose)
+{
+    pose(0,0) = gRpcPose.m11(); pose(0,1) = gRpcPose.m12(); pose(0,2) = gRpcPose.m13(); pose(0,3) = gRpcPose.m14();
+    pose(1,0) = gRpcPose.m21(); pose(1,1) = gRpcPose.m22(); pose(1,2) = gRpcPose.m23(); pose(1,3) = gRpcPose.m24();
+    pose(2,0) = gRpcPose.m31(); pose(2,1) = gRpcPose.m32(); pose(2,2) = gRpcPose.m33(); pose(2,3) = gRpcPose.m34();
+    pose(3,0) = gRpcPose.m41(); pose(3,1) = gRpcPose.m42(); pose(3,2) = gRpcPose.m43(); pose(3,3) = gRpcPose.m44();
+}
+
+// Pose packed in column major order, as with version 2 of the API (one copy each way)
+void toPacked(const SolAR::datastructure::Transform3Df& pose, google::protobuf::RepeatedField<float>& gRpcPose)
+{
+    gRpcPose.Resize(16, 0.f);
+    std::copy(pose.data(), pose.data() + 16, gRpcPose.mutable_data());
+}
+
+void fromPacked(const google::protobuf::RepeatedField<float>& gRpcPose, SolAR::datastructure::Transform3Df& pose)
+{
+    pose.matrix() = Eigen::Map<const Eigen::Matrix4f>(gRpcPose.data());
+}
+
+// Result of a call for each API version: pose written, message serialized, parsed and pose read back
+bool benchmarkPoseMessages(int iterations)
+{
+    const int nbResults = 1000;
+
+    cout << "RelocalizationResult round trip: v1 Matrix4x4 vs v2 packed column major ("
+         << nbResults << " results, " << iterations << " iterations)" << endl;
+
+    SolAR::datastructure::Transform3Df pose = SolAR::datastructure::Transform3Df::Identity();
+    pose.translate(Eigen::Vector3f(0.1f, -0.2f, 1.5f));
+    pose.rotate(Eigen::AngleAxisf(0.3f, Eigen::Vector3f::UnitY()));
+
+    bool ok = true;
+    string serialized;
+    SolAR::datastructure::Transform3Df readPose;
+
+    RelocalizationResult v1Result, v1Parsed;
+    double v1 = measure(iterations, [&]() {
+        for (int i = 0; i < nbResults; i++) {
+            v1Result.set_timestamp(i);
+            v1Result.set_confidence(1.f);
+            v1Result.set_pose_status(RelocalizationPoseStatus::NEW_POSE);
+            toMatrix4x4(pose, *v1Result.mutable_pose());
+            v1Result.SerializeToString(&serialized);
+            v1Parsed.ParseFromString(serialized);
+            fromMatrix4x4(v1Parsed.pose(), readPose);
+        }
+    });
+    size_t v1Size = serialized.size();
+    ok = readPose.isApprox(pose) && ok;
+
+    v2::RelocalizationResult v2Result, v2Parsed;
+    double v2 = measure(iterations, [&]() {
+        for (int i = 0; i < nbResults; i++) {
+            v2Result.set_timestamp(i);
+            v2Result.set_confidence(1.f);
+            v2Result.set_pose_status(RelocalizationPoseStatus::NEW_POSE);
+            toPacked(pose, *v2Result.mutable_pose());
+            v2Result.SerializeToString(&serialized);
+            v2Parsed.ParseFromString(serialized);
+            fromPacked(v2Parsed.pose(), readPose);
+        }
+    });
+    size_t v2Size = serialized.size();
+    ok = readPose.isApprox(pose) && ok;
+
+    for (const auto& [name, seconds, size] : {std::make_tuple("v1 (Matrix4x4)", v1, v1Size),
+                                              std::make_tuple("v2 (packed)", v2, v2Size)}) {
+        cout << "  " << left << setw(16) << name
+             << right << fixed << setprecision(1)
+             << setw(10) << seconds * 1e9 / nbResults << " ns/result"
+             << setw(8) << size << " bytes" << endl;
+    }
+
+    if (!ok)
+        cerr << "  Pose read back differs from the pose written" << endl;
+
+    return ok;
+}
+
+// Reorder buffer entry, as stored by the proxy before the ordered ring
+typedef std::tuple<std::vector<SRef<SolAR::datastructure::Image>>,
+                   std::vector<SolAR::datastructure::Transform3Df>, long> LegacyReorderEntry;
+
+// Comparison used with the legacy reorder buffer (tuples taken by value)
+bool legacySortByThird(const LegacyReorderEntry a, const LegacyReorderEntry b)
+{
+    return (std::get<2>(a) < std::get<2>(b));
+}
+
+// Same layout as the proxy DecodedFrames (shared, read only)
+struct BenchDecodedFrames
+{
+    BenchDecodedFrames(std::vector<SRef<SolAR::datastructure::Image>>&& images,
+                       std::vector<SolAR::datastructure::Transform3Df>&& poses,
+                       long timestamp)
+        : images{std::move(images)}, poses{std::move(poses)}, timestamp{timestamp}
+    {}
+
+    const std::vector<SRef<SolAR::datastructure::Image>> images;
+    const std::vector<SolAR::datastructure::Transform3Df> poses;
+    const long timestamp;
+};
+
+// 30 fps timestamps, with some frames arriving late (swapped with a neighbour)
+vector<long> buildArrivalTimestamps(size_t nbFrames)
+{
+    vector<long> timestamps(nbFrames);
+    for (size_t i = 0; i < nbFrames; i++)
+        timestamps[i] = 1650000000000 + 33 * static_cast<long>(i);
+
+    std::mt19937 rng(42);
+    for (size_t i = 0; i + 3 < nbFrames; i++) {
+        if (rng() % 10 == 0)
+            std::swap(timestamps[i], timestamps[i + 1 + rng() % 3]);
+    }
+    return timestamps;
+}
+
+bool benchmarkReorderBuffer(int iterations)
+{
+    const size_t nbFrames = 1000;
+
+    cout << "Reorder buffer: vector + sort vs timestamp-ordered ring (stereo frames, "
+         << nbFrames << " frames, 10% late, " << iterations << " iterations, cost per frame)" << endl;
+
+    vector<long> timestamps = buildArrivalTimestamps(nbFrames);
+    // Images are shared by all the frames: only references go through the buffer
+    std::vector<SRef<SolAR::datastructure::Image>> images;
+    for (int sensor = 0; sensor < 2; sensor++)
+        images.push_back(org::bcom::xpcf::utils::make_shared<SolAR::datastructure::Image>(
+                             640, 480,
+                             SolAR::datastructure::Image::ImageLayout::LAYOUT_GREY,
+                             SolAR::datastructure::Image::PixelOrder::INTERLEAVED,
+                             SolAR::datastructure::Image::DataType::TYPE_8U));
+    std::vector<SolAR::datastructure::Transform3Df> poses(2, SolAR::datastructure::Transform3Df::Identity());
+
+    bool ok = true;
+    for (size_t depth : { 5, 10, 30 }) {
+        vector<long> legacyOrder, ringOrder;
+        legacyOrder.reserve(nbFrames);
+        ringOrder.reserve(nbFrames);
+
+        size_t allocationsBefore = gNbAllocations.load();
+        double legacy = measure(iterations, [&]() {
+            std::vector<LegacyReorderEntry> buffer;
+            legacyOrder.clear();
+            for (long timestamp : timestamps) {
+                std::vector<SRef<SolAR::datastructure::Image>> frameImages(images);
+                std::vector<SolAR::datastructure::Transform3Df> framePoses(poses);
+                buffer.push_back(std::make_tuple(std::move(frameImages), std::move(framePoses), timestamp));
+                if (buffer.size() >= depth) {
+                    std::sort(buffer.begin(), buffer.end(), legacySortByThird);
+                    std::vector<SRef<SolAR::datastructure::Image>> imagesToSend = std::move(std::get<0>(buffer[0]));
+                    legacyOrder.push_back(std::get<2>(buffer[0]));
+                    buffer.erase(buffer.begin());
+                }
+            }
+        });
+        double legacyAllocations = static_cast<double>(gNbAllocations.load() - allocationsBefore) / ((iterations + 1) * nbFrames);
+
+        allocationsBefore = gNbAllocations.load();
+        double ring = measure(iterations, [&]() {
+            TimestampOrderedRing<SRef<const BenchDecodedFrames>> buffer(depth);
+            ringOrder.clear();
+            for (long timestamp : timestamps) {
+                std::vector<SRef<SolAR::datastructure::Image>> frameImages(images);
+                std::vector<SolAR::datastructure::Transform3Df> framePoses(poses);
+                buffer.push(timestamp, std::make_shared<const BenchDecodedFrames>(
+                                std::move(frameImages), std::move(framePoses), timestamp));
+                if (buffer.full()) {
+                    SRef<const BenchDecodedFrames> framesToSend;
+                    long processedTimestamp;
+                    buffer.pop(processedTimestamp, framesToSend);
+                    ringOrder.push_back(processedTimestamp);
+                }
+            }
+        });
+        double ringAllocations = static_cast<double>(gNbAllocations.load() - allocationsBefore) / ((iterations + 1) * nbFrames);
+
+        bool same = (legacyOrder == ringOrder);
+        ok = ok && same;
+
+        cout << "  depth " << left << setw(4) << depth << right << fixed << setprecision(1)
+             << "vector+sort" << setw(9) << legacy * 1e9 / nbFrames << " ns" << setw(7) << legacyAllocations << " alloc"
+             << "   ring" << setw(9) << ring * 1e9 / nbFrames << " ns" << setw(7) << ringAllocations << " alloc"
+             << (same ? "" : "   (ORDER MISMATCH)") << endl;
+    }
+
+    return ok;
+}
+
+// Client map as used before the registry: one mutex for all the lookups
+struct LegacyClientMap
+{
+    std::shared_ptr<int> find(const string& clientUUID) const
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        auto it = clients.find(clientUUID);
+        return (it != clients.end()) ? it->second : nullptr;
+    }
+
+    std::map<string, std::shared_ptr<int>> clients;
+    mutable std::mutex mutex;
+};
+
+// Run lookups of random registered clients from several threads, return the mean duration of a lookup (ns)
+template <class Lookup>
+double measureLookups(int nbThreads, int nbLookups, const vector<string>& clientUUIDs, const Lookup& lookup)
+{
+    std::atomic<bool> go{false};
+    std::atomic<size_t> nbFound{0};
+    vector<std::thread> threads;
+    for (int t = 0; t < nbThreads; t++) {
+        threads.emplace_back([&, t]() {
+            std::mt19937 rng(t);
+            size_t found = 0;
+            while (!go.load())
+                std::this_thread::yield();
+            for (int i = 0; i < nbLookups; i++)
+                found += (lookup(clientUUIDs[rng() % clientUUIDs.size()]) != nullptr);
+            nbFound += found;
+        });
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    go = true;
+    for (auto& thread : threads)
+        thread.join();
+    auto end = std::chrono::steady_clock::now();
+
+    if (nbFound != static_cast<size_t>(nbThreads) * nbLookups)
+        return -1;
+    // Wall time per lookup of one thread
+    return std::chrono::duration<double, std::nano>(end - start).count() / nbLookups;
+}
+
+bool benchmarkClientRegistry(int iterations, int maxThreads)
+{
+    const int nbClients = 256;
+    const int nbLookups = iterations * 2000;
+
+    cout << "Client lookup: map + mutex vs sharded registry (" << nbClients << " clients, "
+         << nbLookups << " lookups per thread, " << std::thread::hardware_concurrency()
+         << " hardware threads, wall time per lookup)" << endl;
+
+    vector<string> clientUUIDs;
+    LegacyClientMap legacy;
+    ClientRegistry<int> registry;
+    for (int i = 0; i < nbClients; i++) {
+        // Same length as the UUIDs given by the front end
+        char uuid[37];
+        snprintf(uuid, sizeof(uuid), "%08x-%04x-%04x-%04x-%012x", i * 2654435761u, i, i, i, i);
+        clientUUIDs.push_back(uuid);
+        legacy.clients[uuid] = std::make_shared<int>(i);
+        registry.insert(uuid, std::make_shared<int>(i));
+    }
+
+    bool ok = true;
+    for (int nbThreads = 1; nbThreads <= maxThreads; nbThreads *= 2) {
+        double legacyNs = measureLookups(nbThreads, nbLookups, clientUUIDs,
+                                         [&](const string& uuid) { return legacy.find(uuid); });
+        double registryNs = measureLookups(nbThreads, nbLookups, clientUUIDs,
+                                           [&](const string& uuid) { return registry.find(uuid); });
+        ok = ok && (legacyNs > 0) && (registryNs > 0);
+
+        cout << "  " << left << setw(3) << nbThreads << " threads" << right
+             << "  map+mutex " << setw(8) << fixed << setprecision(1) << legacyNs << " ns"
+             << "   registry " << setw(8) << registryNs << " ns" << endl;
+    }
+
+    return ok;
+}
+
+// Record latencies from several threads, return the wall time per record of one thread (ns)
+double measureRecords(int nbThreads, int nbRecords, const std::function<void(uint64_t)>& record)
+{
+    std::atomic<bool> go{false};
+    vector<std::thread> threads;
+    for (int t = 0; t < nbThreads; t++) {
+        threads.emplace_back([&, t]() {
+            std::mt19937 rng(t);
+            std::lognormal_distribution<double> latencyUs(8., 1.);
+            vector<uint64_t> latencies(1024);
+            for (uint64_t& latency : latencies)
+                latency = static_cast<uint64_t>(latencyUs(rng));
+            while (!go.load())
+                std::this_thread::yield();
+            for (int i = 0; i < nbRecords; i++)
+                record(latencies[i % latencies.size()]);
+        });
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    go = true;
+    for (auto& thread : threads)
+        thread.join();
+    auto end = std::chrono::steady_clock::now();
+
+    return std::chrono::duration<double, std::nano>(end - start).count() / nbRecords;
+}
+
+bool benchmarkLatencyHistogram(int iterations, int maxThreads)
+{
+    const int nbRecords = iterations * 2000;
+
+    cout << "Latency record: vector + mutex vs lock free histogram (" << nbRecords << " records per thread, "
+         << std::thread::hardware_concurrency() << " hardware threads, wall time per record)" << endl;
+
+    bool ok = true;
+    for (int nbThreads = 1; nbThreads <= maxThreads; nbThreads *= 2) {
+        // Exact percentiles: all the latencies kept
+        std::mutex mutex;
+        vector<uint64_t> latencies;
+        latencies.reserve(static_cast<size_t>(nbThreads) * nbRecords);
+        double vectorNs = measureRecords(nbThreads, nbRecords, [&](uint64_t latencyUs) {
+            std::unique_lock<std::mutex> lock(mutex);
+            latencies.push_back(latencyUs);
+        });
+
+        LatencyHistogram histogram;
+        double histogramNs = measureRecords(nbThreads, nbRecords, [&](uint64_t latencyUs) {
+            histogram.record(latencyUs);
+        });
+
+        // Same latencies recorded: the histogram percentile is the exact one, to the bucket precision
+        std::sort(latencies.begin(), latencies.end());
+        uint64_t exactP99 = latencies[static_cast<size_t>(std::ceil(0.99 * latencies.size())) - 1];
+        LatencySummary summary = histogram.summary();
+        ok = ok && (summary.count == latencies.size())
+             && (summary.p99Us >= exactP99) && (summary.p99Us <= exactP99 + exactP99 / 16 + 1);
+
+        cout << "  " << left << setw(3) << nbThreads << " threads" << right
+             << "  vector+mutex " << setw(8) << fixed << setprecision(1) << vectorNs << " ns"
+             << "   histogram " << setw(8) << histogramNs << " ns"
+             << "   p99 " << setw(8) << summary.p99Us << " us (exact " << exactP99 << " us)" << endl;
+    }
+
+    if (!ok)
+        cerr << "  Histogram percentiles differ from the exact ones" << endl;
+
+    return ok;
+}
+
+// Record stereo frames (same image data for each frame) and return the duration of the recording in seconds
+double recordFrames(const string& path, int nbFrames, const vector<char>& imageData, ImageCompression compression)
+{
+    FrameRecordingWriter writer;
+    RecordingCamera camera = {};
+    if (!writer.open(path, "benchmark", {camera}))
+        return -1;
+
+    auto start = std::chrono::steady_clock::now();
+    vector<RecordingImage> images(2);
+    for (int i = 0; i < nbFrames; i++) {
+        for (uint32_t sensor = 0; sensor < 2; sensor++) {
+            images[sensor] = RecordingImage{};
+            images[sensor].header.sensorId = sensor;
+            images[sensor].header.compression = static_cast<uint8_t>(compression);
+            images[sensor].header.dataSize = imageData.size();
+            images[sensor].data = imageData.data();
+        }
+        if (!writer.writeFrame(i * 16, images))
+            return -1;
+    }
+    if (!writer.close())
+        return -1;
+    auto end = std::chrono::steady_clock::now();
+
+    return std::chrono::duration<double>(end - start).count();
+}
+
+bool benchmarkRecording(int width, int height, int iterations, int nbClients)
+{
+    const int nbFrames = iterations * 10;
+    const string path = (std::filesystem::temp_directory_path() / ("benchmark" RECORDING_FILE_EXTENSION)).string();
+
+    cout << "Frame recording: stereo frames, " << nbFrames << " frames (page cache, "
+         << nbClients << " clients at 60 fps = " << nbClients * 60 << " frames/s)" << endl;
+
+    // Raw BGRA images, and JPEG sized images (about 1/10 of the RGB size)
+    std::mt19937 random(42);
+    vector<char> rawData(static_cast<size_t>(width) * height * 4);
+    for (auto& value : rawData)
+        value = static_cast<char>(random());
+    vector<char> jpegData(rawData.begin(), rawData.begin() + static_cast<size_t>(width) * height * 3 / 10);
+
+    bool ok = true;
+    for (const auto& [name, data, compression] : {std::make_tuple("raw BGRA", &rawData, ImageCompression::NONE),
+                                                  std::make_tuple("JPEG", &jpegData, ImageCompression::JPG)}) {
+        double seconds = recordFrames(path, nbFrames, *data, compression);
+        if (seconds <= 0) {
+            cerr << "Error while recording frames in " << path << endl;
+            ok = false;
+            continue;
+        }
+        double bytes = 2. * data->size() * nbFrames;
+        cout << "  write " << left << setw(30) << name << right
+             << setw(10) << fixed << setprecision(1) << bytes / seconds / 1e6 << " MB/s"
+             << setw(10) << setprecision(0) << nbFrames / seconds << " frames/s" << endl;
+    }
+
+    // Random access to the frames of the last recording
+    FrameRecordingReader reader;
+    if (!reader.open(path) || (reader.nbFrames() != static_cast<size_t>(nbFrames))) {
+        cerr << "Error while reading the recording " << path << endl;
+        return false;
+    }
+    std::uniform_int_distribution<size_t> frameIndex(0, reader.nbFrames() - 1);
+    RecordingFrameView view;
+    uint64_t checksum = 0;
+    double seconds = measure(iterations * 100, [&]() {
+        ok = reader.frame(frameIndex(random), view) && ok;
+        checksum += view.images[1].data[view.images[1].header->dataSize - 1];
+    });
+    cout << "  " << left << setw(36) << "random frame access (mmap)" << right
+         << setw(10) << fixed << setprecision(1) << seconds * 1e9 << " ns" << endl;
+
+    reader.close();
+    std::filesystem::remove(path);
+
+    return ok && (checksum != 1);
+}
+
+int main(int argc, char* argv[])
+{
+    cxxopts::Options option_list("SolARServiceTest_MappingAndRelocalizationProxy_Benchmark",
+                                 "SolARServiceTest_MappingAndRelocalizationProxy_Benchmark - micro-benchmarks of the mapping and relocalization proxy.\n");
+    option_list.add_options()
+            ("h,help", "display this help and exit")
+            ("v,version", "display version information and exit")
+            ("width", "image width", cxxopts::value<int>()->default_value(std::to_string(DEFAULT_WIDTH)))
+            ("height", "image height", cxxopts::value<int>()->default_value(std::to_string(DEFAULT_HEIGHT)))
+            ("i,iterations", "number of iterations per measure", cxxopts::value<int>()->default_value(std::to_string(DEFAULT_ITERATIONS)))
+            ("c,clients", "number of concurrent clients for the multi-client measures", cxxopts::value<int>()->default_value(std::to_string(DEFAULT_CLIENTS)))
+            ("t,threads", "maximum number of threads for the client lookup measure", cxxopts::value<int>()->default_value(std::to_string(DEFAULT_THREADS)));
+
+    auto options = option_list.parse(argc, argv);
+    if (options.count("help")) {
+        print_help(option_list);
+        return 0;
+    }
+
+    if (options.count("version"))
+    {
+        cout << "SolARServiceTest_MappingAndRelocalizationProxy_Benchmark version " << MYVERSION << std::endl << std::endl;
+        return 0;
+    }
+
+    int width = options["width"].as<int>();
+    int height = options["height"].as<int>();
+    int iterations = options["iterations"].as<int>();
+    int nbClients = options["clients"].as<int>();
+    int maxThreads = options["threads"].as<int>();
+
+    if ((width <= 0) || (height <= 0) || (iterations <= 0) || (nbClients <= 0) || (maxThreads <= 0)) {
+        cerr << "Width, height, iterations, clients and threads must be positive" << endl;
+        return 1;
+    }
+
+    cout << "Best conversion kernel: " << imageconversion::to_string(imageconversion::bestKernel()) << endl << endl;
+
+    bool ok = benchmarkImageConversion(width, height, iterations);
+    cout << endl;
+    ok = benchmarkGreyConversion(width, height, iterations) && ok;
+    cout << endl;
+    ok = benchmarkRotation(width, height, iterations) && ok;
+    cout << endl;
+    ok = benchmarkDownscale(width, height, iterations) && ok;
+    cout << endl;
+    ok = benchmarkArenaAllocation(width, height, iterations, nbClients) && ok;
+    cout << endl;
+    ok = benchmarkPoseMessages(iterations) && ok;
+    cout << endl;
+    ok = benchmarkReorderBuffer(iterations) && ok;
+    cout << endl;
+    ok = benchmarkClientRegistry(iterations, maxThreads) && ok;
+    cout << endl;
+    ok = benchmarkLatencyHistogram(iterations, maxThreads) && ok;
+    cout << endl;
+    ok = benchmarkRecording(width, height, iterations, nbClients) && ok;
+
+    return ok ? 0 : 1;
+}
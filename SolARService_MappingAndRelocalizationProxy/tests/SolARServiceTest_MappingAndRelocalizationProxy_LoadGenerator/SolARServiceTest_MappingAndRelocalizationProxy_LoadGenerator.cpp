@@ -0,0 +1,801 @@
+/**
+ * @copyright Copyright (c) 2021 B-com http://www.b-com.com/
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <cxxopts.hpp>
+
+#include <grpcpp/grpcpp.h>
+
+#include "grpc/solar_mapping_and_relocalization_proxy.grpc.pb.h"
+#include "FrameRecording.h"
+
+using namespace std;
+using namespace com::bcom::solar::gprc;
+
+// Default URL: local proxy on its default port
+const string DEFAULT_URL = "0.0.0.0:5010";
+const int DEFAULT_CLIENTS = 4;
+const double DEFAULT_SPEED = 1.;
+const int DEFAULT_LOOPS = 1;
+
+// Maximum size of a gRPC message (raw images)
+#define LOAD_GENERATOR_MAX_MESSAGE_SIZE (64 * 1024 * 1024)
+
+// print help options
+void print_help(const cxxopts::Options& options)
+{
+    cout << options.help({""}) << '\n';
+}
+
+// print error message
+void print_error(const string& msg)
+{
+    cerr << msg << '\n';
+}
+
+/**
+ * @class ReplaySource
+ * @brief Frames to replay, shared by all the virtual clients (read only once opened)
+ */
+class ReplaySource
+{
+    public:
+        virtual ~ReplaySource() = default;
+
+        /// @brief Camera parameters of the client (sensor 0, then sensor 1 for a stereo rig)
+        virtual const vector<RecordingCamera>& cameras() const = 0;
+
+        virtual size_t nbFrames() const = 0;
+
+        /// @brief Fill a request with the images and poses of a frame (timestamp not set)
+        virtual bool frame(size_t index, Frames& request, int64_t& timestamp) const = 0;
+};
+
+/**
+ * @class RecordingSource
+ * @brief Frames of a proxy recording (.solarrec), read in place from the mapped file
+ */
+class RecordingSource : public ReplaySource
+{
+    public:
+        bool open(const string& path)
+        {
+            if (!m_reader.open(path))
+                return false;
+
+            // Last parameters of each sensor
+            for (const auto& camera : m_reader.cameras()) {
+                if (camera.sensorId >= 2)
+                    continue;
+                if (m_cameras.size() <= camera.sensorId)
+                    m_cameras.resize(camera.sensorId + 1);
+                m_cameras[camera.sensorId] = camera;
+            }
+
+            if (m_reader.recovered())
+                cerr << "Recording " << path << " was interrupted: " << m_reader.nbFrames() << " frames recovered" << endl;
+            return m_reader.nbFrames() > 0;
+        }
+
+        const vector<RecordingCamera>& cameras() const override { return m_cameras; }
+
+        size_t nbFrames() const override { return m_reader.nbFrames(); }
+
+        bool frame(size_t index, Frames& request, int64_t& timestamp) const override
+        {
+            RecordingFrameView view;
+            if (!m_reader.frame(index, view))
+                return false;
+
+            timestamp = view.timestamp;
+            request.clear_frames();
+            for (const auto& image : view.images) {
+                Frame* frame = request.add_frames();
+                frame->set_sensor_id(static_cast<int32_t>(image.header->sensorId));
+                frame->mutable_image()->set_width(image.header->width);
+                frame->mutable_image()->set_height(image.header->height);
+                frame->mutable_image()->set_layout(static_cast<ImageLayout>(image.header->layout));
+                frame->mutable_image()->set_imagecompression(static_cast<ImageCompression>(image.header->compression));
+                frame->mutable_image()->set_data(image.data, image.header->dataSize);
+                setPose(image.header->pose, *frame->mutable_pose());
+            }
+            return true;
+        }
+
+        static void setPose(const float pose[16], Matrix4x4& gRpcPose)
+        {
+            gRpcPose.set_m11(pose[0]);  gRpcPose.set_m12(pose[1]);  gRpcPose.set_m13(pose[2]);  gRpcPose.set_m14(pose[3]);
+            gRpcPose.set_m21(pose[4]);  gRpcPose.set_m22(pose[5]);  gRpcPose.set_m23(pose[6]);  gRpcPose.set_m24(pose[7]);
+            gRpcPose.set_m31(pose[8]);  gRpcPose.set_m32(pose[9]);  gRpcPose.set_m33(pose[10]); gRpcPose.set_m34(pose[11]);
+            gRpcPose.set_m41(pose[12]); gRpcPose.set_m42(pose[13]); gRpcPose.set_m43(pose[14]); gRpcPose.set_m44(pose[15]);
+        }
+
+    private:
+        FrameRecordingReader m_reader;
+        vector<RecordingCamera> m_cameras;
+};
+
+/**
+ * @class CaptureSource
+ * @brief Frames of a HoloLens capture, loaded in memory
+ *
+ * Same layout as read by SolARDeviceDataLoader: one folder of PNG or JPEG
+ * images per camera (000, 001), one pose file per camera (pose_000.txt,
+ * pose_001.txt: 16 values per line, row major) and timestamps.txt (one
+ * timestamp in ms per line). Images are sent as stored, without decoding.
+ */
+class CaptureSource : public ReplaySource
+{
+    public:
+        bool open(const string& path, const vector<float>& intrinsics)
+        {
+            std::ifstream timestampFile(path + "/timestamps.txt");
+            int64_t timestamp;
+            while (timestampFile >> timestamp)
+                m_timestamps.push_back(timestamp);
+
+            for (uint32_t sensor = 0; sensor < 2; sensor++) {
+                char name[4];
+                snprintf(name, sizeof(name), "%03u", sensor);
+                if (!std::filesystem::is_directory(path + "/" + name))
+                    break;
+                if (!loadCamera(path + "/" + name, path + "/pose_" + name + ".txt", sensor, intrinsics))
+                    return false;
+            }
+
+            if (m_images.empty() || m_timestamps.empty())
+                return false;
+            size_t nbFrames = m_timestamps.size();
+            for (const auto& images : m_images)
+                nbFrames = std::min(nbFrames, images.size());
+            m_timestamps.resize(nbFrames);
+            return true;
+        }
+
+        const vector<RecordingCamera>& cameras() const override { return m_cameras; }
+
+        size_t nbFrames() const override { return m_timestamps.size(); }
+
+        bool frame(size_t index, Frames& request, int64_t& timestamp) const override
+        {
+            timestamp = m_timestamps[index];
+            request.clear_frames();
+            for (uint32_t sensor = 0; sensor < m_images.size(); sensor++) {
+                const CaptureImage& image = m_images[sensor][index];
+                Frame* frame = request.add_frames();
+                frame->set_sensor_id(static_cast<int32_t>(sensor));
+                frame->mutable_image()->set_width(m_cameras[sensor].width);
+                frame->mutable_image()->set_height(m_cameras[sensor].height);
+                frame->mutable_image()->set_layout(m_cameras[sensor].cameraType == GRAY ? ImageLayout::GREY_8 : ImageLayout::RGB_24);
+                frame->mutable_image()->set_imagecompression(image.compression);
+                frame->mutable_image()->set_data(image.data);
+                RecordingSource::setPose(image.pose, *frame->mutable_pose());
+            }
+            return true;
+        }
+
+    private:
+        struct CaptureImage
+        {
+            string data;
+            ImageCompression compression;
+            float pose[16];
+        };
+
+        bool loadCamera(const string& imageFolder, const string& poseFile, uint32_t sensor, const vector<float>& intrinsics)
+        {
+            vector<std::filesystem::path> files;
+            for (const auto& entry : std::filesystem::directory_iterator(imageFolder))
+                if (entry.is_regular_file())
+                    files.push_back(entry.path());
+            std::sort(files.begin(), files.end());
+
+            std::ifstream poses(poseFile);
+            vector<CaptureImage> images;
+            for (const auto& file : files) {
+                string extension = file.extension().string();
+                std::transform(extension.begin(), extension.end(), extension.begin(), ::tolower);
+                CaptureImage image;
+                if (extension == ".png")
+                    image.compression = ImageCompression::PNG;
+                else if ((extension == ".jpg") || (extension == ".jpeg"))
+                    image.compression = ImageCompression::JPG;
+                else
+                    continue;
+
+                std::ifstream imageFile(file, std::ios::binary);
+                image.data.assign(std::istreambuf_iterator<char>(imageFile), std::istreambuf_iterator<char>());
+                for (float& value : image.pose)
+                    if (!(poses >> value))
+                        value = 0.f;
+                images.push_back(std::move(image));
+            }
+
+            if (images.empty())
+                return false;
+
+            RecordingCamera camera = {};
+            camera.sensorId = sensor;
+            if (!imageSize(images[0], camera.width, camera.height, camera.cameraType)) {
+                print_error("Unsupported image: " + files[0].string());
+                return false;
+            }
+            // Pinhole model (no distortion): given intrinsics, or default focal length and centered principal point
+            float fx = intrinsics.size() == 4 ? intrinsics[0] : static_cast<float>(camera.width);
+            float fy = intrinsics.size() == 4 ? intrinsics[1] : static_cast<float>(camera.width);
+            float cx = intrinsics.size() == 4 ? intrinsics[2] : camera.width / 2.f;
+            float cy = intrinsics.size() == 4 ? intrinsics[3] : camera.height / 2.f;
+            const float values[9] = { fx, 0.f, cx, 0.f, fy, cy, 0.f, 0.f, 1.f };
+            std::copy(values, values + 9, camera.intrinsics);
+            camera.rotation = DEFAULT_ROTATION;
+
+            m_cameras.push_back(camera);
+            m_images.push_back(std::move(images));
+            return true;
+        }
+
+        // Read the size and the color type of an image from its PNG or JPEG header
+        static bool imageSize(const CaptureImage& image, uint32_t& width, uint32_t& height, uint32_t& cameraType)
+        {
+            const auto* data = reinterpret_cast<const uint8_t*>(image.data.data());
+            size_t size = image.data.size();
+            auto read16 = [data](size_t offset) { return static_cast<uint32_t>((data[offset] << 8) | data[offset + 1]); };
+
+            if (image.compression == ImageCompression::PNG) {
+                // Signature, then IHDR chunk: width, height, bit depth, color type
+                if (size < 26)
+                    return false;
+                width = (read16(16) << 16) | read16(18);
+                height = (read16(20) << 16) | read16(22);
+                cameraType = ((data[25] == 0) || (data[25] == 4)) ? GRAY : RGB;
+                return true;
+            }
+
+            // JPEG: first start of frame segment (SOF0 to SOF15, except DHT, JPG and DAC)
+            size_t offset = 2;
+            while (offset + 9 < size) {
+                if (data[offset] != 0xFF)
+                    return false;
+                uint8_t marker = data[offset + 1];
+                if ((marker >= 0xC0) && (marker <= 0xCF) && (marker != 0xC4) && (marker != 0xC8) && (marker != 0xCC)) {
+                    height = read16(offset + 5);
+                    width = read16(offset + 7);
+                    cameraType = (data[offset + 9] == 1) ? GRAY : RGB;
+                    return true;
+                }
+                offset += 2 + read16(offset + 2);
+            }
+            return false;
+        }
+
+        vector<RecordingCamera> m_cameras;
+        vector<vector<CaptureImage>> m_images;      // Images of each camera
+        vector<int64_t> m_timestamps;
+};
+
+/// @brief Results of a virtual client
+struct ClientResult
+{
+    string clientUUID;
+    size_t nbFrames = 0;            // Frames sent
+    size_t nbErrors = 0;            // Frames rejected by the proxy
+    size_t nbBytes = 0;             // Image bytes sent
+    double seconds = 0;             // Duration of the replay
+    double maxLagMs = 0;            // Maximum delay of a frame on the replay schedule
+    vector<uint32_t> latenciesUs;   // RelocalizeAndMap round trip of each frame
+    size_t nbTransformUpdates = 0;  // Results received through SubscribeTransforms
+    ProxyStats proxyStats;          // Stats of the client given by the proxy (GetStats), once replayed
+    bool hasProxyStats = false;
+    string error;                   // Set if the client failed before the replay
+};
+
+void setMatrix(const float values[9], Matrix3x3& matrix)
+{
+    matrix.set_m11(values[0]); matrix.set_m12(values[1]); matrix.set_m13(values[2]);
+    matrix.set_m21(values[3]); matrix.set_m22(values[4]); matrix.set_m23(values[5]);
+    matrix.set_m31(values[6]); matrix.set_m32(values[7]); matrix.set_m33(values[8]);
+}
+
+void setDistortion(const float values[5], CameraDistortion& distortion)
+{
+    distortion.set_k_1(values[0]);
+    distortion.set_k_2(values[1]);
+    distortion.set_p_1(values[2]);
+    distortion.set_p_2(values[3]);
+    distortion.set_k_3(values[4]);
+}
+
+grpc::Status setCameraParameters(SolARMappingAndRelocalizationProxy::Stub& stub, const string& clientUUID,
+                                 const vector<RecordingCamera>& cameras)
+{
+    grpc::ClientContext context;
+    Empty response;
+
+    if (cameras.size() == 1) {
+        CameraParameters request;
+        const RecordingCamera& camera = cameras[0];
+        request.set_client_uuid(clientUUID);
+        request.set_name("camera 0");
+        request.set_id(0);
+        request.set_camera_type(static_cast<CameraType>(camera.cameraType));
+        request.set_width(camera.width);
+        request.set_height(camera.height);
+        setMatrix(camera.intrinsics, *request.mutable_intrinsics());
+        setDistortion(camera.distortion, *request.mutable_distortion());
+        request.set_rotation(static_cast<ImageRotation>(camera.rotation));
+        return stub.SetCameraParameters(&context, request, &response);
+    }
+
+    CameraParametersStereo request;
+    request.set_client_uuid(clientUUID);
+    request.set_name1("camera 0");
+    request.set_id1(0);
+    request.set_camera_type1(static_cast<CameraType>(cameras[0].cameraType));
+    request.set_width1(cameras[0].width);
+    request.set_height1(cameras[0].height);
+    setMatrix(cameras[0].intrinsics, *request.mutable_intrinsics1());
+    setDistortion(cameras[0].distortion, *request.mutable_distortion1());
+    request.set_rotation1(static_cast<ImageRotation>(cameras[0].rotation));
+    request.set_name2("camera 1");
+    request.set_id2(1);
+    request.set_camera_type2(static_cast<CameraType>(cameras[1].cameraType));
+    request.set_width2(cameras[1].width);
+    request.set_height2(cameras[1].height);
+    setMatrix(cameras[1].intrinsics, *request.mutable_intrinsics2());
+    setDistortion(cameras[1].distortion, *request.mutable_distortion2());
+    request.set_rotation2(static_cast<ImageRotation>(cameras[1].rotation));
+    return stub.SetCameraParametersStereo(&context, request, &response);
+}
+
+/**
+ * Replay the source as one client: register, set the camera parameters, start,
+ * send all the frames (on the replay schedule), stop, get its stats and unregister.
+ * Frames are sent one at a time, as the front end clients do: a frame late on
+ * the schedule is sent as soon as the previous one is answered. With batches,
+ * frames are sent by RelocalizeAndMapBatch once the last one of a batch is due
+ * (backlog of a device after a network stall).
+ * Each client has its own channel (own connection, as separate devices).
+ */
+void runClient(const string& url, const ReplaySource& source, PipelineMode mode, double speed, int loops,
+               int batchSize, bool subscribe, std::chrono::steady_clock::time_point startTime, ClientResult& result)
+{
+    grpc::ChannelArguments arguments;
+    arguments.SetMaxSendMessageSize(LOAD_GENERATOR_MAX_MESSAGE_SIZE);
+    arguments.SetMaxReceiveMessageSize(LOAD_GENERATOR_MAX_MESSAGE_SIZE);
+    // No connection shared between the clients
+    arguments.SetInt(GRPC_ARG_USE_LOCAL_SUBCHANNEL_POOL, 1);
+    auto stub = SolARMappingAndRelocalizationProxy::NewStub(
+                grpc::CreateCustomChannel(url, grpc::InsecureChannelCredentials(), arguments));
+
+    {
+        grpc::ClientContext context;
+        Empty request;
+        ClientUUID response;
+        auto status = stub->RegisterClient(&context, request, &response);
+        if (!status.ok()) {
+            result.error = "RegisterClient: " + status.error_message();
+            return;
+        }
+        result.clientUUID = response.client_uuid();
+    }
+
+    grpc::Status status;
+    {
+        grpc::ClientContext context;
+        PipelineModeValue request;
+        Empty response;
+        request.set_client_uuid(result.clientUUID);
+        request.set_pipeline_mode(mode);
+        status = stub->Init(&context, request, &response);
+        if (!status.ok())
+            result.error = "Init: " + status.error_message();
+    }
+
+    if (status.ok()) {
+        status = setCameraParameters(*stub, result.clientUUID, source.cameras());
+        if (!status.ok())
+            result.error = "SetCameraParameters: " + status.error_message();
+    }
+
+    ClientUUID clientUUID;
+    clientUUID.set_client_uuid(result.clientUUID);
+
+    if (status.ok()) {
+        grpc::ClientContext context;
+        Empty response;
+        status = stub->Start(&context, clientUUID, &response);
+        if (!status.ok())
+            result.error = "Start: " + status.error_message();
+    }
+
+    // Subscription to the results of the client, ended by UnregisterClient
+    grpc::ClientContext subscriptionContext;
+    std::thread subscriber;
+    if (status.ok() && subscribe) {
+        subscriber = std::thread([&stub, &subscriptionContext, &clientUUID, &result]() {
+            auto reader = stub->SubscribeTransforms(&subscriptionContext, clientUUID);
+            RelocalizationResult update;
+            while (reader->Read(&update))
+                result.nbTransformUpdates++;
+            reader->Finish();
+        });
+    }
+
+    if (status.ok()) {
+        // Timestamps of the next loop follow the last frame of the previous loop
+        int64_t firstTimestamp = 0, lastTimestamp = 0;
+        Frames request;
+        source.frame(0, request, firstTimestamp);
+        source.frame(source.nbFrames() - 1, request, lastTimestamp);
+        int64_t loopDuration = std::max<int64_t>(1, lastTimestamp - firstTimestamp
+                                                 + (lastTimestamp - firstTimestamp) / std::max<int64_t>(1, source.nbFrames() - 1));
+
+        std::this_thread::sleep_until(startTime);
+        auto replayStart = std::chrono::steady_clock::now();
+        request.set_client_uuid(result.clientUUID);
+        result.latenciesUs.reserve(source.nbFrames() * loops);
+
+        // Latency of a batch: round trip of the RelocalizeAndMapBatch call
+        FramesBatch batch;
+        batch.set_client_uuid(result.clientUUID);
+        batch.set_last_result_only(true);
+        auto sendBatch = [&stub, &batch, &result](std::chrono::steady_clock::time_point start) {
+            grpc::ClientContext context;
+            RelocalizationResults response;
+            auto batchStatus = stub->RelocalizeAndMapBatch(&context, batch, &response);
+            auto end = std::chrono::steady_clock::now();
+
+            result.nbFrames += batch.frames_size();
+            if (!batchStatus.ok())
+                result.nbErrors += batch.frames_size();
+            result.latenciesUs.push_back(static_cast<uint32_t>(
+                                             std::chrono::duration_cast<std::chrono::microseconds>(end - start).count()));
+            batch.clear_frames();
+        };
+
+        for (int loop = 0; loop < loops; loop++) {
+            for (size_t index = 0; index < source.nbFrames(); index++) {
+                int64_t timestamp;
+                if (!source.frame(index, request, timestamp))
+                    continue;
+                timestamp += loop * loopDuration;
+                for (auto& frame : *request.mutable_frames()) {
+                    frame.set_timestamp(static_cast<uint64_t>(timestamp));
+                    result.nbBytes += frame.image().data().size();
+                }
+
+                auto now = std::chrono::steady_clock::now();
+                if (speed > 0) {
+                    auto scheduled = replayStart + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                                std::chrono::duration<double, std::milli>((timestamp - firstTimestamp) / speed));
+                    if (scheduled > now) {
+                        std::this_thread::sleep_until(scheduled);
+                        now = std::chrono::steady_clock::now();
+                    }
+                    else
+                        result.maxLagMs = std::max(result.maxLagMs,
+                                                   std::chrono::duration<double, std::milli>(now - scheduled).count());
+                }
+
+                if (batchSize > 1) {
+                    *batch.add_frames() = request;
+                    if (batch.frames_size() == batchSize)
+                        sendBatch(now);
+                    continue;
+                }
+
+                grpc::ClientContext context;
+                RelocalizationResult response;
+                auto frameStatus = stub->RelocalizeAndMap(&context, request, &response);
+                auto end = std::chrono::steady_clock::now();
+
+                result.nbFrames++;
+                if (!frameStatus.ok())
+                    result.nbErrors++;
+                result.latenciesUs.push_back(static_cast<uint32_t>(
+                                                 std::chrono::duration_cast<std::chrono::microseconds>(end - now).count()));
+            }
+        }
+
+        if (batch.frames_size() > 0)
+            sendBatch(std::chrono::steady_clock::now());
+
+        result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - replayStart).count();
+
+        grpc::ClientContext context;
+        Empty response;
+        stub->Stop(&context, clientUUID, &response);
+    }
+
+    {
+        grpc::ClientContext context;
+        ProxyStatsResult response;
+        if (stub->GetStats(&context, clientUUID, &response).ok()) {
+            result.proxyStats = response.client();
+            result.hasProxyStats = true;
+        }
+    }
+
+    grpc::ClientContext context;
+    Empty response;
+    stub->UnregisterClient(&context, clientUUID, &response);
+
+    if (subscriber.joinable()) {
+        subscriptionContext.TryCancel();
+        subscriber.join();
+    }
+}
+
+// Nearest-rank percentile of sorted values
+uint32_t percentile(const vector<uint32_t>& sortedValues, double rank)
+{
+    if (sortedValues.empty())
+        return 0;
+    size_t index = static_cast<size_t>(std::ceil(rank / 100. * sortedValues.size()));
+    return sortedValues[std::min(sortedValues.size(), std::max<size_t>(1, index)) - 1];
+}
+
+// Throughput and latency (ms) of a set of frames, as JSON members
+void writeStats(ostream& out, const string& indent, size_t nbFrames, size_t nbErrors, size_t nbBytes,
+                double seconds, vector<uint32_t>& latenciesUs)
+{
+    std::sort(latenciesUs.begin(), latenciesUs.end());
+    double sum = 0;
+    for (uint32_t latency : latenciesUs)
+        sum += latency;
+
+    out << indent << "\"frames\": " << nbFrames << ",\n"
+        << indent << "\"errors\": " << nbErrors << ",\n"
+        << indent << "\"seconds\": " << fixed << setprecision(3) << seconds << ",\n"
+        << indent << "\"fps\": " << setprecision(2) << (seconds > 0 ? nbFrames / seconds : 0.) << ",\n"
+        << indent << "\"mbps\": " << (seconds > 0 ? nbBytes * 8 / seconds / 1e6 : 0.) << ",\n"
+        << indent << "\"latency_ms\": {"
+        << "\"mean\": " << setprecision(3) << (latenciesUs.empty() ? 0. : sum / latenciesUs.size() / 1e3)
+        << ", \"p50\": " << percentile(latenciesUs, 50) / 1e3
+        << ", \"p95\": " << percentile(latenciesUs, 95) / 1e3
+        << ", \"p99\": " << percentile(latenciesUs, 99) / 1e3
+        << ", \"p999\": " << percentile(latenciesUs, 99.9) / 1e3
+        << ", \"max\": " << (latenciesUs.empty() ? 0. : latenciesUs.back() / 1e3) << "}";
+}
+
+// Latency (ms) of a processing stage measured by the proxy, as a JSON object
+void writeStageLatency(ostream& out, const StageLatency& latency)
+{
+    out << "{\"count\": " << latency.count()
+        << ", \"mean\": " << fixed << setprecision(3) << latency.mean_ms()
+        << ", \"p50\": " << latency.p50_ms()
+        << ", \"p90\": " << latency.p90_ms()
+        << ", \"p99\": " << latency.p99_ms()
+        << ", \"p999\": " << latency.p999_ms()
+        << ", \"max\": " << latency.max_ms() << "}";
+}
+
+// Stats given by the proxy (GetStats), as JSON members
+void writeProxyStats(ostream& out, const string& indent, const ProxyStats& stats)
+{
+    out << indent << "\"stage_latency_ms\": {\n"
+        << indent << "  \"queue_wait\": ";
+    writeStageLatency(out, stats.queue_wait());
+    out << ",\n" << indent << "  \"decode\": ";
+    writeStageLatency(out, stats.decode());
+    out << ",\n" << indent << "  \"reorder\": ";
+    writeStageLatency(out, stats.reorder());
+    out << ",\n" << indent << "  \"front_end\": ";
+    writeStageLatency(out, stats.front_end());
+    out << ",\n" << indent << "  \"total\": ";
+    writeStageLatency(out, stats.total());
+    out << "\n" << indent << "},\n"
+        << indent << "\"requests\": " << stats.nb_requests() << ",\n"
+        << indent << "\"errors\": " << stats.nb_errors() << ",\n"
+        << indent << "\"rejected\": " << stats.nb_rejected() << ",\n"
+        << indent << "\"late_dropped\": " << stats.nb_late_dropped() << ",\n"
+        << indent << "\"shrink_dropped\": " << stats.nb_shrink_dropped() << ",\n"
+        << indent << "\"overload_dropped\": " << stats.nb_overload_dropped() << ",\n"
+        << indent << "\"latest_pose_replies\": " << stats.nb_latest_pose_replies() << ",\n"
+        << indent << "\"motion_gated\": " << stats.nb_motion_gated() << ",\n"
+        << indent << "\"duplicates\": " << stats.nb_duplicates() << ",\n"
+        << indent << "\"mode_switches\": " << stats.nb_mode_switches();
+}
+
+void writeReport(ostream& out, const string& url, const string& source, int nbClients, double speed, int loops,
+                 int batchSize, vector<ClientResult>& results, double seconds, const ProxyStats* proxyStats)
+{
+    size_t nbFrames = 0, nbErrors = 0, nbBytes = 0;
+    vector<uint32_t> latenciesUs;
+
+    out << "{\n"
+        << "  \"url\": \"" << url << "\",\n"
+        << "  \"source\": \"" << source << "\",\n"
+        << "  \"clients\": " << nbClients << ",\n"
+        << "  \"speed\": " << setprecision(2) << fixed << speed << ",\n"
+        << "  \"loops\": " << loops << ",\n"
+        << "  \"batch\": " << batchSize << ",\n"
+        << "  \"per_client\": [";
+
+    for (size_t i = 0; i < results.size(); i++) {
+        ClientResult& result = results[i];
+        out << (i == 0 ? "\n" : ",\n") << "    {\n"
+            << "      \"client_uuid\": \"" << result.clientUUID << "\",\n";
+        if (!result.error.empty())
+            out << "      \"error\": \"" << result.error << "\",\n";
+        out << "      \"max_lag_ms\": " << setprecision(3) << result.maxLagMs << ",\n"
+            << "      \"transform_updates\": " << result.nbTransformUpdates << ",\n";
+        nbFrames += result.nbFrames;
+        nbErrors += result.nbErrors;
+        nbBytes += result.nbBytes;
+        latenciesUs.insert(latenciesUs.end(), result.latenciesUs.begin(), result.latenciesUs.end());
+        writeStats(out, "      ", result.nbFrames, result.nbErrors, result.nbBytes, result.seconds, result.latenciesUs);
+        if (result.hasProxyStats) {
+            out << ",\n      \"proxy_stats\": {\n";
+            writeProxyStats(out, "        ", result.proxyStats);
+            out << ",\n        \"reorder_depth\": " << result.proxyStats.reorder_depth() << ",\n"
+                << "        \"jitter_ms\": " << setprecision(3) << result.proxyStats.jitter_ms() << ",\n"
+                << "        \"out_of_order_rate\": " << result.proxyStats.out_of_order_rate()
+                << "\n      }";
+        }
+        out << "\n    }";
+    }
+
+    out << "\n  ],\n"
+        << "  \"aggregate\": {\n";
+    writeStats(out, "    ", nbFrames, nbErrors, nbBytes, seconds, latenciesUs);
+    if (proxyStats != nullptr) {
+        out << ",\n    \"proxy_stats\": {\n";
+        writeProxyStats(out, "      ", *proxyStats);
+        out << "\n    }";
+    }
+    out << "\n  }\n"
+        << "}\n";
+}
+
+int main(int argc, char* argv[])
+{
+    cxxopts::Options option_list("SolARServiceTest_MappingAndRelocalizationProxy_LoadGenerator",
+                                 "SolARServiceTest_MappingAndRelocalizationProxy_LoadGenerator - replays a capture or a proxy recording as concurrent clients of the mapping and relocalization proxy.\n");
+    option_list.add_options()
+            ("h,help", "display this help and exit")
+            ("v,version", "display version information and exit")
+            ("u,url", "URL of the proxy gRPC service", cxxopts::value<string>()->default_value(DEFAULT_URL))
+            ("r,recording", "proxy recording to replay (" RECORDING_FILE_EXTENSION " file)", cxxopts::value<string>())
+            ("c,capture", "HoloLens capture folder to replay (000/, 001/, pose_000.txt, pose_001.txt, timestamps.txt)", cxxopts::value<string>())
+            ("intrinsics", "camera intrinsics of a capture: fx,fy,cx,cy (default: focal length = width, centered)", cxxopts::value<vector<float>>())
+            ("n,clients", "number of concurrent virtual clients", cxxopts::value<int>()->default_value(std::to_string(DEFAULT_CLIENTS)))
+            ("s,speed", "replay speed factor (1: real time, 0: as fast as possible)", cxxopts::value<double>()->default_value(std::to_string(DEFAULT_SPEED)))
+            ("l,loops", "number of replays of the frames by each client", cxxopts::value<int>()->default_value(std::to_string(DEFAULT_LOOPS)))
+            ("reloc-only", "do only relocalization (no mapping)")
+            ("b,batch", "number of frames sent at once by RelocalizeAndMapBatch (1: frames sent one at a time by RelocalizeAndMap)",
+             cxxopts::value<int>()->default_value("1"))
+            ("subscribe", "each client subscribes to its results (SubscribeTransforms) while replaying")
+            ("o,output", "JSON report file (default: standard output)", cxxopts::value<string>());
+
+    auto options = option_list.parse(argc, argv);
+    if (options.count("help")) {
+        print_help(option_list);
+        return 0;
+    }
+
+    if (options.count("version"))
+    {
+        cout << "SolARServiceTest_MappingAndRelocalizationProxy_LoadGenerator version " << MYVERSION << std::endl << std::endl;
+        return 0;
+    }
+
+    string url = options["url"].as<string>();
+    int nbClients = options["clients"].as<int>();
+    double speed = options["speed"].as<double>();
+    int loops = options["loops"].as<int>();
+    int batchSize = options["batch"].as<int>();
+    PipelineMode mode = options.count("reloc-only") ? RELOCALIZATION_ONLY : RELOCALIZATION_AND_MAPPING;
+    bool subscribe = options.count("subscribe") > 0;
+
+    if ((nbClients <= 0) || (loops <= 0) || (batchSize <= 0) || (speed < 0)) {
+        print_error("Clients, loops and batch must be positive, speed must not be negative");
+        return 1;
+    }
+
+    std::unique_ptr<ReplaySource> source;
+    string sourcePath;
+    if (options.count("recording")) {
+        sourcePath = options["recording"].as<string>();
+        auto recording = std::make_unique<RecordingSource>();
+        if (!recording->open(sourcePath)) {
+            print_error("Can not read the recording: " + sourcePath);
+            return 1;
+        }
+        source = std::move(recording);
+    }
+    else if (options.count("capture")) {
+        sourcePath = options["capture"].as<string>();
+        vector<float> intrinsics;
+        if (options.count("intrinsics"))
+            intrinsics = options["intrinsics"].as<vector<float>>();
+        if (!intrinsics.empty() && (intrinsics.size() != 4)) {
+            print_error("Intrinsics must be given as fx,fy,cx,cy");
+            return 1;
+        }
+        auto capture = std::make_unique<CaptureSource>();
+        if (!capture->open(sourcePath, intrinsics)) {
+            print_error("Can not read the capture: " + sourcePath);
+            return 1;
+        }
+        source = std::move(capture);
+    }
+    else {
+        print_error("missing recording or capture argument");
+        return 1;
+    }
+
+    if (source->cameras().empty() || (source->cameras().size() > 2)) {
+        print_error("Unexpected number of cameras: " + std::to_string(source->cameras().size()));
+        return 1;
+    }
+
+    cerr << "Replay " << source->nbFrames() << " frames (" << source->cameras().size() << " camera(s)) with "
+         << nbClients << " clients on " << url << endl;
+
+    // All the clients start their replay together, once registered
+    vector<ClientResult> results(nbClients);
+    vector<std::thread> clients;
+    auto startTime = std::chrono::steady_clock::now() + std::chrono::seconds(1);
+    for (int i = 0; i < nbClients; i++)
+        clients.emplace_back(runClient, std::cref(url), std::cref(*source), mode, speed, loops, batchSize, subscribe, startTime,
+                             std::ref(results[i]));
+    for (auto& client : clients)
+        client.join();
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+
+    // Stats of all the clients of the proxy (including the clients of other load generators)
+    ProxyStatsResult proxyStats;
+    bool hasProxyStats = false;
+    {
+        auto stub = SolARMappingAndRelocalizationProxy::NewStub(grpc::CreateChannel(url, grpc::InsecureChannelCredentials()));
+        grpc::ClientContext context;
+        hasProxyStats = stub->GetStats(&context, ClientUUID(), &proxyStats).ok();
+    }
+
+    bool ok = true;
+    for (const auto& result : results) {
+        if (!result.error.empty()) {
+            cerr << "Client " << result.clientUUID << ": " << result.error << endl;
+            ok = false;
+        }
+    }
+
+    if (options.count("output")) {
+        std::ofstream output(options["output"].as<string>());
+        writeReport(output, url, sourcePath, nbClients, speed, loops, batchSize, results, seconds,
+                    hasProxyStats ? &proxyStats.proxy() : nullptr);
+    }
+    else
+        writeReport(cout, url, sourcePath, nbClients, speed, loops, batchSize, results, seconds,
+                    hasProxyStats ? &proxyStats.proxy() : nullptr);
+
+    return ok ? 0 : 1;
+}
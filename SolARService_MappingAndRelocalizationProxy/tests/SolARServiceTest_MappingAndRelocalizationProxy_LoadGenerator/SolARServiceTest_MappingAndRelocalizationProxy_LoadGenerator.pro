@@ -0,0 +1,73 @@
+## remove Qt dependencies
+QT     -= core gui
+CONFIG -= qt
+
+QMAKE_PROJECT_DEPTH = 0
+
+## global defintions : target lib name, version
+TARGET = SolARServiceTest_MappingAndRelocalizationProxy_LoadGenerator
+VERSION=1.0.0
+PROJECTDEPLOYDIR = $${PWD}/../../../deploy
+
+CONFIG += c++1z
+CONFIG += console
+
+DEFINES += MYVERSION=\"\\\"$${VERSION}\\\"\"
+
+include(findremakenrules.pri)
+
+CONFIG(debug,debug|release) {
+    DEFINES += _DEBUG=1
+    DEFINES += DEBUG=1
+}
+
+CONFIG(release,debug|release) {
+    DEFINES += _NDEBUG=1
+    DEFINES += NDEBUG=1
+}
+
+win32:CONFIG -= static
+win32:CONFIG += shared
+
+QMAKE_TARGET.arch = x86_64 #must be defined prior to include
+
+DEPENDENCIESCONFIG = shared install_recurse
+PROJECTCONFIG = QTVS
+
+#NOTE : CONFIG as staticlib or sharedlib, DEPENDENCIESCONFIG as staticlib or sharedlib, QMAKE_TARGET.arch and PROJECTDEPLOYDIR MUST BE DEFINED BEFORE templatelibconfig.pri inclusion
+include ($$shell_quote($$shell_path($${QMAKE_REMAKEN_RULES_ROOT}/templateappconfig.pri)))  # Shell_quote & shell_path required for visual on windows
+
+# Proxy sources used by the load generator (gRPC client stubs, recording reader)
+PROXY_SRC_DIR = $${PWD}/../../src
+INCLUDEPATH += $${PROXY_SRC_DIR}
+
+HEADERS += \
+    $${PROXY_SRC_DIR}/FrameRecording.h \
+    $${PROXY_SRC_DIR}/grpc/solar_mapping_and_relocalization_proxy.grpc.pb.h \
+    $${PROXY_SRC_DIR}/grpc/solar_mapping_and_relocalization_proxy.pb.h
+
+SOURCES += \
+    $${PROXY_SRC_DIR}/FrameRecording.cpp \
+    $${PROXY_SRC_DIR}/grpc/solar_mapping_and_relocalization_proxy.grpc.pb.cc \
+    $${PROXY_SRC_DIR}/grpc/solar_mapping_and_relocalization_proxy.pb.cc \
+    SolARServiceTest_MappingAndRelocalizationProxy_LoadGenerator.cpp
+
+unix {
+    LIBS += -ldl
+}
+
+win32 {
+    QMAKE_LFLAGS += /MACHINE:X64
+    DEFINES += WIN64 UNICODE _UNICODE
+    QMAKE_COMPILER_DEFINES += _WIN64
+
+    # Windows Kit (msvc2013 64)
+    LIBS += -L$$(WINDOWSSDKDIR)lib/winv6.3/um/x64 -lshell32 -lgdi32 -lComdlg32
+    INCLUDEPATH += $$(WINDOWSSDKDIR)lib/winv6.3/um/x64
+}
+
+DISTFILES += \
+    packagedependencies.txt
+
+#NOTE : Must be placed at the end of the .pro
+include ($$shell_quote($$shell_path($${QMAKE_REMAKEN_RULES_ROOT}/remaken_install_target.pri)))) # Shell_quote & shell_path required for visual on windows